@@ -1,75 +1,193 @@
-#include <stddef.h>
-#include <stdio.h>
-#include <stdlib.h>
+#include <string.h>
 #include "base10.h"
-#include "utils.h"
+#include "pasta_fp.h"
+#include "pasta_fq.h"
 
-void decimalint_add(DecimalInt out, const DecimalInt x1, const DecimalInt x2) {
-  uint8_t carry = 0;
+// Numbers are converted 19 digits at a time: 10^19 is the largest power of
+// ten below 2^64, so x has at most five chunks and each one is a single
+// word. The quotient of each step comes from a precomputed reciprocal of
+// 10^19 (Moller and Granlund, "Improved division by invariant integers")
+// rather than a hardware division.
 
-  for (size_t i = 0; i < DIGITS; ++i) {
-    const uint8_t a = x1[i] + x2[i] + carry;
-    out[i] = a % 10;
-    carry = a / 10;
-  }
+#define CHUNK 10000000000000000000ULL   // 10^19, whose top bit is set
+#define CHUNK_INV 0xd83c94fb6d2ac34aULL // floor((2^128 - 1) / 10^19) - 2^64
+#define CHUNK_DIGITS 19
+#define MAX_CHUNKS 5
+
+static const uint64_t POW10[CHUNK_DIGITS + 1] = {
+  1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL,
+  1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+  100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+  1000000000000000000ULL, 10000000000000000000ULL,
+};
+
+static const char DIGIT_PAIRS[201] =
+  "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+  "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+  "8081828384858687888990919293949596979899";
+
+static const uint64_t FP_MODULUS[4] = {
+  0x992d30ed00000001, 0x224698fc094cf91b, 0x0000000000000000, 0x4000000000000000
+};
+static const uint64_t FQ_MODULUS[4] = {
+  0x8c46eb2100000001, 0x224698fc0994a8dd, 0x0000000000000000, 0x4000000000000000
+};
 
-  if (carry != 0) {
-    printf("decimalint_add: overflow");
-    exit(1);
+// (hi * 2^64 + lo) / 10^19 for hi < 10^19, remainder in rem
+static uint64_t div_chunk(uint64_t hi, uint64_t lo, uint64_t *rem) {
+  const unsigned __int128 q = (unsigned __int128)CHUNK_INV * hi + (((unsigned __int128)hi << 64) | lo);
+  uint64_t q1 = (uint64_t)(q >> 64) + 1;
+  const uint64_t q0 = (uint64_t)q;
+  uint64_t r = lo - q1 * CHUNK;
+  if (r > q0) {
+    q1 -= 1;
+    r += CHUNK;
   }
+  if (r >= CHUNK) {
+    q1 += 1;
+    r -= CHUNK;
+  }
+  *rem = r;
+  return q1;
 }
 
-void decimalint_copy(DecimalInt out, const DecimalInt x) {
-  for (size_t i = 0; i < DIGITS; ++i) {
-    out[i] = x[i];
+// The 19 digits of c < 10^19, leading zeros included
+static void chunk_to_digits(char out[CHUNK_DIGITS], uint64_t c) {
+  for (size_t i = CHUNK_DIGITS; i > 1; i -= 2) {
+    memcpy(out + i - 2, DIGIT_PAIRS + 2 * (c % 100), 2);
+    c /= 100;
   }
+  out[0] = (char)('0' + c);
 }
 
-void decimalint_from_bigint(DecimalInt out, const uint64_t x[4]) {
-  const size_t NUM_BITS = 64 * 4;
+size_t bigint_to_decimal(char *out, const uint64_t x[4]) {
+  uint64_t n[4] = { x[0], x[1], x[2], x[3] };
+  uint64_t chunks[MAX_CHUNKS];
+  size_t chunks_len = 0;
+
+  size_t top = 4;
+  while (top > 0 && n[top - 1] == 0) {
+    top -= 1;
+  }
+  do {
+    uint64_t rem = 0;
+    for (size_t i = top; i-- > 0;) {
+      n[i] = div_chunk(rem, n[i], &rem);
+    }
+    chunks[chunks_len++] = rem;
+    while (top > 0 && n[top - 1] == 0) {
+      top -= 1;
+    }
+  } while (top > 0);
+
+  // the leading chunk without its leading zeros, the others whole
+  char lead[CHUNK_DIGITS];
+  chunk_to_digits(lead, chunks[chunks_len - 1]);
+  size_t skip = 0;
+  while (skip < CHUNK_DIGITS - 1 && lead[skip] == '0') {
+    skip += 1;
+  }
+  size_t len = CHUNK_DIGITS - skip;
+  memcpy(out, lead + skip, len);
+  for (size_t i = chunks_len - 1; i-- > 0;) {
+    chunk_to_digits(out + len, chunks[i]);
+    len += CHUNK_DIGITS;
+  }
+  out[len] = '\0';
+  return len;
+}
 
-  DecimalInt tmp;
+bool bigint_to_string(char* out, const uint64_t x[4]) {
+  char tmp[DIGITS + 1];
+  const size_t len = bigint_to_decimal(tmp, x);
+  memcpy(out, tmp, len);
+  return true;
+}
 
-  DecimalInt one;
-  one[0] = 1;
-  for (size_t i = 1; i < DIGITS; ++i) {
-    one[i] = 0;
+void bigint_to_decimal_batch(char (*out)[DIGITS + 1], size_t *len, const uint64_t (*x)[4], size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    const size_t l = bigint_to_decimal(out[i], x[i]);
+    if (len) {
+      len[i] = l;
+    }
   }
+}
 
-  for (size_t i = 0; i < DIGITS; ++i) {
-    out[i] = 0;
+bool bigint_from_decimal(uint64_t out[4], const char *s, size_t len) {
+  if (len == 0 || len > DIGITS) {
+    return false;
   }
 
-  // Double and add
-  for (size_t i = 0; i < NUM_BITS; ++i) {
-    decimalint_add(tmp, out, out);
+  // a short first chunk, so that the rest are whole
+  uint64_t n[4] = { 0, 0, 0, 0 };
+  size_t take = (len % CHUNK_DIGITS) ? len % CHUNK_DIGITS : CHUNK_DIGITS;
+  for (size_t pos = 0; pos < len; pos += take, take = CHUNK_DIGITS) {
+    uint64_t c = 0;
+    for (size_t j = 0; j < take; ++j) {
+      const uint64_t d = (uint64_t)(unsigned char)s[pos + j] - '0';
+      if (d > 9) {
+        return false;
+      }
+      c = 10 * c + d;
+    }
 
-    if (packed_bit_array_get((uint8_t *) x, NUM_BITS - 1 - i)) {
-      decimalint_add(out, tmp, one);
-    } else {
-      decimalint_copy(out, tmp);
+    // n = n * 10^take + c
+    uint64_t carry = c;
+    for (size_t i = 0; i < 4; ++i) {
+      const unsigned __int128 t = (unsigned __int128)n[i] * POW10[take] + carry;
+      n[i] = (uint64_t)t;
+      carry = (uint64_t)(t >> 64);
+    }
+    if (carry) {
+      return false;
     }
   }
+
+  memcpy(out, n, sizeof(n));
+  return true;
 }
 
-void decimalint_to_string(char* out, const DecimalInt x) {
-  int i = DIGITS - 1;
+static bool bigint_lt(const uint64_t a[4], const uint64_t b[4]) {
+  for (size_t i = 4; i-- > 0;) {
+    if (a[i] != b[i]) {
+      return a[i] < b[i];
+    }
+  }
+  return false;
+}
 
-  while (x[i] == 0 && i != 0) {
-    i -= 1;
+bool field_from_decimal(uint64_t out[4], const char *s, size_t len) {
+  uint64_t x[4];
+  if (!bigint_from_decimal(x, s, len) || !bigint_lt(x, FP_MODULUS)) {
+    return false;
   }
+  fiat_pasta_fp_to_montgomery(out, x);
+  return true;
+}
 
-  size_t j = 0;
-  while (i >= 0) {
-    out[j] = '0' + x[i];
+bool scalar_from_decimal(uint64_t out[4], const char *s, size_t len) {
+  uint64_t x[4];
+  if (!bigint_from_decimal(x, s, len) || !bigint_lt(x, FQ_MODULUS)) {
+    return false;
+  }
+  fiat_pasta_fq_to_montgomery(out, x);
+  return true;
+}
 
-    i -= 1;
-    j += 1;
+size_t field_from_decimal_batch(uint64_t (*out)[4], const char *const *s, const size_t *len, size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    if (!field_from_decimal(out[i], s[i], len[i])) {
+      return i;
+    }
   }
+  return n;
 }
 
-void bigint_to_string(char* out, const uint64_t x[4]) {
-  DecimalInt tmp;
-  decimalint_from_bigint(tmp, x);
-  decimalint_to_string(out, tmp);
+size_t scalar_from_decimal_batch(uint64_t (*out)[4], const char *const *s, const size_t *len, size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    if (!scalar_from_decimal(out[i], s[i], len[i])) {
+      return i;
+    }
+  }
+  return n;
 }
@@ -1,6 +1,29 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #define DIGITS 78
 
-typedef uint8_t DecimalInt[DIGITS];
+// Writes the decimal digits of x, returns false if there are more than DIGITS
+bool bigint_to_string(char* out, const uint64_t x[4]);
+
+// Writes the decimal digits of x and a terminator, returns the number of
+// digits. out holds DIGITS + 1 chars.
+size_t bigint_to_decimal(char *out, const uint64_t x[4]);
+
+// bigint_to_decimal of each x[i], with the lengths in len if it is not NULL
+void bigint_to_decimal_batch(char (*out)[DIGITS + 1], size_t *len, const uint64_t (*x)[4], size_t n);
+
+// The integer written by s[0, len): false unless it is 1 to DIGITS decimal
+// digits of a value below 2^256
+bool bigint_from_decimal(uint64_t out[4], const char *s, size_t len);
+
+// The element of Fp or Fq written by s[0, len), in Montgomery form: false
+// unless it is decimal digits of a value below the modulus
+bool field_from_decimal(uint64_t out[4], const char *s, size_t len);
+bool scalar_from_decimal(uint64_t out[4], const char *s, size_t len);
 
-void bigint_to_string(char* out, const uint64_t x[4]);
+// The same for n strings, returns the index of the first that fails or n
+size_t field_from_decimal_batch(uint64_t (*out)[4], const char *const *s, const size_t *len, size_t n);
+size_t scalar_from_decimal_batch(uint64_t (*out)[4], const char *const *s, const size_t *len, size_t n);
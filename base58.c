@@ -17,8 +17,7 @@
 #include <string.h>
 
 #include "libbase58.h"
-
-bool (*b58_sha256_impl)(void *, const void *, size_t) = NULL;
+#include "sha256.h"
 
 static const int8_t b58digits_map[] = {
 	-1,-1,-1,-1,-1,-1,-1,-1, -1,-1,-1,-1,-1,-1,-1,-1,
@@ -116,7 +115,9 @@ static
 bool my_dblsha256(void *hash, const void *data, size_t datasz)
 {
 	uint8_t buf[0x20];
-	return b58_sha256_impl(buf, data, datasz) && b58_sha256_impl(hash, buf, sizeof(buf));
+	sha256(buf, data, datasz);
+	sha256(hash, buf, sizeof(buf));
+	return true;
 }
 
 int b58check(const void *bin, size_t binsz, const char *base58str, size_t b58sz)
@@ -140,7 +141,7 @@ int b58check(const void *bin, size_t binsz, const char *base58str, size_t b58sz)
 	return binc[0];
 }
 
-static const char b58digits_ordered[] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+const char b58digits_ordered[] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
 
 bool b58enc(char *b58, size_t *b58sz, const void *data, size_t binsz)
 {
@@ -0,0 +1,67 @@
+// Micro-benchmarks for the signer
+//
+//     ./bench.out [name ...]
+//
+// runs the named benchmarks (all of them by default). Inputs are generated
+// with a fixed-seed xorshift so runs are comparable.
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <time.h>
+#include "pool.h"
+
+static inline uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+uint64_t bench_rand(void);
+
+// Random element of Fp or Fq in Montgomery form (< 2^254, so always reduced)
+void bench_rand_field(uint64_t out[4]);
+
+// Random scalar in Montgomery form
+void bench_rand_scalar(uint64_t out[4]);
+
+// Random payment between random keys, and a random keypair
+struct transaction;
+struct keypair;
+void bench_rand_transaction(struct transaction *txn);
+void bench_rand_keypair(struct keypair *kp);
+
+// bench_now_ns() that also starts counting operations on this thread, for
+// the next bench_report
+uint64_t bench_start(void);
+
+// Prints "name: ns/op, op/s" for iters operations taking ns nanoseconds.
+// In a build with -DMINA_OP_COUNT it follows with the operations per op
+// counted since bench_start (opcount.h).
+void bench_report(const char *name, size_t iters, uint64_t ns);
+
+// Times run(pool, ctx) on pools of 1, 2, 4, ... threads up to the number of
+// cores, each worker with scratch_bytes of scratch, and reports each run of
+// iters operations as "label (N threads)" with its speedup over one thread
+void bench_scaling(const char *label, size_t iters, size_t scratch_bytes, void (*run)(Pool *pool, void *ctx),
+                   void *ctx);
+
+void bench_sqrt(void);
+void bench_legendre(void);
+void bench_pow(void);
+void bench_normalize(void);
+void bench_pubkey(void);
+void bench_complete(void);
+void bench_sign(void);
+void bench_pool(void);
+void bench_random(void);
+void bench_keygen(void);
+void bench_hd(void);
+void bench_vanity(void);
+void bench_decimal(void);
+void bench_encoding(void);
+void bench_keycache(void);
+void bench_verify(void);
@@ -0,0 +1,65 @@
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "base10.h"
+#include "pasta_fp.h"
+
+#define DECIMAL_INPUTS 4096
+#define DECIMAL_ROUNDS 16
+
+void bench_decimal(void)
+{
+    uint64_t (*values)[4] = malloc(sizeof(uint64_t[4]) * DECIMAL_INPUTS);
+    uint64_t (*parsed)[4] = malloc(sizeof(uint64_t[4]) * DECIMAL_INPUTS);
+    char (*strs)[DIGITS + 1] = malloc(sizeof(char[DIGITS + 1]) * DECIMAL_INPUTS);
+    const char **ptrs = malloc(sizeof(char *) * DECIMAL_INPUTS);
+    size_t *lens = malloc(sizeof(size_t) * DECIMAL_INPUTS);
+    size_t total = 0, failed = 0;
+
+    // canonical field elements, the values signatures print
+    for (size_t i = 0; i < DECIMAL_INPUTS; ++i) {
+        uint64_t m[4];
+        bench_rand_field(m);
+        fiat_pasta_fp_from_montgomery(values[i], m);
+    }
+
+    uint64_t start = bench_now_ns();
+    for (size_t r = 0; r < DECIMAL_ROUNDS; ++r) {
+        for (size_t i = 0; i < DECIMAL_INPUTS; ++i) {
+            total += bigint_to_decimal(strs[i], values[i]);
+        }
+    }
+    bench_report("bigint_to_decimal", DECIMAL_INPUTS * DECIMAL_ROUNDS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (size_t r = 0; r < DECIMAL_ROUNDS; ++r) {
+        bigint_to_decimal_batch(strs, lens, (const uint64_t (*)[4])values, DECIMAL_INPUTS);
+    }
+    bench_report("bigint_to_decimal_batch", DECIMAL_INPUTS * DECIMAL_ROUNDS, bench_now_ns() - start);
+
+    for (size_t i = 0; i < DECIMAL_INPUTS; ++i) {
+        ptrs[i] = strs[i];
+    }
+
+    start = bench_now_ns();
+    for (size_t r = 0; r < DECIMAL_ROUNDS; ++r) {
+        for (size_t i = 0; i < DECIMAL_INPUTS; ++i) {
+            failed += !bigint_from_decimal(parsed[i], ptrs[i], lens[i]);
+        }
+    }
+    bench_report("bigint_from_decimal", DECIMAL_INPUTS * DECIMAL_ROUNDS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (size_t r = 0; r < DECIMAL_ROUNDS; ++r) {
+        failed += DECIMAL_INPUTS - field_from_decimal_batch(parsed, ptrs, lens, DECIMAL_INPUTS);
+    }
+    bench_report("field_from_decimal_batch", DECIMAL_INPUTS * DECIMAL_ROUNDS, bench_now_ns() - start);
+
+    printf("%zu digits written, %zu parses failed\n", total, failed);
+
+    free(values);
+    free(parsed);
+    free(strs);
+    free(ptrs);
+    free(lens);
+}
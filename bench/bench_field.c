@@ -0,0 +1,242 @@
+#include <stdbool.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "pasta_fp.h"
+#include "pasta_fq.h"
+
+#define SQRT_INPUTS 4096
+#define SQRT_ROUNDS 16
+
+void bench_sqrt(void)
+{
+    uint64_t (*squares)[4] = malloc(sizeof(uint64_t[4]) * SQRT_INPUTS);
+    uint64_t (*randoms)[4] = malloc(sizeof(uint64_t[4]) * SQRT_INPUTS);
+    uint64_t out[4];
+    size_t residues = 0;
+
+    for (size_t i = 0; i < SQRT_INPUTS; ++i) {
+        bench_rand_field(randoms[i]);
+        fiat_pasta_fp_square(squares[i], randoms[i]);
+    }
+
+    // warm up (builds the tables)
+    fiat_pasta_fp_sqrt(out, squares[0]);
+
+    uint64_t start = bench_start();
+    for (size_t r = 0; r < SQRT_ROUNDS; ++r) {
+        for (size_t i = 0; i < SQRT_INPUTS; ++i) {
+            fiat_pasta_fp_sqrt(out, squares[i]);
+        }
+    }
+    bench_report("fiat_pasta_fp_sqrt (squares)", SQRT_INPUTS * SQRT_ROUNDS, bench_now_ns() - start);
+
+    start = bench_start();
+    for (size_t r = 0; r < SQRT_ROUNDS; ++r) {
+        for (size_t i = 0; i < SQRT_INPUTS; ++i) {
+            residues += fiat_pasta_fp_sqrt(out, randoms[i]);
+        }
+    }
+    bench_report("fiat_pasta_fp_sqrt (random)", SQRT_INPUTS * SQRT_ROUNDS, bench_now_ns() - start);
+
+    for (size_t i = 0; i < SQRT_INPUTS; ++i) {
+        fiat_pasta_fq_square(squares[i], randoms[i]);
+    }
+    fiat_pasta_fq_sqrt(out, squares[0]);
+
+    start = bench_start();
+    for (size_t r = 0; r < SQRT_ROUNDS; ++r) {
+        for (size_t i = 0; i < SQRT_INPUTS; ++i) {
+            fiat_pasta_fq_sqrt(out, squares[i]);
+        }
+    }
+    bench_report("fiat_pasta_fq_sqrt (squares)", SQRT_INPUTS * SQRT_ROUNDS, bench_now_ns() - start);
+
+    printf("%zu of %d random inputs were squares\n", residues, SQRT_INPUTS * SQRT_ROUNDS);
+
+    free(squares);
+    free(randoms);
+}
+
+#define LEGENDRE_INPUTS 4096
+#define LEGENDRE_ROUNDS 8
+
+// Exponents as little-endian limbs
+static const uint64_t FP_P_MINUS_2[4] = {
+    0x992d30ecffffffff, 0x224698fc094cf91b, 0x0000000000000000, 0x4000000000000000
+};
+static const uint64_t FP_P_MINUS_1_DIV_2[4] = {
+    0xcc96987680000000, 0x11234c7e04a67c8d, 0x0000000000000000, 0x2000000000000000
+};
+static const uint64_t FP_T_MINUS_1_DIV_2[4] = {
+    0x04a67c8dcc969876, 0x0000000011234c7e, 0x0000000000000000, 0x0000000020000000
+};
+static const uint64_t FQ_Q_MINUS_2[4] = {
+    0x8c46eb20ffffffff, 0x224698fc0994a8dd, 0x0000000000000000, 0x4000000000000000
+};
+static const uint64_t FQ_Q_MINUS_1_DIV_2[4] = {
+    0xc623759080000000, 0x11234c7e04ca546e, 0x0000000000000000, 0x2000000000000000
+};
+static const uint64_t FQ_T_MINUS_1_DIV_2[4] = {
+    0x04ca546ec6237590, 0x0000000011234c7e, 0x0000000000000000, 0x0000000020000000
+};
+
+// most significant bit first, as taken by the bool-array pow
+static size_t limbs_to_msb_bits(bool *bits, const uint64_t limbs[4])
+{
+    size_t len = 256;
+    while (len > 0 && !((limbs[(len - 1) / 64] >> ((len - 1) % 64)) & 1)) {
+        len -= 1;
+    }
+    for (size_t i = 0; i < len; ++i) {
+        const size_t j = len - 1 - i;
+        bits[i] = (limbs[j / 64] >> (j % 64)) & 1;
+    }
+    return len;
+}
+
+// The square-and-multiply over a bool array of exponent bits (most
+// significant first) that the library used before the addition chains;
+// kept here as the baseline.
+static void fp_pow_bool(uint64_t out[4], const uint64_t x[4], const bool *msb_bits, size_t bits_len)
+{
+    uint64_t tmp[4];
+    fiat_pasta_fp_set_one(out);
+    for (size_t i = 0; i < bits_len; ++i) {
+        fiat_pasta_fp_copy(tmp, out);
+        fiat_pasta_fp_square(out, tmp);
+        if (msb_bits[i]) {
+            fiat_pasta_fp_copy(tmp, out);
+            fiat_pasta_fp_mul(out, tmp, x);
+        }
+    }
+}
+
+static void fq_pow_bool(uint64_t out[4], const uint64_t x[4], const bool *msb_bits, size_t bits_len)
+{
+    uint64_t tmp[4];
+    fiat_pasta_fq_set_one(out);
+    for (size_t i = 0; i < bits_len; ++i) {
+        fiat_pasta_fq_copy(tmp, out);
+        fiat_pasta_fq_square(out, tmp);
+        if (msb_bits[i]) {
+            fiat_pasta_fq_copy(tmp, out);
+            fiat_pasta_fq_mul(out, tmp, x);
+        }
+    }
+}
+
+void bench_legendre(void)
+{
+    uint64_t (*inputs)[4] = malloc(sizeof(uint64_t[4]) * LEGENDRE_INPUTS);
+    bool bits[256];
+    size_t bits_len;
+    uint64_t out[4];
+    int sum = 0;
+
+    for (size_t i = 0; i < LEGENDRE_INPUTS; ++i) {
+        bench_rand_field(inputs[i]);
+    }
+
+    uint64_t start = bench_start();
+    for (size_t r = 0; r < LEGENDRE_ROUNDS; ++r) {
+        for (size_t i = 0; i < LEGENDRE_INPUTS; ++i) {
+            sum += fiat_pasta_fp_legendre(inputs[i]);
+        }
+    }
+    bench_report("fiat_pasta_fp_legendre", LEGENDRE_INPUTS * LEGENDRE_ROUNDS, bench_now_ns() - start);
+
+    bits_len = limbs_to_msb_bits(bits, FP_P_MINUS_1_DIV_2);
+    start = bench_start();
+    for (size_t i = 0; i < LEGENDRE_INPUTS; ++i) {
+        fp_pow_bool(out, inputs[i], bits, bits_len);
+        sum += fiat_pasta_fp_equals_one(out);
+    }
+    bench_report("fp x^((p - 1) / 2)", LEGENDRE_INPUTS, bench_now_ns() - start);
+
+    start = bench_start();
+    for (size_t r = 0; r < LEGENDRE_ROUNDS; ++r) {
+        for (size_t i = 0; i < LEGENDRE_INPUTS; ++i) {
+            sum += fiat_pasta_fq_legendre(inputs[i]);
+        }
+    }
+    bench_report("fiat_pasta_fq_legendre", LEGENDRE_INPUTS * LEGENDRE_ROUNDS, bench_now_ns() - start);
+
+    uint64_t one[4];
+    fiat_pasta_fq_set_one(one);
+    bits_len = limbs_to_msb_bits(bits, FQ_Q_MINUS_1_DIV_2);
+    start = bench_start();
+    for (size_t i = 0; i < LEGENDRE_INPUTS; ++i) {
+        fq_pow_bool(out, inputs[i], bits, bits_len);
+        sum += fiat_pasta_fq_equals(out, one);
+    }
+    bench_report("fq x^((q - 1) / 2)", LEGENDRE_INPUTS, bench_now_ns() - start);
+
+    printf("(checksum %d)\n", sum);
+
+    free(inputs);
+}
+
+#define POW_INPUTS 2048
+
+typedef struct pow_case {
+    const char *name;
+    const uint64_t *exp;
+    void (*chain)(uint64_t out[4], const uint64_t x[4]);
+    void (*window)(uint64_t out[4], const uint64_t x[4], const uint64_t *exp, const size_t exp_limbs);
+    void (*bool_array)(uint64_t out[4], const uint64_t x[4], const bool *msb_bits, size_t bits_len);
+} PowCase;
+
+static const PowCase POW_CASES[] = {
+    { "fp p - 2", FP_P_MINUS_2, fiat_pasta_fp_pow_p_minus_2, fiat_pasta_fp_pow, fp_pow_bool },
+    { "fp (p - 1) / 2", FP_P_MINUS_1_DIV_2, fiat_pasta_fp_pow_p_minus_1_div_2, fiat_pasta_fp_pow, fp_pow_bool },
+    { "fp (t - 1) / 2", FP_T_MINUS_1_DIV_2, fiat_pasta_fp_pow_t_minus_1_div_2, fiat_pasta_fp_pow, fp_pow_bool },
+    { "fq q - 2", FQ_Q_MINUS_2, fiat_pasta_fq_pow_q_minus_2, fiat_pasta_fq_pow, fq_pow_bool },
+    { "fq (q - 1) / 2", FQ_Q_MINUS_1_DIV_2, fiat_pasta_fq_pow_q_minus_1_div_2, fiat_pasta_fq_pow, fq_pow_bool },
+    { "fq (t - 1) / 2", FQ_T_MINUS_1_DIV_2, fiat_pasta_fq_pow_t_minus_1_div_2, fiat_pasta_fq_pow, fq_pow_bool },
+};
+
+void bench_pow(void)
+{
+    uint64_t (*inputs)[4] = malloc(sizeof(uint64_t[4]) * POW_INPUTS);
+    uint64_t out[4];
+    uint64_t check = 0;
+    bool bits[256];
+    char name[64];
+
+    for (size_t i = 0; i < POW_INPUTS; ++i) {
+        bench_rand_field(inputs[i]);
+    }
+
+    for (size_t c = 0; c < sizeof(POW_CASES) / sizeof(POW_CASES[0]); ++c) {
+        const PowCase *pc = &POW_CASES[c];
+        const size_t bits_len = limbs_to_msb_bits(bits, pc->exp);
+
+        uint64_t start = bench_start();
+        for (size_t i = 0; i < POW_INPUTS; ++i) {
+            pc->chain(out, inputs[i]);
+            check ^= out[0];
+        }
+        snprintf(name, sizeof(name), "%s (addition chain)", pc->name);
+        bench_report(name, POW_INPUTS, bench_now_ns() - start);
+
+        start = bench_start();
+        for (size_t i = 0; i < POW_INPUTS; ++i) {
+            pc->window(out, inputs[i], pc->exp, 4);
+            check ^= out[0];
+        }
+        snprintf(name, sizeof(name), "%s (sliding window)", pc->name);
+        bench_report(name, POW_INPUTS, bench_now_ns() - start);
+
+        start = bench_start();
+        for (size_t i = 0; i < POW_INPUTS; ++i) {
+            pc->bool_array(out, inputs[i], bits, bits_len);
+            check ^= out[0];
+        }
+        snprintf(name, sizeof(name), "%s (bool array)", pc->name);
+        bench_report(name, POW_INPUTS, bench_now_ns() - start);
+    }
+
+    printf("(checksum %lx)\n", check);
+
+    free(inputs);
+}
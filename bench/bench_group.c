@@ -0,0 +1,204 @@
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "crypto.h"
+#include "pasta_fp.h"
+#include "pasta_fq.h"
+
+static const Affine GENERATOR = {
+    { 0x34786d38fffffffd, 0x992c350be41914ad, 0xffffffffffffffff, 0x3fffffffffffffff },
+    { 0x2f474795455d409d, 0xb443b9b74b8255d9, 0x270c412f2c9a5d66, 0x8e00f71ba43dd6b }
+};
+
+void bench_rand_scalar(uint64_t out[4])
+{
+    bench_rand_field(out);
+}
+
+#define NORMALIZE_POINTS 4096
+
+void bench_normalize(void)
+{
+    static const size_t SIZES[] = { 8, 64, 4096 };
+
+    Group *points = malloc(sizeof(Group) * NORMALIZE_POINTS);
+    Affine *out = malloc(sizeof(Affine) * NORMALIZE_POINTS);
+    char name[64];
+
+    for (size_t i = 0; i < NORMALIZE_POINTS; ++i) {
+        Scalar k;
+        bench_rand_scalar(k);
+        generator_scalar_mul(&points[i], k);
+    }
+
+    for (size_t s = 0; s < sizeof(SIZES) / sizeof(SIZES[0]); ++s) {
+        const size_t n = SIZES[s];
+        const size_t rounds = NORMALIZE_POINTS / n;
+
+        uint64_t start = bench_start();
+        for (size_t r = 0; r < rounds; ++r) {
+            for (size_t i = 0; i < n; ++i) {
+                projective_to_affine(&out[i], &points[r * n + i]);
+            }
+        }
+        snprintf(name, sizeof(name), "projective_to_affine n=%zu", n);
+        bench_report(name, rounds * n, bench_now_ns() - start);
+
+        start = bench_start();
+        for (size_t r = 0; r < rounds; ++r) {
+            projective_to_affine_batch(out, &points[r * n], n);
+        }
+        snprintf(name, sizeof(name), "projective_to_affine_batch n=%zu", n);
+        bench_report(name, rounds * n, bench_now_ns() - start);
+    }
+
+    free(points);
+    free(out);
+}
+
+#define PUBKEY_INPUTS 1024
+
+void bench_pubkey(void)
+{
+    Scalar *keys = malloc(sizeof(Scalar) * PUBKEY_INPUTS);
+    Affine *pubs = malloc(sizeof(Affine) * PUBKEY_INPUTS);
+
+    for (size_t i = 0; i < PUBKEY_INPUTS; ++i) {
+        bench_rand_scalar(keys[i]);
+    }
+
+    // the generator table is linked in, so the first call has only cold
+    // caches to pay for rather than building it
+    uint64_t start = bench_start();
+    generate_pubkey(&pubs[0], keys[0]);
+    bench_report("generate_pubkey (first call)", 1, bench_now_ns() - start);
+
+    start = bench_start();
+    for (size_t i = 0; i < PUBKEY_INPUTS / 8; ++i) {
+        affine_scalar_mul(&pubs[i], keys[i], &GENERATOR);
+    }
+    bench_report("affine_scalar_mul(g)", PUBKEY_INPUTS / 8, bench_now_ns() - start);
+
+    start = bench_start();
+    for (size_t i = 0; i < PUBKEY_INPUTS; ++i) {
+        generate_pubkey(&pubs[i], keys[i]);
+    }
+    bench_report("generate_pubkey", PUBKEY_INPUTS, bench_now_ns() - start);
+
+    start = bench_start();
+    generate_pubkeys(pubs, keys, PUBKEY_INPUTS);
+    bench_report("generate_pubkeys", PUBKEY_INPUTS, bench_now_ns() - start);
+
+    Compressed *compressed = malloc(sizeof(Compressed) * PUBKEY_INPUTS);
+    for (size_t i = 0; i < PUBKEY_INPUTS; ++i) {
+        uint64_t y[4];
+        field_copy(compressed[i].x, pubs[i].x);
+        fiat_pasta_fp_from_montgomery(y, pubs[i].y);
+        compressed[i].is_odd = y[0] & 1;
+    }
+
+    start = bench_start();
+    for (size_t i = 0; i < PUBKEY_INPUTS; ++i) {
+        affine_decompress(&pubs[i], &compressed[i]);
+    }
+    bench_report("affine_decompress", PUBKEY_INPUTS, bench_now_ns() - start);
+    free(compressed);
+
+    free(keys);
+    free(pubs);
+}
+
+#define COMPLETE_MULS 64
+#define COMPLETE_MSM 64
+
+// The Jacobian MSM, shared doublings and mixed additions as in
+// homogeneous_msm. group_madd_affine returns the identity when the sum
+// meets its own point, which random inputs never do.
+static void jacobian_msm(Group *r, const Scalar *k, const Affine *p, size_t n)
+{
+    uint64_t k_bits[COMPLETE_MSM][4];
+    for (size_t i = 0; i < n; ++i) {
+        fiat_pasta_fq_from_montgomery(k_bits[i], k[i]);
+    }
+
+    Group acc, tmp;
+    const Affine zero = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } };
+    affine_to_projective(&acc, &zero);
+    for (size_t bit = FIELD_SIZE_IN_BITS; bit-- > 0;) {
+        group_dbl(&tmp, &acc);
+        acc = tmp;
+        for (size_t i = 0; i < n; ++i) {
+            if ((k_bits[i][bit / 64] >> (bit % 64)) & 1) {
+                group_madd_affine(&tmp, &acc, &p[i]);
+                acc = tmp;
+            }
+        }
+    }
+    *r = acc;
+}
+
+// Jacobian against the complete homogeneous formulas, in variable-time
+// double-and-add, constant-time double-and-add and the MSM
+void bench_complete(void)
+{
+    Scalar *ks = malloc(sizeof(Scalar) * COMPLETE_MSM);
+    Affine *ps = malloc(sizeof(Affine) * COMPLETE_MSM);
+    Group *gs = malloc(sizeof(Group) * COMPLETE_MSM);
+    Homogeneous *hs = malloc(sizeof(Homogeneous) * COMPLETE_MSM);
+    for (size_t i = 0; i < COMPLETE_MSM; ++i) {
+        Scalar k;
+        bench_rand_scalar(ks[i]);
+        bench_rand_scalar(k);
+        affine_scalar_mul(&ps[i], k, &GENERATOR);
+        affine_to_projective(&gs[i], &ps[i]);
+        affine_to_homogeneous(&hs[i], &ps[i]);
+    }
+
+    Group g;
+    uint64_t start = bench_start();
+    for (size_t i = 0; i < COMPLETE_MULS; ++i) {
+        group_scalar_mul(&g, ks[i], &gs[i]);
+    }
+    bench_report("group_scalar_mul (Jacobian)", COMPLETE_MULS, bench_now_ns() - start);
+
+    // the same double-and-add with the complete formulas
+    Homogeneous h;
+    start = bench_start();
+    for (size_t i = 0; i < COMPLETE_MULS; ++i) {
+        uint64_t k_bits[4];
+        fiat_pasta_fq_from_montgomery(k_bits, ks[i]);
+        affine_to_homogeneous(&h, &(const Affine){ { 0, 0, 0, 0 }, { 0, 0, 0, 0 } });
+        for (size_t bit = FIELD_SIZE_IN_BITS; bit-- > 0;) {
+            homogeneous_dbl(&h, &h);
+            if ((k_bits[bit / 64] >> (bit % 64)) & 1) {
+                homogeneous_add(&h, &h, &hs[i]);
+            }
+        }
+    }
+    bench_report("  complete, variable time", COMPLETE_MULS, bench_now_ns() - start);
+
+    start = bench_start();
+    for (size_t i = 0; i < COMPLETE_MULS; ++i) {
+        homogeneous_scalar_mul(&h, ks[i], &hs[i]);
+    }
+    bench_report("homogeneous_scalar_mul (constant time)", COMPLETE_MULS, bench_now_ns() - start);
+
+    start = bench_start();
+    jacobian_msm(&g, ks, ps, COMPLETE_MSM);
+    bench_report("MSM n=64, Jacobian (per point)", COMPLETE_MSM, bench_now_ns() - start);
+
+    start = bench_start();
+    homogeneous_msm(&h, ks, ps, COMPLETE_MSM);
+    bench_report("homogeneous_msm n=64 (per point)", COMPLETE_MSM, bench_now_ns() - start);
+
+    // both MSMs agree
+    Affine a, b;
+    projective_to_affine(&a, &g);
+    homogeneous_to_affine(&b, &h);
+    printf("MSMs %s\n", memcmp(&a, &b, sizeof(Affine)) == 0 ? "agree" : "DIFFER");
+
+    free(ks);
+    free(ps);
+    free(gs);
+    free(hs);
+}
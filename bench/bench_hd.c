@@ -0,0 +1,57 @@
+#include <stdlib.h>
+#include "bench.h"
+#include "bip32.h"
+
+#define HD_ACCOUNTS 512
+
+typedef struct hd_bench {
+    Keypair *kps;
+    const MinaHdWallet *wallet;
+    MinaStatus *results;
+} HdBench;
+
+static void hd_bench_run(Pool *pool, void *ctx)
+{
+    HdBench *b = ctx;
+    mina_hd_keypairs_pool(pool, b->kps, b->wallet, 0, HD_ACCOUNTS, b->results);
+}
+
+void bench_hd(void)
+{
+    uint8_t seed[64];
+    for (size_t i = 0; i < sizeof(seed); ++i) {
+        seed[i] = (uint8_t)bench_rand();
+    }
+
+    Bip32Node master;
+    MinaHdWallet wallet;
+    bip32_master(&master, seed, sizeof(seed));
+    mina_hd_init(&wallet, seed, sizeof(seed));
+
+    Keypair *kps = malloc(sizeof(Keypair) * HD_ACCOUNTS);
+    MinaStatus *results = malloc(sizeof(MinaStatus) * HD_ACCOUNTS);
+
+    // warm up the fixed-base tables
+    mina_hd_keypairs(kps, &wallet, 0, 1, results);
+
+    // every account from the master node, one at a time
+    uint64_t start = bench_now_ns();
+    for (uint32_t i = 0; i < HD_ACCOUNTS / 8; ++i) {
+        const uint32_t path[BIP32_PATH_LEN] = {
+            44 | BIP32_HARDENED_OFFSET, MINA_COIN_TYPE | BIP32_HARDENED_OFFSET, i | BIP32_HARDENED_OFFSET, 0, 0
+        };
+        Bip32Node node;
+        bip32_derive_path(&node, &master, path, BIP32_PATH_LEN);
+    }
+    bench_report("bip32_derive_path (secp256k1 only)", HD_ACCOUNTS / 8, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    mina_hd_keypairs(kps, &wallet, 0, HD_ACCOUNTS, results);
+    bench_report("mina_hd_keypairs", HD_ACCOUNTS, bench_now_ns() - start);
+
+    HdBench b = { kps, &wallet, results };
+    bench_scaling("mina_hd_keypairs_pool", HD_ACCOUNTS, 0, hd_bench_run, &b);
+
+    free(kps);
+    free(results);
+}
@@ -0,0 +1,53 @@
+#include <stdlib.h>
+#include "bench.h"
+#include "crypto.h"
+#include "keycache.h"
+
+#define KEYCACHE_KEYS 200000
+#define KEYCACHE_LOOKUPS 2000000
+
+// Lookups only hash and compare public keys, so the keys are random
+// fields rather than points, which would take minutes to generate
+void bench_keycache(void)
+{
+    Keypair *kps = malloc(sizeof(Keypair) * KEYCACHE_KEYS);
+    Compressed *pubs = malloc(sizeof(Compressed) * KEYCACHE_KEYS);
+    PreparedKey key;
+    for (size_t i = 0; i < KEYCACHE_KEYS; ++i) {
+        bench_rand_scalar(kps[i].priv);
+        bench_rand_field(kps[i].pub.x);
+        bench_rand_field(kps[i].pub.y);
+        prepared_key_init(&key, &kps[i]);
+        pubs[i] = key.pub;
+    }
+
+    KeyCache *cache = key_cache_create(0);
+    uint64_t start = bench_now_ns();
+    for (size_t i = 0; i < KEYCACHE_KEYS; ++i) {
+        key_cache_insert(cache, &kps[i]);
+    }
+    bench_report("key_cache_insert (prepares the key)", KEYCACHE_KEYS, bench_now_ns() - start);
+
+    // random keys, so most lookups miss the CPU caches as a custody
+    // signer's would
+    size_t found = 0;
+    start = bench_now_ns();
+    for (size_t i = 0; i < KEYCACHE_LOOKUPS; ++i) {
+        found += key_cache_find(cache, &pubs[bench_rand() % KEYCACHE_KEYS]) != NULL;
+    }
+    bench_report("key_cache_find (200k keys)", KEYCACHE_LOOKUPS, bench_now_ns() - start);
+
+    Compressed absent = pubs[0];
+    absent.is_odd = !absent.is_odd;
+    start = bench_now_ns();
+    for (size_t i = 0; i < KEYCACHE_LOOKUPS; ++i) {
+        absent.x[0] = bench_rand();
+        found += key_cache_find(cache, &absent) != NULL;
+    }
+    bench_report("key_cache_find (absent)", KEYCACHE_LOOKUPS, bench_now_ns() - start);
+    printf("%zu of %d lookups found a key\n", found, 2 * KEYCACHE_LOOKUPS);
+
+    free(pubs);
+    key_cache_destroy(cache);
+    free(kps);
+}
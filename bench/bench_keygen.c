@@ -0,0 +1,74 @@
+#include <stdlib.h>
+#include "bench.h"
+#include "crypto.h"
+#include "libbase58.h"
+#include "pasta_fp.h"
+
+#define KEYGEN_N 2048
+
+// Address through the generic base58check encoder
+static void reference_address(char *out, const Affine *pub)
+{
+    uint8_t payload[35];
+    uint64_t x[4], y[4];
+
+    payload[0] = 0x01;
+    payload[1] = 0x01;
+    fiat_pasta_fp_from_montgomery(x, pub->x);
+    fiat_pasta_fp_from_montgomery(y, pub->y);
+    for (size_t i = 0; i < 32; ++i) {
+        payload[2 + i] = (uint8_t)(x[i / 8] >> (8 * (i % 8)));
+    }
+    payload[34] = y[0] & 1;
+
+    size_t len = MINA_ADDRESS_LEN;
+    b58check_enc(out, &len, 0xcb, payload, sizeof(payload));
+}
+
+typedef struct keygen_bench {
+    Keypair *kps;
+    char (*addresses)[MINA_ADDRESS_LEN];
+} KeygenBench;
+
+static void keygen_bench_run(Pool *pool, void *ctx)
+{
+    KeygenBench *b = ctx;
+    generate_keypairs_pool(pool, b->kps, b->addresses, KEYGEN_N);
+}
+
+void bench_keygen(void)
+{
+    Keypair *kps = malloc(sizeof(Keypair) * KEYGEN_N);
+    char (*addresses)[MINA_ADDRESS_LEN] = malloc(MINA_ADDRESS_LEN * KEYGEN_N);
+
+    // builds the generator table
+    generate_keypair(&kps[0], 0);
+
+    uint64_t start = bench_now_ns();
+    for (size_t i = 0; i < KEYGEN_N / 8; ++i) {
+        generate_keypair(&kps[i], 0);
+    }
+    bench_report("generate_keypair", KEYGEN_N / 8, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    generate_keypairs(kps, KEYGEN_N);
+    bench_report("generate_keypairs", KEYGEN_N, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (size_t i = 0; i < KEYGEN_N; ++i) {
+        reference_address(addresses[i], &kps[i].pub);
+    }
+    bench_report("b58check_enc address", KEYGEN_N, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (size_t i = 0; i < KEYGEN_N; ++i) {
+        get_address(addresses[i], MINA_ADDRESS_LEN, &kps[i].pub);
+    }
+    bench_report("get_address", KEYGEN_N, bench_now_ns() - start);
+
+    KeygenBench b = { kps, addresses };
+    bench_scaling("keys + addresses", KEYGEN_N, 0, keygen_bench_run, &b);
+
+    free(kps);
+    free(addresses);
+}
@@ -0,0 +1,42 @@
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "crypto.h"
+
+#define POOL_TXNS 1024
+#define POOL_KEYS 16
+
+typedef struct pool_bench {
+    const Keypair *kps;
+    const Transaction *txns;
+    Signature *sigs;
+} PoolBench;
+
+static void pool_bench_run(Pool *pool, void *ctx)
+{
+    PoolBench *b = ctx;
+    sign_batch_pool(pool, b->kps, 1, b->txns, POOL_TXNS, b->sigs);
+}
+
+void bench_pool(void)
+{
+    Transaction *txns = malloc(sizeof(Transaction) * POOL_TXNS);
+    Keypair *kps = malloc(sizeof(Keypair) * POOL_TXNS);
+    Signature *sigs = malloc(sizeof(Signature) * POOL_TXNS);
+    Keypair keys[POOL_KEYS];
+
+    for (size_t i = 0; i < POOL_KEYS; ++i) {
+        bench_rand_keypair(&keys[i]);
+    }
+    for (size_t i = 0; i < POOL_TXNS; ++i) {
+        bench_rand_transaction(&txns[i]);
+        kps[i] = keys[bench_rand() % POOL_KEYS];
+    }
+
+    PoolBench b = { kps, txns, sigs };
+    bench_scaling("sign_batch_pool", POOL_TXNS, sizeof(SignBatchScratch), pool_bench_run, &b);
+
+    free(txns);
+    free(kps);
+    free(sigs);
+}
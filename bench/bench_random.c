@@ -0,0 +1,49 @@
+#include <stdlib.h>
+#include "bench.h"
+#include "crypto.h"
+#include "random.h"
+
+#define RANDOM_CALLS 100000
+#define KEYGEN_KEYS 256
+
+// What generate_keypair used to do for every key
+static bool urandom_bytes(void *out, size_t len)
+{
+    FILE *fr = fopen("/dev/urandom", "r");
+    if (!fr) {
+        return false;
+    }
+    size_t read = fread(out, 1, len, fr);
+    fclose(fr);
+    return read == len;
+}
+
+void bench_random(void)
+{
+    uint8_t buf[32];
+    bool ok = true;
+
+    uint64_t start = bench_now_ns();
+    for (size_t i = 0; i < RANDOM_CALLS / 10; ++i) {
+        ok &= urandom_bytes(buf, sizeof(buf));
+    }
+    bench_report("fopen /dev/urandom (32 bytes)", RANDOM_CALLS / 10, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (size_t i = 0; i < RANDOM_CALLS; ++i) {
+        ok &= random_bytes(buf, sizeof(buf));
+    }
+    bench_report("random_bytes (32 bytes)", RANDOM_CALLS, bench_now_ns() - start);
+
+    Keypair *kps = malloc(sizeof(Keypair) * KEYGEN_KEYS);
+    start = bench_now_ns();
+    for (size_t i = 0; i < KEYGEN_KEYS; ++i) {
+        ok &= (generate_keypair(&kps[i], 0) == MINA_OK);
+    }
+    bench_report("generate_keypair", KEYGEN_KEYS, bench_now_ns() - start);
+    free(kps);
+
+    if (!ok) {
+        printf("  random source failed\n");
+    }
+}
@@ -0,0 +1,64 @@
+#include <stdlib.h>
+#include "bench.h"
+#include "base10.h"
+#include "pasta_fp.h"
+#include "pasta_fq.h"
+#include "record.h"
+
+#define ENCODING_INPUTS 4096
+#define ENCODING_ROUNDS 16
+
+// The output formats of mina-signer, per signature: two decimal numbers,
+// or the raw signature in hex one at a time or a batch at a time
+void bench_encoding(void)
+{
+    Signature *sigs = malloc(sizeof(Signature) * ENCODING_INPUTS);
+    char *hex = malloc((size_t)SIGNATURE_HEX_LEN * ENCODING_INPUTS);
+    char decimal[2][DIGITS + 1];
+    size_t total = 0;
+
+    for (size_t i = 0; i < ENCODING_INPUTS; ++i) {
+        bench_rand_field(sigs[i].rx);
+        bench_rand_field(sigs[i].s);
+    }
+
+    uint64_t start = bench_now_ns();
+    for (size_t r = 0; r < ENCODING_ROUNDS; ++r) {
+        for (size_t i = 0; i < ENCODING_INPUTS; ++i) {
+            uint64_t tmp[4];
+            fiat_pasta_fp_from_montgomery(tmp, sigs[i].rx);
+            total += bigint_to_decimal(decimal[0], tmp);
+            fiat_pasta_fq_from_montgomery(tmp, sigs[i].s);
+            total += bigint_to_decimal(decimal[1], tmp);
+        }
+    }
+    bench_report("signature to decimal", ENCODING_INPUTS * ENCODING_ROUNDS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (size_t r = 0; r < ENCODING_ROUNDS; ++r) {
+        for (size_t i = 0; i < ENCODING_INPUTS; ++i) {
+            signature_hex_write(hex + i * SIGNATURE_HEX_LEN, &sigs[i]);
+        }
+    }
+    bench_report("signature_hex_write", ENCODING_INPUTS * ENCODING_ROUNDS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (size_t r = 0; r < ENCODING_ROUNDS; ++r) {
+        signature_hex_write_batch(hex, sigs, ENCODING_INPUTS);
+    }
+    bench_report("signature_hex_write_batch", ENCODING_INPUTS * ENCODING_ROUNDS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (size_t r = 0; r < ENCODING_ROUNDS; ++r) {
+        for (size_t i = 0; i < ENCODING_INPUTS; ++i) {
+            Signature back;
+            total += signature_hex_read(&back, hex + i * SIGNATURE_HEX_LEN, SIGNATURE_HEX_LEN) == MINA_OK;
+        }
+    }
+    bench_report("signature_hex_read", ENCODING_INPUTS * ENCODING_ROUNDS, bench_now_ns() - start);
+
+    printf("checksum %zu\n", total);
+
+    free(sigs);
+    free(hex);
+}
@@ -0,0 +1,154 @@
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "crypto.h"
+
+void bench_rand_transaction(Transaction *txn)
+{
+    memset(txn, 0, sizeof(Transaction));
+
+    txn->fee = bench_rand() % COIN;
+    txn->fee_token = 1;
+    bench_rand_field(txn->fee_payer_pk.x);
+    txn->fee_payer_pk.is_odd = bench_rand() & 1;
+    txn->nonce = (Nonce)bench_rand();
+    txn->valid_until = (GlobalSlot)bench_rand();
+    txn->memo[0] = 1;
+    txn->memo[1] = 0;
+
+    txn->source_pk = txn->fee_payer_pk;
+    bench_rand_field(txn->receiver_pk.x);
+    txn->receiver_pk.is_odd = bench_rand() & 1;
+    txn->token_id = 1;
+    txn->amount = bench_rand() % (1000 * COIN);
+}
+
+void bench_rand_keypair(Keypair *kp)
+{
+    bench_rand_scalar(kp->priv);
+    generate_pubkey(&kp->pub, kp->priv);
+}
+
+#define SIGN_TXNS 256
+#define SIGN_KEYS 16
+
+static void print_stats(const char *name, const SignBatchStats *stats)
+{
+    const double n = (double)stats->signatures;
+    printf("%s per signature: roinput %.0f ns, derive %.0f ns, k*g %.0f ns, "
+           "normalize %.0f ns, hash %.0f ns, scalar %.0f ns\n", name,
+           stats->roinput_ns / n, stats->derive_ns / n, stats->commit_ns / n,
+           stats->normalize_ns / n, stats->hash_ns / n, stats->scalar_ns / n);
+}
+
+void bench_sign(void)
+{
+    Transaction *txns = malloc(sizeof(Transaction) * SIGN_TXNS);
+    Keypair *kps = malloc(sizeof(Keypair) * SIGN_TXNS);
+    Signature *sigs = malloc(sizeof(Signature) * SIGN_TXNS);
+    const PreparedKey **pks = malloc(sizeof(PreparedKey *) * SIGN_TXNS);
+    Keypair keys[SIGN_KEYS];
+    PreparedKey prepared[SIGN_KEYS];
+
+    for (size_t i = 0; i < SIGN_KEYS; ++i) {
+        bench_rand_keypair(&keys[i]);
+        prepared_key_init(&prepared[i], &keys[i]);
+    }
+    for (size_t i = 0; i < SIGN_TXNS; ++i) {
+        const size_t key = bench_rand() % SIGN_KEYS;
+        bench_rand_transaction(&txns[i]);
+        kps[i] = keys[key];
+        pks[i] = &prepared[key];
+    }
+
+    uint64_t start = bench_start();
+    for (size_t i = 0; i < SIGN_TXNS; ++i) {
+        sign(&sigs[i], &kps[i], &txns[i]);
+    }
+    bench_report("sign", SIGN_TXNS, bench_now_ns() - start);
+
+    SignBatchStats stats = { 0 };
+    start = bench_start();
+    sign_batch_strided(kps, 1, txns, SIGN_TXNS, sigs, NULL, NULL, &stats);
+    bench_report("sign_batch (mixed keys)", SIGN_TXNS, bench_now_ns() - start);
+    print_stats("  mixed keys", &stats);
+
+    memset(&stats, 0, sizeof(stats));
+    start = bench_start();
+    sign_batch_strided(&keys[0], 0, txns, SIGN_TXNS, sigs, NULL, NULL, &stats);
+    bench_report("sign_batch (single key)", SIGN_TXNS, bench_now_ns() - start);
+    print_stats("  single key", &stats);
+
+    memset(&stats, 0, sizeof(stats));
+    start = bench_start();
+    sign_batch_prepared(pks, txns, SIGN_TXNS, sigs, NULL, NULL, &stats);
+    bench_report("sign_batch_prepared (mixed keys)", SIGN_TXNS, bench_now_ns() - start);
+    print_stats("  prepared keys", &stats);
+
+    free(txns);
+    free(kps);
+    free(pks);
+    free(sigs);
+}
+
+#define VERIFY_TXNS 64
+
+void bench_verify(void)
+{
+    Transaction *txns = malloc(sizeof(Transaction) * VERIFY_TXNS);
+    Signature *sigs = malloc(sizeof(Signature) * VERIFY_TXNS);
+    FixedBaseTable *table = malloc(sizeof(FixedBaseTable));
+    Keypair kp;
+    size_t ok = 0;
+
+    bench_rand_keypair(&kp);
+    for (size_t i = 0; i < VERIFY_TXNS; ++i) {
+        bench_rand_transaction(&txns[i]);
+    }
+    sign_batch_strided(&kp, 0, txns, VERIFY_TXNS, sigs, NULL, NULL, NULL);
+
+    uint64_t start = bench_start();
+    for (size_t i = 0; i < VERIFY_TXNS; ++i) {
+        ok += verify(&sigs[i], &kp.pub, &txns[i]) == MINA_OK;
+    }
+    bench_report("verify", VERIFY_TXNS, bench_now_ns() - start);
+
+    start = bench_start();
+    fixed_base_table_init(table, &kp.pub);
+    bench_report("fixed_base_table_init", 1, bench_now_ns() - start);
+
+    start = bench_start();
+    for (size_t i = 0; i < VERIFY_TXNS; ++i) {
+        ok += verify_fixed_base(&sigs[i], &kp.pub, table, &txns[i]) == MINA_OK;
+    }
+    bench_report("verify_fixed_base", VERIFY_TXNS, bench_now_ns() - start);
+
+    Affine *pubs = malloc(sizeof(Affine) * VERIFY_TXNS);
+    MinaStatus *results = malloc(sizeof(MinaStatus) * VERIFY_TXNS);
+    for (size_t i = 0; i < VERIFY_TXNS; ++i) {
+        pubs[i] = kp.pub;
+    }
+    start = bench_start();
+    verify_batch(sigs, pubs, txns, VERIFY_TXNS, results);
+    bench_report("verify_batch", VERIFY_TXNS, bench_now_ns() - start);
+    for (size_t i = 0; i < VERIFY_TXNS; ++i) {
+        ok += results[i] == MINA_OK;
+    }
+
+    // the curve arithmetic alone, without the hash both share
+    Scalar e;
+    Affine ep;
+    bench_rand_scalar(e);
+    start = bench_start();
+    for (size_t i = 0; i < VERIFY_TXNS; ++i) {
+        affine_scalar_mul(&ep, e, &kp.pub);
+    }
+    bench_report("  e * pub (double-and-add)", VERIFY_TXNS, bench_now_ns() - start);
+
+    printf("%zu of %d verified\n", ok, 3 * VERIFY_TXNS);
+    free(txns);
+    free(sigs);
+    free(table);
+    free(pubs);
+    free(results);
+}
@@ -0,0 +1,41 @@
+#include "bench.h"
+#include "vanity.h"
+
+#define VANITY_CANDIDATES 16384
+
+void bench_vanity(void)
+{
+    Pool *pool = pool_create(0, 0);
+    if (!pool) {
+        printf("  cannot create a pool\n");
+        return;
+    }
+
+    // warm up the generator table
+    VanityResult result;
+    vanity_search(pool, "B62qk", 0, &result);
+
+    // a prefix that will not be found, to measure the rate
+    uint64_t start = bench_now_ns();
+    vanity_search(pool, "B62qjjjjjjjjjjjj", VANITY_CANDIDATES, &result);
+    uint64_t ns = bench_now_ns() - start;
+
+    char name[64];
+    snprintf(name, sizeof(name), "vanity candidates (%zu threads)", pool_threads(pool));
+    bench_report(name, result.candidates, ns);
+
+    const double per_second = 1e9 * (double)result.candidates / (double)ns;
+    const char *prefixes[] = { "B62qmi", "B62qmina", "B62qminaX", "B62qminaXy" };
+    for (size_t i = 0; i < sizeof(prefixes) / sizeof(prefixes[0]); ++i) {
+        const double expected = vanity_expected_candidates(prefixes[i]);
+        printf("  %-12s expected %.3g candidates, %.3g s\n", prefixes[i], expected, expected / per_second);
+    }
+
+    start = bench_now_ns();
+    MinaStatus status = vanity_search(pool, "B62qmi", 0, &result);
+    ns = bench_now_ns() - start;
+    printf("  found %s after %llu candidates in %.3f s (%s)\n", result.address,
+           (unsigned long long)result.candidates, (double)ns / 1e9, mina_status_str(status));
+
+    pool_destroy(pool);
+}
@@ -0,0 +1,129 @@
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+#include "bench.h"
+#include "opcount.h"
+
+typedef struct benchmark {
+    const char *name;
+    void (*run)(void);
+} Benchmark;
+
+static const Benchmark BENCHMARKS[] = {
+    { "sqrt", bench_sqrt },
+    { "legendre", bench_legendre },
+    { "pow", bench_pow },
+    { "normalize", bench_normalize },
+    { "pubkey", bench_pubkey },
+    { "complete", bench_complete },
+    { "sign", bench_sign },
+    { "verify", bench_verify },
+    { "pool", bench_pool },
+    { "random", bench_random },
+    { "keygen", bench_keygen },
+    { "hd", bench_hd },
+    { "vanity", bench_vanity },
+    { "decimal", bench_decimal },
+    { "encoding", bench_encoding },
+    { "keycache", bench_keycache },
+};
+
+#define NUM_BENCHMARKS (sizeof(BENCHMARKS) / sizeof(BENCHMARKS[0]))
+
+static uint64_t bench_state = 0x2545f4914f6cdd1dULL;
+
+uint64_t bench_rand(void)
+{
+    bench_state ^= bench_state << 13;
+    bench_state ^= bench_state >> 7;
+    bench_state ^= bench_state << 17;
+    return bench_state;
+}
+
+void bench_rand_field(uint64_t out[4])
+{
+    for (size_t i = 0; i < 4; ++i) {
+        out[i] = bench_rand();
+    }
+    out[3] &= (((uint64_t)1 << 62) - 1);
+}
+
+// Whether the operations counted on this thread belong to the next report
+static bool bench_counting = false;
+
+uint64_t bench_start(void)
+{
+    op_count_reset();
+    bench_counting = true;
+    return bench_now_ns();
+}
+
+void bench_report(const char *name, size_t iters, uint64_t ns)
+{
+    double per_op = (double)ns / (double)iters;
+    printf("%-40s %12.1f ns/op %14.0f op/s\n", name, per_op, 1e9 / per_op);
+
+    if (op_count_enabled() && bench_counting) {
+        OpCounts counts;
+        op_count_get(&counts);
+        printf("  per op: ");
+        op_count_dump(stdout, &counts, iters);
+    }
+    bench_counting = false;
+}
+
+void bench_scaling(const char *label, size_t iters, size_t scratch_bytes, void (*run)(Pool *pool, void *ctx),
+                   void *ctx)
+{
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cores < 1) {
+        cores = 1;
+    }
+
+    double base = 0;
+    for (size_t threads = 1;; threads *= 2) {
+        if (threads > (size_t)cores) {
+            threads = (size_t)cores;
+        }
+
+        Pool *pool = pool_create(threads, scratch_bytes);
+        if (!pool) {
+            printf("  cannot create a pool of %zu threads\n", threads);
+            break;
+        }
+
+        uint64_t start = bench_now_ns();
+        run(pool, ctx);
+        uint64_t ns = bench_now_ns() - start;
+        pool_destroy(pool);
+
+        char name[64];
+        snprintf(name, sizeof(name), "%s (%zu threads)", label, threads);
+        bench_report(name, iters, ns);
+        if (threads == 1) {
+            base = (double)ns;
+        }
+        printf("  speedup %.2fx\n", base / (double)ns);
+
+        if (threads == (size_t)cores) {
+            break;
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    for (size_t i = 0; i < NUM_BENCHMARKS; ++i) {
+        bool selected = (argc < 2);
+        for (int j = 1; j < argc; ++j) {
+            selected |= (strcmp(argv[j], BENCHMARKS[i].name) == 0);
+        }
+
+        if (selected) {
+            printf("== %s\n", BENCHMARKS[i].name);
+            BENCHMARKS[i].run();
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,212 @@
+#include "bip32.h"
+#include "pasta_fq.h"
+#include "sha512.h"
+
+static void bip32_ser32(uint8_t out[4], uint32_t x)
+{
+    out[0] = (uint8_t)(x >> 24);
+    out[1] = (uint8_t)(x >> 16);
+    out[2] = (uint8_t)(x >> 8);
+    out[3] = (uint8_t)x;
+}
+
+// CKDpriv, pub is the parent's public key for non-hardened indices
+static MinaStatus bip32_child(Bip32Node *out, const Bip32Node *parent, const uint8_t *pub, uint32_t index)
+{
+    uint8_t data[1 + SECP256K1_KEY_BYTES + 4];
+    if (index >= BIP32_HARDENED_OFFSET) {
+        data[0] = 0;
+        memcpy(data + 1, parent->key, SECP256K1_KEY_BYTES);
+    } else {
+        memcpy(data, pub, SECP256K1_PUBKEY_BYTES);
+    }
+    bip32_ser32(data + SECP256K1_PUBKEY_BYTES, index);
+
+    uint8_t i[SHA512_DIGEST_BYTES];
+    hmac_sha512(i, parent->chain_code, BIP32_CHAIN_CODE_BYTES, data, sizeof(data));
+
+    MinaStatus status = MINA_OK;
+    if (!secp256k1_key_tweak_add(out->key, parent->key, i)) {
+        status = MINA_ERR_INVALID_KEY;
+    }
+    memcpy(out->chain_code, i + 32, BIP32_CHAIN_CODE_BYTES);
+
+    memset(data, 0, sizeof(data));
+    memset(i, 0, sizeof(i));
+    return status;
+}
+
+MinaStatus bip32_master(Bip32Node *out, const uint8_t *seed, size_t seed_len)
+{
+    if (!out || !seed) {
+        return MINA_ERR_INVALID_PARAMETER;
+    }
+
+    uint8_t i[SHA512_DIGEST_BYTES];
+    hmac_sha512(i, "Bitcoin seed", 12, seed, seed_len);
+    memcpy(out->key, i, SECP256K1_KEY_BYTES);
+    memcpy(out->chain_code, i + 32, BIP32_CHAIN_CODE_BYTES);
+    memset(i, 0, sizeof(i));
+
+    return secp256k1_key_valid(out->key) ? MINA_OK : MINA_ERR_INVALID_KEY;
+}
+
+MinaStatus bip32_derive(Bip32Node *out, const Bip32Node *parent, uint32_t index)
+{
+    uint8_t pub[SECP256K1_PUBKEY_BYTES];
+    if (index < BIP32_HARDENED_OFFSET) {
+        secp256k1_pubkeys(&pub, &parent->key, 1);
+    }
+    return bip32_child(out, parent, pub, index);
+}
+
+MinaStatus bip32_derive_path(Bip32Node *out, const Bip32Node *root, const uint32_t *path, size_t len)
+{
+    Bip32Node node = *root;
+    MinaStatus status = MINA_OK;
+    for (size_t i = 0; i < len && status == MINA_OK; ++i) {
+        status = bip32_derive(&node, &node, path[i]);
+    }
+    if (status == MINA_OK) {
+        *out = node;
+    }
+    memset(&node, 0, sizeof(node));
+    return status;
+}
+
+MinaStatus mina_hd_init(MinaHdWallet *wallet, const uint8_t *seed, size_t seed_len)
+{
+    if (!wallet) {
+        return MINA_ERR_INVALID_PARAMETER;
+    }
+
+    const uint32_t path[] = { 44 | BIP32_HARDENED_OFFSET, MINA_COIN_TYPE | BIP32_HARDENED_OFFSET };
+    Bip32Node master;
+    MinaStatus status = bip32_master(&master, seed, seed_len);
+    if (status == MINA_OK) {
+        status = bip32_derive_path(&wallet->coin, &master, path, 2);
+    }
+    memset(&master, 0, sizeof(master));
+    return status;
+}
+
+// The three levels below the coin node, one level at a time over the
+// batch so that the secp256k1 public keys share one inversion per level.
+// An account whose child key is out of range drops out of the batch with
+// MINA_ERR_INVALID_KEY and the others carry on: its node is given the key
+// 1 so that the shared inversion and generate_pubkeys only ever see valid
+// keys, and its keypair is zeroed at the end.
+static MinaStatus mina_hd_batch(Keypair *kps, const MinaHdWallet *wallet, uint32_t first_account, size_t n,
+                                MinaStatus *results)
+{
+    Bip32Node nodes[SECP256K1_BATCH];
+    uint8_t pubs[SECP256K1_BATCH][SECP256K1_PUBKEY_BYTES];
+    uint8_t keys[SECP256K1_BATCH][SECP256K1_KEY_BYTES];
+    Scalar privs[SECP256K1_BATCH];
+    Affine mina_pubs[SECP256K1_BATCH];
+    MinaStatus status = MINA_OK;
+
+    // account'
+    for (size_t i = 0; i < n; ++i) {
+        results[i] = bip32_child(&nodes[i], &wallet->coin, NULL, (first_account + (uint32_t)i) | BIP32_HARDENED_OFFSET);
+    }
+
+    // /0/0
+    for (size_t level = 0; level < 2; ++level) {
+        for (size_t i = 0; i < n; ++i) {
+            if (results[i] == MINA_OK) {
+                memcpy(keys[i], nodes[i].key, SECP256K1_KEY_BYTES);
+            } else {
+                memset(keys[i], 0, SECP256K1_KEY_BYTES);
+                keys[i][SECP256K1_KEY_BYTES - 1] = 1;
+            }
+        }
+        secp256k1_pubkeys(pubs, (const uint8_t (*)[SECP256K1_KEY_BYTES])keys, n);
+
+        for (size_t i = 0; i < n; ++i) {
+            if (results[i] == MINA_OK) {
+                results[i] = bip32_child(&nodes[i], &nodes[i], pubs[i], 0);
+            }
+        }
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        if (results[i] != MINA_OK) {
+            fiat_pasta_fq_set_one(privs[i]);
+            continue;
+        }
+        uint64_t priv_non_montgomery[4];
+        nodes[i].key[0] &= 0x3f; // drop top two bits
+        for (size_t j = 0; j < 4; ++j) {
+            uint64_t limb = 0;
+            for (size_t k = 0; k < 8; ++k) {
+                limb = (limb << 8) | nodes[i].key[8 * (3 - j) + k];
+            }
+            priv_non_montgomery[j] = limb;
+        }
+        fiat_pasta_fq_to_montgomery(privs[i], priv_non_montgomery);
+    }
+
+    generate_pubkeys(mina_pubs, (const Scalar *)privs, n);
+    for (size_t i = 0; i < n; ++i) {
+        if (results[i] == MINA_OK) {
+            scalar_copy(kps[i].priv, privs[i]);
+            kps[i].pub = mina_pubs[i];
+        } else {
+            memset(&kps[i], 0, sizeof(kps[i]));
+            status = results[i];
+        }
+    }
+
+    memset(nodes, 0, sizeof(nodes));
+    memset(keys, 0, sizeof(keys));
+    memset(privs, 0, sizeof(privs));
+    return status;
+}
+
+MinaStatus mina_hd_keypairs(Keypair *kps, const MinaHdWallet *wallet, uint32_t first_account, size_t n,
+                            MinaStatus *results)
+{
+    if (!wallet || (n > 0 && !kps) || !results || first_account >= BIP32_HARDENED_OFFSET
+        || n > BIP32_HARDENED_OFFSET - first_account) {
+        return MINA_ERR_INVALID_PARAMETER;
+    }
+
+    MinaStatus status = MINA_OK;
+    for (size_t i = 0; i < n; i += SECP256K1_BATCH) {
+        const size_t len = (n - i < SECP256K1_BATCH) ? n - i : SECP256K1_BATCH;
+        const MinaStatus batch = mina_hd_batch(kps + i, wallet, first_account + (uint32_t)i, len, results + i);
+        if (status == MINA_OK) {
+            status = batch;
+        }
+    }
+    return status;
+}
+
+typedef struct mina_hd_pool_job {
+    Keypair *kps;
+    const MinaHdWallet *wallet;
+    uint32_t first_account;
+    MinaStatus *results;
+} MinaHdPoolJob;
+
+static int mina_hd_pool_task(void *ctx, size_t begin, size_t end, size_t worker)
+{
+    MinaHdPoolJob *job = ctx;
+    (void)worker;
+
+    return mina_hd_keypairs(job->kps + begin, job->wallet, job->first_account + (uint32_t)begin, end - begin,
+                            job->results + begin);
+}
+
+MinaStatus mina_hd_keypairs_pool(Pool *pool, Keypair *kps, const MinaHdWallet *wallet, uint32_t first_account,
+                                 size_t n, MinaStatus *results)
+{
+    if (!pool || !wallet || (n > 0 && !kps) || !results || first_account >= BIP32_HARDENED_OFFSET
+        || n > BIP32_HARDENED_OFFSET - first_account) {
+        return MINA_ERR_INVALID_PARAMETER;
+    }
+
+    MinaHdPoolJob job = { kps, wallet, first_account, results };
+    return (MinaStatus)pool_for_status(pool, n, SECP256K1_BATCH, mina_hd_pool_task, &job);
+}
@@ -0,0 +1,46 @@
+// BIP32 key derivation and Mina's BIP44 accounts
+//
+// Account keys are derived along
+//
+//     m/44'/12586'/account'/0/0
+//
+// as by the Ledger app: the private key of the last node, read as a
+// big-endian integer with its top two bits cleared, is the Mina private
+// key. MinaHdWallet keeps the m/44'/12586' node, so every account costs
+// only its own three levels.
+
+#pragma once
+
+#include "crypto.h"
+#include "secp256k1.h"
+
+#define BIP32_CHAIN_CODE_BYTES 32
+#define MINA_COIN_TYPE 12586
+
+typedef struct bip32_node {
+    uint8_t key[SECP256K1_KEY_BYTES];
+    uint8_t chain_code[BIP32_CHAIN_CODE_BYTES];
+} Bip32Node;
+
+typedef struct mina_hd_wallet {
+    Bip32Node coin; // m/44'/12586'
+} MinaHdWallet;
+
+MinaStatus bip32_master(Bip32Node *out, const uint8_t *seed, size_t seed_len);
+
+// Child index of parent, hardened if index >= BIP32_HARDENED_OFFSET
+MinaStatus bip32_derive(Bip32Node *out, const Bip32Node *parent, uint32_t index);
+MinaStatus bip32_derive_path(Bip32Node *out, const Bip32Node *root, const uint32_t *path, size_t len);
+
+MinaStatus mina_hd_init(MinaHdWallet *wallet, const uint8_t *seed, size_t seed_len);
+
+// Keypairs of accounts first_account, ..., first_account + n - 1, with the
+// status of each in results[i]. An account whose BIP32 child key is out of
+// range gets MINA_ERR_INVALID_KEY and a zeroed keypair, and the caller
+// moves on to the next account as BIP32 does with the next index; the
+// rest of the batch is still derived. Returns MINA_OK if all derive,
+// otherwise MINA_ERR_INVALID_KEY.
+MinaStatus mina_hd_keypairs(Keypair *kps, const MinaHdWallet *wallet, uint32_t first_account, size_t n,
+                            MinaStatus *results);
+MinaStatus mina_hd_keypairs_pool(Pool *pool, Keypair *kps, const MinaHdWallet *wallet, uint32_t first_account,
+                                 size_t n, MinaStatus *results);
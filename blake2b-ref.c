@@ -18,6 +18,7 @@
 #include <stdio.h>
 
 #include "blake2.h"
+#include "opcount.h"
 #include "blake2-impl.h"
 
 static const uint64_t blake2b_IV[8] =
@@ -179,6 +180,7 @@ static void blake2b_compress( blake2b_state *S, const uint8_t block[BLAKE2B_BLOC
   uint64_t m[16];
   uint64_t v[16];
   size_t i;
+  OP_COUNT(OP_BLAKE2B);
 
   for( i = 0; i < 16; ++i ) {
     m[i] = load64( block + i * sizeof( m[i] ) );
@@ -1,2 +1,23 @@
 #!/bin/bash
-gcc *.c
+
+# generator_table.c and pasta_sqrt_tables.c are generated offline and
+# committed: regenerate each with the arguments it records and stop if the
+# committed copy differs
+if command -v python3 > /dev/null; then
+    for file in generator_table.c pasta_sqrt_tables.c; do
+        cmd=$(sed -n '1s|^/\* Autogenerated: \(python3 tools/.*\) \*/$|\1|p' "$file")
+        if [ -z "$cmd" ] || ! $cmd | diff -q - "$file" > /dev/null; then
+            echo "$file differs from the output of ${cmd:-its generator}; regenerate it" >&2
+            exit 1
+        fi
+    done
+fi
+
+gcc *.c -lpthread
+gcc -O2 -I. -o bench.out bench/*.c $(ls *.c | grep -v '^main\.c$') -lpthread
+gcc -O2 -DMINA_OP_COUNT -I. -o bench-count.out bench/*.c $(ls *.c | grep -v '^main\.c$') -lpthread
+gcc -O2 -I. -o test.out tests/*.c $(ls *.c | grep -v '^main\.c$') -lpthread
+gcc -O2 -I. -o mina-signer tools/mina_signer.c tools/tool.c $(ls *.c | grep -v '^main\.c$') -lpthread
+gcc -O2 -I. -o mina-signerd tools/mina_signerd.c tools/shmring.c tools/tool.c $(ls *.c | grep -v '^main\.c$') -lpthread
+gcc -O2 -I. -o mina-signerd-load tools/mina_signerd_load.c tools/shmring.c tools/tool.c $(ls *.c | grep -v '^main\.c$') -lpthread
+gcc -O2 -I. -o mina-audit tools/mina_audit.c $(ls *.c | grep -v '^main\.c$') -lpthread
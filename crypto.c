@@ -7,12 +7,17 @@
 //
 //     * Curve arithmatic
 //         - field_add, field_sub, field_mul, field_sq, field_inv, field_negate, field_pow, field_eq
-//         - scalar_add, scalar_sub, scalar_mul, scalar_sq, scalar_pow, scalar_eq
+//         - scalar_add, scalar_sub, scalar_mul, scalar_sq, scalar_inv, scalar_pow, scalar_eq
 //         - group_add, group_dbl, group_scalar_mul (group elements use projective coordinates)
+//         - homogeneous_add, homogeneous_madd, homogeneous_dbl, homogeneous_scalar_mul, homogeneous_msm
+//           (complete formulas, homogeneous coordinates)
 //         - affine_scalar_mul
-//         - projective_to_affine
-//         - generate_pubkey, generate_keypair
-//         - sign
+//         - projective_to_affine, projective_to_affine_batch, affine_decompress
+//         - generator_scalar_mul (fixed-base, table generated at build time)
+//         - generate_pubkey, generate_pubkeys, generate_keypair
+//         - sign, sign_batch, and sign_prepared, sign_batch_prepared with prepared keys
+//         - verify, and verify_fixed_base with a fixed-base table of the public key
+//         - verify_batch, verify_batch_pool
 //
 //     * Curve details
 //         Pasta.Pallas (https://github.com/zcash/pasta)
@@ -21,9 +26,10 @@
 //         FIELD_MODULUS = 28948022309329048855892746252171976963363056481941560715954676764349967630337 (Fp, 0x4c)
 
 // #include <assert.h>
+#include <time.h>
 
-#define THROW exit
-#define INVALID_PARAMETER 1
+// Returns early from the calling function if expr fails
+#define TRY(expr) do { MinaStatus status_ = (expr); if (status_ != MINA_OK) return status_; } while (0)
 
 #include "crypto.h"
 #include "utils.h"
@@ -31,6 +37,9 @@
 #include "pasta_fp.h"
 #include "pasta_fq.h"
 #include "blake2.h"
+#include "random.h"
+#include "sha256.h"
+#include "libbase58.h"
 
 // a = 0, b = 5
 static const Field GROUP_COEFF_B = {
@@ -40,15 +49,6 @@ static const Field GROUP_COEFF_B = {
 static const Field FIELD_ONE = {
     0x34786d38fffffffd, 0x992c350be41914ad, 0xffffffffffffffff, 0x3fffffffffffffff
 };
-static const Field FIELD_THREE = {
-  0x6b0ee5d0fffffff5, 0x86f76d2b99b14bd0, 0xfffffffffffffffe, 0x3fffffffffffffff
-};
-static const Field FIELD_FOUR = {
-  0x65a221cfffffff1, 0xfddd093b747d6762, 0xfffffffffffffffd, 0x3fffffffffffffff
-};
-static const Field FIELD_EIGHT = {
-  0x7387134cffffffe1, 0xd973797adfadd5a8, 0xfffffffffffffffb, 0x3fffffffffffffff
-};
 
 static const Field FIELD_ZERO = { 0, 0, 0, 0 };
 static const Scalar SCALAR_ZERO = { 0, 0, 0, 0 };
@@ -60,16 +60,6 @@ static const Group GROUP_ZERO = {
     { 0, 0, 0, 0}
 };
 
-// g_generator = (1 : 12418654782883325593414442427049395787963493412651469444558597405572177144507)
-static const Affine AFFINE_ONE = {
-    {
-        0x34786d38fffffffd, 0x992c350be41914ad, 0xffffffffffffffff, 0x3fffffffffffffff
-    },
-    {
-        0x2f474795455d409d, 0xb443b9b74b8255d9, 0x270c412f2c9a5d66, 0x8e00f71ba43dd6b
-    }
-};
-
 void field_add(Field c, const Field a, const Field b)
 {
     fiat_pasta_fp_add(c, a, b);
@@ -105,6 +95,56 @@ void field_negate(Field c, const Field a)
     fiat_pasta_fp_opp(c, a);
 }
 
+void field_pow(Field c, const Field a, const uint64_t *e, size_t e_limbs)
+{
+    fiat_pasta_fp_pow(c, a, e, e_limbs);
+}
+
+// Small constant multiples as additions, each far cheaper than a
+// field_mul by the constant. Like the wrappers above, c may alias a: fiat
+// reads all of its inputs before writing its output.
+static void field_mul_by_2(Field c, const Field a)
+{
+    field_add(c, a, a);
+}
+
+static void field_mul_by_3(Field c, const Field a)
+{
+    Field t;
+    field_add(t, a, a);
+    field_add(c, t, a);
+}
+
+static void field_mul_by_4(Field c, const Field a)
+{
+    field_add(c, a, a);
+    field_add(c, c, c);
+}
+
+static void field_mul_by_8(Field c, const Field a)
+{
+    field_add(c, a, a);
+    field_add(c, c, c);
+    field_add(c, c, c);
+}
+
+// c = b * a = 5 * a, as 4a + a
+static void field_mul_b(Field c, const Field a)
+{
+    Field t;
+    field_mul_by_4(t, a);
+    field_add(c, t, a);
+}
+
+// c = 3b * a = 15 * a, as 16a - a
+static void field_mul_b3(Field c, const Field a)
+{
+    Field t;
+    field_mul_by_8(t, a);
+    field_add(t, t, t);
+    field_sub(c, t, a);
+}
+
 unsigned int field_eq(const Field a, const Field b)
 {
     if (fiat_pasta_fp_equals(a, b)) {
@@ -139,11 +179,21 @@ void scalar_sq(Scalar c, const Scalar a)
     fiat_pasta_fq_square(c, a);
 }
 
+void scalar_inv(Scalar c, const Scalar a)
+{
+    fiat_pasta_fq_inv(c, a);
+}
+
 void scalar_negate(Scalar c, const Scalar a)
 {
     fiat_pasta_fq_opp(c, a);
 }
 
+void scalar_pow(Scalar c, const Scalar a, const uint64_t *e, size_t e_limbs)
+{
+    fiat_pasta_fq_pow(c, a, e, e_limbs);
+}
+
 unsigned int scalar_eq(const Scalar a, const Scalar b)
 {
     if (fiat_pasta_fq_equals(a, b)) {
@@ -190,13 +240,23 @@ unsigned int is_on_curve(const Group *p)
         field_mul(z6, z6, p->Z);            // z^5
         field_mul(z6, z6, p->Z);            // z^6
 
-        field_mul(rhs, z6, GROUP_COEFF_B);  // bz^6
+        field_mul_b(rhs, z6);               // bz^6
         field_add(rhs, x3, rhs);            // x^3 + bz^6
     }
 
     return field_eq(lhs, rhs);
 }
 
+unsigned int affine_is_on_curve(const Affine *p)
+{
+    Field lhs, rhs;
+    field_sq(lhs, p->y);                // y^2
+    field_sq(rhs, p->x);                // x^2
+    field_mul(rhs, rhs, p->x);          // x^3
+    field_add(rhs, rhs, GROUP_COEFF_B); // x^3 + b
+    return field_eq(lhs, rhs);
+}
+
 void affine_to_projective(Group *r, const Affine *p)
 {
     if (field_eq(p->x, FIELD_ZERO) && field_eq(p->y, FIELD_ZERO)) {
@@ -227,8 +287,48 @@ void projective_to_affine(Affine *r, const Group *p)
     field_mul(r->y, p->Y, zi3); // Y/Z^3
 }
 
+// Normalizes n points with a single inversion (Montgomery's trick).
+// Points at infinity map to (0, 0), as in projective_to_affine.
+// r and p must not overlap.
+void projective_to_affine_batch(Affine *r, const Group *p, size_t n)
+{
+    // r[i].y = product of the nonzero Z coordinates before i
+    Field acc;
+    field_copy(acc, FIELD_ONE);
+    for (size_t i = 0; i < n; ++i) {
+        if (is_zero(&p[i])) {
+            continue;
+        }
+        field_copy(r[i].y, acc);
+        field_mul(acc, acc, p[i].Z);
+    }
+
+    Field inv;
+    field_inv(inv, acc);
+
+    for (size_t i = n; i > 0; --i) {
+        const Group *pi = &p[i - 1];
+        Affine *ri = &r[i - 1];
+
+        if (is_zero(pi)) {
+            os_memcpy(ri->x, FIELD_ZERO, FIELD_BYTES);
+            os_memcpy(ri->y, FIELD_ZERO, FIELD_BYTES);
+            continue;
+        }
+
+        Field zi, zi2, zi3;
+        field_mul(zi, inv, ri->y);   // 1/Z
+        field_mul(inv, inv, pi->Z);  // drop Z from the running inverse
+        field_sq(zi2, zi);           // 1/Z^2
+        field_mul(zi3, zi2, zi);     // 1/Z^3
+        field_mul(ri->x, pi->X, zi2); // X/Z^2
+        field_mul(ri->y, pi->Y, zi3); // Y/Z^3
+    }
+}
+
 // https://www.hyperelliptic.org/EFD/g1p/auto-code/shortw/jacobian-0/doubling/dbl-2009-l.op3
-// cost 2M + 5S + 6add + 3*2 + 1*3 + 1*8
+// cost 2M + 5S + 6add + 3*2 + 1*3 + 1*8, the small multiples as additions
+// r may alias p: Y1 and Z1 are used up before r is written
 void group_dbl(Group *r, const Group *p)
 {
     if (is_zero(p)) {
@@ -236,30 +336,30 @@ void group_dbl(Group *r, const Group *p)
         return;
     }
 
-    Field a, b, c;
+    Field a, b, c, z;
     field_sq(a, p->X);            // a = X1^2
     field_sq(b, p->Y);            // b = Y1^2
     field_sq(c, b);               // c = b^2
+    field_mul(z, p->Y, p->Z);     // t8 = Y1 * Z1
 
     Field d, e, f;
     field_add(r->X, p->X, b);     // t0 = X1 + b
     field_sq(r->Y, r->X);         // t1 = t0^2
     field_sub(r->Z, r->Y, a);     // t2 = t1 - a
     field_sub(r->X, r->Z, c);     // t3 = t2 - c
-    field_add(d, r->X, r->X);     // d = 2 * t3
-    field_mul(e, FIELD_THREE, a); // e = 3 * a
+    field_mul_by_2(d, r->X);      // d = 2 * t3
+    field_mul_by_3(e, a);         // e = 3 * a
     field_sq(f, e);               // f = e^2
 
-    field_add(r->Y, d, d);        // t4 = 2 * d
+    field_mul_by_2(r->Y, d);      // t4 = 2 * d
     field_sub(r->X, f, r->Y);     // X = f - t4
 
     field_sub(r->Y, d, r->X);     // t5 = d - X
-    field_mul(f, FIELD_EIGHT, c); // t6 = 8 * c
+    field_mul_by_8(f, c);         // t6 = 8 * c
     field_mul(r->Z, e, r->Y);     // t7 = e * t5
     field_sub(r->Y, r->Z, f);     // Y = t7 - t6
 
-    field_mul(f, p->Y, p->Z);     // t8 = Y1 * Z1
-    field_add(r->Z, f, f);        // Z = 2 * t8
+    field_mul_by_2(r->Z, z);      // Z = 2 * t8
 }
 
 // https://www.hyperelliptic.org/EFD/g1p/auto-code/shortw/jacobian-0/addition/add-2007-bl.op3
@@ -323,33 +423,37 @@ void group_add(Group *r, const Group *p, const Group *q)
 }
 
 // https://www.hyperelliptic.org/EFD/g1p/auto-code/shortw/jacobian-0/addition/madd-2007-bl.op3
-// for p = (X1, Y1, Z1), q = (X2, Y2, Z2); assumes Z2 = 1
-// cost 7M + 4S + 9add + 3*2 + 1*4 ?
-void group_madd(Group *r, const Group *p, const Group *q)
+// for p = (X1, Y1, Z1), q = (x2, y2)
+// cost 7M + 4S + 9add + 3*2 + 1*4
+// Either point may be the identity, and p = -q gives the identity, but
+// p = q gives the identity too rather than 2p: h = 0 zeroes Z3, so callers
+// must rule it out. r must not alias p, whose X is read after r->X is
+// written.
+void group_madd_affine(Group *r, const Group *p, const Affine *q)
 {
     if (is_zero(p)) {
-        *r = *q;
+        affine_to_projective(r, q);
         return;
     }
-    if (is_zero(q)) {
+    if (affine_is_zero(q)) {
         *r = *p;
         return;
     }
 
     Field z1z1, u2;
     field_sq(z1z1, p->Z);            // z1z1 = Z1^2
-    field_mul(u2, q->X, z1z1);       // u2 = X2 * z1z1
+    field_mul(u2, q->x, z1z1);       // u2 = X2 * z1z1
 
     Field s2;
     field_mul(r->X, p->Z, z1z1);     // t0 = Z1 * z1z1
-    field_mul(s2, q->Y, r->X);       // s2 = Y2 * t0
+    field_mul(s2, q->y, r->X);       // s2 = Y2 * t0
 
     Field h, hh;
     field_sub(h, u2, p->X);          // h = u2 - X1
     field_sq(hh, h);                 // hh = h^2
 
     Field j, w, v;
-    field_mul(r->X, FIELD_FOUR, hh); // i = 4 * hh
+    field_mul_by_4(r->X, hh);        // i = 4 * hh
     field_mul(j, h, r->X);           // j = h * i
     field_sub(r->Y, s2, p->Y);       // t1 = s2 - Y1
     field_add(w, r->Y, r->Y);        // w = 2 * t1
@@ -375,6 +479,20 @@ void group_madd(Group *r, const Group *p, const Group *q)
     field_sub(r->Z, w, hh);          // (Z1 + h)^2 - Z1Z1 - hh = t11 - hh
 }
 
+// for p = (X1, Y1, Z1), q = (X2, Y2, Z2); assumes Z2 = 1
+void group_madd(Group *r, const Group *p, const Group *q)
+{
+    if (is_zero(q)) {
+        *r = *p;
+        return;
+    }
+
+    Affine a;
+    field_copy(a.x, q->X);
+    field_copy(a.y, q->Y);
+    group_madd_affine(r, p, &a);
+}
+
 void group_scalar_mul(Group *r, const Scalar k, const Group *p)
 {
     *r = GROUP_ZERO;
@@ -385,7 +503,6 @@ void group_scalar_mul(Group *r, const Scalar k, const Group *p)
         return;
     }
 
-    // Group r1 = *p;
     Group tmp;
 
     uint64_t k_bits[4];
@@ -395,14 +512,10 @@ void group_scalar_mul(Group *r, const Scalar k, const Group *p)
     for (size_t i = 0; i < FIELD_SIZE_IN_BITS; ++i) {
         bool di = packed_bit_array_get((uint8_t*) k_bits, FIELD_SIZE_IN_BITS - 1 - i);
 
-        group_dbl(&tmp, r);
-
+        group_dbl(r, r);
         if (di) {
-          group_add(r, &tmp, p);
-        } else {
-          field_copy(r->X, tmp.X);
-          field_copy(r->Y, tmp.Y);
-          field_copy(r->Z, tmp.Z);
+            group_add(&tmp, r, p);
+            *r = tmp;
         }
     }
 }
@@ -415,6 +528,342 @@ void affine_scalar_mul(Affine *r, const Scalar k, const Affine *p)
     projective_to_affine(r, &pr);
 }
 
+// Fixed-base tables, of the generator and of keys that verify often. With
+//
+//     table->points[i][j - 1] = j * 2^(w * i) * p,  1 <= j < 2^w
+//
+// k * p is the sum over the w-bit windows of k, with no doublings. The
+// generator's is GENERATOR_TABLE, generated into generator_table.c.
+
+void fixed_base_table_init(FixedBaseTable *table, const Affine *p)
+{
+    Group base, tmp;
+    Group row[GENERATOR_TABLE_POINTS];
+    affine_to_projective(&base, p);
+
+    // One row at a time, so the table can be built without allocating
+    for (size_t i = 0; i < GENERATOR_TABLE_WINDOWS; ++i) {
+        row[0] = base;
+        for (size_t j = 1; j < GENERATOR_TABLE_POINTS; ++j) {
+            group_add(&row[j], &row[j - 1], &base);
+        }
+
+        // base = 2^w * base
+        for (size_t j = 0; j < GENERATOR_TABLE_WINDOW_BITS; ++j) {
+            group_dbl(&tmp, &base);
+            base = tmp;
+        }
+
+        projective_to_affine_batch(table->points[i], row, GENERATOR_TABLE_POINTS);
+    }
+}
+
+// Homogeneous projective coordinates, in which the Renes--Costello--Batina
+// formulas (https://eprint.iacr.org/2015/1060) add any two points without
+// exceptions. With a = 0 the only constant is 3b = 15, which is cheaper
+// as additions than as a multiplication.
+
+// r = p + q for any p, including the identity (0 : 1 : 0), and any affine
+// q other than the identity. Algorithm 8 of RCB for a = 0, 11M. r may
+// alias p.
+void homogeneous_madd(Homogeneous *r, const Homogeneous *p, const Affine *q)
+{
+    Field t0, t1, t2, t3, t4, x3, y3, z3;
+    field_mul(t0, p->X, q->x);   // t0 = X1 * x2
+    field_mul(t1, p->Y, q->y);   // t1 = Y1 * y2
+    field_add(t3, q->x, q->y);   // t3 = x2 + y2
+    field_add(t4, p->X, p->Y);   // t4 = X1 + Y1
+    field_mul(t3, t3, t4);       // t3 = t3 * t4
+    field_add(t4, t0, t1);       // t4 = t0 + t1
+    field_sub(t3, t3, t4);       // t3 = t3 - t4
+    field_mul(t4, q->y, p->Z);   // t4 = y2 * Z1
+    field_add(t4, t4, p->Y);     // t4 = t4 + Y1
+    field_mul(y3, q->x, p->Z);   // Y3 = x2 * Z1
+    field_add(y3, y3, p->X);     // Y3 = Y3 + X1
+    field_add(x3, t0, t0);       // X3 = t0 + t0
+    field_add(t0, x3, t0);       // t0 = X3 + t0
+    field_mul_b3(t2, p->Z);      // t2 = b3 * Z1
+    field_add(z3, t1, t2);       // Z3 = t1 + t2
+    field_sub(t1, t1, t2);       // t1 = t1 - t2
+    field_mul_b3(y3, y3);        // Y3 = b3 * Y3
+    field_mul(x3, t4, y3);       // X3 = t4 * Y3
+    field_mul(t2, t3, t1);       // t2 = t3 * t1
+    field_sub(x3, t2, x3);       // X3 = t2 - X3
+    field_mul(y3, y3, t0);       // Y3 = Y3 * t0
+    field_mul(t1, t1, z3);       // t1 = t1 * Z3
+    field_add(y3, t1, y3);       // Y3 = t1 + Y3
+    field_mul(t0, t0, t3);       // t0 = t0 * t3
+    field_mul(z3, z3, t4);       // Z3 = Z3 * t4
+    field_add(z3, z3, t0);       // Z3 = Z3 + t0
+
+    field_copy(r->X, x3);
+    field_copy(r->Y, y3);
+    field_copy(r->Z, z3);
+}
+
+// Jacobian (X Z : Y Z^2 : Z); the identity maps to Z = 0
+static void homogeneous_to_group(Group *r, const Homogeneous *p)
+{
+    Field z2;
+    field_sq(z2, p->Z);
+    field_mul(r->X, p->X, p->Z);
+    field_mul(r->Y, p->Y, z2);
+    field_copy(r->Z, p->Z);
+}
+
+// (X Z : Y : Z^3), and (0 : 1 : 0) for the identity. Variable time.
+static void group_to_homogeneous(Homogeneous *r, const Group *p)
+{
+    if (is_zero(p)) {
+        field_copy(r->X, FIELD_ZERO);
+        field_copy(r->Y, FIELD_ONE);
+        field_copy(r->Z, FIELD_ZERO);
+        return;
+    }
+    Field z2;
+    field_sq(z2, p->Z);
+    field_mul(r->X, p->X, p->Z);
+    field_copy(r->Y, p->Y);
+    field_mul(r->Z, z2, p->Z);
+}
+
+// All ones if a == b, zero otherwise, without branching
+static uint64_t ct_eq_mask(uint64_t a, uint64_t b)
+{
+    return -(((a ^ b) - 1) >> 63);
+}
+
+static void field_cmov(Field r, const Field a, uint64_t mask)
+{
+    for (size_t i = 0; i < LIMBS_PER_FIELD; ++i) {
+        r[i] ^= (r[i] ^ a[i]) & mask;
+    }
+}
+
+// r = p + q for any p and q. Algorithm 7 of RCB for a = 0, 12M.
+void homogeneous_add(Homogeneous *r, const Homogeneous *p, const Homogeneous *q)
+{
+    Field t0, t1, t2, t3, t4, x3, y3, z3;
+    field_mul(t0, p->X, q->X);   // t0 = X1 * X2
+    field_mul(t1, p->Y, q->Y);   // t1 = Y1 * Y2
+    field_mul(t2, p->Z, q->Z);   // t2 = Z1 * Z2
+    field_add(t3, p->X, p->Y);   // t3 = X1 + Y1
+    field_add(t4, q->X, q->Y);   // t4 = X2 + Y2
+    field_mul(t3, t3, t4);       // t3 = t3 * t4
+    field_add(t4, t0, t1);       // t4 = t0 + t1
+    field_sub(t3, t3, t4);       // t3 = t3 - t4
+    field_add(t4, p->Y, p->Z);   // t4 = Y1 + Z1
+    field_add(x3, q->Y, q->Z);   // X3 = Y2 + Z2
+    field_mul(t4, t4, x3);       // t4 = t4 * X3
+    field_add(x3, t1, t2);       // X3 = t1 + t2
+    field_sub(t4, t4, x3);       // t4 = t4 - X3
+    field_add(x3, p->X, p->Z);   // X3 = X1 + Z1
+    field_add(y3, q->X, q->Z);   // Y3 = X2 + Z2
+    field_mul(x3, x3, y3);       // X3 = X3 * Y3
+    field_add(y3, t0, t2);       // Y3 = t0 + t2
+    field_sub(y3, x3, y3);       // Y3 = X3 - Y3
+    field_add(x3, t0, t0);       // X3 = t0 + t0
+    field_add(t0, x3, t0);       // t0 = X3 + t0
+    field_mul_b3(t2, t2);        // t2 = b3 * t2
+    field_add(z3, t1, t2);       // Z3 = t1 + t2
+    field_sub(t1, t1, t2);       // t1 = t1 - t2
+    field_mul_b3(y3, y3);        // Y3 = b3 * Y3
+    field_mul(x3, t4, y3);       // X3 = t4 * Y3
+    field_mul(t2, t3, t1);       // t2 = t3 * t1
+    field_sub(x3, t2, x3);       // X3 = t2 - X3
+    field_mul(y3, y3, t0);       // Y3 = Y3 * t0
+    field_mul(t1, t1, z3);       // t1 = t1 * Z3
+    field_add(y3, t1, y3);       // Y3 = t1 + Y3
+    field_mul(t0, t0, t3);       // t0 = t0 * t3
+    field_mul(z3, z3, t4);       // Z3 = Z3 * t4
+    field_add(z3, z3, t0);       // Z3 = Z3 + t0
+
+    field_copy(r->X, x3);
+    field_copy(r->Y, y3);
+    field_copy(r->Z, z3);
+}
+
+// r = 2p for any p. Algorithm 9 of RCB for a = 0, 6M + 2S.
+void homogeneous_dbl(Homogeneous *r, const Homogeneous *p)
+{
+    Field t0, t1, t2, x3, y3, z3;
+    field_sq(t0, p->Y);          // t0 = Y * Y
+    field_add(z3, t0, t0);       // Z3 = t0 + t0
+    field_add(z3, z3, z3);       // Z3 = Z3 + Z3
+    field_add(z3, z3, z3);       // Z3 = Z3 + Z3
+    field_mul(t1, p->Y, p->Z);   // t1 = Y * Z
+    field_sq(t2, p->Z);          // t2 = Z * Z
+    field_mul_b3(t2, t2);        // t2 = b3 * t2
+    field_mul(x3, t2, z3);       // X3 = t2 * Z3
+    field_add(y3, t0, t2);       // Y3 = t0 + t2
+    field_mul(z3, t1, z3);       // Z3 = t1 * Z3
+    field_add(t1, t2, t2);       // t1 = t2 + t2
+    field_add(t2, t1, t2);       // t2 = t1 + t2
+    field_sub(t0, t0, t2);       // t0 = t0 - t2
+    field_mul(y3, t0, y3);       // Y3 = t0 * Y3
+    field_add(y3, x3, y3);       // Y3 = X3 + Y3
+    field_mul(t1, p->X, p->Y);   // t1 = X * Y
+    field_mul(x3, t0, t1);       // X3 = t0 * t1
+    field_add(x3, x3, x3);       // X3 = X3 + X3
+
+    field_copy(r->X, x3);
+    field_copy(r->Y, y3);
+    field_copy(r->Z, z3);
+}
+
+// (x : y : 1), or (0 : 1 : 0) for the identity (0, 0)
+void affine_to_homogeneous(Homogeneous *r, const Affine *p)
+{
+    const uint64_t zero = -(uint64_t)affine_is_zero(p);
+    field_copy(r->X, p->x);
+    field_copy(r->Y, p->y);
+    field_copy(r->Z, FIELD_ONE);
+    field_cmov(r->Y, FIELD_ONE, zero);
+    field_cmov(r->Z, FIELD_ZERO, zero);
+}
+
+void homogeneous_to_affine(Affine *r, const Homogeneous *p)
+{
+    if (field_eq(p->Z, FIELD_ZERO)) {
+        os_memcpy(r->x, FIELD_ZERO, FIELD_BYTES);
+        os_memcpy(r->y, FIELD_ZERO, FIELD_BYTES);
+        return;
+    }
+
+    Field zi;
+    field_inv(zi, p->Z);
+    field_mul(r->x, p->X, zi);
+    field_mul(r->y, p->Y, zi);
+}
+
+// Double-and-add that adds at every bit and keeps the sum under a mask
+void homogeneous_scalar_mul(Homogeneous *r, const Scalar k, const Homogeneous *p)
+{
+    uint64_t k_bits[4];
+    fiat_pasta_fq_from_montgomery(k_bits, k);
+
+    Homogeneous acc = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } };
+    field_copy(acc.Y, FIELD_ONE);
+    const Homogeneous base = *p;
+
+    for (size_t i = FIELD_SIZE_IN_BITS; i-- > 0;) {
+        Homogeneous sum;
+        homogeneous_dbl(&acc, &acc);
+        homogeneous_add(&sum, &acc, &base);
+
+        const uint64_t take = -((k_bits[i / 64] >> (i % 64)) & 1);
+        field_cmov(acc.X, sum.X, take);
+        field_cmov(acc.Y, sum.Y, take);
+        field_cmov(acc.Z, sum.Z, take);
+    }
+
+    *r = acc;
+    memset(k_bits, 0, sizeof(k_bits));
+}
+
+// One doubling per bit for a block of MSM_BLOCK points, then a mixed
+// addition for each point whose scalar has the bit set. The accumulator
+// meets the points in no particular relation, which is where the
+// Jacobian formulas would need their special cases.
+#define MSM_BLOCK 64
+
+void homogeneous_msm(Homogeneous *r, const Scalar *k, const Affine *p, size_t n)
+{
+    Homogeneous acc = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } };
+    field_copy(acc.Y, FIELD_ONE);
+
+    for (size_t begin = 0; begin < n; begin += MSM_BLOCK) {
+        const size_t count = (n - begin < MSM_BLOCK) ? n - begin : MSM_BLOCK;
+        uint64_t k_bits[MSM_BLOCK][4];
+        for (size_t i = 0; i < count; ++i) {
+            fiat_pasta_fq_from_montgomery(k_bits[i], k[begin + i]);
+        }
+
+        Homogeneous block = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } };
+        field_copy(block.Y, FIELD_ONE);
+        for (size_t bit = FIELD_SIZE_IN_BITS; bit-- > 0;) {
+            homogeneous_dbl(&block, &block);
+            for (size_t i = 0; i < count; ++i) {
+                if (((k_bits[i][bit / 64] >> (bit % 64)) & 1) && !affine_is_zero(&p[begin + i])) {
+                    homogeneous_madd(&block, &block, &p[begin + i]);
+                }
+            }
+        }
+        homogeneous_add(&acc, &acc, &block);
+    }
+
+    *r = acc;
+}
+
+// The w-bit window of k_bits starting at bit i * w. Windows of sizes that
+// do not divide 64 straddle two limbs; which ones do depends on i only.
+static uint64_t window_digit(const uint64_t k_bits[4], size_t i)
+{
+    const size_t bit = GENERATOR_TABLE_WINDOW_BITS * i;
+    uint64_t digit = k_bits[bit / 64] >> (bit % 64);
+    if (bit % 64 + GENERATOR_TABLE_WINDOW_BITS > 64 && bit / 64 + 1 < 4) {
+        digit |= k_bits[bit / 64 + 1] << (64 - bit % 64);
+    }
+    return digit & (((uint64_t)1 << GENERATOR_TABLE_WINDOW_BITS) - 1);
+}
+
+// r = k * g using the generator table, in constant time: every window
+// reads every entry of its row under a mask and does one complete
+// addition. A zero digit adds the first entry and keeps the old sum.
+void generator_scalar_mul(Group *r, const Scalar k)
+{
+    uint64_t k_bits[4];
+    fiat_pasta_fq_from_montgomery(k_bits, k);
+
+    Homogeneous acc = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } };
+    field_copy(acc.Y, FIELD_ONE);
+
+    for (size_t i = 0; i < GENERATOR_TABLE_WINDOWS; ++i) {
+        const uint64_t digit = window_digit(k_bits, i);
+
+        Affine q = GENERATOR_TABLE.points[i][0];
+        for (size_t j = 2; j <= GENERATOR_TABLE_POINTS; ++j) {
+            const uint64_t take = ct_eq_mask(digit, j);
+            field_cmov(q.x, GENERATOR_TABLE.points[i][j - 1].x, take);
+            field_cmov(q.y, GENERATOR_TABLE.points[i][j - 1].y, take);
+        }
+
+        Homogeneous sum;
+        homogeneous_madd(&sum, &acc, &q);
+
+        const uint64_t keep = ct_eq_mask(digit, 0);
+        field_cmov(sum.X, acc.X, keep);
+        field_cmov(sum.Y, acc.Y, keep);
+        field_cmov(sum.Z, acc.Z, keep);
+        acc = sum;
+    }
+
+    homogeneous_to_group(r, &acc);
+    memset(k_bits, 0, sizeof(k_bits));
+}
+
+// acc += k * p for the table of p, negated if negate is set. Variable time:
+// zero digits are skipped and nonzero ones index the table directly.
+static void fixed_base_mul_add(Homogeneous *acc, const FixedBaseTable *table, const Scalar k, bool negate)
+{
+    uint64_t k_bits[4];
+    fiat_pasta_fq_from_montgomery(k_bits, k);
+
+    for (size_t i = 0; i < GENERATOR_TABLE_WINDOWS; ++i) {
+        const uint64_t digit = window_digit(k_bits, i);
+        if (digit == 0) {
+            continue;
+        }
+        if (negate) {
+            Affine q = table->points[i][digit - 1];
+            field_negate(q.y, q.y);
+            homogeneous_madd(acc, acc, &q);
+        } else {
+            homogeneous_madd(acc, acc, &table->points[i][digit - 1]);
+        }
+    }
+}
+
 bool is_odd(const Field y)
 {
     uint64_t tmp[4];
@@ -422,18 +871,67 @@ bool is_odd(const Field y)
     return tmp[0] & 1;
 }
 
+// y = sqrt(x^3 + 5), negated if its parity is wrong. The group has prime
+// order, so there is no point with y = 0 and both roots have distinct
+// parities.
+MinaStatus affine_decompress(Affine *p, const Compressed *c)
+{
+    if (!p || !c) {
+        return MINA_ERR_INVALID_PARAMETER;
+    }
+
+    Field y2;
+    field_sq(y2, c->x);
+    field_mul(y2, y2, c->x);
+    field_add(y2, y2, GROUP_COEFF_B);
+    if (!fiat_pasta_fp_sqrt(p->y, y2)) {
+        return MINA_ERR_INVALID_POINT;
+    }
+    if (is_odd(p->y) != c->is_odd) {
+        field_negate(p->y, p->y);
+    }
+    field_copy(p->x, c->x);
+    return MINA_OK;
+}
+
 void roinput_print_fields(const ROInput *input) {
   for (size_t i = 0; i < LIMBS_PER_FIELD * input->fields_len; ++i) {
     printf("fs[%lu] = 0x%lx\n", i, input->fields[i]);
   }
 }
 
+const char *mina_status_str(MinaStatus status)
+{
+    switch (status) {
+    case MINA_OK:
+        return "ok";
+    case MINA_ERR_INVALID_PARAMETER:
+        return "invalid parameter";
+    case MINA_ERR_CAPACITY:
+        return "input at capacity";
+    case MINA_ERR_ZERO_NONCE:
+        return "zero nonce";
+    case MINA_ERR_ENTROPY:
+        return "no entropy";
+    case MINA_ERR_INVALID_KEY:
+        return "invalid derived key";
+    case MINA_ERR_NOT_FOUND:
+        return "not found";
+    case MINA_ERR_NO_MEMORY:
+        return "out of memory";
+    case MINA_ERR_INVALID_POINT:
+        return "not a curve point";
+    case MINA_ERR_BAD_SIGNATURE:
+        return "bad signature";
+    }
+    return "unknown status";
+}
+
 // input for poseidon
-void roinput_add_field(ROInput *input, const Field a) {
+MinaStatus roinput_add_field(ROInput *input, const Field a) {
   int remaining = (int)input->fields_capacity - (int)input->fields_len;
   if (remaining < 1) {
-    printf("fields at capacity\n");
-    exit(1);
+    return MINA_ERR_CAPACITY;
   }
 
   size_t offset = LIMBS_PER_FIELD * input->fields_len;
@@ -441,31 +939,31 @@ void roinput_add_field(ROInput *input, const Field a) {
   fiat_pasta_fp_copy(input->fields + offset, a);
 
   input->fields_len += 1;
+  return MINA_OK;
 }
 
-void roinput_add_bit(ROInput *input, bool b) {
+MinaStatus roinput_add_bit(ROInput *input, bool b) {
   int remaining = (int)input->bits_capacity - (int)input->bits_len;
 
   if (remaining < 1) {
-    printf("add_bit: bits at capacity\n");
-    exit(1);
+    return MINA_ERR_CAPACITY;
   }
 
   size_t offset = input->bits_len;
   input->bits[offset] = b;
   input->bits_len += 1;
+  return MINA_OK;
 }
 
-void roinput_add_scalar(ROInput *input, const Scalar a) {
+MinaStatus roinput_add_scalar(ROInput *input, const Scalar a) {
   int remaining = (int)input->bits_capacity - (int)input->bits_len;
   const size_t len = FIELD_SIZE_IN_BITS;
 
   uint64_t scalar_bigint[4];
   fiat_pasta_fq_from_montgomery(scalar_bigint, a);
 
-  if (remaining < len) {
-    printf("add_scalar: bits at capacity\n");
-    exit(1);
+  if (remaining < (int)len) {
+    return MINA_ERR_CAPACITY;
   }
 
   size_t offset = input->bits_len;
@@ -477,13 +975,13 @@ void roinput_add_scalar(ROInput *input, const Scalar a) {
   }
 
   input->bits_len += len;
+  return MINA_OK;
 }
 
-void roinput_add_bytes(ROInput *input, const uint8_t *bytes, size_t len) {
-  int remaining = (int)input->bits_capacity - (int)input->bits_len;
+MinaStatus roinput_add_bytes(ROInput *input, const uint8_t *bytes, size_t len) {
+  size_t remaining = input->bits_capacity - input->bits_len;
   if (remaining < 8 * len) {
-    printf("add_bytes: bits at capacity (bytes)\n");
-    exit(1);
+    return MINA_ERR_CAPACITY;
   }
 
   // LSB bits
@@ -498,9 +996,10 @@ void roinput_add_bytes(ROInput *input, const uint8_t *bytes, size_t len) {
   }
 
   input->bits_len += 8 * len;
+  return MINA_OK;
 }
 
-void roinput_add_uint32(ROInput *input, const uint32_t x) {
+MinaStatus roinput_add_uint32(ROInput *input, const uint32_t x) {
   const size_t NUM_BYTES = 4;
   uint8_t le[NUM_BYTES];
 
@@ -508,10 +1007,10 @@ void roinput_add_uint32(ROInput *input, const uint32_t x) {
     le[i] = (uint8_t) (0xff & (x >> (8 * i)));
   }
 
-  roinput_add_bytes(input, le, NUM_BYTES);
+  return roinput_add_bytes(input, le, NUM_BYTES);
 }
 
-void roinput_add_uint64(ROInput *input, const uint64_t x) {
+MinaStatus roinput_add_uint64(ROInput *input, const uint64_t x) {
   const size_t NUM_BYTES = 8;
   uint8_t le[NUM_BYTES];
 
@@ -519,7 +1018,7 @@ void roinput_add_uint64(ROInput *input, const uint64_t x) {
     le[i] = (uint8_t) (0xff & (x >> (8 * i)));
   }
 
-  roinput_add_bytes(input, le, NUM_BYTES);
+  return roinput_add_bytes(input, le, NUM_BYTES);
 }
 
 void roinput_to_bytes(uint8_t *out, const ROInput *input) {
@@ -586,50 +1085,185 @@ size_t roinput_to_fields(uint64_t *out, const ROInput *input) {
   return output_len;
 }
 
-void generate_keypair(Keypair *keypair, uint32_t account)
+MinaStatus generate_keypair(Keypair *keypair, uint32_t account)
 {
-    if (!keypair) {
-        THROW(INVALID_PARAMETER);
+    (void)account;
+    return generate_keypairs(keypair, 1);
+}
+
+MinaStatus generate_keypairs(Keypair *kps, size_t n)
+{
+    if (n > 0 && !kps) {
+        return MINA_ERR_INVALID_PARAMETER;
     }
 
-    uint64_t priv_non_montgomery[4] = { 0, 0, 0, 0 };
-    FILE* fr = fopen("/dev/urandom", "r");
-    if (!fr) perror("urandom"), exit(EXIT_FAILURE);
-    fread((void*)priv_non_montgomery, sizeof(uint8_t), 32, fr);
-    fclose(fr), fr = NULL;
+    uint64_t priv_non_montgomery[PUBKEY_BATCH][4];
+    Group pubs[PUBKEY_BATCH];
+    Affine pubs_affine[PUBKEY_BATCH];
 
-    // Make sure the private key is in [0, p)
-    //
-    // Note: Mina does rejection sampling to obtain a private key in
-    // [0, p), where the field modulus
-    //
-    //     p = 28948022309329048855892746252171976963363056481941560715954676764349967630337
-    //
-    // Due to constraints, this implementation take a different
-    // approach and just unsets the top two bits of the 256bit bip44
-    // secret, so
-    //
-    //     max = 28948022309329048855892746252171976963317496166410141009864396001978282409983.
-    //
-    // If p < max then we could still generate invalid private keys
-    // (although it's highly unlikely), but
-    //
-    //     p - max = 45560315531419706090280762371685220354
-    //
-    // Thus, we cannot generate invalid private keys and instead lose an
-    // insignificant amount of entropy.
+    for (size_t i = 0; i < n; i += PUBKEY_BATCH) {
+        const size_t len = (n - i < PUBKEY_BATCH) ? n - i : PUBKEY_BATCH;
 
-    priv_non_montgomery[3] &= (((uint64_t)1 << 62) - 1); // drop top two bits
-    fiat_pasta_fq_to_montgomery(keypair->priv, priv_non_montgomery);
+        if (!random_bytes(priv_non_montgomery, sizeof(priv_non_montgomery[0]) * len)) {
+            return MINA_ERR_ENTROPY;
+        }
 
-    affine_scalar_mul(&keypair->pub, keypair->priv, &AFFINE_ONE);
+        for (size_t j = 0; j < len; ++j) {
+            // Make sure the private key is in [0, p)
+            //
+            // Note: Mina does rejection sampling to obtain a private key in
+            // [0, p), where the field modulus
+            //
+            //     p = 28948022309329048855892746252171976963363056481941560715954676764349967630337
+            //
+            // Due to constraints, this implementation take a different
+            // approach and just unsets the top two bits of the 256bit bip44
+            // secret, so
+            //
+            //     max = 28948022309329048855892746252171976963317496166410141009864396001978282409983.
+            //
+            // If p < max then we could still generate invalid private keys
+            // (although it's highly unlikely), but
+            //
+            //     p - max = 45560315531419706090280762371685220354
+            //
+            // Thus, we cannot generate invalid private keys and instead lose an
+            // insignificant amount of entropy.
+
+            priv_non_montgomery[j][3] &= (((uint64_t)1 << 62) - 1); // drop top two bits
+            fiat_pasta_fq_to_montgomery(kps[i + j].priv, priv_non_montgomery[j]);
+
+            generator_scalar_mul(&pubs[j], kps[i + j].priv);
+        }
+
+        projective_to_affine_batch(pubs_affine, pubs, len);
+        for (size_t j = 0; j < len; ++j) {
+            kps[i + j].pub = pubs_affine[j];
+        }
+    }
 
-    return;
+    memset(priv_non_montgomery, 0, sizeof(priv_non_montgomery));
+    return MINA_OK;
 }
 
 void generate_pubkey(Affine *pub_key, const Scalar priv_key)
 {
-    affine_scalar_mul(pub_key, priv_key, &AFFINE_ONE);
+    Group pub;
+    generator_scalar_mul(&pub, priv_key);
+    projective_to_affine(pub_key, &pub);
+}
+
+void generate_pubkeys(Affine *pub_keys, const Scalar *priv_keys, size_t n)
+{
+    Group pubs[PUBKEY_BATCH];
+
+    for (size_t i = 0; i < n; i += PUBKEY_BATCH) {
+        const size_t len = (n - i < PUBKEY_BATCH) ? n - i : PUBKEY_BATCH;
+
+        for (size_t j = 0; j < len; ++j) {
+            generator_scalar_mul(&pubs[j], priv_keys[i + j]);
+        }
+        projective_to_affine_batch(pub_keys + i, pubs, len);
+    }
+}
+
+// Base58 of the address bytes
+//
+//     0xcb | 0x01 0x01 | x (32 bytes, little endian) | parity of y | checksum
+//
+// The version byte fixes the length at 55 digits with no leading zeros, so
+// the encoder works on ten 32-bit words and peels off five digits per pass.
+#define ADDRESS_BYTES 40
+#define ADDRESS_DIGITS (MINA_ADDRESS_LEN - 1)
+#define ADDRESS_WORDS (ADDRESS_BYTES / 4)
+#define BASE58_POW5 656356768 // 58^5
+
+static void address_encode(char *out, const Affine *pub_key)
+{
+    uint8_t bytes[ADDRESS_BYTES];
+    uint64_t x[4];
+
+    bytes[0] = 0xcb;
+    bytes[1] = 0x01;
+    bytes[2] = 0x01;
+    fiat_pasta_fp_from_montgomery(x, pub_key->x);
+    for (size_t i = 0; i < 32; ++i) {
+        bytes[3 + i] = (uint8_t)(x[i / 8] >> (8 * (i % 8)));
+    }
+    bytes[35] = is_odd(pub_key->y);
+
+    uint8_t hash[SHA256_DIGEST_BYTES];
+    sha256(hash, bytes, 36);
+    sha256(hash, hash, sizeof(hash));
+    memcpy(bytes + 36, hash, 4);
+
+    uint32_t words[ADDRESS_WORDS];
+    for (size_t i = 0; i < ADDRESS_WORDS; ++i) {
+        words[i] = ((uint32_t)bytes[4 * i] << 24) | ((uint32_t)bytes[4 * i + 1] << 16)
+                 | ((uint32_t)bytes[4 * i + 2] << 8) | bytes[4 * i + 3];
+    }
+
+    for (size_t pos = ADDRESS_DIGITS; pos > 0; pos -= 5) {
+        uint64_t rem = 0;
+        for (size_t i = 0; i < ADDRESS_WORDS; ++i) {
+            const uint64_t cur = (rem << 32) | words[i];
+            words[i] = (uint32_t)(cur / BASE58_POW5);
+            rem = cur % BASE58_POW5;
+        }
+
+        for (size_t j = 1; j <= 5; ++j) {
+            out[pos - j] = b58digits_ordered[rem % 58];
+            rem /= 58;
+        }
+    }
+    out[ADDRESS_DIGITS] = '\0';
+}
+
+MinaStatus get_address(char *address, size_t len, const Affine *pub_key)
+{
+    if (!address || !pub_key || len < MINA_ADDRESS_LEN) {
+        return MINA_ERR_INVALID_PARAMETER;
+    }
+
+    address_encode(address, pub_key);
+    return MINA_OK;
+}
+
+void get_addresses(char (*addresses)[MINA_ADDRESS_LEN], const Affine *pub_keys, size_t n)
+{
+    for (size_t i = 0; i < n; ++i) {
+        address_encode(addresses[i], &pub_keys[i]);
+    }
+}
+
+typedef struct keypair_pool_job {
+    Keypair *kps;
+    char (*addresses)[MINA_ADDRESS_LEN];
+} KeypairPoolJob;
+
+static int keypair_pool_task(void *ctx, size_t begin, size_t end, size_t worker)
+{
+    KeypairPoolJob *job = ctx;
+    (void)worker;
+
+    TRY(generate_keypairs(job->kps + begin, end - begin));
+
+    if (job->addresses) {
+        for (size_t i = begin; i < end; ++i) {
+            address_encode(job->addresses[i], &job->kps[i].pub);
+        }
+    }
+    return MINA_OK;
+}
+
+MinaStatus generate_keypairs_pool(Pool *pool, Keypair *kps, char (*addresses)[MINA_ADDRESS_LEN], size_t n)
+{
+    if (!pool) {
+        return MINA_ERR_INVALID_PARAMETER;
+    }
+
+    KeypairPoolJob job = { kps, addresses };
+    return (MinaStatus)pool_for_status(pool, n, PUBKEY_BATCH, keypair_pool_task, &job);
 }
 
 uint8_t write_shifted(blake2b_state* ctx, uint8_t overlap_byte, const uint8_t *buf, size_t len, size_t shift)
@@ -660,64 +1294,144 @@ uint8_t write_rev_shifted(blake2b_state* ctx, uint8_t overlap_byte, const uint8_
     return overlap_byte;
 }
 
-void message_derive(Scalar out, const Keypair *kp, const ROInput *msg)
+// message_derive and message_hash extend a transaction's ROInput with the
+// public key and either the private key or the commitment's x, so their
+// inputs have a fixed size (DERIVE_* in crypto.h)
+#define HASH_FIELDS (TX_FIELDS + 3)
+#define HASH_PACKED_FIELDS (HASH_FIELDS + (TX_BITS + FIELD_SIZE_IN_BITS - 2) / (FIELD_SIZE_IN_BITS - 1))
+
+// blake2b of the packed input, truncated to 254 bits so it is below q
+static void derive_hash(Scalar out, const uint8_t *input_bytes, size_t len)
+{
+    uint8_t hash_out[32];
+    blake2b(hash_out, 32, input_bytes, len, NULL, 0);
+
+    // take 254 bits / drop the top 2 bits
+    packed_bit_array_set(hash_out, 255, 0);
+    packed_bit_array_set(hash_out, 254, 0);
+    fiat_pasta_fq_to_montgomery(out, (uint64_t*) hash_out);
+}
+
+MinaStatus message_derive(Scalar out, const Keypair *kp, const ROInput *msg)
 {
     ROInput input;
-    uint64_t input_fields[20];
+    uint64_t input_fields[DERIVE_FIELDS * LIMBS_PER_FIELD];
+    bool input_bits[DERIVE_BITS];
 
-    size_t bits_capacity = msg->bits_len + 255;
+    if (msg->fields_len > TX_FIELDS || msg->bits_len > TX_BITS) {
+        return MINA_ERR_CAPACITY;
+    }
 
     input.fields = input_fields;
-    input.bits = malloc(sizeof(bool) * bits_capacity);
+    input.bits = input_bits;
 
-    for (size_t i = 0; i < msg->fields_len * LIMBS_PER_FIELD; ++i) {
-      input.fields[i] = msg->fields[i];
-    }
+    memcpy(input.fields, msg->fields, sizeof(uint64_t) * LIMBS_PER_FIELD * msg->fields_len);
     memcpy(input.bits, msg->bits, sizeof(bool) * msg->bits_len);
 
     input.fields_len = msg->fields_len;
     input.bits_len = msg->bits_len;
-    input.fields_capacity = 5;
-    input.bits_capacity = bits_capacity;
+    input.fields_capacity = DERIVE_FIELDS;
+    input.bits_capacity = DERIVE_BITS;
 
-    roinput_add_field(&input, kp->pub.x);
-    roinput_add_field(&input, kp->pub.y);
-    roinput_add_scalar(&input, kp->priv);
+    TRY(roinput_add_field(&input, kp->pub.x));
+    TRY(roinput_add_field(&input, kp->pub.y));
+    TRY(roinput_add_scalar(&input, kp->priv));
 
     size_t input_size_in_bits = input.bits_len + FIELD_SIZE_IN_BITS * input.fields_len;
     size_t input_size_in_bytes = (input_size_in_bits + 7) / 8;
-    uint8_t* input_bytes = malloc(sizeof(uint8_t) * input_size_in_bytes);
+    uint8_t input_bytes[DERIVE_BYTES] = { 0 };
     roinput_to_bytes(input_bytes, &input);
+    derive_hash(out, input_bytes, input_size_in_bytes);
 
-    uint8_t hash_out[32];
-    blake2b(hash_out, 32, input_bytes, input_size_in_bytes, NULL, 0);
+    return MINA_OK;
+}
 
-    // take 254 bits / drop the top 2 bits
-    packed_bit_array_set(hash_out, 255, 0);
-    packed_bit_array_set(hash_out, 254, 0);
-    fiat_pasta_fq_to_montgomery(out, (uint64_t*) hash_out);
+void prepared_key_init(PreparedKey *key, const Keypair *kp)
+{
+    uint64_t fields[DERIVE_FIELDS * LIMBS_PER_FIELD] = { 0 };
+    bool bits[DERIVE_BITS] = { 0 };
+    ROInput input = { fields, bits, TX_FIELDS, DERIVE_FIELDS, TX_BITS, DERIVE_BITS };
+
+    memset(key, 0, sizeof(PreparedKey));
+    key->kp = *kp;
+    field_copy(key->pub.x, kp->pub.x);
+    key->pub.is_odd = is_odd(kp->pub.y);
+
+    // the layout of message_derive, with zero transaction fields and bits;
+    // the capacities leave room for exactly these, so nothing can fail
+    roinput_add_field(&input, kp->pub.x);
+    roinput_add_field(&input, kp->pub.y);
+    roinput_add_scalar(&input, kp->priv);
+    roinput_to_bytes(key->derive, &input);
+}
+
+// ORs the bytes of in into out from bit offset bit on (little endian, as
+// roinput_to_bytes packs)
+static void derive_or_bytes(uint8_t *out, size_t bit, const uint8_t *in, size_t len)
+{
+    const size_t shift = bit % 8;
+    out += bit / 8;
+    for (size_t i = 0; i < len; ++i) {
+        out[i] |= (uint8_t)(in[i] << shift);
+        if (shift) {
+            out[i + 1] |= (uint8_t)(in[i] >> (8 - shift));
+        }
+    }
+}
+
+// message_derive with the key's part of the input already packed. msg must
+// be a transaction's ROInput, which has exactly TX_FIELDS and TX_BITS.
+static MinaStatus message_derive_prepared(Scalar out, const PreparedKey *key, const ROInput *msg)
+{
+    if (msg->fields_len != TX_FIELDS || msg->bits_len != TX_BITS) {
+        return MINA_ERR_CAPACITY;
+    }
+
+    uint8_t input_bytes[DERIVE_BYTES];
+    memcpy(input_bytes, key->derive, DERIVE_BYTES);
+
+    // the transaction's bits are zero in the template, so they are ORed in
+    // a byte at a time; the padding bits above each value are zero and
+    // leave the key's bits after it intact
+    Field tmp;
+    for (size_t i = 0; i < TX_FIELDS; ++i) {
+        fiat_pasta_fp_from_montgomery(tmp, msg->fields + (i * LIMBS_PER_FIELD));
+        derive_or_bytes(input_bytes, i * FIELD_SIZE_IN_BITS, (const uint8_t *)tmp, FIELD_BYTES);
+    }
+
+    uint8_t bits[(TX_BITS + 7) / 8] = { 0 };
+    for (size_t i = 0; i < TX_BITS; ++i) {
+        bits[i / 8] |= (uint8_t)(msg->bits[i] << (i % 8));
+    }
+    derive_or_bytes(input_bytes, FIELD_SIZE_IN_BITS * DERIVE_FIELDS, bits, sizeof(bits));
 
-    free(input_bytes);
+    derive_hash(out, input_bytes, DERIVE_BYTES);
+    return MINA_OK;
 }
 
-void message_hash(Scalar out, const Affine *pub, const Field rx, const ROInput *msg)
+MinaStatus message_hash(Scalar out, const Affine *pub, const Field rx, const ROInput *msg)
 {
-    uint64_t input_fields[24];
+    uint64_t input_fields[HASH_FIELDS * LIMBS_PER_FIELD];
+    bool input_bits[TX_BITS];
     ROInput input;
-    input.fields_capacity = msg->fields_len + 3;
-    input.bits_capacity = msg->bits_capacity;
 
+    if (msg->fields_len > TX_FIELDS || msg->bits_len > TX_BITS) {
+        return MINA_ERR_CAPACITY;
+    }
+
+    input.fields_capacity = HASH_FIELDS;
+    input.bits_capacity = TX_BITS;
     input.fields = input_fields;
-    input.bits = (bool *) malloc(sizeof(bool) * input.bits_capacity);
+    input.bits = input_bits;
     input.fields_len = msg->fields_len;
     input.bits_len = msg->bits_len;
 
     memcpy(input.fields, msg->fields, sizeof(uint64_t) * LIMBS_PER_FIELD * msg->fields_len);
     memcpy(input.bits, msg->bits, sizeof(bool) * msg->bits_len);
 
-    roinput_add_field(&input, pub->x);
-    roinput_add_field(&input, pub->y);
-    roinput_add_field(&input, rx);
+    TRY(roinput_add_field(&input, pub->x));
+    TRY(roinput_add_field(&input, pub->y));
+    TRY(roinput_add_field(&input, rx));
 
     // Initial sponge state
     State pos = {
@@ -726,77 +1440,529 @@ void message_hash(Scalar out, const Affine *pub, const Field rx, const ROInput *
       { 0xd4559679d839ff92, 0x577371d495f4d71b, 0x3227c7db607b3ded, 0x2ca212648a12291e}
     };
 
-    // over-estimate of field elements needed
-    uint64_t* packed_elements = malloc(sizeof(uint64_t) * LIMBS_PER_FIELD * 20);
+    uint64_t packed_elements[HASH_PACKED_FIELDS * LIMBS_PER_FIELD];
     size_t packed_elements_len = roinput_to_fields(packed_elements, &input);
 
     poseidon_update(pos, packed_elements, packed_elements_len);
     poseidon_digest(out, pos);
 
-    free(packed_elements);
+    return MINA_OK;
 }
 
-void sign(Signature *sig, const Keypair *kp, const Transaction *transaction)
+static uint64_t sign_batch_now_ns(void)
 {
-    // Convert transaction to ROInput
-    uint64_t input_fields[12];
-    ROInput input;
-    input.fields_capacity = 3;
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
 
-    input.bits_capacity = FEE_BITS + TOKEN_ID_BITS + 1 + NONCE_BITS + GLOBAL_SLOT_BITS + MEMO_BITS + TAG_BITS + 1 + 1 + TOKEN_ID_BITS + AMOUNT_BITS + 1;
-    input.fields = input_fields;
-    input.bits = malloc(sizeof(bool) * input.bits_capacity);
-    input.fields_len = 0;
-    input.bits_len = 0;
-
-    roinput_add_field(&input, transaction->fee_payer_pk.x);
-    roinput_add_field(&input, transaction->source_pk.x);
-    roinput_add_field(&input, transaction->receiver_pk.x);
-
-    roinput_add_uint64(&input, transaction->fee);
-    roinput_add_uint64(&input, transaction->fee_token);
-    roinput_add_bit(&input, transaction->fee_payer_pk.is_odd);
-    roinput_add_uint32(&input, transaction->nonce);
-    roinput_add_uint32(&input, transaction->valid_until);
-    roinput_add_bytes(&input, transaction->memo, MEMO_BYTES);
+static MinaStatus transaction_to_roinput(ROInput *input, uint64_t *fields, bool *bits, const Transaction *transaction)
+{
+    input->fields = fields;
+    input->bits = bits;
+    input->fields_capacity = TX_FIELDS;
+    input->bits_capacity = TX_BITS;
+    input->fields_len = 0;
+    input->bits_len = 0;
+
+    TRY(roinput_add_field(input, transaction->fee_payer_pk.x));
+    TRY(roinput_add_field(input, transaction->source_pk.x));
+    TRY(roinput_add_field(input, transaction->receiver_pk.x));
+
+    TRY(roinput_add_uint64(input, transaction->fee));
+    TRY(roinput_add_uint64(input, transaction->fee_token));
+    TRY(roinput_add_bit(input, transaction->fee_payer_pk.is_odd));
+    TRY(roinput_add_uint32(input, transaction->nonce));
+    TRY(roinput_add_uint32(input, transaction->valid_until));
+    TRY(roinput_add_bytes(input, transaction->memo, MEMO_BYTES));
     for (size_t i = 0; i < 3; ++i) {
-      roinput_add_bit(&input, transaction->tag[i]);
+      TRY(roinput_add_bit(input, transaction->tag[i]));
     }
-    roinput_add_bit(&input, transaction->source_pk.is_odd);
-    roinput_add_bit(&input, transaction->receiver_pk.is_odd);
-    roinput_add_uint64(&input, transaction->token_id);
-    roinput_add_uint64(&input, transaction->amount);
-    roinput_add_bit(&input, transaction->token_locked);
+    TRY(roinput_add_bit(input, transaction->source_pk.is_odd));
+    TRY(roinput_add_bit(input, transaction->receiver_pk.is_odd));
+    TRY(roinput_add_uint64(input, transaction->token_id));
+    TRY(roinput_add_uint64(input, transaction->amount));
+    TRY(roinput_add_bit(input, transaction->token_locked));
+
+    return MINA_OK;
+}
+
+// The keys of a batch: prepared[i] if set, kps[i * kps_stride] otherwise
+typedef struct sign_keys {
+    const Keypair *kps;
+    size_t kps_stride;
+    const PreparedKey *const *prepared;
+} SignKeys;
 
-    Scalar k;
-    message_derive(k, kp, &input);
+static const Keypair *sign_keypair(const SignKeys *keys, size_t i)
+{
+    return keys->prepared ? &keys->prepared[i]->kp : &keys->kps[i * keys->kps_stride];
+}
+
+// k = derive(kp, msg), which must not be zero
+static MinaStatus sign_nonce(Scalar k, const SignKeys *keys, size_t i, const ROInput *msg)
+{
+    if (keys->prepared) {
+        TRY(message_derive_prepared(k, keys->prepared[i], msg));
+    } else {
+        TRY(message_derive(k, sign_keypair(keys, i), msg));
+    }
 
     uint64_t k_nonzero;
     fiat_pasta_fq_nonzero(&k_nonzero, k);
     if (! k_nonzero) {
-      exit(1);
+      return MINA_ERR_ZERO_NONCE;
     }
+    return MINA_OK;
+}
 
-    // r = k*g
-    Affine r;
-    affine_scalar_mul(&r, k, &AFFINE_ONE);
-
-    field_copy(sig->rx, r.x);
+// s = k + e*sk, with k negated if r.y is odd
+static void sign_finish(Signature *sig, Scalar k, const Affine *r, const Scalar e, const Scalar priv)
+{
+    field_copy(sig->rx, r->x);
 
-    if (is_odd(r.y)) {
+    if (is_odd(r->y)) {
         // negate (k = -k)
         Scalar tmp;
         fiat_pasta_fq_copy(tmp, k);
         scalar_negate(k, tmp);
     }
 
-    Scalar e;
-    message_hash(e, &kp->pub, r.x, &input);
-
-    // s = k + e*sk
     Scalar e_priv;
-    scalar_mul(e_priv, e, kp->priv);
+    scalar_mul(e_priv, e, priv);
     scalar_add(sig->s, k, e_priv);
+}
+
+// Signs up to SIGN_BATCH transactions one stage at a time, so that each
+// stage runs over contiguous arrays and the R points share one inversion.
+// A transaction that fails a stage keeps its status in scratch->status and
+// sits out the stages after it, its R the identity, which the shared
+// inversion skips. Returns MINA_OK or the first status that is not.
+static MinaStatus sign_batch_chunk(SignBatchScratch *scratch, const SignKeys *keys, const Transaction *txns,
+                                   size_t n, Signature *sigs, SignBatchStats *stats)
+{
+    MinaStatus *status = scratch->status;
+    uint64_t t0 = stats ? sign_batch_now_ns() : 0;
+
+    for (size_t i = 0; i < n; ++i) {
+        status[i] = transaction_to_roinput(&scratch->inputs[i], scratch->fields[i], scratch->bits[i], &txns[i]);
+    }
+    uint64_t t1 = stats ? sign_batch_now_ns() : 0;
+
+    // k = derive(kp, msg)
+    for (size_t i = 0; i < n; ++i) {
+        if (status[i] == MINA_OK) {
+            status[i] = sign_nonce(scratch->k[i], keys, i, &scratch->inputs[i]);
+        }
+    }
+    uint64_t t2 = stats ? sign_batch_now_ns() : 0;
+
+    // R = k*g
+    for (size_t i = 0; i < n; ++i) {
+        if (status[i] == MINA_OK) {
+            generator_scalar_mul(&scratch->R[i], scratch->k[i]);
+        } else {
+            scratch->R[i] = GROUP_ZERO;
+        }
+    }
+    uint64_t t3 = stats ? sign_batch_now_ns() : 0;
+
+    projective_to_affine_batch(scratch->r, scratch->R, n);
+    uint64_t t4 = stats ? sign_batch_now_ns() : 0;
+
+    // e = hash(pub, rx, msg)
+    for (size_t i = 0; i < n; ++i) {
+        if (status[i] == MINA_OK) {
+            status[i] = message_hash(scratch->e[i], &sign_keypair(keys, i)->pub, scratch->r[i].x, &scratch->inputs[i]);
+        }
+    }
+    uint64_t t5 = stats ? sign_batch_now_ns() : 0;
+
+    MinaStatus first = MINA_OK;
+    size_t signed_len = 0;
+    for (size_t i = 0; i < n; ++i) {
+        if (status[i] == MINA_OK) {
+            sign_finish(&sigs[i], scratch->k[i], &scratch->r[i], scratch->e[i], sign_keypair(keys, i)->priv);
+            signed_len += 1;
+        } else if (first == MINA_OK) {
+            first = status[i];
+        }
+    }
+
+    if (stats) {
+        uint64_t t6 = sign_batch_now_ns();
+        stats->roinput_ns += t1 - t0;
+        stats->derive_ns += t2 - t1;
+        stats->commit_ns += t3 - t2;
+        stats->normalize_ns += t4 - t3;
+        stats->hash_ns += t5 - t4;
+        stats->scalar_ns += t6 - t5;
+        stats->signatures += signed_len;
+    }
+
+    return first;
+}
+
+static MinaStatus sign_batch_keys(const SignKeys *keys, const Transaction *txns, size_t n, Signature *sigs,
+                                  MinaStatus *results, SignBatchScratch *scratch, SignBatchStats *stats)
+{
+    if (n > 0 && ((!keys->kps && !keys->prepared) || !txns || !sigs)) {
+        return MINA_ERR_INVALID_PARAMETER;
+    }
+
+    SignBatchScratch *owned = NULL;
+    if (!scratch) {
+        owned = malloc(sizeof(SignBatchScratch));
+        if (!owned) {
+            return MINA_ERR_NO_MEMORY;
+        }
+        scratch = owned;
+    }
+
+    MinaStatus status = MINA_OK;
+    for (size_t i = 0; i < n; i += SIGN_BATCH) {
+        const size_t len = (n - i < SIGN_BATCH) ? n - i : SIGN_BATCH;
+        const SignKeys chunk = {
+            keys->kps ? keys->kps + i * keys->kps_stride : NULL,
+            keys->kps_stride,
+            keys->prepared ? keys->prepared + i : NULL,
+        };
+        const MinaStatus chunk_status = sign_batch_chunk(scratch, &chunk, txns + i, len, sigs + i, stats);
+        if (status == MINA_OK) {
+            status = chunk_status;
+        }
+        if (results) {
+            memcpy(results + i, scratch->status, len * sizeof(MinaStatus));
+        }
+    }
+
+    free(owned);
+    return status;
+}
+
+MinaStatus sign_batch_strided(const Keypair *kps, size_t kps_stride, const Transaction *txns, size_t n,
+                              Signature *sigs, MinaStatus *results, SignBatchScratch *scratch,
+                              SignBatchStats *stats)
+{
+    const SignKeys keys = { kps, kps_stride, NULL };
+    return sign_batch_keys(&keys, txns, n, sigs, results, scratch, stats);
+}
+
+MinaStatus sign_batch_prepared(const PreparedKey *const *keys, const Transaction *txns, size_t n, Signature *sigs,
+                               MinaStatus *results, SignBatchScratch *scratch, SignBatchStats *stats)
+{
+    const SignKeys batch_keys = { NULL, 0, keys };
+    return sign_batch_keys(&batch_keys, txns, n, sigs, results, scratch, stats);
+}
+
+typedef struct sign_pool_job {
+    Pool *pool;
+    const Keypair *kps;
+    size_t kps_stride;
+    const Transaction *txns;
+    Signature *sigs;
+} SignPoolJob;
+
+static int sign_pool_task(void *ctx, size_t begin, size_t end, size_t worker)
+{
+    SignPoolJob *job = ctx;
+    return sign_batch_strided(job->kps + begin * job->kps_stride, job->kps_stride, job->txns + begin, end - begin,
+                              job->sigs + begin, NULL, pool_scratch(job->pool, worker), NULL);
+}
+
+Pool *sign_pool_create(size_t threads)
+{
+    return pool_create(threads, sizeof(SignBatchScratch));
+}
+
+MinaStatus sign_batch_pool(Pool *pool, const Keypair *kps, size_t kps_stride, const Transaction *txns, size_t n,
+                           Signature *sigs)
+{
+    if (!pool) {
+        return MINA_ERR_INVALID_PARAMETER;
+    }
+
+    SignPoolJob job = { pool, kps, kps_stride, txns, sigs };
+
+    // Whole SIGN_BATCH chunks amortize the batched normalization, smaller
+    // ones keep every worker busy on short batches
+    return (MinaStatus)pool_for_status(pool, n, SIGN_BATCH, sign_pool_task, &job);
+}
+
+MinaStatus sign_batch(const Keypair *kps, const Transaction *txns, size_t n, Signature *sigs)
+{
+    return sign_batch_strided(kps, 1, txns, n, sigs, NULL, NULL, NULL);
+}
+
+// The stages of sign_batch_chunk for one transaction, all on the stack
+static MinaStatus sign_one(Signature *sig, const SignKeys *keys, const Transaction *transaction)
+{
+    uint64_t fields[TX_FIELDS * LIMBS_PER_FIELD];
+    bool bits[TX_BITS];
+    ROInput input;
+    TRY(transaction_to_roinput(&input, fields, bits, transaction));
+
+    Scalar k, e;
+    TRY(sign_nonce(k, keys, 0, &input));
+    const Keypair *kp = sign_keypair(keys, 0);
+
+    Group R;
+    Affine r;
+    generator_scalar_mul(&R, k);
+    projective_to_affine(&r, &R);
+
+    TRY(message_hash(e, &kp->pub, r.x, &input));
+    sign_finish(sig, k, &r, e, kp->priv);
+    return MINA_OK;
+}
+
+MinaStatus sign(Signature *sig, const Keypair *kp, const Transaction *transaction)
+{
+    if (!sig || !kp || !transaction) {
+        return MINA_ERR_INVALID_PARAMETER;
+    }
+    const SignKeys keys = { kp, 0, NULL };
+    return sign_one(sig, &keys, transaction);
+}
+
+MinaStatus sign_prepared(Signature *sig, const PreparedKey *key, const Transaction *transaction)
+{
+    if (!sig || !key || !transaction) {
+        return MINA_ERR_INVALID_PARAMETER;
+    }
+    const SignKeys keys = { NULL, 0, &key };
+    return sign_one(sig, &keys, transaction);
+}
+
+// e = hash(pub, rx, msg), as sign computes it
+static MinaStatus verify_hash(Scalar e, const Signature *sig, const Affine *pub, const Transaction *transaction)
+{
+    if (!sig || !pub || !transaction) {
+        return MINA_ERR_INVALID_PARAMETER;
+    }
+    if (!affine_is_on_curve(pub)) {
+        return MINA_ERR_INVALID_POINT;
+    }
+
+    uint64_t fields[TX_FIELDS * LIMBS_PER_FIELD];
+    bool bits[TX_BITS];
+    ROInput input;
+    TRY(transaction_to_roinput(&input, fields, bits, transaction));
+    return message_hash(e, pub, sig->rx, &input);
+}
+
+// sign made s = k + e * priv with k * g of even y, so R = s * g - e * pub
+// is that commitment: not the identity, y even and x = rx
+static MinaStatus verify_commitment(const Signature *sig, const Group *R)
+{
+    if (is_zero(R)) {
+        return MINA_ERR_BAD_SIGNATURE;
+    }
+    Affine r;
+    projective_to_affine(&r, R);
+    return (!is_odd(r.y) && field_eq(r.x, sig->rx)) ? MINA_OK : MINA_ERR_BAD_SIGNATURE;
+}
+
+MinaStatus verify(const Signature *sig, const Affine *pub, const Transaction *transaction)
+{
+    Scalar e;
+    TRY(verify_hash(e, sig, pub, transaction));
+
+    Affine neg = *pub;
+    field_negate(neg.y, neg.y);
+
+    // s * g and -e * pub have different Z, so group_add would not see that
+    // they are equal; the complete addition needs no such check
+    Group sg, p, ep, R;
+    Homogeneous sg_h, ep_h, sum;
+    generator_scalar_mul(&sg, sig->s);
+    affine_to_projective(&p, &neg);
+    group_scalar_mul(&ep, e, &p);
+    group_to_homogeneous(&sg_h, &sg);
+    group_to_homogeneous(&ep_h, &ep);
+    homogeneous_add(&sum, &sg_h, &ep_h);
+    homogeneous_to_group(&R, &sum);
+    return verify_commitment(sig, &R);
+}
+
+MinaStatus verify_fixed_base(const Signature *sig, const Affine *pub, const FixedBaseTable *table,
+                             const Transaction *transaction)
+{
+    Scalar e;
+    TRY(verify_hash(e, sig, pub, transaction));
+
+    Homogeneous acc = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } };
+    field_copy(acc.Y, FIELD_ONE);
+    fixed_base_mul_add(&acc, &GENERATOR_TABLE, sig->s, false);
+    fixed_base_mul_add(&acc, table, e, true);
+
+    Group R;
+    homogeneous_to_group(&R, &acc);
+    return verify_commitment(sig, &R);
+}
+
+// Width-WNAF_BITS NAF of k, least significant digit first: every digit is
+// zero or odd and below 2^(WNAF_BITS - 1) in absolute value, and any
+// WNAF_BITS consecutive digits hold at most one that is nonzero. Returns
+// the number of digits.
+#define WNAF_BITS 5
+#define WNAF_POINTS (1 << (WNAF_BITS - 2)) // p, 3p, ..., (2^(WNAF_BITS - 1) - 1)p
+
+static size_t scalar_wnaf(int8_t naf[SCALAR_BITS + 1], const Scalar k)
+{
+    uint64_t n[4];
+    fiat_pasta_fq_from_montgomery(n, k);
+
+    size_t len = 0;
+    while (n[0] | n[1] | n[2] | n[3]) {
+        int digit = 0;
+        if (n[0] & 1) {
+            digit = (int)(n[0] & ((1 << WNAF_BITS) - 1));
+            if (digit >= (1 << (WNAF_BITS - 1))) {
+                digit -= 1 << WNAF_BITS;
+            }
+
+            // n -= digit, which clears the low WNAF_BITS bits
+            uint64_t borrow = (uint64_t)digit;
+            if (digit > 0) {
+                for (size_t i = 0; i < 4 && borrow; ++i) {
+                    const uint64_t before = n[i];
+                    n[i] -= borrow;
+                    borrow = n[i] > before;
+                }
+            } else {
+                uint64_t carry = (uint64_t)-digit;
+                for (size_t i = 0; i < 4 && carry; ++i) {
+                    n[i] += carry;
+                    carry = n[i] < carry;
+                }
+            }
+        }
+        naf[len++] = (int8_t)digit;
+
+        for (size_t i = 0; i < 3; ++i) {
+            n[i] = (n[i] >> 1) | (n[i + 1] << 63);
+        }
+        n[3] >>= 1;
+    }
+    return len;
+}
+
+// r = k * p in variable time, with an addition about every WNAF_BITS + 1
+// bits where double-and-add takes one every other bit
+static void group_scalar_mul_wnaf(Group *r, const Scalar k, const Group *p)
+{
+    Group table[WNAF_POINTS], dbl, tmp;
+    table[0] = *p;
+    group_dbl(&dbl, p);
+    for (size_t j = 1; j < WNAF_POINTS; ++j) {
+        group_add(&table[j], &table[j - 1], &dbl);
+    }
+
+    int8_t naf[SCALAR_BITS + 1];
+    const size_t len = scalar_wnaf(naf, k);
+
+    *r = GROUP_ZERO;
+    for (size_t i = len; i-- > 0;) {
+        group_dbl(&tmp, r);
+        if (naf[i] > 0) {
+            group_add(r, &tmp, &table[naf[i] / 2]);
+        } else if (naf[i] < 0) {
+            Group neg = table[-naf[i] / 2];
+            field_negate(neg.Y, neg.Y);
+            group_add(r, &tmp, &neg);
+        } else {
+            *r = tmp;
+        }
+    }
+}
+
+// verify for n <= VERIFY_BATCH signatures, one normalization for all R
+static MinaStatus verify_batch_chunk(const Signature *sigs, const Affine *pubs, const Transaction *txns, size_t n,
+                                     MinaStatus *results)
+{
+    Group R[VERIFY_BATCH];
+    Affine r[VERIFY_BATCH];
+
+    for (size_t i = 0; i < n; ++i) {
+        Scalar e;
+        results[i] = verify_hash(e, &sigs[i], &pubs[i], &txns[i]);
+        if (results[i] != MINA_OK) {
+            R[i] = GROUP_ZERO;
+            continue;
+        }
+
+        Homogeneous acc = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } };
+        field_copy(acc.Y, FIELD_ONE);
+        fixed_base_mul_add(&acc, &GENERATOR_TABLE, sigs[i].s, false);
+
+        Affine neg = pubs[i];
+        field_negate(neg.y, neg.y);
+
+        // s * g + (-e * pub) with the complete addition, as verify does
+        Group p, ep;
+        Homogeneous ep_h;
+        affine_to_projective(&p, &neg);
+        group_scalar_mul_wnaf(&ep, e, &p);
+        group_to_homogeneous(&ep_h, &ep);
+        homogeneous_add(&acc, &acc, &ep_h);
+        homogeneous_to_group(&R[i], &acc);
+    }
+
+    projective_to_affine_batch(r, R, n);
+
+    MinaStatus status = MINA_OK;
+    for (size_t i = 0; i < n; ++i) {
+        if (results[i] == MINA_OK
+            && (is_zero(&R[i]) || is_odd(r[i].y) || !field_eq(r[i].x, sigs[i].rx))) {
+            results[i] = MINA_ERR_BAD_SIGNATURE;
+        }
+        if (status == MINA_OK) {
+            status = results[i];
+        }
+    }
+    return status;
+}
+
+MinaStatus verify_batch(const Signature *sigs, const Affine *pubs, const Transaction *txns, size_t n,
+                        MinaStatus *results)
+{
+    if ((n > 0 && (!sigs || !pubs || !txns)) || !results) {
+        return MINA_ERR_INVALID_PARAMETER;
+    }
+
+    MinaStatus status = MINA_OK;
+    for (size_t begin = 0; begin < n; begin += VERIFY_BATCH) {
+        const size_t count = (n - begin < VERIFY_BATCH) ? n - begin : VERIFY_BATCH;
+        const MinaStatus chunk = verify_batch_chunk(sigs + begin, pubs + begin, txns + begin, count, results + begin);
+        if (status == MINA_OK) {
+            status = chunk;
+        }
+    }
+    return status;
+}
+
+typedef struct verify_pool_job {
+    const Signature *sigs;
+    const Affine *pubs;
+    const Transaction *txns;
+    MinaStatus *results;
+} VerifyPoolJob;
+
+static int verify_pool_task(void *ctx, size_t begin, size_t end, size_t worker)
+{
+    (void)worker;
+    VerifyPoolJob *job = ctx;
+    return verify_batch(job->sigs + begin, job->pubs + begin, job->txns + begin, end - begin, job->results + begin);
+}
+
+MinaStatus verify_batch_pool(Pool *pool, const Signature *sigs, const Affine *pubs, const Transaction *txns, size_t n,
+                             MinaStatus *results)
+{
+    if (!pool || (n > 0 && (!sigs || !pubs || !txns)) || !results) {
+        return MINA_ERR_INVALID_PARAMETER;
+    }
 
-    free(input.bits);
+    VerifyPoolJob job = { sigs, pubs, txns, results };
+    return (MinaStatus)pool_for_status(pool, n, VERIFY_BATCH, verify_pool_task, &job);
 }
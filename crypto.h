@@ -7,6 +7,8 @@
 #include <stdio.h>
 #include <stdbool.h>
 
+#include "pool.h"
+
 #define os_memcpy memcpy
 
 #define BIP32_PATH_LEN 5
@@ -23,13 +25,37 @@
 
 #define MINA_ADDRESS_LEN 56 // includes null-byte
 
+// Fixed-base table for the generator: w-bit windows over 255-bit scalars
+#define GENERATOR_TABLE_WINDOW_BITS 4
+#define GENERATOR_TABLE_WINDOWS ((FIELD_SIZE_IN_BITS + GENERATOR_TABLE_WINDOW_BITS - 1) / GENERATOR_TABLE_WINDOW_BITS)
+#define GENERATOR_TABLE_POINTS ((1 << GENERATOR_TABLE_WINDOW_BITS) - 1)
+
+// Points normalized together by generate_pubkeys
+#define PUBKEY_BATCH 128
+
 #define COIN 1000000000ULL
 
+// Status returned by the entry points that can fail
+typedef enum mina_status {
+    MINA_OK = 0,
+    MINA_ERR_INVALID_PARAMETER,
+    MINA_ERR_CAPACITY,    // ROInput is full
+    MINA_ERR_ZERO_NONCE,  // derived nonce is zero, the transaction cannot be signed
+    MINA_ERR_ENTROPY,     // no randomness available
+    MINA_ERR_INVALID_KEY, // BIP32 child key out of range, use the next index
+    MINA_ERR_NOT_FOUND,   // search gave up before finding a match
+    MINA_ERR_NO_MEMORY,
+    MINA_ERR_INVALID_POINT, // x is not the x-coordinate of a curve point
+    MINA_ERR_BAD_SIGNATURE, // the signature does not verify
+} MinaStatus;
+
+const char *mina_status_str(MinaStatus status);
+
 typedef uint8_t FieldBytes[FIELD_BYTES];
 typedef uint8_t ScalarBytes[SCALAR_BYTES];
 
-typedef uint64_t Field[FIELD_BYTES];
-typedef uint64_t Scalar[SCALAR_BYTES];
+typedef uint64_t Field[LIMBS_PER_FIELD];
+typedef uint64_t Scalar[LIMBS_PER_FIELD];
 
 typedef uint64_t Currency;
 #define FEE_BITS 64
@@ -58,6 +84,14 @@ typedef struct affine {
     Field y;
 } Affine;
 
+// Homogeneous projective coordinates, x = X / Z and y = Y / Z, with the
+// identity at (0 : 1 : 0)
+typedef struct homogeneous {
+    Field X;
+    Field Y;
+    Field Z;
+} Homogeneous;
+
 typedef struct compressed {
     Field x;
     bool is_odd;
@@ -99,28 +133,177 @@ typedef struct roinput {
   size_t bits_capacity;
 } ROInput;
 
-void roinput_add_field(ROInput *input, const Field a);
-void roinput_add_scalar(ROInput *input, const Scalar a);
-void roinput_add_bit(ROInput *input, bool b);
-void roinput_add_bytes(ROInput *input, const uint8_t *bytes, size_t len);
-void roinput_add_uint32(ROInput *input, const uint32_t x);
-void roinput_add_uint64(ROInput *input, const uint64_t x);
+// Size of a transaction's ROInput
+#define TX_FIELDS 3
+#define TX_BITS (FEE_BITS + TOKEN_ID_BITS + 1 + NONCE_BITS + GLOBAL_SLOT_BITS + MEMO_BITS + TAG_BITS + 1 + 1 + TOKEN_ID_BITS + AMOUNT_BITS + 1)
+
+// Transactions signed together by sign_batch, stage by stage
+#define SIGN_BATCH 64
+
+// Signatures whose commitments verify_batch normalizes together
+#define VERIFY_BATCH 64
+
+// Per-stage state of sign_batch, one array per stage
+typedef struct sign_batch_scratch {
+  uint64_t fields[SIGN_BATCH][TX_FIELDS * LIMBS_PER_FIELD];
+  bool bits[SIGN_BATCH][TX_BITS];
+  ROInput inputs[SIGN_BATCH];
+  Scalar k[SIGN_BATCH];
+  Group R[SIGN_BATCH];
+  Affine r[SIGN_BATCH];
+  Scalar e[SIGN_BATCH];
+  MinaStatus status[SIGN_BATCH]; // a failed transaction skips the later stages
+} SignBatchScratch;
+
+// message_derive hashes a transaction's fields and the public key, then
+// the transaction's bits and the private key, packed into DERIVE_BYTES
+#define DERIVE_FIELDS (TX_FIELDS + 2)
+#define DERIVE_BITS (TX_BITS + FIELD_SIZE_IN_BITS)
+#define DERIVE_BYTES ((FIELD_SIZE_IN_BITS * DERIVE_FIELDS + DERIVE_BITS + 7) / 8)
+
+// Fixed-base table of a point p, as the generator's:
+//
+//     points[i][j - 1] = j * 2^(w * i) * p,  1 <= j < 2^w
+typedef struct fixed_base_table {
+  Affine points[GENERATOR_TABLE_WINDOWS][GENERATOR_TABLE_POINTS];
+} FixedBaseTable;
+
+// The generator's table, generated by tools/gentables.py (generator_table.c)
+extern const FixedBaseTable GENERATOR_TABLE;
+
+// A keypair with what signing derives from it alone: the compressed public
+// key that transactions name as fee payer, and the input of message_derive
+// with the key's bits in place and the transaction's bits zero, so each
+// signature packs only the transaction
+typedef struct prepared_key {
+  Keypair kp;
+  Compressed pub;
+  uint8_t derive[DERIVE_BYTES];
+} PreparedKey;
+
+// Nanoseconds spent in each stage of sign_batch, accumulated
+typedef struct sign_batch_stats {
+  uint64_t roinput_ns;
+  uint64_t derive_ns;
+  uint64_t commit_ns;
+  uint64_t normalize_ns;
+  uint64_t hash_ns;
+  uint64_t scalar_ns;
+  size_t signatures;
+} SignBatchStats;
+
+MinaStatus roinput_add_field(ROInput *input, const Field a);
+MinaStatus roinput_add_scalar(ROInput *input, const Scalar a);
+MinaStatus roinput_add_bit(ROInput *input, bool b);
+MinaStatus roinput_add_bytes(ROInput *input, const uint8_t *bytes, size_t len);
+MinaStatus roinput_add_uint32(ROInput *input, const uint32_t x);
+MinaStatus roinput_add_uint64(ROInput *input, const uint64_t x);
 
 void scalar_copy(Scalar c, const Scalar a);
+void scalar_inv(Scalar c, const Scalar a);
+void scalar_pow(Scalar c, const Scalar a, const uint64_t *e, size_t e_limbs);
 
 void field_add(Field c, const Field a, const Field b);
 void field_copy(Field c, const Field a);
 void field_mul(Field c, const Field a, const Field b);
 void field_sq(Field c, const Field a);
+void field_pow(Field c, const Field a, const uint64_t *e, size_t e_limbs);
 void group_add(Group *c, const Group *a, const Group *b);
+void group_madd_affine(Group *r, const Group *p, const Affine *q);
 void group_dbl(Group *c, const Group *a);
 void group_scalar_mul(Group *r, const Scalar k, const Group *p);
+void generator_scalar_mul(Group *r, const Scalar k);
 void affine_scalar_mul(Affine *r, const Scalar k, const Affine *p);
+void affine_to_projective(Group *r, const Affine *p);
 void projective_to_affine(Affine *p, const Group *r);
+void projective_to_affine_batch(Affine *r, const Group *p, size_t n);
+
+// The complete formulas of Renes, Costello and Batina for a = 0: no input
+// is special, so none of these branch on their points. r may alias p and q.
+// homogeneous_madd takes any q but the identity. homogeneous_scalar_mul is
+// constant time; homogeneous_msm, sum k[i] * p[i] with shared doublings,
+// is not.
+void affine_to_homogeneous(Homogeneous *r, const Affine *p);
+void homogeneous_to_affine(Affine *r, const Homogeneous *p);
+void homogeneous_add(Homogeneous *r, const Homogeneous *p, const Homogeneous *q);
+void homogeneous_madd(Homogeneous *r, const Homogeneous *p, const Affine *q);
+void homogeneous_dbl(Homogeneous *r, const Homogeneous *p);
+void homogeneous_scalar_mul(Homogeneous *r, const Scalar k, const Homogeneous *p);
+void homogeneous_msm(Homogeneous *r, const Scalar *k, const Affine *p, size_t n);
+
+// Whether y^2 = x^3 + 5; false for the point at infinity (0, 0)
+unsigned int affine_is_on_curve(const Affine *p);
 
-void generate_keypair(Keypair *keypair, uint32_t account);
+// The point with x-coordinate c->x and the parity of y given by c->is_odd
+MinaStatus affine_decompress(Affine *p, const Compressed *c);
+
+// Random keypair, account is unused (see bip32.h to derive accounts)
+MinaStatus generate_keypair(Keypair *keypair, uint32_t account);
 void generate_pubkey(Affine *pub_key, const Scalar priv_key);
-int get_address(char *address, size_t len, const Affine *pub_key);
+void generate_pubkeys(Affine *pub_keys, const Scalar *priv_keys, size_t n);
+
+// n random keypairs, normalized PUBKEY_BATCH at a time
+MinaStatus generate_keypairs(Keypair *kps, size_t n);
+
+// B62... address of a public key, len >= MINA_ADDRESS_LEN
+MinaStatus get_address(char *address, size_t len, const Affine *pub_key);
+void get_addresses(char (*addresses)[MINA_ADDRESS_LEN], const Affine *pub_keys, size_t n);
+
+// generate_keypairs across the pool's workers, with the addresses of the
+// keys if addresses is not NULL
+MinaStatus generate_keypairs_pool(Pool *pool, Keypair *kps, char (*addresses)[MINA_ADDRESS_LEN], size_t n);
+
+// On failure the contents of the signatures are unspecified
+MinaStatus sign(Signature *sig, const Keypair *kp, const Transaction *transaction);
+
+// kps[i] signs txns[i]
+MinaStatus sign_batch(const Keypair *kps, const Transaction *txns, size_t n, Signature *sigs);
+
+// kps[i * kps_stride] signs txns[i], so kps_stride = 0 signs everything
+// with one key. A transaction that fails does not hold up the rest of its
+// batch: the status of each is in results[i], and sigs[i] is set where it
+// is MINA_OK. Returns MINA_OK if all are signed, otherwise the status of
+// one that is not. results, scratch and stats may be NULL; a NULL scratch
+// is allocated once per call.
+MinaStatus sign_batch_strided(const Keypair *kps, size_t kps_stride, const Transaction *txns, size_t n,
+                              Signature *sigs, MinaStatus *results, SignBatchScratch *scratch,
+                              SignBatchStats *stats);
+
+void prepared_key_init(PreparedKey *key, const Keypair *kp);
+
+// sign and sign_batch_strided with prepared keys: keys[i] signs txns[i]
+MinaStatus sign_prepared(Signature *sig, const PreparedKey *key, const Transaction *transaction);
+MinaStatus sign_batch_prepared(const PreparedKey *const *keys, const Transaction *txns, size_t n, Signature *sigs,
+                               MinaStatus *results, SignBatchScratch *scratch, SignBatchStats *stats);
+
+// MINA_OK if sig signs transaction under pub, MINA_ERR_BAD_SIGNATURE if
+// not, MINA_ERR_INVALID_POINT if pub is not on the curve. Variable time:
+// everything it handles is public.
+MinaStatus verify(const Signature *sig, const Affine *pub, const Transaction *transaction);
+
+// verify with table = the fixed-base table of pub, so that s * g - e * pub
+// takes table lookups and additions only
+void fixed_base_table_init(FixedBaseTable *table, const Affine *p);
+MinaStatus verify_fixed_base(const Signature *sig, const Affine *pub, const FixedBaseTable *table,
+                             const Transaction *transaction);
+
+// verify of sigs[i] under pubs[i] and txns[i] for each i < n, with the
+// status of each in results[i]. s * g reads the generator table without
+// the masking of the constant-time path, e * pub uses a width-5 NAF of e,
+// and the commitments of each VERIFY_BATCH are normalized with one
+// inversion. Returns MINA_OK if all
+// verify, otherwise the status of one that does not.
+MinaStatus verify_batch(const Signature *sigs, const Affine *pubs, const Transaction *txns, size_t n,
+                        MinaStatus *results);
+
+// Pool whose workers each own a SignBatchScratch (threads = 0: one per core)
+Pool *sign_pool_create(size_t threads);
+
+// sign_batch_strided spread across the pool's workers, sigs in input order
+MinaStatus sign_batch_pool(Pool *pool, const Keypair *kps, size_t kps_stride, const Transaction *txns, size_t n,
+                           Signature *sigs);
 
-void sign(Signature *sig, const Keypair *kp, const Transaction *transaction);
+// verify_batch spread across the pool's workers, which need no scratch
+MinaStatus verify_batch_pool(Pool *pool, const Signature *sigs, const Affine *pubs, const Transaction *txns, size_t n,
+                             MinaStatus *results);
 
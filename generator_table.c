@@ -0,0 +1,1164 @@
+/* Autogenerated: python3 tools/gentables.py 4 */
+/* Fixed-base table of the generator, linked in read-only so that */
+/* generator_scalar_mul and verify need no table built at startup. */
+
+#include "crypto.h"
+
+#if GENERATOR_TABLE_WINDOW_BITS == 4
+const FixedBaseTable GENERATOR_TABLE = { {
+  // 2^0 * g
+  {
+    { { 0x34786d38fffffffd, 0x992c350be41914ad, 0xffffffffffffffff, 0x3fffffffffffffff }, { 0x2f474795455d409d, 0xb443b9b74b8255d9, 0x270c412f2c9a5d66, 0x08e00f71ba43dd6b } },
+    { { 0x303c567b00000007, 0xefee2ee4411acfc1, 0x0000000000000000, 0x2000000000000000 }, { 0x142346ca4827f1cb, 0xd33d1c5d270dc3d0, 0x2a93c997c8aaefe4, 0x3af2fab0e7f8abe3 } },
+    { { 0x63ec9f3751d9afdc, 0x90506ab60470232d, 0x5397829cbc14e5df, 0x29cbc14e5e0a72f0 }, { 0xc2f25c3e60c5500e, 0x523a9fb9ab090332, 0xaa76a461d05bb22a, 0x135ff70328937410 } },
+    { { 0x8cc3a917f130a8dd, 0x0fb72dd482c9fd32, 0x1fbc4c2a50658db3, 0x3b7021d9ead7cd39 }, { 0x802c38dd7748252a, 0xb30b817808ab90e3, 0x101d5c4a5470ae7c, 0x2e30c45e32c33dee } },
+    { { 0xb818ba2c262c5ed7, 0x2b845285295d04d1, 0xad6e66893faa92e6, 0x21394f385af2cbaa }, { 0xb2d93a36c9ac0f8e, 0x4fabe31a159feb38, 0x24a89332a394bd73, 0x38b1f568a076f6d3 } },
+    { { 0x1bd1f13543380e53, 0x289724425ff1ccc9, 0xab5a446a6af853d1, 0x38ec649dbc3faad0 }, { 0x210d73a0ab5383e4, 0xa90256b55090c3f6, 0x975024fb8564ef4c, 0x2bcffc410b2634ee } },
+    { { 0x4bb66ca1d69618ab, 0x763e5c01b0ddeb03, 0x3dd43cedd45837d6, 0x04e1fd626603f3a5 }, { 0xf4f39e5373b478ce, 0x92cf78bd4a484051, 0x771020b97a595169, 0x006fbfbc137c9f3e } },
+    { { 0xbf46bec0b6f2cc9d, 0x675a52636d44d027, 0xcb35e72d833a8fb2, 0x193f39fd15a0188f }, { 0xc45cbf41388f76fc, 0xb60203b483b53501, 0x350d4fa59171b60b, 0x2d81553f03261875 } },
+    { { 0x8e9d7747b1b9dee6, 0x99674576649b57f0, 0x4607c6e9671ec9b9, 0x171c2f11b58310a6 }, { 0x74b1e71dbd001ca4, 0xa181a505473f7089, 0x71df7c3868015558, 0x031a8e28c79055cd } },
+    { { 0xc2fa0b8d3d41f6cd, 0x3e5bd6502da7d108, 0x98de143866503b63, 0x11a6cda19031f26b }, { 0xc31cabd1949e1ca4, 0x2ca91338df712273, 0xaf3bb5cf8c4dd63f, 0x0186163e80fd3b70 } },
+    { { 0xe4db8b4d398cefcd, 0xc3b2e0497aec5b06, 0x12f00d6042332a20, 0x0bb8429b22fe69b1 }, { 0x81dddf776d839212, 0xb208e8a889576355, 0x8f55103d4c980e58, 0x29ff476a9d2d5dcd } },
+    { { 0xb74ba4edff4736c5, 0x32b1dc56fdafcf66, 0xaf64bdadb47b3232, 0x3c31e4bcf09b4d6d }, { 0x51c89c18b9251738, 0xd08fc19f3266d4b4, 0x3705384858dd1341, 0x3174696139ff26b9 } },
+    { { 0x6f1ea49459f7dc4d, 0x8d33c9ede490a009, 0xc756c84193feba03, 0x10489c8cfcf42092 }, { 0xaf33ec75644b316f, 0xc7254b886569f271, 0xf1577c904f87bcd3, 0x1c4e57e29d586638 } },
+    { { 0xe2aa14b32fb0247d, 0x78300d55b53bdf9a, 0x439d9e65aa0b6006, 0x09afd179e4efd245 }, { 0xaee41fdac19ce430, 0xe1483d48e5771ace, 0x4b0cfd3812e22590, 0x0e02d704a4bda909 } },
+    { { 0xf0c350c5ff0c171d, 0x0456fcd7c9895f4f, 0xc4964ccfea913074, 0x07a5c3d9dff1416a }, { 0x81b711d63c61b1f5, 0xde7543adc26aacb6, 0x678dab99ec8a3d75, 0x24dca3cd4d82253e } },
+  },
+  // 2^4 * g
+  {
+    { { 0x62a26be8860c5e0d, 0x27084a9588793e1b, 0x1e0c65127637f1f1, 0x3ff52cbcb28d06ab }, { 0x9fccf21258ac23b1, 0xb76a2eeff9418a5c, 0x89298705c3df6a34, 0x3bdfaca5995de882 } },
+    { { 0x003bd227b41bb551, 0x7afd3fe1abe259f6, 0x7525964d631f25af, 0x15b4e33b93363473 }, { 0xbdf08205c984c278, 0xa94e8a9a609501e1, 0xdc220841895cdc71, 0x2c4097ddd89467cd } },
+    { { 0x856a442642ea5e08, 0xc1c3dec0d13431a1, 0x6810319dcf98f745, 0x2cdd476cc25aa79b }, { 0xe7b3466c10effa44, 0x65e4ebf5206e41dd, 0x4e47a7457d035d25, 0x35916e2b64d78d1c } },
+    { { 0x1bae728011d53f9b, 0xcbcfa83c7363d776, 0x772bf0d328bf9dbf, 0x15ea2e804e00fad3 }, { 0x6a071812108a32c9, 0x1ad8821612453afe, 0xe0e6c1caf4c863c8, 0x03ecdb34b4f89ef1 } },
+    { { 0xe54f13a0ac502c62, 0x546f76eed46a954c, 0xa70569fb9c2f84c7, 0x030e508293fbd769 }, { 0x13315b81bc1ae2c8, 0xca41abb18aaf6431, 0x2ed77d57f9e976c1, 0x16c007d0e683c7fb } },
+    { { 0x090d7cb9082b1c95, 0x88b10cf7495161fb, 0x92dc7978782baa51, 0x3fc6d2b0fa080530 }, { 0xcd794d578b332e12, 0x2618523de999a2c3, 0x64e4580013405f52, 0x0ae25471c048b4c1 } },
+    { { 0xd4727736f6395e1a, 0x229f7d96e0110b37, 0x3a05791417d79d1a, 0x1815df01280cd2be }, { 0x51e70332eb96f2cb, 0x76afe2790a897053, 0xfeeb44590b2d2c60, 0x1b4d3deb203568b9 } },
+    { { 0x84a3dc60f1508dc3, 0xde7ae04fb861ede6, 0xf0ba372ca675c1bf, 0x08c5ffc70ed8bba8 }, { 0x7fddd503886aa7df, 0xc07293bc5b4cc2c8, 0x80788301b8f70c0d, 0x38cd3f0c7e9b7064 } },
+    { { 0x3f5aa60c367679bf, 0xa7eed2d7f20d8a37, 0x921eeb1b884d5ce5, 0x0e2abe9ee8f5475e }, { 0x6104e30ea14712b7, 0x5c641931388027fe, 0x4b1dede47afa3163, 0x0f54cdf75a201727 } },
+    { { 0x35f58f882d891a2c, 0x1787df78501f5e74, 0xe6089e1ee0bd23d9, 0x34f61b97d363ebd4 }, { 0xb72e5eec8061f19a, 0xa1178e5eced8ac89, 0x573bc0a8418bfd61, 0x06aff62e4bd7ae6f } },
+    { { 0xd0994b553943e7fc, 0x78b7ece52806ef0a, 0xf2327cd4d7aef8f4, 0x0c387b60a706549a }, { 0x74c6a1a0fc4e5ad6, 0x5bd2246ecd97a729, 0x99112241d87db10c, 0x043d6e8183b71ba5 } },
+    { { 0x4de8967d79a07883, 0xc9ecc39b06838c3e, 0x8359d92b6ee32828, 0x14f199fe8ed1d9ff }, { 0x9786e1d4d8251d08, 0x82381432801b02b8, 0xd8f799ec126001c8, 0x1bbc8ea46f8c42bc } },
+    { { 0x1bfc30178c1208d8, 0xda6c619a16d9b22f, 0x9746bbcc137af202, 0x22de22bf1896db36 }, { 0x8a17c5a214767d6b, 0x16cf300b460d82f1, 0x54c4e8b5485001c5, 0x3e1c7044f23cc39e } },
+    { { 0xe361c6c35bbcbe0b, 0x996bd183fd543413, 0x45c37c2a89ea5d41, 0x31f4280ff5ceafd7 }, { 0xda3152548a20c958, 0x731d0650bd558ab0, 0x57c67f66a5e44899, 0x1945edf8b7324b97 } },
+    { { 0x0af11180f4f9945f, 0x5723b21a6d73542e, 0x12ed4a794d65b661, 0x3a72c0a8d09c50fa }, { 0x4e28fd66df9e29b5, 0xf1813c8680c1188d, 0xb449cddb857eff0d, 0x3b668725ca9789f5 } },
+  },
+  // 2^8 * g
+  {
+    { { 0xd9941a3d9c8ec7b6, 0x457f9f32223838c2, 0xd57d0f184317e558, 0x2a501f9b2ab22e6d }, { 0x83bc021a8cd6541a, 0xa6dd22e595899aca, 0x138c2723fb0fcfdf, 0x3daf716592a31f25 } },
+    { { 0x4785a3ede034db48, 0xb8c9d5b7c12dd151, 0x051b301fa8dcde7d, 0x0f5255f6a3c601a1 }, { 0x30fb96beaefd7fbd, 0xa6cfc30277a9a9b0, 0x85c11202c1a7a6b4, 0x2babe776a79beff2 } },
+    { { 0x0942a892b3a21ea4, 0x3a98e619839afa81, 0x87b50ee78d12a8ae, 0x10cacbc32fc2f23e }, { 0xf5444aef4091ee42, 0x968b3245d9299d98, 0x582989d19b235323, 0x1214b9339d6190d6 } },
+    { { 0xf58a206f03681360, 0x58c0c52dbdda2095, 0xebf1d0eea8ae0199, 0x1d7ddc4fa69ca97d }, { 0x7aafdfa63d688e45, 0xf93c05225d5905a2, 0x2a8a4b86c03f3725, 0x244448edfb5b01bb } },
+    { { 0xd6dbb0bb836a36f8, 0x41bb0b398ad0aa56, 0xcf00f0d111e3c7d2, 0x214d0a6a78ca7aa4 }, { 0x9f9ae98ac7793926, 0x94038e30c2f67b02, 0x5f1955173c52b370, 0x0575422b5b0a14b7 } },
+    { { 0x38a054af264cddc8, 0x2b0a2c2d104964a1, 0xc857d24ae5a1923f, 0x108af2a1ffc9f5d5 }, { 0x302c2b6ce2e46e18, 0x01052be31d6d3ff0, 0x938dac98ee8c4acc, 0x080100610bc1dc3d } },
+    { { 0x08b1f5a50c278bfc, 0x9c75f4d087b43650, 0xbcca41bde9497588, 0x13101bdb987773a6 }, { 0xf4945939eeb24150, 0xcde71bd7049330a3, 0xbdda6710c1075376, 0x349569306af50a19 } },
+    { { 0x6cb1213cb455a133, 0x7108262afb7780ec, 0xf69fb26341fc0edf, 0x21e51ffb21136d6d }, { 0xa1f6d20d43704e5a, 0x7df645309090390e, 0x152dd66f8ef5dc15, 0x2bc18ebdc5f33064 } },
+    { { 0xe86dcfdfa7cb9ddc, 0x10f1d2de7b21de4e, 0xd3010aeb5c2e0084, 0x2f6f707cfe705e0f }, { 0xc1a109c7511630f2, 0xd2a6a5bb7fff6fc7, 0x409fbd2733d28058, 0x0182b81ee8b850f6 } },
+    { { 0x3387b1e32c17af58, 0xc0d0bbd7436b5829, 0xa9e927b04be7f46c, 0x098bdad0197a31c0 }, { 0xa2f3efa018fa9917, 0x76f7fad38094e09b, 0xdd6ded0c1bfd410b, 0x022a79e75af90ba2 } },
+    { { 0xd05159853ae2d289, 0xb3a12b66c4ab139f, 0x46ec897dc1f516c6, 0x2f2625734579beca }, { 0xd696df26438cdb69, 0xfe9b6a8d6dd1aa11, 0x1062929700ab2d79, 0x13993d687670c12d } },
+    { { 0xfea91f30edf5396a, 0xa60b961597c0593f, 0x8765d85a144ab89c, 0x196dd0eba14e1760 }, { 0x18aa44a8498c153a, 0xf8b72c3679cc95e1, 0x8ec7c929532b0f58, 0x3a415066fc35e923 } },
+    { { 0x9db9ac6b2ebfd71c, 0xd6ec1a2c34c06f1e, 0x3a6d6a03d2aab92d, 0x08404105dff90460 }, { 0xfeb47276beb78aab, 0xcf3006b4790e4225, 0x3d1f344db824786e, 0x06d97c13186db073 } },
+    { { 0x12300b2ce8ca8821, 0xdbe31d55f5971936, 0xb4e1950154cd1e0c, 0x2e1ffdb340eab1dc }, { 0x6128caae94ea7a5e, 0xc7e1872d68fffcf1, 0x472a90a63b991da0, 0x019806f9d02e2476 } },
+    { { 0x0b9035c4b8b45067, 0x3a68b56f6ed9d107, 0xd13006f38fa9eaec, 0x28902cd1e61bc526 }, { 0x0b1bf555ea71b09f, 0xcac0fe90fab57a8c, 0x7fdf49d1c6314691, 0x0ee899cd5e56189c } },
+  },
+  // 2^12 * g
+  {
+    { { 0x9d147a7cbc0132b8, 0x4095744358a19131, 0x1c5766e4282f9ee3, 0x39593c1a5a2a8fd7 }, { 0x0522354de5d4a887, 0x273975b1b2f6dedc, 0x25a4c43e3ea34e51, 0x1bb0b3de69e41c54 } },
+    { { 0x51ce0ef5241426a3, 0xc27578d30cfce785, 0xb8bdf2b06360658c, 0x38a79ef4b8cde3c7 }, { 0x48ef8b6774833be3, 0xfd7176f77d3e876c, 0x4f6ce7423bb4a18f, 0x3f63185b865a8a07 } },
+    { { 0x81f19c7c2dd2d330, 0x8e2349e098959e43, 0xbe0ff0090d9f2382, 0x2f27953e8600e5ca }, { 0x694012de984a7b4f, 0x0ba0d6fa0eb2fe14, 0x7084ee568e36335c, 0x10e5de40dda46e0a } },
+    { { 0x31445e0345132c36, 0x874925b3139cfae8, 0xa80f30a080286b26, 0x0c0adfb5ff45b15d }, { 0x9ca892c964b32209, 0x8c947de931cb3ef0, 0x29b0b756432169d2, 0x0c03359900d9de54 } },
+    { { 0xb41cff036e217ea3, 0x4deff615a2fc3baf, 0x18aa14625969be58, 0x0f619b6c6d6265c4 }, { 0xcd911c809d831c38, 0x28909691e1fe742a, 0xeca397372fca5c0f, 0x2e23cf03794d8dda } },
+    { { 0x68de4abbe276ddc8, 0x0f3874d3ea5f5b36, 0xde46ad2661fc92c8, 0x2f4ae05038e85ac5 }, { 0x3a62c5767fb8f67d, 0x21ddf2b2041f4655, 0x6df9d45ba56983e8, 0x3f2ea76fd0a102a1 } },
+    { { 0x42ab5efd4b616ea7, 0xa54a7465b208178a, 0xecdf2bb12b419eb4, 0x2564c28791ed80c8 }, { 0x432ba1f7aae1c773, 0x140e62ce30362ee1, 0x5dc76f1a93053852, 0x3d38eb16c7c48238 } },
+    { { 0x4a41e3d08ee01ecc, 0x155e6221a9fdc425, 0x7aaf178168b87909, 0x3c2865611f3e4470 }, { 0x2df0760a51f8b6db, 0xb879eb0865e89153, 0xa25a0376c912ff65, 0x2825fbfe8351caff } },
+    { { 0x27cfa9fb431ad42a, 0xe387e56c7ac0e10d, 0xf5236b1d432f82f5, 0x33ed7b3dd8f42503 }, { 0x99d46f92ad581de0, 0x1b449276696ac5ec, 0xc63af65c43d8a069, 0x1df073f2da13d0d5 } },
+    { { 0xfb06829bdca3b17d, 0xa180604d71a3f965, 0x50f38b81a49939df, 0x086d395a0ed49e7f }, { 0xca7596f68be31c4a, 0x7e5962a7b472ada7, 0x57c63e592e50bf03, 0x2aca32a01fb692b7 } },
+    { { 0xaec073a359cb480d, 0x01f19a2f67390228, 0xc06b0ab1c6dbf124, 0x33247b88fe78fbe6 }, { 0x2a19a98f5d29be89, 0xf10220501fecda7e, 0x9c04969fb4ba0865, 0x1c763556f2470f6f } },
+    { { 0x112524c7b150e5ef, 0x6f59df564a05f31d, 0x6c33e8c932c1266b, 0x22508e5a48bf3d8d }, { 0x747612fcf3c176dc, 0xf4dd8e2d5ed5def7, 0x630b44c168af885b, 0x10025643931b33b9 } },
+    { { 0x2f659c7d1ee61536, 0x3fcdccb67f201dde, 0x00d0edf77917ed69, 0x3c30b935e1c6aaeb }, { 0x57f2428a18828d29, 0x09dfdd7eedb44df9, 0x8ed54294131f6900, 0x0cff1a873a31d22f } },
+    { { 0xa756fbbc74e2fc21, 0xeb68de1df8013e52, 0x6ba91ea85bf5793c, 0x1b287c18132208fa }, { 0xc3c170419b010328, 0x4ce87ba7f4c947c9, 0xbe6d29b6454a28ba, 0x1abae148cbcb3cea } },
+    { { 0x1f0a3996e22a0033, 0xb2c653e2dbf94ff3, 0xe77698494d21a7c2, 0x28c166acbd1c4606 }, { 0x9a1ba46550a1816e, 0x027a3424b7abb420, 0x37d3813e7f1e4dfe, 0x2667d4db40122f36 } },
+  },
+  // 2^16 * g
+  {
+    { { 0x35d58ff521e256f5, 0xea9a0d4f7114c2bf, 0xdcfd15fc5c3bcaf7, 0x393867d24fec04bf }, { 0x10069a9814ef7116, 0x54e86d7dc6215795, 0x7f99a5802ebbbf42, 0x0f94e9bc8b831c0d } },
+    { { 0x8502d8e1fe788cbc, 0xc5c2dd80a7a22d0d, 0x8a23d310ae4024d6, 0x24bb6bce6a86a9c8 }, { 0x39ae5e095ab24bce, 0x2afa745f3d4eaa21, 0xa4473ca6fd7c8e5f, 0x3d0a89c2acd74464 } },
+    { { 0x19f6fa7388d10f22, 0xa1f576b67f6c25d1, 0xd624b16eab556d84, 0x10074a9e9f453beb }, { 0x28c342bccf8c22ad, 0x42b03b30a5aae86b, 0xbb872ee470a062e4, 0x017761a60465cc26 } },
+    { { 0xb7aa306fd34b5f6e, 0xd42ee0b2fe1cd6f8, 0x1c4728b2bcd0e3c9, 0x27677bb2b96bb2f1 }, { 0xf67ed73769c1405a, 0x45ce95f7bb8c28ee, 0xb99db8f4c61550d8, 0x296aceabb21dc512 } },
+    { { 0xfeb317f0284d2ec6, 0x23e4a5344182ebd6, 0x4be4639922b6d524, 0x25c07c1ec204d44e }, { 0x1a2b7dbbf78be6d7, 0x7f54704b75c2cd08, 0xe70bdeaee23287e9, 0x020164c8abb2dfb3 } },
+    { { 0xf66620a5c9052291, 0x2cef631c9275c53c, 0x0ed732ff6e3ddfba, 0x30209aa1e35cf340 }, { 0xc5d495b732e7c158, 0xbfffc8090ad3e46f, 0x61a26c0cbdc613da, 0x2f73a2672a7e44f1 } },
+    { { 0x65652ca98671ddad, 0xd7f77ce042afbe90, 0xe33ae06fa0f65c01, 0x141f0c2db5f1fbe5 }, { 0x39b455919b191657, 0x584273870c0aeba1, 0x2a2a6f16813185eb, 0x387b46de46375678 } },
+    { { 0x470acbcf1a668364, 0x031e25f33918e833, 0xbf94962008614f43, 0x3037415dea9c6e5d }, { 0xd797b2e4e942eb35, 0x17e0eeb885e0c599, 0xecd97b091a1f0872, 0x37134a3d14feca59 } },
+    { { 0x826344b89c87e6bd, 0x95dc683bceb7f09d, 0x7342f62a006ca34d, 0x3fc5586fc7238616 }, { 0xe93267d0578ea1a4, 0x7d1037ad60c298cb, 0x8c2f9fc014e5352f, 0x2cd3d7673b05ed0b } },
+    { { 0x1ce07b52a550a0c9, 0xa4225ab073b9f761, 0xaf3bb85cdf71d1dc, 0x3917f29131e561a5 }, { 0x6105bcee49506ad9, 0xeaaa4161369b32c7, 0x5d91c69a58062ad7, 0x27b95bd5d2916ca6 } },
+    { { 0xe8daeefd8d83e1b9, 0xf27ce1d749af3f26, 0xa8ff255cc090530e, 0x372085068d2629eb }, { 0x3dec027197ea1927, 0xb07a65cbb2c93877, 0xbd82a539c02a0dae, 0x3d80ad3a4a0fd976 } },
+    { { 0x3d6864b2d780ca46, 0x9fc0dffe7be8778d, 0x31f9f191e3d5a7f3, 0x1b723a56561bb7b3 }, { 0x68b20b0d0105b211, 0x40a4b564a185888b, 0x21d04b739384914e, 0x02d64892c67cabc2 } },
+    { { 0xa2bc31bdc9c1b53d, 0x2d8750f0a1b1a424, 0xe391ed40862c4f47, 0x2ff26f5681fdac6f }, { 0xa446c921e40c7d20, 0xdc9f0c53428ffb57, 0xd6ec2ab05a24affe, 0x098515a6963ab04f } },
+    { { 0xe9ff461e7f9d5f01, 0xdb3f6e5a67d4e0a7, 0x7810f2b21ace309b, 0x3b6b415515699501 }, { 0xc2e9a7248bf874bc, 0x7cb9d9af33a1a167, 0xc009c2977b0ca7f9, 0x29eb73511853348d } },
+    { { 0xfcc67be65171c647, 0xb4b4cd5504d54105, 0xcb2e3e40a52dde67, 0x1e0767358f783137 }, { 0x7943192060d715ef, 0xae5ae9c648da1d8e, 0x4f601a78034f5409, 0x3da5c9484609ba67 } },
+  },
+  // 2^20 * g
+  {
+    { { 0xd4454d9f31ca55b7, 0xb83525dead1578f8, 0x15a68da69a88100f, 0x1aee16c1d3762769 }, { 0x7e6d2a5041e8d3e6, 0x61f19efb2f334b7f, 0x3a9555d172e7ab36, 0x35c9dd41e7799ac8 } },
+    { { 0xad4e1447906b8735, 0x91bef4ca67a2062f, 0x3a0100069cb52165, 0x1a9bd4bf6a8943cd }, { 0xa519c4a2d0c1ea8c, 0x227a12b1f496ad92, 0x9adeead4beab8dc0, 0x38fec5fb8a0f16cb } },
+    { { 0x036652a7a582b83e, 0xefcb6a0563aea0a8, 0x21f8878117ca91d0, 0x04f84160848374ca }, { 0x721f35d996bbf1fe, 0x00dace896567fc87, 0x5facb9000a4aa94e, 0x22873a1e4ff0367c } },
+    { { 0x381dd49e34d6ad37, 0x25462c5f2a26f2e0, 0x5928f2a7da04f27b, 0x3abcd55d6d607b75 }, { 0x51ca7bfa7eb14d69, 0x9b5bb1488aa5419c, 0x40cf87eece2cc496, 0x2257cc82cb4e7980 } },
+    { { 0x009310cea369ac32, 0x61420c2ab691c60b, 0xbed35a0cc78322fe, 0x0b74e6915fd4c028 }, { 0xe559159d2136f4c7, 0xa241d4ebaacca6c0, 0xc44d4f39c1808a69, 0x014f5aa349a2feba } },
+    { { 0xba9325427d7f97b8, 0xa3c383508272b484, 0x4c1c6a6aa3c14f23, 0x269c7ab690656b45 }, { 0xa71c1893a36bb581, 0x1cbea3fb4bc81e33, 0x5b8f07d846cb43ee, 0x3d9f8f9528ecc9a9 } },
+    { { 0x3b8f0b479a47a3de, 0xd17790c5b1b08c1f, 0xe455500dc62df61a, 0x143ead8ba1630391 }, { 0xbece83dfbbd55f18, 0xc57f7d85b4271fd5, 0x4a25890ea4d93673, 0x301d4fe3485f9896 } },
+    { { 0x26ed119d5f3f7464, 0x1ca7eb6b1075d946, 0xb27ebcd04be51d4e, 0x39b379b8a9db6762 }, { 0xceecf5f31f4ec7c6, 0x409c93eccd3ab343, 0x2b184dfa18447580, 0x3403acd66ea68fed } },
+    { { 0x2b40f4b826d52bfb, 0x246a5fda6fbe535e, 0x62c74e1b485958fa, 0x228662a19028ebee }, { 0x6a887390d3e7b319, 0x97bd3a511f9aaf91, 0x41d4e369d776e478, 0x10c3135081e1835b } },
+    { { 0x3f7fd820f7094435, 0x7ae99f885b180331, 0x6d8d0fb15553c8b4, 0x320fce0de421b605 }, { 0x0f54e7aa52f92f00, 0xe658342a7ce046ce, 0x5440f589e7b0df34, 0x1bed3758a589a2bf } },
+    { { 0xb767657dfd8729bb, 0x62fa5185a5e7292a, 0xe286205324fd9a34, 0x12ca0ce9d960c4e5 }, { 0x07c335d1048dcc6b, 0x806049fad2cee381, 0xa2997822ce18dff1, 0x2b0f52e75e0f62a3 } },
+    { { 0xfda74aa8d393d861, 0x050b3826a78bbde9, 0x743d793487506aab, 0x13bb6b9e22ed72cd }, { 0xb8c881d9cd41327b, 0xaa71cdcf5fa844da, 0xd4e7e2d3c03e0f39, 0x15f35bea01c642bc } },
+    { { 0x6c77844f2552bd0d, 0xce359d9837d0ce24, 0x8c068bc3903cd6c3, 0x0de3453670f37ddb }, { 0x3be223d0a73cf425, 0xa0e8d3eaef416a01, 0xc3b46fe3e4e3590d, 0x22a695a5e9f5ec24 } },
+    { { 0x44e61f264960cb14, 0x5a267e856b405f3c, 0xa8b0b2c6b6ed3b18, 0x18321e5b0bff5bd5 }, { 0xabef6e25cdb15fcc, 0x2ff22098f044c562, 0xc95a22cddd9f2f4d, 0x0acdae8b6518357a } },
+    { { 0xca49a7be7f042471, 0x1061f2da29f35cb5, 0x1befa5983664423b, 0x03e540f110d9126e }, { 0xfd2b38a7c3a6b53e, 0xcb5ca27536ddce42, 0xa765d83dd54fde50, 0x080e35b9c056fb86 } },
+  },
+  // 2^24 * g
+  {
+    { { 0x372278ff6c5d0d5d, 0x70813b1e81c8f6b9, 0xaeb726d5111d74df, 0x161b0aae49d6c69d }, { 0x22e57e555502d6fb, 0xd71ae9f104fea24e, 0xd902e829fa0aa271, 0x2328dc92a371be0e } },
+    { { 0x726ac2a001ea2e87, 0xcdb28c71a45f140b, 0xddbe72154cc54982, 0x215027ff09f845ea }, { 0x411f01ceeb4d7a45, 0xbe46c4a15369005c, 0xd0ad829499f94baa, 0x3d53e09fbb47170f } },
+    { { 0xb122ac7d0bbdcf77, 0x0f6a2c621889d4f4, 0x33302035e04a6cde, 0x01d0e15534dec5d5 }, { 0x1830bcced5c77dfb, 0x2b290976f2a710c9, 0x87f8077daf8e7229, 0x24b7f75673cc9d10 } },
+    { { 0xc88077b928ac96ba, 0xb42a90ccbaf6b98b, 0x69b96da9e5d32336, 0x2447382a52f9bc9d }, { 0x2baa3ea45c471f0c, 0x952ffe4efbe18ec0, 0x4ce2d17f5d50914b, 0x13bd5c9e853869fc } },
+    { { 0x1db19f790684798e, 0xff46f6992c682c6d, 0x4ce73c85c8a3cb93, 0x2435eb18b499a7f9 }, { 0x2a1bf17a473ceb3d, 0xd06c6a3c237a04b3, 0x47fc195bb1dbf84d, 0x2ce9b80d8711f8e8 } },
+    { { 0x9cf8b628a5781e4b, 0xee962b770082000e, 0x2f7d5bb398dc25d3, 0x30b92c6e4b613717 }, { 0x22503d3bdd962163, 0x5c533239e7e8fa24, 0x28aeb38c66244836, 0x3795615f634943be } },
+    { { 0xd7f32d5c20606227, 0x4dcb9d651dfc867e, 0x31a49344815cea8a, 0x1cffca78174a6ebe }, { 0x73a81c540dd450fc, 0xbf5e146e0190f551, 0xe2069a334c08b52b, 0x108637ace05bf0ef } },
+    { { 0x275fb7f85e645904, 0x556ae520972ce234, 0xa9ed4aebef141049, 0x1afc71e05da3f7dc }, { 0x74303aaf46ab45c2, 0xc7a64908661b03c8, 0x33ea7d99148d55c0, 0x1054aa6cea661c5e } },
+    { { 0xbd9cef75b0b0a710, 0x6de0ad788b413904, 0xf576c683bca04ef1, 0x2865c181d85ae144 }, { 0x044de74a919156cf, 0x167c4937015d4cca, 0x4d97dfba8bbbe4b9, 0x076caa8484444353 } },
+    { { 0x480102f54cd487f2, 0x0fab78aabb6048e0, 0xa1703a262b94bc40, 0x16c2e78df07de6c3 }, { 0x31f2655d5e3e66d7, 0xa03ddffbeec2d75c, 0xb16f1db2dbea3760, 0x2ccdfa037062e8c9 } },
+    { { 0x3244b51ff7d4cc2d, 0x8f9d55187fef021c, 0xc09b3e353d37fb89, 0x1db3760c4190fff4 }, { 0xe441bd0283425288, 0xcf8337be85c611f4, 0x9f5169e1883708c4, 0x2b4e7904649c1e92 } },
+    { { 0x0a3a4c6fc6cf25c7, 0x8e8a95aa2938465d, 0x100384ea62a38bc6, 0x3285197fae499e83 }, { 0xe5cb316b5c2113c4, 0xdea5b5ee4e7eaee2, 0x22e1a2eacc128ecf, 0x1434608bad3d95bc } },
+    { { 0x17b6ddc138d0ef2a, 0x63c5781ac3d9d9ea, 0xf39f16478c632723, 0x01f1efa2ac1e0a35 }, { 0x9bda5a420528f421, 0x6d5f94d7f4d72fd2, 0x7384cdd32c4c279f, 0x1d0ce06c6c4e6a66 } },
+    { { 0x0739041970e75ad4, 0x55b845639eaad0bd, 0x143385dada456d51, 0x2d890820e7c2ad65 }, { 0xceb36bf7dbb20e30, 0x23e425fad8e5d11b, 0xaa93019bb838f301, 0x08317f6c3242e564 } },
+    { { 0xecc53eb7f58b6fdd, 0xecf398f9e74776ba, 0xdc56cca066f6f58b, 0x1368f842e4337ec2 }, { 0x8dc64e1f0649a855, 0xd74d5b611adc19ed, 0xc3b4262955fb9304, 0x04705fa2a5a051a5 } },
+  },
+  // 2^28 * g
+  {
+    { { 0x267126aeb9a4fefb, 0x04caf37dac607f3b, 0x17e5f0061f6bd361, 0x25e3469c6496da1d }, { 0xe19e3e4cc284b8b2, 0xc7304564ae91a4db, 0x45269577a8949549, 0x1176356930e1237a } },
+    { { 0xbc8ad78e4222641c, 0xc1c9ac5281c5aa08, 0x3c7b08a77e613fa5, 0x07f90b1cb886100e }, { 0xa349465cac29a796, 0x9f3d3bb1acbd9b28, 0xa154386bdfc5c7b3, 0x241e93a1785ef147 } },
+    { { 0x7321b5162a1c4bdf, 0x69198c37b4f1bf3a, 0x77fa0901ee3ac588, 0x0e4a4d4dac1aa37a }, { 0x2cb5cf8ecb81af5d, 0xe5d72aebd39d39c8, 0xb41f3e3f8eb91d26, 0x20a4d5e55aad7192 } },
+    { { 0xe11510678c78c83f, 0x65e75f6f95d35cca, 0x6cd061888adb5176, 0x3da0ef79b9b0ca9b }, { 0x3e05f9af88a01549, 0x991e6826c99939f4, 0x832cdd8abcdf33df, 0x2999e7ec0c6529f9 } },
+    { { 0x75589586d2e2a54c, 0xbada5745e4f97381, 0xd6f8be6e1972f9b3, 0x05c5b147bac9231c }, { 0xe2d55e65fc3e04bd, 0x59df1b6dff20d3c8, 0x173a861e93d11d71, 0x10a7eb67214ae84c } },
+    { { 0x3397845cdc98ac95, 0xecb5445ae00bf8c1, 0x63b27b664e4738f3, 0x112a4ebb84d5fdb8 }, { 0x89d8d3d30a535639, 0x730f0b054dce6943, 0x00c8f0d85940b466, 0x0bf8f2fce40c9f31 } },
+    { { 0x3ad643f11e11d1c3, 0xa5e292efe14faa25, 0x746f72c72e42ca85, 0x0bb1c3c5a9e6fd54 }, { 0x9d8b7d7d7c0c64ad, 0x6154e8b6e4e24df3, 0xee035947b494b8b1, 0x29da51caf37ea99c } },
+    { { 0x8bf3ea8f63ac714c, 0x1a1188e7ec1b56a7, 0xfbe4ceb852d56253, 0x209277636875a2b6 }, { 0x9414aa3451fa2bae, 0x67f43218e2525282, 0xb88152eb8e249369, 0x18de2891241c29b9 } },
+    { { 0xcb42bdd6c4828faa, 0x2fc6c993a9f3c696, 0x6e24d162ca7f18f1, 0x22b4299d1e53b43c }, { 0x6c6ef151e35e981d, 0x09cd203446f76684, 0x95cb6d2f362f327d, 0x0ca154297121adb5 } },
+    { { 0x94f350f30f029a39, 0x6bb247509cff5fa5, 0x8ed084c2ddd3417b, 0x01f4aa45c59fa772 }, { 0xf0925ff69a542577, 0x87f80788cb541476, 0x2e48d54427d06c13, 0x300253d74d574137 } },
+    { { 0x75a58b16d97034b6, 0xbe0d95deab8f2542, 0xf1c60f1645debde6, 0x08246dc21e49edd0 }, { 0x7f17170d0917dc32, 0xd3dccea17d7dabf3, 0x363b561d49b8a9c8, 0x2345fb654a793f75 } },
+    { { 0xd275b933cf2684eb, 0xa9bcd2c797b02261, 0x51c89fddc89817d9, 0x08dbfe732c5903b5 }, { 0x8a842ea416a6ecee, 0x3b7899e18890b175, 0xd11c8f70cccebe3f, 0x027feb3781eab418 } },
+    { { 0xdb6d5b98cccf9869, 0x057d7982c11a0d47, 0xa81703af2b94bbe6, 0x3609c6b901e2eb94 }, { 0xcf85f96ce974b865, 0x0a9dfb7987c53927, 0x1573a762929d64f6, 0x01b2600e929ec642 } },
+    { { 0x6d892c7ad023bc05, 0x4fe9b6de8df17475, 0x41588deed98ef89a, 0x2ee28ff11383fff9 }, { 0xb7b3a010efc083b7, 0x911a8479faf4b9ab, 0xe01416cd91ff6e56, 0x3de40df286bc73d0 } },
+    { { 0x4585d730af4a2930, 0xa2b19a3c193671bb, 0xccf876332d091ddd, 0x1cd8b745db1b702c }, { 0x83a2acd7d07443d7, 0x2e46387ea480a7e2, 0xed7fad707dc62dfa, 0x1c6975191b7f6193 } },
+  },
+  // 2^32 * g
+  {
+    { { 0xf9af7636254b4ded, 0xfde16dd55cdc4074, 0x053d85769e209145, 0x281a611cb5a692a9 }, { 0xbe7ae9070b27e61a, 0xfaf6dee0676e5c45, 0xb077db6c4069cce8, 0x0d8046ee0eca53a0 } },
+    { { 0x3e5595c8bdde23da, 0xf60a7d73e3d16383, 0xc09725ad9f990664, 0x04c0a56036a66439 }, { 0xec10dab9c9a3e5db, 0x602afa1da8a9c9ea, 0x521759bc1c6c2d53, 0x0f795931c920eb8b } },
+    { { 0x6a0b2de51fa31d8d, 0x7a2ea790e1227736, 0x1a078514771fc1d7, 0x0132fcc84785b0d7 }, { 0xc3f3be2869dd84d2, 0xc8f2a4bfa8cafc5d, 0x031a96f99f97c3b3, 0x229f6370e14a0ae2 } },
+    { { 0x5cd82ac024eecc66, 0x72a067f0d61d9edb, 0xc1971310b83df336, 0x2d85e17f19b60694 }, { 0x221feffd8e72e56f, 0x4e2555943b269a8f, 0xc6a6512e1a9caa48, 0x2ec2467be381f786 } },
+    { { 0x628d9e02e5ec4eac, 0xf0b37ac4e733ede7, 0x25037cb15269fbdf, 0x111e2c3986acca52 }, { 0x3fb1fb4dccd4c9ef, 0xd58fc513c3ed1686, 0xfe3de1f21ec4b99a, 0x09f6ece5c8b1a2f8 } },
+    { { 0x90906452bd7a6d8b, 0xe54c3ab269ceec5a, 0xdbb33fdc561e4349, 0x05e2476e2b3b400c }, { 0xad34c10f6bd1dcc6, 0xe1c0b33a3a552b04, 0x0b3f823d125d9992, 0x26a43d64fc489aed } },
+    { { 0x2a4e1f0393361662, 0xf562746c60a1b4fb, 0xe462b914b6cc86a7, 0x3bcb207337908eae }, { 0xaacfd4d564558deb, 0x585c6e501405eda0, 0xe9450454e5f9f43a, 0x3e723696a0cc0cec } },
+    { { 0xbdca048f2a64bb81, 0x82c2bae1169e5fbe, 0xc191bbb15626a9e7, 0x3f7441f2b4538ecc }, { 0xfa464ff7a99524b9, 0x9c8ee445dc0c5e52, 0x15c68fcd9cf0bafc, 0x0a45107998cb1c97 } },
+    { { 0xb454dd3eaf2cdacf, 0x6863a574899bdbf6, 0x3bfa53e3c11584d4, 0x1458fcaa38a82c60 }, { 0x530eddf8f27881c3, 0x0326ca8d77fe9282, 0xcca2c6d7469421cb, 0x36eca5c2bb1cf24b } },
+    { { 0xf220abd5f762b0eb, 0xbaef5eb9aed1a15e, 0x86e580185b8d7dcf, 0x244865553e9fc205 }, { 0xb83d19c666e8ecf1, 0x4a51b5d2fc5ea15f, 0x9f8232e3d8612bbe, 0x1875525f84e91850 } },
+    { { 0x09c5eab0d742b053, 0xea1c76c22cb2d945, 0x60f92fab9cd89f3e, 0x38f1388270c5465b }, { 0x120288e884b1ec3e, 0x89df3d209f873dde, 0x41d1d2b9d8b3c71e, 0x1deb29dd91c6b5c8 } },
+    { { 0x47c75c3a8179ab2b, 0xdba32fbb5ad93ebd, 0x47047d82d86672a1, 0x19653d4bff5ff1a4 }, { 0x41ce7619dc010a12, 0x8e1a7ef184713839, 0x395efbaf021af36c, 0x29d4b226204f0b32 } },
+    { { 0xbb9679d1feba05c4, 0x56615afd7b79c3d0, 0xfa6acb288541508a, 0x0f55cd01abcb73b6 }, { 0x8cc85c985ed95dad, 0xc25a24923acd7c51, 0xc7e7e2ce1df24406, 0x1bbef8a7dbadd042 } },
+    { { 0xbd248f45790ccd90, 0x25d17b1f1e8bda7f, 0x41e3ab41301c563b, 0x00dc858e125d1483 }, { 0x4978c8f3f9d1d337, 0xe4dbb9aceaac6340, 0x1d58a4c676e85d00, 0x16818e4bbb90b0cb } },
+    { { 0x77331981f3322a04, 0x390712cdcb596b9d, 0xef15eb80cb56804e, 0x3087fa464d3731c9 }, { 0x661395bc59823e67, 0x92963f46ad3e54b0, 0x64ea9f8f5fa12d4e, 0x02f96d3dbe5320e0 } },
+  },
+  // 2^36 * g
+  {
+    { { 0x0d6abebd213d1ff4, 0x5990cb6926eb39df, 0x6aa67bf8beed7f07, 0x3bb7d1a71ab78121 }, { 0xd9c7e991e5a06606, 0xdf93e4f4ef83fda6, 0x4b6613e90ba10eea, 0x084c25b53427cc4a } },
+    { { 0x2c5ebbc20be11bd0, 0x9aeb0bae6a7c696b, 0xc0e84cc37e99a31b, 0x18167c687d357f84 }, { 0x83f39d4072cb788e, 0xea3c299d4320e001, 0xdf5553a00353861a, 0x31f8786d659ce95f } },
+    { { 0x060c5d8cb4b30bd7, 0xc290350a9b3e160d, 0xb4f048f98d22d013, 0x05a7d9dc7f55227c }, { 0xc472fea311dd49f9, 0xaaf7188e4f0f7345, 0xddfe2d8fe3c9972a, 0x3603ad7daa77ffeb } },
+    { { 0xec9ea0ec5926c7f2, 0x45063061819b5fb8, 0x134d77ffcf5b8861, 0x24a4ae7e931fd1bf }, { 0x832c9e0989104b92, 0x69b5a98b33fe03da, 0xf4ec5b72579d1054, 0x1f7b338dfcda72e1 } },
+    { { 0xec6f3ae07ae6ee82, 0x279e0f64603bf053, 0x4e8235fe4f14049e, 0x28a6a3510a0f88a8 }, { 0x0b456aa64b9bbf73, 0xffe2ab2f2e2791c4, 0xe5c89762621be92c, 0x324b822e1fbd95ef } },
+    { { 0xd34f31f540d5fe37, 0x0b0e2f873f6615ba, 0x904d5a4dc90374da, 0x0c0a5d2c5d1b55b8 }, { 0x5516a18321de59e1, 0x0d1ff9b35400bfce, 0xded948a3ec1883a9, 0x25bcdb8e9a5b1e3a } },
+    { { 0x9628df1fc8473060, 0x05ff4f5e1b0098f3, 0x0e30b39eff09fe38, 0x1e85b4585893f43a }, { 0xbb31cc9eedfc09fc, 0xbfe99aeb7b57d6a8, 0xbbbfe47852f6109b, 0x08026aee011df9ec } },
+    { { 0x4d5de6025070161d, 0x38c44cc1fb23716a, 0xfb20e156cd7008a7, 0x03b128c5d088da7f }, { 0x12cde9237123ab99, 0x0a0e55d627098552, 0xb566d9dc2a47922a, 0x09ef0929bacb60c6 } },
+    { { 0x29bf15d60e9a26aa, 0xfb7d4475007c1620, 0x988d528657542df2, 0x2aebbe6e9ce4dae6 }, { 0xa915f760cefad536, 0xf1060ba28a0c7f74, 0x13fd57f4b62003f8, 0x289b5b5b2860dc56 } },
+    { { 0xf4bdd4d958cb22fb, 0x330d0fd9317aafc2, 0x34fa40dddc2e0b90, 0x3ea230126a1cb12d }, { 0x17c7ac792851a173, 0x7a6c397ba292c9d5, 0x5efd589f4e936627, 0x239bcdbe6cd1f46a } },
+    { { 0x71db746ffcb8905d, 0x0826561ed5ee5cd4, 0xc668ba6c1261b96e, 0x172918255029ef20 }, { 0x566f538f118cac92, 0x2287a2d31eae84d6, 0xe361acb41676b686, 0x3ed38e90ac932873 } },
+    { { 0x096f893d0cfe1f31, 0x332a9aeb98467fd9, 0x338980e83d84ab8c, 0x2b9cc7a09c1929fe }, { 0xd8d90565221a1e8b, 0x9b23bfc76d1e4c0c, 0xf5a666e42d5d7556, 0x25b6c16eac07ce3f } },
+    { { 0x6971c399014dca15, 0x041f347fe716fbca, 0x332daa2fbee8687e, 0x1590f8ed719a2c09 }, { 0x7b425d0594b0a219, 0x429f35fda8b8a034, 0xfe0025ee81d81cad, 0x1125265b5ac1ca6b } },
+    { { 0xf363ccd100f7c8c4, 0x097aab7ef4c27b1a, 0x1970d08aa6602f60, 0x174d3432415c890b }, { 0xc898100a16a454d4, 0xa80d7227ac6ae9e5, 0x472f576e5a47a25a, 0x076717cb102d05c3 } },
+    { { 0xe71e6dd80ffafa8a, 0x457f8a9dc41e4226, 0x895f82b59b422e22, 0x095c8e7c2a7c2d99 }, { 0x0a9d4ae5506b4bfe, 0x1c70fca890b30a88, 0x29fd70a411a29a96, 0x155b380694b3fe83 } },
+  },
+  // 2^40 * g
+  {
+    { { 0xe26dd9f086fbd016, 0x19b267c1cb3de939, 0xbedd8a49cdf749d6, 0x2839d64a36adf19b }, { 0xb40132683ca52add, 0x99d17b5667c27877, 0x6662dd53c7d452fb, 0x2ad28de937f72892 } },
+    { { 0x914797de1eac4212, 0xa36d2266925986fd, 0x54950491cba75b8f, 0x2c17d1fecdf90854 }, { 0x0b7f3ab409a8cbe2, 0x5378d3cf1fdd7094, 0x995b7cbf45ce357e, 0x2fc3b46fd8abf6e3 } },
+    { { 0xa55c0c1a4df0d2f0, 0xbd4b66c197a9c27e, 0xa13ad4f682872bcd, 0x258cd1f8decb8483 }, { 0x01ccc99a51b2b123, 0xa6a312117c4dcb3b, 0x6ad6dcf7d954eb78, 0x28a04ac20f7080de } },
+    { { 0x06f3e60c20a3f407, 0x561eb0c3c5f509b0, 0x22df99e801875e26, 0x26f71bfc0e0ce612 }, { 0xb4e0868594770d6d, 0x3b044530f102a925, 0x967704d7418fe0f1, 0x3ed1999943057a56 } },
+    { { 0x9680a1c068abc9ca, 0xbaec33bafec9dc87, 0x746f67fc45fc80d5, 0x39a5be7efa0a9457 }, { 0x547be4df199ea77d, 0xe06662943c312591, 0x51d9a4045962b5b5, 0x3f1ffb81d0344c70 } },
+    { { 0x4980ffcff7997780, 0x9610829ea68daa0b, 0xa97e8d7ab70093d9, 0x003ec91350856e58 }, { 0xe5389242dd62e8b5, 0x233d1492aa79a1c5, 0xa44944ca4628ff4f, 0x19068f88ad5bf348 } },
+    { { 0xaa7a9bc526061b8c, 0x330404dc68e84680, 0x0ba16233b6396fd4, 0x35c939121c077eba }, { 0xe4069f327b7b271d, 0x79f2b97ba726ab1e, 0x089c9834070954db, 0x1ae1a34dee3de697 } },
+    { { 0x1d5bce59d99f6005, 0xa2b60117938e1a09, 0xe889eb76f229d6e1, 0x16be56260c8a056e }, { 0x8bb5401301ea0408, 0x6ac39aa7de602c7a, 0x22e55dfc24e16318, 0x3adb738c0b6cc459 } },
+    { { 0x2baafe0f4552c7f4, 0x9f2c441c560f7716, 0x66dfccef218f3bd1, 0x0f64826602632d86 }, { 0x8b33357be30e7308, 0x171645bbbc242294, 0x1163306054dbf6a9, 0x0c99d549277eec84 } },
+    { { 0xdcc0992072675307, 0xc819608d5af8efcf, 0x1e6dc01a743c8d56, 0x1e980d371d06af25 }, { 0x56b7eaf5b9b3db2c, 0x1fb8bbe821f27db5, 0xf1f3f69e13bc4374, 0x314aea32a1566346 } },
+    { { 0x3ff404b0c281b204, 0xb0efc690f4ec97ba, 0xcab700eb5ed465c7, 0x0bc27f54f8a16ae0 }, { 0x1207fbca83444ae3, 0xdd0b1fb8e3a617b8, 0x22f11f2d6ee9d10d, 0x00ae2ebbf5a84a21 } },
+    { { 0x3621b9cfd576c506, 0xfb59406ad0e0ba7e, 0xd1fcefbd6ab8fc85, 0x32bba06d0d0c0005 }, { 0x1911f4eb81eb735a, 0xef8370270d7c3231, 0x8500d25d30e39f5b, 0x304ad04667ba7669 } },
+    { { 0x8a2e4e27230b0c04, 0x5192ff5f772564bb, 0xead74132c213dff4, 0x0ed0c83da5fb262d }, { 0x377ecc06b3262594, 0xe3e61ac1123407af, 0x810623c68e95fb6c, 0x36554424877d2a0d } },
+    { { 0xd15450e824487d37, 0x92e02a0486ecfa23, 0xcf4c72927571c4b2, 0x0009b8e5a0fd81bc }, { 0xb97cf42f58f0fdf5, 0x7084e0e1f4268194, 0x79a13b13f8fe3c72, 0x38b6adeeec2c2d88 } },
+    { { 0x0ba5d9a3c313850e, 0xca584d9edb6c9fa4, 0xcebbd326d8d2b2e0, 0x1e3c969bac00d2dc }, { 0x04543bac92fa1252, 0xa9ac98663410456a, 0xa5da57caf782e362, 0x07877c503dc56d0c } },
+  },
+  // 2^44 * g
+  {
+    { { 0x519ba4f7b3c26af4, 0x75d5667e3e3f9c22, 0x7f597beaa488c89e, 0x0645432190242add }, { 0x97c396c2ebd5d7db, 0xfbce3f4189437715, 0xf35301d369bce405, 0x0342c3c1adf0949d } },
+    { { 0x3502fe5f69179cba, 0x25bf98a56061c6cd, 0xa5db15d528c26ba2, 0x21f252aa201ab2c7 }, { 0xf589cc2d86c57ea4, 0x0573886c06fdd4aa, 0xe66deef7fdf279dc, 0x1f429f8c5ee590fc } },
+    { { 0x48f773991efc7774, 0x367f1c22fe79f998, 0x0fec261093df6b76, 0x31e75a238c777d4e }, { 0xdb56835d9cbbfc63, 0x9876d81fc149ce17, 0x637b28a988ff115b, 0x15ac29d21f8e4e71 } },
+    { { 0x7e8e69918b01a489, 0xc1870ec2f71821d4, 0x4534be8bfa407f5b, 0x3901051e5e595f4c }, { 0x2a819eacac8d8712, 0x48b538269df1035a, 0xe6e7edec1c10160e, 0x38119499386a9e2b } },
+    { { 0x5511cff6a005fec9, 0x9825de37faaa8f90, 0xea6d0b8b1a7d632a, 0x012a21786b6a6da1 }, { 0x0d3d330531bdcea3, 0xc6989a98d0aca9c0, 0xd8f0d32e4fb76932, 0x3ed121a0b37a1d3a } },
+    { { 0x1d27d0623137b126, 0x68eba38a053db07a, 0xc3126782cb470b6f, 0x39dc135dfd333427 }, { 0x314d38599fc8c117, 0xde86bee91731cf57, 0xe617896c58295f8c, 0x12840374439863ea } },
+    { { 0xe886a9d002ad9d9b, 0xbdfcf10777b96e14, 0xc85f8714fcc9552d, 0x15c1ab22b27cb008 }, { 0xddfe37ef9b5d7cf1, 0x56bb90549fb77bba, 0x628c1abffb389e26, 0x3e33c634c3292bb4 } },
+    { { 0x8374bb4ef6896be7, 0x4c9ec9c5a0f3eaed, 0xff639c203cc5d95a, 0x0518a7934eccda6f }, { 0x6cdb44810b0484b0, 0x8c6fb2e2c65bdd0f, 0x47ed3deee275570e, 0x00546e9fab6391d2 } },
+    { { 0x70023e6c8d3563fe, 0xe13d2610f824b01a, 0x2fbb8c3bb3147525, 0x0852cd2b3200d82d }, { 0x3ef2cd1a78ad407b, 0x8543fdb0319947f8, 0x110891902f37fc20, 0x3bc751d0b10bcb97 } },
+    { { 0x0bd049fe04ea62d1, 0x5274c5d488ebb403, 0xcda2739efd443b21, 0x324412a9b47c8615 }, { 0xf0735e1db7663264, 0x93b254e91ce11d07, 0xfd6ee58bf4ffc3b1, 0x2f16387d2c2c3256 } },
+    { { 0x5c377fa70c8e5484, 0x711de8830f963107, 0x4941883c7b33a4fc, 0x278e7e4bcfbabeb8 }, { 0xc1e44279eb5c15e5, 0xee6dc18c1f77095f, 0xb29a7fd480f67990, 0x235125e722725def } },
+    { { 0xb645aa2ae3e9d603, 0xcaad3dab5c105ec7, 0x3b11a827642efe89, 0x1ff9a8d4510fc924 }, { 0x65de0452e8d10387, 0x419ccb576663a6cd, 0xf96cc60b8e0552ed, 0x2e4ddcfb09a09e3f } },
+    { { 0x481654b390384ce7, 0x9b67e44cc965aa65, 0xf3382030b3a1c4f6, 0x1d0ad980f774a68d }, { 0x6b1411041825d61c, 0xa31c02f1f29a9deb, 0xda2c66bc0843c751, 0x1e5a6d08911a9eec } },
+    { { 0x9dc5acad5b706358, 0x03c3d4c4b8ccc794, 0xcd6382de5481e18f, 0x1d3b113286494dab }, { 0x1df57322554c7fc4, 0xa3f76c452a963b48, 0xd198097caf7df7c1, 0x10dcd9f56fbea8aa } },
+    { { 0x4b0f9fc62bb0bac4, 0xfd615988404e900c, 0x60d822650cef235f, 0x28b6a0172555bc06 }, { 0xb1ac5e702e060f9c, 0xb9ea19ca6909fff2, 0x0bff342a0cb28396, 0x1d7e5307ba0e687f } },
+  },
+  // 2^48 * g
+  {
+    { { 0x5151d5aa661441a8, 0x5aa52ff756cb6c28, 0x4891c8fef7dc7cae, 0x00d44ec275111610 }, { 0x8e7d76a48560ed66, 0x94276ad12e0225ac, 0x190bcba54369a605, 0x11c20fba751b9b6b } },
+    { { 0xf3a4ec2866c7d777, 0xec9eb8715c908aa4, 0xd415f1f8de323e9e, 0x2cf58da5500e79b3 }, { 0x880ecce828dde5a7, 0x8ee7be16db6271d3, 0x6b12d122deeffeac, 0x078e17dbb8628cd9 } },
+    { { 0xba2467c4574127dd, 0x7cd058321e1101b7, 0x77b9bda48611610d, 0x09315c24a9417d10 }, { 0x2a439d19bc243b67, 0x0dd34d690811a16a, 0x79c555b330cb8266, 0x25a8d940f1acf199 } },
+    { { 0x72b7aadfb17a2f32, 0xa7ba53b3f7cf3f52, 0x87ec9b104dbaba0d, 0x1481dd43f56c05ea }, { 0x6a9a78fbb8fd63fc, 0x7e98fd04a3d0770b, 0x3504019e0d7102f0, 0x125ee15ae45a99b7 } },
+    { { 0x64bebd4c7d712c43, 0x3b8af36a741879a9, 0xb8d216138990c96f, 0x32b45fa3df410d28 }, { 0x2d5651919840208e, 0x005c034ba9601967, 0xaf5f9b5b571ec52a, 0x2f6fa553dd338a82 } },
+    { { 0x66aff63bd5d22165, 0x4a8a64cd57313fd0, 0x7edcf27c4da58a46, 0x3bd33655c5674ad4 }, { 0xfcfcf66554b0ce76, 0x99f59e8b8500218a, 0x3c0ea26a6d5f4f67, 0x30d13d5543439dbf } },
+    { { 0x5cae9482e87d4dd1, 0xaeec614260c3d67e, 0x1918ce978058a4b1, 0x289c2901049037fd }, { 0xd5f61362b4fd29c5, 0x3ad3a73402c6c06e, 0xb6c71b561c1eca2b, 0x2ae3001b3d14e57b } },
+    { { 0x29991f4a532cf217, 0xc820ee8dea4c5bf0, 0xd39b2a036de6d66c, 0x3f7e9b31cc69c6ad }, { 0x460b13a35d4da463, 0x5744c02cfd611f77, 0x1c84b261fb18b779, 0x256c3f73e897b9b8 } },
+    { { 0x57cc3625f76ca3e9, 0x7e189edafc4c1384, 0xa9115bc5cb422d79, 0x2fd971515032a484 }, { 0x635ea03e561db2eb, 0x3449b940883a881a, 0x8086c65ace79bab0, 0x2620d76755e3f644 } },
+    { { 0x171355cf0be8b59b, 0x3e8801c0ff95f317, 0x5e084d61ead12903, 0x33e518e8c58dcb80 }, { 0x3f5555dafee81c20, 0x0798e5d3c7e560e8, 0x1a565572b3937a5e, 0x0b3936cca9891000 } },
+    { { 0x48b8b3f39347829c, 0x13751e45f00d611f, 0x839e7b9642997cb5, 0x109a8b0e215f815f }, { 0x58c83be51fd7be11, 0x79c3acf8fa21f189, 0x71385a14a948648a, 0x3307eaddf4bef1af } },
+    { { 0x6c2dba8878307e4c, 0x4f3bba5c8373ee97, 0xd98b7556f967dc1c, 0x1ea5e947ab058291 }, { 0x1f5371d4aa2300fe, 0x89b0a6f019cb793c, 0x672843eb566c0c9d, 0x231d62499a2bc17f } },
+    { { 0xca3ca3d4b6212800, 0xf7dff0494631c4e6, 0xc3d506fba2697329, 0x26723cfd7abe6ef6 }, { 0x7ec363a4406efa38, 0xa79494a9e7a1c06c, 0x371509c09023f5f0, 0x3a1939d3c0aa56d8 } },
+    { { 0xd2d798ca49f90cf4, 0x9eadcd645fb8d765, 0xfb6bc7e5d977aa08, 0x2e8b84385a87a8a2 }, { 0xf680e5c424bf14c3, 0x4e55820fa6e3dbae, 0xdce29abfed687a5b, 0x3415f92d1bdceb87 } },
+    { { 0xdde7c98edad266e5, 0x9f849a07495c318b, 0x5d2e671158dc99ad, 0x30668bf11c4330da }, { 0xf3fddb01d4ee4178, 0xb0d00d92fc858cc6, 0x85eda20203812f16, 0x0d58ba607c5a5e07 } },
+  },
+  // 2^52 * g
+  {
+    { { 0x0e7fb2b2f506e9de, 0x1c4bdb84f26950f4, 0xb4e3065416f6dcab, 0x0aae7bcaeb78b4f6 }, { 0x8823b0a01d6cc901, 0x1637e1575326f086, 0x5eb2485a55ea5ffb, 0x2d5bbd8c0caa25db } },
+    { { 0x16df74e745f0379b, 0xac25c7471a1025c6, 0x72500120db75e251, 0x20806d51733024b1 }, { 0x70b62fba91d4999c, 0x5b4b8d8f336af739, 0x82e301639b00001f, 0x38999b9587526529 } },
+    { { 0xb6d06c12511125e0, 0xb6bd8e06f0ae45e9, 0x58b3f7283b073671, 0x2a26ce4403901397 }, { 0x7cf49e70758bdd81, 0x19aadd6b943d0535, 0xabf9d92aaa800c3d, 0x32d85fddc629d9b9 } },
+    { { 0xf026247b30ee5b88, 0xa818f4cd13343520, 0xe49d71e53f630cd3, 0x3b5545b448b7f067 }, { 0xf59ff959d1f27820, 0xdf8ab6043c475efd, 0x4b0c82cd8853b7b9, 0x0441041b59d90ebb } },
+    { { 0xe8017422c93e1073, 0x8b94a5db78b6a36a, 0x1ce9f9e8101b7681, 0x24683f46b16e0814 }, { 0x5176a9ce8597d299, 0x0e78c994560e4ee8, 0x23ac52cdb20f0536, 0x3bb8316cddd70a0a } },
+    { { 0x392f908bce401d30, 0x87d3220df7bb1fda, 0x233dc8ec55edba32, 0x127e2bc48dd7ea6b }, { 0x6fa517bf0d4f2915, 0xe7205e4497344971, 0xba41fd61bf8af878, 0x31ac02f26a3d4d8a } },
+    { { 0x82c9ebd5d718d123, 0xdac80fdd1722cfb4, 0x9650cd87a1237857, 0x07c851582cc29dd7 }, { 0x376900ada698ac1c, 0x56194451f5d68f37, 0xbb2e0a7a5b54c06a, 0x24e76a0a09ec48dc } },
+    { { 0xdcf0463ee4aff173, 0x20f36436b486fb68, 0x0b4bbb496596f887, 0x3cf17348b9fda56e }, { 0x2ec4fe5999fa7f18, 0x40abf18a0c4441aa, 0x1457601a3ae3506a, 0x09958c9471390953 } },
+    { { 0xfcdfc7a47a2f05b0, 0x77a80c8970210f69, 0x7ba570d5a8ea20cf, 0x3449dc52780308b3 }, { 0xc49026fdbe93b59f, 0x9cfd4694a264ac1c, 0x5b2733833560d243, 0x3031df8481e57eea } },
+    { { 0x99783a654bbd9219, 0x7b763aed6ab20a43, 0xecfa38125d60f323, 0x2d299c60b2e0c89a }, { 0x9c376d3915bc58a5, 0x781debe4181128c5, 0xdce3da837e54a669, 0x2315ed8e9cf2d8a2 } },
+    { { 0xeb211fb3f6a5aecb, 0x2b6940b3baae0bc2, 0x19e8d7d0ac0a2455, 0x1d73c04d2bedad03 }, { 0x7b120c711cca2f3a, 0xf4261f20ee4be58c, 0x31d8ab8693d5028a, 0x0bfafba5c05153eb } },
+    { { 0x29908d89afb8315b, 0x21410f2557ef4bc0, 0x3045f52c7976159d, 0x2c3f4f398edf7d05 }, { 0x3ca455051f826b99, 0x55fa82456f292dc5, 0x9c7b9ba91abac1de, 0x07bc66d6a4f6964d } },
+    { { 0x7bbba3bf68e90943, 0x06c1d09cecbf11b8, 0x24c45bfbca9730c4, 0x36b6d9038a213821 }, { 0x550782a68f7c8aeb, 0x64f0ad7f39fb8f45, 0x38310c6df27edbbd, 0x02c97d4876b2f8e2 } },
+    { { 0x9cf9914b18b1c004, 0x0aa6cb7b54b4cb98, 0x7fdf61666060d457, 0x37b821bc09e657da }, { 0x9d3af70691e2fb56, 0x2c917e9578a9b9f6, 0xee7cf50379cc333e, 0x05cc393c759fdd54 } },
+    { { 0x80dd39402746f719, 0x5cebd4969364976e, 0x1ab56ea9a1aa2bc6, 0x01223615de1e03c4 }, { 0xc6d3ff460bfbe3ec, 0x5d03d84a3917dddc, 0xe94e8c2c9dfc759f, 0x38c2dc5ac3610041 } },
+  },
+  // 2^56 * g
+  {
+    { { 0xb5df49e9fa914c22, 0x667e2db35ee39a89, 0xefc73000d09a596c, 0x32390bfa2e1cf7c2 }, { 0xdb6248c6c826fda3, 0x1b282b5995f72b45, 0xc77b22e5bfa9a470, 0x27d82f43a9c4de21 } },
+    { { 0x58a528afa739c0e6, 0x6adc9a9e7825e687, 0x6719bfcb997a730d, 0x26407208f7cd6bea }, { 0xd6cfc675d9228998, 0x383e61e88e444f54, 0x43b113d5bad4634a, 0x1b714d237f7baa56 } },
+    { { 0xc8288203c5e30f87, 0x121e629a809d2f1f, 0xe1a0958e5af28338, 0x310951a204e8d730 }, { 0x27bef65c3197ff0e, 0xe28846fa9265f274, 0xb71376b07c06043c, 0x01411f45d1644c14 } },
+    { { 0x2293bed1c0629168, 0x6167ed4baac49fd8, 0xfac211579801a039, 0x0ddf5213b3bbdb2a }, { 0x0ef8b7c6d2813008, 0xcecaba297bd497d0, 0xf3a9c4c75d22eba7, 0x0012af83497646d4 } },
+    { { 0x107f6b92f2ef1157, 0x1131fd3e56ee5514, 0xd7d1a42238f9927d, 0x3481c26c06e70a68 }, { 0x392b5bffa0f875a7, 0x2384900e5f1b4740, 0x126a347ed715dbf8, 0x0b66b229fc88d3c7 } },
+    { { 0x161a918c7c728ecd, 0xe42c35cdbb4d39d7, 0x041909d77aa7a80d, 0x2e6332b5417de2fa }, { 0x8bb6373db8eb01e0, 0x91af5dd989b978c9, 0x043b04200e03e05d, 0x10ffe998951872b0 } },
+    { { 0x5f53bfbbbd0d44ba, 0xeb83ff95a0564512, 0xe1c8aebf5d6de0d9, 0x2aca2eafdfbc5eae }, { 0x03c4009c38d8e1c9, 0xd9e813429c30c933, 0x1984d6df8a248d60, 0x3ba006b569163989 } },
+    { { 0x775eae1fadd5c972, 0xf439c0ff264f803f, 0x1910f70872105144, 0x0ad9b8ebc47e7519 }, { 0x7befd85068b26924, 0x7a99dfc934cb8aad, 0x6a08679fa0e3a2b2, 0x2f23fc6e726f7498 } },
+    { { 0x7bc9faaa398ca808, 0xd82e908effa57b5e, 0xd873156c4ac2b86b, 0x30d76025164abf80 }, { 0x46d15895c743cb99, 0x50abd5aca016f671, 0x2cdb554a6662a689, 0x1d3901c898947a73 } },
+    { { 0x1770b30515b7d319, 0x068ee8e4c5704522, 0xe850d51916b89fb5, 0x1a9a67bbc1421a0d }, { 0xc82a533b5c94f254, 0x4a10995c50834d78, 0x9942016adbfe4d3a, 0x29f86588a9566e55 } },
+    { { 0xae651557048b1b43, 0x290b2d2d0950433d, 0xe9ad6efa14d45085, 0x22f2539228708010 }, { 0x7b945ff89aa938eb, 0x50e5c8b622051e2f, 0x93e4618837a88814, 0x2caf9e25edec95df } },
+    { { 0x211d88d787a7e095, 0xb583ee007945b95d, 0xbc2acf619bd45cab, 0x06d5588946d5a5a1 }, { 0x287bae3c48339d74, 0x3bfbc22dc85a8bac, 0xd0b4c922a9fd82a1, 0x0291a62ec2ee3345 } },
+    { { 0xce7c7096f7416c95, 0x1d789d801a0feba1, 0x7a13abab0acf5556, 0x03ea3e0ca6906dbe }, { 0x48faf8c97098992d, 0xc0b3fe1a9f9ac610, 0xca95ed5b3c9db61c, 0x17023bf125d90f88 } },
+    { { 0x5118f8a4aae6f53d, 0x2d51d7012c9c2bb4, 0x932b4fc20907a2bf, 0x1e367110cc98dd9b }, { 0x8b4607bae0fac95f, 0xf4a87a102576845e, 0x3e16c8fea4cca663, 0x30cad6090fec2301 } },
+    { { 0xe15c2c370eca1913, 0x4bbe66f855a472fe, 0x4a3d279e7497c1f7, 0x287497facbc7accb }, { 0x94ee75f8c9060840, 0xa4763f399d6e127f, 0x245a2ce3c8e8c6dd, 0x0d72b7e226c38b4b } },
+  },
+  // 2^60 * g
+  {
+    { { 0xd19f1ddcc95dc421, 0x459bc56b82fd7c47, 0x01d26e564bf64631, 0x16c57ac5a6e6b0f0 }, { 0x6b5e72a73f23b310, 0x42eca38667ac461c, 0x4600b084b6c879aa, 0x34f45097f5702ff3 } },
+    { { 0x29dde47db3862be9, 0xffbd5b5cf084eb51, 0xbe8b423e4efde27a, 0x0192d88d48ea3a54 }, { 0xad4f8f806b4bb061, 0xe31bfba7fe4b179e, 0x7d76718c37c8db3a, 0x367a348c031ba74b } },
+    { { 0x986ec3a768d58b3e, 0x6e8bcb7130b7449f, 0x0c3fcadbc5b4e062, 0x3e01bcb554bdc14b }, { 0x38b210c9e6f8464d, 0xc9a7f224390add22, 0x9c508edc40ba5b98, 0x04b4b655bdddb0bd } },
+    { { 0x0afbeaa79baea976, 0x137124ed62017b2e, 0xbc7ec16b97ea8562, 0x2711b0e2461b50cc }, { 0xb20fe95539a0e015, 0x586660c5bed4718c, 0xad5c532bbec41fdc, 0x215ab4d3dd4c4f10 } },
+    { { 0x73caf8a537924bed, 0x301d2e867b732cb3, 0x8907c067716dca9b, 0x0b3807afde00042c }, { 0x62980f89cc1ed274, 0x13633ce71210d9b7, 0x6c0e9e07ec186c54, 0x1571f7cc1060c587 } },
+    { { 0xc0e6b0ec38a477c9, 0xb332af80aaae5778, 0x40271ce9f74c1019, 0x269e250e8659a74e }, { 0x72a10a3a3cbbbec4, 0x08ac8e9a4d1fc387, 0x0f00608289d66790, 0x30350fa5bde7f5a1 } },
+    { { 0xe2bc49c079ece1f5, 0xc3426dbf50d95f6a, 0x7e3d4761ca16ea46, 0x2bf4ed3394480bf8 }, { 0xaf05f01460c3dfee, 0x00cc4388d5027fd9, 0x32ca70c8c193a18e, 0x33064ce010e74d3b } },
+    { { 0xd6a25aa6fe8d3f6f, 0x2092f43702b9359e, 0x3239fd67fb05b34c, 0x24892ac69319bfe5 }, { 0x0e9ef2d83a8cce85, 0xc89400724a4003b9, 0xd970f5042c5acd7b, 0x21cca2e34e97bae6 } },
+    { { 0xfd8a6b0aaea39bbe, 0xdad72bc81dc2e822, 0x1d98b8f224b935b6, 0x209432111275d3c6 }, { 0xf0396b1afbe62ba1, 0x00251d9ed0e310ca, 0x36cfdf41a7e8705b, 0x08649b25a0f46e20 } },
+    { { 0xb6c30b1663509034, 0x342e5d68e385bf43, 0x2a26382325e36bf2, 0x28b5362bb3d026a8 }, { 0x1257bdf6afdc31a6, 0xbf06080852c9ead5, 0xc08c65b5657a2e5f, 0x1b09d8aa288332a8 } },
+    { { 0x070353dc098af708, 0x2c705b36b9e9ca6c, 0x76b472046fcb4797, 0x04819497ee84e029 }, { 0xc75521cd33f77b9b, 0xba315626db25e375, 0xb380b7544474f69c, 0x37979914874c2690 } },
+    { { 0x04be10a25565c56f, 0x18493060352200d5, 0xfb0d59c5eda2a1f0, 0x29d9ce0253fa833d }, { 0x6c49384c2046106c, 0x38b0417549f32249, 0x1601c3ba39a01944, 0x1a0f11f98e3e5ac7 } },
+    { { 0x07ff6b3bfde8c3a8, 0x48b8756df272a380, 0x5fe971991314f178, 0x1d1d7fbe16df0fef }, { 0x0a6edfb9262f959f, 0x9893a6fcec99382f, 0x810e57de311e737f, 0x21d92289e629b931 } },
+    { { 0xe4286dec214338de, 0xd72b097fd2b93ea7, 0xbbf842b6efcc5cf0, 0x0f6b00047bcd79a0 }, { 0x01e78a4538f1887b, 0x537fe177dcf3978e, 0xbd83c4d3b836a406, 0x045fe745a9fb2641 } },
+    { { 0xe98a7172550f31b8, 0x6ef07d4b097d53a3, 0x02b3794e99c9325f, 0x08a5077686eeba52 }, { 0xccec942176f06124, 0x8e0beafec18a9076, 0xf60bf28d3a116891, 0x01ad6eaa1d766035 } },
+  },
+  // 2^64 * g
+  {
+    { { 0xd3ef3898d7a287b0, 0x27cc6a4a473ff99a, 0x0a0cfab1a987fafb, 0x357c8681257a2b4e }, { 0x01eaf8485b287538, 0x08f39da0fda718e8, 0x2dae9eb7c18d3c2e, 0x2ac54f225d4e6e46 } },
+    { { 0xdc0fc0e49b56bf33, 0x365d932ddd95ebef, 0x2aba0450264142bf, 0x25e7b16aa8053da8 }, { 0xf78bdb73c84b80fb, 0xec621592b59fe69d, 0x330eef036577fd6b, 0x1d75d310b3021319 } },
+    { { 0x8381aeacf27fe6f3, 0x3549f124880763af, 0x44132685204735cc, 0x38932fab930c353b }, { 0x79bae59b60d3f277, 0x847d55319d48b287, 0x56bd18630b8748b7, 0x061d0bb3ec514800 } },
+    { { 0xd56da37788106c70, 0xb70d91e38e083382, 0xf09e07dd3176b9ba, 0x2112efb179584edf }, { 0xc364bd4edc517864, 0xd458a5f4ec793d51, 0x1e81a5241d285b21, 0x3691f3434a566304 } },
+    { { 0x476d70c8478a8b4e, 0x7e932f57c15fe81a, 0x8a956ce47c2254fd, 0x3aea5ad722a2b42f }, { 0xb6ea7bf103434b6f, 0xd6f76241f8a8fa41, 0xe2c3a9327c5e6532, 0x1c4075497fa42615 } },
+    { { 0xccfbe1b69e49d341, 0xd90d06344f66f654, 0x342526143e8e9c75, 0x35bc4daa69bf10ca }, { 0x89fc8bc874963ccf, 0x3eca294505000210, 0x387e96b336846fe3, 0x247902769c30af1d } },
+    { { 0xe4af6997f76375f4, 0x4eedc2fef2421832, 0x14c792670b7cb305, 0x3f419a5396ecb1a6 }, { 0xf90b5658af5082a1, 0x0d2767c3f3b3210a, 0x2951492febe76bd9, 0x27cbaf894b7bdea2 } },
+    { { 0x62a57ce0df98a10a, 0x32cbed61ab6ae66e, 0xdf4f8f4bf30474cf, 0x1140fbe050a6297d }, { 0x3f8c1330d5b2a058, 0x954d5b544ae0bd5e, 0x34244ce0cccfea92, 0x1becff1c5354edab } },
+    { { 0x772887cbbf1dc25d, 0x12302c8c1f4795c0, 0x3321f36af927cccf, 0x3cd1305c9eb95af4 }, { 0x882cd47e8e254342, 0xb1f7550533bac304, 0x03ce43e59475ca66, 0x2e7e1828b9ddff20 } },
+    { { 0xcb82d9e5955187b9, 0xb7ec411013eb23fc, 0x0db9a31868a86b6a, 0x2d100945ceb4a522 }, { 0xe109e929165f19fc, 0x43bb15ceb2d8bdcc, 0x4d437c2ececeb07a, 0x33584965106e9453 } },
+    { { 0x129aecb5e366a934, 0x806e1b9c3aab2f51, 0x89d25f891d0f5778, 0x25c75926a2b3a740 }, { 0x14eb604896fd7903, 0x29deb1062fca786b, 0xdcba754f4c87824c, 0x008e66140b87a3a4 } },
+    { { 0x9f282fd79554d8e8, 0x85426d7e90dd8885, 0x384c157bae8745b6, 0x35aa7ce27309b15d }, { 0xbb3dea54c5041dac, 0xcd51d2223c7d8255, 0x4464c466e01a9039, 0x0f23c18315b78918 } },
+    { { 0xabdc22cb17c586b0, 0xd4ab128db2d660c8, 0xd38b0c09f192bd8b, 0x29c4dbe3ed05f5dd }, { 0x87fedeef8e6f7496, 0x34412ed9da0d599a, 0xbd733458be3b7c58, 0x0a4ae4051569683b } },
+    { { 0xdf5f809bb3b8911c, 0xdbae29a73e32f355, 0x8049228d8f26e5fb, 0x109cd7d3e7f44d51 }, { 0xafd6729f832861b5, 0x99a5e31d31029272, 0xe175c85d8c860262, 0x2faed2c30e6ebe7c } },
+    { { 0x4264b27e15653c72, 0xda4ea8d42d6e92f9, 0xf27b650af1990773, 0x2cd653f0648bcbf0 }, { 0x8a32fd19b21c5402, 0x343ddb373575f565, 0x4fedada03eee2b88, 0x38776a7fe113ad80 } },
+  },
+  // 2^68 * g
+  {
+    { { 0x7e5d5fef31079471, 0x112b0543e583244a, 0x8a8c05ac70d681a4, 0x2deba48851c1f552 }, { 0xa6e3cda837b17927, 0x33010a609a4becd9, 0xed7452786d4fe84f, 0x35208f6e35d2c110 } },
+    { { 0x277966b9aa765c8d, 0xff0c0fbba4058d87, 0x843a1db9f3a0ac56, 0x05298b073f1729ca }, { 0x16ec8bb082e74ebe, 0x755cd7902f10ebc0, 0x553b66467888b6bc, 0x2910b3d387b66af5 } },
+    { { 0xc7bea329ed5ce510, 0x85206f22b58eafe4, 0xe2b662cbdb3bb846, 0x033b88fabe9e887b }, { 0x5f25efcdae582cd0, 0xe599a6c014ab8036, 0xb8fbe291e467e7eb, 0x2aa621bc30d735f6 } },
+    { { 0x5bea94ebdc1a8b26, 0x6aea7c4c36c2e226, 0xa70155f2a10653bf, 0x08a455107dd10fbd }, { 0xca42799613bf3028, 0xdbd6b97c7afa9892, 0x6913688ddf7fa004, 0x3ee4fc210f41ea0c } },
+    { { 0xe8cbdcb3b11120a4, 0xb0cedea13185c137, 0x6aa16b8ff04850d2, 0x34879876f195f635 }, { 0x4c79da856fd3c2a1, 0xeaaccff627f24539, 0x91af96edeae48daa, 0x057a25f26b0bf2c3 } },
+    { { 0x2cfe04a82a4e61a9, 0x1b35198fffa3fca3, 0xe9a956aef6904ea2, 0x1603cf4385ab5d4e }, { 0xe17d11da55b3919a, 0x001f6f6f06faaf77, 0x695cb529cb16e58d, 0x1623fd5d91711356 } },
+    { { 0x0dadea8333aff0c0, 0x4fe6ff478dfb85d9, 0x19013bd7d6d31278, 0x21545dafabecc49b }, { 0x9265a584e5237279, 0x6e755aeb22a476a5, 0xde399dad31049753, 0x31a29fe9d255b0f3 } },
+    { { 0xa3a992fdc1ee77c8, 0x099f23103f6fd8be, 0x10cc5ad303fabcd0, 0x180a40415ff1e745 }, { 0x5f12f1562acf89a0, 0x9d8c3ebaf18bf7b6, 0xa099c52fdeec6bd5, 0x3eacbbb7cf360f82 } },
+    { { 0x3b577cca0c23af78, 0x5af9fa717e25c9eb, 0x159ba21f6ff8502c, 0x3363c0a31fe45fbe }, { 0xdb69d045e3f04bed, 0x134af360d8b5a29e, 0x3c09cc2048cdbdb2, 0x0b22d5da24d9e141 } },
+    { { 0x6ec07e15c74cb19d, 0x269d0e0bfd1b98b6, 0x050fa7bdc6a5119b, 0x29e7cd5d9da6c713 }, { 0x63501f2c7f632263, 0xc7dade4bf2982f5e, 0x50a2dbc6220ec397, 0x18bb8c09d7072888 } },
+    { { 0x2aeb025cd484a990, 0x729d777dd8214ea4, 0x666e9ebc5d79bbb0, 0x3542adaabffb6dc5 }, { 0xd29f375c63e81500, 0xeaecc4bb0d10dd6e, 0x7da49ad22c665f01, 0x2df860f5030ed388 } },
+    { { 0xbb95c4a34878ce51, 0x8a133f793ecaecf5, 0xd5a2b6688a4d4267, 0x32c5577ef909ed61 }, { 0x6880e6b8ee15a8ef, 0x8e3bae5ee435c543, 0x7abe1782fb7fdfd6, 0x255cc1b251d69afc } },
+    { { 0x8e101eddb128af4b, 0xd1ed50b9d7f2dfbd, 0xf548e4e5321a5a0b, 0x39a15979e7a2c831 }, { 0x4e590b855bbf1761, 0xd3d9e9f82ff9d0bb, 0x3f7711dce408205c, 0x3dc4f598f649e896 } },
+    { { 0x8ff87d6d2627ba4a, 0x1473989efd9b4bd3, 0x558c099de111fb75, 0x3f07587be20ac3ae }, { 0xd43cc44f49cdc739, 0x4dffda87b1fa3ac6, 0xff35818f8e590cc6, 0x02647dc5277c7658 } },
+    { { 0xa43a61d0e4cba7e3, 0x1bd8cb9ee51dc4ef, 0x9cebcbbb53228d3a, 0x0cc88ec63766a3ba }, { 0xb4b2cf1b4ca6a632, 0x83464e759dce0e70, 0x9a43990d54c1fb23, 0x29f1a6327c878669 } },
+  },
+  // 2^72 * g
+  {
+    { { 0x5ce37548e1949dba, 0x2ca168b4c49fd0c1, 0x730e0e924eda5b24, 0x1c6638a90cf04987 }, { 0xcbc5232cd053f697, 0x786cb67c051a4c56, 0x673b22ab81681857, 0x3c8434553c112a15 } },
+    { { 0x058bcd5f7b8e3687, 0x557ec12d93139fb1, 0xf16a42da75e2ec41, 0x3a895f86c36f55de }, { 0xf7edf10e52f02a61, 0xfd00305305827ffa, 0xeb30accb4bd1e766, 0x0b9db7d23b803381 } },
+    { { 0xfcbfd995fb833690, 0xcc7f07f357c942b7, 0xde9307e3886b014d, 0x14143edeca8c506e }, { 0x01f1523647cea050, 0x5a989fa2983b9345, 0x93355f8bf5d964e7, 0x223c08cc17a8e202 } },
+    { { 0xc051a25836dad1cb, 0xb9284816bf9861a6, 0xe1f0e0a409fc326f, 0x09111c7f2f1aaa7a }, { 0x037d48f2830abda8, 0xb4415fa0ac5ab3c0, 0x98b6af7da6c4a763, 0x00f023df50248e53 } },
+    { { 0xc7fca06628714409, 0xe81aa16c274e047a, 0xcbb0a81184df8090, 0x0b8aa59a895460f5 }, { 0x4a628a401cdcbb3e, 0xf6c9da9dc73abdef, 0xc577fc51556edc9d, 0x3b79ab80385b8ede } },
+    { { 0xd6edf70e2557f233, 0xee343f56e5b73daa, 0xf201d143dfd6c40d, 0x28ea39b3719c3179 }, { 0x4effccbb020263ce, 0x482f1969750e0bed, 0x115b769070e6f837, 0x120d416c2c30788c } },
+    { { 0x0831770b9246ab80, 0xb69447c81e4f1c05, 0xdf040652e94ff51c, 0x25db0886f4b9551d }, { 0x4b86dfbb64b273ca, 0x4634588ff5f776e6, 0x8db7f874c77e234b, 0x2d5eeb6d3b00c09e } },
+    { { 0x0d9c80c8d8a91e12, 0xd1846866c1fe7f18, 0x82d67f1c68a33d3c, 0x04f8b590a739c352 }, { 0x235840c5bf89b285, 0x0c27b72c460c2ac3, 0xb59f472219239fb5, 0x308d04e3bb620c23 } },
+    { { 0x51553c80e2b3d9e7, 0x769f626bc5821032, 0xf77ac94dc85f91eb, 0x174b6129a8d3f78e }, { 0x60390b30e6ed9fa1, 0xac20d1d784379b51, 0xf9efe02b581eb14f, 0x005ecc2d49a0e1f4 } },
+    { { 0x5416587cbed02ddb, 0x1b127b1599f2c544, 0x4b021287bd27a16c, 0x19d03a1c847127f4 }, { 0x137f6d04adc57fba, 0x7b643980899b73ef, 0xa2ab3ffb17abc8ce, 0x06280d7e8e480541 } },
+    { { 0xff589a089e60461d, 0xdec5f77f4a4e77e7, 0x8b8874e57f0c1f5b, 0x3571de593e805c11 }, { 0xb5965503f9336c8e, 0x43174fd925030b19, 0x9240bb2eea593ced, 0x2a3a098b26fb9147 } },
+    { { 0xf06ec55052d55e01, 0x8f103f31d5795371, 0xb4f9e4c2238a8e94, 0x1f1a84ce790cc6d0 }, { 0x2a95a1edccbc9008, 0xa100779f65894eb7, 0x3b03ce19ca580aca, 0x36b0862ecc43542f } },
+    { { 0xf75c71f7983fbc8c, 0x02dafcf33f3c084c, 0x31c1f4a2fa0676ff, 0x051e4c2568f96dd3 }, { 0x0b430fd6f7816cd5, 0xd5b3156dbf3b23dc, 0x3e283aaa081f3002, 0x0eec399eb81436bf } },
+    { { 0xa0603291adc59868, 0xa5efdbf35ffcc3b7, 0x20f5abc351e32ec8, 0x34c23086dd7241f1 }, { 0x6c05d5e85f902779, 0x983f099de91e207a, 0x6aca6a6085646aa1, 0x3bd23f398e8d9911 } },
+    { { 0xcd02c0012f62d0af, 0x3697e15132a36ed2, 0x0d2392bc5a06bad3, 0x3e6ffacd59baf220 }, { 0xb30930a737a083df, 0x73841c45f49840c8, 0x0e4db20bbcb382d2, 0x272641ed0002710b } },
+  },
+  // 2^76 * g
+  {
+    { { 0xadb8b50f88c82370, 0x15f3843dc508b5ec, 0x2215a227d4010cc1, 0x0ca20ad1a95d0ba6 }, { 0x94b54512f9913859, 0xd0152fb5393d78af, 0x79ba7035f00962c3, 0x043d53b2c1638267 } },
+    { { 0xa149ec461822315f, 0xb3afcc0959edaf3b, 0xd4f997a6c1bdb109, 0x3e2770c433969725 }, { 0x15ca28332c5d379f, 0xe9b2cc7218b23b38, 0xdb9579e264be4d5f, 0x2164ad8d23c0d6dd } },
+    { { 0x0b4462a139f8ab70, 0xb30d27c1e08c5138, 0x463a7bbe022645b9, 0x3e19d064cca873c6 }, { 0xa4cc81c52e9fdb42, 0x244f2847681fb131, 0xf6f9a894010a8c81, 0x2b34c43281ecc95f } },
+    { { 0x19915e0910ef65a4, 0x337e395a2e70f427, 0xa29b9fde68d81f8c, 0x0c6c5039abf206d2 }, { 0x279f393c3e2bb9f7, 0xa37b575fd14dca14, 0x316784c4aa8a837a, 0x342aa928f2c7be3d } },
+    { { 0xfe14dd39fd821a80, 0xd4b33762b5926aea, 0x5dd712ade643a516, 0x31dbf9f6834eee6f }, { 0xd807fb786e188729, 0x3d85874d0e43bc3c, 0xa36866dfa33dd1f1, 0x0be601dc96653918 } },
+    { { 0x244155716cc5622f, 0x70f5ef3ff14bca40, 0x158f205afd71e0dd, 0x2f1b4d82147378a5 }, { 0x47e9461e4d14cefb, 0x8b0a972d4fea5fb1, 0x015d8e229cd3e8ae, 0x10d6bbf887a8ed05 } },
+    { { 0x12df923db6b017d3, 0xa2caa201cc856221, 0x1e04f41868f19c98, 0x06c0ba742bca0ae0 }, { 0x92502fe7c3c362b4, 0xbd0f976d35ae392d, 0x93bef73147652406, 0x39312e607bc8d42b } },
+    { { 0xcc9bdb8030cea01d, 0x88108850d817a37d, 0x826c68dae6d57423, 0x2e0d1efa33e6b37c }, { 0x3794039b072d47cc, 0xbb6a79815704bf9c, 0xc14930aeacf5ad4b, 0x0f67aedb64892950 } },
+    { { 0x549b03fece3d44ff, 0x8b5996ec1b56ae31, 0x42f7d5369e92b521, 0x3eac111721d69540 }, { 0xc4d32bdfeb631223, 0x98014cafaa574af6, 0xf02896567f8ccf54, 0x38eac9a4ec24b72c } },
+    { { 0x70190140380958cf, 0xa435aef1565f3852, 0xde2228bdb63d8687, 0x2233744b384574b9 }, { 0x44a4e780a3ccff66, 0xe272fa32f0af9c8d, 0xde20ae0cc80311ac, 0x2be0e30b198203b3 } },
+    { { 0x4a1fa9dd0cfc2ec8, 0x6b2d9631a0cd54b8, 0xeb9b3b79e1aa88e6, 0x2c440bb8fd7e0810 }, { 0x0f8061d2fb21ae5c, 0x7be63ef8ba1cec20, 0xd36780d1bec75d14, 0x09d4b9301fe48551 } },
+    { { 0x6d5d9d5ec5b7bc06, 0xfb92d8aefb9d9112, 0xc0f05eab414f5c33, 0x147740f11f22d19a }, { 0xa5bb3cde77813765, 0xaa4ebbb78e489a81, 0x95dea2e55e012326, 0x268f8808a7db0d5c } },
+    { { 0xdd33c5b7443ec122, 0x0d39c67dbbb88313, 0x24627709928718d7, 0x1bc91b12d7dcda7c }, { 0xed1ee91029da4a6d, 0xba6162f134f11750, 0xa376146ec0c8c0d8, 0x16a1fb4dd23a6f5f } },
+    { { 0xfb71f1f4b65f977b, 0xb6d8a22571c8b4e6, 0x0fa561b19978fd9f, 0x39cedfb371148447 }, { 0x6e271ac185f86f18, 0xb4ec434eed487b44, 0x657e88a345b2330f, 0x1c93fd9a4160301f } },
+    { { 0x11ed9026e9a2ca77, 0x35d6e00f6d55329e, 0xd300ba5d8363097b, 0x007421f97dd13948 }, { 0x7aeb0f4ede031354, 0x2f66e33945c07c10, 0xfb257761e1cee370, 0x10ea3f701cd52589 } },
+  },
+  // 2^80 * g
+  {
+    { { 0x2e73f91dcf4b43e7, 0x0bec6c13d0073022, 0x83e3fc3595662d22, 0x2e58ef5ceb3480f5 }, { 0xd88117d489354d12, 0x70a3950643aeb82d, 0x54a35c609e7e52dd, 0x3ccc38b00d2b27ad } },
+    { { 0x0fd446f98f679e28, 0x066f885419ffbfee, 0xc50c26e9357800ac, 0x32fe04a6ffd1a258 }, { 0x5eaa676d85f62c54, 0x49f137a54abf0bf6, 0x5118efac0f81e39d, 0x0409ef7e69e734ce } },
+    { { 0xd886a1ebc4cd677a, 0x27a689bbde04d112, 0x1457464d782cc4a5, 0x2e9d4ca1051b8236 }, { 0x302b64b0071b14f3, 0x3f4ed4a0da6f1e71, 0x02d14b6b2df9fb99, 0x265a1aaf5f2495be } },
+    { { 0x6e7c415751b9b44f, 0x883095f6dc7a6afe, 0x9f2d66f3524003e8, 0x27fe122a8d769bbf }, { 0x07f020eca15f0a75, 0x0b644f3f185342e4, 0x5ef0db8dc2f3979b, 0x1b97807b516bddba } },
+    { { 0x4c3cb93f3246646c, 0x3c8189d5f8679d39, 0x0c6e4a0f8c16e071, 0x33a3a7f2c1b64e63 }, { 0x87b54a81cd0ec0b7, 0x3e19ce25ee45389c, 0xdea260450f5ccf1a, 0x0736d97cc095503f } },
+    { { 0xddeb57c95c6a5471, 0x31c246231ce223ac, 0xf540668ad37c088c, 0x073b5166d4400793 }, { 0xb1ea50eccd4dc89e, 0x330f0b985ceda9e7, 0x3a51b151ef62a182, 0x1b1ec545dcc39743 } },
+    { { 0xe71809191c5f1ef4, 0xeb8c375413670052, 0x6cb310db8a602d90, 0x3d6078afe078eb70 }, { 0x091178c1d817759f, 0x1c1c3d713e9ee082, 0x57d968ca275244e4, 0x33b66bdbdf8ff934 } },
+    { { 0x3804453303156712, 0x964206e368b295e1, 0x6ff0dfc75340d05a, 0x3ed53741e3567852 }, { 0xfea026de3e8ed6b4, 0xd84dd73a6c9a6268, 0x8ee77dc5be148253, 0x3119e32ece563b4a } },
+    { { 0x473c4e2f07a337a2, 0x209b54fe22eb60f4, 0x6f767020c15efd6c, 0x2c7fcf3c899b8368 }, { 0xf4ad45da8a490bde, 0x932e3687282ff2c1, 0x0ccfd81d7e047d0a, 0x186b113b04d41d6e } },
+    { { 0x930aecf18a7af104, 0xcab47058bc168a89, 0x6650a63692f8118d, 0x3eda3784e3439942 }, { 0x51ed4fb1063db9b9, 0xcf8c8067ce5ce4f4, 0x5f232b96616c3fd4, 0x352eb175240011fc } },
+    { { 0x62c5da3a19e21ce3, 0x1f4325abda23dc25, 0x3555da99cc3b57e6, 0x2649b2930c8a6cb2 }, { 0x19ed819b6499c117, 0xecd2ddffb28efe86, 0x1d146cc1cd4305b6, 0x2e979c70d4df548c } },
+    { { 0xf5688eccc3b63f56, 0x126a73e3851a02f6, 0x0b82d5ef7ca07fb7, 0x1923343f8159a413 }, { 0xbaea07699e191646, 0x0d7e585899b23bbf, 0xf434b63201d604ad, 0x2fe56b95dc7fd07f } },
+    { { 0x3de5e60cf0ee291a, 0x1eb9f19d47f908e6, 0x1bd41da986d7694c, 0x339b5e3318ada35f }, { 0x75a03ae6ec5e90ba, 0xc36c1a540d8c0f8e, 0x7b0e9bf55f607787, 0x290c6ad1471b08af } },
+    { { 0xaaa148b841bf52d2, 0x86b52aefe82f0b79, 0x76d5e6983f3367e8, 0x3b2770b922312f8e }, { 0x05ad5d85bf44d763, 0x8367a05385c0ca09, 0x54d3a1346d0bddb9, 0x00ca4760ef51c9d3 } },
+    { { 0xd97048d149132977, 0xbb267ac747ec9868, 0x94ab400007dfeb4f, 0x3a0226d7ca86795d }, { 0xff1b0171f2231473, 0xad3acd69d515e690, 0xb59f3501e207fd97, 0x2cb41d70d4b534bb } },
+  },
+  // 2^84 * g
+  {
+    { { 0xc5dbf98674826b26, 0x566b6fb5778e2c42, 0x17d23438be1dc2ba, 0x0b0ce19b59b61303 }, { 0x42802f998c369c2b, 0x992d7a47c87d09c2, 0x0daeaa01aa792011, 0x38fe6e78cecd9820 } },
+    { { 0x3f551b23be638985, 0xc8adb49d4a3389e8, 0xc1cab00e03a7cf42, 0x3d8a4ecab78e9777 }, { 0x5dc6868bd59b7cbb, 0x190c3c0a2dc44cbc, 0x1315828fa87b5702, 0x2dcb6487f25d9417 } },
+    { { 0xffd27d79d2676dad, 0xc6e9b29a83ecc14e, 0xb973ed364c6f1ac4, 0x1551a4de8e2958fe }, { 0xf582c5f16564cb83, 0xc40e9865f3d4bc85, 0x4d1867dbd160c14b, 0x0abc5446de7be788 } },
+    { { 0x836cf7c6cbf14063, 0xf43ed837357b09c7, 0xb093d81b0e721779, 0x126b5f0c930ed218 }, { 0x25087b5a7c8b3fdd, 0x160019dbbc3d055f, 0x09c5f87021d25f8f, 0x30fc5f41dd44452d } },
+    { { 0xe98fccbc484c5391, 0xe482ad664d918a7e, 0xe7555dd117749fbf, 0x257936e6559e8f84 }, { 0x0ffa63fe875260da, 0x82465f5cb36f14cc, 0x861b2213a0c0da2d, 0x10c11dda4b2affc3 } },
+    { { 0x0580b9fc84fd58fa, 0x8d36c230cb7df6c8, 0x1c875031791b27be, 0x2c5abb52193c0e17 }, { 0x7dec0ae1c1671f74, 0x6013e8d699859bcb, 0xc9439ae595909042, 0x36596b1d9278663a } },
+    { { 0x2de7e8692ea86d54, 0x6c0a4dcaeb5d4f4e, 0xa6f4f249c70adf35, 0x3b11b647caeb230d }, { 0xe6732286e460f2c7, 0xd074aca9c72e0593, 0x92d422ee735913c9, 0x1c3f36240ae3456c } },
+    { { 0xa7961d786909c5df, 0xf04f98f806b43b47, 0xe5ee521b30513046, 0x27d8fc5bb1c3ed9e }, { 0xf3c350bf32658676, 0xd1a52596bbb382b0, 0x4aa790ed6bd7112c, 0x22b4885755c19005 } },
+    { { 0x6dca5ff98e3bc108, 0x3914488c56edccc7, 0xda51a9dd52ac75a9, 0x26d6b641f380384e }, { 0x94249c7421dd3b04, 0x5564a81fbc3b448d, 0x51ba17a64606ab65, 0x13fdadcf94258f45 } },
+    { { 0x0cce9dc069c8e936, 0x664db893103553ee, 0xcb6015b81a4365a3, 0x11e2239712586152 }, { 0x6c3ebfe55b6f0b33, 0x5aad9d2c25b04664, 0x6cf61361b6917028, 0x3d0fa5e1e91ad175 } },
+    { { 0x106d525c0b2a5808, 0x2ebd9d41cdb3fbed, 0x62c1c1e627fa979a, 0x05f61b3c174d2d49 }, { 0x0af1101b64c60660, 0x602d6109be7dd2e3, 0xb2a67f176a6225d4, 0x290c3e464305aabd } },
+    { { 0x708b28a35964f88e, 0x01b26e2d8923fd48, 0x3092b6766d25da36, 0x15f3afbc1bdad805 }, { 0xe0ed3bcb1f87fe01, 0xdae91fe2d38a392e, 0xa6e52a07f84b9e25, 0x02081fbf4439aef8 } },
+    { { 0xc8850c7403bdcbc9, 0x669672c3bf9361e9, 0xec32935ca78f0609, 0x00127593ffa4b5b2 }, { 0x98e1fd03cd3e73a4, 0x03d7e4480b7f6b6a, 0xdd03ed8ef441543f, 0x3885c3937243045f } },
+    { { 0xab19724a4694e1fb, 0x7a09fcfcd6529824, 0x167394c7aceace0c, 0x0b4d0a1b185a317a }, { 0x4ce35b4103b084b6, 0xac3974d634c5f3ce, 0x4392b770793e299f, 0x08d62161469687a1 } },
+    { { 0x2bd3ff5809acba31, 0x0b86fa6aa449ba35, 0x2fae83783b975c80, 0x3feecc69039d80f5 }, { 0xcd93b4723bd0a40a, 0x86dc6e3881ee56f4, 0x1c4bea735acf66ef, 0x36f5d25331c7ba21 } },
+  },
+  // 2^88 * g
+  {
+    { { 0x03efc60f3af3b28f, 0x1568966d897f404d, 0x6b258ac63fc7302b, 0x285252b1c8df0e20 }, { 0x4b358106a7ea6d00, 0x14650615edf16611, 0x3edf3359358f4750, 0x3da282979e2338eb } },
+    { { 0x64ccea9b79fb45de, 0xd929332d8ab352e7, 0x61bd1e50910201a4, 0x3c4f57ea561d9991 }, { 0x7559b3487914f06b, 0x547e8b7cbc6b87ca, 0x557fa97c3f434099, 0x2384ca11c54c1daf } },
+    { { 0xd99d23761c348b9f, 0xdc776f23a66b2b43, 0x1dd591d5d59bc4bf, 0x0fead93756513922 }, { 0x21caa28144f92bb9, 0x2dfb8119b026e8ca, 0x9c5d08b49a1041c9, 0x2e0e911128710f5f } },
+    { { 0x75bdfb216701c291, 0xfe80b69314c9632a, 0x972dc764c04c5d15, 0x304509367fac5ffe }, { 0x7314f3a926332a18, 0xa57956f9cab52753, 0xa40dda675db018a3, 0x06cae2248b09d488 } },
+    { { 0xa7e7c16e66e16c38, 0x9b4d323505afe2e7, 0xd8e3490caad3dd8c, 0x04c06249aff4e65f }, { 0x64f9dd19994ca200, 0x0144437d54d8c588, 0xdb1f41948b1cb6cd, 0x293598fe093df29b } },
+    { { 0x8f995b3cf8088d76, 0x9c3b24fbd217718f, 0x0427381ad2c6ed40, 0x3a97643f4901b244 }, { 0xb697fb57ed865505, 0xbea95ef6e7733cbe, 0x716a2eafa89ba3a5, 0x0b0c34c8307238cd } },
+    { { 0x6d6c253dc91dbd57, 0xb6603bf5f2f928ff, 0x3827cfb1a2c1f0a5, 0x02d9ec46fca86ec7 }, { 0x74e1f7468a248468, 0x1c2e01e250369cf1, 0x28b8c431314c884c, 0x1d1b8bf1b33517d7 } },
+    { { 0x219af443b812d452, 0x4936ce55cde414e4, 0x324c2f1f30392bb4, 0x244c1b0c50ce4e8d }, { 0xdba720fd09b63487, 0x6758c4e86c893361, 0x538342f19c73c315, 0x3aad584a82856965 } },
+    { { 0x1a28f3088d0ad46f, 0xca3fbafea22bab7c, 0x77de712c8e89371b, 0x1fd1f70c02666e2f }, { 0x7a4297a375a16f2e, 0xfa4cfbc1febccee2, 0xf804a17d9f865272, 0x14caff0181ecdef6 } },
+    { { 0x09f47df359c6af56, 0xaf201665a08bf641, 0xce3e0dc0649ac143, 0x0096777e9728cd48 }, { 0x31525bb1c3a53307, 0x75171f4a2fa245e4, 0x89aa2d157d6757ae, 0x0c38fd1fbd03e47a } },
+    { { 0x2f58cc80d530cefe, 0x00ea1c5b51f91606, 0x8cc052d8ff72b8ea, 0x35a9c34aa9a6db7c }, { 0x438717b8b72c1564, 0x30726df535249ad8, 0x562eafae47a71fe5, 0x33a72ef1a915811c } },
+    { { 0xf09ce7c88510f1ee, 0xb014995d96d8ff18, 0x056f69f1e86613cc, 0x2d19e8b7508ac075 }, { 0xbf5e422e1638727e, 0xedbdcbc2da258bf7, 0x6a30cd1dfbd502c9, 0x3142422b97e63b5b } },
+    { { 0xe9195f048a39a611, 0x38a2dc1a429b0d80, 0x3cde4873daadff59, 0x0fca3f4efa3c50c7 }, { 0x125f01a89bfc9519, 0xc86434e7c6f05bbf, 0xe7f2ff59d39b4376, 0x1d677d77ee08af8b } },
+    { { 0x17fb0b734f29c811, 0x3cb0942c557f7eed, 0x4149e5b09b8f10df, 0x19815bc0ea75cdff }, { 0xd61cd09711a22ffc, 0x45e093f4dcda98c6, 0x90e79e60b0f99417, 0x2fadf5ecef01d5ed } },
+    { { 0x90a6cbc31ee50224, 0xbb9d7a087543eb35, 0x62c048be1a618ec8, 0x32cf287fb9121b68 }, { 0x4db60f8ea64518c7, 0x385d07b491a17eb6, 0x4a5fb7f9cc5fc993, 0x17eb3e03f7a1941f } },
+  },
+  // 2^92 * g
+  {
+    { { 0x588a014cf9885802, 0x45d28638ab110bf2, 0xcb36b1f0bc772c32, 0x2f13737943c90a54 }, { 0x749d315219aa776b, 0x5b4ead0950c8eed1, 0xfc5edfd65216ac26, 0x3e75cf1c3fd373d9 } },
+    { { 0x6977c31ff02f3132, 0xdb49a41d1eb0d961, 0x28488da9523f4b4e, 0x3b7e8551c8d7f2c1 }, { 0xe06c46f070b967d8, 0x731ff55bec5fd628, 0x51a12f81be25103b, 0x145986c710ba7d4e } },
+    { { 0x3f9e927bfa320bb3, 0xab3c7f02458a5b7a, 0x09ae123bc4d21312, 0x054164a454b47d99 }, { 0xac05160ab9e6628c, 0xcfa151ccf9780797, 0x956f53ddee84135c, 0x2eaff1ea1241c1dd } },
+    { { 0x99f30464939ff110, 0xeb517af6acf011e5, 0x322701fb41d07f85, 0x2fe2ea8dcf24abf4 }, { 0x601b9bc8f8a38394, 0xb97590b299eed4b1, 0x38b38619c3f22f24, 0x11784cc0a07b6151 } },
+    { { 0x5ca292975fd43f4b, 0x1088d20bd6e269bd, 0x996f13123b0dfdfb, 0x0c4c6a1d1fc855bb }, { 0xbc87f8510b9ffad1, 0xbd99f2a046b66eac, 0x95efc199a9abc659, 0x3c27b50cda0f5369 } },
+    { { 0x4aff2d5be1d01cc0, 0x82a407fe5a440b2f, 0x60daa29c3f9271c2, 0x249e52a8e4ad9c99 }, { 0xcd0fded1fc8ba6f8, 0x6abb386362efeecd, 0x1251e8b08e94dcd6, 0x08a1a769cb2b0374 } },
+    { { 0xcf1711df939ad6ef, 0x85c69dbf502a63ce, 0x92a270a6f4b19208, 0x3dcc59d2641a4680 }, { 0xd8ff770406587ddf, 0xb049f7bbc28e2db1, 0x4fc5563074c6f03c, 0x031622f96965967b } },
+    { { 0x6dcfd568e9f6f435, 0x60a20dca5435f5b2, 0xcddf0d0b27c9cffb, 0x20442c162bb604ed }, { 0x8009c6cab4d21a7f, 0x72ec19be16fb9139, 0xbaa4cb4bff3eb722, 0x21dfac66e52879d0 } },
+    { { 0x21c1ed3d0c006388, 0xd6dde20516b41620, 0x4341fff666f34aea, 0x3a881222dddead0c }, { 0x716470f50cbf1708, 0xe21a30b481e8a5a5, 0x64d04eb71ccbc5de, 0x3122bed75b306317 } },
+    { { 0x0833b6f09b26e2ad, 0x03c6e6ad2f2ce3ee, 0x37d0a18ee661a8e9, 0x3bd66a5877a5897a }, { 0x0a5fce97d1458e45, 0x010f446f420a4e7d, 0x171788b6859d123b, 0x04b8358b78477a3e } },
+    { { 0x87c47000fe851f5b, 0x7cb82b95489f099c, 0x8f224f315f982819, 0x1f937d3247454ad7 }, { 0xb345e786d53fb0d3, 0x5ab71150b42f1aec, 0xb3b3c750c9fe38c3, 0x13b5f203268eab92 } },
+    { { 0x2eaefa268c9bf968, 0xf6ab8ff572c8cb27, 0xdc3c12b12c7b6c00, 0x1c39aadc4d58b3ab }, { 0xe2022394fd5ea5b7, 0xa76b29eee5532571, 0x8910b81f4a614876, 0x136342b4114cbd1f } },
+    { { 0xcf0bdb02dd2481e5, 0xb14c2990c36f0806, 0x2868618388e26325, 0x22602e393b0494fa }, { 0x1d38502e1852590a, 0x295ce2d4719eb24a, 0x78d7165fe0d616b6, 0x269348050fe16f28 } },
+    { { 0x25a8997df17c3030, 0x94e5c1f6da67734f, 0xdea3ae555a2217a2, 0x31acb16944acfd35 }, { 0xc82e615bdcc16963, 0xe38be434473b5a96, 0x252a2d8c3c05e125, 0x2e80b8f0c3da3b26 } },
+    { { 0x24dc0fab5abaa107, 0x888cbfd4e17213d8, 0x06837e3e096e9644, 0x1984f8b6370bd183 }, { 0x375536fad15bab18, 0x7e9fad41eba66009, 0x334a0469dd490093, 0x0a76eed4973c8965 } },
+  },
+  // 2^96 * g
+  {
+    { { 0xb53592294ba84d04, 0xcedc2e3dee109c08, 0x6042ccc671437d1a, 0x29d7c06063f7bf14 }, { 0xad7418f63b3fd913, 0xd3abbcb2c3ea1762, 0xddb0b2337cfa0b75, 0x060c44845d5f3dfb } },
+    { { 0x9b4660ffec945b5c, 0x8715d53c171473f6, 0x59cd7dc653623d59, 0x0ac00ecb3330f9e2 }, { 0x29c21cc80025ddba, 0x882de9451bb38f84, 0xc2fdd441b71e5b0f, 0x354bd699b553f5bd } },
+    { { 0xb76176b15cd5f1e5, 0x4eb5c0bb583e913b, 0x61ba83765ad3c893, 0x05407b16cafd669f }, { 0xbd04dc592471db0e, 0x3efc04662d8b7a6e, 0x865654180532714c, 0x3f7b3c086d349313 } },
+    { { 0x03889bffa932a786, 0x2c4b433475eaaf66, 0x5917ee2691137938, 0x220feec5861e8d40 }, { 0xa91b1f0b770cd9ad, 0xaf380d4f1d773695, 0x0e45ac6f1dcc9f8d, 0x210b74f2c141c649 } },
+    { { 0xcdd3d144744cad2d, 0xa50d559e86418943, 0xd16358db17767131, 0x263f57c2a9b6b766 }, { 0x86956751a8347935, 0xb61214672e7fc7f0, 0xd62548036b13ff48, 0x03bb1f9063fc5eed } },
+    { { 0xcf7b46f8dd70f6dc, 0xd138432a4c16785f, 0xa04e9ebb1c01e812, 0x06cfaabe11468a5a }, { 0x711b1e3ea68d0b44, 0x11da0df4087c3267, 0x55310ff4d2005177, 0x24bd47cc6b8e9056 } },
+    { { 0xe399918046988993, 0x244978f90884717f, 0x060919f24185a69b, 0x17d52e9e11af27cc }, { 0xd29e3a699d68838c, 0xa6d5251036bc904c, 0x4b086894bab4ac32, 0x335015bc0c3d7b59 } },
+    { { 0x9c0a925bf9f406cb, 0xd02fd775494c3d3b, 0x8131472d619136db, 0x0885994ef7410854 }, { 0xdfb395d2a7fb4743, 0x323b049e7440cb99, 0x717a6c5f5cca73ea, 0x09c44a820dc2c1d8 } },
+    { { 0x65d23b843e06dcd6, 0x179a283a5ab290a7, 0x0737f81d7b01f44a, 0x3014a9162f80e02a }, { 0x978978f8e4c8400c, 0xc648b8631524413d, 0x83584561dc21291c, 0x2dca6a2dbc31f920 } },
+    { { 0xf786f503ab2db7a9, 0x1b3d6fe005d1d117, 0x5990b8cc569ef97e, 0x07b8e3633b555b5c }, { 0x6c1adf43becb5076, 0xf9a36a5191a4a16d, 0x1ddfe4714afb6317, 0x1ed72261564de125 } },
+    { { 0x4403e156320403e8, 0xa66ef32b1a12d2d0, 0xa0aa210b24d1114d, 0x3a06077614cc3339 }, { 0xe3826ab2dd95dbd4, 0x31695055e587dfff, 0xa14cac8abfd8f23f, 0x2c9e52a65cd3cd9c } },
+    { { 0xa656b6a41700be8e, 0xd63c22c807790ac2, 0x8d2a7d881e830909, 0x338e1e0cb35df5b6 }, { 0x51464cc2a51ce9fb, 0x5cb9f8533660fbde, 0x25186bedb9a05841, 0x2ee6c4aba3f2b0c5 } },
+    { { 0xa27b4e3dad3e6234, 0x24fa94690f1129ca, 0x331ecc6a5eb56b91, 0x005b961b0604ab27 }, { 0xf96777982713d342, 0xd3463224d38eecb0, 0x5cfa51993478860b, 0x002c27ac788fdb81 } },
+    { { 0xb9dc30e962f6ed3f, 0x312f2b1ebd0533dd, 0x19f76c1ee3644bb6, 0x228ebc179874a0b0 }, { 0x144073f3d721b567, 0xa3a844428a3f2e3f, 0xc1fcd91f2134729d, 0x20c0a18f38125ab3 } },
+    { { 0x4a6449a10ee9c9f6, 0xfc54de6959311135, 0x65ca9837fd060f3c, 0x0bfa83259fa57f1d }, { 0xa7078a7e0862eebd, 0x9e4e8ebec47d5452, 0x73e6bbb7f8d6dbd8, 0x28e332b67f1f40c7 } },
+  },
+  // 2^100 * g
+  {
+    { { 0x733c704a80141c83, 0x8c94ab5e9a302f22, 0x99919302c52b9132, 0x16f411e481382e87 }, { 0x11cc94e2d57e2d1d, 0xa1afa38293e9d24a, 0x26840071d2876736, 0x31da15aa8cfed892 } },
+    { { 0xa1c8f665283f218e, 0x40992ca2dd26a634, 0x534a25779f69f3bd, 0x26165d4584b9157d }, { 0x2aeaec8f59420ac0, 0xd347ddef4c9dc0bc, 0x222fe385ce1fbed5, 0x1b15fb9ea7548475 } },
+    { { 0x341b839cfa1ba15c, 0xeb1ee27a12c62c95, 0x91a109d8dfa613f5, 0x24962b53ffa23372 }, { 0xcdaa014dc2473d14, 0x04cbb141a43cc8f6, 0xec98319da0e95e3c, 0x3e4d993e7c50e0b8 } },
+    { { 0xff643928b66faa67, 0x0df76c4b10579945, 0x04a14c9639b0dabe, 0x38f1fa212c03dfbc }, { 0x6aa997fb9aefc5ea, 0x3ba6decd12749a28, 0xb95640fb3d222df3, 0x3b3649e5e50c8e1e } },
+    { { 0x90cb3afd6cc2ee2b, 0x1d94996f0263343d, 0xe66c9e292c3f6be5, 0x2ab84743989d504c }, { 0x3510e16a0ed1e7a0, 0x6f79f57ee09237ee, 0x2cc301d1c78f5ab2, 0x14322b310bd09f6f } },
+    { { 0x1f3c81090aca4893, 0xbf192958f62cc08d, 0xc0952f81320ddcad, 0x347eca719cb9bdd9 }, { 0x8c04d8101c463526, 0x1dcc16d4dc0b8cb9, 0x056003884c2fa030, 0x16b71d673b86df3d } },
+    { { 0x3119c53d5a15243a, 0x14723273e95e75f8, 0xc1be6cd92d83f8eb, 0x162f4a81716aa80a }, { 0x5f85e4a3d1a736b1, 0x1fee4d336fc1e6dc, 0x120cd5b6d1950cc8, 0x20fe8eb12ae3daf1 } },
+    { { 0xbc7c50d6597f5c02, 0x6faf139ce8c57177, 0x05e99cad1a804a10, 0x2144bb1e98f8279b }, { 0xbbd596e6f649dd23, 0x662c6e660bfc9b6f, 0x989ca2dcd637a0d6, 0x2a5d0c25c51a7982 } },
+    { { 0xa3e919c55a9c6e06, 0xa75b97eeef700826, 0x7652c5b3f682e1a7, 0x199c8bf186a7a481 }, { 0xa9d910694eac46db, 0xb5e862cf5c23d008, 0x18ede84c54329431, 0x08ea5b10fb7245ce } },
+    { { 0x34ff381a73568459, 0xb092a9c01091f690, 0x63f43e84d19b310d, 0x21c8c9d4593f9545 }, { 0xd79d90c37eff93d2, 0xbf07880caad34a83, 0x5bc96cd44950964e, 0x0604062f6f6629bc } },
+    { { 0x4e87f0c6c0883257, 0xfff3d4f051aa4b13, 0xcff57ba227c397c4, 0x05ec419732129888 }, { 0xd18d3687c2c6740b, 0x3c11f617d21bb5ee, 0x2e1de4e41fe3ec3b, 0x31d55754a0d0e0d8 } },
+    { { 0xae7e4986d9b78641, 0xd336526dd2050ebf, 0x0d16521dcca71c63, 0x2728ab21b672aeaf }, { 0x148f4d83144b4c2a, 0xa499dc89f1a8bfa3, 0x3ee34333bc8c96dd, 0x2346b951e45d9236 } },
+    { { 0xfcede7ce1862bf61, 0x051fb970384b9f30, 0x175703f2c117dc7a, 0x2a5b349e1b41d7bc }, { 0x9fc210a3befee59e, 0xe7e7bff0d5de59ee, 0x999387d56f6fa268, 0x2fc284bc7b7457c3 } },
+    { { 0x4164039543ca076a, 0x455a5d67aabac434, 0x92ea54f0d24ab06e, 0x240a5fd6fabd5b00 }, { 0x73b83a6f02ed5791, 0xf2bd6e993eb1ede4, 0x383ed15c4d9c3bd9, 0x133a2fd2c2a197db } },
+    { { 0x9234acac76f237e1, 0xb8b18c821512b466, 0x4864153568b6de84, 0x3ca412ba055057cd }, { 0xd43047eedd9910a1, 0x3465d08dfeee33d6, 0xc69dc57d60326444, 0x3902666b2394dffd } },
+  },
+  // 2^104 * g
+  {
+    { { 0x475c7bc729eeaff6, 0x2250d64279ae476b, 0x2f57ff5432af5865, 0x06ec4024b5a6b6d0 }, { 0x2cd88124d3846efd, 0xfb9943dcc6cc4e7a, 0x70340b206f50cdc4, 0x3eef3a0868a654b2 } },
+    { { 0x815bd24c56c93f3a, 0x2fe09bd214cfd906, 0x870b516663f5f2f7, 0x390f425effd72c22 }, { 0x80065a8fe024eecc, 0x54bec95906b2d461, 0x8f0a15d61555fd0b, 0x1dcce5ed3a5fe462 } },
+    { { 0x6ca01b6ef900ff93, 0xf42f356578b34422, 0x55a05c998c8f0eac, 0x361b4b3820aed115 }, { 0xf775a610064f29cb, 0x187b522233b29b23, 0xf5acad9e0b626d23, 0x2b5f3863fe9813d0 } },
+    { { 0xabc4a29d4c6cdcd7, 0xb9706fef9129142b, 0x5da18f0eae777a2e, 0x1e7410c6d1d13135 }, { 0xc4f76b0c7d861893, 0x1c022a1794ceec07, 0x663a27e196c2c957, 0x0e2c5ab12b5078fc } },
+    { { 0x41ae800b0f0b601c, 0x636c41bac8a2f95d, 0xd93bcbaec8ca44b7, 0x398c664ca3793f32 }, { 0xa9cf9a5ffbcea729, 0xdb278862fb48316d, 0x3f437ee073f36f97, 0x3a366e14bb07968b } },
+    { { 0xc00c9a53bc94ba9e, 0xf9e8584859efbb1d, 0xb614f1221801cfc3, 0x2cfade0d17d2fa41 }, { 0x9e0facd01f8d5f43, 0xaf68d1631115f032, 0xc700c7e15ca2bda2, 0x022bd19692330e15 } },
+    { { 0x4fe5bdb5f3d46416, 0x411247c68c641d2b, 0xd3aeb9e0728d4484, 0x33a73bfe546bde4e }, { 0x78a52d9657a0a987, 0xcced0cda4029cef8, 0x678d2d89c8733dd3, 0x26957ae971a6c1a7 } },
+    { { 0xfa168557099122b2, 0x6fa705ad4e4fda4d, 0xbdf0fac0a5b41199, 0x0c32267d3a62a0f2 }, { 0x3cff1bcd670392b1, 0x44507b9052888f1c, 0x66dae2c3a4f61fcd, 0x20912cd7b1be3f1d } },
+    { { 0x45c45025ba70a59b, 0x01ad14de4d7f0ad3, 0x1cfcef649e560de4, 0x39895205196f88c2 }, { 0xd05eeb8846c44148, 0xddca16cf600f08b9, 0xe2d5278ae6f33b20, 0x27a6827435d64d13 } },
+    { { 0xc63b2b9508a97562, 0x3e52180362a8b8fb, 0x7cd3a191f8977e40, 0x327b583356ca2c45 }, { 0xf437776e6fa95773, 0x07b83cabc6be55ba, 0x2b87fe60a447be0b, 0x2bf4fc0c43d104ef } },
+    { { 0xc8d5b82ca64b764f, 0xf71a70dc253d5a0f, 0x34ff5dc3bcb2fd5a, 0x0873436d1259079b }, { 0xe649a3af4ba3e48e, 0x1177e4da51624a2f, 0xc0a7bc77277d6511, 0x03c97c67d483e378 } },
+    { { 0x4f31bb4eba931fcd, 0x26df26b71e5fff31, 0xafb51b29a9098bad, 0x10c00c42914c8df0 }, { 0xca0813d8a94d0143, 0x51f9427379e2587d, 0x27e532c12c20e1b3, 0x23159f5a1dd5771e } },
+    { { 0xf148d7f85b3894d2, 0xb1afeb2a9be3e5cc, 0x4439281f62004b0b, 0x20ccb85297188778 }, { 0x1e96631922c1c359, 0x3a6982233361d1a7, 0xe5a57c6ef31fbab0, 0x3b4e586c75ed5b55 } },
+    { { 0x675b30f202999efa, 0x7b817f58e4f1805b, 0x317929cc294c5cf3, 0x3af55674bbc57a6a }, { 0x880d480dc03738e6, 0x9a3856c62fb4b38a, 0x6740d6f6b3eaedd0, 0x21578945142a6b99 } },
+    { { 0x9acb98d5bcf5e7e2, 0x04e692c6b44576af, 0x42a06eb579a159aa, 0x3a8ec8b502797fc2 }, { 0x3e7105eac628662f, 0x50b7548f2dff0105, 0x9ab47b3c8722fb42, 0x13fa6333ccd861f0 } },
+  },
+  // 2^108 * g
+  {
+    { { 0x3f3a75c49c27badd, 0x7a984994d1de2d67, 0x07001648a3379776, 0x321232d6e9e0be48 }, { 0xd130bc4e5e1b7939, 0xe0f8822f5e4cc6e2, 0x4634d0ab9f5f84e8, 0x0d87261605d7c173 } },
+    { { 0x6eb5ebfaf560a86d, 0x792c3e3db7bb4926, 0xa3fe77dc2e4c07e7, 0x28b746e393f8e714 }, { 0x8a3a23a7d2eaa7fd, 0xd21486fb168ce903, 0x317f944d11568dc0, 0x0f0bf39323a438ce } },
+    { { 0xc73f2ecda766fe3b, 0x2d33d21cdff3ecd4, 0xc11d58e88b8a3e16, 0x2fb17bd801a9e812 }, { 0xa0a5ba0357926cf2, 0x71eb335522c42790, 0xc8cb1007940f8ca5, 0x1572fe6326b755de } },
+    { { 0x2fd2a8dc71d9bef1, 0xcfd27d14075abfb6, 0x593024f8ba2d0f54, 0x1cfd3d8152665639 }, { 0x702228d1354dc190, 0xae8f48086372bb30, 0xa702b039beff39c1, 0x08072985d0b71667 } },
+    { { 0x77c66691efa1bed4, 0xa93e711851280a2d, 0x768fb54266896f69, 0x288f9fe5b55c30f4 }, { 0xa232f754ce353449, 0x1e3285b56b001f03, 0x0f6b12ab82a3bc1f, 0x06a84055ee3a17c9 } },
+    { { 0x1fbe83adb20b3ec3, 0x4207f54947d72bac, 0x053e0d3d6f64f5c3, 0x3d749e9f5cb9b1ac }, { 0xddb92d2f607dcd32, 0x72b559ad696a6f3a, 0x21b7283d2770b35d, 0x081df888ea91194d } },
+    { { 0xd92c2f80c2a3cc57, 0x360dec59cdf368f8, 0x6c947dbbe22a3b6e, 0x2bdafccaa23135cc }, { 0x4606d36de6f61da4, 0x5efa6bc82213aed0, 0x7afc5c4772f7f28b, 0x263dc0a204371a41 } },
+    { { 0xddac0ac714e7e7fc, 0x381ac071d5e77761, 0x38084e7a9db1ca69, 0x18d9a300a3cb6c05 }, { 0xf34d9bab3bd47b86, 0x0193596d20ed2c0a, 0x44e3adc0b6a76449, 0x3324121562ab3721 } },
+    { { 0x56a43d11c241e977, 0x7fda1037e5a175d2, 0x3bc220991f9052d2, 0x3ba7c3ec595718d1 }, { 0x6025dda69cf52d12, 0x077ddc0da7185518, 0x9f8255bf8c981107, 0x28c8947b56fcab3d } },
+    { { 0x6309a605441464f0, 0xf1c6eaa4ba09a76c, 0x25f32c69e8a624b8, 0x1dfebbb7679c4c3c }, { 0xd575b46a78c9a530, 0x465ce8fd2e81c82a, 0x236f7b5fe99efc7f, 0x2bf1ce39e5e20310 } },
+    { { 0x6ad888eb9369b14d, 0x6eb14f02232d9adc, 0x30bdde1614e1a7a8, 0x22ef07765d4ffd99 }, { 0x59712cdcb32bb47f, 0xf343441345887c54, 0x1f4217376d81c803, 0x3f4a3fc0146c42d7 } },
+    { { 0x4e21ffb9af9972fb, 0xe572dca4d84607df, 0x44423ad27e9718c8, 0x0572be7c0172f463 }, { 0xa6c93c401861f6e1, 0xf736bc08dd6e8240, 0xd8635451dc11c0e6, 0x382292acfae5ba02 } },
+    { { 0xfb7ce23d28bfaa5d, 0x4937a7eac06381df, 0x0d462355deb0953d, 0x2832809783da10c0 }, { 0xb00c5e01f9cd7c89, 0xc12e92bb2fc59d22, 0x5fda6a3ed18f4202, 0x0d7f34abbfd5d12a } },
+    { { 0x632ed3433634dec5, 0x3ea73afab5c1dcd7, 0x4cf1020d94bf0e9b, 0x15fb89822aa0b03b }, { 0xdaf72c899dee6f33, 0x89e42dfe1712c28e, 0x98cd908f626b25fe, 0x07e90e30ab88acdd } },
+    { { 0x8ac5b2070676099c, 0xa0217b495a7ff56d, 0xf882c76641085c07, 0x2303bdc88f2201af }, { 0x81aeba154b06032e, 0x93fa173e9025dc38, 0x5a20e106e9f8516c, 0x238b30a205dfb430 } },
+  },
+  // 2^112 * g
+  {
+    { { 0xa6b985f84b9ba44c, 0x558e77b7dd301dc3, 0x799c160a73b2306d, 0x1afe31e5abab2bb5 }, { 0x801862cb08c486e4, 0x87f82a000453cfec, 0x27aedb93d74cdad6, 0x3c5ebba61450ef7f } },
+    { { 0x526fcd3745328984, 0x68e5869f109978e8, 0x4396cf2365aeb088, 0x1bb95f9433e3f2db }, { 0xf19d543699b9cc1e, 0xc7d7fcfee3ef2dda, 0xfeb28fc629bfe76e, 0x216c89efa6ec6688 } },
+    { { 0x270f75d53ed3bc63, 0xb1d4c21b76cbc118, 0x22c145a0de59bbd5, 0x06c5b7040ec3bafd }, { 0x48cf3fc4bb92208b, 0xe8c1ec21d21e5f95, 0x4daec889c286d1fe, 0x21dd39671dd139f0 } },
+    { { 0x50623d23a1ce8aaa, 0xe8c2303520d08011, 0x82bc18bdb8cfa5ec, 0x0f48b60f1f77ff17 }, { 0xa14d01d6c9d49c28, 0x468ed98c7c916556, 0xe85d410f1ed41f82, 0x348f3484aa1c79a5 } },
+    { { 0x2dee87b5c4b07a1b, 0xed9101ec29669656, 0x4b126636e95e3775, 0x027f17d78b8bee5c }, { 0xe9590daec6208b9b, 0x0fa874acb3270084, 0xf8634a10b06c9ea5, 0x398323a9be1142fe } },
+    { { 0x9460d38c4db28ca8, 0x4c61ce0930b130c4, 0x7f5b5acf735f2eea, 0x3bf532ca47359fd2 }, { 0xe610b58ebe3b5472, 0x55c551971d38f896, 0x5e95c85f82f5605d, 0x27f46745c396a39d } },
+    { { 0x7145745cbcfad3e8, 0x842bac10d5ccbea1, 0xc36480be45e586e3, 0x3824e1e805f613ee }, { 0x56cdffdfdacbb151, 0x2a47a3d63ac22aa2, 0x26316503e050ec22, 0x0d3fc7fbc5f2a380 } },
+    { { 0x97c9a675f7206c99, 0xf5919e05fedbd32d, 0x1c0f489653f2639e, 0x1443f738b98a29e9 }, { 0xce502377a7ad0a22, 0xe7337a36719096e1, 0xd85cc05441e2bc9f, 0x0e31fc658605ca59 } },
+    { { 0xe275225ef52afadf, 0x11949e0ed6a80f6b, 0xc89fe1391e2a5591, 0x07b68b440950c368 }, { 0x1fd51a50361d310e, 0xf06597aa64f89153, 0x3ad89e2ccfb7408b, 0x3cc43208c7c1fa75 } },
+    { { 0x1bde4a15ae8d2ca5, 0xdf224e77ef6b39ba, 0x67597023b0ce228a, 0x0c297169620b9626 }, { 0x1d56c69a6172727a, 0x014d29f6e910ebcf, 0xd0ba01c3b8d58646, 0x329337bd65e60fe9 } },
+    { { 0x24e47f76043da911, 0xef5dce5ad7ec5a30, 0xeeab12db0a3b6148, 0x3a35a14c27b86f5d }, { 0xffd45f4c92b02628, 0xd74e4d8f15d12503, 0xba6adb585503fbb1, 0x2129c03e7bf2f08f } },
+    { { 0xfae7b0c0b4fff332, 0x858715b0d9c37740, 0x4baf7e12c3b2c8d1, 0x316b5be49a967c44 }, { 0x43b3a8c92c26f8a2, 0xa6343367b571f9c0, 0xf3f722355de56589, 0x18b89cb43712638d } },
+    { { 0xe68df211ac04fe81, 0x655846b302497499, 0x49c1b10a5ea83277, 0x00d9f4113de4768a }, { 0x80db21128a90fbd3, 0x490a7b6b7d0b7ad9, 0xe6ec4ab36b33c505, 0x19c71c1fcc4aada3 } },
+    { { 0x1e59e89d452b5dff, 0xe1e2b09d54876abe, 0xb3073b5d6c28c52a, 0x213d669787508944 }, { 0x3f4419bf08d9ccf0, 0x340c9ca6f2b69ccf, 0xf2308ecd0bdd6ba2, 0x0e0ae4c2a89402e5 } },
+    { { 0xc335f5380a16734f, 0x0e5c92f05dedd4a2, 0x73513eebfbf313a5, 0x187ec0ac2d1fcbd5 }, { 0xf5497ae9a2010f0b, 0xedb7fc03f467da77, 0xb4672d738a310385, 0x00fb24a9112b48cc } },
+  },
+  // 2^116 * g
+  {
+    { { 0x585afe91e0a86179, 0xd08a0cd374adfdc2, 0xaf37bdcce2164841, 0x0db3df9bb90b35b9 }, { 0xce384b8529917c67, 0x446387a2979f091f, 0xa59769871be98d1b, 0x25cb589f16a04449 } },
+    { { 0x07182dd9fdf61838, 0x066f834e444415a4, 0x4ed46b177e5a3b99, 0x28f553897639223e }, { 0xe1e777f685d0c3b7, 0x479640790163c013, 0xb75d8455fafc87a0, 0x05cee1aea9878f58 } },
+    { { 0x96f2d314c48b3419, 0xa8ec8aaab2b010eb, 0xd484c0d71389ab79, 0x3a7466d6fb865319 }, { 0xfdc98afee54b0ee6, 0x78811883b5cc6490, 0x702f6704e5e28dc3, 0x22ca4510b99112cb } },
+    { { 0xdd5bbd6bf331d5fa, 0xa66d42ed4ee30145, 0x79069fa6402bb4dd, 0x3d9b63cfcdb1626d }, { 0x91900090f45a0671, 0x3e1bab10d9a3e168, 0xf99c577e196dd4a8, 0x2506d2f6b196f673 } },
+    { { 0xb46d6ae4d7408052, 0x35ee034a94ff0bb4, 0x0bac02725637cc83, 0x3f37a6bb1727e1d2 }, { 0xc2826b263eba71bf, 0xf51b783a989a93a8, 0xb46e2e51651f5c46, 0x3242246deda7d302 } },
+    { { 0x8eaa1df6e7747b6a, 0x90481628471975cf, 0x2b819b7150661838, 0x20d62cc1efef02dc }, { 0x742a680d2c8c6155, 0x8c9d4d4c08cc3f5c, 0x11e8bbf92365de20, 0x3e527be1486783e1 } },
+    { { 0x76c7d8d9e37f8a68, 0x84dc45b4b8344fbd, 0x2e11643fa3cd3af2, 0x0edefbb95eda3573 }, { 0x170bd4fb3c8256c2, 0x81ed121c75f2583b, 0xcd5fa08be22f6e65, 0x2a88db95da11dd5f } },
+    { { 0x141ef6f9584106af, 0xf410c80a78620b62, 0x31da7e496005e092, 0x13f989959487ece8 }, { 0x12d4324fea911918, 0x1536671aa99f795e, 0x2217e38893782591, 0x2e6aa8bf32859d4e } },
+    { { 0xce0b2f0afd36fd7b, 0x24318a57f12527c8, 0x9365a81e1cc94f0a, 0x35bc2af42893bae9 }, { 0xef7f8d9344ad7313, 0x4dc3afb8b197f59f, 0xcea053daddec37f7, 0x2e03e68643aed2cb } },
+    { { 0x152fb007579295be, 0xdb2af3c2c58f42a9, 0x93c7d19546f59532, 0x2054ec9e7ee222ab }, { 0x04e6320a7b7f2f8e, 0xe429a647b46fab28, 0x184d9527a38ffc4d, 0x2bb3ecfb6f08481f } },
+    { { 0x63ceb1c33dca53d9, 0x1278b3531a30d1e4, 0x4e2272fa921ada2d, 0x09f14d3b115b7847 }, { 0xd9effdf17b697afe, 0xfdd4faf953a1ab9e, 0x6a865fa0d5051fc4, 0x104fd113a183efc1 } },
+    { { 0x8b692106341f4986, 0xbdd55a311f8ff4e4, 0xb57fe11cd596269d, 0x1e68c1612e0c81e8 }, { 0xcc61eaf4d19565a3, 0x569d69a5adb1bb00, 0x7ee9db0fc6c884f5, 0x09b64e4b1c59f5b9 } },
+    { { 0xb1ca1339037ee189, 0xf69f9c3d53b55614, 0x5e76ef4b4652c07a, 0x334995e39d8552ab }, { 0x03b60d25c253d561, 0xc124a0e8450e0945, 0x869280e05fef83a4, 0x1099de421b0dae94 } },
+    { { 0x576b0323f6ad4879, 0x6981d84ccd9142ff, 0x25283c12eac3ff5d, 0x1f0dff20761e350d }, { 0x7711896a7bcdad32, 0x78b152f3f8a27476, 0xf23cab488b02ee79, 0x0804428229243714 } },
+    { { 0x6db09aa2f8902468, 0x6de653d6f325f9b3, 0xb51853819943c110, 0x2eb2e33a6578588f }, { 0x322069b372ebeda5, 0x7636f1a1854ec7b1, 0x5f0c9e6de6bfc9f2, 0x3dd6738050537f27 } },
+  },
+  // 2^120 * g
+  {
+    { { 0xcd43face83e7046c, 0x7b03478ec29f014e, 0x40831b45d0254592, 0x0739a4847ce245b3 }, { 0x2a8d997402bc367c, 0xcce3c34f7aa73522, 0x0bf6f0c8b6b81e68, 0x04d86ebb0bb15f0f } },
+    { { 0x460b13cdd662f612, 0x59f82bf6e7c69eb3, 0x4680ac5c23858293, 0x374116d3445ff31f }, { 0xd620d78f1e8821e6, 0x204113f8429283d1, 0x7a6376d25a6a04e3, 0x04f7575fa85df3e8 } },
+    { { 0x006b5d1ec2042d41, 0x7e46aaf157412729, 0xa1233629d1e8efbc, 0x1cd2599334211302 }, { 0xeb9132ad9fb9e252, 0x2f53f5d28e434995, 0x5481f1865c19972b, 0x3e196aa6b983faf6 } },
+    { { 0xbe62207a0fe6b00c, 0xe8db71819543bb6e, 0x6abcf6b2b26218d8, 0x13e98e523d698fd5 }, { 0x32d73d8ceb3f05f4, 0x769ca83d21ab2cb9, 0x297a615fec9c4e5d, 0x0cea51fe2d085dbd } },
+    { { 0x48ee35a7cfb6b4f2, 0xf8c5118014232e0a, 0xae992c8bcac839e7, 0x3e8b36e290f8b824 }, { 0xc6e59f5c47d81ad0, 0x8838e97c78b7f289, 0x321ca4c550275b1d, 0x069594232d4d8740 } },
+    { { 0xd3fe5e72bd62145b, 0x5a31a274efed24f4, 0x617977f0336f9047, 0x1de61237f67374b8 }, { 0xf2e8a900a77e6cd8, 0x4c100c7378944a26, 0xa272d393427277d9, 0x0b3522477fdaa3bd } },
+    { { 0x6371bb5fe315159b, 0x1997ce104918f287, 0xeb791304fd7a4c97, 0x2c3ed2acc5a46569 }, { 0x3b3c4f5dd745da23, 0x4dad45748dfee8d5, 0xc1dad17f71ee6be3, 0x03676b8d4402e3f5 } },
+    { { 0xa53f2367c4194e15, 0x1488e9a0043bcf46, 0xd24585464e6c0f55, 0x0e641fdd42d1d602 }, { 0xd5fa660305d3ef86, 0xbe832ad8d7481314, 0x8ff26a070d27c7b7, 0x366aa40173a113f2 } },
+    { { 0x4c4d0b31ce9b5633, 0x4edf17e3c487648a, 0x6e39d1c85bd90cac, 0x0f232a452ae01db0 }, { 0x3bcc35dfcff3cdee, 0xbe4b3d8c127e58f1, 0x49954e3363feee78, 0x098335dca8688a73 } },
+    { { 0x14a78284140cbf96, 0xcb1a7400b16bf976, 0x456fecd49aa782c0, 0x0b3bdc830be5a528 }, { 0x0883db78937dbfe2, 0x4d8728637ee16f2a, 0x8aad29dec5966781, 0x2e17dbfb460fb4b5 } },
+    { { 0x9af09739b53c060b, 0xc8e4547e82c3b573, 0x1f3574294e6c224e, 0x38fa672f319df3e0 }, { 0xdfc7701ea965f61d, 0xe2f2ccc851afef2b, 0xb100624f8b167a9b, 0x3a0d12793009ef97 } },
+    { { 0x264b4dff5aaed2f4, 0xef38b0185d020d19, 0x2fa3714b3fa6e68d, 0x04753c165d1af6e6 }, { 0x5788b31253bd2704, 0x4dca1f2d5d013c91, 0x3306325c30ac6909, 0x027c58a461e4edd3 } },
+    { { 0x9f595e6ba27cb060, 0xd59e40bd27f2536e, 0xe4c03cc038ec45c8, 0x1d885ec761b12572 }, { 0xdd7f8e79c9fa762e, 0x9b38d051777a1455, 0x12f799dbaacb346e, 0x2f317214a9d394f4 } },
+    { { 0x93b0bea139e69012, 0xf9e1ef8afffba31e, 0x7b6b5a3926833bc5, 0x0dcdba9a99775ea0 }, { 0xd63b754f6af35d09, 0x69db609b5b1ca62f, 0xa914dc1cf6b7f379, 0x226ae1468b088de2 } },
+    { { 0x83b5d82e93e1c850, 0x0ebc8a82e8332520, 0xb204da39409ba9f9, 0x0363682014cf8025 }, { 0x6c710d1533f1ce95, 0xcce8cf34a89e0bbf, 0x0a5e3f2f8188c5ef, 0x3c05dd6d055396d9 } },
+  },
+  // 2^124 * g
+  {
+    { { 0x17f3a3b646f43d3f, 0x306d48af6ea6368b, 0x14138fafe22bd4f3, 0x311cbd53f3692540 }, { 0x9212e91712a22f63, 0xdf4596099ec0b415, 0x08033a7a7e16745b, 0x2ac9c81f97caf04c } },
+    { { 0x5302a0330d2976cc, 0x6bc1ff2dacb7097c, 0x52a4a4bcbdff6a36, 0x1e8ab1d947e71452 }, { 0x0fe60758aeb2a450, 0x6aa05fc5f5c6c0a2, 0x7b7a7ba7b1cfb96a, 0x2c8bb4642e7ece24 } },
+    { { 0x04fdb7dfffcb62f9, 0x862a1b6cbd2c5abe, 0x113976b20333f8ba, 0x010b3111c30ffd35 }, { 0x542b04fc57320c6d, 0xe7b556f584858bbb, 0x05a4670e707cfe60, 0x23394104c07e3a72 } },
+    { { 0x2abc09eae52ed3c1, 0x2ac9d63f0081e3c1, 0x7bebed9d73c97389, 0x02390ca98cf0f446 }, { 0x4b377e2c9df7853d, 0x3e012ea98f790997, 0xf0578669c12c720d, 0x078bc6395483a5f2 } },
+    { { 0xd9e259de2646d3d0, 0xa92e87e566db6619, 0x7bafde267220f791, 0x360abed7ea9fe007 }, { 0x1e299b14b763c005, 0x31c00867fc392366, 0x0c8cbff1de677dea, 0x1b319630edcff7a5 } },
+    { { 0xd495db9f6dd9b993, 0xaffa6f93c38abc53, 0x8bd1c0f89afe789c, 0x00f1b3aacf17e768 }, { 0x9aa55e82e33cbdd1, 0xd24548bc01c4d2ef, 0x5c2acc4d98b79765, 0x29f2187f9d63b360 } },
+    { { 0x8ba88935c6ecd25d, 0x9c57ad30887ab735, 0xab693efa9c69a927, 0x30014f59900bff3c }, { 0x4ea9a153532506a3, 0x3ca4733159e86ebf, 0xdba224c1aba47fef, 0x10f5c9ee815ef9fb } },
+    { { 0xcc999bb3313ac26c, 0x69b121de7f20c10c, 0x7b66cfca48e0a3f0, 0x2ae6920ab16d4f8e }, { 0x976fc873e8e793ce, 0x2bca156bfff1d6d6, 0x1363388a6b97f824, 0x33810a143b8c909c } },
+    { { 0x820b8084e3b08aa4, 0xb19735b6f82e4056, 0x01ed5f2f538168f8, 0x28837359f9405764 }, { 0x87c0cf34702c14bb, 0xeb50086000632820, 0x3b6d965e4011135e, 0x3bbbdda0aa67849c } },
+    { { 0x19468247c40dceac, 0xfc628ca6707840f6, 0x10c3527bde220ce5, 0x18cfe5258f52dbea }, { 0xb30c9e2d178931f8, 0xfbe5f6a26eceb04d, 0x457dc36395ccc9be, 0x33d1f6ed0a72e89f } },
+    { { 0x915d20d3a41b9222, 0x869a694cec5deb43, 0xf5e504800d33f86c, 0x1dc8a65b70a39b62 }, { 0xcf24357410c838e2, 0xffa313b7a6bb7972, 0x5e8a4939d614d461, 0x3d8ba56f360c275c } },
+    { { 0xb9184d1b06a94ef7, 0x721aaf7544ab1a45, 0x4f9c19db0ce6770d, 0x3de5c21ab97a14f4 }, { 0x614fdc1a70c16497, 0xcf3878a0117d0af1, 0xe44affcf16d922d5, 0x1aaa7d0c7fba7639 } },
+    { { 0xc5766ea8d484e875, 0xb6bfa9f4f3006d00, 0xa7151f00b6ccd149, 0x30e9fac288778e68 }, { 0xe77a7145ecfab21e, 0x892b8cb1c28fbc3e, 0x5a2a8f237065d696, 0x33d685ec7b90ff4b } },
+    { { 0x07f2f335264ecef4, 0x67e2c064b3559ea3, 0xfb8fdb918630870c, 0x32e4ee28fb0242e9 }, { 0xad15063917b1aad0, 0xe546d6cf2e910aed, 0xc7fa3fa496293bab, 0x1921c48e19ba98c8 } },
+    { { 0x5a4f46666ef66a9c, 0xafa47fad880af1ab, 0x07288271454a0553, 0x38cb8e3930044eeb }, { 0xe91e921d6a88288a, 0xb43752c6d6c142df, 0x8ddf89b4c994e6e6, 0x3caf6b42edc9711b } },
+  },
+  // 2^128 * g
+  {
+    { { 0x6f151a89b363135a, 0x1d21718614519620, 0x32825b77b8ac503c, 0x1c8b5c8d561a9d75 }, { 0xb161e3182cb81e9f, 0xa3d01fe9ee651f57, 0xdf9557f0fc34015e, 0x067a2b851a861c46 } },
+    { { 0x518a4e6f1305fc53, 0x7a104885d4cebd57, 0x35872ee399d702ee, 0x06d598b4f60a2862 }, { 0xc0003c908310e899, 0x3118e365c11842ae, 0x51f3b8380399bf53, 0x39b0c06255717345 } },
+    { { 0xe6a69d4c5ec932b7, 0x3647e2349490ea97, 0x4b26a1aa31a20f46, 0x31ae806f22426d8b }, { 0xb25602f8a4d7d6a1, 0x5a391fdcf478e2af, 0x06f63d63a8371d1f, 0x12bf3d1f4bcabc03 } },
+    { { 0x39bbfdbe763300e7, 0xe7239af422de8407, 0xff559ee60857ba54, 0x37a08dd4bded9abf }, { 0xc1c29ada3b9e5c59, 0xbe39dbc6315f1f7c, 0x966c1137067c2634, 0x301375d69bfb38d6 } },
+    { { 0xfd56df62564de18d, 0xa7f70b73c0a09f8f, 0x0bffee3a1425eb91, 0x13cebade340188dc }, { 0x4f0a14d2a3637079, 0xf7f7ae0d8315d5d5, 0xd843d28200b58cc4, 0x2389239b83650fad } },
+    { { 0x26d85d9bb1f7ec62, 0xb7be4f237435239a, 0xc74c61ba4016b01e, 0x30b141f350ecb485 }, { 0x42b5225d67b64dd1, 0x3380236c03b3f375, 0xc44a75ce86401039, 0x1b793fd02ce823c2 } },
+    { { 0xf6ee57be993b2f7b, 0x418985bba4935b22, 0x6f9bd2e8356e66c6, 0x1bccde783686328a }, { 0xba3796195eec3def, 0x2ae45ad16db509ad, 0x4efe76fcda485f7a, 0x1b209cfa32d40c82 } },
+    { { 0x0e4021e806cb0007, 0xfddd3709a5c6b5d8, 0xb8c0dec069ae7d99, 0x3a4bb596833de524 }, { 0xbf0fb357d64b15e0, 0x9f789beb3f815439, 0x0d1f1b61beb058fc, 0x1323121c34b6ffd5 } },
+    { { 0x141e956949043850, 0x8f6d5a18314404ab, 0xcd2d5d2cd26a9c18, 0x1228b0e9f3d7badb }, { 0xaae69030c7423ab0, 0xeb0a1f05c4fc7040, 0x5af2971c5d412b0f, 0x1b11feb561f2122c } },
+    { { 0x20b5835e34c39c7e, 0xb07e2f39fb4918e0, 0xc9e571634f7c1a07, 0x30af34c744a643ef }, { 0xb9abd942974f9275, 0xcd478d538576be63, 0x5797e45fd54e7f2a, 0x17b629bf92c1eaad } },
+    { { 0x01c278756b44f4a4, 0x862db238496c77ab, 0x8b5a5771f0815515, 0x2ca9ef5b1d18ca3e }, { 0x24f6e84e8a3da71a, 0x9bdb0633e4600fe7, 0x8c61ca8f11700058, 0x3d9253034800e875 } },
+    { { 0x3cac2fcb7e560b85, 0x8906ad09e2b841ef, 0xa87198f300b61478, 0x1b489b33979ce486 }, { 0x78fea007eeb6c3fc, 0xb320c701d1c58ad0, 0x33d162a7d83fb851, 0x1792cd9c88133b34 } },
+    { { 0xec885e7a76dcef10, 0x95b9266673fe9f4b, 0xfdf3c1b22f0fa2bc, 0x1a3d5e95c5b1aec3 }, { 0x680a551b799eb963, 0x3c600aa0fc302cdf, 0x3f71f5783e75f04c, 0x23be8e6dbb45e906 } },
+    { { 0x0f29489ef1d014eb, 0xde67abef2943c04d, 0xdb25568e24e6d888, 0x385ae368002af39a }, { 0x43a3465256f27450, 0x1a906f5f876f8b39, 0xdab78cf356147bb5, 0x2b257e910bc46eb8 } },
+    { { 0x843922c2f45a32a5, 0x985ee9a7153e1992, 0x7c6b32efd689b032, 0x34326e323a654f87 }, { 0xb3c1a2f25842ed21, 0x6af5328a354b2ef9, 0xbfea580eb65f7226, 0x36c1ef403e1e7b0a } },
+  },
+  // 2^132 * g
+  {
+    { { 0x4e407c2a99ebea31, 0x01fa826b796e55e0, 0xcd3abbe31053def1, 0x1462a85c6a8f768f }, { 0x2deaa917c823eade, 0xd9b0f107649fc209, 0x11646ff5af6ac2cd, 0x2fddc3392e665deb } },
+    { { 0x726185adc18dc08f, 0xc799e09356f6cf60, 0xc85dd6146ece1893, 0x093d07bd995b9f0d }, { 0x7e60c23ea1316390, 0xba1850baadad12d4, 0xee7a3344429b9b9b, 0x2d55c0f16a096a28 } },
+    { { 0x7cfd8a36aecc3a44, 0xf7fc3de23a7a537d, 0xa466d702754ff74d, 0x09e3560780cf5ae1 }, { 0x6c2e60b7adc6a8f5, 0xd5df1d464a2a1a98, 0x68851b068da7186a, 0x2fd3b4f91634fad7 } },
+    { { 0x418d8f1dd552f5a9, 0xe1a95e0b080d875f, 0x7d81f24d5174df01, 0x177e959ff7254f64 }, { 0xd4bd42f5ee646bcc, 0xb126afd0867487cc, 0x775ac2483bad7a18, 0x2d301709e0b28d99 } },
+    { { 0xbcd4d0dd9b9077b8, 0x34702eebaeb7a224, 0xa36d6d7d9d46a893, 0x23b065ceafde413c }, { 0x145dc02487a4563f, 0xffc1a539eb9ab424, 0x8ada226f7bb2d293, 0x35c985f4fc829ff8 } },
+    { { 0x34ec2eba065cfa0d, 0xdb4f817be63c811a, 0x4ea49591583ab31a, 0x20baa49bf52bb383 }, { 0xb0a0401a3493c480, 0x0a5850751f10bb44, 0x38b94a53fad3beb8, 0x3b75723c1415e261 } },
+    { { 0xf5fb16ac5a67660f, 0x7e2278b8988d0255, 0x10aa1635e1bd94f6, 0x354d1e52ea484cb0 }, { 0x9aedb6144b973755, 0x23735ff85f152712, 0x4d4a1e557e65d81a, 0x1d5de232a57ad07d } },
+    { { 0xb8ddd921e4651b59, 0x0d16a42b41dab845, 0xf517f12a79f559ac, 0x06548bf1e6143337 }, { 0xdd88519ab35c1d65, 0x8946dbb52845244f, 0x258be89f7fa8328b, 0x1ec7adec36918f74 } },
+    { { 0xf852ac5af505f98f, 0x3ebb9a709124c639, 0x208130c7436df495, 0x2758e033fe0e75a0 }, { 0xeaedfd65ed2c9114, 0xd8982324e30888ae, 0x16453fbb92ff7af6, 0x3830164ad6735fc9 } },
+    { { 0xd8ef8aaa2455d9ef, 0xf27a1d2034abf9fe, 0x6ad539b2ca6f7cb6, 0x329d1db1a9f7e0a7 }, { 0x5a4388502e73db3a, 0x2392f602a9918b4b, 0x4a2d16831167fe48, 0x14ab282327bcfb6f } },
+    { { 0xe522678632cb4de5, 0x5bfc38dc6364da42, 0xd167d7298ec3b832, 0x2824b4c668db5eec }, { 0x9ab4c49ba7fec34a, 0x91fa861de73a086c, 0x41fc8786ed9ccfa9, 0x111eda20e177496e } },
+    { { 0x626862873c54b74f, 0xa99e6e8163de14eb, 0x469eaf6dc11f6270, 0x1817244d7c67c5b4 }, { 0xca2dbd34180f09f7, 0x4bc44b2c5fae4b7e, 0x296fe45d29d94922, 0x38a773fd6fdc8206 } },
+    { { 0xbafbeac0063bd8bf, 0xb75bba65d43c80bd, 0xb37ce41eb9cd1a00, 0x0a475b71d3570a39 }, { 0xe1067e36582892e5, 0x5dd4867360af993a, 0x949ea4045f73831e, 0x270f7d69c3ab84fa } },
+    { { 0x67e27fd85aabc447, 0x7684a1b224f2310f, 0x2d233a6a456c670b, 0x152653c8bc3bf2ff }, { 0x134fea3991b5a52f, 0x4b9f0d34dce062c0, 0xb9d013eb7f14f97f, 0x3c310db578d3dcac } },
+    { { 0x92b2ace6164f37d8, 0x6978346e7dc8e389, 0xcd5750c7b2478254, 0x2cc0a2a9a600a5cd }, { 0x416428be030a3254, 0x707b6530f5083867, 0x9fa3cb158bbc3c67, 0x3b9b72069c93af7e } },
+  },
+  // 2^136 * g
+  {
+    { { 0x63940829b00d0565, 0x1a00086708b47081, 0x2e06fce06e780776, 0x18d07f4130eb90c6 }, { 0x8801bd8db3f3da1e, 0xf249461e0a4d519e, 0x84ef3e2d5650ed25, 0x08aac05a0ae072ae } },
+    { { 0x7d2beb87f6b17754, 0x1e0303224e7e6778, 0x066c6fce1cf78700, 0x07ef0b9aa87d6a2a }, { 0x75de3ed2cc2dbc15, 0x42aab015d23d78b2, 0x422b7dd165a99934, 0x1442866228a68f9e } },
+    { { 0x1a1a879697270f4d, 0xabfda518e3f0b5e8, 0x517189fb1533a824, 0x1ddd65e075bc5db8 }, { 0xd79ee1e3d86ff266, 0x0f9be180f6540666, 0x16386a9f3316aa70, 0x35ec7ec32a87bd0d } },
+    { { 0x6966de95ea7945e7, 0xa5ca03396f625ee4, 0x43bf1a20a820fae5, 0x3a1f06d3f40978e5 }, { 0x2579b0e8e3d5a8cf, 0xc8d4c68eb9302280, 0x9769653c74689658, 0x2ec98f8a0a27acfb } },
+    { { 0xa2ac02019a3ab911, 0x4eee2a704be7a65a, 0x69bf6c213a33c74e, 0x2b586505643be052 }, { 0xf51d98a118d2051d, 0x98328933163c262b, 0xc1f858218c92851e, 0x15df6828812699e2 } },
+    { { 0xf71035baaa9f084b, 0xd8e1252fd085f867, 0xe4b79dbd62aec22a, 0x0acf2f47a7920dfc }, { 0xff1bc5cdefac6064, 0x023009fef14a18da, 0x386dc1a3364f843e, 0x2c27f596370dbeee } },
+    { { 0x7a97fa1d84ba9207, 0xa9e907f23bd22aae, 0x23261d5b95e32845, 0x1c2b73fb49898947 }, { 0xfd895f3407941318, 0x2c772456928a4705, 0xad8a6d029df362bf, 0x19d6c48cc66d5f2f } },
+    { { 0xbd3578f2413d3a50, 0x88263cb5fe671492, 0x31f56008e4d705f0, 0x11f7b52ef04fde57 }, { 0x855a221e9d5a3f68, 0x8440caf5d7574db3, 0xba136058f990f856, 0x0954f00e0e0eb70f } },
+    { { 0x855ccb75ca782478, 0x6ae0be1ac4ec4744, 0x0debd9f9a143a541, 0x121164164bcc212f }, { 0x8ee2ab16a5b34d76, 0x6fc3b20fced718fc, 0x94c6d5247a2d945a, 0x042d4cca81a81ce0 } },
+    { { 0x9e800dc3ecceab83, 0x5dc1ea384aedffbd, 0xa50896eec0396f73, 0x1545a41e5174f2e5 }, { 0x92c37bb35922e5ba, 0x1e2c58202ec5023e, 0xd7ee10a828fe9752, 0x311d6a4f58a90012 } },
+    { { 0x01036c979f03d860, 0x761df7f107bd69b3, 0x688be63298d2dc4e, 0x2a54bb4180f87cc2 }, { 0x72a64f6ffbf84f3b, 0x7f3737c9d79d3513, 0xedc7fe125bfb6338, 0x1bbe98d698190fdb } },
+    { { 0x0503a60109250dbd, 0xcaabc108589c1d96, 0x8cd85ca47980ba60, 0x24d921b3f92eb243 }, { 0xcbfcb47ddb2715f6, 0x5a1e1a3ae147f688, 0x5e24085a576a649e, 0x0eae7bc9b9672f42 } },
+    { { 0xcd12690518b33610, 0x7a6516c9bf38715e, 0x1d7c88f1e3b01c7c, 0x0c0c19cb12797b32 }, { 0x8edec1eb63980276, 0x97bebf0c82f47b51, 0x38d20574ba685295, 0x281a19c9d9b89084 } },
+    { { 0x89e4a5d88d7cc942, 0x48fc148eb7c5578c, 0x5c73f6696b25330e, 0x3865c1c2da7d0b33 }, { 0x947273738e831f65, 0x4f8d4c268f50e8ac, 0xf27054f98f22f67b, 0x23fd908b9040200e } },
+    { { 0x013d7d85cd405d01, 0x6cd3c39b6c0aa502, 0x3e167d1092f42853, 0x34097186ebca4328 }, { 0x646b8f47b14518c1, 0x1bd0edcf4383f432, 0x2b68572a89f6ab08, 0x184f213520298113 } },
+  },
+  // 2^140 * g
+  {
+    { { 0x87e6aab86e368943, 0x58c6a5a773d4ea07, 0xbbe04e7c1b417b6b, 0x39f9619834866960 }, { 0x0f4c71d9e3a55851, 0x228a373e0e9dc971, 0x81d94a7ed57ef891, 0x109f28fccc775436 } },
+    { { 0x447b09018d8aadf5, 0x2979e5b249bb9e99, 0xa16d703dfa193f47, 0x06ab12ff6035ef20 }, { 0xcb8ed13119e912b6, 0x7f5f074552fb209f, 0x1703e00d0be0297c, 0x19f75489a78b794b } },
+    { { 0xd366f4edec209572, 0x1e132eed3255b040, 0x342a83758531cf3d, 0x2d8c21691626e7ba }, { 0x98026137b93207ec, 0xee4628fc16e2b34b, 0xbd82bfa3930c8aba, 0x1d2ac74572fa5acf } },
+    { { 0x98ec3d9180964451, 0x97c329f47ea46809, 0x94bf01ee312eea2e, 0x0bcae453dd5b5117 }, { 0x6483a1df54f1ac7e, 0x5c1f9141468b207b, 0x31cd5a6a8dd1911f, 0x3b5ef3376b4bd564 } },
+    { { 0xc337359ff736f2b8, 0x1ffbf0a596680c9b, 0xeaf5284f974e0031, 0x3767cfb2e48b58aa }, { 0xe51bb382057e25e6, 0xc0456f35a40d4fe9, 0xfda1cddfbf9ba922, 0x13f39a5a451a92b5 } },
+    { { 0xb090192c49e4f011, 0x0c66fddc274ca228, 0xcdf5df8e29bd78ae, 0x0c08aa549585bef3 }, { 0x67e97a2857c364c7, 0x05b91e728de30b3b, 0xdede51063a414ec0, 0x1c37b5efb827a461 } },
+    { { 0xcf83a58300e3acc2, 0xefcf0056e6b06d68, 0x23a0c1c9ceee1069, 0x2e66f7d9f989b6aa }, { 0xb3fe9b48b19ebd0a, 0x41bdd88ca6c0b017, 0xa9b38c697c39fb35, 0x2c8f784687296ad0 } },
+    { { 0x9c87321adbc1ee2f, 0x09d840f7a9d2fb2b, 0xa5de80359e2e22f4, 0x086ca3aa77d22fb2 }, { 0x871a4fe004ee4c69, 0xba96de4136f683f7, 0x6edd419fd95303d1, 0x3ec45a5a0763914e } },
+    { { 0xd705d14df59f5c49, 0x334a968507e4b909, 0xcdcf7ea694e16694, 0x33c17131d27bd972 }, { 0x5da3d45cc6aad557, 0x932f975ae2ad35f5, 0xfaeeb29c2c1e468c, 0x27e620d648dfdc7c } },
+    { { 0xad4398b456c21fad, 0x35c3ad392c6aebdc, 0xe8c87595dd6b45d0, 0x31b0f4dfe76e31d0 }, { 0x15e8390af0b2adcd, 0x8d8f327d7164e02e, 0xb3896cb78632a637, 0x0c84f0c3ffee1ee8 } },
+    { { 0xba795d26472538fa, 0x93f30017e52af210, 0xac8af135ea118de1, 0x37e01e90dff52809 }, { 0x90cd81f4d3f43510, 0x19006aa57592d0ad, 0xe41cee4de0d902b9, 0x0158ee25aa74abf0 } },
+    { { 0xcbb6eb78406ac8ac, 0xda412d256021597b, 0xfca274189731e330, 0x0adbda828f85e4e8 }, { 0xbb4ebbcd3341c8d1, 0x5ad419e23fdafade, 0xd37388bebaef6592, 0x21a7cbb97d9f3b23 } },
+    { { 0x9e8a877aca91f3c7, 0xea869a34480ab0c2, 0xd354b5a27058e54b, 0x1b769727edaa197d }, { 0xeb30c9bec87ed8c6, 0xceb7668eb27f0920, 0x5f6f41fab6439a40, 0x284b47031308693a } },
+    { { 0x23fdfed425216db4, 0x22ac7ee10f1d5919, 0x4e4ac5c28905e30c, 0x0b3393828324bffd }, { 0x4f596378fa9d82ce, 0x6f2da8643ec24c42, 0xccc6ef24b037ad1b, 0x30df48866530ec71 } },
+    { { 0x121152d6c6150cba, 0xc45f67d3fb419244, 0xf9dd02bfa78a22b2, 0x3ad1241e360016e1 }, { 0x43c22a0ceffaa137, 0xf24c7bca89c000f7, 0xf45ddec50792ea95, 0x087d734779fe7b3b } },
+  },
+  // 2^144 * g
+  {
+    { { 0xcfb40dfb06679dc3, 0x9a609f07746b7723, 0xd0857e2a167c52c5, 0x07ed63834535a6f0 }, { 0xfa9f657d7e2eee30, 0x4c0d0df19ff5d4cf, 0xac6c5029eeff0f71, 0x0dd08db7521ae88b } },
+    { { 0xc76baa295dc94539, 0xe97702ca58fbe6ae, 0x75252c044219a1f1, 0x1a08386ac144cdc9 }, { 0x08ffbd892dab7c7a, 0xa301c48769835536, 0x0ddc8c81d94fafbf, 0x0f13427d5c94acc4 } },
+    { { 0x2f38c81ecde5aa48, 0xcdcde19a4d10252e, 0x0caa1469ea54d4e3, 0x0a600867702abc26 }, { 0x46d52e8183af4cbd, 0xe5c64a75fe325de8, 0xc22a29c14e64528c, 0x071eccde8ed517c2 } },
+    { { 0xc5a8339f03ce270f, 0xc59c90ed839c1daf, 0x397ced663601e3a4, 0x111c41690dff576a }, { 0x68f65e4ac19f4e61, 0x643f7368624f8bb9, 0x1cdbc56a71b8db99, 0x267a7e7ab263d94a } },
+    { { 0xc1739d9a83cd350e, 0xf87ef8a2e2f3ac5e, 0xa963229f13e62f2a, 0x3b822a9fb3370ae7 }, { 0x1f8321080eff91c2, 0xa868125a4d5b8627, 0x9217d118601e3a10, 0x108f504e2bac4935 } },
+    { { 0x140ea60ac819e7e9, 0xbb83337106cc4a6e, 0xb1c2ed3083447be7, 0x142545b66d772ec3 }, { 0xa68ea32756322466, 0x6469f3659b69ec4b, 0x5b5179dab744e0cb, 0x313c5b3357d8df91 } },
+    { { 0xe359d086797d0135, 0x1669d9c40996b751, 0x095e0d66089a47ef, 0x3e61dac6afbc5bdf }, { 0x5fbaad0b1d7c8e4e, 0x4d59431181759236, 0xc98b55de389f7c14, 0x1b3640db482fff48 } },
+    { { 0x193fa751554f93ca, 0x7dc0a4e1b69fe583, 0x12de79d37fa12493, 0x361957aa307563a4 }, { 0x57bb024e11a3c98e, 0xbdb4e1b4e1ee51d4, 0xe4dc02d50aba1c60, 0x2c4778dd8e29b53c } },
+    { { 0x725dc5f8c75379b4, 0xd853601cb8bf7570, 0x9cda22246ff6ad0b, 0x0a5a453cc580cb20 }, { 0xd4c193adf794c9b3, 0x944198ccf8db6128, 0x36e97af4d35e426f, 0x0789e0222778f234 } },
+    { { 0x5fc8b051c6eb04ae, 0x052293444482be66, 0x0fc7953c8e4507fe, 0x09279372e330adf2 }, { 0xf6bef20062034ce0, 0xea655ed97a2c4c90, 0x8198b742b3e0f179, 0x0c857837349138cc } },
+    { { 0x570dd5ade80b5786, 0x18ae7bf9556aa444, 0xfc5a3519c835450a, 0x37cea8b33d92ed91 }, { 0xfdbf68e747d10b10, 0xfedc2b1f8999f881, 0x550f87d097586790, 0x1830c1288e9b1716 } },
+    { { 0x5f8a0e47c98e4673, 0x98a19ec43443f409, 0x688d1257e111068b, 0x1367457b674aafff }, { 0x1682657cbbb8ecc4, 0x6973a8aeaa7335a6, 0xa70d2b1e10944074, 0x142949921afc3b94 } },
+    { { 0xb46fb213229ec7df, 0x3439a7b277825d7c, 0xa7e5c6046bf0bdd6, 0x30ce16e27ed11492 }, { 0x714c74a1cbd9220b, 0xa3d3a3210e384cbf, 0xfe03a15f4890bd41, 0x2e996c3cbe2f0568 } },
+    { { 0x07375b316eabb65c, 0xa0cd4c996463ab83, 0xdf0e9d2a47f64650, 0x2986a4caa7197dd7 }, { 0xe9af9ebb313ea56f, 0x32b1b6d238f3e8fa, 0xa5d8404331eede26, 0x376267b2cfc8e49b } },
+    { { 0x008b6ca3b09518fb, 0xaefe4879b91bc2b6, 0xbedee7a7173acfba, 0x0dab2c5838ebe07c }, { 0x981cdf41b2fb46a2, 0xcbfaec9c3e667e6c, 0x7fe54efc88177bec, 0x0f51acd8c73302f9 } },
+  },
+  // 2^148 * g
+  {
+    { { 0x5ca7617a94a93bd6, 0xd188fc7d1b9d24a8, 0xfa841e176f2da33c, 0x2e6437e44472f20d }, { 0xd79ca34ad09c8e5b, 0x3b28caa7cba27c6e, 0xc57b295b39af67a1, 0x3bf0c63975ca6c2f } },
+    { { 0xba9027f6a88ac7d8, 0xfb47953d5d41aaa8, 0x6886becbd8a904eb, 0x05ce7822630f979a }, { 0x7c6a655025595cb4, 0xc1e1d4ef9198488a, 0x6591e034ff2a38e0, 0x2646aed3049b984c } },
+    { { 0xdcb5da25e76bd8bf, 0x82c6346cff058928, 0x05a956c674a4cfa9, 0x2c12199fccfc7e14 }, { 0x065aeee74c4c29f6, 0x54b7d909c063b742, 0xc53c4a72dafc8886, 0x362d1c3dec1df78a } },
+    { { 0x7877f685bb6a2d63, 0xec1d4726923c25ea, 0xe9a7e0f8e0e278c7, 0x3007b6ff45a4823a }, { 0x7b29b1f7ee9cbf6c, 0x7a9f7781fb672709, 0x4023db69b7d3697c, 0x3ebcf0b40ff25eec } },
+    { { 0x887220176cd1dd77, 0x962606f12bb88b5b, 0x9f34a27b0ca7ee76, 0x3c50132567c2ef6c }, { 0xc0e366596a945c61, 0xdb6ea8a34775e23b, 0xf08c3371f6e60d32, 0x022c957b4fcd7820 } },
+    { { 0xc32bb7bbab1dca06, 0x763b790d3fb51d2a, 0x5300f6930c2724e0, 0x3eabccc44f236113 }, { 0xf3541d7d40b2c75b, 0xfca545964d201cf5, 0x8e26592deac2e386, 0x1dfdf372d5d61ccd } },
+    { { 0xf7d7fac03601f303, 0x9402504f423b1e79, 0xa0fd180a8b1820ff, 0x2f5095ab653a35e6 }, { 0x08ff46c511b2a83c, 0xb1c7a8e207eca902, 0xc384b36e09ec0cd7, 0x3498c61f5731dddc } },
+    { { 0xbd930432c409f7f8, 0x300db6934d3dab10, 0xb88b201c897ef47f, 0x2e30ca2d4f2e995a }, { 0xf556d701cecec2b4, 0xef86b12ac6beec9c, 0x9bb3bd40020f4772, 0x19a25089328db800 } },
+    { { 0x4faf535f293abe02, 0x9c5f194c6c6ad6d0, 0xe89fc37690c8a0d5, 0x311e5c0752bba137 }, { 0x04db860c21bf22eb, 0xea5809b75bb8d6a9, 0x8b103bfeaa22b022, 0x0050be8c699c8e87 } },
+    { { 0x35f692fb08352b56, 0x09e48de436a35290, 0x6a618e1a95817566, 0x041a6434fad254c9 }, { 0xd26fb3641974e9dc, 0x1a720beefc2b7e6c, 0xb48607a815607acd, 0x0bb1f0fdb93d3b36 } },
+    { { 0x7b5f84fd43799b3a, 0x767f112eb1faf7d9, 0xde1d70cdf9e03c4a, 0x170d318e1d30d8e6 }, { 0x17c0a5d1ab025a21, 0x2a8dedb867ac59e2, 0xfdb6fb0d10565e5b, 0x1b0172a9ef06433e } },
+    { { 0x5e8ec3397a8ed498, 0xf5f6dfcba10dd2bb, 0xe4a078dd2729b6a4, 0x0303ba275aff7291 }, { 0x849bf0074195df04, 0x0f8ddb96c645af77, 0xd794bbf374f3216c, 0x255dbaef04b808d3 } },
+    { { 0xa8e41183b1aa890d, 0xd2eb71ff2b2be6cc, 0x759fb15da661e9c0, 0x0b9b8cd6217cd930 }, { 0x3a0dfda9cedbc4fb, 0xb39f4648621087e6, 0xbbacdb7206a891b0, 0x3d93511487311ff5 } },
+    { { 0x4737862cda53a5b8, 0x8e5906bde6ad29b5, 0x83eef6d075ae2083, 0x172ae0655a3d0e62 }, { 0xa87676cfceff9252, 0xbc2839979f4bb1f3, 0x0837868d19924b2d, 0x2684eb4dfc757c96 } },
+    { { 0x3327ee48030a6f2a, 0x37757abb322fd181, 0x2721fdf93ff7da3f, 0x1d8222ce1470678c }, { 0x1bf369fcff39b10c, 0x3f2a1c677e784d57, 0x82f614130eb3f641, 0x0d171ba92da7e2b1 } },
+  },
+  // 2^152 * g
+  {
+    { { 0xbf8692930fca98aa, 0xa66bccf8e3ffd989, 0xcfb4ccc93e443696, 0x1310ccc855acdd96 }, { 0xf6124bbae99a617f, 0x7b552601969e8d78, 0x8ceebfb7351b70fd, 0x0e0d4a14e815948d } },
+    { { 0x854acf499db06db9, 0x6494f918f3532345, 0xacdfefb5fc6388b3, 0x2fcace2e54c2a099 }, { 0x32f6aa5600b07c32, 0xaa0967a3cf4c9c99, 0x347e9010121171fd, 0x111607246c670a38 } },
+    { { 0x3f7457f20cd8e75f, 0x1f27ac52865a4583, 0x3466176c67035ef0, 0x3edcf12f2885c5c0 }, { 0x770250f10e7f2d88, 0x6470c50d2d64c3cc, 0x6d78c7b1b1845172, 0x1fdb90d14d8d1c5f } },
+    { { 0x0c9fe1670e8ad852, 0x6a4cf814d9fe4e92, 0x619dbd63567cb97d, 0x188732fee717f200 }, { 0x64c48d7b62a91401, 0xc1aaf153e824aab7, 0x553bb7657f956491, 0x0a313bd19a1025c7 } },
+    { { 0x9a5522ed9ad223c4, 0xadc0ddf097881a31, 0x5637439c55cd79fa, 0x00cd2e0dad1d9c13 }, { 0x52dae1cec28d8dc7, 0x9c0a76bf72687bc2, 0x48b30bc54befc4c0, 0x13db23a1023c88a6 } },
+    { { 0x843cd988e6e59d43, 0x763270c7472c767b, 0x7ed3e9a2e1a1b37e, 0x25f62340352df773 }, { 0xaec4b5b6d9793482, 0x6fcff9e2b282aedb, 0xc8de410b95ac07d1, 0x3ffe258e1fa3a6c3 } },
+    { { 0xaf9292240f2a300d, 0x096e930df77eee8d, 0x8c6e0113a8c1e659, 0x0ca6815b4fbffe0d }, { 0xfb57bf2539a0b45c, 0x0e1c1674df8e500d, 0x1c21d1724b5283bd, 0x2444b4959e1d3380 } },
+    { { 0x3eb24e04704fa8c7, 0xe3de6acd5f3a4b9a, 0x783dd1c8e9510590, 0x1be8a32fa04b364a }, { 0x97d9a16532116391, 0x110e233ba10f6817, 0xf583ff70be06fb77, 0x2413ad76ffee918d } },
+    { { 0x90e32139e5f7eaaa, 0xf2f71b30e1229b52, 0x5906e0bc1c3888f6, 0x32d4c352681ddf9a }, { 0x95ca452fb7e1dbd6, 0x91d1ae0c271d5fe8, 0xc15cb13bcc89ece5, 0x05194f53db7d0cc7 } },
+    { { 0x7949b6f3544a4741, 0x2823a082b106fd5d, 0x29ec4b743f899f55, 0x00df4ba83a098542 }, { 0x807b999152c8973d, 0x1358a36f61b33a7e, 0x410192d6deea4e7f, 0x218dd75b56c49d79 } },
+    { { 0xc1e65c21a08aa355, 0x0e25285acbdc259e, 0x788d27272044db44, 0x3d16ebe7d9eb33a2 }, { 0x6d4d8d79bfba0f6a, 0x88844fedb864eaac, 0xd2e72de0c95d89f7, 0x103cfc226e45a47d } },
+    { { 0xdc7cf4b7b9ad0bdb, 0x63bc44f90ebb646d, 0xd7a466b086d30197, 0x292e7a6df7f7e502 }, { 0x6f8ca7b990ec477c, 0x024bae4f40062fcc, 0x34a1895464de11ae, 0x2a47c66d47cd1174 } },
+    { { 0xecf2f7398dc5426c, 0x9c44962e62394048, 0x14399411231e0035, 0x073ffefdf3cd5a0b }, { 0x11448f6e730feada, 0xe384cb7036d394b1, 0xd402eee7247b3da4, 0x012fe9a0fea4b6e9 } },
+    { { 0x0f205e48b478c1c2, 0x59071c4993bcc7f0, 0x930ea60be187af15, 0x24061e6431551cf5 }, { 0x2a74af2f7282597e, 0x5373a193b03ab6a3, 0xd3c94f9558dfc387, 0x215ea22fa8276cf4 } },
+    { { 0xb544a07c94674f74, 0xdf611847978ab036, 0xb1151cea84b69ae7, 0x0581fc70592f34b5 }, { 0x16c60ee79dcc42dd, 0xcdcf8a4b73725895, 0xce41307361013623, 0x015bb88f92a2082e } },
+  },
+  // 2^156 * g
+  {
+    { { 0x25020b17024057cd, 0xc05002e2e28df223, 0xfdf5b92eb5b8ff19, 0x25f3e63b145f780e }, { 0x81f9d93211adc40d, 0x00f93afa9ffc205b, 0x700cb7c49b309ade, 0x29c506c6fc92fd43 } },
+    { { 0x39d3a8dc04376af3, 0x4c078eb17eefde40, 0xe92d6386de3a6566, 0x049f69ed00a3a9ef }, { 0x7f9ce1f2401536b2, 0x2c807a79145841d3, 0x50ef7b99661a2e4d, 0x2ad1e427e09839e1 } },
+    { { 0x92176eeb86bca3ef, 0x9ef261564012744b, 0x0e8f5fe0a1b1c70b, 0x1f41196c2c0885ff }, { 0x2dc49316cb7747c4, 0xf59b297b05807e38, 0x3bb55f1750c097d2, 0x04c410abc64cf2b8 } },
+    { { 0x22823c3b4de727bb, 0xd426da0259f9d54a, 0x19499984e3db5989, 0x1fa64cd06d43eff1 }, { 0x1c54cc8dcffa47a6, 0x0f88b0365d6c91b0, 0x100ac543e90e0ef1, 0x27cea286e6fac7bd } },
+    { { 0xcadd3c4fe17d36e6, 0xbf49e1a87b68e826, 0xb3b4249a08acb865, 0x0d9012fec337b7fc }, { 0xd98926a8a028b59e, 0xebcc8377af61de20, 0x3bed78cfbee631da, 0x1c323e61dbf18f61 } },
+    { { 0x1ea840ca329fdcd2, 0xedb8ec8ee8a0a96a, 0xab1cf083a176030e, 0x1a0c3fd7248bcaca }, { 0x677bd76b23fcd06f, 0x4f767cc9cc9b53e2, 0x7e6d950f299f3bfe, 0x04f53f336c7776c0 } },
+    { { 0xe64d5d7d5434b8d9, 0xeb5e5ec0f8e99ffa, 0x5166e9f4d92f3757, 0x0bed74de4ad15908 }, { 0x38e2e1df831d2a32, 0x055b714d6bb9208b, 0xa92f8f43fa88e4f6, 0x03ba79666c8f6edb } },
+    { { 0x9e7ae8e5473ffb34, 0xb0ed350d7ce584fd, 0x18d7f924826e99c4, 0x165ae87b4886c15f }, { 0x026ac3ba3fd4bebc, 0x64eb1bbe0d497b1e, 0xe098e58e743beb8e, 0x0925f07786aa6e57 } },
+    { { 0x35f9e1ed4ccaa755, 0xdced4087c31979d7, 0x620df0f02af708c1, 0x3df9d48c7e17a66a }, { 0x555922d02dbbb34f, 0xf311bddf16e070a5, 0x30a112a28509c21a, 0x3a13aa4a8c971fb7 } },
+    { { 0x18805b522f0635e8, 0x68e321f4bc6f4e15, 0xf56bbe7bdf734505, 0x3a836512f69db9ab }, { 0x531a7c8bd6e8ee8f, 0x20aa7df2c734d20a, 0x67c396442ba7ef63, 0x33ab7088ff787984 } },
+    { { 0xdee168a1fb6c31c4, 0x7795c2ceddaa261c, 0x9fc453f1139f7a28, 0x3e2e8091b6ca72c1 }, { 0x6c78d261b3ca411b, 0x0013a3180100f9ac, 0x245109dee277948c, 0x190ee4a3d64909b8 } },
+    { { 0x1d1ca6796eb7a774, 0x7ea3b3fad79ec9bd, 0x4c20dde928009528, 0x0d48eb17b75f9ecb }, { 0x9a19be1c077eaa36, 0x94b8d8bb17ec91f4, 0x4db78d060a6d3ce6, 0x3ecca8d5ee8d2c88 } },
+    { { 0x9f32de9d9a8c1dc2, 0x7b34e04c9b32b6bb, 0x5bd07e5236b3dad3, 0x11c3af5cf3925cde }, { 0xf615f444ba8b63ae, 0x23e86c630a1808f5, 0x3b6db1e4bfe83dc3, 0x3874132e95ff814f } },
+    { { 0x3554fd9e2a6adcd9, 0xf6f846e0cd37fcb6, 0x9849ab69b34f2739, 0x377060e2eb652ae7 }, { 0xf05f133a7a12a96a, 0xbde09712f79d637a, 0x0f91fc0ea10db320, 0x30a2ec33ad31a7c2 } },
+    { { 0x67de6198f1a681c7, 0xa8449745f92d3c6f, 0x7dde2ade7b905100, 0x0ad758a9650d5ef4 }, { 0x2ebbaced9f3f1d9d, 0x696b949790dfaaa3, 0x864bc31bcf8b361f, 0x3ee4da07af1ec44a } },
+  },
+  // 2^160 * g
+  {
+    { { 0xd925cca1350b46d9, 0x12396f787b08f72c, 0xc4f2603f76371905, 0x365435e17783b009 }, { 0x063a9c4b15a112f3, 0x41b7e03de76b23cd, 0x2ee0cc5ba576f474, 0x0079b0c450e1e617 } },
+    { { 0xa0511046e4d17b17, 0x2bcd7823284ce92e, 0x1b01b0236a96c6da, 0x06ec9aabeb868e77 }, { 0x259869084245dbda, 0xb3b0fc6f8f9d2c35, 0xd300429d8c02ba66, 0x2e7386c0704d2462 } },
+    { { 0x8db64fa8a525eea6, 0xecb56516f5ecc115, 0xf516c7089cf3ed79, 0x1cbbe296e5e8e435 }, { 0x8bf75d1724ae6f2b, 0xc2b381fab7c0d440, 0x3beb875fa8f19207, 0x347e37f0c7243b1d } },
+    { { 0x74e819d6cb474861, 0x47cc990bc8c92931, 0xf67652674631f3ec, 0x3cf3ca22ba122b1d }, { 0xdc017065c1092a55, 0x0b5ee6ae08873161, 0x63e546c47b09a3b9, 0x0ffc4894b258d8cf } },
+    { { 0x74147f8378017cdf, 0xd53cb9d6742fbf17, 0xf20cac0b6a24202a, 0x1ab4185334192120 }, { 0x78278e3611861eec, 0x302e4034c6c02402, 0xc3e8442e0e70a34a, 0x0bc5224c723ae120 } },
+    { { 0x56d959ccb941abf9, 0xab8b95f6a5301dbc, 0x0f034c0d31e519a2, 0x354e05f727ccdf96 }, { 0x4c1e84829cf6f6e5, 0x22918d3aad234c65, 0x184baf08d6d3f9b1, 0x2d2752ffb2f8cf15 } },
+    { { 0x787b7c0d553d6df7, 0x232d2f59a4017f56, 0x7896bb954cacac83, 0x3fb3836c79426661 }, { 0x5d65f69e08d17fdd, 0x767072925bd58285, 0xbfff819c8671b712, 0x085f608d4aed1906 } },
+    { { 0xe79203e9589374b9, 0xf74d5c5fab2be203, 0x9615b5d1e211d910, 0x3bc0acbe31d74923 }, { 0x7653085bb53967c2, 0xcddad50bbf98368f, 0x43803c4de7e2c663, 0x2e7caf925c4fb633 } },
+    { { 0x3d7f45a5bf90085a, 0xedc2aa5d84ee2045, 0xe0cd00f25ceb2f8a, 0x3b54a52a44a52f09 }, { 0xf2b7232a03f285f4, 0x80d6f64484f8c854, 0xbd92e83888f47fd8, 0x36153d8799440d7c } },
+    { { 0x5186371e64e99481, 0x970544674597522f, 0xbd5198fbe5d0ce48, 0x3762f7c6525b680e }, { 0x869cde80c5b3bad2, 0x933ce43881b7e179, 0xe2bcc94b8ea24d30, 0x0e430b08293c73c5 } },
+    { { 0x84574843bb1cee8c, 0x351662e28d376bcc, 0x094b87630a9c4dd6, 0x33d25743283b04e3 }, { 0x51af18ef9f8d6528, 0x79cc34756174a166, 0xa75cd7b8e7c224a4, 0x2f4cdec0d008a3ad } },
+    { { 0x62bdb79a886f7b6a, 0x2ae3c961b5ce6d6f, 0x4ee183c78ef85088, 0x3153d8802b776c8c }, { 0xe513e3c2f1152826, 0x6d20e29f9f9360c3, 0xf59f2d8d63127a84, 0x3d4f78ce9efe83f0 } },
+    { { 0x7f827ccac93f3a4f, 0x0e6ccc124fb76842, 0xce1907a9be3113ff, 0x079c24295f97f0a7 }, { 0xff0aac0f28d6fd4a, 0xafdb4d087895ab91, 0x288b7bb52af06df0, 0x20c016ebe3b3bf1b } },
+    { { 0x967638ad0cc9b666, 0x52b4135df2ef4ea7, 0xe41a213f8b4224b7, 0x3c8d034c8a9c8583 }, { 0xae31c836e7e9f3ec, 0x3b19d648e64c1e22, 0xa2443de6200efea1, 0x1a106a24cdfe2d2a } },
+    { { 0x9e5fa7e098aa7e9c, 0xf4c8c60dbe41c2c3, 0x834782cbc151a723, 0x165ee03ee3e24253 }, { 0x4180c7d35ff2efd0, 0xcc5bc3961047875c, 0x0ee8d0c00ad5512a, 0x0dd9139d76b0f7cf } },
+  },
+  // 2^164 * g
+  {
+    { { 0x5016d4e5acf44ca9, 0x7fed89b8808ddc2e, 0xff70025fed9edc7c, 0x315653ab1fcb89ed }, { 0xb672156880e3bcce, 0x6fd87727a33cd8aa, 0xa10db646fa084def, 0x17176ac048e832f9 } },
+    { { 0x673e4febd8ec2a3e, 0x0c2beb121aac0c7f, 0xccb1c2e5037b7cbe, 0x0716a6a607f0ad95 }, { 0xdcffe0e5ecc25304, 0x34f7ad755f611a17, 0xc14709982722eed9, 0x3dc150b8a5dc1f3c } },
+    { { 0x9167cebcf519f00a, 0xca96377cefd29651, 0xf6a4f959a1f92146, 0x0b5e05e3dfc0e6be }, { 0x16bad2883fef4b80, 0xf5f669271caa858b, 0x503364958e99036e, 0x0d17b174d96d6833 } },
+    { { 0x032630ab91f2d886, 0xb3c04d6823d56621, 0x55ee79726b1abf19, 0x2dd31b56f3f28624 }, { 0xb5216979e9ddac93, 0x6a86ad36185ccc48, 0xd22411ea9a554508, 0x2e33910e3411588d } },
+    { { 0x1593742526b3807c, 0xae401668aac27656, 0xac1cebd1d865e1af, 0x22d3eb3010f24dae }, { 0x9509c750b9b17bf8, 0x3803ec010aff0131, 0x07add5c092bc229c, 0x3c77c01cde6af0be } },
+    { { 0x73488a2c3ef14604, 0xc38849d6b64429ec, 0x3677737b50c962a4, 0x2c3b2cd8c883b51c }, { 0x569e0f9151ae2d18, 0x07c51005d6451ea2, 0x952bab08a5226181, 0x11813e37d0bb979b } },
+    { { 0xa891e94ccd35a1e1, 0x88e3bb7176c8e40b, 0x55c6608a5676fa62, 0x1d78450fb947c7c5 }, { 0xdeed0abe6266a83a, 0xd495ed0b0295a8a1, 0xaf4d5f29fd98d0e0, 0x1856641a997bb9dd } },
+    { { 0xa8934719a7e14d72, 0x0b045a142c7ec3ab, 0xc0f38abaa3e8e7a4, 0x3debfa29d55afdd9 }, { 0xaa457d15d16b1f27, 0x2369fead992b0a7d, 0xbeb86cd48c4322ad, 0x240fd0e8da3d3385 } },
+    { { 0x97525595e3ceace9, 0x3d7c187de78c9a4f, 0x4ba9058d4d62c0c8, 0x373285e9cd78c79d }, { 0x20c2ac4945fc2081, 0x31daf7306799bce8, 0x69f54ff394ba8ce7, 0x1e57cb26168efc46 } },
+    { { 0x6e401092c55b3540, 0xb4f7eb1e2f093acb, 0x82156f9aa888ac73, 0x1753fa4b47c9b868 }, { 0xf08dca5cf4cad48e, 0x4f185ff405176a84, 0x24d50c1476e1c4b4, 0x3bd9ccd157882b4d } },
+    { { 0x125998fe11433f32, 0xa595987cc617a791, 0x472c7a0a7f53bd60, 0x19c5e792a536eb52 }, { 0x9acfb74e57dbede7, 0x70f225153b471bc0, 0xa0c9894dde4782b5, 0x364cce8c2c8fa984 } },
+    { { 0x16fb90caa9a8f037, 0xc9219bd00fa1e636, 0x4681a5b67893d8e5, 0x0f02761100d99527 }, { 0x16e5acb4437759ec, 0xf5f4c6a9e01347a9, 0xdc50309874319991, 0x17249b4a949db251 } },
+    { { 0x2a42c585ba39d951, 0x48c078124c6d8f54, 0x048789704af2ba82, 0x3cb8eebd64a465f7 }, { 0x3f356de159a77b51, 0xd1fc5cfd6a4a155b, 0x80effec043b60c8d, 0x2a409f0a0227ea59 } },
+    { { 0x77eef556dbe5cc38, 0x65195c70a64a56b9, 0x14482e9d2df8f1f4, 0x035332b738b37ec9 }, { 0x4cf59ac89b2fd5f0, 0x651252000c9fe1ef, 0xa1364953905ed574, 0x0c21a75c33a88ae0 } },
+    { { 0x92a03193674c746c, 0x7bc17da74b5abe7f, 0xcbe5c93f31e30e3b, 0x3c82b027d5b50535 }, { 0x7419fb75c220b25b, 0xe63f597e81fd073e, 0x09398708679fe4db, 0x0b6418e2ef4645b9 } },
+  },
+  // 2^168 * g
+  {
+    { { 0x9e12742302c4fd9d, 0x9e668be27f8d4857, 0xd8e5a5752de92af7, 0x337b787154d86caa }, { 0xee0075ce990780d3, 0xe90faa534f4c8eab, 0x15cea41eab603516, 0x059cca3941afa806 } },
+    { { 0x1f982d5098d88b09, 0xa8f8806780fe6613, 0xfba2aae945c0bb3e, 0x1074ef4157cca4e6 }, { 0x866103975b620348, 0xf512f2f8741f5227, 0x61cdf4065e9d7af9, 0x230e5f7608915751 } },
+    { { 0x791667b18dde31b6, 0x0eb7f42ce9c70d4c, 0xa57b9b08de42b001, 0x355573b1cfd36128 }, { 0x173ebd0b616201ba, 0x3059f100568ffc87, 0x96e6473493c47bc4, 0x28c6b6fbab85bc3f } },
+    { { 0x2bf9025c909a65be, 0x5fe6fc1712af9bef, 0x7964906f2b25751f, 0x32b197c50a81c0c5 }, { 0x6845abdaf381fece, 0x9391f9af70eb9b1e, 0x178c698cde83d6fb, 0x05639e126850e5c6 } },
+    { { 0x9c4b081d590272ae, 0x738493a7ebc9b59b, 0x175af366932be885, 0x28ced023a1360316 }, { 0xeee4296e1c099760, 0x42d2db886d787e0f, 0xd6c88f4a3e16c96e, 0x23e277d298fddd94 } },
+    { { 0x74113900e2d13728, 0x2143c6f0dc7b4784, 0x1b9e81bcce30cae0, 0x22beae432371502c }, { 0xbc0e2f6cc32aefcb, 0x8b510c407736192d, 0x1608715ff948aae9, 0x2c6f410f605f699b } },
+    { { 0x4afd233d510a15b4, 0x07a1ea03325da628, 0x4662b1072e9289c1, 0x16d96a487840ae38 }, { 0x6603e055f39f1415, 0xeee9500e004a2a53, 0x4b58861c9369b277, 0x295129dd1be29394 } },
+    { { 0xf360bbe351527ec1, 0x482372c0cae8ed55, 0x26eb7cb83ed72b6d, 0x2018d017adf0109d }, { 0x11754f25f56341ae, 0x1460b7d0e83e84ed, 0xf34492970485bed7, 0x067f6955e99fc3b1 } },
+    { { 0xee0bcd2fb1fd91be, 0xc9a3a6031e274f22, 0x008a85b026320869, 0x0890ead04e7b6078 }, { 0x08ee26e9ea6cc96c, 0xf32477943c09721e, 0x58aa0402d21c20ef, 0x1600cb7e7a5b7d1c } },
+    { { 0xb8978e00e80a4b85, 0xe2331991ef6bd7e9, 0xb0fbbd66c33425e7, 0x1742b2f4e8ff7bdf }, { 0x5b1a528f420ebd72, 0xbd4c0e13befe5816, 0x2cdde5711d7dfeae, 0x1d336a08fe1f2c89 } },
+    { { 0xef0d70c0c17c8574, 0xe74d29c1b239bf71, 0x2c95073dc5abb4aa, 0x14008660272df64c }, { 0x08caa7a959075455, 0xcc2896b5181cfe78, 0x3ea336d63549595a, 0x2dca77a4582ea45b } },
+    { { 0x9866cd7f240d6835, 0xce072e8fefd6c792, 0x59bda9fb1195c143, 0x1c894bed7aca8360 }, { 0x9f6738861eed1afe, 0x50695b7d4c624894, 0x97f338134e79d1ac, 0x3f884b0fe69298be } },
+    { { 0xc2a00a4d380fdda6, 0x3f09417e8a9f0b5e, 0x7845550d7fba3490, 0x2af12784fd1fc69f }, { 0xdb205aefc2cfdd7a, 0x26e7ffd867fc4cbd, 0x39ec056ca283689b, 0x2688c875b030d2b1 } },
+    { { 0xaa5bba200bd3c64d, 0x6f675e59b456009f, 0x4779b5eea430e1e7, 0x25bbca199dc7ac66 }, { 0xf4c471ebedfde859, 0x9b1441b7369fa913, 0x119cd5b14e3abde6, 0x3373dfc67ed3aa3d } },
+    { { 0xe647bc67a867f11f, 0xb72c92067ffa193e, 0xe295667d1617699c, 0x394455cd0966cdc7 }, { 0xd980a567d7252d81, 0xf78420741d11b109, 0xf48ed46b32ab0dea, 0x1eeff1c2aa393a57 } },
+  },
+  // 2^172 * g
+  {
+    { { 0x8bcebf54e27b54a8, 0x48d55ae41d8645e3, 0x97be22ee0ed322f2, 0x349764687ff54b5e }, { 0x4c686a0a079c4597, 0xe125422acae0354b, 0x46381684d918a467, 0x19b83cb3a707d1ef } },
+    { { 0x38d3c5987581b315, 0x3e7658d3339413e4, 0x37cc8db957f91f96, 0x3f3eb2e9dfa2a503 }, { 0x97a2ac7705c8782a, 0x3bf11c1331b3ce71, 0xa3123ca535e2a200, 0x311f562b2fab91f0 } },
+    { { 0xb0114ec504ecd696, 0x69e8c5a21ecf41cf, 0x6ad57faa82989ba1, 0x11095535d87c8e32 }, { 0x9679eedeca5760de, 0x826e1d5d9b0cf120, 0x82746257b5e23c74, 0x181bc43654fa172e } },
+    { { 0x0239d10712a70e9b, 0x40481e82c89991fb, 0x3b5a96e2a970cd51, 0x02aff0918bf1bb43 }, { 0xb571df286b936c2b, 0x1fc93cf31e743149, 0x7cd615bbb24a9711, 0x26da3b237c649e5c } },
+    { { 0xa68fe3e6304b132e, 0x9428c0ef2d72e7f6, 0xb1e14989caa9d1e1, 0x266cf7c82611a773 }, { 0xdad38edb2f4f8587, 0x5cc9c12cfc478499, 0x3e995aae314197c2, 0x0b4356ca422d02bd } },
+    { { 0xa84b3fc22d451be4, 0xf9368559f54ef4e9, 0x53f47950f0184d48, 0x36237bd171aefee1 }, { 0xf0e67b3e501b0e97, 0x92230789237be129, 0x334084fcbd3f8e2c, 0x2296bd64ab45e50b } },
+    { { 0x0cad27dd05d60c61, 0x788168d5c1222c8d, 0x403acab615348f2b, 0x1621d6a76a7349b9 }, { 0x47f7f3714d3149e8, 0x76db7faff5e4c395, 0xd210b15cb3f24232, 0x3c9978bf4a36d277 } },
+    { { 0xfd43f7bbdcdd54fa, 0x8e4342529a1c0d59, 0x3eb7402cd7ed5ea2, 0x22c7560064c6aeec }, { 0x6e266659ae814180, 0x3a95f0c41acd12fd, 0x3ca6e78a71cb98dc, 0x3e57cd7d4a802e1c } },
+    { { 0xc355c2d2ca0b05d5, 0x8d749121f0c4cf19, 0x69cd3bdc3df56fcb, 0x1d1f63f0e167036f }, { 0xfd10b351031c10bc, 0xc513187bd2fa51aa, 0x8fa1dc4a941efc83, 0x25bbbc742e790179 } },
+    { { 0x137a92feaf74c263, 0x3ce226e43f1c079d, 0x974c50857c0c85fa, 0x08611b32f1718c88 }, { 0xd08f68d461a93a8d, 0xcb4a3a3149dac6a6, 0x3199d887d0e0e7c8, 0x1c8fae2baf8d1935 } },
+    { { 0xe4abcf63860e26b3, 0xb769ad411abf3d6d, 0xad24e849580b05a0, 0x316c347d8e8f0e77 }, { 0xa52ff83af80ba197, 0x23319b64d76c85de, 0x82071180dac9099a, 0x22f31b5fb29e09a0 } },
+    { { 0xa84aae2b67b4aa76, 0x49d20e526b05e18c, 0xbcd72d96c8877543, 0x18b7bfdc7e1127dc }, { 0x448f74c73e24f40e, 0xa22c4749e3f32c42, 0xb6211ed3b6155e71, 0x10c28aa5d780f813 } },
+    { { 0x5dc702ba8373bc2d, 0xfc758d7703af3d26, 0xe276ed3495c3266a, 0x306497fff6bb3c43 }, { 0xbac83c34f92d295a, 0x4e96883a3b06ec44, 0xf9960b2478d740bd, 0x0787f71dac98b561 } },
+    { { 0x0aaa204e55419964, 0x408ece333e992ac6, 0xf39802f659d74bbe, 0x38fc9110ded6015b }, { 0xc1f1f0eebd663584, 0x21c5dba33f1919c0, 0x6b61abf1369ff8e2, 0x15b581dbb979d1a9 } },
+    { { 0xfdef77c14688df3f, 0x4845fe796fa9e89d, 0x0db7993f091996a3, 0x1dcdc4a1c6ac685b }, { 0x2ea99ca52042cfa1, 0x44e5da4bccce98a9, 0xb81b2f48fb3b8970, 0x387617bc90817f1a } },
+  },
+  // 2^176 * g
+  {
+    { { 0xda096673de1b6bf8, 0x31b16ea1dd71af93, 0xd0248817e9ecb7c7, 0x29f086c3db35e8c4 }, { 0x69c883938aa0d885, 0xa3f184ae470fa8d8, 0x68bf584ea72fb3b6, 0x0325d9b735c805b4 } },
+    { { 0x959f0a4e2d440fd0, 0x1ea5af4aa20470bc, 0xd293e6bf1bdc5eb8, 0x2ddd33695d9985ca }, { 0xe13cfff57d8fa2b9, 0xad9ec37b525fb758, 0x7814640f7b5edb3d, 0x0fe6b715e3895810 } },
+    { { 0xfba4ef91b467f3c6, 0x8b09f7ea1315734f, 0x7b447e7bef1b66f3, 0x26e485fa007afd20 }, { 0x8b9ae582c5498b80, 0xb017bb229aef0f26, 0x17308a0acca4295f, 0x0022f491857a88da } },
+    { { 0x10797244eac1a32c, 0x0578d59e08a44a17, 0x4a07e2b511f10a23, 0x0942212571c88fcf }, { 0x18d2823ca2d7ce4e, 0x9e83a038a646f80c, 0xebc63ce3042e7512, 0x1e5e2e5100b474d5 } },
+    { { 0x7eb618edbc22f453, 0x68a658b7413124da, 0xea7346b7e9162aa7, 0x349bd57d74a88d68 }, { 0xd6777b9d79865684, 0x581721df03213aec, 0xdbd31fd96313b0e4, 0x14ffcf757f77b345 } },
+    { { 0x162ad677c75e8b41, 0xc0540bbc649faa0f, 0x66ab73e3c616ac85, 0x3fc78c4fadee7322 }, { 0xd2d16a5e9dea5ee8, 0x8b5e1361a9fa4228, 0x513760e82072653d, 0x3a640dc67d90e6c7 } },
+    { { 0xe028055413e9e54d, 0x0f002f5f62c07a0f, 0xce7bcec8f21bfee7, 0x1127902203423889 }, { 0x70df36f932fb95e3, 0x628de0e2121fb551, 0xbf9455730d160a04, 0x146a18130f9f0566 } },
+    { { 0x94bd5fe231f7427d, 0x4c57e2a504181458, 0x1cd6dcc2858e4950, 0x36619c636434298f }, { 0x7066748eff5f8e11, 0x280f05dc5ad2b374, 0xb4e07ccc790dfb7c, 0x066443076f882c5e } },
+    { { 0x8cdfcc832f64de5f, 0xe6b59445dc6ba357, 0x8aa9c731558d00cc, 0x0f31fa6a1a2051e8 }, { 0x5890bc1c436da779, 0xf92ca00f41231408, 0x51a1615928b6dafd, 0x3bfbc2114c97cb38 } },
+    { { 0x6748e2423dfccb91, 0x9bd68e1f6899dd75, 0x75ef292ba8a1c9f2, 0x10fe915d7d1869a7 }, { 0x93ea6fa167fcf73d, 0x1ac1724bc81cc7d0, 0x04c9434670df687c, 0x24e2f0428b62962e } },
+    { { 0xd5b4a78e647aa533, 0xc4c86eff9bc6ca4e, 0x0f9e788a51311145, 0x318f68786658d26e }, { 0x0c8172180b1d3bd6, 0xdab7df68b65add84, 0x41acbafd8258c7ac, 0x08d6ab998c3341a8 } },
+    { { 0x091165cc7519a378, 0x21231ac6ea830489, 0x80eb8758e7308ca2, 0x3738347b85d2125b }, { 0x8af6da3ba46799f5, 0x11eb3d64a77e9cc7, 0xd3dc545bb8129358, 0x34246723267b246a } },
+    { { 0x5562504eeec0a3cf, 0x5e266b264bf77f35, 0xc05180d0362db194, 0x3410cd288844b190 }, { 0x9d41ad99cee14202, 0xd744143b6ef3f93c, 0x71132d802d272bb8, 0x012ef627bb5aee4f } },
+    { { 0x46ed6ac7f1afd464, 0x952e52f7318ce708, 0x4791299726bbe609, 0x34ced1e16fc10035 }, { 0x0bec79edb17f55a3, 0x63fdcbf4be41e4bd, 0xf83bbccdcd856ac0, 0x2cb6e2af6fbd8641 } },
+    { { 0x383eb183f20440cf, 0xad339eb4f3ef98a2, 0x65094c053b766e40, 0x3546157dc277cffe }, { 0x36fc7ee6c018db28, 0xec2c3304b79c9e46, 0xa79543fbdc4f88df, 0x2bf7c94c5d6a6e69 } },
+  },
+  // 2^180 * g
+  {
+    { { 0x9f53e62fbcc04862, 0x1fe65436607b9be3, 0x00d8dbcc8808cf12, 0x1d5be8ff5a222074 }, { 0x12229244046e3404, 0x9162e92531907b3b, 0x849783fc63a2c1a3, 0x0802da4f0b5fd478 } },
+    { { 0x13f09ea8d81feaea, 0x6fc45801869070c9, 0x452d798598941eaa, 0x36ff66acc23a0f29 }, { 0x32eeed599f69c389, 0x13ce91187a6d63e7, 0x69f35c58876b0fb5, 0x0710b13daaff2f4a } },
+    { { 0x2feb5196d5c95ef7, 0x9dad8c803ef12e2a, 0xebfad9795c2a9f0d, 0x1d6da1cef4e3b252 }, { 0xdbee0c9c03078d0c, 0x2e55702cda806210, 0x5c2bf0f6ef95eea3, 0x3196a24a49e9a913 } },
+    { { 0x890703c1ebcb9bf1, 0x20451373c3c33075, 0x14d2370463e40999, 0x1dbcc718e5a09340 }, { 0xe7a4e871573c2c77, 0xe4d649e61f9cc56e, 0x8810958d894b02a7, 0x1d018f777f915cf3 } },
+    { { 0xbda3324a688441d5, 0xc819012e8ab52eac, 0xcd37d5279692c133, 0x3035b99b2dcb5667 }, { 0xbbcee6178817c4dc, 0xfc0afee04dbbca68, 0x42c7a99b555ec91c, 0x0fe743596662ee0c } },
+    { { 0x6a64bfea40a17c4d, 0xae83cb65a8472536, 0x995446156d21d202, 0x0bf655024f852102 }, { 0x777a7ba6fda28fd3, 0x9eecda61089e6e64, 0xfdab18307ee8f978, 0x34c21faa201ae50d } },
+    { { 0x181303b5994491a4, 0xfcfbb121e092767b, 0x5cdfc168c7e799e8, 0x0c97bf11c214c56d }, { 0x831f7d13486d46db, 0x7752ba892ba5189a, 0xd3b2480a5cd8395d, 0x25650dac2265aeb8 } },
+    { { 0xd94ef772621cb040, 0x3586f91734ceb11f, 0x57e3e9065e1c2f0c, 0x0c39003326c7dcf8 }, { 0x4ac9d4716ec0ae92, 0x49afab71279e8a76, 0x83fb6d5aeb52121d, 0x08b5cad3f9140405 } },
+    { { 0x22f3844586619dfc, 0x0ecb7ae89a7b4699, 0xf1adcafcd603be0c, 0x10bf1c2ef4f76ae6 }, { 0x2e84d658f166dfbd, 0x9d67650e156693d8, 0x006125356af39447, 0x0ca4f2a67e09b2a7 } },
+    { { 0x50a6c7d9ce1cf6b3, 0x9093d6970bb70609, 0x8f12606e5abedcfd, 0x2993fe2e5e308dc0 }, { 0xe16636e707a0fa6e, 0x06183f982abf08b8, 0x65cbbfc03605b256, 0x1d47b92db1235444 } },
+    { { 0x71f2a6b594b17442, 0x19b409e95155d6b1, 0x8c1c7803d895dcd8, 0x0ab22e50db23c280 }, { 0x2b7902a5ec363748, 0x38a488c818b955a8, 0xad759233ce5b3a17, 0x1a5280157fa0ba97 } },
+    { { 0xcca4e957837fce99, 0xfb6e5e7fc5caf8c1, 0xfa2cfd1a1b45cb80, 0x2b964c0e53b37cfa }, { 0xe5bf9cb550eead0a, 0x521e83e2ab69d6c5, 0x81472711e5a78a9c, 0x269cd8514cef1858 } },
+    { { 0xe6eba1909aeb6ccd, 0xef08f9d06cf58d58, 0x4b8592b82a3fd654, 0x144941dd5f1d6f3b }, { 0x0d9b38612702cab5, 0x671bb44123ba5445, 0xb2a77f5f3b90ff32, 0x39aad3e0f798f82d } },
+    { { 0x83b40f8830c7093b, 0x6403bd8d2e01ed9c, 0xdd164dd6ee7cc776, 0x08560bcea3c2aaba }, { 0xe8446dd47d07a59e, 0x855f1dcd463c1659, 0x19b786b4c569cc90, 0x17d85b6445385bee } },
+    { { 0xa47121820212b892, 0xba152b77a9e5fbde, 0xe5a8b0ead59b9302, 0x13eea10626f2bd96 }, { 0x9945234afee24ff2, 0x9533dd0cb33d8477, 0xbdb3a7724a3eef5b, 0x33666cd16beefece } },
+  },
+  // 2^184 * g
+  {
+    { { 0x2e85e6f1c0da6490, 0x30edb8f75d31a60e, 0x70eb939914fcf369, 0x2e19c258590dfcca }, { 0xb3b256abedc652a7, 0xb3ea4c5470aa6436, 0x557a9cdc0867bf5e, 0x22731cb09e2bca3e } },
+    { { 0x865767257dd3b160, 0xde9fd9c621f0f7df, 0x6af3e8e11eb66b55, 0x324f52c3940e9c2d }, { 0x0cca1c2e39cc1041, 0x35ca4275cade6135, 0x280f2752f4da30b7, 0x14fae130515ecce1 } },
+    { { 0x75ea408c31ed6cfd, 0xbc2a11dabfd0c1b7, 0xf7e428d6a29c9021, 0x3c094213be05fcdb }, { 0x80a025482958a091, 0x89ff5944df5b1a61, 0x0c8f219d37db70c7, 0x09a719089e46ec6c } },
+    { { 0x568d539fa7319dd7, 0xefd41e7c02e073f0, 0xa5cfb37bb8c9dd9d, 0x1869a7b493f7ab8c }, { 0xc0f28041805c007a, 0xf9e1e124f89b9450, 0xf42f03ec9a98b306, 0x17a5341a3bdd7e21 } },
+    { { 0xf50682368fb8ecf8, 0x03ba35d5f9e2f7e7, 0xd0816a15de9d1d41, 0x365efb6fc246ff61 }, { 0x9307145a08c24af3, 0xbec15a49c6f88587, 0x5cffe01d3c77ff7a, 0x0c5388de30afeed8 } },
+    { { 0x3bb004f22f27489f, 0xde7db2215ac36b69, 0xb16818988f5d9cf6, 0x1fa88b1c46ad7d3f }, { 0xaa77b9167d864ffc, 0xedb6334b4f9a5550, 0xeb5d6b571c7788bb, 0x0e932ae8b1b40deb } },
+    { { 0xaec01d87167fb5e1, 0x83e8f4009cdb813a, 0xc1bb04297d3601b6, 0x1016a0d4bae9735d }, { 0x4c8389b83b704a72, 0x4aa090fb5761f2c3, 0x681b465cd5cb1706, 0x3b77c23111f81c26 } },
+    { { 0xeb13c8713ded6f39, 0xc4dd58df0917791b, 0x23ef3f0124103cdb, 0x0ca6a42dd6d9dba1 }, { 0x166aef6979e0f207, 0x8c258172accecf42, 0x1d5b0ede11119c28, 0x01dfe7c3ea88d281 } },
+    { { 0x7234e9049596ef43, 0x4b57201f6f041608, 0x9ce562119aa2c687, 0x21ea9064dede2f67 }, { 0xc58d752f9ee19bb7, 0x2dd656a922cfbe77, 0xf63654a16b2c1ea1, 0x00eacb1a7337bdd6 } },
+    { { 0x7fecbd145aeae2d2, 0x7b109f753bcb12b8, 0xa94daeaa7eb0129b, 0x17706bbae27e2f3c }, { 0x90f6689d3276fd47, 0x39875cba284d3792, 0x15fe4fab4374f354, 0x144bfb91e062c326 } },
+    { { 0x1f39a2ad2d668a61, 0xb648c84a72411e39, 0x0c59e7d00eb09724, 0x2c90b9297d8c3997 }, { 0xad517c87bc5bc834, 0x7fbec3a749cdefc6, 0xd10677aaea9b22ef, 0x04536cabe8becb17 } },
+    { { 0x733f054ac4f27471, 0x87ddb979124d2aa6, 0x77cf9c138f4cf461, 0x119d64c46783fe78 }, { 0xf12bedeab154aa61, 0x9f2200becf682776, 0xb15e4b22211101b8, 0x25eee73c989425fb } },
+    { { 0x07df4903d95b6a5a, 0x515f9fcb9300c70e, 0x7b09d11db3ee99d4, 0x12d8f02c3eb42f5f }, { 0xc450bed043094946, 0x9b30c00f8c775065, 0x70a13eb37afbaadf, 0x132aa16771db9123 } },
+    { { 0x8b1deca09e64926e, 0xd0053fb4175d6f9f, 0xaf92f7fee5fb94bd, 0x1e72280e9b27da6a }, { 0x5aa1d31152004377, 0x3ce11bb84770c7d0, 0x2273f82dc602f67c, 0x36e1b01ef1f193c4 } },
+    { { 0x8dbf77bff658924c, 0x7b3530c72371efe2, 0xde898765e1707b4f, 0x21f8106c431c4f16 }, { 0xfcd5f2b5d44c2503, 0x1c529c7a8be90591, 0x43c592cebc2634f4, 0x1fbe2fc94bb3ecdf } },
+  },
+  // 2^188 * g
+  {
+    { { 0xed4e8ef003e30391, 0xade55c921f7ec3e2, 0xea870f21f33fad4d, 0x02b0e9824ff5651c }, { 0x1d2f4a1349b780d1, 0xadf0be73ed60a0c0, 0x637e0d9e25537e76, 0x314d6923e9334ee5 } },
+    { { 0x48dd4d60f1dbfb6d, 0x388f9723af0fc605, 0x37f51f84eaccf976, 0x17c185fa2b09e406 }, { 0x13311f1fa32369d4, 0x852fa39912ee854d, 0xde71edc7fe755cfa, 0x294af9bf629623ab } },
+    { { 0x791365a2cd2eb2fe, 0xfd5744984c29274d, 0x0c1aa11aa8feac25, 0x3b8d79890c578f81 }, { 0xb58de16759b33c8d, 0x5565c78576f04827, 0x4145b442d530de6a, 0x2c9d8f8e29759ff5 } },
+    { { 0xdd08b35b0c832031, 0x293a19d8cf7c4569, 0xdf0d1ef147f714de, 0x1cb94b25294b5e6a }, { 0xbaf78fc54ed7418a, 0xd82a97a25cffef14, 0xcea554c290f7fde6, 0x25b2716db1128b09 } },
+    { { 0x27e5a9370e945258, 0x81cb5850f5ddfc0c, 0x2bb96bd2d679b5b1, 0x3a5b2290ba8f1d02 }, { 0xcdfaa8e40402e487, 0x412a1198ae9e7825, 0xdc7acfb92562d72b, 0x2577352d89a37344 } },
+    { { 0x5ba5f2fdb5bbe969, 0xbdffeeb266c42dfa, 0x7cff5bbc4a9edfd8, 0x25c0445cca05a773 }, { 0x6217b56837f62f63, 0x730df04597bc999b, 0xd6c8d4c54686a4c7, 0x2566a1152dcb295b } },
+    { { 0xfcd4fffd310cac2d, 0x56768d8d30349b51, 0xb285f939da5cd75c, 0x27894ccf565361d5 }, { 0xd727551b7b3eaf1b, 0x902b9c89a882bdeb, 0xc6b39d80941411c4, 0x03fefa2e67fbc77f } },
+    { { 0xbb1dc90168be6778, 0x8966cafb69cec6ef, 0xde9c053a603a10e4, 0x16cf7adc5d39d85e }, { 0x657006999748396d, 0xb52ca0d4f06495f9, 0xb545b44810cdb7f2, 0x23d06114542d2576 } },
+    { { 0x92ccae8bbfb0dc85, 0x0bad19c759a2a034, 0xdfabccd4062f3b57, 0x162f114d3459c5c7 }, { 0xfeb1f431d52ddd48, 0xa567f37a93207dd9, 0xe22da423251744a0, 0x346d31ee13d1bffb } },
+    { { 0x8b5b14816c700dfe, 0x3f4b7b49d66cde94, 0xbd5730448f55fc43, 0x29c2bf7ba2e0dc53 }, { 0x70b2742ef69fd638, 0x3b8ee7a79134ec75, 0xae040d98f320bbce, 0x33c312f5d9d4ebe3 } },
+    { { 0x8f411667e74ffa7f, 0x122c96432ba328e0, 0x23217d7766ef8d47, 0x381312e39d827dac }, { 0x64c3e33849bab25a, 0xb3dbc5365b23a632, 0xb8b13321665657a7, 0x1a704ec2f2c74cd7 } },
+    { { 0x1bcc23c3d1dd0533, 0x2b922b505bca3c47, 0x3ca0600877705f2a, 0x25162cc787e6dbfa }, { 0x88c42b483a40e882, 0xb7a1339c38ba9297, 0xbb6220d6805b9bcd, 0x305db89045059735 } },
+    { { 0x2b13610c95a666e0, 0x6da69010bc645b60, 0x4caeee586bb6820f, 0x36e439061f21d49b }, { 0x3691a6663bedb83a, 0xf34aed46d2412fd3, 0xa03d3efdd63f9c26, 0x3ff744b96017b793 } },
+    { { 0xe02a7cea488b95f3, 0x20fe68d6c5af095d, 0xcfa5de66973cacf4, 0x22317c40a2b26672 }, { 0x44aec9ac84831314, 0x50f863aa02f4f685, 0xf9bf00a03619fecd, 0x2530f6eb449adcd6 } },
+    { { 0x964febed7f234386, 0xd20aa77dee77d786, 0x291c36d72275b11e, 0x0a5a4cfca5427a7d }, { 0x3e8c9c834f5bf8a1, 0x985c472d5a7819e7, 0x3c68865e73423f32, 0x0dbc41795df7ebad } },
+  },
+  // 2^192 * g
+  {
+    { { 0xf7a944552fb5acf1, 0x1fe1f5594d8f7930, 0x3a39477099a9ea1d, 0x0dc87c0e0b2c6b50 }, { 0xac1bb47409e0a7f9, 0xff2cbfd5dc286df2, 0x8485922a590931c4, 0x3419e0e5f780715d } },
+    { { 0x680febbbe764723b, 0xe92d53a6544c4e3f, 0xdeaf8613ec00aadc, 0x24a072eeeb3e4202 }, { 0xa7f602c3f301fdd0, 0xe845b3d1159b6cfe, 0x548aede42487c5b7, 0x292c2cc2939aac47 } },
+    { { 0x9ad0d1c7f3c0854d, 0xe510fbf2acdeea8e, 0x5206e8f2499053aa, 0x3c3e7720da77764f }, { 0xa6b919cd33824010, 0xb3bce4aeab08d72e, 0x8216473ddc037af5, 0x095cd5b6ba1b0c7b } },
+    { { 0x5b0012dd511ebdc1, 0xb566c567f67c81c2, 0xb901092980f9d890, 0x3abc53858a49308d }, { 0xc90eb7f5d471d40b, 0x62607d52dd51f879, 0x5421fbe966a13262, 0x0c8897f3d5e34801 } },
+    { { 0xca639942e577c5a3, 0x1b43f548beaf7cf0, 0x8f84b46740d5c094, 0x1f2daff947afb296 }, { 0x044ecbcf0c779d68, 0x6f89e36172ad6dca, 0xf25cd298b4bebcf2, 0x32c49ddf7874549d } },
+    { { 0xdb83d150d3815277, 0xa0556844b5d29dfd, 0x91aff23d74e46abb, 0x14aab2a82efb789b }, { 0x85529e2b9ebd05cd, 0xb45263e30b5b472c, 0x19a1c97387f6a54e, 0x03c8702b43ff15ba } },
+    { { 0x56e75434fb9e9493, 0x2ad4c0559cde9356, 0xa02fc56f8c55a876, 0x356b6305fff334cf }, { 0xbd80d4ff70e95919, 0xf3886813b530fea0, 0xed437600458bec24, 0x0c75206004151f2d } },
+    { { 0xe8b8e5aee87d69c8, 0xb6c5f521455ce3a9, 0x6f90e45802a55024, 0x1cb3af975d893560 }, { 0x39f8f52eb0fe87d5, 0x9a21c2aea8e5ed63, 0x455646801871edc7, 0x0efd5b6fce6095c9 } },
+    { { 0x7214d9cf066bc7c8, 0xcb986fcf9e51c832, 0x2f1f7e9682e14ef2, 0x22a64c43832cbd2c }, { 0x14304b9af341ba18, 0x7aedbbdb1f697d7d, 0xfb68f7a4eac4e978, 0x1bafbf74e3e760f3 } },
+    { { 0xa298ae9e346ed01f, 0xb1790edc0f99743a, 0x2cf17756eff92cfe, 0x0ed1a05a457877f3 }, { 0x77a9e777eadd522b, 0xe90e898a6ddf0bac, 0xdeac52aa35688693, 0x258ed6a5d109737e } },
+    { { 0x648c2f3770a66d92, 0xf7aacccc22881bdb, 0xd3858ee23c2f55d9, 0x29ba052c5774d73a }, { 0x044257fe61444947, 0xbfa0699d048358d6, 0xd307768ecb6d80b0, 0x1d24c61fb6789320 } },
+    { { 0x6944dcfa324d0ae5, 0xfe8e9127ecc8dc4d, 0x0607155a93aa109e, 0x3c9a56628f6069f3 }, { 0xeb512bdfbf653677, 0x832a223cd9cbbb30, 0x654097c3b9ef25db, 0x3a0614f240d55be2 } },
+    { { 0x905d9dc69ccbf32b, 0x88e0c4973250fc1a, 0x5eca838abf2ef18e, 0x32f39401c76ca467 }, { 0x04041aa13e1de864, 0xa427567fc3429783, 0xa15e3ffb86dc4c9c, 0x12abfedaf3e485de } },
+    { { 0x4e7a014e36f62f0e, 0xc330913c0b1f2fd8, 0xf8c61875b59a04a3, 0x0729b7bb5213f3d3 }, { 0x59b5fd04290412cd, 0xdb2aed5f33791203, 0xc31284b718d9265f, 0x054403e2654ac2ee } },
+    { { 0x1a55941cfde6e8c2, 0x956afce56f8aff3c, 0xc3349c497e406a0b, 0x3547b8ca888094fb }, { 0xf21c02cd511ac31f, 0x7aae9fe6b546d20b, 0x89216765fd494059, 0x27781d5e09675ea1 } },
+  },
+  // 2^196 * g
+  {
+    { { 0xcbad2bddb18a2aa9, 0x5536e71d7fc80822, 0x8197fff221d317ea, 0x1140970810e03543 }, { 0x1546d309a89e5010, 0x4dbc9cb09ed9aa6d, 0xf9f78b61a7128872, 0x166a6f623778c8b2 } },
+    { { 0x655d74c7a9702308, 0x8b99dfe4b94a1504, 0x7b41fef2e473ac68, 0x2763626ac79d2383 }, { 0x6edc1068e4220a6b, 0x1b1c33f1d15b3995, 0xd4d736fb874d0b2a, 0x3bcdbea454ad388a } },
+    { { 0x1143b2f4e7f189a6, 0x8e199ebef51f8aa3, 0x45f15eb8e75a2d2b, 0x1f10736c4daf852f }, { 0x4bd90ffca570f31f, 0x07fcde1db68cf89a, 0x36fe4f4c685ed653, 0x2e9424a73387e36f } },
+    { { 0x382e547e56414bd3, 0xdc82d9c2dcb1366f, 0xb8f2825433e21511, 0x10b3603dd5f6ba6d }, { 0x1b83ff4fa73de9d3, 0xbbed7519c724f97f, 0x8eb347458767260b, 0x1dfe38d980ae3293 } },
+    { { 0x3f7be7885df11a0b, 0x43c053fc09fd0fd7, 0x89aa06a2ad0b65c8, 0x3f86623638e2aa05 }, { 0x76628f5e2afcccb5, 0x8d6defa37b50fbdf, 0xdbcb8a6c843456dd, 0x1862f1669a0ae408 } },
+    { { 0x4ae1eebb60ea1a2b, 0xcf7e486aa582236a, 0xae000288d2b5f618, 0x27362621687ae092 }, { 0xa0c3603334a451e1, 0x5887824a4cc8a6d2, 0xb257d87ec3437c96, 0x2d1098d5afa84d14 } },
+    { { 0x363e8cad8823c3ad, 0xa0e5e5167c1f0403, 0xd95134b820432091, 0x1f898f733b073ecf }, { 0x113ed611a8cb9e35, 0xe435cb9b9ccfd2aa, 0x37638670d1d5cac0, 0x1364a9a4b345aeb5 } },
+    { { 0x582fc60b258beef5, 0x647b75a01afc8be6, 0x820d8c1a4d1999e3, 0x1643e5656bce53ed }, { 0x8ca632b3e172e5d2, 0x7821db0df0da494b, 0x028d1488d426b730, 0x0c7d5f5449bac34a } },
+    { { 0x4f40802e926172d3, 0xaad869ffea473c15, 0x744bf2d8fdd981e2, 0x068ebc31c1210398 }, { 0x0bb64a40a078e4f6, 0x548b985a488c9f04, 0x77e2c42c42c34159, 0x26ed174a79d89849 } },
+    { { 0xc401a4726dd8ea41, 0x4af0910a91d304f2, 0xdb862f435762c2a5, 0x0a2a32784ba8c856 }, { 0x33ed9e34c3c43ee4, 0xd22fb8f704c0203c, 0xa19307bacfc9b95f, 0x0e3f55dd650a9bfe } },
+    { { 0x7fdb163db55409a8, 0x9d77fb0e439c3f48, 0xba53d42044139e88, 0x1fb7977b8c30ced5 }, { 0x0cba28f0bde631ce, 0x783321bbb16b93aa, 0xecd9f53ee9e02e57, 0x208681b3990a7b56 } },
+    { { 0xcab23ba9c6660fc5, 0xc75ebd2c50b54f11, 0x6cbf7d294b6b40ea, 0x0c04a979fc781381 }, { 0xb41c97c00dc54d4b, 0x747759b921ec845d, 0x7e3a07e3f011d0a0, 0x2e73735592485e59 } },
+    { { 0xe38a8757a2cf3bfa, 0x90b5830bb252ad6d, 0x200b4d5c3741e9da, 0x13c64cb7345f5e04 }, { 0x00e2aed95dbbb5e3, 0x42a39dd45719232b, 0x786aeafbd50d75b0, 0x1dec6013b6174d3a } },
+    { { 0xd002096b1e2f9f68, 0x45b8b11c5af27e5e, 0xbfeae3b4c11ccf80, 0x020bddde35c7382e }, { 0xd0b3f3165a491884, 0xe79ec4d91d5d4fda, 0x288bfd9dad28ec18, 0x04f45589067da974 } },
+    { { 0x880785af45e00db9, 0xb9bd7e8f9eea3be0, 0x393a2e3228ec7e73, 0x33ce85d17fdb1bf7 }, { 0x0d3705c88a7aef8c, 0x61d74b9535d0f547, 0x431ec8e116172c98, 0x22cd0aa3895cef37 } },
+  },
+  // 2^200 * g
+  {
+    { { 0xd3c899a0e431ff37, 0x500a3f0b09dccf69, 0xec5d5b2dd954e6a0, 0x28133d13d3b0ce21 }, { 0x214aae525d4b0eee, 0x633376daece7905e, 0x07a7687b55f26d6d, 0x160bf0a351981abd } },
+    { { 0xcf5e01f9ec40a877, 0x14a2b0e4468630a9, 0x3408b6c925db95ea, 0x32f880bbf21c2e46 }, { 0xd3684a600e6a727f, 0x0f007d9b067007bb, 0x0ac4eaddda35260d, 0x0a9b4b58e8953290 } },
+    { { 0x04ca78f224f1541a, 0xf3be83e458400816, 0x39d98a3d54d58fe6, 0x0ed5f59b53cc19df }, { 0x5e4f747221541801, 0x29c66e2b40b23500, 0x6a4fea65f505f612, 0x238849aa307d2b93 } },
+    { { 0xb06ed582094bed96, 0x7b8b876746146c59, 0x55ca4b56226f005c, 0x242236aed3419786 }, { 0xc19d21c9ed09e105, 0x8b72cb20abd36db1, 0x7f15050e96a7dfaf, 0x368e19edc4e4b62c } },
+    { { 0xabf09bdd672c2820, 0xf16e7f5115d03ffd, 0xb3a06098872a8444, 0x3aa1e80a3315de53 }, { 0x3113925c8dbd59f6, 0x6a45f234df6635aa, 0xec87d4f5b0f363b0, 0x006513bba78cdd94 } },
+    { { 0xa6e13800242f3c03, 0xdbde75f3d177599b, 0x5daf5949ecc2502d, 0x3a442e6bed795853 }, { 0x2f2e4fe5bf086ced, 0xbf4b52a96f042ca4, 0xeab55ad62785b5f1, 0x3098dab321b93622 } },
+    { { 0x84e55d80eee35cf0, 0x6ad4c65e41378744, 0x3bcfeb2ce902ce39, 0x1150a19d1b9cf651 }, { 0x222fa2d04dfa1129, 0x0749fdb440e59632, 0x98c7d3c2f47efa7d, 0x2bc8893f1706d91b } },
+    { { 0xf708f4ae7f1a9d34, 0xbe2ca2b3ddf7bb73, 0x7cd06ffef347aa8f, 0x2172c6f364111c50 }, { 0x3bc4b27d9881e140, 0xff98fdbe0bb66984, 0xae6bff25fbdf51cf, 0x262610a6099171c3 } },
+    { { 0x17c0cfafec41d612, 0xaac21bcfe8e370f6, 0xdd348e01187bbe65, 0x1e14dd7bd1953a39 }, { 0xa0ef597d13f42370, 0x9c28c64482483896, 0x1de6bb8d3e38baa7, 0x1569e3cb72c69f2f } },
+    { { 0x01accd1037bec872, 0xc76149de4eb604d6, 0xf98d76b17950264e, 0x2884c5d9975b03b2 }, { 0xeb515eae9af0b630, 0x1a4e4e8d5ee182d0, 0xa8351c56791d8c70, 0x272030db3aac2946 } },
+    { { 0x7493603fac07e541, 0x6d7981b74f769901, 0x06887b8068dc39c9, 0x051364a6a571298e }, { 0x6744c8386cd472bb, 0x0e2f308f3aafdf74, 0x0f19c5d26bf5d5d8, 0x32e4ada8ddf97ae4 } },
+    { { 0x535798a612a1562e, 0x5ed749a80012018e, 0x83cc984bdbe31b62, 0x324a3984e45eb9ab }, { 0x24331956dfa406f2, 0xc2c6cce751f0ae37, 0xe08034e9a7f8a432, 0x3b809bf3ca12f01b } },
+    { { 0x0365a1e2250569f9, 0xa1dfc331dbc3d6c3, 0x7e07877a58dd4bf0, 0x0929aea7db0695c1 }, { 0xa47275199e191e72, 0xdc1e03202528a9f1, 0x8036a147e17b5e28, 0x06b07120e70e8e7c } },
+    { { 0x09eb92667228ee87, 0x545ef1afac937bb4, 0xff904074fe15cb60, 0x2d6602d85112343f }, { 0x1a67f18bba650e15, 0x29afed0a41e4b74c, 0x5cf856f70f87532d, 0x09c885422b042fa8 } },
+    { { 0xfabc35850416e489, 0x840e6926c2e7e918, 0x034b61dc9a31b358, 0x25753eed59e3c2f8 }, { 0x90b6b33bde01af07, 0x5dc709924cc16488, 0xfa924a9348cce425, 0x2809ab68359e3976 } },
+  },
+  // 2^204 * g
+  {
+    { { 0x2e93863a6e7a6cff, 0xf3d1dde87c4803d3, 0x65da92d3338e2e8f, 0x2f35df0ebc3fc442 }, { 0xaec485e7e3694aea, 0x8bb202b05b2c4151, 0x53af6cf5d41e7122, 0x09d4af1053e92093 } },
+    { { 0x0ff4b6fde6d20c35, 0x5f1b127a01aface1, 0x6f1bcec94ed279e6, 0x08067886116aad4e }, { 0x8a50a661c9aa8fd3, 0x987005d07dc7ec31, 0xfb57e500de8e9022, 0x39712fd4f0ff90b8 } },
+    { { 0xa043bf9aea208abe, 0x619f455332af6005, 0xc40776067224b329, 0x044e2b6843ff9761 }, { 0x0d7172f0c8ef70b6, 0x99065b65ca7c199a, 0xb91206d9d2bfc10f, 0x3bb0fda6a021d3fc } },
+    { { 0x6040aff4005a7913, 0x2380d3d7a45a4a1e, 0xf29ab533b1e8c9ae, 0x1c13eef5c5426974 }, { 0xb9d2637d28dac369, 0xeb72c9b95f843d03, 0x7252847393debd20, 0x03bf27555d4a8bd1 } },
+    { { 0xa8f5a0595ae8bcfe, 0x394d9a36230c35d5, 0x1f8b0b7b1f6263eb, 0x25f9330db71fbc21 }, { 0x426cbe13144f5bda, 0xa4c8b7c5836dbc5f, 0xa9b4b36660e5a827, 0x2107d881f184a4de } },
+    { { 0x0b6c89aeb668f649, 0x0c4ba8600d71d084, 0x32f9620f4d877978, 0x26dc147524500996 }, { 0x331d28ede2171ec5, 0x0a4ac0d452c752fe, 0xecdbed433b508f38, 0x2f4ed9bbffd8c711 } },
+    { { 0x6cd0d368d3594330, 0x2581cf80bb48245d, 0x94524db54d2d5b89, 0x0cde4063e0058430 }, { 0x109a052b2db17829, 0x280467ee47212989, 0x56188754f2403992, 0x085f1e14376945f6 } },
+    { { 0x58446133700bc3a7, 0x0c2dd6afe36c782f, 0x72a786bf5364dc9e, 0x3fb887900518b991 }, { 0x9bc9944960c93579, 0x5729a88310a9c0da, 0x5f766d5f5bbafb19, 0x3a33c35244e6cde8 } },
+    { { 0x9d6ed09884cdfaff, 0x48745f3a67c44431, 0x29418fc742d3dcb1, 0x1a431cb0c2fc35ca }, { 0x837a4925baa77966, 0x7443c2acd7a7f78b, 0x7652a0ad6e3aff02, 0x0050d779a9199847 } },
+    { { 0x40523ad3b5f5ba8d, 0x2e50d60094913a54, 0xcf9d608c2fffe9d2, 0x2088b1b3b84590d7 }, { 0x3d90a83579acc922, 0xa6d646c2984e76ae, 0xa6bba76c8e3e925d, 0x164da6bcca157d55 } },
+    { { 0x5c21d99681d019a4, 0xc3ba28d0afe415ab, 0x1ff84a28fa822d5f, 0x2a607e369148350b }, { 0x5826c3c99c11e4f0, 0x58b29e14ffea7580, 0x59c8fe9ed8e5d5de, 0x320755288bb5bd4e } },
+    { { 0x6362f8aa69cbd502, 0x6f92f3c10eb9d298, 0x8c7351f70492d42e, 0x3e6199faeca99c8a }, { 0x8a9134f8ee27c5cf, 0x6573e44a75fd78f2, 0x9e4e22364372ddda, 0x105638a20c8f47cd } },
+    { { 0x253863c57471ea62, 0x67438def5bbc30ea, 0x0365d0365b7a341a, 0x21a04418a9a9c875 }, { 0x1ae075f154b90bd9, 0xbbc48bb3d730d1be, 0xefc1098244bc1ac5, 0x3e5f57c3876cf490 } },
+    { { 0x1d6b7268cdfa36a6, 0x6631ab2b56dada9d, 0x485f29091877ceba, 0x35548eccc87c1090 }, { 0xda466e36706be6c0, 0x98fcba7f092f19e3, 0x36c5d2c8bfcc4407, 0x3ec3002a29f74c32 } },
+    { { 0x4b97464ebf88d73a, 0xce6261fefc33c061, 0x501dd2036729a3b7, 0x26c02c07ac7ca59b }, { 0x4e55875c142e6c87, 0xef4b5b2f671171f8, 0x55d963aa22843d99, 0x0f865cae1068ae66 } },
+  },
+  // 2^208 * g
+  {
+    { { 0x1ffff2ca7fd9f562, 0x59f8adfc200461a7, 0xe5a0a9b843763ac1, 0x37e1faf2ffb11f1e }, { 0xdf3e38ca71b4aacc, 0x12010619a3f3fb1b, 0x635ff552b0ac4420, 0x211c9599e72d65f9 } },
+    { { 0x8870e7fca3aa30e3, 0xe21534c213fe997e, 0xc4d9bcb4ecec7d02, 0x0cf37749875d8d00 }, { 0xcc1e5172560a1698, 0xe70531437dee245d, 0x4b4954e969b4bba9, 0x368f03f25a22a6b4 } },
+    { { 0x9599775a8c2e2119, 0x07164ab86bfe78d8, 0xb13a7dcf4b7ee1d6, 0x03e1c7d5b20410c6 }, { 0xc0641f5e59a041da, 0xdbd3d2fcea91e2c0, 0x1b64b4f1dae3c2c3, 0x312d14416f3cd6ea } },
+    { { 0x769c1576bd0e61c7, 0x1286461bcee73a2c, 0x3a9188f5ca3f5381, 0x3e9f6e3e1505d3d0 }, { 0x1465f2c3789054d0, 0x4185337e1aa80b3e, 0x5f85bd6be0abd519, 0x1988c66f3c83c55e } },
+    { { 0x232ea4b6b128020c, 0xf999c73b0bd6ad41, 0x53cb38510f1949b0, 0x305a4314cf985d63 }, { 0xfe1954d918174fb7, 0x43fb4d8648cb03b9, 0xc49e2598c7a59952, 0x35710619224908da } },
+    { { 0xfe9f6b05e557771c, 0xf2c6c7dddf4e0516, 0x6667887d380c7f9e, 0x37de204086f82282 }, { 0xc86b0fcda1425f50, 0x1f9020808002fd2e, 0x3419a05c101a0464, 0x27cd39d90a69eb99 } },
+    { { 0xd2beff61cbccead2, 0x08701a1c0066a8ca, 0x75563e3abf6a5096, 0x3510183eac1d7bf3 }, { 0xab1cba7e0bab8df2, 0x146097ae95aedeb5, 0x982acb808f8a7a78, 0x303f3b7937347ae6 } },
+    { { 0x16281993f30a0a90, 0x5dcd440c048f5bf7, 0xf5460d52f52aa21f, 0x3e7ddf7744b7345e }, { 0x4880fe2957987e02, 0xe783084f42a6eab7, 0xe526aa7527b53612, 0x0d598c90213638d8 } },
+    { { 0x2292dbf12affa937, 0xa6c33657201a5a9f, 0x1fca4c5c483a821b, 0x054c11717118526c }, { 0xf44d66b5ca491c6a, 0xd6be64031ec43800, 0x2d16bb4a36b3c10d, 0x2ba1abc9e8cb5956 } },
+    { { 0x3b73c7e6fce65cf7, 0xacd1428253b7e84f, 0x6c51a847e20ce424, 0x3bcfe8adce323978 }, { 0x25c9214bda7a3c96, 0xf956acca2dd4c5dc, 0x6a43ec03dad74556, 0x069eeef58d5e340c } },
+    { { 0x242ec9671099f12e, 0xb4b6bff65a152262, 0x3e1068b9abb24ed3, 0x10dceaaef9ecbbcd }, { 0xa953b07b9c193ff5, 0x590ec32f83f8b89d, 0xa07bcb57bfe86a3a, 0x321f7a06f0a0074d } },
+    { { 0x8d78ddfdd6227d10, 0xaa01df41d1bd5db5, 0xcb615daaaf9185cc, 0x25ec49d8c29fcec2 }, { 0x17f5deddfa3b31ca, 0xd19fe203d12e6921, 0xb2c089516c1532a0, 0x0f5368197eaf776d } },
+    { { 0xd351c3d1b80eb1b8, 0xb8acbe2ce453b662, 0xa2660f82c448259d, 0x3688991ba317f112 }, { 0x198dbdbf0c6a1713, 0x8524dde77a12bcc8, 0x8903acb2cf71436d, 0x39222fb5533c89df } },
+    { { 0xdae7d512702402ca, 0x2ef3a0bfd22b8c7e, 0x194f992716b0c385, 0x0a1263622b4e932e }, { 0xcd642c417bf9e166, 0x2240da97ee238b00, 0xc8aad56b208ee860, 0x17efd6218af5a112 } },
+    { { 0x89a18c104df38fab, 0xe01cac3ad642bd9c, 0xe8f426199578f1b1, 0x1aedfb57e10a6148 }, { 0x28d02e231797cf7e, 0xeda2d4185e13dff3, 0x1650f280d7282578, 0x06d07b1ce334f987 } },
+  },
+  // 2^212 * g
+  {
+    { { 0xf607ce2c38881be5, 0xd2fa3e98ef6ff8ad, 0x09d0c4c2a32b9a86, 0x2de727e9ccd02b0a }, { 0xcd4f60c8840b3f86, 0x7022a50a630db15a, 0x37d05df9a6743697, 0x230d252b6485bb6c } },
+    { { 0xf67b1f2108b0ffcf, 0x6f64cae4d69e241f, 0x80960b02d17966ed, 0x270316f7d49358cd }, { 0xed391547bf3dcbfa, 0xe8bf771823efb853, 0x0e4720e24d0423c8, 0x3550737c31affc38 } },
+    { { 0xe1d98cf5f415f2e7, 0x3202ac0725709f3c, 0x2e0b23f0a849b46e, 0x2ae924f1468bf2e8 }, { 0xafafb1fe12005cf3, 0x7ae4ced1f78ea6dc, 0x845fa4f00b85fe74, 0x0a8f78701460bc6f } },
+    { { 0xbd1aa5d6768b8ebe, 0x86d6f9d366bed4cc, 0x1c171818ec8e73c7, 0x1d9df4e955b04f69 }, { 0x15c8139100390317, 0xd97576187f4dcc45, 0x1b64d8645fe042d1, 0x237b2486d33c8c33 } },
+    { { 0x47b9381cd84510e8, 0xab0b59e2ac705edf, 0x76f31dc67ad94923, 0x3240c3be986f2fa7 }, { 0xfae74c65c3a0f0af, 0xdf8424a3892a987b, 0x84b4527a516ad6b4, 0x105f1ea544367fd0 } },
+    { { 0x52facadbe05355da, 0xd9e32ba3e5878958, 0x4c200bb1a534da83, 0x069e5e3b089da4cb }, { 0x7463376813d4157d, 0xddf1809c52be47f7, 0x2953a373151f5e34, 0x0ba4c273a3833ab5 } },
+    { { 0xa313b9d3a23f5f93, 0x4ac2fe9bc0f105d4, 0x2baed951f48a7532, 0x05026bb0458f3bf7 }, { 0x2961affc005bc0bc, 0x83609be0e9d3552e, 0xc30381ae4e616dc5, 0x2791f18df74dbac7 } },
+    { { 0x645c1e16527956d3, 0xca07c393162b0e22, 0xeaca64fb3920ef7b, 0x34376bb90a514da5 }, { 0xfb163a75270b716f, 0xf69bc316a562f81c, 0x4a337c6019098dbc, 0x0bb66aba1e5e1ee7 } },
+    { { 0xf0e3b2a940c42d27, 0x457ff91d3150b23e, 0x7bdcad7b0add9fce, 0x21fb5cd77b4884cf }, { 0x06f2224bf3015099, 0xd1adfdfa4046e659, 0x891830c040bf0891, 0x1e4544e4c37d00b6 } },
+    { { 0xd7c73527c3605fe0, 0xfaf8e2e406c1a1df, 0xa5bc0e94904df060, 0x11e679fb80b70b42 }, { 0x386856931bcc1640, 0x93ebfa91da07bf14, 0xcc7cefa37c730a93, 0x3dfac74786a130c8 } },
+    { { 0xa0ff21dd172943c0, 0x085ad3743674a88f, 0xe2b738b2fb791bf7, 0x145863c9470327bf }, { 0x2c00798503bd3cfc, 0x2977376f50ae8cce, 0x907c69b5bc95dd86, 0x383c0b3ba2184aa4 } },
+    { { 0xf55865fd7047a7c7, 0x4ec728953ab8aca9, 0x20e9e160b687aca3, 0x157d313dc3e9bec2 }, { 0xa08999707e587ef2, 0x1fc5d4a064567110, 0x0c65d8fead744a46, 0x3027f9d7c6670dc0 } },
+    { { 0x87840c45d34644ec, 0xf9d8aa4179978fe6, 0x448349eec45ae3b0, 0x201586906c120158 }, { 0x84437a963cfa69c3, 0x55577864f8fd059b, 0xa965145b06f09d48, 0x1a9c5d52bfb1e39d } },
+    { { 0x175e7873af3f4280, 0x515b3595cdb0ced2, 0xb6706362e3e637ab, 0x2f7fcf6cb45128a2 }, { 0x929352f93f367e8f, 0x1a2f57152563320e, 0xf6e4e7cf5f871e65, 0x0f6206a2ffb1ed46 } },
+    { { 0x3dc4ecea084a5ee3, 0x0365ca28bb470781, 0xdada9366e2912fb2, 0x0174e70513a709cd }, { 0x57fbe76f7f1a5fc7, 0x97cfe59f107dd4e1, 0x6f641a6c72db169b, 0x1409973cf79792ca } },
+  },
+  // 2^216 * g
+  {
+    { { 0xd02dee44642fec10, 0x937a26f9d247e8c2, 0x365e89f252a0edbf, 0x26fb8536dfa9a897 }, { 0x74dc29b68376c380, 0x6d382f710587c427, 0x7539007ccb091e1f, 0x0b7af6e751de42f0 } },
+    { { 0xd25af6d90cef4aba, 0x28a9db6f377e8876, 0x1fc15df5bd3de64b, 0x1a8f5219b720d099 }, { 0x0bbbc85abfc64f41, 0xa39227b664ca2e6c, 0x42088e0c3e8a4261, 0x2b105dfd6ec49670 } },
+    { { 0xab9824d476d15da9, 0xdaac73fd192ac1fd, 0x055cad580f80d97d, 0x2367e076912dacd6 }, { 0x80685b522172edcb, 0xc5451ecebbc04c0d, 0xdd3fa8d6e40bffd1, 0x20a3eaa9a0eebac0 } },
+    { { 0x7c99411cb8a1f876, 0x6ac18b4f0839584b, 0xd22082863bf30a5f, 0x143a60ca53cf741e }, { 0x17bde032722901ab, 0x7bfa6725b1e0f15f, 0xba51be328d82a33a, 0x23494a08fe8a371e } },
+    { { 0x6639d618b8d7d512, 0x6f2bee302b6d1cda, 0x1669719a0450e67a, 0x0bd9ae4a7113e5f2 }, { 0x5e557343f8cd5d15, 0x3d673e46263fae0a, 0xf905ad62ebda0ce4, 0x323e656ddfc008da } },
+    { { 0x683f0d0b9588b4b9, 0x195f1fcb0cf32638, 0xdb896bc1887c9b6c, 0x34959d893c9c9b5e }, { 0x15862550037de9c4, 0x58456aa9c176b7c2, 0x6321baac97c4c6d2, 0x0eb98f1185482f8a } },
+    { { 0x7c66609eca7c6239, 0xc6cbdaf0fb8c0ba7, 0xc53be3bd5f25d05e, 0x0586ebcb7aae86cc }, { 0x0e0f7a57a5d4f463, 0x4c8c0c303470c86c, 0x5e8e4647a4b13732, 0x30cf436749c15fa3 } },
+    { { 0x64fee93c97d30df9, 0x5089a4642c571750, 0x226f17ed7edc3cbf, 0x1f97e698c4b459c5 }, { 0x74f1961cafa2907c, 0x82b1d6c2e22be4f7, 0x98282ceeb7b92779, 0x38ba07b9eacb62cf } },
+    { { 0xc8bf2466bf941687, 0xc37cd4ee63f1cb07, 0xe97beb586cfa6128, 0x21e95f95d4d94ff6 }, { 0x08e3d13c284c93af, 0xc7e82d4cbafb6f6f, 0xb54935e464a58769, 0x3beff0c8c22671d4 } },
+    { { 0x3808d725ef878d68, 0xb0a041c28be8d0c3, 0xead55cfd3074cc34, 0x2c5bc9bdf5caac1a }, { 0x1711123f861535d7, 0xd23038b15b3d2d23, 0x43e142b534496be6, 0x1d1f4753ea15fedd } },
+    { { 0x1150e46cf8113d46, 0x893c44138fa23a0e, 0x55c0ef3c8670b20f, 0x00c91bbc6471fd11 }, { 0xeafecb6ee260a2c9, 0xf820947e8f9cfd2a, 0x3927dcba8f112bb8, 0x1c9a4b988ca1c9c3 } },
+    { { 0xe9396e9f800bfd1a, 0x707acd8594afc8b7, 0x5b589575ae1cc06b, 0x0f54758ae863dc59 }, { 0x76ba262c8d8947cb, 0x076f8b956e7c98d7, 0x9e67a807b40e84b1, 0x046a4ef458b7164e } },
+    { { 0x20e9a7ded01de90e, 0xe02e476a687eb8b5, 0x94daecccd2bf1300, 0x04f946df133257d1 }, { 0xbe5d4646daf3e2b1, 0x5756a026d77ca54b, 0xad49d2c20ecbe540, 0x1c8d56d21425cc49 } },
+    { { 0x7fafe3db175638f3, 0xf6c99cfb0efff2f5, 0x3ed81f19a98c82ea, 0x02bbdf7ef6570c55 }, { 0x71d5f956b465b6f9, 0x0e59cdb3dfc01c56, 0xe169d2a79cc120c6, 0x1c12e48a1a32cc6b } },
+    { { 0x01f9ac3eeeaf0c95, 0x4a4b32125b2117d0, 0x906277fe443a32b8, 0x2ce5171bc2a9a9bf }, { 0x08ca138bfcad1c50, 0x796574d5cce03bfc, 0xbbb1624a3de088c2, 0x2da023daa981af07 } },
+  },
+  // 2^220 * g
+  {
+    { { 0x0fd4c83a82780df9, 0xbd3b264e58e7ae78, 0x86d38481c1075940, 0x3ac3b773909dd9de }, { 0x78db4b038746af74, 0xa1acc2207fd76780, 0x58e730808e57db48, 0x359e6a419542e8ab } },
+    { { 0x41505c76ea3f60e2, 0xc3879912abb32a18, 0x7b2c3a67239200a2, 0x1a37897e8477e1b2 }, { 0x8e8d63a07c7ce40b, 0xb3361bf7c060133c, 0x573e88785e01e2fe, 0x38789e4978898427 } },
+    { { 0xbce05c7ada925524, 0x6ef9459b94db2504, 0xd7230e0cb9392de8, 0x11d94bf289aff825 }, { 0x9cebd22f0d985b3c, 0x2220b0b8ef3a2e49, 0x9d9dc238a81458f2, 0x272c5bde91138632 } },
+    { { 0x8b5da3bdc80deda6, 0x99bb08f931dfcb43, 0x40cdd5caa7c88d74, 0x397f2507501292ea }, { 0x3c437304718aedcd, 0x9664633534e80e40, 0x10c22c9e972abaa3, 0x36df31084c10ffb0 } },
+    { { 0x706a0e10ba3057be, 0xa7e3fb11a7174e73, 0xecd1299dd51c7f7b, 0x08e91a918f8e1f12 }, { 0x7cdf62e3d1cdb835, 0x26ad84e5098f7d3f, 0x7f0a9dcad2d3061c, 0x149af42059e0688f } },
+    { { 0xa0f02a797fb6e84a, 0x63aad810dcfb17d9, 0xdc22116ece00f3dc, 0x29a3057c6618e326 }, { 0x3f7781a42c0ea45f, 0x2bc5882bc9519419, 0xb16612ff6ea96f27, 0x16923c29a092065a } },
+    { { 0xc37ffbf05ae7e3ee, 0x3830ea994c01794d, 0x00c7244fabe5acb3, 0x16f411bb494a8236 }, { 0x43b0a79a2f06e267, 0x10f9fea33b297a20, 0x3274ac80125ef091, 0x01b951350630d855 } },
+    { { 0xf28e05ce3ace3625, 0xd42418024fb1d00c, 0x7dff742792d96e4a, 0x0bcfdff529513daf }, { 0xb96866a8ab2767ce, 0xbda39ffea7ab9132, 0x75798c26202e6c07, 0x1a5fa7033161f19a } },
+    { { 0xffd7a5c34338aca2, 0x131619b9eb24cf09, 0xdc4ead5d671a8407, 0x120ae591df9fcfb8 }, { 0xd24874e7236198e9, 0xd7fe2aacbe47f4ba, 0xa451a2c2ef3cb001, 0x133d9c30fe190a2a } },
+    { { 0x078d48a4ec2ebfd1, 0x861247aafd8f17ef, 0x50a9c8d47352b162, 0x16c7b4399dd7f5ea }, { 0x7acba5782a8a8227, 0x8a72fe3277ef313a, 0xcd1d6c702d8877de, 0x17b92334f36b08b2 } },
+    { { 0x4dc0e208c3b8a2f5, 0x7eae608984b4608d, 0x50a804d7695187c1, 0x2144fef3cf203069 }, { 0x6332b93ee72c7e40, 0xa27d1413f65015e5, 0x7faa8166cb45ed1b, 0x3e7902c90b183ce1 } },
+    { { 0x624f3a3295fd4a0f, 0x3bebbd37fa24c0bb, 0xbf0925682bff91e3, 0x21aa8d152392ccb4 }, { 0xa8b7337fc2f722a0, 0x8d1b608ee6b8dae4, 0xbe7c42ee13b1f7fe, 0x2fdd497fc073435d } },
+    { { 0x8f2b4ddb5ca21aae, 0xed28da27a9c9a117, 0x286981d577f8d288, 0x36956307c36d4906 }, { 0x3b43962fc93275a5, 0x843f1add2a1bd023, 0xbbd12e1cb24ff3f8, 0x3856d1d78788d227 } },
+    { { 0xe76f2a4737cdacbd, 0x6e97ff1ca09ba597, 0xe4068672defabbe9, 0x240be361296a8bad }, { 0x5ae61895ca9545d9, 0xbaa316494941254d, 0x5f8060a85a22fc62, 0x383684734780cc0e } },
+    { { 0x449fb11323fc22cd, 0x03c71e06f7d78278, 0x89e8d05834076124, 0x36eab130f4dec59e }, { 0x94cd2e31014794dd, 0xeb8125562771e3ef, 0x0f980d8f8d92965f, 0x1c35bf8cf66a7d87 } },
+  },
+  // 2^224 * g
+  {
+    { { 0x0bd330775604cbee, 0x865900ba8edb9bfc, 0xe436892e3d8c7c58, 0x1805a0233dc24c8f }, { 0x7ce21b02893e5bf5, 0x72c755cb88b84c84, 0xa871a2a3c912505e, 0x31cbbe352b7e2745 } },
+    { { 0x381e13a1a51505c4, 0xba6074137a923acc, 0x394566c6af37b541, 0x1237ff167214eb8e }, { 0xc06d0a61fba7d578, 0x59b9f1135c7e2f15, 0x63ca22fc3d3bbc7f, 0x10e121eb2ef44070 } },
+    { { 0x50e773f068bca287, 0x22206d9320acf9d8, 0x6d56c1fa58b4a40b, 0x15335a9106ca7611 }, { 0x624c43d2f60ae3cf, 0x920f9cefc5f8d117, 0x0324168116468398, 0x3e87cec73355b95c } },
+    { { 0x63c54227d2434e27, 0xd7a5dcd9e84254e7, 0x7287cf068b049b8c, 0x26e1eac70e64dc26 }, { 0x1e030a6addfaec73, 0x8cebfe9ad8b36c42, 0xf53ee8919be938b7, 0x2c1c7d5d896b9be2 } },
+    { { 0x66f68858b02271f4, 0x331cbc6d403746fc, 0x43a074420821e0a8, 0x26bb4a81d4918913 }, { 0xae104ea930201956, 0xb95d43e61f5aecbf, 0x0a6d1755130f1de1, 0x3c5a950ebb0cc787 } },
+    { { 0x395888a67bc1c861, 0xf9a18d710e3b475f, 0xbd1184c4b76bfd1f, 0x3fcfdf9d9f7f6490 }, { 0x8e1514a570db2c4c, 0x7251e90d7a0591b1, 0x2a316b30e3fcf674, 0x2b2ea10122d862eb } },
+    { { 0x47777389ad0a5962, 0x64c77eb574c264ed, 0x3d7af5a7c9a91406, 0x2886d5ecc0bf1afb }, { 0xc0cad307c05c75e5, 0x84044caee70a7dd9, 0xd3c347497c54e5f0, 0x3861bcc4893571d9 } },
+    { { 0x4fa6a6b010f5b552, 0x21a0f43b388c3084, 0x241ca4af940b427b, 0x220a8419eadcfef4 }, { 0x54ca886e186de9f5, 0x909bde0a1681dd4a, 0xa611994b3f63bdd0, 0x2ad35eadb593659d } },
+    { { 0x642f3a3adf2cbb7d, 0x09b23b3332945da2, 0x46d16c15c5d86b58, 0x201908d247a5539f }, { 0x991eb11451aa7f25, 0x0240ba50c5e9a80c, 0xa4c629ea2c982b7b, 0x038391c627bfb427 } },
+    { { 0xe8033dcbfca3cbc0, 0xcffb6cb8934648b1, 0x165464beaee85f2e, 0x18f834b5f3b60b88 }, { 0x2a8c1d5a294bc669, 0x52c3b11aa2283b56, 0x7842c8ea02fae384, 0x1f53a7adf2b5eb3c } },
+    { { 0x1a0e6d9cfe5b2edd, 0xc229d7bf588cf381, 0x22ffe7bf02cb94ad, 0x34f7b92772a454d1 }, { 0x3cf21963ed715459, 0x119f5662d80d77cb, 0x88dd68f88838d807, 0x266a04f119c63d7d } },
+    { { 0x3ab2750b21673053, 0xdf6e3c03a8bd68fe, 0x8c45139769329ae6, 0x0c0e34334c8824d2 }, { 0xe764c48c6d689c1c, 0xea3b96f357285063, 0x1966d26bcc9e4864, 0x07a2aa2706a43898 } },
+    { { 0xe17ca84644febd58, 0x6de1064b6fd90b8b, 0x2d4b9d9638196774, 0x32183f7ccd8dd10b }, { 0x5fc71c620058e8c9, 0x244297c6e223d5a6, 0x3c3c7a26e225510d, 0x2b6eb0a6cdc445c2 } },
+    { { 0x3d8d1a52a300019b, 0xdc9336ab6dd81174, 0xfe953765548b4b70, 0x3c500cae3bf95c41 }, { 0x24d7fd8fb9d92c04, 0xdb0fc7283a6619e1, 0x5de6088232d8c51f, 0x253c51ace1ecf9e2 } },
+    { { 0x5c2976c2120775c2, 0x9801442d3513be61, 0xbdc1530906f489e7, 0x1b6cc5b0f7efb69e }, { 0x08c12a6caac73340, 0x63d753f23a1d6c48, 0xae7ac18bfd76057d, 0x1bc3b16d0c59ea87 } },
+  },
+  // 2^228 * g
+  {
+    { { 0x4f8fe32e2e69f1c9, 0x9164c67a8c79a49c, 0x0a46f7bc6f1f8878, 0x1d9bad2c6fef8da2 }, { 0x04b5f940cc61f7bc, 0xe40db1914efd4a5a, 0x22688ad26bc3cf3d, 0x3697f92b91f509f9 } },
+    { { 0x5961922229efba3e, 0xf9c3c65ea54863e8, 0xc51fb90a4d681176, 0x38f4b495b87f6395 }, { 0x7bc9765d9ca3497c, 0xdc8067d0e70a8b7f, 0x69e7f0d22dfd042b, 0x05c2dc09cbfe40a0 } },
+    { { 0x1a808421e4cd69ed, 0x88d1c3fad26a6509, 0xe6aa31260b533b16, 0x011a8ec5b2fc5dae }, { 0x9ed4aea7f149b70f, 0xab781faf461e6c3b, 0xca129943ad6716ce, 0x28f8ab7f7bcbf49e } },
+    { { 0x7dd5389d6182e3b7, 0xc63594188c727816, 0xc37cb9f839a270b7, 0x27529caaf9662bf2 }, { 0x093d0f5439ca5f7f, 0x4a5597d8e9acd4c9, 0x9abcaf1da5d3a629, 0x1cf8dbcb4b16a690 } },
+    { { 0x2955337e408e5093, 0x1444bcdc4cc3a651, 0x881236a77c5c2687, 0x169547b680933bbf }, { 0xcfeee333a0189ed6, 0xa9d8f785c98c8038, 0x0311c63f247e450f, 0x2923bf78aa35530d } },
+    { { 0x3923dcdd32b2ffcf, 0xb233eafb90c99fb5, 0xab1a91c87e75fafc, 0x2518ac34f4229a37 }, { 0xac43c83515836160, 0xeb34337014ffc041, 0x63f245d88dea7490, 0x280aadebe5e7d456 } },
+    { { 0xb991a772f2d8c03a, 0x35b7eb007be7a327, 0x7fc43bb2ecf320b9, 0x158d5bf7c8518293 }, { 0x86a3b4f8544ea6bb, 0x101bc09aae448fa4, 0x09175592ac54da5a, 0x3cee1851f1aa15ac } },
+    { { 0xffd8cb08587a6ceb, 0x3a7c6e4eeef45701, 0xe6d4be2b3d4e392e, 0x0c97cd873b042960 }, { 0x9e8fdf51b2c0a33a, 0x2fe7dd9e504fa839, 0x0060d50abca3f945, 0x1bacc1f37723d5de } },
+    { { 0x9ed66db87eabda0f, 0x60d8bfb17c596505, 0x3fa46e6ace716d51, 0x0e775c617c66d585 }, { 0x49f498a7dcdfe80d, 0x3c03e89b61e625fa, 0x5f06d93bcafe40c2, 0x36d309dee969387b } },
+    { { 0xf2419c0577e78981, 0x1a9ca29d04c15f8b, 0x55e57407ee07378e, 0x17715d902ef0a1b4 }, { 0xdefdf04de3ef801c, 0x83edc4aec1994389, 0x635601d7ea0d9b45, 0x17ab1d535fd93b5d } },
+    { { 0x9f0232b795f86ae5, 0xdf6f11622e526214, 0xd334ea55c5745e8a, 0x145337f9a1491740 }, { 0xd5a04a2cbe8c1330, 0x4eda20f6ec2320c9, 0x14f797d8c2ec6c09, 0x1dee1ef23adc02bf } },
+    { { 0x6054bf9758e013da, 0x5889a32c9e9ed73a, 0xf5cf55c8e93daf13, 0x2c2d95c87802cfd1 }, { 0x35bc635574f3cf2a, 0x3fe24e0752a493db, 0xb6f3691a4674d27b, 0x239a34d60114a429 } },
+    { { 0xb650d38ce8ee9d96, 0xb807f8b092eac81b, 0x12d7d8b532a2feca, 0x2919733541fbe1fe }, { 0x39ae5d373570ab40, 0x2b6c06e315242055, 0x5cb571b9e088ca6c, 0x11be2e23c3dcba86 } },
+    { { 0x9a422c250cbf7ec5, 0x04c0da3005981e50, 0x580d8ada6939b384, 0x2eca1a5252f66209 }, { 0xf2e01a2293ddbb14, 0x8f77d58913775e4c, 0x86d302d9374964f6, 0x1cadc60eccc75548 } },
+    { { 0x6a26c8110eef214a, 0x28c79d1da56675b1, 0xc7932bf10f03dd4f, 0x0f85dd7664304d2a }, { 0x0d597fad103f9420, 0xcd36d095097407ea, 0x507bfa7869490b67, 0x1684ee0b36f50dc0 } },
+  },
+  // 2^232 * g
+  {
+    { { 0xca2fcd00b4d0fbeb, 0x7d9828a61f981eea, 0x6e98779b6f570e7a, 0x32c9506a4deec47b }, { 0x897558e6085d9e29, 0x1723d60805448730, 0x554841a6ba82a074, 0x34593c8586479017 } },
+    { { 0xc904fb822a1e9392, 0x7ce53239bd2bfead, 0xc5a0ea62e6d6845a, 0x117347c740bcd00d }, { 0xd633e903f2ccfca4, 0xb6dacc9a4c45cef4, 0x15a5786f7b231ed0, 0x37d4d003c9243ece } },
+    { { 0x51f8c6390a925f0e, 0x6de65fdf175e18c4, 0x93e8b7279b0a4e77, 0x1b162da4d2ac52a1 }, { 0x8e57aef451d01d24, 0x5048071e4ac37665, 0x0dd0fcc81ffc146b, 0x20afa8045fed2ffa } },
+    { { 0x864119599db47d58, 0x77395d4e54719ebe, 0xe709a631b1e4fbda, 0x03895f5c4edbeb3b }, { 0x0a18617bb36e00bf, 0xdc30182058d7a6b3, 0x1cec189f59190be7, 0x3756f76906b8b6d5 } },
+    { { 0x1153ecb9a79b7441, 0xa9f0e434a1f41d2b, 0xc13b1dfd469c244a, 0x2fd2024639a83dd1 }, { 0x480f39ad4985327d, 0xc747ae6f594c207d, 0xb3ba00bee00fcd59, 0x0d1bd74a05cec88c } },
+    { { 0x432e95d0c03cb05b, 0x358a100634089091, 0x0bafee91fa5b39df, 0x30e9c4207484ca61 }, { 0x7f4bb6fdb697fd98, 0xb2b1c59b536a8d99, 0xcc40d40a2960fa99, 0x38f0dace3d7770cb } },
+    { { 0x9ee15988e52771a8, 0x03242882bb2ae56e, 0x4f0c9479f302a3dd, 0x1da7db4a18fc7510 }, { 0xe8a02a4db290b7de, 0xbbe120198cebd53d, 0xf87ad524409b1e9d, 0x138e992479331429 } },
+    { { 0x4df1bdf8e54b3f0d, 0x1efe1e37315199f9, 0x1eac9c9f90c6ddbf, 0x3990b66f65f40c01 }, { 0x27c1e2205ed0c339, 0x9001735406d0804a, 0xb9b997417a25b77c, 0x2eb7e5f48e728904 } },
+    { { 0xa001da299b6e3021, 0xbab99fcea9499661, 0xd9400dd5eb2249c8, 0x2d40f17e590e1dda }, { 0x89c636ddf3cc3a00, 0xbab4f98226fe8d71, 0x7fa4db445484574b, 0x20b4b2468775ab31 } },
+    { { 0x7af84a3a6bc83634, 0xcbfd9949a582e18a, 0xe0681f9feec64737, 0x0fb289b6d6c86a7c }, { 0xc864f20b0ec2268f, 0xc866ab181e1a9e0f, 0x1931e01c3aa62d8f, 0x092ce1bbc0ae23f7 } },
+    { { 0xe1201d5338e0a333, 0x6e7582e7e610527c, 0xd9e6dc6932311ea1, 0x272875026fe75748 }, { 0x7f0b7b5a5af634b9, 0xe0f368ee725f879a, 0x8c7cfa88c0aa8cf7, 0x02641c60ce1bcc8a } },
+    { { 0x1cecfece443e391a, 0xf3880ea5f63c1b06, 0x9136190cc3e5dfed, 0x0d82f4dee1e384aa }, { 0x6d4e80d6c05dded4, 0x225a5c924b74238d, 0x358314be74c0f937, 0x0f46d6efc87b8cb7 } },
+    { { 0xb51a07da53d7074b, 0x0ed876576e42fa3d, 0x3675703c108a5e4c, 0x00dc2e772d7c55bd }, { 0xc4e6b2708460360f, 0x9855c8202ee5c16a, 0x79d200628aedac65, 0x0ccf828c3db966b3 } },
+    { { 0x8d673cab905183c2, 0xc264c9b8a02738e8, 0x9921e8f4cbbc0c6d, 0x21c7815874d2a742 }, { 0x800f326a76bec1ff, 0xe28872667e7effab, 0xac9fa034b8ca3933, 0x3ce985a828c521c9 } },
+    { { 0x9819b47665d2b5cf, 0xe2ac8bd84b07d456, 0xd4ee8c3461eb3fe2, 0x1ed487c2c30095c0 }, { 0x3669bcb94a881feb, 0xf3816668735518ba, 0x7a06b6341a4a5721, 0x1efe6c857b30d40b } },
+  },
+  // 2^236 * g
+  {
+    { { 0xdeb2ff436ab3851e, 0xd48766566a75d4a4, 0xe3a9b2e163083891, 0x1aa6a2993e93446f }, { 0xb5ac9fb7534f2718, 0x9dbdcadcec6f3e76, 0xe6cd9e52a032c925, 0x26fde61a8b1d3185 } },
+    { { 0x0045897b2ef1ba7c, 0x81b0dfe430e751ee, 0x2541411a7aa7c3ba, 0x3f90bdb6ac079c43 }, { 0xa07eb3b19939abf7, 0x67977d709429f272, 0xcd6555a15cb69c21, 0x3dffdaf9886eaf76 } },
+    { { 0x1087a77b02e0d16d, 0x7d2db9321a6e5db4, 0x43d3b16b1eb145b6, 0x2085122bff5f9354 }, { 0xb7fcc90e9355d942, 0xb720376eeaf830be, 0x252199949d784c18, 0x1d2f7eb2f5ffd926 } },
+    { { 0x1bf8552daa3977e1, 0x51a189c6e0d389cc, 0xc4935dfab5f19775, 0x308e88da1ecb418d }, { 0xbf39fb8b954f7420, 0xd2b8f579bdcb51cc, 0x56a3fa56767c2c27, 0x21a6062f6e04d26c } },
+    { { 0x4a3aaadcd6ce324f, 0x2fd68a8be1e0f090, 0xb28e422c9331a9a5, 0x0aca664998fdecf8 }, { 0x5398a3dff4e6c026, 0x63a0cd13723f9626, 0x34ca96285fbe368d, 0x335a3eb9cc26fd0c } },
+    { { 0x7ba738960ac1cc06, 0x5df1a1892504ef6b, 0x30d75c039c2db0fc, 0x1a20194c6c182cf0 }, { 0xb4debd51f8741270, 0xf77b80016c836547, 0x3c24ae7e25f15d49, 0x38a6eac645cfc48c } },
+    { { 0x934316cdfe9a8767, 0x54835b281771b982, 0xfdbc4a6e4b7f2842, 0x00d8ff6b207c0e6b }, { 0x6d11fb42bb889dfb, 0xacd499a6ee2535ee, 0x3a5dfea15f28d036, 0x29e00f6bbdb6f0a4 } },
+    { { 0xd2e25b03f494788d, 0x331cdfa42860b942, 0x6bf8f1331408987a, 0x3c3e6326b3bf8c6c }, { 0x5706c6c03b8ddb31, 0x072ff1d7a4397ebe, 0x3a42d70b4d3922bf, 0x0eaeab422894dc19 } },
+    { { 0x8e985ec770155103, 0x6cd49a8005fdaef8, 0xb7862bbd96d98951, 0x1329af1956530afb }, { 0x775aef3048d3a4c8, 0xb56de603c51a9f07, 0xc8d090c161aa3128, 0x34e1aa13a18f05aa } },
+    { { 0x04c9f044edbbb1fd, 0x97353940133e236f, 0x4b93bb547b2381ba, 0x13f088f1ac236e18 }, { 0x993a07bea0f7a1c6, 0x44833223e5b0560a, 0xd6cbd06c7f1747f6, 0x095c3aa1eedccb15 } },
+    { { 0x77afbc9710c5e9f7, 0xc7ba2cc6defa6231, 0x3ce81c6973db3184, 0x00b7c4baa925b76c }, { 0x20acd4193a90f545, 0x49de7bd83fdacc25, 0x98991c25261e59b7, 0x07510c173b65c0e8 } },
+    { { 0x3027705502fa6ed3, 0x1e99f90dece6cc96, 0x55edf6eeb4833c92, 0x09127ec58b3e52b3 }, { 0xbcf67f6d445b4558, 0x80d0678571043000, 0xa9ae15cc4087b107, 0x286f10129ff182ef } },
+    { { 0xf8ce1f7cab68164b, 0xe8e1cf56e34a152b, 0xf8a088ca4c006ba0, 0x3c56c8aa7f30dd25 }, { 0xcf74851479bef582, 0x544ea9401096db12, 0x768c1f58c91489f2, 0x11c63cfdf9a053ce } },
+    { { 0x356f5b80d27d1d74, 0xfa5628f15a755cf4, 0x54899c86aa16e07d, 0x2517e35829436ccb }, { 0x3b8b8d5eb8ef0eea, 0x4588ac641bc8468c, 0xf6df716b1f996d40, 0x39b7fb5dab946896 } },
+    { { 0x79334036ac48b27c, 0xe322d0176c6043df, 0xf594548bf8c4ff96, 0x0695845e11712065 }, { 0xd388c6a7511bddd5, 0xd8defbfc34477b3e, 0x3eb5b7dc6ad52b25, 0x3e9e96a1a8fa3616 } },
+  },
+  // 2^240 * g
+  {
+    { { 0x6b9993536155c2d9, 0xf66790890e15bc0a, 0x9539e2fc21c71289, 0x3a9d375377a54053 }, { 0xbbb4a21590163ff7, 0x30f52b322bc0ef5f, 0x16e6b358f047a77e, 0x2371443aa17233cb } },
+    { { 0xdc89a2f9dec85ab2, 0xc6af6b122e276c53, 0xf4d409a23b1a499e, 0x1ec1b8cbcc5633c7 }, { 0xff591c6c47cb6122, 0x3e27432f65be62fa, 0x037a9d4ce82f0141, 0x37eec08282192ca0 } },
+    { { 0xac9d3498159a5b6d, 0x4b881add90d5c095, 0x314e4e09789290ba, 0x0870df7ee4b356ed }, { 0x8a801914b97ccd20, 0x24d4641bfcfe0f77, 0xd13f0aff3d28654d, 0x02a3f64ec774d6cd } },
+    { { 0x65d8311acaf84df3, 0x34fd71c12beb0d7b, 0x521d07d876e872fc, 0x147763beb549a25b }, { 0x2636c3ce6c2c43bf, 0x94494856ac5a2e2c, 0xc41233aa37fe5366, 0x196ce821a949dcd4 } },
+    { { 0x1a137d21536c207e, 0xd4206ff49009f996, 0x0d5369cf935bcb45, 0x3bb90644fbce8e44 }, { 0x380bfed181d3ca53, 0x04656834bdbca0bf, 0x8a0aaa02cf33b241, 0x1ca817d15f3ea9a5 } },
+    { { 0xe6498cec04b096f5, 0xe22642412665566a, 0x7cc0f8816f81a788, 0x21e27a51429b0e7a }, { 0x070a095a3e32082a, 0xcb33586ffa57f7bf, 0x5b93259cc0999f40, 0x1f64b632b258d60c } },
+    { { 0x6055ce241605cacf, 0x1b3590f988f2c600, 0xfaf3f67df4147838, 0x2d9e16d6722e9027 }, { 0xe26306925d1a4222, 0x42c0ea4393da1183, 0x9b0cef879fed7d1a, 0x3fde9c87984b5b07 } },
+    { { 0xf487301ca106d8f7, 0xd8181872c4a681de, 0xbd0bde98fce6f5f1, 0x145fd895a38f837b }, { 0x17163d5b370dc1c9, 0xd12484ab1b69234f, 0x62be1a8694976163, 0x0901fc5cf2a3b071 } },
+    { { 0x48f4158c8db428f2, 0xdf86377c817ccf10, 0x496ed6828add0cc0, 0x04ae7f6ac38b5c81 }, { 0x6269bc96d3a59168, 0x2e4d7a4077596a32, 0x027ccd57aea9a922, 0x2bbb1e672a25d548 } },
+    { { 0x7bad0549793bd872, 0xda2eb827f8b94a66, 0xad4f9d0e626a5e08, 0x258cda567960b3d0 }, { 0x5a0341cb9b5b780a, 0x1b96e3fa0b02039a, 0xb3d2c800fa7b5973, 0x3146835fda710c6f } },
+    { { 0xf41b10c0cc1444ee, 0x05fd51ae24351fa2, 0x77c41e5eb087a28f, 0x0b967d14725e0fb7 }, { 0x2d47f687ead94220, 0x56304b8062844f04, 0x94e33906518b2a79, 0x128c3d3c01e958c0 } },
+    { { 0xcdc03521feb483da, 0xf94794cf427709d7, 0x242b7271204f3ed9, 0x3fc093faa3542803 }, { 0x921bc40897fbcc17, 0xe9121809dc983ab0, 0x256e97ef5f6f8575, 0x0305ddda40200761 } },
+    { { 0x485f9c4943883c11, 0xaeedd89c35adc545, 0xb174dc27860c2c52, 0x2b7ada8a688371ce }, { 0x3c95899c1e5d482d, 0xe6ad8c2a9462ca98, 0xcdb072ff619f36d5, 0x1584a8fb1b6ec960 } },
+    { { 0xdac36d4f47353d14, 0x1a2b41cfddc3692c, 0x65266428f93eac5b, 0x36de588c6e54c7f7 }, { 0x2d60259e755e647a, 0xad1ea30caa0c9791, 0x3fd2843de9ad2370, 0x3d8c72445415e638 } },
+    { { 0x993add2424f4e5d3, 0xb13117701e4fb260, 0x268d78ba3fe6d2e8, 0x162712ab3e6c5679 }, { 0x2ab3625c5ea3f23d, 0x288099aca8fa4074, 0x209bf6f02489c042, 0x3788298c9c8f4b10 } },
+  },
+  // 2^244 * g
+  {
+    { { 0x3b4ee966e57e0055, 0xd4ebb58ecc3427a5, 0x46c2d73435711dfe, 0x2b6e39d6d22e22f0 }, { 0xcd8eab1e5dac2031, 0xfe8439c9a96ad6e2, 0x10b558f9e6b6d14d, 0x291ace2c7923a606 } },
+    { { 0xb5e0859a1b9a3c6b, 0xc85fe5da16809457, 0x3a157edc32702726, 0x210841e13a10ad6f }, { 0x56c0507b4753b929, 0x686bea5ffcc22e58, 0x985024e80d179578, 0x1e86c89b9d4de936 } },
+    { { 0xa9fe35306ddf2896, 0x8c49860f7f0c4750, 0xfb680592970f7d57, 0x12f5ad23d9d727f6 }, { 0x464a22fce8ce33ac, 0xe44cf0486a427e9f, 0x70f97287559f92f0, 0x24252552149761d2 } },
+    { { 0x3733fb61b1f97e76, 0x6fa963df3feb70bb, 0xc1cea3af0ace55eb, 0x32f9a5648d890f7a }, { 0x1e0dd59b4ca690ec, 0x7c67394761d3026d, 0x8755d335c4fc1856, 0x38dd6f79b03d6d1a } },
+    { { 0xa88577a5e442ac1c, 0x01b7e712985780c1, 0xcd5c616aa7b61faf, 0x0f41d5f6da0c7f35 }, { 0x331ff93a6f3d5582, 0x8a36d77595743a1f, 0x9296b071666672a2, 0x0db76d03686c9512 } },
+    { { 0xbceaef2863f784e9, 0x9c10d1a5fc3e94e1, 0x407a13532212fcc6, 0x1b7d76006e8b97c6 }, { 0x411d4ffd76f84db4, 0x8e7cd1b7459d4706, 0xedb29eec7a057323, 0x378b0014b13c5a0b } },
+    { { 0x9f223ad0c260f197, 0x50d882f0ed580945, 0x9c711702070a8d88, 0x15ac52100611e1ca }, { 0x0ce0ab4855e386d0, 0x16b88cef1b3955a1, 0xd5772d608c56d7f7, 0x397f05acc4b285cc } },
+    { { 0x5acb95b6bdc4a319, 0x766906f8650007c6, 0x2f68968e979e2dbf, 0x34efe9f08ab79c65 }, { 0xe6d5cad9409d8b1e, 0xc4a79a127f84cede, 0x72bfef42249e568a, 0x0e2bb43774afa77e } },
+    { { 0x29bbbaf1992b89ab, 0x0f32bb62ec02fb6d, 0x4fe77d6db6338be3, 0x397797e2591f8eb1 }, { 0x952137a910462fdd, 0xfff552d38ece3587, 0xbf917f0411937f92, 0x1ca4f315c396b313 } },
+    { { 0x5fc1c73838a46b9e, 0xf545ac56f893cc81, 0x6483aba52537b188, 0x24d15a71caf63163 }, { 0xb72e48f2068e227c, 0x966e630eb75669f1, 0xd28fbb572284745b, 0x02c1a4da2b503454 } },
+    { { 0xf7bb8384794e9ab0, 0x3de99a2ba0c44c81, 0xe7654711a064797f, 0x0fb0d5345a86c9da }, { 0x8b5066b0f3272c06, 0x4ac6bc80d47b1b84, 0xed6a893d1fb95abd, 0x17d3fd95cfafd7de } },
+    { { 0x4444c30e68cde73c, 0xb77b5e0ceb6c4e1d, 0x772d8bc032bc104f, 0x39d32c7c1cb42fe8 }, { 0x472bc0c4c92d9918, 0x3adf058e50662c8b, 0x84a0f6b0791fc6d7, 0x0bb2b393d0776d50 } },
+    { { 0xdbbbb014de831e8a, 0xe2434230c13f71a0, 0xe8b2f0c54a7db09a, 0x3e0a4198d7c173b8 }, { 0xee0ae15a914bc1f1, 0x4e0f85a1fe58cef4, 0xb2ac4ba4371a72ce, 0x17cbed79036d65d0 } },
+    { { 0x4b0b6eee25efb5d4, 0x2371800441c1217a, 0xfa2478ee293c2014, 0x0482560e15fdebb6 }, { 0x2512e79689a7f8ba, 0x0530680059538b9a, 0x1888ff0e894bf7e5, 0x0b38b3ef40be10f0 } },
+    { { 0x763e4827438e83aa, 0x8e1dbca51b30e571, 0xf97c3c210bc27a0a, 0x06718c8628065213 }, { 0x8785b7976a1c0de6, 0xa14c7b1f9c535ef5, 0x35686720bd3c0bc7, 0x1e5f1c62346ab997 } },
+  },
+  // 2^248 * g
+  {
+    { { 0x2befc13fdf7bfa68, 0xa007ab4d5a79ea3c, 0x26e7954ec85a8b93, 0x0095dc11c5ae5f8f }, { 0x6d6de4080591c778, 0x69923e48f932b67c, 0xfd204f49b26ac07b, 0x2f8fc6be5bc42f4e } },
+    { { 0xf4de1f568fdcfe46, 0x64d1f75780dfdb04, 0x37bea9e083d71181, 0x2a0df96c1dde77db }, { 0x55db5029b7f3dad0, 0x7d6b46ae4744d943, 0xfd4b830776489a1b, 0x231ac5f5d6709335 } },
+    { { 0x743e51b453b77943, 0xdc19e89300396458, 0x9e02dc741d8fb143, 0x1b6c75827c0e5337 }, { 0x5d6ba29bb8ce78da, 0xeb889a2fc3a56265, 0xc202236ce3b9ce99, 0x2e1e9bcae8cb9a60 } },
+    { { 0x7ba09fb6fb5879bd, 0x3c2d426b39a11999, 0x5401312abc5bacb5, 0x3cfb7d46c8565217 }, { 0x61821ea666b2329a, 0x43ca3be37dab808b, 0x98ba1d85996ce694, 0x0bf2bd25275350dd } },
+    { { 0xf3ef50dfb424e566, 0x374ae2d746008e22, 0xcd23311b329733c7, 0x26c0c540a5d29b82 }, { 0x2ca8764ba76c97b2, 0xbb04db65bfc4d90b, 0x752cf49c3108b5fa, 0x2f923fe49c773704 } },
+    { { 0xc4701a3f6e4b4620, 0x9e4bd01b16e61187, 0xe0d9c3c49fde36d3, 0x39ae81b2f97ec126 }, { 0x7acaaccc227990b7, 0xb74c3cb0381a6fa7, 0x30dda9a6f2948ede, 0x3904a7cdfec11b57 } },
+    { { 0x81c3514ff5ae9f4d, 0x69ebc758be3eaeb5, 0x357fc237281d7005, 0x0fcfd588d7d96b57 }, { 0x839f28c46f50b186, 0x40daa5e7b087704b, 0xeb8efd6dd7a1ad23, 0x3adca80af8c7262c } },
+    { { 0xb83a6930e961a4b0, 0x63a9b1c0efa3610a, 0xbccf9edb8692d1c4, 0x36a3dc44fb44313a }, { 0x70546d55c5a8e6b2, 0x5fbe60982c0741f9, 0x03471b5b1c35ee50, 0x312abaf2f190efb7 } },
+    { { 0x950429f162ea6dd8, 0xaa217f3bea008dd4, 0x33cf0c26de1a851f, 0x0bd3b06aae1c2b0f }, { 0x9f1a58b2c47a5f03, 0x374bd37ebff1c474, 0xc0d839a69dbf4cc7, 0x1240ec5cde9401a3 } },
+    { { 0xd70a926fd661c9e3, 0x7fd5170b245cbcc8, 0xb8ae06c91cf264e6, 0x2278a79af6f41648 }, { 0x2823e2bd02d9ac20, 0x80cd584ef0b3b596, 0xb64f66ee187f0186, 0x05890fecc679ba82 } },
+    { { 0xbc150ed286eb785a, 0x78bd6763d0c39bb2, 0xa54bbae41a516d00, 0x01666bdba14bcbb2 }, { 0x5600585a70fe001d, 0xb0a2ef8a0f24c657, 0x143ce6e524290ff7, 0x0ef2b7415e5cca5e } },
+    { { 0x1d2fffe0f70ef70a, 0xb02ada35478775aa, 0x087f8de4760c4f5e, 0x3220c54a62e9e0be }, { 0x49b906bcae2f81f0, 0x08886cf75a83a4ad, 0xa117b954dc513eb6, 0x0448192eac93e4f5 } },
+    { { 0xcb5742447198ba82, 0x1ef08c945ff08162, 0xae9fe29a46366b02, 0x292e1710918a0040 }, { 0xe39febf8dbfeb3a3, 0x39c3bb8107c99bd2, 0x53efec80c2f764f7, 0x22037508d4bfc8c3 } },
+    { { 0x75c1a79351d1c0ac, 0xd1e2defc3b6a4bf2, 0x4965a624faa37e9e, 0x0fe81d81dcd5c72b }, { 0xb214079ac34d5041, 0x99860105d8bf8853, 0xbc06ae25ecc54094, 0x0c196c2b42685d27 } },
+    { { 0x58ed8a2068a644cd, 0x8e75d71d4d77c0ad, 0xecef77ae4076b795, 0x1ee9fb186899749d }, { 0x63354baef72e21ed, 0xb88a979ca66222ed, 0xbfb8ed6ab8d3b65a, 0x124df9021ac94222 } },
+  },
+  // 2^252 * g
+  {
+    { { 0x9000600d7677a559, 0xd88901b7ce15489d, 0x740c8ed233686b19, 0x144b54d8ddb5d3f1 }, { 0xaafd8e84483ea23e, 0x99ababf18e0acdb9, 0x86a04063ada1d91c, 0x10a2af676f2fb119 } },
+    { { 0x3ccd58d116ea35fd, 0xbd547b43a5bd3866, 0xc77fd8d98d23f415, 0x1e4b357ae2dce88e }, { 0x731193147cc8cd0b, 0xbde6126ad89b01f5, 0x7b550c238dbbbbe1, 0x05271d9df25870ce } },
+    { { 0xd26bb0dbed801ae7, 0x22db69bac9361da8, 0x69052b40da6e3450, 0x2e7428b2fb9a47b0 }, { 0x31ca3a3638f07926, 0xbb10e1ec2b63c8e8, 0xc187abb3e02c7572, 0x086b8839e5a7278e } },
+    { { 0x99183972f9615eb1, 0x56852dc055665105, 0xa731e6ff8ec4eac3, 0x352eb4ef56658c03 }, { 0xa19aaed9b5baf251, 0x80f1aa6425e75db7, 0x7126f0a496d8cb0f, 0x2c554f69d8c629da } },
+    { { 0xba5bf1bc193e9362, 0xd026855629d79085, 0xa1bc1ee7bcd551b4, 0x3ccc65e275297e48 }, { 0xce493a668248d51b, 0x35e53bf6997be085, 0xe6023740c077b4e7, 0x235a24211f194a7d } },
+    { { 0xc2094689c1b46cf0, 0xc7e8eb42fa085e9f, 0x7fca4d68311b4d5d, 0x25ea79877c8de082 }, { 0x96849ff1decc7025, 0x97eba782f4dc8e9a, 0xf1b770b45b5586f7, 0x2a303ec9a5f4ec7f } },
+    { { 0x5b8a42288e2f5bc1, 0xb273c09e8ab67c60, 0xa76d3824ebca4bf7, 0x245d941ec61a577e }, { 0xc263a5d819c3fdff, 0x1d6dc35f287d2fe7, 0xd46003d513f634fe, 0x2f7426c62a40a8c9 } },
+    { { 0xfd6ce58e67754f9f, 0x27bdf8bb6f0755d3, 0xb8cd5e385e3a943d, 0x29f3c748827e7818 }, { 0x5c96fd4d3ba371bd, 0x7202fe4c342f5e25, 0x20605ca5f9381bd4, 0x3386fd5c591a7f0b } },
+    { { 0xf3589cf3898e99de, 0x95d483a25ce8a6d7, 0xd714806cecf194c1, 0x1a0fb4ff1c09a6a2 }, { 0xc872ee7b2da9aac4, 0x096617d5d842105e, 0xae6ec33e04492f61, 0x1cda65d2cab2f1e4 } },
+    { { 0x8af17a70c6768788, 0x7c51e4abe7f15aa0, 0xf0fb7670649b0472, 0x2697156b91ac745e }, { 0x5814b37cf8de7b47, 0x156ef37b01c0d86b, 0x0d2775aa2940a2a3, 0x0367ca3eb5d84ace } },
+    { { 0xc582a23a963ee237, 0x919cf0181bdfcda2, 0xcdd3c0da31cf1915, 0x3937ebb09d6e6330 }, { 0xfd6add2205624787, 0xcc6a8b167b672312, 0xf70e8de8eba49b36, 0x27d6b3fa22c9ae75 } },
+    { { 0xed8505b87e114fa4, 0xc5e817d13f01fdab, 0xe73af0a01cc12b10, 0x3f437c2dff337230 }, { 0x05c7a24282e33547, 0x25ea2c0dbae305a4, 0xb98afa8ccc7c5bb8, 0x22a82fbc145e052c } },
+    { { 0x6443bff04ba3fdde, 0x96f804f43f169742, 0x2b2b0610d0aa091e, 0x03e2f2537b35c792 }, { 0xfad2d6de8205675e, 0xe903db139be944a7, 0x0480e12388b35df9, 0x015fb5c3537c387b } },
+    { { 0xf8c793146d472710, 0x9b4ac8a469900117, 0xbad604b9313279ec, 0x096976c5b356af6e }, { 0xdc9c1e4033343a05, 0x91955b7f613601e1, 0x0ae7c40386a6aebd, 0x2178e6210dccf6ec } },
+    { { 0x8f7d4f2a536f2272, 0x94debb254d79343d, 0x596be8c5bc5821f3, 0x39e0d56e55f72d48 }, { 0x276101ff9bc4e627, 0xa0a98b7ab3454688, 0xa8fae9ac6c0e2ab9, 0x3f77ca3cdf843160 } },
+  },
+} };
+#else
+#error "no generator table for GENERATOR_TABLE_WINDOW_BITS, run tools/gentables.py"
+#endif
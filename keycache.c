@@ -0,0 +1,252 @@
+#include <pthread.h>
+#include <stdatomic.h>
+#include "keycache.h"
+
+#define KEY_CACHE_MIN_SLOTS 64
+
+// Marks the slot of a removed key, so probes for later keys go on
+static PreparedKey KEY_CACHE_TOMBSTONE;
+
+// Memory a lookup may still be reading: a table, or a key to wipe
+typedef struct key_cache_retired {
+    void *p;
+    bool is_key;
+} KeyCacheRetired;
+
+typedef struct key_table {
+    size_t mask;
+    _Atomic(PreparedKey *) slots[];
+} KeyTable;
+
+struct key_cache {
+    _Atomic(KeyTable *) table;
+    pthread_mutex_t lock; // held by writers
+
+    // under lock: live keys and tombstones in table, and what
+    // key_cache_collect frees
+    size_t used;
+    size_t tombstones;
+    KeyCacheRetired *retired;
+    size_t retired_len;
+    size_t retired_capacity;
+};
+
+// x is uniform in Fp for keys that are not chosen adversarially, and a
+// multiply mixes in the parity and the other limbs
+static size_t key_cache_hash(const Compressed *pub)
+{
+    const uint64_t h = (pub->x[0] ^ pub->x[1] ^ pub->x[3] ^ (uint64_t)pub->is_odd) * 0x9e3779b97f4a7c15ULL;
+    return (size_t)(h >> 17);
+}
+
+static bool key_cache_same(const PreparedKey *key, const Compressed *pub)
+{
+    return key->pub.is_odd == pub->is_odd && memcmp(key->pub.x, pub->x, sizeof(Field)) == 0;
+}
+
+static KeyTable *key_table_create(size_t slots)
+{
+    KeyTable *table = calloc(1, sizeof(KeyTable) + slots * sizeof(_Atomic(PreparedKey *)));
+    if (table) {
+        table->mask = slots - 1;
+    }
+    return table;
+}
+
+// Slots for n keys at most half full
+static size_t key_table_slots(size_t n)
+{
+    size_t slots = KEY_CACHE_MIN_SLOTS;
+    while (slots < 2 * n) {
+        slots *= 2;
+    }
+    return slots;
+}
+
+static void key_cache_free_key(PreparedKey *key)
+{
+    // the private key must not outlive the cache in freed memory
+    volatile uint8_t *p = (volatile uint8_t *)key;
+    for (size_t i = 0; i < sizeof(PreparedKey); ++i) {
+        p[i] = 0;
+    }
+    free(key);
+}
+
+static bool key_cache_retire(KeyCache *cache, void *p, bool is_key)
+{
+    if (cache->retired_len == cache->retired_capacity) {
+        const size_t capacity = cache->retired_capacity ? 2 * cache->retired_capacity : 16;
+        KeyCacheRetired *retired = realloc(cache->retired, capacity * sizeof(KeyCacheRetired));
+        if (!retired) {
+            return false;
+        }
+        cache->retired = retired;
+        cache->retired_capacity = capacity;
+    }
+    cache->retired[cache->retired_len].p = p;
+    cache->retired[cache->retired_len].is_key = is_key;
+    cache->retired_len += 1;
+    return true;
+}
+
+KeyCache *key_cache_create(size_t expected)
+{
+    KeyCache *cache = calloc(1, sizeof(KeyCache));
+    KeyTable *table = key_table_create(key_table_slots(expected));
+    if (!cache || !table || pthread_mutex_init(&cache->lock, NULL) != 0) {
+        free(cache);
+        free(table);
+        return NULL;
+    }
+    atomic_init(&cache->table, table);
+    return cache;
+}
+
+void key_cache_destroy(KeyCache *cache)
+{
+    if (!cache) {
+        return;
+    }
+    key_cache_collect(cache);
+
+    KeyTable *table = atomic_load_explicit(&cache->table, memory_order_relaxed);
+    for (size_t i = 0; i <= table->mask; ++i) {
+        PreparedKey *key = atomic_load_explicit(&table->slots[i], memory_order_relaxed);
+        if (key && key != &KEY_CACHE_TOMBSTONE) {
+            key_cache_free_key(key);
+        }
+    }
+    free(table);
+    free(cache->retired);
+    pthread_mutex_destroy(&cache->lock);
+    free(cache);
+}
+
+const PreparedKey *key_cache_find(const KeyCache *cache, const Compressed *pub)
+{
+    // acquire pairs with the release of key_cache_grow and of the slot
+    // stores, so the table and the key behind each pointer are complete
+    KeyTable *table = atomic_load_explicit(&((KeyCache *)cache)->table, memory_order_acquire);
+    for (size_t i = key_cache_hash(pub);; ++i) {
+        const PreparedKey *key = atomic_load_explicit(&table->slots[i & table->mask], memory_order_acquire);
+        if (!key) {
+            return NULL;
+        }
+        if (key != &KEY_CACHE_TOMBSTONE && key_cache_same(key, pub)) {
+            return key;
+        }
+    }
+}
+
+// Copies the live keys into a table sized for them, drops the tombstones
+// and retires the old table. Under lock.
+static bool key_cache_grow(KeyCache *cache)
+{
+    KeyTable *old = atomic_load_explicit(&cache->table, memory_order_relaxed);
+    KeyTable *table = key_table_create(key_table_slots(cache->used + 1));
+    if (!table || !key_cache_retire(cache, old, false)) {
+        free(table);
+        return false;
+    }
+
+    for (size_t i = 0; i <= old->mask; ++i) {
+        PreparedKey *key = atomic_load_explicit(&old->slots[i], memory_order_relaxed);
+        if (!key || key == &KEY_CACHE_TOMBSTONE) {
+            continue;
+        }
+        size_t j = key_cache_hash(&key->pub);
+        while (atomic_load_explicit(&table->slots[j & table->mask], memory_order_relaxed)) {
+            ++j;
+        }
+        atomic_store_explicit(&table->slots[j & table->mask], key, memory_order_relaxed);
+    }
+    cache->tombstones = 0;
+    atomic_store_explicit(&cache->table, table, memory_order_release);
+    return true;
+}
+
+MinaStatus key_cache_insert(KeyCache *cache, const Keypair *kp)
+{
+    PreparedKey *key = malloc(sizeof(PreparedKey));
+    if (!key) {
+        return MINA_ERR_NO_MEMORY;
+    }
+    prepared_key_init(key, kp);
+
+    pthread_mutex_lock(&cache->lock);
+    if (key_cache_find(cache, &key->pub)) {
+        pthread_mutex_unlock(&cache->lock);
+        key_cache_free_key(key);
+        return MINA_OK;
+    }
+
+    KeyTable *table = atomic_load_explicit(&cache->table, memory_order_relaxed);
+    if (2 * (cache->used + cache->tombstones + 1) > table->mask + 1) {
+        if (!key_cache_grow(cache)) {
+            pthread_mutex_unlock(&cache->lock);
+            key_cache_free_key(key);
+            return MINA_ERR_NO_MEMORY;
+        }
+        table = atomic_load_explicit(&cache->table, memory_order_relaxed);
+    }
+
+    // a tombstone is not reused: a lookup probing past it for this key
+    // could otherwise miss it
+    size_t i = key_cache_hash(&key->pub);
+    while (atomic_load_explicit(&table->slots[i & table->mask], memory_order_relaxed)) {
+        ++i;
+    }
+    atomic_store_explicit(&table->slots[i & table->mask], key, memory_order_release);
+    cache->used += 1;
+    pthread_mutex_unlock(&cache->lock);
+    return MINA_OK;
+}
+
+bool key_cache_remove(KeyCache *cache, const Compressed *pub)
+{
+    pthread_mutex_lock(&cache->lock);
+    KeyTable *table = atomic_load_explicit(&cache->table, memory_order_relaxed);
+    for (size_t i = key_cache_hash(pub);; ++i) {
+        _Atomic(PreparedKey *) *slot = &table->slots[i & table->mask];
+        PreparedKey *key = atomic_load_explicit(slot, memory_order_relaxed);
+        if (!key) {
+            break;
+        }
+        if (key != &KEY_CACHE_TOMBSTONE && key_cache_same(key, pub)) {
+            // a key that cannot be retired stays in the table
+            if (!key_cache_retire(cache, key, true)) {
+                break;
+            }
+            atomic_store_explicit(slot, &KEY_CACHE_TOMBSTONE, memory_order_release);
+            cache->used -= 1;
+            cache->tombstones += 1;
+            pthread_mutex_unlock(&cache->lock);
+            return true;
+        }
+    }
+    pthread_mutex_unlock(&cache->lock);
+    return false;
+}
+
+void key_cache_collect(KeyCache *cache)
+{
+    pthread_mutex_lock(&cache->lock);
+    for (size_t i = 0; i < cache->retired_len; ++i) {
+        if (cache->retired[i].is_key) {
+            key_cache_free_key(cache->retired[i].p);
+        } else {
+            free(cache->retired[i].p);
+        }
+    }
+    cache->retired_len = 0;
+    pthread_mutex_unlock(&cache->lock);
+}
+
+size_t key_cache_size(const KeyCache *cache)
+{
+    pthread_mutex_lock(&((KeyCache *)cache)->lock);
+    const size_t used = cache->used;
+    pthread_mutex_unlock(&((KeyCache *)cache)->lock);
+    return used;
+}
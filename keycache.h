@@ -0,0 +1,45 @@
+// Concurrent cache of prepared keys, looked up by public key
+//
+//     * Lookups take no lock and write nothing shared: the table is an
+//       open-addressed array of pointers to immutable PreparedKeys, read
+//       through one atomic pointer that writers replace when it grows.
+//
+//     * Writers (insert, remove) are serialized by a mutex. A key is fully
+//       built before its pointer is published, so a lookup sees either no
+//       key or a complete one.
+//
+//     * Memory that a lookup may still be reading is not freed at once:
+//       replaced tables and removed keys are retired, and key_cache_collect
+//       frees them. The caller calls it at a point where no lookup that
+//       started before the matching writes is still running, e.g. between
+//       two pool_run calls when only pool tasks look keys up.
+
+#pragma once
+
+#include "crypto.h"
+
+typedef struct key_cache KeyCache;
+
+// Room for about expected keys before the table first grows. NULL if out
+// of memory.
+KeyCache *key_cache_create(size_t expected);
+
+// Frees the cache, its keys and everything retired; no lookup may be
+// running
+void key_cache_destroy(KeyCache *cache);
+
+// Prepares kp and adds it. Adding a key that is already present keeps the
+// present one. MINA_ERR_NO_MEMORY on failure.
+MinaStatus key_cache_insert(KeyCache *cache, const Keypair *kp);
+
+// The key with this public key, NULL if absent. Valid until a remove of
+// this key is followed by key_cache_collect.
+const PreparedKey *key_cache_find(const KeyCache *cache, const Compressed *pub);
+
+// false if the key is absent
+bool key_cache_remove(KeyCache *cache, const Compressed *pub);
+
+// Frees the tables and keys retired by earlier writes
+void key_cache_collect(KeyCache *cache);
+
+size_t key_cache_size(const KeyCache *cache);
@@ -9,7 +9,8 @@
 extern "C" {
 #endif
 
-extern bool (*b58_sha256_impl)(void *, const void *, size_t);
+// The 58 digits in order of value
+extern const char b58digits_ordered[];
 
 extern bool b58tobin(void *bin, size_t *binsz, const char *b58, size_t b58sz);
 extern int b58check(const void *bin, size_t binsz, const char *b58, size_t b58sz);
@@ -93,7 +93,11 @@ int main(int argc, char* argv[]) {
   generate_pubkey(&kp.pub, priv_key);
 
   Signature sig;
-  sign(&sig, &kp, &txn);
+  MinaStatus status = sign(&sig, &kp, &txn);
+  if (status != MINA_OK) {
+    fprintf(stderr, "sign: %s\n", mina_status_str(status));
+    return 1;
+  }
 
   char field_str[DIGITS] = { 0 };
   char scalar_str[DIGITS] = { 0 };
@@ -0,0 +1,54 @@
+#include <string.h>
+#include "opcount.h"
+
+static const char *const OP_KIND_NAMES[OP_KINDS] = {
+    "fp_mul", "fp_sq", "fp_add", "fp_sub", "fp_inv",
+    "fq_mul", "fq_sq", "fq_add", "fq_sub", "fq_inv",
+    "poseidon", "blake2b",
+};
+
+#ifdef MINA_OP_COUNT
+_Thread_local OpCounts op_counts;
+#endif
+
+bool op_count_enabled(void)
+{
+#ifdef MINA_OP_COUNT
+    return true;
+#else
+    return false;
+#endif
+}
+
+const char *op_kind_str(OpKind kind)
+{
+    return (kind < OP_KINDS) ? OP_KIND_NAMES[kind] : "unknown";
+}
+
+void op_count_reset(void)
+{
+#ifdef MINA_OP_COUNT
+    memset(&op_counts, 0, sizeof(op_counts));
+#endif
+}
+
+void op_count_get(OpCounts *out)
+{
+#ifdef MINA_OP_COUNT
+    *out = op_counts;
+#else
+    memset(out, 0, sizeof(*out));
+#endif
+}
+
+void op_count_dump(FILE *out, const OpCounts *counts, uint64_t per)
+{
+    const char *sep = "";
+    for (size_t i = 0; i < OP_KINDS; ++i) {
+        if (counts->n[i] != 0) {
+            fprintf(out, "%s%s %.10g", sep, OP_KIND_NAMES[i], (double)counts->n[i] / (double)(per ? per : 1));
+            sep = " ";
+        }
+    }
+    fprintf(out, "\n");
+}
@@ -0,0 +1,62 @@
+// Operation counts for cost accounting
+//
+//     * Built with -DMINA_OP_COUNT, the Fp and Fq entry points of the fiat
+//       code, poseidon_permutation and blake2b_compress each count into the
+//       calling thread's OpCounts. The crypto.c field_* and scalar_*
+//       wrappers forward one to one to fiat, so they are counted there,
+//       together with the calls poseidon.c and the chains make directly.
+//
+//     * Without it OP_COUNT expands to nothing, the counts stay zero and
+//       op_count_enabled() is false.
+//
+//     * Counts are per thread: work handed to a pool is counted on its
+//       workers, not on the caller.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// An inversion also counts the squares and multiplications it is made of,
+// and negation counts as a subtraction
+typedef enum op_kind {
+    OP_FP_MUL,
+    OP_FP_SQUARE,
+    OP_FP_ADD,
+    OP_FP_SUB,
+    OP_FP_INV,
+    OP_FQ_MUL,
+    OP_FQ_SQUARE,
+    OP_FQ_ADD,
+    OP_FQ_SUB,
+    OP_FQ_INV,
+    OP_POSEIDON,
+    OP_BLAKE2B,
+    OP_KINDS
+} OpKind;
+
+typedef struct op_counts {
+    uint64_t n[OP_KINDS];
+} OpCounts;
+
+#ifdef MINA_OP_COUNT
+extern _Thread_local OpCounts op_counts;
+#define OP_COUNT(kind) (op_counts.n[kind] += 1)
+#else
+#define OP_COUNT(kind) ((void)0)
+#endif
+
+bool op_count_enabled(void);
+
+// Short name of a kind, such as "fp_mul"
+const char *op_kind_str(OpKind kind);
+
+// Zeroes the calling thread's counts
+void op_count_reset(void);
+
+// The calling thread's counts since it last reset them
+void op_count_get(OpCounts *out);
+
+// Writes "name count" for each nonzero count divided by per, on one line
+void op_count_dump(FILE *out, const OpCounts *counts, uint64_t per);
@@ -16,6 +16,7 @@
 /* bytes_eval z = z[0] + (z[1] << 8) + (z[2] << 16) + (z[3] << 24) + (z[4] << 32) + (z[5] << 40) + (z[6] << 48) + (z[7] << 56) + (z[8] << 64) + (z[9] << 72) + (z[10] << 80) + (z[11] << 88) + (z[12] << 96) + (z[13] << 104) + (z[14] << 112) + (z[15] << 120) + (z[16] << 128) + (z[17] << 136) + (z[18] << 144) + (z[19] << 152) + (z[20] << 160) + (z[21] << 168) + (z[22] << 176) + (z[23] << 184) + (z[24] << 192) + (z[25] << 200) + (z[26] << 208) + (z[27] << 216) + (z[28] << 224) + (z[29] << 232) + (z[30] << 240) + (z[31] << 248) */
 
 #include <stdint.h>
+#include "opcount.h"
 typedef unsigned char fiat_pasta_fp_uint1;
 typedef signed char fiat_pasta_fp_int1;
 typedef signed __int128 fiat_pasta_fp_int128;
@@ -138,6 +139,7 @@ void fiat_pasta_fp_cmovznz_u64(uint64_t* out1, fiat_pasta_fp_uint1 arg1, uint64_
  *   out1: [[0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff]]
  */
 void fiat_pasta_fp_mul(uint64_t out1[4], const uint64_t arg1[4], const uint64_t arg2[4]) {
+  OP_COUNT(OP_FP_MUL);
   uint64_t x1;
   uint64_t x2;
   uint64_t x3;
@@ -460,6 +462,7 @@ void fiat_pasta_fp_mul(uint64_t out1[4], const uint64_t arg1[4], const uint64_t
  *   out1: [[0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff]]
  */
 void fiat_pasta_fp_square(uint64_t out1[4], const uint64_t arg1[4]) {
+  OP_COUNT(OP_FP_SQUARE);
   uint64_t x1;
   uint64_t x2;
   uint64_t x3;
@@ -784,6 +787,7 @@ void fiat_pasta_fp_square(uint64_t out1[4], const uint64_t arg1[4]) {
  *   out1: [[0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff]]
  */
 void fiat_pasta_fp_add(uint64_t out1[4], const uint64_t arg1[4], const uint64_t arg2[4]) {
+  OP_COUNT(OP_FP_ADD);
   uint64_t x1;
   fiat_pasta_fp_uint1 x2;
   uint64_t x3;
@@ -841,6 +845,7 @@ void fiat_pasta_fp_add(uint64_t out1[4], const uint64_t arg1[4], const uint64_t
  *   out1: [[0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff]]
  */
 void fiat_pasta_fp_sub(uint64_t out1[4], const uint64_t arg1[4], const uint64_t arg2[4]) {
+  OP_COUNT(OP_FP_SUB);
   uint64_t x1;
   fiat_pasta_fp_uint1 x2;
   uint64_t x3;
@@ -887,6 +892,7 @@ void fiat_pasta_fp_sub(uint64_t out1[4], const uint64_t arg1[4], const uint64_t
  *   out1: [[0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff]]
  */
 void fiat_pasta_fp_opp(uint64_t out1[4], const uint64_t arg1[4]) {
+  OP_COUNT(OP_FP_SUB);
   uint64_t x1;
   fiat_pasta_fp_uint1 x2;
   uint64_t x3;
@@ -2040,180 +2046,15 @@ void fiat_pasta_fp_divstep(uint64_t* out1, uint64_t out2[5], uint64_t out3[5], u
 
 #include <stdbool.h>
 #include <stddef.h>
-
-void fiat_pasta_fp_copy(uint64_t out[4], const uint64_t value[4]) {
-    for (size_t j = 0; j < 4; ++j) { out[j] = value[j]; }
-}
-
-void fiat_pasta_fp_pow(uint64_t out1[4], const uint64_t arg1[4], const bool* msb_bits, const size_t bits_len) {
-  fiat_pasta_fp_set_one(out1);
-
-  uint64_t tmp[4];
-
-  // square and multiply
-  for (size_t i = 0; i < bits_len; ++i) {
-    // out1 = out1 * out1
-    fiat_pasta_fp_copy(tmp, out1);
-    fiat_pasta_fp_square(out1, tmp);
-
-    if (msb_bits[i]) {
-      // out1 = out1 * arg1
-      fiat_pasta_fp_copy(tmp, out1);
-      fiat_pasta_fp_mul(out1, tmp, arg1);
-    }
-  }
-}
+#include "pasta_fp.h"
 
 void fiat_pasta_fp_inv(uint64_t out1[4], const uint64_t arg1[4]) {
+  OP_COUNT(OP_FP_INV);
   // invert by Fermat's little theorem:
   // x^{p - 2} * x = 1
-
-  const bool P_MINUS_2[] = {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 1, 0, 0, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
-  fiat_pasta_fp_pow(out1, arg1, P_MINUS_2, 255);
-}
-
-bool fiat_pasta_fp_equals(const uint64_t x[4], const uint64_t y[4]) {
-  uint64_t x_minus_y[4];
-  fiat_pasta_fp_sub(x_minus_y, x, y);
-
-  uint64_t x_minus_y_nonzero;
-  fiat_pasta_fp_nonzero(&x_minus_y_nonzero, x_minus_y);
-  if (x_minus_y_nonzero) {
-    return false;
-  } else {
-    return true;
-  }
+  fiat_pasta_fp_pow_p_minus_2(out1, arg1);
 }
 
-bool fiat_pasta_fp_equals_zero(const uint64_t x[4]) {
-  uint64_t x_nonzero;
-  fiat_pasta_fp_nonzero(&x_nonzero, x);
-  if (x_nonzero) {
-    return false;
-  } else {
-    return true;
-  }
-}
-
-bool fiat_pasta_fp_equals_one(const uint64_t x[4]) {
-  uint64_t one[4];
-  fiat_pasta_fp_set_one(one);
-
-  uint64_t x_minus_1[4];
-  fiat_pasta_fp_sub(x_minus_1, x, one);
-
-  uint64_t x_minus_1_nonzero;
-  fiat_pasta_fp_nonzero(&x_minus_1_nonzero, x_minus_1);
-  if (x_minus_1_nonzero) {
-    return false;
-  } else {
-    return true;
-  }
-}
-
-int fiat_pasta_fp_legendre(const uint64_t arg1[4]) {
-  // x^{(p - 1) / 2}
-  const bool P_MINUS_1_OVER_2[] = {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 1, 0, 0, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
-
-  uint64_t tmp[4];
-
-  fiat_pasta_fp_pow(tmp, arg1, P_MINUS_1_OVER_2, 254);
-
-  uint64_t input_non_zero;
-  fiat_pasta_fp_nonzero(&input_non_zero, arg1);
-  if (input_non_zero) {
-    if (fiat_pasta_fp_equals_one(tmp)) {
-      return 1;
-    } else {
-      return -1;
-    }
-  } else {
-    return 0;
-  }
-}
-
-#include <stdio.h>
-
-void fiat_pasta_fp_print(const uint64_t x[4]) {
-    printf("[ ");
-    for (size_t j = 0; j < 4; ++j) {
-      printf("0x%lx, ", x[j]);
-    }
-    printf("] \n");
-}
-
-void fiat_pasta_fp_sqrt(uint64_t x[4], const uint64_t value[4]) {
-    // A few assertions to make sure s, t, and nqr are initialized.
-
-    if (fiat_pasta_fp_equals_zero(value)) {
-      for (size_t j = 0; j < 4; ++j) { x[j] = 0; }
-      return;
-    }
-
-    uint64_t one[4];
-    fiat_pasta_fp_set_one(one);
-
-    size_t v = 32;
-
-    // z = 5^( (p - 1)/2^32 )
-    uint64_t z[4] = { 0xa28db849bad6dbf0, 0x9083cd03d3b539df, 0xfba6b9ca9dc8448e, 0x3ec928747b89c6da };
-
-    const bool T_MINUS_ONE_DIV_TWO[] = {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 1, 0, 0, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 1, 1, 0};
-    const size_t T_MINUS_ONE_DIV_TWO_LEN = 222;
-
-    // w = value^((t - 1) / 2)
-    // where
-    // t = (p - 1) / 2^32
-    uint64_t w[4];
-    fiat_pasta_fp_pow(w, value, T_MINUS_ONE_DIV_TWO, T_MINUS_ONE_DIV_TWO_LEN);
-    fiat_pasta_fp_print(value);
-    fiat_pasta_fp_print(w);
-
-    fiat_pasta_fp_mul(x, value, w);
-
-    uint64_t b[4];
-    fiat_pasta_fp_mul(b, x, w);
-
-    // compute square root with Tonelli--Shanks
-    // (does not terminate if not a square!)
-
-    uint64_t b2m[4];
-    uint64_t tmp[4];
-
-    while (! fiat_pasta_fp_equals_one(b))
-    {
-        size_t m = 0;
-        fiat_pasta_fp_copy(b2m, b);
-
-        while (! fiat_pasta_fp_equals_one(b2m))
-        {
-          // looping here
-          // b2m = b2m * b2m
-            fiat_pasta_fp_copy(tmp, b2m);
-            fiat_pasta_fp_square(b2m, tmp);
-
-            /* invariant: b2m = b^(2^m) after entering this loop */
-            m += 1;
-        }
-
-        int j = v-m-1;
-        fiat_pasta_fp_copy(w, z);
-
-        while (j > 0)
-        {
-            fiat_pasta_fp_copy(tmp, w);
-            fiat_pasta_fp_square(w, tmp);
-            --j;
-        } // w = z^2^(v-m-1)
-
-        fiat_pasta_fp_square(z, w);
-
-        fiat_pasta_fp_copy(tmp, b);
-        fiat_pasta_fp_mul(b, tmp, z);
-
-        fiat_pasta_fp_copy(tmp, x);
-        fiat_pasta_fp_mul(x, tmp, w);
-
-        v = m;
-    }
-}
+// pow, legendre, sqrt and the comparisons, shared with pasta_fq.c
+#define FIELD_FN(name) fiat_pasta_fp_##name
+#include "pasta_field.inc"
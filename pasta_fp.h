@@ -2,7 +2,7 @@
 #include <stddef.h>
 #include <stdbool.h>
 
-void fiat_pasta_fp_sqrt(uint64_t x[4], const uint64_t value[4]);
+bool fiat_pasta_fp_sqrt(uint64_t x[4], const uint64_t value[4]);
 void fiat_pasta_fp_set_one(uint64_t out1[4]);
 void fiat_pasta_fp_add(uint64_t out1[4], const uint64_t arg1[4], const uint64_t arg2[4]);
 void fiat_pasta_fp_sub(uint64_t out1[4], const uint64_t arg1[4], const uint64_t arg2[4]);
@@ -10,10 +10,20 @@ void fiat_pasta_fp_mul(uint64_t out1[4], const uint64_t arg1[4], const uint64_t
 void fiat_pasta_fp_inv(uint64_t out1[4], const uint64_t arg1[4]);
 void fiat_pasta_fp_opp(uint64_t out1[4], const uint64_t arg1[4]);
 void fiat_pasta_fp_square(uint64_t out1[4], const uint64_t arg1[4]);
+bool fiat_pasta_fp_equals_zero(const uint64_t x[4]);
 bool fiat_pasta_fp_equals_one(const uint64_t x[4]);
 bool fiat_pasta_fp_equals(const uint64_t x[4], const uint64_t y[4]);
-void fiat_pasta_fp_pow(uint64_t out1[4], const uint64_t arg1[4], const bool* msb_bits, const size_t bits_len);
+void fiat_pasta_fp_pow(uint64_t out1[4], const uint64_t arg1[4], const uint64_t *exp, const size_t exp_limbs);
 void fiat_pasta_fp_print(const uint64_t x[4]);
 void fiat_pasta_fp_to_montgomery(uint64_t out1[4], const uint64_t arg1[4]);
 void fiat_pasta_fp_from_montgomery(uint64_t out1[4], const uint64_t arg1[4]);
+void fiat_pasta_fp_to_bytes(uint8_t out1[32], const uint64_t arg1[4]);
+void fiat_pasta_fp_from_bytes(uint64_t out1[4], const uint8_t arg1[32]);
+void fiat_pasta_fp_nonzero(uint64_t* out1, const uint64_t arg1[4]);
 void fiat_pasta_fp_copy(uint64_t out[4], const uint64_t value[4]);
+int fiat_pasta_fp_legendre(const uint64_t arg1[4]);
+
+// Fixed-exponent addition chains (pasta_chains.c)
+void fiat_pasta_fp_pow_p_minus_2(uint64_t out1[4], const uint64_t arg1[4]);
+void fiat_pasta_fp_pow_p_minus_1_div_2(uint64_t out1[4], const uint64_t arg1[4]);
+void fiat_pasta_fp_pow_t_minus_1_div_2(uint64_t out1[4], const uint64_t arg1[4]);
@@ -16,6 +16,7 @@
 /* bytes_eval z = z[0] + (z[1] << 8) + (z[2] << 16) + (z[3] << 24) + (z[4] << 32) + (z[5] << 40) + (z[6] << 48) + (z[7] << 56) + (z[8] << 64) + (z[9] << 72) + (z[10] << 80) + (z[11] << 88) + (z[12] << 96) + (z[13] << 104) + (z[14] << 112) + (z[15] << 120) + (z[16] << 128) + (z[17] << 136) + (z[18] << 144) + (z[19] << 152) + (z[20] << 160) + (z[21] << 168) + (z[22] << 176) + (z[23] << 184) + (z[24] << 192) + (z[25] << 200) + (z[26] << 208) + (z[27] << 216) + (z[28] << 224) + (z[29] << 232) + (z[30] << 240) + (z[31] << 248) */
 
 #include <stdint.h>
+#include "opcount.h"
 typedef unsigned char fiat_pasta_fq_uint1;
 typedef signed char fiat_pasta_fq_int1;
 typedef signed __int128 fiat_pasta_fq_int128;
@@ -138,6 +139,7 @@ void fiat_pasta_fq_cmovznz_u64(uint64_t* out1, fiat_pasta_fq_uint1 arg1, uint64_
  *   out1: [[0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff]]
  */
 void fiat_pasta_fq_mul(uint64_t out1[4], const uint64_t arg1[4], const uint64_t arg2[4]) {
+  OP_COUNT(OP_FQ_MUL);
   uint64_t x1;
   uint64_t x2;
   uint64_t x3;
@@ -460,6 +462,7 @@ void fiat_pasta_fq_mul(uint64_t out1[4], const uint64_t arg1[4], const uint64_t
  *   out1: [[0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff]]
  */
 void fiat_pasta_fq_square(uint64_t out1[4], const uint64_t arg1[4]) {
+  OP_COUNT(OP_FQ_SQUARE);
   uint64_t x1;
   uint64_t x2;
   uint64_t x3;
@@ -784,6 +787,7 @@ void fiat_pasta_fq_square(uint64_t out1[4], const uint64_t arg1[4]) {
  *   out1: [[0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff]]
  */
 void fiat_pasta_fq_add(uint64_t out1[4], const uint64_t arg1[4], const uint64_t arg2[4]) {
+  OP_COUNT(OP_FQ_ADD);
   uint64_t x1;
   fiat_pasta_fq_uint1 x2;
   uint64_t x3;
@@ -841,6 +845,7 @@ void fiat_pasta_fq_add(uint64_t out1[4], const uint64_t arg1[4], const uint64_t
  *   out1: [[0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff]]
  */
 void fiat_pasta_fq_sub(uint64_t out1[4], const uint64_t arg1[4], const uint64_t arg2[4]) {
+  OP_COUNT(OP_FQ_SUB);
   uint64_t x1;
   fiat_pasta_fq_uint1 x2;
   uint64_t x3;
@@ -887,6 +892,7 @@ void fiat_pasta_fq_sub(uint64_t out1[4], const uint64_t arg1[4], const uint64_t
  *   out1: [[0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff], [0x0 ~> 0xffffffffffffffff]]
  */
 void fiat_pasta_fq_opp(uint64_t out1[4], const uint64_t arg1[4]) {
+  OP_COUNT(OP_FQ_SUB);
   uint64_t x1;
   fiat_pasta_fq_uint1 x2;
   uint64_t x3;
@@ -2040,29 +2046,15 @@ void fiat_pasta_fq_divstep(uint64_t* out1, uint64_t out2[5], uint64_t out3[5], u
 
 #include <stdbool.h>
 #include <stddef.h>
-#include <stdio.h>
+#include "pasta_fq.h"
 
-void fiat_pasta_fq_print(const uint64_t x[4]) {
-    printf("[ ");
-    for (size_t j = 0; j < 4; ++j) {
-      printf("0x%lx, ", x[j]);
-    }
-    printf("] \n");
+void fiat_pasta_fq_inv(uint64_t out1[4], const uint64_t arg1[4]) {
+  OP_COUNT(OP_FQ_INV);
+  // invert by Fermat's little theorem:
+  // x^{q - 2} * x = 1
+  fiat_pasta_fq_pow_q_minus_2(out1, arg1);
 }
 
-bool fiat_pasta_fq_equals(const uint64_t x[4], const uint64_t y[4]) {
-  uint64_t x_minus_y[4];
-  fiat_pasta_fq_sub(x_minus_y, x, y);
-
-  uint64_t x_minus_y_nonzero;
-  fiat_pasta_fq_nonzero(&x_minus_y_nonzero, x_minus_y);
-  if (x_minus_y_nonzero) {
-    return false;
-  } else {
-    return true;
-  }
-}
-
-void fiat_pasta_fq_copy(uint64_t out[4], const uint64_t value[4]) {
-    for (size_t j = 0; j < 4; ++j) { out[j] = value[j]; }
-}
+// pow, legendre, sqrt and the comparisons, shared with pasta_fp.c
+#define FIELD_FN(name) fiat_pasta_fq_##name
+#include "pasta_field.inc"
@@ -2,15 +2,28 @@
 #include <stddef.h>
 #include <stdbool.h>
 
+bool fiat_pasta_fq_sqrt(uint64_t x[4], const uint64_t value[4]);
 void fiat_pasta_fq_set_one(uint64_t out1[4]);
 void fiat_pasta_fq_add(uint64_t out1[4], const uint64_t arg1[4], const uint64_t arg2[4]);
 void fiat_pasta_fq_sub(uint64_t out1[4], const uint64_t arg1[4], const uint64_t arg2[4]);
 void fiat_pasta_fq_mul(uint64_t out1[4], const uint64_t arg1[4], const uint64_t arg2[4]);
+void fiat_pasta_fq_inv(uint64_t out1[4], const uint64_t arg1[4]);
 void fiat_pasta_fq_opp(uint64_t out1[4], const uint64_t arg1[4]);
 void fiat_pasta_fq_square(uint64_t out1[4], const uint64_t arg1[4]);
+bool fiat_pasta_fq_equals_zero(const uint64_t x[4]);
+bool fiat_pasta_fq_equals_one(const uint64_t x[4]);
 bool fiat_pasta_fq_equals(const uint64_t x[4], const uint64_t y[4]);
+void fiat_pasta_fq_pow(uint64_t out1[4], const uint64_t arg1[4], const uint64_t *exp, const size_t exp_limbs);
+void fiat_pasta_fq_print(const uint64_t x[4]);
 void fiat_pasta_fq_to_montgomery(uint64_t out1[4], const uint64_t arg1[4]);
 void fiat_pasta_fq_from_montgomery(uint64_t out1[4], const uint64_t arg1[4]);
+void fiat_pasta_fq_to_bytes(uint8_t out1[32], const uint64_t arg1[4]);
+void fiat_pasta_fq_from_bytes(uint64_t out1[4], const uint8_t arg1[32]);
 void fiat_pasta_fq_nonzero(uint64_t* out1, const uint64_t arg1[4]);
 void fiat_pasta_fq_copy(uint64_t out[4], const uint64_t value[4]);
-void fiat_pasta_fq_print(const uint64_t x[4]);
+int fiat_pasta_fq_legendre(const uint64_t arg1[4]);
+
+// Fixed-exponent addition chains (pasta_chains.c)
+void fiat_pasta_fq_pow_q_minus_2(uint64_t out1[4], const uint64_t arg1[4]);
+void fiat_pasta_fq_pow_q_minus_1_div_2(uint64_t out1[4], const uint64_t arg1[4]);
+void fiat_pasta_fq_pow_t_minus_1_div_2(uint64_t out1[4], const uint64_t arg1[4]);
@@ -0,0 +1,21 @@
+// Tables of the square roots in pasta_field.inc, for both fields.
+// Generated by tools/gensqrt.py into pasta_sqrt_tables.c; see there for
+// their layout.
+
+#pragma once
+
+#include <stdint.h>
+
+#define PASTA_SQRT_WINDOW_BITS 8
+#define PASTA_SQRT_WINDOWS     4
+#define PASTA_SQRT_WINDOW_SIZE (1 << PASTA_SQRT_WINDOW_BITS)
+#define PASTA_SQRT_DLOG_SLOTS  (2 * PASTA_SQRT_WINDOW_SIZE)
+#define PASTA_SQRT_DLOG_SHIFT  (64 - 9) // log2(DLOG_SLOTS) bits of hash
+
+extern const uint64_t fiat_pasta_fp_sqrt_table[PASTA_SQRT_WINDOWS][PASTA_SQRT_WINDOW_SIZE][4];
+extern const uint64_t fiat_pasta_fp_sqrt_dlog_keys[PASTA_SQRT_DLOG_SLOTS];
+extern const uint16_t fiat_pasta_fp_sqrt_dlog_vals[PASTA_SQRT_DLOG_SLOTS];
+
+extern const uint64_t fiat_pasta_fq_sqrt_table[PASTA_SQRT_WINDOWS][PASTA_SQRT_WINDOW_SIZE][4];
+extern const uint64_t fiat_pasta_fq_sqrt_dlog_keys[PASTA_SQRT_DLOG_SLOTS];
+extern const uint16_t fiat_pasta_fq_sqrt_dlog_vals[PASTA_SQRT_DLOG_SLOTS];
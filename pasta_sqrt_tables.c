@@ -0,0 +1,2417 @@
+/* Autogenerated: python3 tools/gensqrt.py */
+/* Square root tables of both Pasta fields, linked in read-only so */
+/* that fiat_pasta_fp_sqrt and fiat_pasta_fq_sqrt build nothing.   */
+
+#include "pasta_sqrt.h"
+
+// m = 0x40000000000000000000000000000000224698fc094cf91b992d30ed00000001
+const uint64_t fiat_pasta_fp_sqrt_table[PASTA_SQRT_WINDOWS][PASTA_SQRT_WINDOW_SIZE][4] = {
+  // g^(-j * 2^0)
+  {
+    { 0x34786d38fffffffd, 0x992c350be41914ad, 0xffffffffffffffff, 0x3fffffffffffffff },
+    { 0x5cfe5f67cb155442, 0x176460c2734c4621, 0xdf81001645214110, 0x18047fb9f91068bc },
+    { 0x39ae11c799b36804, 0x5ada0798d938cab2, 0x8f16455f3116ae8e, 0x01d36527da74de40 },
+    { 0xb8b5e728c85f6490, 0x385c9bc8c19ca21b, 0xad3665038889aba9, 0x1d22781a637a3518 },
+    { 0xbfa8482d7f4f7bc6, 0x79a15ad32a10a3b9, 0x724636160e332ebf, 0x02bdac2fc039aefb },
+    { 0x135cefaba2ff266c, 0x6c417cf6bc0fe551, 0xa654461290ccf6c6, 0x2afde1d50d6a720c },
+    { 0x61fa6ee2317bd716, 0x08d6e8dcebb09b2b, 0x6b6571bd60e0dd19, 0x30a11e17b28881f7 },
+    { 0xf2e0dca121e977f9, 0x12f577094151e612, 0x02447f37798186c7, 0x1990be429ea720b2 },
+    { 0x00571ac525be8d97, 0x4363960a6c2ab600, 0xef8565113262de6d, 0x3bbb2f06f5e05bc5 },
+    { 0x6ff9d9151580fa84, 0xa09547bb827b69e4, 0x2a8d21921171174c, 0x35b363f07f7a52e3 },
+    { 0xdf7ff875167169b3, 0x3e15f2547c09046d, 0x7852e821b5e702f6, 0x214b183c9d66f8db },
+    { 0x01ddb327197b6bc7, 0xaf0e87e51de71f74, 0x65e1a34a6e2fe1af, 0x10e2ee310e0fbd85 },
+    { 0x66eb9858531f05e3, 0x808f69ba731480d9, 0x411c23542633342b, 0x23142ea047a74736 },
+    { 0x6adea6b08f4dcb9a, 0xc2a4bced1f49e2af, 0x9414dc5d66125734, 0x3659ca11a5605582 },
+    { 0xa9204c771e457f8b, 0x57b3c80c93626362, 0xcd7d96129b118495, 0x113aaec928a2b3da },
+    { 0xc4ed6098b9558f50, 0xa969906a0c5fd273, 0xee7b7076902d73aa, 0x363273ead2e6cb51 },
+    { 0xd020fa666ff53916, 0x0340cdd6acffbdbd, 0x055bf888f38bb742, 0x1c6ac32cbcf9e95f },
+    { 0xed94acf3b92255d1, 0xda27b413b21e1d37, 0x9eabc0eea78b6ea7, 0x32313bf989a3fe88 },
+    { 0x772cec1a40d739a4, 0xf494fca00b04de45, 0x5006513954d0a1fd, 0x201d05b3194c5931 },
+    { 0xdc4ab5a9a227e3dd, 0x8980769b849d2e02, 0xa756d8f453e7196e, 0x372288e21273ddb5 },
+    { 0xb95f03f29dbb8569, 0x5b8aff3f2c1c3f67, 0xbf4e2122fd5f5553, 0x1b95c6bae8798c94 },
+    { 0x757eff28e53d02b0, 0x1718155876ea7a39, 0x1b33573a43795459, 0x05e7afdaa1694c8d },
+    { 0x5c57b70baf47105e, 0x27645c1f47923656, 0xeda028aad8142a27, 0x36601be3cd57b462 },
+    { 0x6b6c00826ff66b5b, 0x2f3da91424b54a74, 0xcd94702e6091291e, 0x0c3074ab775dcf31 },
+    { 0x7c0ec13df0dc8855, 0xe3e2dea65db1a859, 0xda2611108556538a, 0x106f3488a3961971 },
+    { 0x9024d5db2dc4b638, 0x2f56685323fbd458, 0xea42ba342cc01554, 0x1927f05c1af5a886 },
+    { 0x079ee20249c0191a, 0xcedc0c80901aef6e, 0x21948db5f9239a69, 0x0eb35f10bc072ede },
+    { 0x60042b8f068396df, 0xcc36cb7f1d42e41e, 0xbfa77f1e188881c0, 0x280999136e37a147 },
+    { 0xf1c411d28d07cf74, 0xe7e516ab88956931, 0x3f52e7238d8d1b8c, 0x1fa0632292e84dc0 },
+    { 0x618b5d347b905b9e, 0x1c31ea9d51f2b01f, 0x8eab407f5962c4bb, 0x049b7245f66c83f5 },
+    { 0xc60cf7f1f6016b0b, 0x1185a228ed147f99, 0x650f1f97f3deb30f, 0x1e7c536689ff7f2d },
+    { 0x6c76682615fa04a9, 0xcf676e3dc32a2ce6, 0x55248687ee72d811, 0x2daf009e97544def },
+    { 0xa79987b9f64ac99f, 0x9220f0a4645760fc, 0x0b72c1b6797419ad, 0x0a69932addf80267 },
+    { 0x36f5cb26459b010a, 0xb71587752805b827, 0xba14a36e58256a4e, 0x3c2dbb675a34935d },
+    { 0xbd24f15eda5ecb79, 0x2ece51881f5300af, 0x88b201255a81924e, 0x1f36674180b9c76d },
+    { 0x1072e48dabd4744c, 0x229eae558b16d457, 0x9c62ac990a065680, 0x38959219adab2742 },
+    { 0xeb29c56e09a5d08c, 0x745e42e897086853, 0xe42ea60cb38d9252, 0x27be47d95fd792a5 },
+    { 0x8afd3f637eb07266, 0x61b3b3eaa3ec8512, 0x2bb42c19caff4858, 0x1e69f1d171325388 },
+    { 0x776664826c6933d0, 0x8ad10a600f50d42c, 0xbb0cd948dd761447, 0x1c5c83a0ea413a86 },
+    { 0xe4a98188e1622f99, 0xa084ec5bf2d69a5a, 0x4476c04c9a9a67b1, 0x144efec97173597c },
+    { 0x21f3bb99b654920b, 0x4ded366f3bcbf89c, 0x91ebc2c7b3897f4a, 0x3b86d4ae330ddcde },
+    { 0xfe52fef3eaa56e64, 0x971768a7fc416071, 0xd02023a906b4a8ef, 0x238e734bc5559ee9 },
+    { 0xf7963212bda0b600, 0x99747fd432bee02a, 0xe7ab893829e54bf1, 0x3c752df6638c22d9 },
+    { 0xbccb9d1af88b8497, 0xa87905198dd048be, 0x0adf5b320a5ed062, 0x2cb563f35a7d3805 },
+    { 0x128fc181a6564801, 0x7d1dd32f53f67249, 0x86c9d3db174ac187, 0x2abfddcb4c2541fb },
+    { 0x5deaae121cbca937, 0xb7466801f5ba0381, 0x79b0348e469baccf, 0x25735bdfd935edf0 },
+    { 0xece06339fc494ad2, 0x1f39d31285055dfd, 0xcd1fc22704108643, 0x12e9204d5738dc20 },
+    { 0x96ce24493aef8a9f, 0x48d3058fb82329c8, 0xdafea5f9a0066542, 0x0769e0038c87407e },
+    { 0x6919bf3460cd937f, 0x7a73df9f163e8829, 0x529ad87b7ea92f48, 0x1ba3d8c6f0c40d4a },
+    { 0xf1e0ae1a4ccb59a8, 0x8bc9c4807dd2500c, 0x6791c925abbe8915, 0x15faf7c0516cd591 },
+    { 0x66419285fc29d7e4, 0x25dfb7bc4795bb39, 0x27c4ce5ccd8c38e2, 0x274e2c02c875c4f4 },
+    { 0xf9b9cd6b00f428f7, 0x7602041ffd44e076, 0x6dd4444379c69a00, 0x318dfd6bb99e9b1c },
+    { 0x247026ff73f08791, 0x76768af696830eaf, 0x96934b1e264774c3, 0x1ad8484147d804b3 },
+    { 0xedc0888bcc338c63, 0x87271b68e6635083, 0x24ea244bef0d938b, 0x38e9682553611058 },
+    { 0x32fba19d895e8202, 0xc14e77a6a6232b90, 0xe37da65768a77a10, 0x23976db12794e323 },
+    { 0xb1302a1e1c8b0f37, 0xa6fcb84954cfb6d6, 0xe74e2c6bce898da5, 0x035061cf9700362c },
+    { 0x7e2c9db24338c125, 0xd01abe3c6f406132, 0x97565909ebf8181b, 0x07d330db8fa18f93 },
+    { 0x209e6e2e1d7930f3, 0xd98963b224ae1c4b, 0x43c4fdb5a0afc6fc, 0x016637f6dad74e14 },
+    { 0xc3700ee15600ce4c, 0xf46001a056091dc3, 0x656f562bfe938b50, 0x3ace83f3184b8ac7 },
+    { 0x3e2988f2136b8111, 0xdbe2f9146d54a3a2, 0xd8daa3cdbbe331e0, 0x0bce7dd11e3929e6 },
+    { 0xc48af3886f6a61fe, 0x6a39fe4892ef34d6, 0xb15966d307fea62a, 0x1f51c571cf208327 },
+    { 0x597e7504d2aa3d89, 0x599b44bdd0a49141, 0xaac8d132303c44a6, 0x1b0d58030c16461e },
+    { 0x03a3cd07ee31fb02, 0xebdb942f5fa62e78, 0xa29f37309f2f6722, 0x337d31b79a4da99e },
+    { 0x5bfa13764f1ccb2f, 0x9dd71aed71fd270d, 0x4083f14528bf9855, 0x290909da179f5630 },
+    { 0x58f143c945f74cfe, 0xdda26b6b8eb66b9a, 0x070b3c12119f4f70, 0x32ed3eb2b92f5667 },
+    { 0x967d01c7e4e49334, 0xcf47cbb102d11b15, 0xfd1f966b352516e0, 0x1ed9f5f53892fe5d },
+    { 0xa01d1d415dbd607d, 0x4ab4366e9b7b7788, 0xa0c2278937ec56d3, 0x22fa7433798b48e0 },
+    { 0xf4b64b9fbc154f9f, 0x4e95a7883df5e870, 0x86d6c2db296322f0, 0x092ca1804284394c },
+    { 0x4a97766895f7359e, 0x2226eb54e40108f0, 0xfd898afda1886ca9, 0x39f54932eadb31d6 },
+    { 0x76e6fbeb15b7ec4a, 0xce85a9a34ecef429, 0x9f86c9d6cccec42a, 0x3fe16ebdb63caf15 },
+    { 0xbaf0fdd97e96f67a, 0x8afd426015a5fbea, 0x92e685202e729902, 0x06ff70878d7b10aa },
+    { 0xcc7567585fa9e22c, 0x94f680683fef6e66, 0x1ef7cde822e60259, 0x0c40bcfec04eeee6 },
+    { 0xc5f7b934dfdb7c3c, 0xd4adee79fde19724, 0xb6c361b18e9f270e, 0x29d5abed9eeedf2e },
+    { 0xcce2e71c0bf3f316, 0xbb369e55029e74b2, 0xded6ec71ba4c99ca, 0x1eec89a6ca6bdeef },
+    { 0x6572d598ac309b33, 0x42a4d3c0adaf4a33, 0x1341b81db9d4c68c, 0x3f5f1b154e8788a7 },
+    { 0xb724d8023f2f275c, 0x8760a9383e9356fd, 0xdac40ed357cb81ab, 0x02284ec0a78fe8b2 },
+    { 0x62c6a81fd90c8a63, 0xa7293ac87f950dd7, 0xc46e182091662dd2, 0x22a01c0f27f6665b },
+    { 0xc20fdd10d79c8062, 0xa79db4ee17bc0d2a, 0x407537b1704079a9, 0x0eb0c891686d76ef },
+    { 0x4c727b911b750e70, 0xd6d5c9a7210a4f89, 0x7d7f76d6e8c3c115, 0x013466329f9c98b5 },
+    { 0x1c3a848c445bdeb4, 0xf8b2bc23862ddce4, 0x4113a444a9087268, 0x24bcc0e82df5a30f },
+    { 0x6f7b0cdfe93f4d8f, 0x7216d8fe2914eb94, 0x94e45b78c1838943, 0x06fd76d1ab4c434d },
+    { 0xc454fb940fb46459, 0x2d0b305f9833982d, 0x49933a1d3c263b22, 0x157d2b9e01baf7af },
+    { 0x9630ad84da26f490, 0xfa5bfb1a91fc3542, 0x4aa4ede92e102c19, 0x152b70cc7e34d36d },
+    { 0x3d8229f5f5fadd19, 0xfe248392c1e81d37, 0xe17e517aee1d413b, 0x29e6c0398a510065 },
+    { 0x34e0abd63a078f56, 0xae56edbcf59183d3, 0x8a339a3dba47d8c3, 0x007248cee9e6b241 },
+    { 0xce60edb630ab8f47, 0x6e2af1a715f749dd, 0xd8731d9a3b17cdf4, 0x34b67d5491fe4f3c },
+    { 0x4a859f5239b7e16d, 0xf3c53d3e64a81465, 0xc9eb0e92bc255ff9, 0x3eb38db279fabea2 },
+    { 0x2dae0ad9bf75f402, 0x963b28a0a3628d0c, 0x2664933103dd5f55, 0x136a6bc65a0afb60 },
+    { 0x50130b9ce9948312, 0x90616b16f48600ee, 0x94ef0bb603270497, 0x00e886e9420166f1 },
+    { 0xfc7b9152870e3cdb, 0xb68d4fa2407214e4, 0x3b37860906236493, 0x3b0cdb5fa7ae6402 },
+    { 0x99f596906b4a4b96, 0x997e801c3a231e24, 0xde4872e2493ff4ea, 0x10b6239c3b32370c },
+    { 0x2f4a51bd995e0aaa, 0xbaad361493bf5506, 0x4710063ec99c0d3b, 0x150b5f750bcf88b8 },
+    { 0xd136af5d8d30dcfa, 0x516ca1a27d6fcc72, 0xb90a9ae5612e4b68, 0x3f6b449942005137 },
+    { 0x6fada0d06d446a86, 0x25796d064aa90b71, 0x179ba9f4e28f4d63, 0x19ec0f7b81d97107 },
+    { 0x7cf125374772bc47, 0x5cf7abead6d85694, 0xcb45c91c8c4a1620, 0x365396d90225da9f },
+    { 0x90234af2820b155d, 0xb7bf86ea844a918f, 0xc51e94a3720d158b, 0x175662cfc530dce3 },
+    { 0xa29ea76e8ce31401, 0x75522b75ab4fc90d, 0x29807ff962cff7c5, 0x3b441dc4b716f12a },
+    { 0xfb480dcec1efcca2, 0x2da148381b025362, 0xabf008f809c64c6b, 0x38eb221cbc88c156 },
+    { 0xffd36840437a4efc, 0x926bd1f44bfabc60, 0xf7a7f6850e57c672, 0x146ef90cb60a7269 },
+    { 0xe9cf1df4276c1114, 0xc6dc325b1f0a50f3, 0x262e49aba15b2c17, 0x140e7742b00046ff },
+    { 0x34d05b8e3f466c08, 0xb818999d4969f15f, 0x1a1004efe6037555, 0x04749327976c556f },
+    { 0xe33af26d7184f729, 0xbb5d3cf09e8a9c35, 0x3250d7614b375922, 0x10787ba85eaeb777 },
+    { 0x097ad8a2ab8e4138, 0x33b78842725bdde1, 0x883f9c212b510240, 0x36e5fec888f86fc4 },
+    { 0x5a8bbb75ca7959c7, 0x278c2614248a0923, 0x8423c3e480df3cc4, 0x21fc9eb946db5f8b },
+    { 0x05cb2d5827e5b096, 0x348459ef51eec69f, 0xcd42041cf3ce3076, 0x0d4fcc02b2fa1c6b },
+    { 0x62dec484cb3773df, 0x22660c4e774a45b0, 0x2fe1536c21fbf134, 0x1c0a64024257d806 },
+    { 0xbac7843566c48418, 0x08ece718a688b88c, 0xcaf2ab6fff58dd95, 0x2372fcaddc187dfb },
+    { 0x57e468ac0e567522, 0xc0f6163b86de68e8, 0xeb6dbaf028955dd0, 0x0f19c3dfab213da2 },
+    { 0xf1e31f0eb4f40d12, 0xab7367a62c48d560, 0x9e5b2a6d50597d30, 0x2df4b7e2cbb5e8bd },
+    { 0x9e76c93376a8e3da, 0xe61d8f10be9919bf, 0xf351dbef44eeac76, 0x162f1bd3e25fc235 },
+    { 0x653cce4671a31a25, 0x32e0b8dd1c2c84b5, 0x84dde3b7d3343eb1, 0x2743def532568fa9 },
+    { 0x3686789bd31ad802, 0xa20df941dc4fb2bf, 0x107f7095f896997a, 0x37538662fce293ff },
+    { 0xc28a364e3006c70b, 0x2405fb40b6e87603, 0xfe46e81e76d41058, 0x1661741cd14a6d73 },
+    { 0x4c76f31c53e33bba, 0xc84a531ca45eb032, 0x8438e386eda54e48, 0x26c0968a31b20b5c },
+    { 0x137468ea335d44e3, 0x628bbc3c57f361ff, 0xa585fe100efe7396, 0x019b3cd34462ee59 },
+    { 0x9d85cfd7df715524, 0x12b1aebeca767417, 0x33f4fec601e30d1b, 0x0b28e6872bb513bc },
+    { 0xaf5fee7ff5675f4d, 0x478c2b8e90293213, 0x82857bc62763c528, 0x3adc188532002fa6 },
+    { 0x89a1e07ab6ff3016, 0x6a262666cc3a088c, 0xa9e0c3061ad4137a, 0x0cee09cda2ed60a2 },
+    { 0x5cd375ded8d3b78d, 0x5845f6f307e32b2f, 0x0f8230c9da5b1e7f, 0x2d759ab21782b3fc },
+    { 0x088fca9c2f2adb23, 0x359f0572ee14fb2b, 0x42bd434452ae7e67, 0x364ec1c9de0bb529 },
+    { 0x9d44da0944f74819, 0x1c7e8d01b0a3e811, 0xb6c5515b71ab80f7, 0x0c26a6de9f782d1c },
+    { 0x59c47a8cedd3aec5, 0x466bd619dbd7fb0d, 0xd0bde6af8728d96a, 0x0fc59b8d758763b0 },
+    { 0x05221ffebce48546, 0x09234469cdf460ac, 0xb61dc5a34e551be4, 0x0893d7ec2c1149c7 },
+    { 0xce8a819dd5554b3f, 0xeff6b61b93db1033, 0x7d26ac444a6e46de, 0x0965eda4b74c803a },
+    { 0x14292037dd06f178, 0x140cda5f5f28c498, 0x750bae9b29bd81d7, 0x1ae0306ecd838e62 },
+    { 0x4e32af7002a57955, 0x71841b5db88a11a5, 0xa229ff96245e5bdc, 0x3447a3974d53c8f9 },
+    { 0xf010df1c21eb9ba1, 0xf6a733dae3e07b2a, 0x3ce34d903879c585, 0x352a962d444c5b07 },
+    { 0x4b39544b1e29f8f4, 0x6c05fcad481364ee, 0x2562154bcd3edaf5, 0x0c7fc12f3ce179c5 },
+    { 0x5201c47cb901fd70, 0x9a2a69e40cb56518, 0x04f91ba827baf510, 0x2a2fb12100e13050 },
+    { 0x2caad2a3cf7db49f, 0x1edc50249c05f1e5, 0x27f685e274d2da28, 0x11df97bd8278f134 },
+    { 0x92c4c134b1d62357, 0xcdf2e9f080b21de7, 0x964a703e955d4c88, 0x14937d7c81a9e73c },
+    { 0x6007d684937962d1, 0x8f980854889c4f88, 0xe52ce2171f01fada, 0x18f1cfa10aec970d },
+    { 0x0f26beac6f23e4c3, 0xa180544c2444a7e1, 0x536d78e948043430, 0x2734f42424a16275 },
+    { 0xa9834a28948b3e48, 0xa256c0188d4f3c1c, 0x8f395cfecb14faac, 0x1d922eac35f61670 },
+    { 0xa270aaf1bddc3596, 0x305bdfaef05bc409, 0xac9a836a16178fc5, 0x1f42c9ce2408bf24 },
+    { 0x512810e907a254dd, 0x4b23912e7d5397fe, 0xf910b59a3d0afc40, 0x2aae0fa8caf05a58 },
+    { 0x3648a547bd1a69f2, 0xd7d7f2e2f66461af, 0x2285a6640451e1c6, 0x0ac801259074a80e },
+    { 0x1413725024fbdd61, 0xbe253727fe7be3d1, 0x390d99f758926e9d, 0x3c78849c15b5dd90 },
+    { 0xa28d00bedf2ff893, 0x66109664885178c9, 0xd6bd5d6aca94bb3f, 0x0786d34fc51e1ca6 },
+    { 0xf296fd9b0824e791, 0xcbb313049d48d775, 0x0dbc02cf0c9e2396, 0x2c2a961569e30f8f },
+    { 0x67d7cd1279bcce27, 0xb2b0ff68ddd19832, 0x932e8101a4826801, 0x2ade00bfa54c8571 },
+    { 0x80345c04b098e07f, 0xecafad2ba4c92a12, 0xbe4000f39ec0e867, 0x1f0ba4d2f82ebd62 },
+    { 0x41879a413d22e186, 0x2d4589d6af8b1c88, 0xc88077f3f354fea1, 0x1b4d056b824ab5f1 },
+    { 0xc6cd067f6a56874c, 0x87beba0adb92d4b2, 0xf7fde9fea0738927, 0x083b5b1e3d3e5a8b },
+    { 0xc82be7621fb45800, 0xabedf9fb3769235d, 0xf4f0a3d8aefbc003, 0x3ceb8815d3e81af7 },
+    { 0x849a957a124f8b46, 0xbbd5459300924cc9, 0x02edf45012d219fc, 0x3a241fe6943bfd80 },
+    { 0x4a3c4a15655c9a25, 0x6387ce9c2d7ab859, 0x72181d182950399f, 0x15e68dac39bd5390 },
+    { 0x406979d025d64dc2, 0x0dda2614ad0d42fd, 0xfded8469f3e33c3a, 0x3a185acbcaa50de8 },
+    { 0x285e05c8726525b7, 0x21be87e6a6a703cf, 0x913aa5e84bd0572a, 0x065debf683d431ab },
+    { 0xad3bc1fd8cc8ef84, 0xb97db0558b4610bd, 0x37a2f949d7a52cb1, 0x2fb5288185a25e03 },
+    { 0x8d93ca9d1737a12a, 0xd8aaf81ec27577d7, 0x856d286818f92f08, 0x07365cdc9c9882bf },
+    { 0xf04adc2c07d26759, 0x14ed7373019c3e3c, 0x9910a2df2ce47872, 0x305ae15a98e6baaf },
+    { 0xfef661ac8cc1ef8e, 0x09e838b1ce1c47e8, 0x298de167766f7bac, 0x2de719ae6db60d6a },
+    { 0x744a0e7c897808d9, 0x5387d9f22b8b3b03, 0xbe035b7409286163, 0x2a2ac6c691ae9985 },
+    { 0xeb581195a8ffd7cf, 0xd7cf915bf3181c03, 0xa5c95b11c03b26ae, 0x276ab92d1f6e1f52 },
+    { 0x1349a605dfe11bc8, 0xf230d514b5009841, 0x8a5da5fb206b84fa, 0x0a2051016c0e92f8 },
+    { 0xf068e7caa26be3cf, 0x05f14ef4fb222ba7, 0x5cdf2cf1821c26fd, 0x13d6d7fdb8429a79 },
+    { 0x1f59ee9972f1692b, 0xecf77c6eba5b839d, 0x4a4621a3fadd2530, 0x17e8a89fb65b690b },
+    { 0x0ec742504ffd74df, 0xb0b44ca328acf028, 0xfc63c5696b890991, 0x0ed2b09d1eaa8dfe },
+    { 0xa1c1853d315c3294, 0xfcb5b8a722981acc, 0x8b4ad4482492526c, 0x163cf7ea21c8f872 },
+    { 0x67a2e87fbdba265b, 0x60dcf7675556f2d0, 0xa02ae8e7a336d33f, 0x3c4701fe9594f62f },
+    { 0xb445680b8de999e0, 0x3b207f0824038663, 0x99aa61073a424b2b, 0x375508063ffe5752 },
+    { 0xe4d9a637e1dc30da, 0xd5278aff91fb13ea, 0xb076706f6eaee10a, 0x2e068ac2dcb8e1a6 },
+    { 0xce6430426b4fc9a2, 0xe219a11b0f4b4b0a, 0x5d470c32d0c8ec13, 0x1c93f63b3c1d080c },
+    { 0xa73918078979e997, 0xfae793fdd9c39f88, 0xad6a044a08087ecd, 0x0a2b52259f2ade8e },
+    { 0x78c1afcdb6f16467, 0x2e5948071262126d, 0xa8713639ad805a30, 0x2c67ca078439a695 },
+    { 0x5969c2266d51735d, 0x1016c1ccc00c354e, 0x3197ace158c473cc, 0x0fe063e08de932d5 },
+    { 0xc7d870646fbb99c7, 0x3e656a22f5c3f0e7, 0x063940ce07b77352, 0x0f622be4067ce8d8 },
+    { 0xa402e7057a94cf9b, 0x82893678e888db8e, 0xf8942c77a7097daa, 0x1a826378aac94b75 },
+    { 0xef842aaa536aa648, 0xe6c6f4e182926bb6, 0x2cb77a4901b1f261, 0x15d3fd4c8c763bbd },
+    { 0x05d348654d05ed06, 0x1c2242963b1dd40f, 0xd1527202b571c0f5, 0x2e67222fe3bcc783 },
+    { 0x15da83eb58e97ae5, 0xc98617bbc3b6ee29, 0xac22b6375afe4377, 0x2446bea584ab34ec },
+    { 0x7092fc13f6f0358b, 0xd3742f385ccb5ecf, 0xb3f48985ce094af3, 0x146e96438e90ab0c },
+    { 0xa238d73db152a35d, 0x85c5a2e07ecf04c9, 0x714c11a6e49adc9f, 0x15c388f9b503862e },
+    { 0x82d0f027ff47338c, 0x98381c7e3e63dfa8, 0x426411510837a468, 0x29ce01d5c1f9af8e },
+    { 0x2a97daab1d7d0ae3, 0x5f330384a9703d56, 0x2f6434613c65f401, 0x17472bfc08a1c194 },
+    { 0x400aab2d22c500f4, 0x31797a5b1b84b322, 0xdbf6c3e34961de00, 0x070bea4ff7a17738 },
+    { 0x65ce5cc75572aa75, 0xa6c538384a2ac4bd, 0x4ae899ac836adb6b, 0x2879704be129a7d7 },
+    { 0xff0bf4189c6e6f33, 0xbf71d4258f352fce, 0xae2946d388bade05, 0x1da5c48a8c76f521 },
+    { 0xdc11186fdd871ffd, 0x932cbe6babe8cab2, 0xf1236e679ff3f58f, 0x0f0edf48f5a6dc03 },
+    { 0x489a12d4af5aeb10, 0xb1308e04f3b0f7a1, 0xbb62264aea62aa6c, 0x2be3d78ae8b29b7b },
+    { 0x15fde41535e9c14d, 0xc06229d812494f1e, 0x73c59ca6bb495d8d, 0x17dc0f981b76b2c8 },
+    { 0x24700de2a6e0ed5c, 0x44ba87a5185c224e, 0x2bfb3601d64c9f54, 0x0ea8f3009e9d3b9b },
+    { 0x40cd5eb18f226dfa, 0x3ed32ae5fb0c7fe4, 0x878eb4e425c66ae0, 0x14f0fcc30c0db9a4 },
+    { 0x28a9fa2e31fe962e, 0x746b023c7e4212aa, 0x6b26d211af6dca7a, 0x33a829374aa38f65 },
+    { 0xd44e345e5e7a4b42, 0xf23b7512d59592c3, 0x40b9b3983344f37c, 0x34846a3628775406 },
+    { 0x9c5c00db5eb7da81, 0x3576298e9703e3ff, 0x0b8ef43f9ee60d37, 0x096729d490f7dfc3 },
+    { 0xe2f67f4656911cdb, 0x290e4111c1bcdde6, 0x949e50b6dbfc33c0, 0x31338ef47da79001 },
+    { 0x2c75affbd6d96995, 0x553744f687651e3c, 0xec272f5f0605248f, 0x2894528178756653 },
+    { 0x7fdfa8240628a50e, 0x37e4b7fb6c765d81, 0x46ecd59ef1b46915, 0x1079f9040fc8021e },
+    { 0x575bd28fc066082f, 0xc1ebac66d290408a, 0xb8c8a9e3e0dd8217, 0x00c9212d77e04704 },
+    { 0xe14889c9c5b1155c, 0x1d5918438763ce0b, 0xce77aa1f7e638e40, 0x2dc46a9237fe4b1d },
+    { 0xba7f8b14484872d8, 0x018652cf27a662d2, 0x3cd1c7e952d8fe73, 0x027cb60a9dae12f4 },
+    { 0xe43250f7e31537b4, 0x5622a78ed57764a3, 0x8e11b67523c2b708, 0x05d84e8ed4d87834 },
+    { 0xf32c5f5e3a7d57e0, 0xa25fa963cff33d06, 0x5aff28c2e1637648, 0x157e4bbdec228580 },
+    { 0x2cd756e12e00298a, 0xaf9d4db3430e4300, 0x22b6fd9425b131b8, 0x2308835cf59361a7 },
+    { 0x32669dd4dace29fe, 0xca1db026a1d1367b, 0xc2a5648c149bc276, 0x0576c3279b2ac18b },
+    { 0xabe37e7dc8d5301c, 0x2d0d7fad14241d3a, 0xa165621e3f711ba3, 0x227f35c772939b31 },
+    { 0x1c3931d614d6ed7e, 0xd1c1759c9f6b43ef, 0x6a5e3bed29219883, 0x24d81916c076ef7d },
+    { 0xecc48768ea3f68cb, 0x80a9ffaf76b8720a, 0x5ec09a51e8e1bc99, 0x099cf0049720583b },
+    { 0x0c92b3c4465fbdfe, 0x329c5352490f4ff6, 0x7d2029dab7c69c93, 0x0818a6ea58374ddb },
+    { 0xff91dd3df2759f7c, 0x9269bfbbb40b3023, 0x6fb5fdbba2cf6f56, 0x03084804d93d08ca },
+    { 0x77f6a5b0718cfaa0, 0xc6bb4ec6c2ba3ca9, 0x4b364c57425826d0, 0x011e9111115df908 },
+    { 0x789c235ae34c4ab8, 0xb12f68d42db79e9c, 0x4ffc9b0974604563, 0x307bedee014de6db },
+    { 0x2686c7698c46de26, 0x7792f12533062a02, 0xd38596c7a626b8b0, 0x1a57cf775af0f30c },
+    { 0x3cc2c094ef31dec1, 0x290d252de2a2482b, 0x38cb839b9ed36480, 0x058b1b2605c75e4e },
+    { 0xcb527dfeedce7bd5, 0xc1e82081da02ae5f, 0x6fb019f9d0e701fd, 0x0d44afed39df1aef },
+    { 0xf4326d03907cc2f7, 0x6ff9b4f49ce6b875, 0x336c647dba81a645, 0x13d43f4a7a4e70f6 },
+    { 0x7729c8e04ef228aa, 0x08a8268b4265af99, 0x2c8d1f2090197e45, 0x0c71db06c8afef81 },
+    { 0x44a1908281bcdaa6, 0x8f0844d6198c4016, 0x5edb1b175c894250, 0x3429005b85626b49 },
+    { 0x3a3524ed4480f58b, 0xbcd4a180e74d24aa, 0xbc90beaed6dc3863, 0x21ae93da7ca6f3c9 },
+    { 0x4b1036e2e1cfc1f3, 0xc791d6f2b4d87d27, 0xa2185fa398c237f0, 0x08dcea5053771ff6 },
+    { 0x4672d3a9e6132fe6, 0x5a90974b2ddc8a38, 0x4b9d1b5a83a92496, 0x1fd6fa10f2636c71 },
+    { 0x880a52e4fc06b36e, 0xdd09e05f9c46793c, 0x423a6117fe78ac62, 0x0dea9fb721d7adf3 },
+    { 0x514f538678b376d8, 0xbf9b79fb28a1b78b, 0xf6eab88f5338d666, 0x0db0ba754849ee0c },
+    { 0x2c5d9f2a3d03dce8, 0x8ca64c93ba4ee4ca, 0xeeb4f93bef7f94f9, 0x2974a55cabe21c27 },
+    { 0x9b44d0d277fce85e, 0x9153edc4741afc38, 0x3198c7d2ad24357a, 0x1c6946225d8d79d1 },
+    { 0x4724084653e079e2, 0x06105f2ef5f16e73, 0xa1445650d9c3d00a, 0x2a9057c9ec6cf951 },
+    { 0x8367c612757243f6, 0x92e14c7c30c9fe65, 0x9d0da7d654bb8719, 0x0b8b12d964eeeede },
+    { 0x8b84a9bcac6ddd8c, 0xcbdc8ce94aea15cf, 0x40220fde97445993, 0x267fa4fdbfc97c86 },
+    { 0xc907b4e68a6c1ae8, 0x73a48404d308de39, 0xd965f5487e1ded7e, 0x3f111defc1df8d41 },
+    { 0xf5acb2422eaba54d, 0x5177b089c98398d0, 0xc12cf8dd734a0f8d, 0x3de9aeb0ad56e1b7 },
+    { 0x4f348aba3fc596c9, 0xfe45459121830dea, 0x17e2b6a54f8fce55, 0x3e995f2352564106 },
+    { 0x06e2ec22fff5cacb, 0x4dabb9cdb4fdc094, 0x04a3e327e6dcbdcb, 0x093d7e0ef341b1fc },
+    { 0x9601adfb47dc3064, 0xc511fcc075df0302, 0x421107b8bf05a54d, 0x08c80086ae249aad },
+    { 0x12ad90071605fb5d, 0xfc823c13fe201170, 0x67cdcae77d4a16c5, 0x048070c602caf469 },
+    { 0x1ea5bdc0dae696c8, 0xcd67c46beb870b35, 0x1cb5416f15cddeaa, 0x3f9312a306c60298 },
+    { 0x283e47619c597cd4, 0x30732dcdd00f1b86, 0xc829cd9e664bc220, 0x2e10362907c3a5f4 },
+    { 0x1c29d6c706d1f25e, 0x4a78427e22cdd372, 0xabee3715c0cc4557, 0x2482cfb772186578 },
+    { 0xcf93b475ef3f4fd7, 0xc1011f57a6cbca72, 0x6c4936bc136afd76, 0x3cfc80fe76751e6e },
+    { 0x8b9cc27dfef5dce6, 0x984d0eb558245d29, 0x5ca3a0f6f84bec7a, 0x38c2607b9e2ff93c },
+    { 0xae95edc7c5da9fd2, 0x279433cb0132ff2b, 0x9c082ace35fe1b4d, 0x39fe7eed397d2397 },
+    { 0xe16c1461b6ab8e1e, 0xc67b2826b87931f9, 0x6d814ca5468582d3, 0x18838f5e4d60711b },
+    { 0x79afcb0887e490d9, 0x0c274514e3621c59, 0x628e5e635dbf07d4, 0x214ba39173af448b },
+    { 0x5d525a7be12d5ebd, 0x193dbbaff418da58, 0xf33339a58d95fa80, 0x335115803e9ccdfb },
+    { 0x861d720f6fa2b30d, 0x35a4cedaf593e10a, 0x49a9c9b2439c65dc, 0x09f24a08d5cd29df },
+    { 0xa12d9da954613ff5, 0x955d3a02d93d7339, 0x33817cb0445f5606, 0x13dc18371a05de2d },
+    { 0x31fc5702f98ac83e, 0x9b890e3e23d0c8e2, 0xfa8b029d11f22bbd, 0x007593f51070fc82 },
+    { 0xaabe5fb67a949dc3, 0xfa3804ea7fe930af, 0x56e81351376ed4f9, 0x12f77f5e4fcedb88 },
+    { 0xa0864dba064bc470, 0x25ddc61aef678b32, 0xf298b2f565670af7, 0x21b0d11ef10cda87 },
+    { 0x107dc587a46312f6, 0x5892cd1b5900e4d2, 0x29594cfb5c203cba, 0x374617ecc1187117 },
+    { 0x2b5e6c20d885f73a, 0x2c6bd486df05950b, 0xfe43a907f93b1ed5, 0x2fb129ac2ccb50e0 },
+    { 0xf137577b34dcd7d7, 0x0c3c931c8f12bfad, 0x6ae36bef9ddf7267, 0x3d1d716879c3e23e },
+    { 0xa08f99f0d90486d5, 0x5482f75caff508d8, 0x6c57a36d0f8e0e26, 0x20ddbd0b1959af09 },
+    { 0x7e910c83da45370c, 0xc10959c20510831d, 0x8a15e5fff0651839, 0x1bdaee342ba7cf63 },
+    { 0x4451c0748691d468, 0x2ebdfe57c9236f9e, 0x393a325f2df964e8, 0x17a14703b1cbf281 },
+    { 0xe178f2decc4425eb, 0x06b2dfd4a034592d, 0x977fa9405847e138, 0x0963d30dcd0893aa },
+    { 0x5bd90292e41d9751, 0xfb84f48716952e49, 0xaec7d0ba21011969, 0x208fed8acfe67134 },
+    { 0xbcc3665f0a06debd, 0x7c60426840604b54, 0x98ea0d21d4aad6b9, 0x053aabc47c2e522f },
+    { 0xe5b215b45cb95d6b, 0x7410d44fd7673506, 0xa21cb18d78f74114, 0x2d76ecc48980be16 },
+    { 0x27a127e72adad037, 0x7ce5ce9d4337f983, 0x8da77d5a89012daf, 0x2380ac267a47a092 },
+    { 0xb372d501de057440, 0x5812b124a2344ef4, 0x2b5726999f679048, 0x1a08049449f34f1a },
+    { 0x49235a4b087a8a83, 0x610e0a55663c9550, 0x04ebfd4ed252c527, 0x39db06729aacfa4f },
+    { 0x60636b56a9b1a90d, 0xe744cd4a9d9aaf1a, 0xcd3aa7481b1caab4, 0x29d1c6e136c97ed4 },
+    { 0xd5c0c7c28d7f0c50, 0xc8f252ac3cdb690d, 0x863777abfbe28d98, 0x16535a243b478f6d },
+    { 0x1ac79f320d3f9bbc, 0x5d1e7fb06cd0074a, 0x06a184883ff38b99, 0x1bb818680933f0ca },
+  },
+  // g^(-j * 2^8)
+  {
+    { 0x34786d38fffffffd, 0x992c350be41914ad, 0xffffffffffffffff, 0x3fffffffffffffff },
+    { 0x281d7e00e5d18518, 0x1c54c47b0ff85914, 0x42f0f80bd49c7cf0, 0x0c48c6ec0abb7a66 },
+    { 0x23490ab3310cf5ad, 0x9adf07709f93e6a2, 0x4c1c4bb1e7d4945e, 0x35c451a6d1eac3eb },
+    { 0xc543fcc813a8b28a, 0xe3402adc15c51cdf, 0x2d3ee8613a1d9800, 0x3bfa2b3af66ba0b7 },
+    { 0xf960847dd17e4718, 0xc563ae311df001c0, 0xcab7569702fd177d, 0x373415759b76cb44 },
+    { 0xc1a9a53ca65d6e11, 0x85fd931186b7e753, 0x88b6e05a67db1558, 0x3b06a91a746e1c47 },
+    { 0x5b50975f3baa61dc, 0xc745cb838265611e, 0x0fde404693938ce4, 0x2607b85cae41d308 },
+    { 0x5079c2221d909812, 0xf889d7ee9e0e8fb3, 0xc989f910c9926bdf, 0x372a1a6d77146353 },
+    { 0x502d922a860e0248, 0x9aede8c2164e94ae, 0xc5413491910138a4, 0x05cfd8e66c406bcf },
+    { 0x0b13acd2dedb684a, 0xb5891f8236cd4322, 0x2d5eff28571f0fe1, 0x023b260691ee5070 },
+    { 0x491c8fab5995fdde, 0xe7a6bf78a25a7c26, 0xd8deebc3211f82be, 0x108273e6a09c96a0 },
+    { 0x2fde87801b92a22e, 0x8f82353939c32547, 0x8408d67caf458383, 0x144f65c67444dfa5 },
+    { 0x91cf935894305fb1, 0xb1ed39c7fafae84c, 0x6123af040b493202, 0x38bbfdd4eb8d721e },
+    { 0x9d0e2acf7cdf9f2f, 0xccc51a6edb7d010d, 0x5db303c07b9f057e, 0x03bd55352209a8b2 },
+    { 0x022bacbc911fdb8e, 0xaca631367e4d85a9, 0x3da79c18527f63f6, 0x1d53a26c68ac1e41 },
+    { 0xdb86498671ff3727, 0x99b2243ec7659f1b, 0xb4203c1a1f124747, 0x2695bdaefa0fb0f1 },
+    { 0x5197df495903edd6, 0x4cd4032ca9fbc7cc, 0xe4f26df7f8ab0371, 0x31ea15f1acd46e73 },
+    { 0x113982991ac2fbe7, 0xef752f6b5be1f451, 0x16ef0ffb2eb81374, 0x2949415c3d30d6fe },
+    { 0x181d1ea01739ba66, 0xddee9e63460ea792, 0x07a0085019055bfd, 0x17db4c0042147476 },
+    { 0xd5d67db345db7b95, 0x83bcaed9b61f1525, 0x19acff6302022a4a, 0x139880b51e1a7c01 },
+    { 0x16766310e9daf1f5, 0xb030bce0698e41fe, 0x1140efa6f9aa9ae7, 0x3cb3353a33903e11 },
+    { 0x5e6aa9316b373fb7, 0x005cbbf28d6be945, 0xba211f3f99b9e68e, 0x3d548eadf102e853 },
+    { 0x18612f175ac4917a, 0x08f959ef1a3e3e6c, 0x8dae5400700e1395, 0x1b684a4e47c8ecb6 },
+    { 0x7f2b3ae765825f73, 0x7c43ca2d4b5ed848, 0x1c3e60adf4665911, 0x053aba68abc86b71 },
+    { 0x6730b525edbe8e1b, 0x3cca1e21a48ef89f, 0x6e3dd32ac0a4e686, 0x0ac8d9e2ffdeff0c },
+    { 0xa264b8b576038e82, 0xad625ae6374d31be, 0x3c4adfe1c4d6c092, 0x1265bcd26ac3cdb9 },
+    { 0xdcc3543ddc2b25e7, 0x883323865591eb84, 0x8b02e1fdb2875c3c, 0x2d4aebff2807fe38 },
+    { 0x33b58a519e1e2353, 0xd2172925f5646d20, 0x036f1764aded97c3, 0x09a204db0c31eaba },
+    { 0x5278f9a9fb80de2e, 0x5e9465c8cb469a19, 0x3bfce83881bf194f, 0x09468f758b383e3d },
+    { 0xdca20875f2a53379, 0x983c06091379403e, 0x559053a225690c3b, 0x314ff52722a88771 },
+    { 0x9110dddc4e9360f6, 0x9fb61d0904ade150, 0x1413a74f81372a05, 0x38733880fbd828d9 },
+    { 0x10e55144952341c8, 0x85fafb0ded23c4c8, 0x6176be7406994170, 0x3f429e5fd4e23792 },
+    { 0x89990be10d94140e, 0x2308171169a21f4e, 0xbf9492adb949c6e6, 0x3c7978e8b41f50d3 },
+    { 0xddf0e4ef8165d0d9, 0xf075ee0b1359db07, 0x1549b27ceae33560, 0x13ed5c9f88fcd3a0 },
+    { 0x3676b5255be048ff, 0x3e5fe09db43a430b, 0x0a3b10004cb20cb9, 0x0697ce413b4dd4e6 },
+    { 0x2249801d835d4f5a, 0x2dd0839db23c91e4, 0x9ec7b3835bac27b8, 0x1ffc05873d976ab5 },
+    { 0xafb39d5c28a73852, 0x8ccdeb67a35df93e, 0x248a1cf238fe137c, 0x039ddaa4a5428365 },
+    { 0x8b7ee3d02c68b7e3, 0x2dcbb8cad968562e, 0xd354a6f798112cbd, 0x1c5adea377a8481b },
+    { 0x06b6f5d0e5428ee0, 0x4bc81a8c5ee93a18, 0x1688cbe3ef9bbcc1, 0x2c5b2b55da0b5ffa },
+    { 0x0c463480482cd338, 0x0401c96f131bd06d, 0x84bce3b8af9d9139, 0x00f2e4ebdd806a68 },
+    { 0x38c78adbf98d42ac, 0x3569f55d7a327483, 0xce290fad84d660a2, 0x20f051ee21377199 },
+    { 0x3584cf001c7557d5, 0xd8fd2e3fb9df6187, 0x5342b2f0abefe6fc, 0x394498057657708e },
+    { 0x34e10ad38156d1de, 0xb3999fed3952fd1f, 0x75a2fb9ac04f219f, 0x2159e37f13e24fa7 },
+    { 0x3fb9ecd7edeba610, 0x8750a563590ded0e, 0xc77861556c0a58fa, 0x12a5809ea10a14b7 },
+    { 0x30c5639fabd32692, 0xdc061e46eb6fd8eb, 0x97bbb5c4bb5b9333, 0x30ee0f7a63e0e80c },
+    { 0x5891df309e90060b, 0x7689cb953497b53d, 0x63f84cbe23cc65a4, 0x1c1aa044e58a9c8f },
+    { 0x20382461c66f1061, 0x807807c463db4c95, 0x4dbb0f352debf855, 0x152a743a73ab6268 },
+    { 0xa6e009893c9303cd, 0x647a36f77e8abd5b, 0x9aabf83fdd89923e, 0x033129fdc7349350 },
+    { 0x76ade67bf2e35d07, 0x357047f6279c1055, 0x376228b1de6e7e3d, 0x12cb3fbb95a55851 },
+    { 0x9f2779c584fdaa28, 0x3e82be72efd1e319, 0x6746283e310cda86, 0x1d3c33432768807b },
+    { 0x99e34c7a60e15aaf, 0x4ac12a7470fa90cb, 0xd55b20060e8de306, 0x0124bd3206ca047c },
+    { 0x2472f1bfd5eeee88, 0xdbefd89ce0e5419c, 0xd946b704eee3d735, 0x0fe4aa50c6abff90 },
+    { 0xebe38e830fa642f0, 0x55a7b97678d439b7, 0x937103da1b031057, 0x2d457d81c0b134f0 },
+    { 0xcebcd5d7ef0d34e2, 0x4aac567a54c6b296, 0x207fe1f7fb8d1ab1, 0x16125999c37672f4 },
+    { 0x43810aa46834ba08, 0x86bd05d2213ef935, 0xdea954bd5de1de30, 0x365a73e281527b2b },
+    { 0x828bafde66f02cb9, 0xdd52107b8c20c2dd, 0x67fb251d573b6545, 0x2a1e4f9237bf797c },
+    { 0x5cc6d61a134655c3, 0xbffb7b80c5e4815e, 0x473b6b8cc67e4aa6, 0x0bb0591bca82270d },
+    { 0xfad8b8096c1f8fda, 0xca2920ea02788253, 0xbfd8f504cefc6482, 0x08c6b0b18ebff2c7 },
+    { 0xf5c8cf496c8410d0, 0x9f637b5cf21d3781, 0x2ed202010d0e90aa, 0x17f0994d3944fc9a },
+    { 0x29495535794fb0e6, 0xa292ddd449a09cfc, 0xbf446706ea0e89bb, 0x1722ae8306ca89b1 },
+    { 0x4dd58f5ec3cf46d0, 0x9ffe95d4d776c01b, 0x55be33e28dd84a0a, 0x34af31d2b44d1478 },
+    { 0x563c8133696d2ff5, 0x6bc47f731ee056cf, 0xb556d5af78b244c1, 0x006bbb5d68934031 },
+    { 0xa204850be6b0971b, 0x78e4c623bcfda3ee, 0x184953d622ac00bf, 0x350074566c0e264a },
+    { 0xfa162886ee56d68b, 0x7e6f579d284f70be, 0xc1bc09fc08a02b37, 0x0affd72e668e679b },
+    { 0x10802190c35fbc24, 0x7a4d3a764126bd02, 0xe4bc421e6de64119, 0x0b69c128ef08db88 },
+    { 0xd5d6a2df387c7309, 0x433a8b244d0e6443, 0x11c049584aacb607, 0x2a669900e97b7304 },
+    { 0x57abeed6542139ce, 0xbf0614d5aa5c0299, 0x733659dd5e8f08fd, 0x2a2ed8fd37aa924f },
+    { 0x32f169e2333f83ea, 0x81c2ce40804ebf62, 0x54e6869501493c09, 0x2fdbf2af5e40bc41 },
+    { 0x52e3661f627189bc, 0x3c05454c002b1214, 0xe0a8ad0e69afce0c, 0x1e352c13e4307dfb },
+    { 0xe4259695ca8fc1bf, 0x43962032844da513, 0x565eea6918ee3c50, 0x0c4b7d4e37241eaa },
+    { 0xa06df3dc7465fc9a, 0x3de23719fce95a76, 0x28af49c6fe000d75, 0x11650d12ae1b3c2d },
+    { 0x9b6d5203b93a2097, 0x718728e0c36eecc1, 0x057055a4f8b7b114, 0x13af4df2de9b0cc9 },
+    { 0xe803d115c66af950, 0x8dd8a881eb38bb1a, 0x882e2455129125d0, 0x16800725cf521a6f },
+    { 0xa70a916cdc97bbbf, 0xd8c8de3a0d7ae576, 0xcc78e1e07a40c8f3, 0x0f20bbcc5d0793b1 },
+    { 0xdb48b4c4c88c7bf6, 0x6780b9da6b80a9ac, 0xbdfc0ccbcceabdcc, 0x297dea1cf78faac4 },
+    { 0x4c37b298765c93ce, 0x10a279d01b3566c6, 0xb7a1e33a9a2a3f63, 0x2c495480f01aee46 },
+    { 0x92eefd4199576f59, 0xb52688a1d4ce514b, 0x393ea362b01f8fb7, 0x2c0833e1dbbf3f8b },
+    { 0xb7bcfdd4b5b60ff8, 0x667c28804a0b4ff6, 0x86666dbf097c3ddd, 0x3c650cbfa4b46b03 },
+    { 0xe460c6dc3c77fc41, 0x750bda50150c1503, 0xba7c58a40b96036d, 0x17fa00ab78600775 },
+    { 0x3bd8fe560bd0095e, 0x8803f65431a7449e, 0xc29d3d324b2c9e33, 0x17ff97d0c9f068a3 },
+    { 0x6ad56301def0c5f1, 0x376fd81b9357cf63, 0x38c35bee137995ca, 0x1554ed92e2537878 },
+    { 0xab40583d69bb7ee2, 0x3dd37733bb0c0668, 0xeb45ba17e552eaa3, 0x242ddc0bbb2b0379 },
+    { 0x9cf3ca302373ba52, 0xfe2d8caacd44f6b5, 0x177fbabc7ca58229, 0x3526b7cf05ddcab6 },
+    { 0x7ffcfb5d0cc00142, 0x0f8d3709ac029914, 0xcecea524e3881483, 0x3c16b750a9aafa57 },
+    { 0xbf1f61cc8376a15f, 0x73525f223ca4fd57, 0xe2760933d1591489, 0x05bd26279e3e760f },
+    { 0xd91cc0a6cb0b6f25, 0xea87ea0ab1f5b829, 0x62603ec750b39145, 0x0ba7d10dc7afb139 },
+    { 0x7ef20492025fd958, 0x58163b5b8a457ca1, 0xee2992ba1089adca, 0x30748194a1392401 },
+    { 0xe49df6737cb82912, 0x80f01c44b5af4b31, 0x7cb7fbaccd0f7d57, 0x15490392728a5ba8 },
+    { 0x922f49414fe174e1, 0x4568fe949ea6eff1, 0x99ff82d0bb5453c8, 0x0b61fc5d9e3aefd3 },
+    { 0x5af1b229b50f9bbd, 0xb10cec8feeaeb4f2, 0xbc6196f04b3d6f9f, 0x0b57ecb865f4f3c1 },
+    { 0xdc9fab9516fe84f4, 0x7d303d9144a92d90, 0xc09a36f72e1d75fe, 0x1371167fc177c98e },
+    { 0xf65dd79db2692ae3, 0x9c8b73b38ea39204, 0x73f05a5228b6a1e8, 0x15470d0e3b6e48b9 },
+    { 0x213c3b7cc623d2fb, 0x7df5af849604361e, 0x270a1b0dd09b5ead, 0x3b3a0239348a5e6e },
+    { 0x5971970de261622c, 0x7c3e8337afbbf181, 0xd2b3fa343eccefb7, 0x3b863b46c82f6d28 },
+    { 0xf73de614b70cd2ca, 0xaf4154656d447c94, 0x9192bca3def6ebe7, 0x31d86e5936ef743e },
+    { 0xcff303713a6e6be3, 0xe1cdd1d634f4fcf2, 0x25d60a63d4416ae1, 0x24cfb04e5000599e },
+    { 0x741550deccf66484, 0x42186a71b5bbca71, 0xa02e699aa9071e53, 0x179ba3fbb7ae6412 },
+    { 0x8c2313bee8588b45, 0xbb7e5bd6ed2e794e, 0x57c11b727d915dec, 0x0c3049a22029b2df },
+    { 0x085583637d4abbd5, 0x3780ccc5542b9d94, 0x6b965ec52602e846, 0x115557b62a38d7d2 },
+    { 0x1ab18745bda2e787, 0xe0287bc9f364949e, 0x5acb4911f3375663, 0x1fcc49329d95de2c },
+    { 0x126a24f438818a50, 0xd756dfef289eb773, 0x7a26da3bbb42f0a7, 0x31afd116552ff0f7 },
+    { 0xffcf028d381d413d, 0x86e4099093888233, 0xbc74c00194923088, 0x10b7580c14963156 },
+    { 0x4905d71194bbff3d, 0xb53388e191a1a3cf, 0x9e67eacd7c078906, 0x257d00a549ad9524 },
+    { 0xc936b0fdf776a501, 0x684eae275723844d, 0x7d13b21d3a84484f, 0x09f918fb41c32572 },
+    { 0xfd0cf4a10c6cb1eb, 0x476d949e3a956fc3, 0x6382d26a9a92f432, 0x02f1fdbce0d5a6ea },
+    { 0xc9ac6a8149ac27b5, 0x3ad66bc5f60c890e, 0x5708d2a7b25c9feb, 0x14aeb6cd946e35d5 },
+    { 0x8760945aa3b08eea, 0x4fe6e6f28bc56db9, 0x0ae0055b243ffdd7, 0x3c4a402a242d2b50 },
+    { 0x57a8f0916a79174f, 0x19cc8bb438078a8d, 0x44f7f214f7e3b25f, 0x3ab82f7f603981b6 },
+    { 0xb8ed2c552f547c12, 0xedcb7438d7e5b959, 0x03d47a852a0cd798, 0x30dffca9ec6fcb8b },
+    { 0xe2ca4baad692ceaa, 0x652ac6ebcf7ee98d, 0xe8dcda21cba5ff4f, 0x307d5d9f0b34e7c6 },
+    { 0xa05966484287db25, 0x2bdae62f818ceb93, 0xb1b35b82677d50a9, 0x07c7666d1a96de76 },
+    { 0xd582a1aa9193a95c, 0xdf0bed3c47a66c05, 0x06e3d0a321b9bf39, 0x1ca6044d4db9ca51 },
+    { 0x893fc24db0d51f47, 0xe9deea48476a2d94, 0x88dfa6d13f3e8d0a, 0x0434ab74be7af235 },
+    { 0x91f61a2c714452a7, 0x00421f9093f558b1, 0xeb49e57a69b51a92, 0x21a23ceaf6e09af6 },
+    { 0x0afe222e652edf64, 0xd2f148b41a0e738e, 0xd35a126d9132294b, 0x1c837467ce98f83f },
+    { 0x5baa4ad014358572, 0x793461667bed808a, 0x6af842d250a7dbe3, 0x0493b593ccfc5736 },
+    { 0x536127acbd289cce, 0x450fcc5e8b0e08a7, 0xba2682a2b8c1f199, 0x03a967a7ed20ea32 },
+    { 0x5777128878f07bc7, 0x5de279719acc3f11, 0x74ce761d59b59e4c, 0x09efef129563139a },
+    { 0x90894f5f64ee6079, 0x39899a13897e2aab, 0x09dbd00890b159c5, 0x3c208c108394fd86 },
+    { 0x53aa57442d9b92b7, 0x5a5ce8373c40987e, 0x903c28ee9457e6a4, 0x05fb04163d094055 },
+    { 0x62445e7a1b3927f7, 0xd0d14f98baf3e4e7, 0x7e09c64bba7071dc, 0x22de5afa17df0f8f },
+    { 0xc21181cd57d0ee14, 0x0113aa5124418c3a, 0xebfbb2dc1ebea092, 0x39d4689b427a86ca },
+    { 0xb86a437d1893dca8, 0x314f26bfe565894d, 0x9f9aecae391411c3, 0x0d6a5460db92848e },
+    { 0x59468441112f94d0, 0x0a32b1ea97786e7d, 0x11d9271cc3f6b358, 0x39195308da202b48 },
+    { 0x2c30929d137d0fe5, 0x8c3d49512192b906, 0x1df3cd8b8fb21d47, 0x094389a0023aae71 },
+    { 0xe87a2a0974ecc7ff, 0x6ede665c2c1f4922, 0x4bc27c5eaf8670a1, 0x2348b487c1d97109 },
+    { 0xdfbcfc2f80729e7f, 0xe96122ed9996ffec, 0x77dfa2fa105cd023, 0x2f580ebabd4e8746 },
+    { 0xd8bb5b2c75519f1e, 0xcb5589d385e93147, 0x4b1c6e7e4b58926f, 0x26d275fc1f52be9c },
+    { 0x76c96791711e794f, 0x92a564081f65413a, 0xd0495ba4620a60dd, 0x25b6de6c627103cc },
+    { 0x27b30405230bbfda, 0xff387280d31d7bf7, 0xfffcc044cefcabae, 0x1e9f35fd1df075ae },
+    { 0x1e0a825c0d76e91f, 0x197224125ee0edf4, 0xecf4a608eea56970, 0x0888a33739e3be0a },
+    { 0xb5505efaed3c36c8, 0x2d1d3143c47febef, 0x6cbef87fbf8778c4, 0x3a35dd7bc07af2c4 },
+    { 0xcda9ef63d25996cf, 0x8ad32755b7cfc265, 0x527c663e6fdc6397, 0x25508c995be7b04e },
+    { 0x1c70160ab29c49fe, 0xbd3edac3a48706bd, 0xded0e79674dd3ade, 0x3449f852e1c19fac },
+    { 0x6df94ffd51bbf30e, 0xe7e29025fb5ff132, 0x7a3907db17b11043, 0x03120d129c11bea8 },
+    { 0xe8ea83a9f9703f0f, 0x66cca0e2d4f03e33, 0x71b102cde9f69dfb, 0x0de5081e3cabdca8 },
+    { 0xa81bf93849d41580, 0x2b5dafe49522dc63, 0xa563469d1635bd3f, 0x3e5818ed2b670a70 },
+    { 0xa15c46b52e71cbf5, 0x7c8cb9cae2f0a6a4, 0xc54771ec81772a17, 0x29c09d55794d0afe },
+    { 0x422847a6d2e390a2, 0x67cc3299f6a88229, 0x6758c0df26799d2a, 0x08a70e7200793b32 },
+    { 0xf4089a67e7c337f7, 0x85076f74c9041ef1, 0x165ae002543ffdea, 0x1077b4c6709ef3e5 },
+    { 0x6ab7bc5c916d2871, 0x432d5742f09ba261, 0xa60dce480e819e01, 0x014fb9d86200abb1 },
+    { 0xb4781bb44ebcc277, 0x6cf6f2e83cf2c997, 0xee336aa409f42451, 0x311749859182ddd0 },
+    { 0xd39e9dd93b4d5247, 0xbfed1c7c847dce68, 0x696c23796d7a85bc, 0x30d8ffcdeb3dc106 },
+    { 0xfb5d0384d17df970, 0x459445f384b828b8, 0x7368a9d935a0ff5c, 0x3dec6e300af55c67 },
+    { 0x888e891faf7ac09d, 0x79add3071770c6a5, 0xfbf6090a1e1ab460, 0x26d9b83b46382222 },
+    { 0x3817aa0828ec5a0a, 0x5e6417c34950146e, 0x232d2757663cf43e, 0x3a9b222b05e15f4c },
+    { 0x0f70f4049c1b23b6, 0x65859116e8dc939a, 0xf95b63b609a21db8, 0x32acada7e0cdc6d4 },
+    { 0xdb26a77cb9a63f8e, 0xbb74e690f59a92ea, 0xb10bf67fe0c2bb9f, 0x3ab3a672ad2ab115 },
+    { 0xcf265938b2105f12, 0xad2ea4e803713bb3, 0x6d140c068a802dca, 0x1d25a4c690d7a8fe },
+    { 0xd7a0ef8cb7a963e7, 0xbd039fed30a68f02, 0xb81689c06ccd9125, 0x38fb980fa88aa5bf },
+    { 0x712ca5067826119d, 0x0ea6b57f23c350a0, 0x7a87cc993cd0e5c3, 0x18af867d973fbf6f },
+    { 0x2f8d57216b431a6f, 0xd332cf87f1c27465, 0xf5d2bdb336910441, 0x31eb41d93647c53d },
+    { 0x919efa32ed1327f2, 0xa5f31dbc1a78b519, 0x49ea23a53292f6d6, 0x0b776efd2484d82d },
+    { 0xfe39b588b73b9cc1, 0x59ac4fb02d3cbb0d, 0x9af9ae499c8f294c, 0x3224b93b395e9a6e },
+    { 0x505d0466d6da7502, 0xbd5580b6ef5c6773, 0xa7e6b7a86a4f5167, 0x311fac1663e9b8f4 },
+    { 0x74d5719c5ed4530d, 0x8ff7d2771422174d, 0x23ecc302869b76bc, 0x34b87ffd7c2a3b0c },
+    { 0x3a32f89f517883ce, 0x526eb33256016f6e, 0x0c02a432cec939c9, 0x338feea76f324757 },
+    { 0x5e30dd2c01ffc07d, 0x02ac0b611a053dc9, 0xb21d2e40bd6075e7, 0x16378023d2c940e5 },
+    { 0xa5925bd72df88857, 0x2923e1ea95504119, 0x1343330eea48030e, 0x21156f897325b140 },
+    { 0x65e92c72da44f7c7, 0x5a15582dfd53cb10, 0x959dec9f3ae9f4ee, 0x2c650d8674ca6bd2 },
+    { 0x91257e546c96ca38, 0x43a929655b908727, 0x394a14d149648abb, 0x01611926d5285edd },
+    { 0x9070a4fdc0ee8554, 0x6a7f5c56cbb73342, 0xbec9407cf28826a7, 0x37975acb575c7b76 },
+    { 0xa05f257fbe003b64, 0x29e8943468a5f39d, 0x3245a9c2df8feb40, 0x1cb245950ee9ba5b },
+    { 0x2b6884d3ce29f278, 0x5fe0c47332db3148, 0xbd69745da967fb2f, 0x173d6c25da8c1bca },
+    { 0x065d5e7894722a6e, 0xbd0561ee4384bdbb, 0x77e693d693502a75, 0x1cac000d11ff5a58 },
+    { 0x1439d7d0d869f315, 0xe2009b6dcbd87f73, 0x2df841ace705f70e, 0x1be71a45e99805ab },
+    { 0x1d9310731cf8f9ff, 0x88f4dc8b2e2e7726, 0xa30b1df1e24676f9, 0x210cac85620e482e },
+    { 0x72434674617a10b7, 0xf1b34478a8d89fae, 0x21bca0b265672369, 0x14b8de71152f7e7f },
+    { 0x50a8407527e27249, 0xeb3247145ff04e07, 0xba9b22d5e2b3f74b, 0x387b4feaf1585de4 },
+    { 0x3a4541f52bbb95c3, 0x2b2f7b371ccb349d, 0xa575b17a4924a366, 0x13889fd0ce258e04 },
+    { 0x7bea78b2651de0b3, 0x181c6d6b91196d7d, 0x13dc222bbb13e289, 0x3b06ac6a7e6d7e1a },
+    { 0x514e987fa6ad260b, 0x0d61b44315420420, 0x141dff8397d68b28, 0x3c331630ba5c5807 },
+    { 0x6f7f25083067f2ea, 0x88e39f85a6b6e896, 0x2017f92ffb48d2fd, 0x0075a4de950d53f8 },
+    { 0x4ec6fd4047da85f5, 0xf207b5af31a9dd3d, 0x28dc0cb9e963da2f, 0x044512134a8e70a8 },
+    { 0xcd88e70cb96bacb3, 0xbdd1349562de648f, 0x59ba5c63c16545b4, 0x14e84be305c42225 },
+    { 0xeeb5d7ee6630387b, 0x3f67450ec8255256, 0xefa48f2b07d55080, 0x0d33199a21da58c9 },
+    { 0x67d4b73fc0f7ceac, 0x555d861e23f43aa5, 0x1daf224a342ac667, 0x3cd692b6a65648ca },
+    { 0x0330f5f028690b4a, 0xc42111075009f9db, 0xd1f12a068e63cae6, 0x0ebcc3be05bdfb3a },
+    { 0xb403f7fd82543502, 0x081448372f062745, 0xd6fec9817ba8078f, 0x0b570d054ca67027 },
+    { 0x4490eac78df3891b, 0x1f91326d0430adc3, 0x54919d2c802fc972, 0x25b06d2059826adb },
+    { 0xcb9d6bd08723fbac, 0x02ccbf9f91eccfd1, 0xffe8c7dfbf47b84a, 0x323c273ce59489b5 },
+    { 0xba0d65db416f05fb, 0xde2c43429030af2f, 0x36508dd53bd88ae6, 0x211c6365d1b7e270 },
+    { 0x9b61e5e9a765d3ba, 0x5eec7c0eaa553e3c, 0xeeb20a634273aa5f, 0x19e721aecc645537 },
+    { 0x15be78e60a172e32, 0xd39c1b6517d917ed, 0x33a13a210509a3b0, 0x0415e79878097b88 },
+    { 0xea031c72b23b6b7b, 0x0dfb333694dbd333, 0xab835660f47b31b9, 0x2aa8d2c1e7df397f },
+    { 0x4f60ae05649998af, 0x7407720b60a08ac3, 0xcb1cdc0b919f71cb, 0x225df15ec5a85894 },
+    { 0xec1d78992d91c0bf, 0x03807f01fe6ac69e, 0xd95ab0b8dc404208, 0x16d6cc8a8e71fe6f },
+    { 0x2757c8e96ec1f110, 0x3464be0d9f92b802, 0x3b6d0a9631ae35df, 0x1b27ee9818b16db3 },
+    { 0x512797272bcbf20a, 0x02583129e8e65b3b, 0xefd74156f107c38b, 0x2d73839ddfb6bd47 },
+    { 0x6626ceeaa75334f7, 0xf0e108f209821f4e, 0x10d37e7f099927b2, 0x2ffd1a651ba89648 },
+    { 0x714fda22e7b30d40, 0x5e23aabcdab6b237, 0xcd211e37b8379174, 0x368ca4d07ccb68da },
+    { 0x53cbc0c910d03b91, 0x0076116fa4c42dde, 0xcdc661ac9b56d571, 0x39ec52811756dd6b },
+    { 0x6866017257575ada, 0x193923bfe0221fb1, 0x39a3032d136df87f, 0x23fc6df0819bec66 },
+    { 0x24d67f370fa5bbb5, 0x70f46c2ad9228acc, 0xc087267ca10ab121, 0x0e7972eddf3c2b17 },
+    { 0xc39d8ae4d698637a, 0x7757be90e6f77377, 0x27c51b24b775f773, 0x18aa71f5c3eef085 },
+    { 0x73b732d2a20d98dc, 0x9d4cfbaffb7cd073, 0x4397eeb17ebd4689, 0x08f0ea87388568f2 },
+    { 0xf6d440d948dfd15a, 0xb0d465076046229d, 0x0b50cf4635c09a66, 0x2c03003714724b7a },
+    { 0x38a58115911e2630, 0x09c7d910f81b602e, 0x6907adc4a7628054, 0x152cddd75fe89955 },
+    { 0x6bab65774f64da0a, 0xb4561ef4e72f80a8, 0x7de9f32449c7a56b, 0x251111b2841d7e29 },
+    { 0xeea81cb01a7182d3, 0x15bce73308855492, 0xa5eb29006d8c438c, 0x0934831b9cbe08f2 },
+    { 0x43e6184566c46164, 0xe14e89523baf1ad1, 0x01afab1d1f52fc0b, 0x2d8806a75f2a4cde },
+    { 0x70d24ae9470341cb, 0xe601ce39e2a43e14, 0x506fc289344e880e, 0x11fc895c04045dce },
+    { 0x8f97b3ced5c19f55, 0x3eb356a3361e2bbc, 0xe95b21765951505f, 0x0f4acbf9ba79c053 },
+    { 0xc4d425ec1bb6dd2d, 0xe4c293de5e1bda35, 0x21e57ecbb258c350, 0x1d41aedcfe856700 },
+    { 0xf907b9244861a3ff, 0xc19f5a2c1dd1bd58, 0x6f017c50ccb5f691, 0x13d336da74e4d67b },
+    { 0x2305527504705e04, 0x54805e13b7130d1d, 0xd830e2f1cb48e0a0, 0x2d1583db51b0db76 },
+    { 0x3fb27ea6afc22436, 0x3baade122c6f7a61, 0x42e170fd72faef4a, 0x2e27069097e06417 },
+    { 0x7817593b83566c54, 0x08733c1e23d9617b, 0x341f8d621a6f847a, 0x25e2c086b893f30e },
+    { 0xd20a0fc4fd30b57c, 0x4114726c59154ac5, 0x61d41a9de583f010, 0x08a20b591e1f7c98 },
+    { 0xf8d900a82581c7f1, 0xf9b446cb9ad601e7, 0x00500d1b5290ff70, 0x1865bec14d96bee3 },
+    { 0xa97b4412e32b14e6, 0x75dd2f799f06debf, 0xef3db522913c1bae, 0x00b13fefbd3a73fa },
+    { 0xe47487cc4315fe17, 0x08ed2749b9dddb00, 0xa3a4f46b13402ea0, 0x22a4ae76f8229dab },
+    { 0xe1cd631f7e20f122, 0x6bc147ad3d11b620, 0xb4f6fb766cb0106c, 0x2b28f60a931328ab },
+    { 0x81d3a01dd6d8cd5e, 0x3e782405e7b466bf, 0x9ae7ac340656678d, 0x3b68289ab03bbd7d },
+    { 0x19ebc83f6ada08dc, 0x251a5e9ef4a8e51a, 0xe7981a856f072eb7, 0x0c2c1a02df8568b9 },
+    { 0xed5eae1f8b4f37c9, 0xadfdbb09c0d8f34c, 0x75c7bf2eeaee1932, 0x1cdc494c95a80728 },
+    { 0x50add213f11718b4, 0x97d28628e1fc7bf2, 0x3cecdad9c0ce46ac, 0x3370a017561bfa71 },
+    { 0x8547137ce6963a48, 0x2b9d1f266c50ece9, 0xcabdd558cd207bef, 0x2ef7246d82f55d96 },
+    { 0x7436995ee333fdbd, 0x98c96de6d4742997, 0xed938a1bc32cbd41, 0x392132a877c26634 },
+    { 0x16c25486bfe88c31, 0x0cf6247e9d0096aa, 0xcd1b194b41c59974, 0x3f4b0d934d8856c5 },
+    { 0x8e626c262adf96b4, 0x62f0e94037e717bf, 0x49b091b16c5d478f, 0x18be79ff9850c777 },
+    { 0x2786abab1dfe8e13, 0x25ad4df0cee2e0a6, 0x890953c3b0fb0b9d, 0x28d8b32c78bc3257 },
+    { 0xcec6b4c2244906a8, 0x29830aa30909acda, 0x78e6b4f1e184975e, 0x0797f9cf28e5c107 },
+    { 0xa540157471b3b1f3, 0xe7d312d6e088121f, 0x9ab2bc2e0c83a8da, 0x31243c059e38e4d8 },
+    { 0x35b3895777b77cf7, 0x673f4f95ddc6e6b5, 0x8facf1ef51418807, 0x27fa6aee240794c8 },
+    { 0x48f188edc8756396, 0x6156fbaff9fe7f03, 0xcbadbc47acfc7f3d, 0x257b31bddb6dae17 },
+    { 0x9a8f53585f474481, 0x76cb1aa373307e23, 0x518996e170ffb13b, 0x122d560e71b5df42 },
+    { 0x3152c95be201c82b, 0xc83df34c4f92fb95, 0x13ddfbc1d88fe58b, 0x0ac352d01d82cf85 },
+    { 0x8a58196ffcaca926, 0x694faebaf1e76956, 0xf111ecd8e8e9ee87, 0x0db50a424dff9c5f },
+    { 0xbeef7b1687f81593, 0x181ec73460703aba, 0x60ae17497bd4a220, 0x32b72e30eefc8a04 },
+    { 0x72fcd604b5a71c6b, 0x396302c12572a7bf, 0xf6fb2ab7bd402661, 0x19b7382668b54a48 },
+    { 0x294350f56f74a5a8, 0x6f5dd5ec508210ec, 0x04ef6fc6042afa9d, 0x3e3f6418c9713a56 },
+    { 0x46a85a1bd627fc32, 0xe7145ad5179e1a39, 0xc51553df8928662a, 0x0211208dc973d51b },
+    { 0xd47570899498256d, 0x0f7bf7ff24bb73aa, 0xacaa35b50c305eaa, 0x10ef12c7b122baff },
+    { 0x0a32b3c835234075, 0x204da20d74ceda49, 0xb7d6e73cf338948a, 0x0833ebd55d01305c },
+    { 0xc782da4313a3d94d, 0xcc9373784991dff9, 0x5df699c3579c93e0, 0x2727a7154652b160 },
+    { 0x7382ab00a2968913, 0xbd0021fdb8326270, 0x2aea324e519eb6f6, 0x0ccbdce420a5ff67 },
+    { 0x04b35250d5e4a1f8, 0x661967f2a6c047d3, 0x3a9619c6871add53, 0x3925125e492274f2 },
+    { 0xff5bf27833b95c29, 0x60cc9de90c89a676, 0xd4faa7e61e1f62ff, 0x05690f41549f67a7 },
+    { 0x79fefb886f0203a4, 0xb1a88cba1560bfb1, 0xfec246b2997844fa, 0x09f758a89505492b },
+    { 0x1addac82a0d4a7f5, 0x4d6a50fd781c34e0, 0x7c6f89a8f5b1e1c5, 0x389ab30f6dbde180 },
+    { 0xbeb8f6b121c15ed9, 0x0a0e7223c5ab31cf, 0x86cfead1e51f9c92, 0x111bb1eaa1188ed8 },
+    { 0x909eacf4588a9a94, 0xa99bbcf9b33743e3, 0xc3b4ac99a2a86c45, 0x1fd7d93177bb4612 },
+    { 0xa7aeb65cede432cd, 0xe26fb01ee8df1753, 0xac91f17be4d0905c, 0x03b0f3307567080e },
+    { 0x33ff7326efb082a8, 0xac70967c34df3f0f, 0x3dda9635594ff57a, 0x108fd7736c888923 },
+    { 0x10d0232538971b75, 0x9690f6d4a4cb7092, 0xc7fd0bf0e6c94cf3, 0x1a6b6541299adc71 },
+    { 0x079d96ce889c6577, 0x21a2da794f6620fd, 0xfea83775c0cfc20c, 0x3ff7cd0a6fd46426 },
+    { 0xfd1ff700aac824ca, 0x84f59eff8776f7a9, 0xbbea0a5e45fbb795, 0x37d7575b3de64803 },
+    { 0x77ac906b92279ba1, 0x379aabcce4d31af6, 0x718f7972f363b081, 0x255c8f4bc4eb983b },
+    { 0x7edde487c72b308b, 0xc8dec809c8204adb, 0x8921c3c4613de720, 0x1703daad1ef7e07d },
+    { 0x198286a2a3936d70, 0x943118272a318dc0, 0xa058cd921ac91ae9, 0x3db4ef6456e4a522 },
+    { 0x679ecacbec7166fc, 0x207d93f6455594e6, 0x677df709cd189c06, 0x28034390a87b6156 },
+    { 0x60caa89ebdc5212c, 0x1df68f022b7b7caa, 0xe6bab36f880c8ad3, 0x15c99e9d483bdb49 },
+    { 0x54582134c880334d, 0xa3e030aa8ba16556, 0xdf10066184d19370, 0x2c5f515a96927da2 },
+    { 0x4b98488cc4ce72db, 0xe8ef1579f958ffda, 0x424b62a75895375b, 0x01e0d42cb7b5cbed },
+    { 0x013467f176a3a462, 0xe693a11f223e9570, 0xcbeb4126a0dc230c, 0x165ec5675490ebd3 },
+  },
+  // g^(-j * 2^16)
+  {
+    { 0x34786d38fffffffd, 0x992c350be41914ad, 0xffffffffffffffff, 0x3fffffffffffffff },
+    { 0x16455dabaeb15b15, 0xbdd1596390bcb45e, 0xbe7b3b2b6a164e05, 0x17ccf4947f478856 },
+    { 0x5db80c23c8b793e2, 0x0ee0414e8f23e8dc, 0x00493dba0d9920fc, 0x32460ec6b78ff358 },
+    { 0xcecceec7dab551a7, 0x9c94ad51d5d80ca1, 0xade7eeaa07dc9841, 0x0028222039cf553e },
+    { 0xbead0341103e86ff, 0x94b6bae19f3132d0, 0x42c64966764060e7, 0x247879d7b6a8d6a6 },
+    { 0x0aaa024ba7de6e76, 0x7d7f69eb962d42bd, 0xcde70364b6d8ca7d, 0x1cb80e6a59c4ca43 },
+    { 0x0d6c5216c41c498a, 0x8af403b29446b236, 0xe87619916b9c9280, 0x1f18ba9ac2c806d1 },
+    { 0x0cd84eb733aa1294, 0xbdf91c1381d602b0, 0x2a2fee0d80cdd8d7, 0x230bf29ff6e63046 },
+    { 0xed9acaac3b3feafb, 0x3199ce25e6fd3e72, 0xbd99288dd8f43737, 0x0d5414922eff660d },
+    { 0xd3d4884f337a0fa7, 0x8d93a9fc5b6b52df, 0x9a2feaa8664a24b4, 0x0f5885cc922dc633 },
+    { 0x483f152e5afe2af9, 0x871a0299d2b8d390, 0x70b8a11a95987ba9, 0x01ce76be3ac22ae9 },
+    { 0x0ad1b6e5e56025da, 0xe0c6928068ab46b4, 0x709cfaf876b1828b, 0x0b1ba55f8881c308 },
+    { 0xc46d1e3cc82eaca3, 0xf102790b354c9c01, 0x1e5ed8f80c41ec80, 0x0fbe0517b8e08a54 },
+    { 0x71f22f93f8b3f71d, 0xddedd23d0a3db6b7, 0x6fba4af339fc5f9c, 0x07d635441f6973ad },
+    { 0x5f87bd64b90456d1, 0x85cde9dc5ae479a0, 0xf1438fd20f812b0f, 0x32db272c3dc9c455 },
+    { 0x8f619c2d07361d2a, 0x5efb340c7b79d98a, 0x1cbb688a3906ae68, 0x2e1d3005f3134802 },
+    { 0x4e9f8af797eb8684, 0xe192715a106841c4, 0x4e29f77e8d0c2902, 0x2f5e372ea49e457c },
+    { 0xd63a439f8d63627b, 0x6c3d6e767fe3346d, 0x7d85a5836f0586bb, 0x16321bca4ea6d5d5 },
+    { 0x3c00c6781ba8c5bc, 0x607b34e847b852f9, 0xe791c3b88aab4d66, 0x2fa632d9a6938f24 },
+    { 0x66d7fac3d60aa88c, 0x2ff668f0f7bcb46b, 0xf83dbe6a3ab64d8f, 0x2a2554908e7d1001 },
+    { 0x7f9d74466498894e, 0xd5864cd0ab715300, 0x4fde65c66084f0ec, 0x2db54438a78d6a72 },
+    { 0x546601134aba2c91, 0x4109cbde359f75c6, 0x33d0b53c32706e78, 0x157f1bda33c8851b },
+    { 0xc3caf21455cb299c, 0x63f21b4955f67d6b, 0x7d21baca8bf6804c, 0x1789d8b6845c9811 },
+    { 0x1fa2e4e1db4019c5, 0xedc4863fa85f2cc3, 0xfde0b6da04d7dac3, 0x1f63fe23470f2724 },
+    { 0x81460b01eb9a1afc, 0x0091b75e43be4679, 0x85b34579eed923d7, 0x016ac385aa3a0f1e },
+    { 0x97ac20d1fe28dad4, 0x571fee248ca82def, 0x1d1a4a4afbc5db17, 0x039d9ef1367e33e7 },
+    { 0x44e2cdbdc4cac869, 0x3ed3ce3babaa46d8, 0x2023f96c9b97a75f, 0x1699140d7056b430 },
+    { 0x227d510d1aabd60a, 0x3a6dcc918a4c0987, 0xe333752cd47635df, 0x3011c7e33effc74d },
+    { 0x868b65e5250aea9d, 0xa9e68456d6bf466b, 0xe53cf9e92b82e391, 0x1255afd93627f658 },
+    { 0xf2417137bd1cb667, 0x8583751f9e02295c, 0x30565d4c42be0b68, 0x0185ffdecece8488 },
+    { 0x4dd1be2243284d70, 0x0bbc856b6f6c60fa, 0xce4506f8bb574384, 0x2f44c7c831d43609 },
+    { 0xc60e30439b819626, 0x0df25b882793f26b, 0x4c2c96d8f6e74c31, 0x31adc216559a79d0 },
+    { 0x2e8d8b45723ff480, 0xd1b4d0449c38e955, 0x73dde41876ef358f, 0x0448616b3506a7bb },
+    { 0x2ea8babdd35308ff, 0x922cbf1aae8e4ab3, 0x2ec8c3ca06acbc2f, 0x1d0f63146276ad29 },
+    { 0xb2f3a8224381f9f8, 0x465535abc5162892, 0xbd82558d1321c39e, 0x0b31a7a10776a52a },
+    { 0x4932c933feb7e22e, 0xa13457ac7631a915, 0xf1c50f579e9f0435, 0x29d3777d26ee8962 },
+    { 0x06c8035d07825142, 0x35e2a6c48bca3f8d, 0x730290652ee4c2ee, 0x18fc9491a0d4243d },
+    { 0xe1ec04749fe2e2e6, 0x05309b7e5bb2b5d6, 0x3883cd44f84fa3d9, 0x111abd7572c09110 },
+    { 0xd5d2f31fdb30e0a5, 0xdf678d2edf509bb6, 0xff090b270b67551e, 0x37ab877a1e7613fa },
+    { 0x6519197f220671cf, 0x4f61684e9f9a80cb, 0x536111e96ebe4cd4, 0x2fecbabb146add28 },
+    { 0xef9608e28f0127b6, 0x0993019d5eef2987, 0x05461f21eca3eebb, 0x3101ff5696b4e737 },
+    { 0x13547b9d33710473, 0xcce379889ca6d9dd, 0x0806e7084864b2e1, 0x3de70fe0c43c61c3 },
+    { 0xc4b1477a8f1bcc9c, 0x6eaa01fbb6b93777, 0xa7dbeb76b0be7ae8, 0x000bcacfe8a237ca },
+    { 0xa7636c7f8a708e26, 0x1e386f81c09a00bf, 0xcc509525c479d090, 0x31bf3fbbb28a3841 },
+    { 0x06cc1854e9075670, 0x4ce5df113a88c840, 0x5f69dd580c53d105, 0x3c4282689be35250 },
+    { 0x209362f5a2516d84, 0x76893b16a6906512, 0x2081edfebe2c537b, 0x1aaf478ee4e5dd2e },
+    { 0x3ec2fa847a488a57, 0xcb434d8ea8e91cc7, 0x848a121cb4610ee2, 0x1bc433e8e9d4076c },
+    { 0xc47176809266d171, 0xd0e45e5e0e5a550f, 0xaa976de382484a3e, 0x2b0c161a657e3185 },
+    { 0x3b9f405110e8e97b, 0x009f6786496b56bd, 0x7767a1d005509eb8, 0x2d5b2848747802bd },
+    { 0x097ae0ca15cbf855, 0x266a46d3237b2dae, 0x8acad51bc539bf0b, 0x0e65021422a75fef },
+    { 0x3f0efaef2b7e7a94, 0x95e9a32003b41e1a, 0xa8fc16970050de18, 0x34778bf73644ae1d },
+    { 0x34adc56bbfb3ee55, 0x035be41bc446b0b6, 0x274bb3b938948a1a, 0x17257ef52cd00663 },
+    { 0xf224742d7e9cbd08, 0x08cdebab68684515, 0x23661214f405483b, 0x2360688f810accaf },
+    { 0x89cecef6901c4098, 0x2b23bae1070bc3ab, 0x871c04f755380d22, 0x274227af7f11b1b5 },
+    { 0x267881ee279dea1a, 0x9d4697b7883f0f7f, 0x299810c34421cdc8, 0x2b76a04d50d2d94c },
+    { 0xda3d01fab5bf4169, 0xbdfa80a36af9dd57, 0xdb4bd6dd270cf567, 0x21410dbf6461c60f },
+    { 0x3135e57f24b2cb0d, 0x789ab138d9ac4ba3, 0x3136165b751450cd, 0x3d52e102bf469de1 },
+    { 0xdd157553c511d430, 0x4a9b8879cb515310, 0x18cdf9bc0783830b, 0x11bd78819c2eff24 },
+    { 0xbfa71f3b21c83889, 0xedac5347f9ab289c, 0xb2fc8bf648d833c0, 0x1cf26d589aebf9b4 },
+    { 0xe4079a4b2eaef21b, 0x429b9ddefe84f669, 0xfb3d84f260d449d7, 0x09aa1e8a1204f804 },
+    { 0x5cb22df26f3d7515, 0x42f6e4fa8745c1e5, 0x287c5dd8566ce97f, 0x2684a2370139b7cd },
+    { 0x2fb73eaa1d18f089, 0xb6c2727c70f4effb, 0x4d3351a6d3a264e3, 0x3623f4afdfe0b577 },
+    { 0xb1d00baf70b53f2a, 0x3ede5f7150e5156d, 0x68fa04f0798fe551, 0x30682c9819c8bded },
+    { 0x4e6fd1134d6147ed, 0x926c4bedbb2b55a3, 0xe502b7c5d99ce1d0, 0x3fc78e03e125eed6 },
+    { 0x65a48ffd9908f633, 0x8be3d33c2f034ad4, 0xe8ea04f25d93cf27, 0x1218a277a2bde0a2 },
+    { 0x28ef8f950e3f47ca, 0xc3442f248e6e0007, 0xeb9bedddd071b5fc, 0x171bacf1840aa897 },
+    { 0x210f1e260f9635ce, 0x8ccd3f2cef43223d, 0xc0d90d265bd2b58f, 0x24d03aa032d8c666 },
+    { 0x50e8b77fa5b2a757, 0x2fdfcc2a834ae67c, 0xe29ea40724a6dc68, 0x2adf2a6a921b915f },
+    { 0x84c7dd6505da211e, 0x575e772d20631ddf, 0x905fed48415d4b0a, 0x11e50b6a998de30a },
+    { 0x366c2822daf5c5fe, 0xbf9762ac009d6bdf, 0x4ac892b7f2d5da17, 0x0296b6324361d57b },
+    { 0xca0c68290060eff9, 0x30c38fd23cb1aaa3, 0x406eac90f9ec0e49, 0x3da267a3ad613dd3 },
+    { 0x0c553fe98d807664, 0x6718cc6397288fe3, 0x38d73db677f3ff7c, 0x21ec5311cc6afe63 },
+    { 0xf233c26d67c2d8a8, 0x4f305f250416e4d4, 0x4d751439b72a7452, 0x35a7e3dbc8a0c5ec },
+    { 0x25cb6894e72d1f0d, 0x9819f2a581d445b8, 0xa7f125b33b3c2ad3, 0x0a83afdc91610ae4 },
+    { 0xccfde9effae4ee22, 0x3ab2930a8c09ca2c, 0x19c422c214d66b0a, 0x2f414b6fb24318ce },
+    { 0x01256b9f5b676f4d, 0xf0818ec2a78a796b, 0x7eb4f420fcb381e1, 0x31cd65232ba81a27 },
+    { 0x12a0b2b972d039e7, 0x4edd7d652d3d5edd, 0xbd23a5dce551b7b6, 0x2f1a8d770538027b },
+    { 0x7f7344807bd07590, 0x92bef3dedbcf4f47, 0x1805d754129592f8, 0x1e1c5b1f50c5aab3 },
+    { 0xa2a4359f0105edad, 0xf830650904e41b42, 0xb6fabafcaf6e0e64, 0x1dca573f437bbce1 },
+    { 0x59b19e444193c7be, 0xd91aea9e94ee36bf, 0xfd9693a25d170c8b, 0x3e5ef7cb5f3233b7 },
+    { 0xb176cd90f42d3091, 0xf42332b25ae71c2f, 0x1c117bb2314c3be4, 0x315bdbd9138291b1 },
+    { 0x7f9e8d44f8b74610, 0xac07886e7a9c98b0, 0x624919340f65e825, 0x06dff8c2e88965fe },
+    { 0xd0614cb5d0aff490, 0xd930c9329e32e3a5, 0x3bf9173aaa4c379e, 0x28753512126c0962 },
+    { 0x51538c2a21d9d19e, 0xd21a0328dedd25fc, 0xb9a17056d5829bc2, 0x37b343831b817a7a },
+    { 0x900b3ada0e230536, 0x91f80dfcbcc29ecc, 0xee174830b2c664f2, 0x39c4cb189ae1dd6f },
+    { 0xc7adfec2d103c031, 0x8c848f8877808853, 0x752b38222c65caae, 0x006fa7c76696f70c },
+    { 0x69bf678bbd7e9112, 0xcbadc6e6ef547972, 0xa0921be0a99d7329, 0x301b7f8b68bbd439 },
+    { 0x6a0454424810734d, 0x0cb567fa79e8abb3, 0xcd1e19b657dad111, 0x1d00cc6c213a6848 },
+    { 0x54b062f4c07a2950, 0x4c61761bd4932599, 0xfd4f0bb564a4ad22, 0x042ad7147dce5716 },
+    { 0xffbdd6af34131c65, 0xf9aa627b85c0a231, 0xc2bc4866f541d973, 0x0eb093f731e64151 },
+    { 0x7ad1acdf6b620e3f, 0x6448dfb8fdde7c75, 0xd0e45a4e67e44d3d, 0x0b3af5519ff46453 },
+    { 0xe9e03722c31f24c5, 0xcc469e0c5d9384c4, 0x007750739f336262, 0x006bae36811dfb2f },
+    { 0xefeb89e747c7f5ca, 0xf8eb4f73de3657af, 0xd7adb6168cb630d6, 0x29112f2cc194d1a3 },
+    { 0x5d689a9971b0cc5d, 0xd70b4ccae9e0dd0f, 0xc1b783ac3799f7a1, 0x2739ef9cbc192a69 },
+    { 0x959bd6a111866e9f, 0x009638f48d1684bd, 0xd8ef68a0f4a2190b, 0x2c377d0e31e5afbf },
+    { 0x59dfa5f5f03b1883, 0x034417d591e7eeb0, 0xbf9ffaa747288649, 0x0ab1c08500885427 },
+    { 0x5191baf535f5321a, 0xcb853047ab8fe3d5, 0x0d62d6beaae32c8c, 0x0e8a794ade3d342d },
+    { 0xc58148874e24d478, 0x15fda58157aa8b09, 0x7a01982da130b60d, 0x2b34b2ff53e47eaf },
+    { 0x291bc213d82e307b, 0x8d64347fd43cb9dd, 0x35232a2dfcb1cc89, 0x28f3a2f6893e2dcb },
+    { 0x9d6784df53db6c92, 0x105dddc995091184, 0x798603207a2de294, 0x2e64d16e1ec3d3f1 },
+    { 0x33d40a75d46b31b0, 0xa84edebb3b9a809b, 0xcec9908e8d548159, 0x1b75071b27200381 },
+    { 0xf7c4e51ad3f63d5a, 0x0fe51fbe828aa8c3, 0x097689c0fd70ebb6, 0x297ae12959c3edd8 },
+    { 0x99575ba36ba10622, 0x520c4774a4af0ae0, 0x4e1c61d45d7fac15, 0x0429642c99183fcc },
+    { 0x9a4b5c7e5703d3f2, 0x06a61d7d35a8c75a, 0xa5bf38d0cf9f9045, 0x30fc24e8f1f5d995 },
+    { 0x01dd5b08ac0d9e5e, 0x284203cacdfec948, 0xb31ca2dfeec90ad7, 0x31b2d1aba3da8a21 },
+    { 0xc813e48839de07a4, 0xf01c0cdb46cd1f38, 0x0be4e49e75ad8430, 0x098aefb285a1cbe1 },
+    { 0xb602f4fca98b8963, 0x131007c39eb29554, 0x17896389aba2d14c, 0x0fd6f4c9a38ad275 },
+    { 0xa89f2fa10609db00, 0xbbfe275d61f21a52, 0x2b68de1acdb16d6c, 0x0d63b219c8965c68 },
+    { 0x6b3dd43fa9470b4f, 0x67a2eabb23d86cb7, 0xbdb7d9d086af4fb3, 0x31b17120a190f457 },
+    { 0x168a2e0cb2885548, 0xaf79012c37f8172e, 0xd935f20155798410, 0x2b588044dbe591dc },
+    { 0x12066ceda9fac9c2, 0x72c288725ed246b1, 0xa213a46da780bdfd, 0x0153080c7c4784b7 },
+    { 0x449155896ec48552, 0xd270194ea0f5293d, 0x57cae762fa448130, 0x02713f071af366f8 },
+    { 0x14945b82811b94bb, 0x54a0c7b9b83a385e, 0xe3e2a2500bec654d, 0x178666ce0a2969b4 },
+    { 0x6f4da3a1c72bdc81, 0x81ef22f025ea0152, 0x4521b6e8a5211943, 0x350c559c6c1af9db },
+    { 0x6bef5839803758a0, 0x7a1e690faaa999a0, 0x82a49f325d6748a4, 0x120ba3f69e9d3464 },
+    { 0x9113a26e91d11b4c, 0x3035680c5fce84be, 0xd5768fe6a06619f8, 0x201d15a418d78b1d },
+    { 0xe0e2e441f5f874fc, 0x4bb4c050d2e0228d, 0xe0385427a85a8455, 0x06daf5da8dd5c524 },
+    { 0x125320cae48c6465, 0x8c21ff84a22c0ae8, 0x443f732bac5963ca, 0x01fdb32b86206078 },
+    { 0x24628a227647da24, 0x885bb7178e8e291a, 0x77006baaa6597bf3, 0x2844c50323506cb2 },
+    { 0x3184fc5d60bb9bf9, 0x9648cd44d9981358, 0xdf8a3e153d992ce1, 0x1346169d116c1133 },
+    { 0x2956ab1cf99dc00f, 0x431770c22d2bafb2, 0x36448102f8abf719, 0x2db1750cdaf0cee9 },
+    { 0x4c8a43e8180ae752, 0x48b7836693faeedd, 0xa0b1ca3bfc6e43c8, 0x028320ad1fe71bf4 },
+    { 0xbe093c18e7b855a6, 0x03645133b5194020, 0x22bfb377a4ecbf74, 0x144d8dedaf31ae6b },
+    { 0xdf3dfa2e134f6b08, 0xbadb18fc37c88f48, 0xa2541029b1b68e77, 0x1e67abb4578df441 },
+    { 0x3b800374cb755095, 0x425de5c1c3be1c79, 0x4850a86bd05d776b, 0x1d6b28b2fe2ccf72 },
+    { 0x537c66a87d65d56f, 0x95e4857a9a710df6, 0x0aa6bb4298422320, 0x07d6e95632e4e638 },
+    { 0x6672d4749cfd3a00, 0x386d945b1ec1d0cb, 0xa56516b624a208c0, 0x02b250d4be479952 },
+    { 0xd350f4231d6c93dd, 0x12b36427e8b2d0f3, 0x0d06ff92bd8822d2, 0x33af4ce005bf45f2 },
+    { 0x0cd7507eb7b55bc5, 0xa263e797e6c2c902, 0x18ace1b6ccf172f8, 0x241db4ca8027ab61 },
+    { 0x3f502d8bd60a658c, 0xdee72f391f2a8af6, 0x6347363dbdaad799, 0x0b06977a1843472b },
+    { 0x7df2b48d2ba4e3f9, 0x86734a68a73a503a, 0x967c8420baecfefd, 0x17f7623c1e40a530 },
+    { 0x1bfa56fb4aaabae8, 0xaff93163ca29073a, 0xc7b72768fe61a5bf, 0x04d6d5c44e43079e },
+    { 0x7eabc06df9e4c911, 0x1ed954e2f83a6fa7, 0x4c5d50abef4336d9, 0x1f51ffd150a7f153 },
+    { 0xcc3c13473f78b062, 0x46c6f85e812d402b, 0x5757f301ad1c5dfd, 0x32084ce077c544d3 },
+    { 0xc94f48a493f8fe0e, 0x96d6da03fbb6ae61, 0x0c9a98327b122043, 0x0728d91736275805 },
+    { 0x603b6ecb81de5cef, 0xdc1bb50cd23c9a0e, 0x2297fa371def7d35, 0x09cb9fec9ef0b8f3 },
+    { 0x2b80a1d30a9dd6a1, 0x8d382980411701d2, 0xd2468c4cb3fd087d, 0x0e167d69351a7c5c },
+    { 0x68fc847d59813715, 0x6a8e3970fda1d28b, 0x662ad7e40e6d1bc8, 0x2325b6a51f3c267a },
+    { 0xe33310f79ca44bd9, 0x552002731d4a47d2, 0x97c0b9adfaad9ca3, 0x369da36dfbe7c978 },
+    { 0x4a50a6fc4e3c8662, 0x7db86ddb9b045b0f, 0x56d94fe203e9043e, 0x1033d99e56dbd8ed },
+    { 0x7e44b8d73a786892, 0xa5d5cd16e481d533, 0xc3085ab6c91169e7, 0x20e9ef6e2af5a507 },
+    { 0x3964a14b0cb4c031, 0x4d34f2cf1ce70d3a, 0xf38f2ed424fe6770, 0x2d42692d3a518849 },
+    { 0xd21ea79600f788f2, 0x4b2aecb7caed7cb3, 0xb2bc6f7c99beccfe, 0x0cd1e1d78aefc17d },
+    { 0x26fe0fe86209cea0, 0xbd5174c4783ec98e, 0x852ec447c38126f8, 0x34d7163b6c92d8aa },
+    { 0x40a2e6215c3ad9af, 0xdeff3358c1619a5e, 0xbd4c539dfc81a9e4, 0x1690484391b881f6 },
+    { 0x93786d0945d6f1e8, 0xdca475eb5c1015f2, 0xac0b3137e50f8654, 0x2600a50dc11d39fe },
+    { 0x8b820efaff2ba76c, 0x2c5b92011b557d36, 0x91744383d38f9890, 0x2e32d4e725f653e4 },
+    { 0x5df53088dcbdff5d, 0x96af975a50ee84ec, 0x3e35922beaf5d63e, 0x321cb9f56d99afb6 },
+    { 0xc9e50b56335d565c, 0x074fcbe5096a2b30, 0xecd8386297119c02, 0x189c588fea94f270 },
+    { 0xe301f2b9baf76cdf, 0xfce5e803ba852389, 0xe6d7cfa2d92e1522, 0x13e773e1789d3333 },
+    { 0x6d39f465b033a52e, 0x3f758d9dc6d53f72, 0x8c388dd62614530d, 0x060ee44fe0835ef1 },
+    { 0xfd4310499fcbedc1, 0x7d53dc190a790ec1, 0x4ae7b9a65a618bb9, 0x1a282a83f53f3f7b },
+    { 0x7f1bec4c0db107fb, 0x2775e9b0addc0c21, 0x4dcae35c0300b7ef, 0x098edc68987927cb },
+    { 0xdcbd90621cf1469c, 0x9dcb672f7a9e17b0, 0x1935ca2aca0332e4, 0x3a7084a709bd5fce },
+    { 0x57702dea046ece58, 0x67fc35ff8f6ec89f, 0xe9f7a55df3d72942, 0x2ac147a8b535cd20 },
+    { 0xf0fbe984e6275bdd, 0x2d8c87297981505a, 0x7c6a521771f4fa9e, 0x1d07fff53b61e791 },
+    { 0xbe966050647b09f0, 0x6bb488072d1bd3fa, 0x1331783459fa0963, 0x114046fc9eeca544 },
+    { 0x8a7e379f0b5fa8b4, 0x70e6b0e9a11613f1, 0xcac684d57ced4777, 0x3b2e462a4e1c10e5 },
+    { 0x54fec22d7e688c65, 0xbf76eb5bb8d63bf7, 0xe71743839a99c054, 0x30ee499d2c820066 },
+    { 0xa4b0f12ea958d60b, 0x6ba0792b96e0acb8, 0xf4736e003babb07e, 0x1b3857157eeeccdf },
+    { 0x7459d1c946c5c2c2, 0xf79e22e0a29d0077, 0x2aa1798f3fe85096, 0x329edbd1f702db95 },
+    { 0x907fe2f57dc59050, 0x40f40997c285aa1e, 0xbcb7ef86c9fdee5c, 0x063726b54d30c4c1 },
+    { 0x2b0dba58d79db0d0, 0x2ebc2b9e7b908dbe, 0xbde9162b7dafccb8, 0x1895486f6172da3d },
+    { 0xe350f07da3e273b3, 0xe30cda43013b3c2a, 0x2b39f9bc273709c4, 0x16b0cd8fd4b68fcd },
+    { 0x729c8af4a046ea4a, 0xcc0efbe96d009c66, 0xcf2ad68ae06bca54, 0x3ec11a462b2c32b7 },
+    { 0x0ff1ec7768acc9ef, 0x9c1f89b24c5cfde1, 0x86dab631a85505dc, 0x0b5de632960590ff },
+    { 0x2e3e009be74084fb, 0x9c1bec81028a7d77, 0xfc3f2c9dce8e239a, 0x386387cde4f9ff7c },
+    { 0x8ed5c19a6573d90e, 0x73cd560a34ead1a2, 0x89b5eceb48a32a94, 0x13548b95cc934d25 },
+    { 0x88722e0837ff1ddf, 0xc7d68d31497933bc, 0xaeddb8d0d1e0e48e, 0x3ec45de660e4ea65 },
+    { 0xfe3817b9c984dcbc, 0x9c6927507a64ffd9, 0xb5647579cc4599bb, 0x3530e43cc74933c9 },
+    { 0x18219b91a9a19db7, 0x83f84db029240366, 0x838090daeababb07, 0x1573cd891a00656f },
+    { 0xc50f2ef90f54caae, 0xe69cd8e3f6271693, 0x5edb366c0aa51e50, 0x05ac068007099ee6 },
+    { 0x3e9bfd76b2de91a9, 0x26e31af6ddd5a8f8, 0x8cab68f10cd1dc61, 0x0058d7f36b1b4ce1 },
+    { 0x95a009a708442ca6, 0x87fd620026266b7f, 0x78574d3e560692c2, 0x23d37c4f4ef7ae7a },
+    { 0xeb108d7749c2073f, 0x5f8c364e5df721b0, 0x330b5fcb1662c773, 0x0a81384ea24346aa },
+    { 0xc487b89c76ddc4f5, 0xa73adc3e7bacea41, 0x962e171baa04baea, 0x0ebddc11b1eacca5 },
+    { 0x43f37d722720b311, 0x8dd00b8d8832d9e2, 0x969b703934d6ba66, 0x21180adc47321c35 },
+    { 0x2aa3f001a76f29a4, 0x718b035e96ae28c6, 0x58c45a9dce108f46, 0x163f2b0b40fbcef4 },
+    { 0x72be9c5138f11917, 0x39b7a24af113a7a2, 0x5b7a0a9c3348e70b, 0x2e9f267f5328dc4a },
+    { 0xe1240ac0abae9f73, 0x8b92a1def51c9797, 0x60e9dcbbac66d897, 0x06038b23befdf743 },
+    { 0x81f3f4bd83053ff1, 0xaec8415f2e00008b, 0x1a01e1b64daff163, 0x2bed6f27a269379b },
+    { 0x1c901151cf41ef66, 0x7a6f9ee8b1e41d22, 0xcc833ed212fb6f00, 0x39e9c40d9d0e895b },
+    { 0x1e032c346ba26ec0, 0x64ab8db9d3482c11, 0xce0ed7588b228a7d, 0x2e14238ea7e1e308 },
+    { 0xbe940f378a8806c8, 0x90c287e0ec759aad, 0x5c0594402a0d3a83, 0x063a5f12d98641d2 },
+    { 0x499bebe70eedafb8, 0x751b09617286987f, 0xce3f2b42b08b301a, 0x1f2a5ebeea10dbac },
+    { 0x927bb525aee19138, 0x6bf0805513e852ac, 0xd055c9f67a13f1d5, 0x0967f3f68b6269fc },
+    { 0xf45735aafc3355a7, 0x4bc4eb7bd9609e09, 0x424f5b493df35634, 0x2802247f49d90443 },
+    { 0xdea250b55c677fc1, 0x3e4b19373ea97f14, 0x5634025e71c0e651, 0x0be583cf68657982 },
+    { 0x3efa90a0623428c5, 0x5fc4e0f19a89f05a, 0x3261b16160833db3, 0x2d52ef6790caf9e5 },
+    { 0xd0cb8b34d9e4ef28, 0xef1a940812309f80, 0x4f97d726dc9b8c09, 0x2b6e83948a660fb9 },
+    { 0xc5a0bdbb5230f5ae, 0xf217904e188b1cf0, 0xb0c1a7e12c9a7c54, 0x0ba55560ff2b4993 },
+    { 0x052830b29d8aa445, 0x2d535fedc627ad54, 0xd37503330a44070a, 0x153190f4233e8839 },
+    { 0xe8d8c7738a7ac81d, 0x0a93e47c7fc75e11, 0x44b36ada9d7d223c, 0x09f417eb431aa237 },
+    { 0xa3ca538d9094b251, 0x46f08e5e8a0d2c09, 0xc735fd6f83ddc4e7, 0x18170c329f62063a },
+    { 0x6b7d22454fb7214c, 0x67587205d7d7a575, 0x80157dec45f46581, 0x3ccfbd07b7a0ff57 },
+    { 0x1e8d11841db6fee9, 0xff6c42c7e6a69297, 0x0e5293da1938455e, 0x33340076864964e2 },
+    { 0x1fb2141f79c5bed7, 0x3ce07f32269e076b, 0xa5db6b52d67fd1a5, 0x13cc2c2f8bcf4c6e },
+    { 0xacd17b4113622450, 0x9c4a048e829a7b2a, 0x96f51f764ba0d0c9, 0x17dcae1dc569f514 },
+    { 0x168c8cb01fd0260f, 0x396fcdfbb8bd3c37, 0xcbbadb2898f3b53e, 0x0e389173a103c388 },
+    { 0x477580b17b775ead, 0x10c02c390187830e, 0x874970ab5a995966, 0x392b8ae93cfdaefc },
+    { 0x4eaf20cb854f7122, 0x1bb4dd0286a88012, 0x92b8079cb94bdba2, 0x269dfc3099ed62b5 },
+    { 0xf04a8e6d0f502448, 0x122577e79c9eff5e, 0xdcd733992bbb06bf, 0x07d3879ed0e727b1 },
+    { 0xf302fb2af240b124, 0x05acb977b994a811, 0x319ca3fb026c638a, 0x0061c4b15ddfe784 },
+    { 0x5869aeace39a1df9, 0x64e5c86cd6d0b4af, 0x3427a11e40e42cef, 0x38fcfd6c4cae791b },
+    { 0x3b352f26c614e29b, 0x6e7b714d58e5fb6d, 0x095b2c1f2a059798, 0x010b186e9a2bfc90 },
+    { 0xce942f6db427489a, 0xc87673c598424fde, 0x0d5aa5a082e7fb37, 0x2a09aebdd1930fb4 },
+    { 0x32657516043f45e0, 0x4006f29fee77e428, 0x8033c929c7fae6d4, 0x28dd1d625e4d16ea },
+    { 0x38ff212a74aac49e, 0x92ba6949de6a06e5, 0x96d08be83e2557bb, 0x0e6cccdcd0e4afdc },
+    { 0xa9f77c485464f9cf, 0xd58e9dffa1c9e962, 0x2ad11698b4a645e1, 0x05d2d492546d1c57 },
+    { 0x3aa381859f350a51, 0x750dba5f2c295ad3, 0x4a7d43a277a7c43d, 0x32bd5f2fcefca309 },
+    { 0xaf1472a7d4b83662, 0x1e0113c7a4e6a6d4, 0xf34b8424b72fc1e3, 0x0ad5c0ec251505da },
+    { 0x33482b5e09388a17, 0x1b339aca859a2a33, 0x987e75f47eb3c071, 0x03f625fbccc6a147 },
+    { 0xf4749253735d8d74, 0xa5e38bccfea5f5bd, 0xbde030216c4316ec, 0x36ffd53abeb17c14 },
+    { 0x733ddae585702efd, 0xfef10d8d54e1ebdf, 0xbd7cf337dbc4108c, 0x3c41a8112aec7ea0 },
+    { 0xa0b69d23ed6a3a55, 0x08a8d06ba0f535de, 0x2d486cffd3efe072, 0x1e00aba38e4e36d3 },
+    { 0x34bbacf688189a05, 0xd14e73349c70287d, 0x7ffa6de0f36ff721, 0x22528de8c498fdd9 },
+    { 0x3b7efdb92be5cf67, 0xe68995059fdd020a, 0x6c96cc4451316d37, 0x0fb82601920fb679 },
+    { 0xd53d17ab5f0401be, 0xdc4cc9f792cbb654, 0xb31262b04ee50e4a, 0x0a1f6cff0d7b266d },
+    { 0x4e1c0d3d8e36de9d, 0xffc8136f954ea0f0, 0x9810d2df1254317a, 0x28906006076a3574 },
+    { 0xf8f02394b84cdae8, 0xa215e3d2d9b6a13a, 0x78dfce88d2807068, 0x2b7a09e0ab127d3c },
+    { 0x1ec6e03d324d248f, 0xda0b2948488fc912, 0x4585d9718f080727, 0x24e860287129cc5f },
+    { 0x859d2d2c75a80d9d, 0x92b53aec94d64c2a, 0xc10aeb559e00dbdb, 0x124f2d64f4a223f3 },
+    { 0xe867c4dbe677c170, 0x19bde0fbebf5256b, 0x8ffc72c751431639, 0x0b99d3e4bcd697c9 },
+    { 0x13c0db4c91a044ba, 0x078b8a890bbea236, 0x7630f615963911eb, 0x12f3b7c032d13163 },
+    { 0x510ac2a394814913, 0xeeb814329a6a2b5a, 0x9f9db71c12b9f83f, 0x14c8f8b365576e48 },
+    { 0xff7ef7faaa6a166b, 0x5b98d4650d648c25, 0xcdbfb5aa9296b301, 0x268905e5bf703b3a },
+    { 0x2aaee3b5faba8641, 0x22ea4bae41eb6d91, 0xc386f89ba0576481, 0x3e5eb63d539189e9 },
+    { 0xcf8c1eeab5752831, 0x8126c27cd690b9b9, 0xc51b0ce2f7b9f57e, 0x2e4634a3bc868377 },
+    { 0x47b6d53f29cd2ce9, 0x5773980b302aa88c, 0x03b88503186e1c6c, 0x38ed77c5753270f5 },
+    { 0xfc0a19b9d5c99da9, 0x9d29499f033d8e03, 0xda50d4b2219fe9a3, 0x10a950fd08b43b6b },
+    { 0x9524664766ae2f12, 0x406244e3c26ec2d1, 0x8a60941e0777e1eb, 0x33c24690ebae0ab3 },
+    { 0x555eede21df5f63b, 0xda9e2ced779b2b81, 0x349b487dfe041ebc, 0x24781d33aa03fc0e },
+    { 0x76c5ed571697dea6, 0xeec6264682aaca17, 0x41532b0c48e22ca0, 0x2def22d0812abaa6 },
+    { 0xa5484ed21da8dec2, 0x6cb66c9ab6ba75fa, 0x892799c32bcf58c5, 0x040fb4653e4c18d5 },
+    { 0xb0c6b53be7ffa7cd, 0xdedbff861d53af81, 0x04edd2ed05609dde, 0x30c311853e7859d0 },
+    { 0x83d4e75beac4eb84, 0xb2e3ee919ffe9176, 0xb804bf4d9ccf2af3, 0x3835f8f8c015db81 },
+    { 0x9df9fe67c813469f, 0x4159bee1399990df, 0x3abfcbddc887d0bc, 0x259eeb9a73cafc7e },
+    { 0x044fee1425c5abe4, 0xbec4b23d9213dfeb, 0x7059ceb89a438bfb, 0x178e13bf2878840b },
+    { 0x107cdf5a9811192a, 0xcc1cca83591d372f, 0xbe42ed08eef40fc7, 0x05adce5c56b2b002 },
+    { 0xb90c43b6aed5528b, 0xa3c18182087588f4, 0x4f2ca0484de9b9b7, 0x207aeba6c49441a3 },
+    { 0x8e564268b170ed40, 0x5da1e3ca07c4b725, 0xb53f1a005258de4a, 0x0d468d7a4d5ecce0 },
+    { 0x02ee284aa1a8ab02, 0xca0fb1b53258a76a, 0xdb775081a8fef2b9, 0x229ed8dc053a6340 },
+    { 0xb7402a30e16bd01e, 0xef5702ab82cf26be, 0xd8cd39d8e48e2bee, 0x24df72a8df192fca },
+    { 0x1ad812cbc45c89c5, 0x1d2f14dab419ef03, 0x82728ba077be588e, 0x2a4979935a41843d },
+    { 0xd3c213e233f7c37c, 0x68826b105299246a, 0xe6a40b77b73a8194, 0x0166b36931c13b62 },
+    { 0xcd6e6764852c077c, 0xe2974ae1a9331f98, 0x83c6a633d15d95a7, 0x2611085ad2258807 },
+    { 0x40dca2ae928c320e, 0xf146eb8677bd7cf2, 0xc68901ad27f5a325, 0x0c38a19d32e8b293 },
+    { 0x82e212783bbeeb94, 0x39a030bd965d2c66, 0x9225c8847e8df27b, 0x0448be1c71243d61 },
+    { 0xa6a63daa39cd43b3, 0x798aaff4f42691e3, 0xab63e475c72762ad, 0x028389f18c2d1046 },
+    { 0x1a0b839bbb811476, 0x39c6326fd03ca25b, 0x87dd476b33a8ff14, 0x2f44cc09099bd3d1 },
+    { 0x722f239642374b8a, 0x0092a7478f7cff4b, 0x32844d2207a1686e, 0x1d05da84f7a9aeb4 },
+    { 0x6375ff75ded8e1f4, 0x19a424043337bf8f, 0x06040341133802d6, 0x3dad70b70f00d85a },
+    { 0x8b762d0d1e9332c8, 0x37efecd671c866fa, 0x8fbd5a842a61e83e, 0x299a59635be14c79 },
+    { 0xfdae7fb22432488e, 0x2c587668d7640275, 0xf52f3f73d9b5cd36, 0x32edf6f49030d245 },
+    { 0x501741019db3a03c, 0x388031d5b7afc441, 0x49bad278927307da, 0x1166f5b64e1484eb },
+    { 0xbea9cd705a8bd0d3, 0xf41eac9369e389fd, 0x066875334bd1e9e9, 0x2b1dcc18874f7f28 },
+  },
+  // g^(-j * 2^24)
+  {
+    { 0x34786d38fffffffd, 0x992c350be41914ad, 0xffffffffffffffff, 0x3fffffffffffffff },
+    { 0x3f4b89667f4200a0, 0x99fe6ed9ac8c9a8b, 0xfabcff5a5a833bdc, 0x2b90f10730dea533 },
+    { 0x5ce10b11994471db, 0x27cfdb4356c5a334, 0x653e9ee6655ec9ca, 0x270994be59ee1688 },
+    { 0x18f10e20291c5308, 0x4a6d3f5b502943ab, 0x2276dd3ec67f9891, 0x3d9be9ab3dd536b9 },
+    { 0xb45bc2aaba470234, 0x088caab990e6fcd7, 0x3d875ad5f8e62078, 0x334afd132487ec24 },
+    { 0x470a0ed37e9114ae, 0x0c3e81aabccff03d, 0xcd1987c476c7767d, 0x1ea92ffa85468fe0 },
+    { 0x91fde2f7df658065, 0x2afccecd85317bf4, 0x796fe5906f112187, 0x19b3abc5803346e9 },
+    { 0x08571a6129221b0e, 0x7228d981c375bb6d, 0xdf6a1dd7b95f9ae0, 0x1a0ca8592b65bf06 },
+    { 0xed015766aff08680, 0x2b8b67f06ff5e5ec, 0xfc1988e68a9f75e0, 0x3cf52321d4f161d3 },
+    { 0x82757b6f12eb4828, 0x816a545a5feeae83, 0x42225bd91dfec68f, 0x28de7026b18681e6 },
+    { 0xd2ac97a2815ddc9b, 0xa736f425a1d31759, 0x5ac9e2129efacede, 0x2a4e25fc31815723 },
+    { 0x52fdbc0963610dcc, 0x9ce3cbcc12e643f1, 0x38bd2a7d1a78296d, 0x3a3a04a01f4344ed },
+    { 0x2edda87a8c417156, 0x8995ef4db87e01b8, 0x2023cfeec0f4476d, 0x16384c253982f2f8 },
+    { 0x3789233c6ae99ace, 0x7fd91beafc9af27e, 0x220884b285ab2efc, 0x0bc068d33336982a },
+    { 0xa99bada560a9c489, 0xc7290faa4212f5b4, 0xe6614a2cd9f3bd13, 0x00ffaf7099dcd6af },
+    { 0x35540a8f807ce222, 0x81b0de7052b07eaf, 0xfc74c04f5057723f, 0x26573a0f14273e81 },
+    { 0x9f91fe66f2205343, 0xfeca29bcce5ad423, 0x1a2dc566c531877d, 0x14cc054cda06fd17 },
+    { 0x9da1b2f02cbadf75, 0xb5b3ed61f1560694, 0xcae47e42d79c40d3, 0x12598e1e887158ec },
+    { 0x2c66ac16ae70110e, 0xa5eda03081973328, 0x57fb04055061ac47, 0x3b2f8fc22f7063f5 },
+    { 0x093f0d6c558a093a, 0x13e5da07cb66e926, 0x28c31786c1f815af, 0x05c61781cce65b8c },
+    { 0xf360f3eddb77f541, 0xbd18c563de2357b6, 0xe5acfc51f5872ff3, 0x00fe0599f4f8fca0 },
+    { 0xac7a68cc0da52fcb, 0x6e2036eefeadbf43, 0x98ef817899035ea0, 0x396a983613e7c3bf },
+    { 0x5fbdbc2a65ea2317, 0x2f2e1750359781fb, 0xa3b3516ccc0d400f, 0x0ffa852ef810fabe },
+    { 0xb111c4a0f86a8238, 0xb2dee1c0cf5a02e8, 0x65f59198645bbd94, 0x09c63c3ff882649b },
+    { 0x59a4835107913f56, 0xd49f1f79a5784eb9, 0x0a608357d6b4f355, 0x1667845d9fd4ed90 },
+    { 0x1dc223f64e2d9057, 0x95ec2cc0ff7f6846, 0x982280261bfb70b1, 0x058a13ee151c220b },
+    { 0x741159aab8983ec2, 0x3b9ef5cfeba12f92, 0x52b2abcd4880fc74, 0x2a9401762fb529b2 },
+    { 0xd0230479ccd0f017, 0xba252eb3d34e96f0, 0x9f2b0c5c1351bb35, 0x2e07c0a1682f44f6 },
+    { 0xf6b2fbf1682e3626, 0x06a20dd82b66a7fb, 0xbcde76fbf83f1eef, 0x3faaf580ec1abe2c },
+    { 0xcf1bd5180eb6c09c, 0xb579bd5ea8526e03, 0x2ab7dac85ad26367, 0x17eb2e97f565f843 },
+    { 0xc2b08580765354e2, 0x60044e226bef2fc1, 0x1e6fabb6e31bbeb7, 0x07fc1d14bc09f095 },
+    { 0x79848b3f39dc24c9, 0xb9ff13f4465eb6c2, 0xfff048b4b2393610, 0x24fbd5025bdcb466 },
+    { 0xe633f8bb035949c8, 0x218023c7703f86af, 0x792cf89e6c9e7197, 0x20c7f44ddf560f7b },
+    { 0x0ae4a1e379037e82, 0xb22af2b8a8bb1c93, 0xa26b4e68c7a977b4, 0x26b58bd08045f402 },
+    { 0x9826eb9c13a21203, 0x8cdc5ea06ee1d4ac, 0x9a2b7dbbf5faf595, 0x2b215aa2e8899277 },
+    { 0x2e4fdded67dad1c2, 0xbf75f3d274235bca, 0x9966609d1f7ef5f1, 0x2541d7cca45bc62a },
+    { 0xcc43f1f8e8878f1c, 0xd9daf4ed75e858ac, 0x883af7c742580344, 0x165a53e0033a3398 },
+    { 0x2b21c076a961e752, 0xe84f46cf587d5e11, 0xfe6a78e7b50bcf88, 0x0841f96dff67e0fe },
+    { 0x7b20099dec3a86ce, 0xa82408a763641648, 0x882de935a8a58ef1, 0x29dd360fec2ac861 },
+    { 0x94cba12d6e13dd66, 0xdd2cdc2103cbe119, 0xd2f5dea12130feb5, 0x39667642798d0b49 },
+    { 0xd42d8b665f2e34a0, 0x0682d973e9b2ab4c, 0xa7e3932fbe770bd4, 0x03e446e101856195 },
+    { 0xda30185db7438d7d, 0x60a92726fbeb187c, 0x1dc351e9e3da0a0b, 0x378e8c30ad47e768 },
+    { 0xd61b5414d37c60bf, 0xc3721868631aff64, 0x0570b4faf5028e78, 0x0bc90acfb39d3d6b },
+    { 0xce9c1fb8829d1ee2, 0x22cae41b328462af, 0x3df93caf254e4af0, 0x06903cb5f0a4de3a },
+    { 0xc36798adfb60f45a, 0xd1e318632ec722dc, 0x192b0904079cc89a, 0x2b0fcf848f478aa0 },
+    { 0x369f417a37d50c7e, 0x28454db8772a1d80, 0xbe57604489f80d7b, 0x2631cb942f44ef8b },
+    { 0x69c9a223b20bc7b4, 0x6164c3cb2b807561, 0xd12a3884d8234250, 0x01b8cce784d66ef6 },
+    { 0x9dda57209f153728, 0xd1c49f7235b196f3, 0xc555fa90404c6480, 0x0357151c93ec6eab },
+    { 0x506f821410e8d121, 0x359b533e41aa6ab7, 0xc74ab09763bc091e, 0x11a0edd8ebf763f4 },
+    { 0xd18cfa354d2c3f5f, 0x27a18bacba24b335, 0xb56af58b4549c264, 0x2e72f2771b745652 },
+    { 0xd878e9485c687454, 0x1b73c1ba2637c15c, 0x1daa9343c61cc897, 0x174700795e2bbef8 },
+    { 0x6976058d5da82588, 0xaf3e4b0c35b4da7f, 0x5e6540319d9128d2, 0x195e61ceef6dfcac },
+    { 0x5120fcd05a363344, 0xe73dd4221f571ded, 0xdb68fe0421c07876, 0x2e650d525982bc76 },
+    { 0xc411111e5ddec77a, 0xf7d03628b494564a, 0xe8211ef57bc5bc27, 0x3b87d6e857b9a100 },
+    { 0xaab6712e6b004807, 0x9aa63440abec0950, 0x5842def1e14cfbd5, 0x350ed3bfbbfd75c1 },
+    { 0x449714a8e2fde1f9, 0xf377eb17120aa236, 0x9c1ecfd058fb967d, 0x2797ee3cebf1ee6d },
+    { 0x867854e5a0fe4964, 0x1c6f10b2dc848e10, 0xf705dffa5db86f0e, 0x09b618547283621e },
+    { 0xe83d0fd87d73fd6f, 0xbd0ec646bf3f0e14, 0x11cb9b8b774c41f0, 0x383893514317a005 },
+    { 0xff80637de34052f4, 0xc246f2cf5b9871ed, 0x722799f87ff1440a, 0x1de7bf2a6a556657 },
+    { 0x1c9dc21945a900d5, 0xd4a73ad4badd2362, 0x68a174e2f6b3eade, 0x208a244dc773873e },
+    { 0xa7cbbce8c29ea06b, 0x771855c429c5250f, 0xc5454372c14393dc, 0x2e0979ec73156494 },
+    { 0x80f7d13976058b9d, 0x4442bcc6922b80da, 0x7ac3eae6a261b67b, 0x04751111cb131d65 },
+    { 0xeadeb92ad84b5bf3, 0x80fec34cfb06362e, 0x480485c40993d370, 0x117f82a639b0ea04 },
+    { 0x96b12caf46e32d55, 0xe829453f1e792cc8, 0x856fb048ccde3797, 0x142295559d70946d },
+    { 0xaf57498aeb21417f, 0xad111b9857b84020, 0xb33940ace578f046, 0x21a8a87d7d902ba3 },
+    { 0xaadc8fd726ca0b45, 0x66a2f077600acb6e, 0x8395fa207328adcf, 0x2c010533e408e8a6 },
+    { 0x232fcf34b4d12d8b, 0xef7d2dccb25a26ac, 0x08e5f827552662f2, 0x3c5b954c6aad4a46 },
+    { 0xb2507f08c9a1f5c0, 0x4e40832d9e90c4b0, 0xce62f3d2fb7f418b, 0x3cbbb10a66e33ae3 },
+    { 0x63543181417b4365, 0x536dd991ad3cdebd, 0x1756258e91972387, 0x2a19584cc3db3710 },
+    { 0xd6c97e430bbc6fe6, 0x3d5fea8c34c4ab80, 0x6e5e8d44e7ec42fe, 0x3ff19e350a1757c9 },
+    { 0x2fe1b80894e433f8, 0xe778353a70e9e8ee, 0xd26b3ed9acbe085c, 0x03e6c980b256ea1f },
+    { 0x78c9d00619fa3804, 0xced4b65a3aa48975, 0x4046c319737301f6, 0x1206d137ea73b9ed },
+    { 0x78eab1be90f7f5a0, 0xedff969ecfe67eaf, 0x67095479016b996e, 0x3760122eb8bf2929 },
+    { 0x6521fb1e181baa7c, 0x06c452062dba4b39, 0xbde4c4522cd35921, 0x39fca520dc61fc69 },
+    { 0xfeb618ee9a449080, 0x4733e5b33a201f6b, 0x0a0ed65a5d43c78e, 0x011845ae8146399a },
+    { 0x72285313324b68d9, 0xbfad3e6ee8a95e23, 0xcff5b7b4a739e877, 0x195d4d21b9626ebe },
+    { 0xfc61fff63dd8dbbc, 0x1ba6dd6dcad5f496, 0x7b879cd83510220e, 0x3aa0b0e35430866c },
+    { 0x89c56d5e88ec9dc4, 0x69e891563fa6cb03, 0x8679bd9e5c743acf, 0x25063eefa5bf245e },
+    { 0xbde90966d6fa2d16, 0x096fd2aadad20d2f, 0x7a47d26771e83ac0, 0x1bf5e226af7f6374 },
+    { 0x27474a29f5766af7, 0xc84ca2827beb6c42, 0x9195135a7fb8aa84, 0x015432c77605d54d },
+    { 0x4bd4ea62256527f1, 0x996a49e10e2ca0c0, 0x95ad8d79b51f187f, 0x1e75bae856a7f0aa },
+    { 0xcba3b9e6b69a6838, 0x3f306312a15b1fec, 0x34e25f0d5db8a7de, 0x1c076806093a9039 },
+    { 0x0e39431641b66fcc, 0xf3a684f40a4d82d8, 0x5b0047150f164c9d, 0x098febb2543894bb },
+    { 0xe468758151d5c459, 0xdababbe79c9eaa2b, 0xaeb1daae65d54c9a, 0x19f5af5b49abe334 },
+    { 0x061afc359070180f, 0x2f36b0f8f605312b, 0xe5f8bbeb9300397f, 0x175feeafd5c774c6 },
+    { 0x716cdc8082b361f2, 0x8ec51bbd8aa0ab90, 0x2b1e662c39ac81ae, 0x309dbd15844f3521 },
+    { 0xdf948a96ae650272, 0x0bc1e7cae8dbdda9, 0x2e1ceed663b631e7, 0x03c92b2d307d6130 },
+    { 0xcb45321084d21c4b, 0xb0f6c7ec04957227, 0x4e5a2d2f824d8a6a, 0x098114aa49aa252d },
+    { 0x2a384076680ee644, 0x82562a7a7ac3bec0, 0x2cfca6700b8e544e, 0x10fc11d22202de06 },
+    { 0x2639f4446e1c698d, 0x9480b6c520e91c1d, 0x97170d03aa46e5b4, 0x04d0432b8a31374e },
+    { 0x000388d066cbce27, 0x410be24003e7a840, 0x85e5d2dfcf61bf38, 0x18fcab45cdd79f5f },
+    { 0x3dc855d7c01b6238, 0x7d9430d846848b37, 0x3a350da45c9de4e0, 0x3ec247fa603ee4c6 },
+    { 0x52123dd033d63808, 0x975423cf65fa3be5, 0x15fd40cdef61885f, 0x0142c1a582c9b895 },
+    { 0x98084866a6074816, 0x83e678eb98392e8e, 0xde7fc88b597d8f58, 0x011680e19ea039ca },
+    { 0x66fef68b6a13fded, 0x6f55fa9051d67228, 0xe5906c722b779f79, 0x3b7a2ce265e04d4a },
+    { 0x6ba435dce9be9ee0, 0x741b80917fc0315a, 0xbc95207ba813bf97, 0x21ac70b744d172cc },
+    { 0x2badb8769bc8bc8d, 0x721b2b19962451e5, 0xed122670c857ec3a, 0x087e51b5d5b60f18 },
+    { 0x9ef64d5baf183970, 0x2e00b75551374f4e, 0xd126bd64a4f2cc2c, 0x3475143766648b02 },
+    { 0xad1dd62c04770c5f, 0x69224bf379521405, 0xe067b55d489486e4, 0x34dcec05cd4c1d7d },
+    { 0x636a37c18e5a1d60, 0xa0b211836be72f2b, 0x6559feddc1ae436a, 0x110009784394bd96 },
+    { 0x0e299145bd2afc98, 0xd4485056d86686e6, 0xd31f4577aeffbad2, 0x2257c3cc150a1c65 },
+    { 0xe6b29a73453749cb, 0x5bb1bedb5319ee21, 0x1be94b348d769cc7, 0x21c3613fff02866f },
+    { 0xddf74c097f74faf5, 0xead9e254cfbf0227, 0x333d60371e263f67, 0x3f52bf4cc60ad400 },
+    { 0x864cafd3ca004119, 0x4e9696e811c32573, 0x9555836e0dd62023, 0x187646a39c7873df },
+    { 0x0e392e2cff36eee3, 0x3661a9bdb17d777a, 0x806c7a6239698613, 0x0961b39ee3d536ee },
+    { 0x9da7d28f79527192, 0x5975ea1b7d19bb1e, 0xaacd263d5d9c5c2e, 0x2d0ba6822ce0918c },
+    { 0x4159cec258a6688a, 0x41354feb7b38a9f5, 0xd2f9bcf20a3e2076, 0x28769cbb69c758bf },
+    { 0x4f020725fb285b19, 0x46ce503d27861669, 0x36a41e3b017c7649, 0x2369bbdbcdde2b8a },
+    { 0x3c40cf3df909a524, 0x466ef4bec56d5769, 0x5117e9515d5671cc, 0x0f4e82203c1b0238 },
+    { 0xd5b9324c37c7f130, 0x833bb085b5753126, 0x7ad778e2a86038aa, 0x209a96e98915e0de },
+    { 0xe355fcad5c583b80, 0x94169095585ebbb6, 0x8872dfe56fe2258a, 0x1839947b9c482a97 },
+    { 0xe1ac6b001537ea6c, 0xec665df9b8128b43, 0xfe0c2ddd83056981, 0x3fa8420b9ee06adc },
+    { 0x0790536599e10f7a, 0x907c87bc71752ed7, 0xc4522a1fc3a2af35, 0x2c435f830802d475 },
+    { 0xbc48acacb1c9f794, 0xff552a221a1344ad, 0xdb9be045178b55e8, 0x28f841a2aa5fb96c },
+    { 0x202e075dbc14011a, 0x88379388a808bb1b, 0xaf8d181ab68ba735, 0x1a300286e3b68d88 },
+    { 0x9f8ac7b20ba7b28c, 0x2694a045b6fa0cfa, 0x05bbfb25954f7be4, 0x055a8848de0e5531 },
+    { 0x3d6ad96deac82367, 0x7b067bc21696b97f, 0xb4a740bf2c1c532f, 0x28e4f627eafae099 },
+    { 0x58a99f22adf15f91, 0x35185a03dfddd43b, 0xdaefab59c7934ed7, 0x020d57305e5ad6b7 },
+    { 0x5fbc94069346bfb3, 0x04086dbf193cc3a5, 0x77175720e5cdeaec, 0x118bb3df6a106a37 },
+    { 0x473dc83bcfec1e73, 0x88f6c5e5951e3791, 0x95af330483bdb267, 0x2af79f93a7a2687d },
+    { 0x07672dd5bc9b993f, 0x809030a67122c717, 0x4d2f790e6cbcc14c, 0x00ef85c1f665624a },
+    { 0x0ce88a5acf3022a2, 0x6b00c33af660ffc4, 0x15dfd963c59ef088, 0x1b0fdf3460b7cb78 },
+    { 0x0e3bdb6eba07d287, 0x4d4f19d105e261b4, 0xf6ec42d5cb779e2d, 0x1f484801725afcad },
+    { 0xb777f4580a7b0e3b, 0xa2fe36930c80e44f, 0x31e6374bdb8a3dda, 0x05de3689fd2d93c3 },
+    { 0x35a0e01101e17de4, 0x71b085a24aba4bde, 0x82067f001e98e920, 0x2fe73aca64b133ec },
+    { 0x13da60ec848a8aa0, 0x30e271988fd0404f, 0x65e948518cdabced, 0x189d6d3880c61132 },
+    { 0xd0723fea38d0e902, 0xf75155a9d88bfb4a, 0x3e52d70f985aca24, 0x185ba658b84055ca },
+    { 0x851755dc4d6e5204, 0x004c4e558d6dbfb6, 0x6865182a55a017d8, 0x2597a06022d48281 },
+    { 0x64b4c3b400000004, 0x891a63f02533e46e, 0x0000000000000000, 0x0000000000000000 },
+    { 0x59e1a78680bdff61, 0x88482a225cc05e90, 0x054300a5a57cc423, 0x146f0ef8cf215acc },
+    { 0x3c4c25db66bb8e26, 0xfa76bdb8b28755e7, 0x9ac161199aa13635, 0x18f66b41a611e977 },
+    { 0x803c22ccd6e3acf9, 0xd7d959a0b923b570, 0xdd8922c13980676e, 0x02641654c22ac946 },
+    { 0xe4d16e4245b8fdcd, 0x19b9ee427865fc43, 0xc278a52a0719df88, 0x0cb502ecdb7813db },
+    { 0x52232219816eeb53, 0x160817514c7d08de, 0x32e6783b89388983, 0x2156d0057ab9701f },
+    { 0x072f4df5209a7f9c, 0xf749ca2e841b7d27, 0x86901a6f90eede78, 0x264c543a7fccb916 },
+    { 0x90d6168bd6dde4f3, 0xb01dbf7a45d73dae, 0x2095e22846a0651f, 0x25f357a6d49a40f9 },
+    { 0xac2bd986500f7981, 0xf6bb310b9957132e, 0x03e6771975608a1f, 0x030adcde2b0e9e2c },
+    { 0x16b7b57ded14b7d9, 0xa0dc44a1a95e4a98, 0xbddda426e2013970, 0x17218fd94e797e19 },
+    { 0xc680994a7ea22366, 0x7b0fa4d66779e1c1, 0xa5361ded61053121, 0x15b1da03ce7ea8dc },
+    { 0x462f74e39c9ef235, 0x8562cd2ff666b52a, 0xc742d582e587d692, 0x05c5fb5fe0bcbb12 },
+    { 0x6a4f887273be8eab, 0x98b0a9ae50cef763, 0xdfdc30113f0bb892, 0x29c7b3dac67d0d07 },
+    { 0x61a40db095166533, 0xa26d7d110cb2069d, 0xddf77b4d7a54d103, 0x343f972cccc967d5 },
+    { 0xef9183479f563b78, 0x5b1d8951c73a0366, 0x199eb5d3260c42ec, 0x3f00508f66232950 },
+    { 0x63d9265d7f831ddf, 0xa095ba8bb69c7a6c, 0x038b3fb0afa88dc0, 0x19a8c5f0ebd8c17e },
+    { 0xf99b32860ddfacbe, 0x237c6f3f3af224f7, 0xe5d23a993ace7882, 0x2b33fab325f902e8 },
+    { 0xfb8b7dfcd345208c, 0x6c92ab9a17f6f286, 0x351b81bd2863bf2c, 0x2da671e1778ea713 },
+    { 0x6cc684d6518feef3, 0x7c58f8cb87b5c5f3, 0xa804fbfaaf9e53b8, 0x04d0703dd08f9c0a },
+    { 0x8fee2380aa75f6c7, 0x0e60bef43de60ff5, 0xd73ce8793e07ea51, 0x3a39e87e3319a473 },
+    { 0xa5cc3cff24880ac0, 0x652dd3982b29a164, 0x1a5303ae0a78d00c, 0x3f01fa660b07035f },
+    { 0xecb2c820f25ad036, 0xb426620d0a9f39d7, 0x67107e8766fca15f, 0x069567c9ec183c40 },
+    { 0x396f74c29a15dcea, 0xf31881abd3b57720, 0x5c4cae9333f2bff0, 0x30057ad107ef0541 },
+    { 0xe81b6c4c07957dc9, 0x6f67b73b39f2f632, 0x9a0a6e679ba4426b, 0x3639c3c0077d9b64 },
+    { 0x3f88ad9bf86ec0ab, 0x4da7798263d4aa62, 0xf59f7ca8294b0caa, 0x29987ba2602b126f },
+    { 0x7b6b0cf6b1d26faa, 0x8c5a6c3b09cd90d5, 0x67dd7fd9e4048f4e, 0x3a75ec11eae3ddf4 },
+    { 0x251bd7424767c13f, 0xe6a7a32c1dabc989, 0xad4d5432b77f038b, 0x156bfe89d04ad64d },
+    { 0xc90a2c73332f0fea, 0x68216a4835fe622a, 0x60d4f3a3ecae44ca, 0x11f83f5e97d0bb09 },
+    { 0xa27a34fb97d1c9db, 0x1ba48b23dde6511f, 0x4321890407c0e111, 0x00550a7f13e541d3 },
+    { 0xca115bd4f1493f65, 0x6cccdb9d60fa8b17, 0xd5482537a52d9c98, 0x2814d1680a9a07bc },
+    { 0xd67cab6c89acab1f, 0xc2424ad99d5dc959, 0xe19054491ce44148, 0x3803e2eb43f60f6a },
+    { 0x1fa8a5adc623db38, 0x68478507c2ee4259, 0x000fb74b4dc6c9ef, 0x1b042afda4234b99 },
+    { 0xb2f93831fca6b639, 0x00c67534990d726b, 0x86d3076193618e69, 0x1f380bb220a9f084 },
+    { 0x8e488f0986fc817f, 0x701ba6436091dc88, 0x5d94b1973856884b, 0x194a742f7fba0bfd },
+    { 0x01064550ec5dedfe, 0x956a3a5b9a6b246f, 0x65d482440a050a6a, 0x14dea55d17766d88 },
+    { 0x6add52ff98252e3f, 0x62d0a52995299d51, 0x66999f62e0810a0e, 0x1abe28335ba439d5 },
+    { 0xcce93ef4177870e5, 0x486ba40e9364a06e, 0x77c50838bda7fcbb, 0x29a5ac1ffcc5cc67 },
+    { 0x6e0b7076569e18af, 0x39f7522cb0cf9b0a, 0x019587184af43077, 0x37be069200981f01 },
+    { 0x1e0d274f13c57933, 0x7a229054a5e8e2d3, 0x77d216ca575a710e, 0x1622c9f013d5379e },
+    { 0x04618fbf91ec229b, 0x4519bcdb05811802, 0x2d0a215edecf014a, 0x069989bd8672f4b6 },
+    { 0xc4ffa586a0d1cb61, 0x1bc3bf881f9a4dce, 0x581c6cd04188f42c, 0x3c1bb91efe7a9e6a },
+    { 0xbefd188f48bc7284, 0xc19d71d50d61e09e, 0xe23cae161c25f5f4, 0x087173cf52b81897 },
+    { 0xc311dcd82c839f42, 0x5ed48093a631f9b6, 0xfa8f4b050afd7187, 0x3436f5304c62c294 },
+    { 0xca9111347d62e11f, 0xff7bb4e0d6c8966b, 0xc206c350dab1b50f, 0x396fc34a0f5b21c5 },
+    { 0xd5c5983f049f0ba7, 0x50638098da85d63e, 0xe6d4f6fbf8633765, 0x14f0307b70b8755f },
+    { 0x628def72c82af383, 0xfa014b439222db9b, 0x41a89fbb7607f284, 0x19ce346bd0bb1074 },
+    { 0x2f638ec94df4384d, 0xc0e1d530ddcc83ba, 0x2ed5c77b27dcbdaf, 0x3e4733187b299109 },
+    { 0xfb52d9cc60eac8d9, 0x5081f989d39b6227, 0x3aaa056fbfb39b7f, 0x3ca8eae36c139154 },
+    { 0x48bdaed8ef172ee0, 0xecab45bdc7a28e64, 0x38b54f689c43f6e1, 0x2e5f122714089c0b },
+    { 0xc7a036b7b2d3c0a2, 0xfaa50d4f4f2845e5, 0x4a950a74bab63d9b, 0x118d0d88e48ba9ad },
+    { 0xc0b447a4a3978bad, 0x06d2d741e31537be, 0xe2556cbc39e33769, 0x28b8ff86a1d44107 },
+    { 0x2fb72b5fa257da79, 0x73084defd3981e9c, 0xa19abfce626ed72d, 0x26a19e3110920353 },
+    { 0x480c341ca5c9ccbd, 0x3b08c4d9e9f5db2e, 0x249701fbde3f8789, 0x119af2ada67d4389 },
+    { 0xd51c1fcea2213887, 0x2a7662d354b8a2d0, 0x17dee10a843a43d8, 0x04782917a8465eff },
+    { 0xee76bfbe94ffb7fa, 0x87a064bb5d60efca, 0xa7bd210e1eb3042a, 0x0af12c4044028a3e },
+    { 0x54961c441d021e08, 0x2eceade4f74256e5, 0x63e1302fa7046982, 0x186811c3140e1192 },
+    { 0x12b4dc075f01b69d, 0x05d788492cc86b0b, 0x08fa2005a24790f2, 0x3649e7ab8d7c9de1 },
+    { 0xb0f02114828c0292, 0x6537d2b54a0deb06, 0xee34647488b3be0f, 0x07c76caebce85ffa },
+    { 0x99accd6f1cbfad0d, 0x5fffa62cadb4872d, 0x8dd86607800ebbf5, 0x221840d595aa99a8 },
+    { 0x7c8f6ed3ba56ff2c, 0x4d9f5e274e6fd5b9, 0x975e8b1d094c1521, 0x1f75dbb2388c78c1 },
+    { 0xf16174043d615f96, 0xab2e4337df87d40b, 0x3ababc8d3ebc6c23, 0x11f686138cea9b6b },
+    { 0x18355fb389fa7464, 0xde03dc3577217841, 0x853c15195d9e4984, 0x3b8aeeee34ece29a },
+    { 0xae4e77c227b4a40e, 0xa147d5af0e46c2ec, 0xb7fb7a3bf66c2c8f, 0x2e807d59c64f15fb },
+    { 0x027c043db91cd2ac, 0x3a1d53bcead3cc53, 0x7a904fb73321c868, 0x2bdd6aaa628f6b92 },
+    { 0xe9d5e76214debe82, 0x75357d63b194b8fa, 0x4cc6bf531a870fb9, 0x1e575782826fd45c },
+    { 0xee50a115d935f4bc, 0xbba3a884a9422dac, 0x7c6a05df8cd75230, 0x13fefacc1bf71759 },
+    { 0x75fd61b84b2ed276, 0x32c96b2f56f2d26f, 0xf71a07d8aad99d0d, 0x03a46ab39552b5b9 },
+    { 0xe6dcb1e4365e0a41, 0xd40615ce6abc346a, 0x319d0c2d0480be74, 0x03444ef5991cc51c },
+    { 0x35d8ff6bbe84bc9c, 0xced8bf6a5c101a5e, 0xe8a9da716e68dc78, 0x15e6a7b33c24c8ef },
+    { 0xc263b2a9f443901b, 0xe4e6ae6fd4884d9a, 0x91a172bb1813bd01, 0x000e61caf5e8a836 },
+    { 0x694b78e46b1bcc09, 0x3ace63c19863102d, 0x2d94c1265341f7a3, 0x3c19367f4da915e0 },
+    { 0x206360e6e605c7fd, 0x5371e2a1cea86fa6, 0xbfb93ce68c8cfe09, 0x2df92ec8158c4612 },
+    { 0x20427f2e6f080a61, 0x3447025d39667a6c, 0x98f6ab86fe946691, 0x089fedd14740d6d6 },
+    { 0x340b35cee7e45585, 0x1b8246f5db92ade2, 0x421b3badd32ca6df, 0x06035adf239e0396 },
+    { 0x9a7717fe65bb6f81, 0xdb12b348cf2cd9af, 0xf5f129a5a2bc3871, 0x3ee7ba517eb9c665 },
+    { 0x2704ddd9cdb49728, 0x62995a8d20a39af8, 0x300a484b58c61788, 0x26a2b2de469d9141 },
+    { 0x9ccb30f6c2272445, 0x069fbb8e3e770484, 0x84786327caefddf2, 0x055f4f1cabcf7993 },
+    { 0x0f67c38e7713623d, 0xb85e07a5c9a62e18, 0x79864261a38bc530, 0x1af9c1105a40dba1 },
+    { 0xdb4427862905d2eb, 0x18d6c6512e7aebeb, 0x85b82d988e17c540, 0x240a1dd950809c8b },
+    { 0x71e5e6c30a89950a, 0x59f9f6798d618cd9, 0x6e6aeca58047557b, 0x3eabcd3889fa2ab2 },
+    { 0x4d58468ada9ad810, 0x88dc4f1afb20585b, 0x6a5272864ae0e780, 0x218a4517a9580f55 },
+    { 0xcd897706496597c9, 0xe31635e967f1d92e, 0xcb1da0f2a2475821, 0x23f897f9f6c56fc6 },
+    { 0x8af3edd6be499035, 0x2ea01407feff7643, 0xa4ffb8eaf0e9b362, 0x3670144dabc76b44 },
+    { 0xb4c4bb6bae2a3ba8, 0x478bdd146cae4eef, 0x514e25519a2ab365, 0x260a50a4b6541ccb },
+    { 0x931234b76f8fe7f2, 0xf30fe8031347c7f0, 0x1a0744146cffc680, 0x28a011502a388b39 },
+    { 0x27c0546c7d4c9e0f, 0x93817d3e7eac4d8b, 0xd4e199d3c6537e51, 0x0f6242ea7bb0cade },
+    { 0xb998a656519afd8f, 0x1684b13120711b71, 0xd1e311299c49ce19, 0x3c36d4d2cf829ecf },
+    { 0xcde7fedc7b2de3b6, 0x714fd11004b786f3, 0xb1a5d2d07db27595, 0x367eeb55b655dad2 },
+    { 0x6ef4f07697f119bd, 0x9ff06e818e893a5b, 0xd303598ff471abb1, 0x2f03ee2dddfd21f9 },
+    { 0x72f33ca891e39674, 0x8dc5e236e863dcfe, 0x68e8f2fc55b91a4b, 0x3b2fbcd475cec8b1 },
+    { 0x9929a81c993431da, 0xe13ab6bc056550db, 0x7a1a2d20309e40c7, 0x270354ba322860a0 },
+    { 0x5b64db153fe49dc9, 0xa4b26823c2c86de4, 0xc5caf25ba3621b1f, 0x013db8059fc11b39 },
+    { 0x471af31ccc29c7f9, 0x8af2752ca352bd36, 0xea02bf32109e77a0, 0x3ebd3e5a7d36476a },
+    { 0x0124e88659f8b7eb, 0x9e6020107113ca8d, 0x21803774a68270a7, 0x3ee97f1e615fc635 },
+    { 0x322e3a6195ec0214, 0xb2f09e6bb77686f3, 0x1a6f938dd4886086, 0x0485d31d9a1fb2b5 },
+    { 0x2d88fb1016416121, 0xae2b186a898cc7c1, 0x436adf8457ec4068, 0x1e538f48bb2e8d33 },
+    { 0x6d7f787664374374, 0xb02b6de27328a736, 0x12edd98f37a813c5, 0x3781ae4a2a49f0e7 },
+    { 0xfa36e39150e7c691, 0xf445e1a6b815a9cc, 0x2ed9429b5b0d33d3, 0x0b8aebc8999b74fd },
+    { 0xec0f5ac0fb88f3a2, 0xb9244d088ffae515, 0x1f984aa2b76b791b, 0x0b2313fa32b3e282 },
+    { 0x35c2f92b71a5e2a1, 0x819487789d65c9f0, 0x9aa601223e51bc95, 0x2efff687bc6b4269 },
+    { 0x8b039fa742d50369, 0x4dfe48a530e67235, 0x2ce0ba885100452d, 0x1da83c33eaf5e39a },
+    { 0xb27a9679bac8b636, 0xc694da20b6330af9, 0xe416b4cb72896338, 0x1e3c9ec000fd7990 },
+    { 0xbb35e4e3808b050c, 0x376cb6a7398df6f3, 0xccc29fc8e1d9c098, 0x00ad40b339f52bff },
+    { 0x12e0811935ffbee8, 0xd3b00213f789d3a8, 0x6aaa7c91f229dfdc, 0x2789b95c63878c20 },
+    { 0x8af402c000c9111e, 0xebe4ef3e57cf81a1, 0x7f93859dc69679ec, 0x369e4c611c2ac911 },
+    { 0xfb855e5d86ad8e6f, 0xc8d0aee08c333dfc, 0x5532d9c2a263a3d1, 0x12f4597dd31f6e73 },
+    { 0x57d3622aa7599777, 0xe11149108e144f26, 0x2d06430df5c1df89, 0x178963449638a740 },
+    { 0x4a2b29c704d7a4e8, 0xdb7848bee1c6e2b2, 0xc95be1c4fe8389b6, 0x1c9644243221d475 },
+    { 0x5cec61af06f65add, 0xdbd7a43d43dfa1b2, 0xaee816aea2a98e33, 0x30b17ddfc3e4fdc7 },
+    { 0xc373fea0c8380ed1, 0x9f0ae87653d7c7f4, 0x8528871d579fc755, 0x1f65691676ea1f21 },
+    { 0xb5d7343fa3a7c481, 0x8e300866b0ee3d64, 0x778d201a901dda75, 0x27c66b8463b7d568 },
+    { 0xb780c5eceac81595, 0x35e03b02513a6dd7, 0x01f3d2227cfa967e, 0x0057bdf4611f9523 },
+    { 0x919cdd87661ef087, 0x91ca113f97d7ca44, 0x3badd5e03c5d50ca, 0x13bca07cf7fd2b8a },
+    { 0xdce484404e36086d, 0x22f16ed9ef39b46d, 0x24641fbae874aa17, 0x1707be5d55a04693 },
+    { 0x78ff298f43ebfee7, 0x9a0f057361443e00, 0x5072e7e5497458ca, 0x25cffd791c497277 },
+    { 0xf9a2693af4584d75, 0xfbb1f8b65252ec20, 0xfa4404da6ab0841b, 0x3aa577b721f1aace },
+    { 0x5bc2577f1537dc9a, 0xa7401d39f2b63f9c, 0x4b58bf40d3e3acd0, 0x171b09d815051f66 },
+    { 0x408391ca520ea070, 0xed2e3ef8296f24e0, 0x251054a6386cb128, 0x3df2a8cfa1a52948 },
+    { 0x39709ce66cb9404e, 0x1e3e2b3cf0103576, 0x88e8a8df1a321514, 0x2e744c2095ef95c8 },
+    { 0x51ef68b13013e18e, 0x994fd316742ec18a, 0x6a50ccfb7c424d98, 0x1508606c585d9782 },
+    { 0x91c60317436466c2, 0xa1b66855982a3204, 0xb2d086f193433eb3, 0x3f107a3e099a9db5 },
+    { 0x8c44a69230cfdd5f, 0xb745d5c112ebf957, 0xea20269c3a610f77, 0x24f020cb9f483487 },
+    { 0x8af1557e45f82d7a, 0xd4f77f2b036a9767, 0x0913bd2a348861d2, 0x20b7b7fe8da50352 },
+    { 0xe1b53c94f584f1c6, 0x7f486268fccc14cb, 0xce19c8b42475c225, 0x3a21c97602d26c3c },
+    { 0x638c50dbfe1e821d, 0xb0961359be92ad3d, 0x7df980ffe16716df, 0x1018c5359b4ecc13 },
+    { 0x8552d0007b757561, 0xf1642763797cb8cc, 0x9a16b7ae73254312, 0x276292c77f39eecd },
+    { 0xc8baf102c72f16ff, 0x2af5435230c0fdd0, 0xc1ad28f067a535db, 0x27a459a747bfaa35 },
+    { 0x1415db10b291adfd, 0x21fa4aa67bdf3965, 0x979ae7d5aa5fe828, 0x1a685f9fdd2b7d7e },
+  },
+};
+
+const uint64_t fiat_pasta_fp_sqrt_dlog_keys[PASTA_SQRT_DLOG_SLOTS] = {
+  0x71e5e6c30a89950a, 0x78eab1be90f7f5a0, 0x59a4835107913f56, 0x0000000000000000,
+  0xb780c5eceac81595, 0x39709ce66cb9404e, 0x52232219816eeb53, 0x0000000000000000,
+  0x63d9265d7f831ddf, 0x0000000000000000, 0x35c2f92b71a5e2a1, 0x0000000000000000,
+  0x6ef4f07697f119bd, 0xed015766aff08680, 0x8fee2380aa75f6c7, 0x35d8ff6bbe84bc9c,
+  0xb998a656519afd8f, 0x0000000000000000, 0x9ccb30f6c2272445, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0xb4c4bb6bae2a3ba8, 0xe83d0fd87d73fd6f,
+  0xce9c1fb8829d1ee2, 0x0000000000000000, 0x0000000000000000, 0xa27a34fb97d1c9db,
+  0x0000000000000000, 0xbde90966d6fa2d16, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x48bdaed8ef172ee0, 0xc311dcd82c839f42, 0x0000000000000000,
+  0x803c22ccd6e3acf9, 0x0000000000000000, 0x0000000000000000, 0x2fb72b5fa257da79,
+  0x0000000000000000, 0xdce484404e36086d, 0x0000000000000000, 0x0000000000000000,
+  0x6cc684d6518feef3, 0x51ef68b13013e18e, 0xee50a115d935f4bc, 0x0000000000000000,
+  0x89c56d5e88ec9dc4, 0xcba3b9e6b69a6838, 0x0000000000000000, 0x6add52ff98252e3f,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0xca115bd4f1493f65, 0x628def72c82af383, 0x741159aab8983ec2,
+  0x0000000000000000, 0xe1b53c94f584f1c6, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0xf16174043d615f96,
+  0xd51c1fcea2213887, 0x0000000000000000, 0xb2f93831fca6b639, 0xc0b447a4a3978bad,
+  0x8c44a69230cfdd5f, 0xbefd188f48bc7284, 0xfa36e39150e7c691, 0x69c9a223b20bc7b4,
+  0x0000000000000000, 0x64b4c3b400000004, 0x0000000000000000, 0x0000000000000000,
+  0x9929a81c993431da, 0x716cdc8082b361f2, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0xd18cfa354d2c3f5f, 0x5bc2577f1537dc9a, 0x0000000000000000,
+  0x9a7717fe65bb6f81, 0x1fa8a5adc623db38, 0xad1dd62c04770c5f, 0xfb52d9cc60eac8d9,
+  0xc36798adfb60f45a, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x232fcf34b4d12d8b, 0x0000000000000000, 0x0000000000000000,
+  0xae4e77c227b4a40e, 0xd0723fea38d0e902, 0x0e3bdb6eba07d287, 0x3c40cf3df909a524,
+  0xddf74c097f74faf5, 0x0000000000000000, 0x3789233c6ae99ace, 0x0000000000000000,
+  0x202e075dbc14011a, 0x12e0811935ffbee8, 0x7b20099dec3a86ce, 0xd42d8b665f2e34a0,
+  0xb5d7343fa3a7c481, 0xb27a9679bac8b636, 0xb111c4a0f86a8238, 0xcc43f1f8e8878f1c,
+  0x8552d0007b757561, 0x35a0e01101e17de4, 0x0790536599e10f7a, 0x5fbdbc2a65ea2317,
+  0xd2ac97a2815ddc9b, 0xa5cc3cff24880ac0, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0xb2507f08c9a1f5c0, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x1c9dc21945a900d5, 0x0000000000000000, 0x1415db10b291adfd, 0x91c60317436466c2,
+  0xcde7fedc7b2de3b6, 0xc263b2a9f443901b, 0x0000000000000000, 0x0000000000000000,
+  0x52fdbc0963610dcc, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x5ce10b11994471db, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0xd0230479ccd0f017, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x66fef68b6a13fded,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x72f33ca891e39674, 0x0000000000000000, 0x0000000000000000,
+  0x16b7b57ded14b7d9, 0xecb2c820f25ad036, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x408391ca520ea070, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0xef9183479f563b78, 0x0e392e2cff36eee3,
+  0x0000000000000000, 0x0000000000000000, 0x78c9d00619fa3804, 0x04618fbf91ec229b,
+  0x6a4f887273be8eab, 0x0000000000000000, 0xaab6712e6b004807, 0x0000000000000000,
+  0xfb855e5d86ad8e6f, 0x471af31ccc29c7f9, 0xd67cab6c89acab1f, 0x2b21c076a961e752,
+  0x9826eb9c13a21203, 0x18355fb389fa7464, 0x694b78e46b1bcc09, 0x99accd6f1cbfad0d,
+  0x4159cec258a6688a, 0x3dc855d7c01b6238, 0x3f4b89667f4200a0, 0x0000000000000000,
+  0x57d3622aa7599777, 0x59e1a78680bdff61, 0x5b64db153fe49dc9, 0x2fe1b80894e433f8,
+  0x80f7d13976058b9d, 0x01064550ec5dedfe, 0x52123dd033d63808, 0xff80637de34052f4,
+  0x6e0b7076569e18af, 0x9da7d28f79527192, 0xee76bfbe94ffb7fa, 0xc2b08580765354e2,
+  0x94cba12d6e13dd66, 0x2edda87a8c417156, 0x206360e6e605c7fd, 0x0000000000000000,
+  0x0000000000000000, 0xa99bada560a9c489, 0x8af402c000c9111e, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x58a99f22adf15f91, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0xac7a68cc0da52fcb, 0x82757b6f12eb4828,
+  0x0000000000000000, 0x0000000000000000, 0x2639f4446e1c698d, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x322e3a6195ec0214, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0xc90a2c73332f0fea,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x3c4c25db66bb8e26,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x462f74e39c9ef235,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x07672dd5bc9b993f, 0x851755dc4d6e5204, 0xcb45321084d21c4b, 0xd6c97e430bbc6fe6,
+  0x7c8f6ed3ba56ff2c, 0x0000000000000000, 0x0000000000000000, 0xe6dcb1e4365e0a41,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0xf360f3eddb77f541, 0xc680994a7ea22366,
+  0x0000000000000000, 0x0000000000000000, 0x919cdd87661ef087, 0x13da60ec848a8aa0,
+  0x638c50dbfe1e821d, 0xcce93ef4177870e5, 0x396f74c29a15dcea, 0xe355fcad5c583b80,
+  0xc4ffa586a0d1cb61, 0xe81b6c4c07957dc9, 0x864cafd3ca004119, 0x78ff298f43ebfee7,
+  0x1e0d274f13c57933, 0xe6b29a73453749cb, 0x61a40db095166533, 0x0000000000000000,
+  0x5cec61af06f65add, 0xbb35e4e3808b050c, 0xc8baf102c72f16ff, 0x8af1557e45f82d7a,
+  0xeadeb92ad84b5bf3, 0x0000000000000000, 0x75fd61b84b2ed276, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x9dda57209f153728, 0xec0f5ac0fb88f3a2, 0xd5c5983f049f0ba7, 0xfeb618ee9a449080,
+  0x79848b3f39dc24c9, 0x3d6ad96deac82367, 0xc7a036b7b2d3c0a2, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x27c0546c7d4c9e0f, 0x000388d066cbce27,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x34786d38fffffffd,
+  0x0000000000000000, 0x2f638ec94df4384d, 0x9ef64d5baf183970, 0x0000000000000000,
+  0x0ce88a5acf3022a2, 0xd878e9485c687454, 0xda30185db7438d7d, 0xe633f8bb035949c8,
+  0xa7cbbce8c29ea06b, 0xc411111e5ddec77a, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0xb777f4580a7b0e3b, 0x0000000000000000,
+  0x0000000000000000, 0x251bd7424767c13f, 0x369f417a37d50c7e, 0xcf1bd5180eb6c09c,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x2e4fdded67dad1c2, 0x0000000000000000, 0x0000000000000000, 0xcd897706496597c9,
+  0x0f67c38e7713623d, 0x0000000000000000, 0x473dc83bcfec1e73, 0xaadc8fd726ca0b45,
+  0x2c66ac16ae70110e, 0x0000000000000000, 0xbc48acacb1c9f794, 0x0000000000000000,
+  0x6976058d5da82588, 0x0000000000000000, 0x0000000000000000, 0x18f10e20291c5308,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x506f821410e8d121,
+  0xd61b5414d37c60bf, 0x0000000000000000, 0xdb4427862905d2eb, 0x0000000000000000,
+  0xf6b2fbf1682e3626, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0xb0f02114828c0292, 0xca9111347d62e11f, 0xe468758151d5c459, 0x0000000000000000,
+  0x0000000000000000, 0xfc61fff63dd8dbbc, 0x0000000000000000, 0x0000000000000000,
+  0xdf948a96ae650272, 0x63543181417b4365, 0x093f0d6c558a093a, 0xac2bd986500f7981,
+  0x2a384076680ee644, 0x636a37c18e5a1d60, 0x0000000000000000, 0x35540a8f807ce222,
+  0x0000000000000000, 0x470a0ed37e9114ae, 0x5fbc94069346bfb3, 0xe1ac6b001537ea6c,
+  0x0000000000000000, 0x0000000000000000, 0x3f88ad9bf86ec0ab, 0x27474a29f5766af7,
+  0x20427f2e6f080a61, 0xfb8b7dfcd345208c, 0x90d6168bd6dde4f3, 0x867854e5a0fe4964,
+  0x0ae4a1e379037e82, 0x0000000000000000, 0x8b039fa742d50369, 0x1dc223f64e2d9057,
+  0x0000000000000000, 0x0000000000000000, 0x8af3edd6be499035, 0x0000000000000000,
+  0x9f8ac7b20ba7b28c, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x98084866a6074816, 0x0000000000000000, 0x449714a8e2fde1f9,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x4d58468ada9ad810, 0xe4d16e4245b8fdcd, 0x4a2b29c704d7a4e8, 0x061afc359070180f,
+  0xd5b9324c37c7f130, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x96b12caf46e32d55, 0x0000000000000000, 0x2d88fb1016416121,
+  0x340b35cee7e45585, 0xe9d5e76214debe82, 0x91fde2f7df658065, 0x0000000000000000,
+  0x5120fcd05a363344, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x72285313324b68d9, 0x0000000000000000, 0xf99b32860ddfacbe,
+  0x2badb8769bc8bc8d, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x6d7f787664374374, 0x9f91fe66f2205343, 0x2704ddd9cdb49728, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x480c341ca5c9ccbd,
+  0x0000000000000000, 0x0000000000000000, 0x072f4df5209a7f9c, 0xaf57498aeb21417f,
+  0x6ba435dce9be9ee0, 0x6521fb1e181baa7c, 0x027c043db91cd2ac, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0xc373fea0c8380ed1, 0x4f020725fb285b19, 0x0000000000000000, 0x4bd4ea62256527f1,
+  0x931234b76f8fe7f2, 0xb45bc2aaba470234, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x54961c441d021e08, 0x0124e88659f8b7eb, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0xf9a2693af4584d75, 0x0e39431641b66fcc, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x7b6b0cf6b1d26faa, 0x0e299145bd2afc98, 0x8e488f0986fc817f,
+  0x0000000000000000, 0x12b4dc075f01b69d, 0x9da1b2f02cbadf75, 0x08571a6129221b0e,
+};
+
+const uint16_t fiat_pasta_fp_sqrt_dlog_vals[PASTA_SQRT_DLOG_SLOTS] = {
+  50, 185, 233, 0, 18, 11, 124, 0, 114, 0, 30, 0, 41, 249, 110, 61,
+  43, 0, 53, 0, 0, 0, 46, 200, 214, 0, 0, 101, 0, 179, 0, 0,
+  0, 81, 87, 0, 126, 0, 0, 78, 0, 16, 0, 0, 111, 10, 64, 0,
+  180, 176, 0, 94, 0, 0, 0, 0, 0, 100, 84, 231, 0, 6, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 69, 76, 0, 97, 79, 8, 88, 32, 211,
+  0, 129, 0, 0, 39, 172, 0, 0, 0, 208, 13, 0, 55, 98, 159, 82,
+  213, 0, 0, 0, 0, 191, 0, 0, 67, 131, 135, 149, 155, 0, 244, 0,
+  143, 26, 219, 217, 19, 28, 234, 221, 4, 133, 145, 235, 247, 109, 0, 0,
+  0, 0, 0, 0, 190, 0, 0, 0, 198, 0, 2, 9, 42, 60, 0, 0,
+  246, 0, 0, 0, 255, 0, 0, 0, 230, 0, 0, 0, 0, 0, 0, 163,
+  0, 0, 0, 0, 0, 40, 0, 0, 120, 108, 0, 0, 0, 0, 12, 0,
+  0, 0, 0, 0, 0, 0, 115, 153, 0, 0, 186, 90, 117, 0, 203, 0,
+  24, 37, 99, 220, 223, 68, 59, 71, 151, 166, 256, 0, 23, 128, 38, 187,
+  196, 95, 165, 199, 92, 152, 75, 227, 218, 245, 58, 0, 0, 243, 25, 0,
+  0, 0, 0, 0, 0, 0, 140, 0, 0, 0, 236, 248, 0, 0, 168, 0,
+  0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 102, 0, 0, 0, 127,
+  0, 0, 0, 118, 0, 0, 0, 0, 137, 130, 170, 188, 70, 0, 0, 62,
+  0, 0, 0, 0, 0, 0, 237, 119, 0, 0, 17, 132, 5, 93, 107, 147,
+  89, 106, 154, 15, 91, 156, 116, 0, 21, 27, 3, 7, 195, 0, 63, 0,
+  0, 0, 0, 0, 210, 31, 85, 183, 226, 141, 80, 0, 0, 0, 44, 167,
+  0, 0, 0, 1, 0, 83, 160, 0, 136, 207, 216, 225, 197, 204, 0, 0,
+  0, 0, 0, 0, 0, 0, 134, 0, 0, 103, 212, 228, 0, 0, 0, 0,
+  222, 0, 0, 48, 52, 0, 138, 192, 239, 0, 144, 0, 206, 0, 0, 254,
+  0, 0, 0, 209, 215, 0, 51, 0, 229, 0, 0, 0, 72, 86, 174, 0,
+  0, 181, 0, 0, 171, 189, 238, 121, 169, 158, 0, 242, 0, 252, 139, 146,
+  0, 0, 105, 178, 57, 112, 122, 201, 224, 0, 29, 232, 0, 0, 47, 0,
+  142, 0, 0, 0, 0, 164, 0, 202, 0, 0, 0, 0, 49, 125, 22, 173,
+  148, 0, 0, 0, 0, 194, 0, 34, 56, 65, 251, 0, 205, 0, 0, 0,
+  0, 182, 0, 113, 161, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  33, 241, 54, 0, 0, 0, 0, 77, 0, 0, 123, 193, 162, 184, 66, 0,
+  0, 0, 0, 0, 20, 150, 0, 177, 45, 253, 0, 0, 0, 74, 36, 0,
+  0, 0, 0, 0, 14, 175, 0, 0, 0, 104, 157, 96, 0, 73, 240, 250,
+};
+
+// m = 0x40000000000000000000000000000000224698fc0994a8dd8c46eb2100000001
+const uint64_t fiat_pasta_fq_sqrt_table[PASTA_SQRT_WINDOWS][PASTA_SQRT_WINDOW_SIZE][4] = {
+  // g^(-j * 2^0)
+  {
+    { 0x5b2b3e9cfffffffd, 0x992c350be3420567, 0xffffffffffffffff, 0x3fffffffffffffff },
+    { 0xb990773d23d22e85, 0x4ece919a03f3c012, 0x2c9ac8b9aa3ba50b, 0x364d5dfa434d9efa },
+    { 0xd1dbb3e688e91ad9, 0x491d4513e44ffd0c, 0x006e18c577fcadc5, 0x24ab3529132ab860 },
+    { 0xb6cbbf016eae3395, 0x0631d31a2acb09f1, 0x5324f01059da2d1d, 0x1d43dab05c46821a },
+    { 0x9f2de71b6ea9cbc2, 0xa92b999d8a9ceba2, 0x252d04a31253fb65, 0x31b18dd7575fb508 },
+    { 0x437a403963ed9555, 0xbdb3383770aa7cd3, 0x358856c5a7fbb7bc, 0x10573991f287fdc6 },
+    { 0x6135d9fc2d455fe4, 0x8abffe9f251515cf, 0x17d9599e83ea5bb8, 0x0528ec11ba045ccb },
+    { 0x26991ae3576e43bf, 0x0300e5952a1da791, 0xecedda8484e35ec7, 0x3ee8519e2de9bc8e },
+    { 0xf49c886df5ecd31b, 0x486c02cc934df55c, 0xbc7708ffddbf35b3, 0x3240dc2e0f53da8c },
+    { 0x2a676f30accb130a, 0x9ef8483a292a70d0, 0xc43aaf4b446e8cfa, 0x13419dc52391581a },
+    { 0x155bb4521b60441b, 0x6d748af787e32d0f, 0xb1837639b7df5ac8, 0x07e4870b96d253fa },
+    { 0x04e1002729526dbb, 0xf5271934b303d602, 0x78084e65d310d06a, 0x2d36ab6530164b55 },
+    { 0x3adeafe34b6a58fd, 0x3a5e0b16fca8325d, 0x89b73dc1fa30ad42, 0x37bbf3d884492414 },
+    { 0x190c10702a6d3a2d, 0xa9935b93039df795, 0x09f89623d3589bd5, 0x04be22361de38164 },
+    { 0x8f5f94de7e75f878, 0x47816fa0a5ed2c03, 0x31582fda06d00f63, 0x320961fad9752793 },
+    { 0xd13480471bc228ad, 0x02fe65cd8d943083, 0x34fd79f865ba20c9, 0x25ba73a747215f18 },
+    { 0x51c974f5d568866f, 0xe69eb7a48f652521, 0xd78107c66296509c, 0x1e175b9d89c56e33 },
+    { 0x7bae2e31fb789ede, 0xe8045a20ec0931db, 0x5bc15bb4dfe97dc7, 0x2807b78a6ab59489 },
+    { 0x06396b7a33329d19, 0x9257795ac6abdc8d, 0x206d37419779ec1a, 0x2852bd89fc11a3f1 },
+    { 0x1eda61c4a6242a12, 0xa4ad59cbd36e74ca, 0x0766e6e495669b73, 0x046d4223c9b90860 },
+    { 0x32dec60d9bed67ca, 0xd7fac940dc4320be, 0x5727321fbf43f3ba, 0x04d18a1b767ace94 },
+    { 0x01350f663ca0abd6, 0xe27cb190ac469a6c, 0x287a0048c9caae59, 0x3bc8bf56fb8c1998 },
+    { 0xa9032d44c275deb9, 0xc02336689a8b89fa, 0xeaf38200c11df4f3, 0x3e4831e98a5e237e },
+    { 0x1ab9c3cbc7c23cee, 0x610213369cdb6774, 0x16645b1cd8268c44, 0x3e9a67cc30fcc77c },
+    { 0x76748b970e9f3605, 0xbb23014636f096c7, 0xc6b194be5e4cca4a, 0x2d0b4399e2bbae6c },
+    { 0x473e5005e74e7a88, 0xabd6e0f393eff4ca, 0x47485b096f4e27f6, 0x0265a79302a33a91 },
+    { 0xc5ac4cd0294aaa1d, 0xe7d412ae8520743a, 0xa7774b65d3cf3875, 0x372eebfd2387f3c0 },
+    { 0xda0242b062cacf86, 0xd2c083356ce315c7, 0xf74c18f453d03c4c, 0x32792147b186e0b3 },
+    { 0x3b9a1f49ea9d9cee, 0x82bbd455a2ddf368, 0x90fe6ac17d07da6a, 0x2a75f71c47a4e8ca },
+    { 0x36ae2fa2851f2a2e, 0x003d63126761b9db, 0xc59c08c136989e04, 0x1bf2e975bec411cf },
+    { 0x1deeed64b44b5b9c, 0xf98d4dd4537ef79e, 0x5bf2fcd0a1594e5f, 0x3c8393d380d3ff17 },
+    { 0x80c4d1f3408ce761, 0x8be014b8d91e37fd, 0xfdfd83dfcef50bdd, 0x3421f9dfc52812aa },
+    { 0xc537eae78dc37c2c, 0x0422a99002f63696, 0x4fbbf679b2b498b3, 0x22bfb73b2402d4bc },
+    { 0xa5069744c55b8b13, 0xd5cfc525989656b8, 0x4123e7fdd3a6e23a, 0x21e1a61cb933ef15 },
+    { 0xcc22a66d8f68889e, 0x4c16585f939ddef5, 0xa021cf6afd62edf5, 0x01bca3fc3cb87365 },
+    { 0x4dcf511bcabbc1c9, 0x84d47d3c782cd829, 0xe2b45ce017bc32a1, 0x14246af18c8a51ee },
+    { 0x9e7ae43fe03a8884, 0x2e820269b956a775, 0x05764143fc87bea1, 0x36f7a63e7c435b0a },
+    { 0xc1ce06ff914111b6, 0x0cd70c29b92f26a1, 0x3df970881f89a245, 0x3afb8a224a0ddfa0 },
+    { 0xcc0d9d26a396a514, 0x1ccb89364452ec51, 0x4d9e8d29888a8cdb, 0x38bd89313d5a6d3c },
+    { 0x2aaab47b053395a7, 0x2afd269a3abfbb06, 0x622a0d2d0aaf71af, 0x3c451a7446b5600f },
+    { 0xa189e49bfd464c14, 0x9aa56293922fcc5d, 0x3dc04c61de5c6af0, 0x3f03691e51646a64 },
+    { 0x09b2757a571819d6, 0x94ff5f72205d7fb9, 0x9c108a220ec240c7, 0x02cc3f78c2b92596 },
+    { 0x77f322910b4b0933, 0x02c01a0004b35918, 0x29b1d25630ac4d81, 0x1592376d16ad905c },
+    { 0x705434cc27e45e7a, 0x88ea402ae8072eac, 0xaa705e2859e4d028, 0x05d05fb2f73747ca },
+    { 0x0778deb5df36ce29, 0x046e74c1da0f7503, 0x509799cf398239f9, 0x29d022d27517b265 },
+    { 0x8b7591b514beb62a, 0x016a321a62f6a0fb, 0xad34c1aa042fb316, 0x016e5da09ab9ac6e },
+    { 0x727790b00515f9c4, 0x6212771d50e515cc, 0x1ddc45b43a4de411, 0x2bd7928ac1591774 },
+    { 0xd3293208c8a6b27b, 0x7ae80b57e67299ad, 0xc64ba30c80297ee9, 0x205ddc7f908342d2 },
+    { 0x35b3ef9d9f2965e5, 0xe0ea0971ee751d2a, 0x3ba7523a56fe4820, 0x3b42762bbae12a88 },
+    { 0xad76594a1c6063fc, 0x2f0254d07af30253, 0xb59b0eb55937adc3, 0x2f8f1d1b15b6d879 },
+    { 0x4c2441fb946069a4, 0x86f4688f097bae50, 0xfab1d4ac6b433d08, 0x2589d1e6f316f5c5 },
+    { 0xad62ef1986764b37, 0x2d84521dae50379c, 0x670aa79870a64351, 0x3462e4edf16ccc29 },
+    { 0xe9dd06f85887b8e5, 0x5b77f4806b209694, 0x9969f134f8bb439d, 0x075ab8a48e62a40c },
+    { 0x361d29790772c9e2, 0x42588347873679e9, 0xfcdbff1452983436, 0x006299ff83b81ef6 },
+    { 0xa437547c5addb99f, 0xa5b74039c91f0c67, 0xfbc6e23faf08fa6f, 0x004baa52abacbfdf },
+    { 0xf0c0a9295fece799, 0xd2630279044e2e27, 0x0ca2fe6f4b91c70d, 0x1a563b4f6d51c386 },
+    { 0x9940c189a42bf28b, 0x88971f79756b99ba, 0xaf5f87c0290f5973, 0x2aaf452d4238e4ff },
+    { 0xa2c300ea46f3069c, 0x664e039bd2eaa3c5, 0x1a3f46165435eca9, 0x30d1b945265bc555 },
+    { 0x12c19bce43ddde15, 0x966cb9a4a70fc555, 0x8d156cfee48fda0d, 0x1efcac42862ed6bf },
+    { 0x4e902c3d88681add, 0x9e5bbc767d4ba17e, 0x748d6bfcce1702d1, 0x064c55d5b7f06f16 },
+    { 0x1a9e5cf72abc92cd, 0xafb01448223f26de, 0xc0324a7ba06aebd3, 0x2bbf73d0f668b4b9 },
+    { 0xb627474c670cde42, 0xb701182f4a6e79d5, 0xf7cf8f16ecab8e96, 0x00357bb8ede44c4d },
+    { 0xfd1f8086932c3bc7, 0x20a025450e4d61d2, 0xaaf838f14dd7c039, 0x00f7b31a719d11a3 },
+    { 0xd62fae2915bb67fc, 0xa4aadad691675d02, 0x92a6117d2af413f0, 0x10d8c11401e93834 },
+    { 0x5fdffb112a7da976, 0x5460c0d0af9683c8, 0x9b7d269833a148d8, 0x2d782f20867dc31b },
+    { 0x94c9a336e04623db, 0xf101949128eef233, 0x56242d2ea3034c1e, 0x35b0f98ead9bfb74 },
+    { 0xacb1e7dea7c4b35d, 0xa31a089d17f3ed9a, 0xb995fad3283108bb, 0x176e0e45f2b3b379 },
+    { 0xf61ef2dee471e1dc, 0xef1139a0812f57ab, 0xfb0de867b03f2126, 0x163e37bca0b5c3df },
+    { 0x03c7d88945633f9c, 0xf4e9c3e06c364b34, 0xd54a57340c1f8545, 0x34bae8c95ded622c },
+    { 0x6f12e480879cd9e3, 0x7b60050c221baaa3, 0x2d8a3aed62939192, 0x1242118d7107b9dd },
+    { 0x3f2aa59d9f5872e3, 0x232b37b4a94a50a8, 0xd7761adf9cb3a6cd, 0x3c8aadbba4f0b8b4 },
+    { 0xa88490e96271bc20, 0x31b8f66777dd2638, 0x350b41b0e34964d2, 0x118f792a9bf863f2 },
+    { 0x6e19025dcdb27017, 0xb612aeaffa8379dc, 0x6f585c6f464243f0, 0x07015d8e8c3d39ca },
+    { 0x260375d9b5d73ae6, 0xf6b7c4105c31c229, 0x9d873f673caf043b, 0x3056a42633d5ede1 },
+    { 0x60c40b8927426ef4, 0x2f7b720d5834794e, 0x573e9509db2beb7d, 0x1506565d84e027fa },
+    { 0xe91058cd78e86830, 0x8c6864c71fa1cf17, 0xe9469868417b8a10, 0x129c7023f69930b1 },
+    { 0x926a9e00bad6476f, 0x8336d523cb114097, 0x12721ff48bfe3c09, 0x2269e6f922c280e0 },
+    { 0xdcb76f61e1ab476b, 0x9347cff8a10a1536, 0xca85eca5bd530d12, 0x37c8061ad09d3455 },
+    { 0x289f338158a3eec1, 0x2530bb673125dfb8, 0xfc7e55bd2c802b56, 0x29f8f25ad4c5c353 },
+    { 0x4a5e941cd1fe14fd, 0x38605c74ff7f9dcf, 0x2f482881eae0e473, 0x3cba464a29d566f6 },
+    { 0xb756fed9864e5d34, 0xafce611ed30083e0, 0x1b71b194c2f7696a, 0x16fd5949c03864ca },
+    { 0x53e0fcfbd6b059e9, 0x7eafbf2485737f5f, 0xb2a7b959fda77f35, 0x34116594423d5ecc },
+    { 0x84a87b2209af5c32, 0x1ab4195fc9b6e0b8, 0xd6aa68dd4d493834, 0x21e0682bcff9893e },
+    { 0xa279726eaa3f89a1, 0x38c39022098ad551, 0x5cd9589f0e433286, 0x388fcb2c474f9cc0 },
+    { 0xa570de7897a410d1, 0xa33122ee16bf5b13, 0x4a9fde6ab8be2646, 0x1e95ade2978148a0 },
+    { 0x0614a1de7674905c, 0x6a0dc4b08a38f4d5, 0xfbb083537b4e0106, 0x1b7e86060fe24dec },
+    { 0xcf3d3e5d33176836, 0x24d8bfa91a650eac, 0xd89c8a7932581017, 0x207efb3c65fb2948 },
+    { 0x6ba707281dbb9f49, 0x30b4d48a22673af4, 0x97b74596507ef5a1, 0x1562ea54b8ee0294 },
+    { 0x3641cb64f78d32fa, 0x4d57d009c8d0581c, 0x137c8baa97feba0d, 0x24d6899ccd8abfe5 },
+    { 0x2f55039b9c77b24e, 0x67d3f1c6907a4847, 0x68f87ed3d2eeab2f, 0x0fa2fe49ce1641cf },
+    { 0x3a0e0c121ffaf843, 0x4686a26758f21b68, 0xfca529291cd1a546, 0x199ba28d8b0e8b69 },
+    { 0x65b08fc505cc383b, 0xdd7f815d2e00bb15, 0x56837aaab4205504, 0x1d2bc6f51bf1856d },
+    { 0x9f590d7668f8ad71, 0xb55c9f89eb6b50c2, 0x39e00b9deaad0e6b, 0x03d4130358d7e85d },
+    { 0x3d84844afaad8f37, 0x40c0307ba9f767d8, 0xe1ece56f5e1a2a32, 0x1055d275a4d1b547 },
+    { 0x559c93fb191a1a00, 0x28edb8aff084e997, 0x7d76978f774ab1dc, 0x2fff0d0fd47815c5 },
+    { 0xc6e809bf9b325722, 0xc342f8f162b49859, 0xd5ac91072468ed13, 0x3a5fae41e719cddd },
+    { 0x10d3c1ed06d57ddc, 0x4041b2ffd8041329, 0xae38991e707a4cbd, 0x1aad0db73ce3eeab },
+    { 0xf358657d97600323, 0x2dccb690bde45343, 0x579721f375dd93ff, 0x247c9a66ebf0a941 },
+    { 0x3667a6709b78c910, 0xc742c2ac40003a13, 0x4d807631aff70841, 0x12c3e293950e63f2 },
+    { 0x2dfa195f67223d76, 0x3aea1ce24187ea77, 0x8d86f2aa1ee3f43c, 0x18ea3f66cbb43496 },
+    { 0xb42eafab8c343c08, 0x771a47d54e06d99d, 0x3b4e5f49689a3bb6, 0x2fbe57a4f834b8c1 },
+    { 0x96dce5202111f8c2, 0xd79919e10421888c, 0x946393006bad1334, 0x039c493a74358b17 },
+    { 0xcbbda68eb9b2722c, 0x042f1d14ab5dcddc, 0x8115120228362cd7, 0x38533016346c7c4b },
+    { 0x3009b21bb2ff038a, 0xb8562d42865c44d1, 0x7a64a278116e4953, 0x153d0d59492d3d6e },
+    { 0x89bd9122251208c9, 0x6269a397ecc3bdf4, 0x37719808970c71e8, 0x1bbf7753a9eba7e5 },
+    { 0x3af6c2ab363509b7, 0x2820b83038a3098f, 0x97d5636a1d6442be, 0x3692bfb319012e39 },
+    { 0x62eee3989df7e04f, 0xddf9ad884e122025, 0x2a443b27f9460d4a, 0x1727aed852868a8b },
+    { 0xff5271d0e73a8223, 0x21e2a8ab0e0a1323, 0xbf42ddff9201cc19, 0x19941560300f7460 },
+    { 0x7763cae39f370665, 0x360ed2cebadafd84, 0x1d9cca4b92ed3182, 0x14580f7b3d374f84 },
+    { 0x3a46f1fee1800aa0, 0x920c75d5096deae4, 0x8b19f75d13fec0bc, 0x00be6b0af190d1fc },
+    { 0x38c03077bcae6827, 0xd6be2e5d10d78c98, 0x46478aebc8ee96f8, 0x3c3f1261dc1b07b3 },
+    { 0xa20b111aceda2194, 0xc6c6dabf9e47d0e2, 0xa4795590e7231a36, 0x277c053cd757f51b },
+    { 0xfb83179d2fee2275, 0x50dc3c794d54737e, 0xd6fb5680eadedce5, 0x0f36e71bbb8b2e0e },
+    { 0x1de36fc8323f67a2, 0x3d185a289d94c962, 0x2aafffe76c493846, 0x0de0e3b4df10ec29 },
+    { 0x1a06048043317345, 0x65ed4fb6fd46a790, 0x643b5ffa805eab33, 0x07db66cb0dbbdf99 },
+    { 0xe32e73b45fd84e82, 0x5448d0271ed50381, 0xd5a7bd41867a61d3, 0x3c1467f9a18dfd64 },
+    { 0x07e9a7a66c08d44a, 0x47b3beb8924a27c6, 0x99210e33b580a7d2, 0x2604da4659e6f461 },
+    { 0x8905d71831bd341f, 0xa42663a585eba0a3, 0xfbdf9fdc28ebfd98, 0x39e66513620df6d2 },
+    { 0xd5801a13d1aed2c8, 0xa43d969c0ab5c581, 0xa9bad6fdc112ac22, 0x242b01f594c4b611 },
+    { 0x8569305ebdeb6b28, 0xb0811d232a305891, 0x5c290a0d623257c8, 0x27fc9de1b415f1cf },
+    { 0x86441a1d1b0499af, 0x8a15ee6fc39dadc4, 0x178476f74b2f7cfe, 0x31de5251d7214ffa },
+    { 0xf2280369856e9932, 0x9ba3087b30352b89, 0x5689120ebb0ceb04, 0x23cf6adbdecffedb },
+    { 0x482fb4754b524f44, 0xc4592c1d16449e3c, 0xf69799548d952ec1, 0x1abd46359ac47b4e },
+    { 0x49a96fae8076055c, 0xf114cf3eaaf3be1f, 0x33239c83605edbe4, 0x09bcd3a4b0769ca4 },
+    { 0x924e485306988520, 0xd8bb6afbdcea7056, 0x406d020effdac389, 0x0f89eb5a4d6ae988 },
+    { 0xb2a7eca4e4a5bef8, 0x76c9b8fc3679c8f4, 0x74333f8c56b2c5d9, 0x2b3f4a111f0035b6 },
+    { 0xde8dbe2981889d32, 0x10ce8e6c3ad40b65, 0x457d4bdd7b5db91b, 0x3893884139aa50bf },
+    { 0xd541dc6d63acbcc3, 0x2da483eeb212c9e2, 0x81b698f76a10e0c5, 0x3ad4445c36a56cf0 },
+    { 0xd288bf4d52ceb49e, 0xbbcfe2336b33a37d, 0x444e8e6dc6315838, 0x02c7dce6a4557edb },
+    { 0xef847f8cfcc70657, 0xc0ec26cdea557889, 0x50159442b6e47322, 0x28afb062a958bdf0 },
+    { 0x98180f2e8d8e7e75, 0x6516fb70cf0b38c3, 0x2d40e99526721b0f, 0x341c22b54d7cfc20 },
+    { 0xe4c0e29ba724a633, 0x3c71890f4fa577a4, 0x8eabff912b335532, 0x0ad1aefa18bad634 },
+    { 0x70ae796b9d84cd1b, 0x861b55e59b8ec93b, 0x393746de4294a6f6, 0x1e72dde630df03e8 },
+    { 0xe90cdc17f225977a, 0x68576db774fbbf60, 0xab7612d39f6a5973, 0x16c56799f37b163f },
+    { 0x07f4128e62be98ce, 0x533485fd533b183e, 0xc21bf873c75c5ccf, 0x3874c905cea9267e },
+    { 0x109551455b8fe509, 0x8eaf94afcf508782, 0x06e307388d854a0b, 0x1488fdac487a08d3 },
+    { 0xf46331ddcb74b63d, 0xf5f36ffee7803e99, 0x945ce9e2f0d7fb50, 0x10a72f0adbcdd9df },
+    { 0x720461dd2aeb2f82, 0x19fce3e51075d538, 0x5d0c23392f779810, 0x30c3c83499677c3b },
+    { 0xb6c907fd0f6e3a66, 0xbb3492fcc5941ced, 0x7d8bca1127bc5c8b, 0x3c9f205cfa6d4c46 },
+    { 0x3e1716aee9871d16, 0x607806ca4416f525, 0xf8942db49352f6d7, 0x01e5f391449967a3 },
+    { 0x58c23498a01055f0, 0x31fcb2d5ae2f2650, 0xb0376144037f9b08, 0x040355952edc7c29 },
+    { 0x6c108a264d7b422c, 0x1b589dce89001739, 0x9ff525be81c46541, 0x0e5851b43da507ef },
+    { 0xe005f3b8ec2b1904, 0xb8ca0fa66e4e3f62, 0x4b952ea2e1e55eaa, 0x0330ed24df59d5f6 },
+    { 0xea5e03ba5eac897d, 0x0e5843001b8be569, 0x208782713546b52d, 0x3ed38372664f1ff5 },
+    { 0xdb7e7956c327b89e, 0x985e797e49ca46b2, 0x06713fb8763bdff9, 0x27f5dda39a7db19d },
+    { 0x4f22826303515fee, 0x815ccfc931e7f88c, 0xea69bfbef9c61cce, 0x06a2a9657e161ce7 },
+    { 0x25ee106f1a3ecf17, 0x30c043a9e1efd086, 0xc2e5ef5f617d62c1, 0x3aac7b96bff78a66 },
+    { 0xd8e07800cd1e4685, 0xb94a0c1aeede0c8c, 0xb7ef9a908aa4f5cf, 0x1b207da945cee89a },
+    { 0xf0440c70bd0018d7, 0x1dfd756449013185, 0x06f23eec1910a0da, 0x2fb420b842c1b511 },
+    { 0x3821e27e2e2d6c58, 0x2ba4295524fdd50b, 0x8ed0a500efe231dc, 0x1eed35a5e4d5a5e3 },
+    { 0xa019c7a21ce1f047, 0x69bf13f0c3c3e7ca, 0x089b6a52b6f7365a, 0x002ea5604f8b7570 },
+    { 0x262d0821b9d70acb, 0x555f0a81467b2894, 0xc5b85cce52e7893d, 0x209eb77b32da514c },
+    { 0xc75508b21ec7c9e1, 0x3626e49dfac4b01e, 0x0d54ae05981b3b82, 0x1cca1e4db0fee7c7 },
+    { 0xe43c2267caf902c9, 0x45553c6988ef0e21, 0xbbf6d832a6ebd7cc, 0x36fc7504f654e160 },
+    { 0x991c5200dc354ec8, 0x408b5a8b9e2c7f9b, 0xc3e282e87e2c452d, 0x3a8f79984484e72d },
+    { 0x77eaf5cab523c507, 0xdeea5865220da1fc, 0xf07ac527ba72193b, 0x046cbf5030241887 },
+    { 0x1ca053d2469a1f0c, 0xd4f341d900b8aa8a, 0x419e43c8ad2c5fe7, 0x24fe4c0d8712dbbe },
+    { 0x7f79cd86f3975982, 0x232cb6c3becccf4b, 0x1d6b55a0b83fcb3b, 0x235f6c9af8d758b6 },
+    { 0x68ad050d137f7882, 0x645d43d5935a0696, 0xf353f6150227923b, 0x07cb8c54ed04ec57 },
+    { 0xd9fa0f1354c922b2, 0xafc5a041ad7a5e6b, 0x0718529a5b0e2d7a, 0x3044a4d2afce05e2 },
+    { 0x3e09f4f192ef6926, 0xb8bb3125ae50b7bb, 0xa46f4f535ebb6d52, 0x11c0936defd7908d },
+    { 0x2f26db3da7fe7552, 0xb60fffad6507cd28, 0x75f349840257ccab, 0x2ea6c592f9df87b6 },
+    { 0x1775c5119b4b02f4, 0x91c77b4c57eaab07, 0x8021ec87dad66bd6, 0x0b77cef00b8284b9 },
+    { 0xb00cc28e35ba66d9, 0x76b90ce9201fa064, 0xd659d0f24c966793, 0x2bf4f8533f9b3303 },
+    { 0x24f483b6f66607fe, 0xcd6d05add352d4a0, 0xa5af8ef1b3745eb5, 0x10f45280e29af1c5 },
+    { 0x7cd98c57684ea9ec, 0x05837864d38940b8, 0x51bbf93ed5301c8b, 0x237841e0488e785d },
+    { 0x38fd1af8b989df68, 0x527f19bc91ba1032, 0xb30c4721a8566206, 0x3a86e316866ccb45 },
+    { 0xc1d5411e3d5cfbc6, 0xb1432e28a4f59fe2, 0xeec626e5d060e777, 0x0fe59a28455b248b },
+    { 0x69d28fd4527d9d65, 0xcce34e763d45cfe2, 0xb2fdf7b8d02090b2, 0x2a849437f95984f8 },
+    { 0x231a6b4f58a300ea, 0x0f5dc98ebd23cea4, 0x8fe3709ee84dbb5a, 0x1784d82b6f54e809 },
+    { 0x37c3de3290345de7, 0x579da11a79ee6683, 0xba80b1b07466c141, 0x32ac0c486187b11e },
+    { 0x0b81e9f541777f8f, 0xddb65be2fbb60ee1, 0x702a7c7f6342f179, 0x1a866bf3d89e5feb },
+    { 0xbc742ccf2e3ec521, 0x09fdfa926710722f, 0x77ae5e654c268b8e, 0x1940b55c54e437e1 },
+    { 0x1f0aff519e731e3d, 0x9d54adf444e8bf78, 0x203263beaf1d3d55, 0x3d1711b99c4bdc47 },
+    { 0x0baeb3df78e2f3a0, 0x08acab210a8deadb, 0x45eb5da018481262, 0x3ca2516b352dab4e },
+    { 0xef6db6f961efba72, 0x75b2640fd8100da9, 0x1701bc767c0d712f, 0x252538b8cc2e9827 },
+    { 0xe60ccc7b7f359241, 0xca0323afa4ac8a17, 0x3685c413e54e091c, 0x346e208829edc5a5 },
+    { 0x237b035558fb432b, 0x022f71e65b4975d7, 0x1c1d390ccbbe7628, 0x22a80d01c9a61140 },
+    { 0x1e92f4deb1fc08d0, 0x4c003cd6634b3a4f, 0x51e8f49e30722423, 0x0aa35b6bb7cd33e4 },
+    { 0x13363b75bf721d69, 0x6d79a1f21071afb1, 0xf7d4967efcd85959, 0x07ca8ba86fc6dbec },
+    { 0x26add2e474fcd69e, 0xb2e949d2d8339f14, 0x1e77892421184bbc, 0x20f69b24b777bac8 },
+    { 0x1704c3540990792f, 0xb7cf965b5613040a, 0xab8fae35e2b60374, 0x0d2b19f4a3b98bb9 },
+    { 0x614cb601db2d6c3d, 0xcbf01a8b4cf89556, 0xe5b1c15e165c874e, 0x23645122a0bfcb77 },
+    { 0x6ddca67968147437, 0xb7c11d6bb0a52c00, 0x949ceed3fafcf827, 0x0eba322a4352b98e },
+    { 0x89a759fecbb3c042, 0xb78987ede7728868, 0x57cd1763d955adec, 0x2ca8abd3fc6359d8 },
+    { 0x333c637fd39b5305, 0x27bf034781f5b700, 0x0b8e07d60ffeec10, 0x0beb5e96ca4e03b9 },
+    { 0xefc0427e677bfd6e, 0x237b5c83b94fc670, 0x1d02e0e03f2e7477, 0x357ad538daed1d40 },
+    { 0xc1530941a125fe98, 0xb5376a29b708096f, 0x53c5128b41d45d63, 0x25e8df7555e48ef4 },
+    { 0x3afcc99a8a41831e, 0x53d5734d93b248b7, 0x726dffdf1c95514a, 0x0a0df82901c01c55 },
+    { 0xfb172fafde386537, 0x3ba92f1da106a6a5, 0xcfbb871dfc86e27d, 0x39568f86ee8681c4 },
+    { 0x4975acb8214cf6b4, 0xd8e32dd948329443, 0xd4d3810ef75d6086, 0x110bbd0306dcd271 },
+    { 0x20fe114880e77471, 0x45db6a2d33c8fb82, 0x3582503f188a2304, 0x0007613989d4beb8 },
+    { 0xa25d8973d90aa890, 0xb5005b00bbf14743, 0x3ecbaff34d0a4ecf, 0x09c6bc568f56520b },
+    { 0xf11bc50e18520ef6, 0x577b7b8fcbb5a07d, 0x381e6b1c6bc7d7d8, 0x0657b02318a7c5e3 },
+    { 0x780fa7a3275fdfdb, 0x393168c003d7de91, 0x13480a278b00ac3a, 0x236aa31be851b1f7 },
+    { 0x1497259bf7b4d332, 0xf1802938208ba53b, 0x2361f84783e41717, 0x1da87d582aa9b960 },
+    { 0xcca978f908a4e589, 0x69b16c83cde517f6, 0xa3e86e6569a3b8e1, 0x1fbddb84c424b3c2 },
+    { 0x45b8f33034773e40, 0xf6e6578fe3861c80, 0x5a7a6c13a21ce346, 0x38f710fe0be4a8dc },
+    { 0xb7e1da9f1cda794f, 0x3713f3347e5698af, 0xac4a33304c1a0007, 0x33957826dae561e8 },
+    { 0x28c83686b2f0518b, 0xb232600bfca2d334, 0x70d556cacdcd6706, 0x0be0af90471d2113 },
+    { 0x731f50e4c9ec358d, 0x7647e06220325e1a, 0x1cc6c22e03af1e0c, 0x35a05bd7a7573db5 },
+    { 0x8ba9c5db271f4d51, 0x159cc2e5cb59e79a, 0x321e690bcfdc68d0, 0x2e58802e8d83e49b },
+    { 0x3f85bf1ebc45d65d, 0x9b2daae184a17753, 0x3844b9ca465a7c0a, 0x30908d7b2f580a98 },
+    { 0x824e5585ebdbd073, 0x1cb4da8c3cb4a9d5, 0x9f6222c106a59597, 0x1435eaddd48287f3 },
+    { 0xa45fd5bfbc1d248b, 0x3aee3542949f0407, 0x4c1069515b3e36d6, 0x23e0301f1c8eaf22 },
+    { 0x5347209002de64c0, 0x2593e54901e2392a, 0xb418394fee5a11cc, 0x264d751f7c4c8bf7 },
+    { 0xebca2053fa4066d7, 0x1491e243fac9235b, 0x5ad11f6cc6c3cae3, 0x3b65212fb600bfd5 },
+    { 0x5f134f8c479db1e8, 0x8ffc25a59adfc35d, 0x46587ce7e1ff0e5e, 0x353b2280e177f198 },
+    { 0x4535a33b02dacde7, 0xf31d047e3eb488a8, 0xa30c6cf0e6f31ed1, 0x25e45a48d2ae1b9d },
+    { 0x2eb686ccda2d32ce, 0x9fb47dae7b50dbcf, 0x420d37ee04fe3d87, 0x0bc483e3ab127ad1 },
+    { 0x29dc2bc7157d5d42, 0x759552d525019704, 0xd91a363425ad4e52, 0x0cf2ca568a76e531 },
+    { 0x97ba98bbb708e3c4, 0x785b6ca6d0a42927, 0x60fed4760c07653f, 0x2fd2d9c3ce049cff },
+    { 0x9183d47545b2c033, 0x4bd4f337a9c9bda7, 0x065f045fa632c5d2, 0x00a1e7401edfc631 },
+    { 0xcaef69ae7c3cd9ab, 0xf652857fa0ae4245, 0x187a5de155cdaec9, 0x2bd3f0513f7a2244 },
+    { 0xc139d7705209515a, 0x6afbd9ec6beecf0a, 0x2b93e1ef85449591, 0x0607e7978962a49c },
+    { 0xdd8452d46062aa09, 0x1ecbc71c559bc301, 0x26374d7980371221, 0x33d90a2ae0bab674 },
+    { 0x57c538f13589e38d, 0xd1e713873081a8fc, 0x9e18b1018458c9d0, 0x2c883464e40a26f4 },
+    { 0xe3d96534307689f3, 0xe105b1785bf20721, 0xfef40e8ea91f3d14, 0x3b7f2cf4c1ae5bc0 },
+    { 0x5b9cffa1b05d40c6, 0xcdee193fd605d5ec, 0x5306e71cec9d0970, 0x3faa60888bc6874c },
+    { 0xb87b23da6b269680, 0x6f1df5a1595c06bb, 0x05e86df1bbc97dfa, 0x357c1577daac9bf7 },
+    { 0x04b730b5ba8ebb5d, 0x06ad9407d5fb3ea7, 0x873d6ba9b6b13896, 0x23130688b8fdeeb0 },
+    { 0x754236bf88476886, 0x3f941d4f25f14f30, 0x281ec1ca50b6d9fd, 0x21fc4dee630ee7cb },
+    { 0x933cf0dcc746138d, 0xd9bee0afe7ba268a, 0xf618c80c7b51a42a, 0x1ee97f41fb1a72ab },
+    { 0xec17e4f41860b7d2, 0x55b50b60eb2a208b, 0x6d67d37da3732a1b, 0x06f00d69216db8d4 },
+    { 0xa05916fb28647085, 0xa1665d8bc0800bc6, 0x4549999a07909401, 0x27bd071b63863c55 },
+    { 0xcb424373f2ab89f5, 0x89af85230d6038f5, 0x580d74a63c42f15d, 0x10a8cddf23bc8178 },
+    { 0xe55e65872a257672, 0x50a989a48bd5661d, 0x6b1338e3480ac480, 0x08ae6681cd3639ed },
+    { 0xeb153bdda818e9b0, 0x43f6f0f53acedc93, 0xda0ade57a2173aaa, 0x129cbb83f8ef4506 },
+    { 0x8ca506dfa52b1ec9, 0x68834e094ef26f36, 0x4a07732f012162d5, 0x1b7cdd9cb50fbf25 },
+    { 0x8166596c41198afb, 0x02378943503f07a1, 0x3ba8943ffdef21a9, 0x2f279da50ac8f105 },
+    { 0xf83bacc0e58c5819, 0x8c6d0145a6fd8fa3, 0xfc9d3fdd30a9da18, 0x1f659c27bd308527 },
+    { 0xcc441846bb39a656, 0xe66bb6bb6d01e515, 0x83515f57f70190a8, 0x337197c5a9a8d656 },
+    { 0xe378b64900941271, 0x8c1e1cea3c92be1d, 0x657eb77444548083, 0x02ac5c1e50a7f6be },
+    { 0xefaa9e3e62d473f4, 0xc7891850927922a1, 0x8ce560e36f6acefb, 0x03acae630dfe449d },
+    { 0x98f934fc4e93ce30, 0x82f80b376aeb5a03, 0x1d18ebaa53e29c1c, 0x1095d5b034f056af },
+    { 0x64a957e1f9c36ad4, 0xeefe9461a8b40ee3, 0x1c6314650b9fb24c, 0x289f1a1a1c2d6d97 },
+    { 0x143777fe86e070d1, 0x38eceab74214e444, 0x5d7e9abddce4c20a, 0x0f91aa38897e2e38 },
+    { 0x27400c56818f6c47, 0xf7468879beafb7fb, 0xdb46eb026907ea12, 0x054c3987efb54214 },
+    { 0x0424b558ed13d8c2, 0xba7e9134b4198bdf, 0xbda9702c38784c2a, 0x03a3eafe964f80b5 },
+    { 0xd8521b470c4ee82c, 0xb5e4f94a27050e9e, 0x8878c7df613936a7, 0x06f25f6788766be5 },
+    { 0x455f635f4c4c433f, 0x50c633b8551f9739, 0x6b48a1b6b8604024, 0x246027c28a0a7319 },
+    { 0xdf420228138247b4, 0x654194b2818571b4, 0x0df5a93e7b7b166a, 0x391a5be28f21900d },
+    { 0x128741139c9fb9e5, 0xed2d0aab71b4f269, 0x4ccb696870c9f882, 0x103f4fd6af41662e },
+    { 0x1c57c0e91cecba6e, 0x7045c646bd07eca8, 0x23c64c02b23567ff, 0x0813f13373685bfe },
+    { 0xe2f82844849187ce, 0x7075e80b431725a1, 0x180bc5763d376afb, 0x2b08a06c0a141f54 },
+    { 0xcf94804c5f19433d, 0x4840ccc34f8cfa3d, 0x5bc4628976c5cf9c, 0x2c1c2f69e69d5ccb },
+    { 0x2f5f4b34b4a86dbe, 0x60eb4c5fb90fcceb, 0xdb2c2f7228d631db, 0x1e12a83a3a5ec33b },
+    { 0x90bac25f00bcfb57, 0xefe9f7ba7e52ff4f, 0x39fc1d817f035e77, 0x1d26cfd32c9d92d0 },
+    { 0x02a493b59e9b674c, 0x83d4f0e3ac084f8e, 0x3bdb78cc584d9c4c, 0x2a4867ecaea5893e },
+    { 0xfae19968ac01d227, 0x579b91a0f27a625a, 0x4c1b2bdc9e7ac09a, 0x3b9603fdd8ae111d },
+    { 0xce16d3ac9a13cdab, 0x865e146a1188d4c2, 0xf000040de61725ec, 0x07103bba9d88439a },
+    { 0x983ea372c8b4011f, 0xc4751a45c2e63105, 0x53224336240e9b9d, 0x2d8cf9f565c721e9 },
+    { 0x59a89d9a476e8839, 0xb5bff67a7c6dab7a, 0x474f660ea42cbfbd, 0x01b8d19a5aeeb956 },
+    { 0xd770dc53760385dd, 0xa43c6d46a12396b6, 0x8afa9e8214c0f7c1, 0x0c1b23641b3ac723 },
+    { 0xdae121dd46191fcf, 0xd3d8eb4fbf2fc089, 0xf0f2a89c56832c0e, 0x3fb51b8960d29a16 },
+    { 0x822ac791d904652c, 0x74ad22ccafafcb56, 0x152f0edb56f74d73, 0x0af28a01fd16dd47 },
+  },
+  // g^(-j * 2^8)
+  {
+    { 0x5b2b3e9cfffffffd, 0x992c350be3420567, 0xffffffffffffffff, 0x3fffffffffffffff },
+    { 0xbb46ba275a79fe4d, 0xb78f9dc567f45c8a, 0x194a5257e74dbd52, 0x0bcc650325c5d688 },
+    { 0x18b39c0266a1d816, 0x3d3100214696a7a6, 0x5a46979bc39fb309, 0x10a909e2f3662567 },
+    { 0x04e11cdefa622dc1, 0xbc58be3361277550, 0x32e2eff42c3cefb7, 0x32f6891d2f6320a0 },
+    { 0x78d4de6ae191382a, 0x419113246b406379, 0x7595a5755af50829, 0x2b8c65d7d893623c },
+    { 0x5cd9614c0516af13, 0x89e8f3028ea484b5, 0x0d21aa592ef5f2e5, 0x1d8c1feeadaa4ea1 },
+    { 0x3d805e776c47d5d9, 0x90cd909d1dbef23d, 0x09675b09ef8bea9e, 0x0840cc71b3d19063 },
+    { 0xd8dac3fca667c6a0, 0x7d54ba61276cc309, 0x022ee8695f0e4a73, 0x1921a1794a4c05ac },
+    { 0x13d00b9807804e04, 0xde52cd351bfa70fd, 0xf08499fdf08dafd6, 0x1ab7133ddf5bf5e8 },
+    { 0x097d32d90fa0a58a, 0x4e3b07085ee43afb, 0xdcbeecfe321e7ccc, 0x0c58c49799f9035f },
+    { 0x4b1cbc63e0af18b5, 0x857f0d3cfd3d6bd4, 0xf2f7828eb4e4362d, 0x3fc4d1deb3d30475 },
+    { 0xfe7d13a86bb3267c, 0x8169304c4bdffa45, 0x32bdbcf932aa9297, 0x0894533d5936b100 },
+    { 0xfa67b00c67e0faf5, 0x5b6edddf8a73b770, 0x12f4e0ef86da78ef, 0x14733d0def2e6873 },
+    { 0x8696ee8e5133b1d3, 0x7080c95641da24e1, 0x2bf1a1821343e482, 0x3a5c354fb7f43956 },
+    { 0x51085acf57312697, 0x05a6ff95a811785a, 0xa0cfcc663c167058, 0x0c62a6b29f14eb0a },
+    { 0xdf0c9facfece828a, 0x9fd1a317ec08d343, 0x15e5bb47a5a68d4f, 0x0c92c02830b16721 },
+    { 0xeea86d0aff815435, 0x3e82efe633774f61, 0x3d76869e12bd1c6d, 0x1b0bab216c708988 },
+    { 0x5d667bbcca67987f, 0xa6226e9fe7eb9e4a, 0x5fffdb388af867d0, 0x0ae79c1160403cd4 },
+    { 0x2f468fa1c71c4251, 0x64a3ee9722897ea9, 0x4045787c96e32f94, 0x15a25d025ffffa72 },
+    { 0xda02d1ae68e87856, 0x2a1efae8f29a59a1, 0x1a1b0dae9adb6176, 0x0699ff79874f47ca },
+    { 0x33d47c5be709bf13, 0xffe2220a84478a58, 0x99a68714d4e56536, 0x3cc4a2c0bce19a5f },
+    { 0x4dacc0829d4a7f9b, 0xb4a801bf0074952a, 0x041c07639fd8c344, 0x375cabdbbd4f7aaf },
+    { 0xa0d4ae112b5eb709, 0x3efa224980545ac4, 0xd05322649ec3ca50, 0x39423476b59f9e39 },
+    { 0x473590bb01634ce5, 0xb64899afe5b161e8, 0x595b3a06ea57afbd, 0x187374d82289b161 },
+    { 0x97e9e97ebf4d3276, 0x74c4b87161c3753c, 0xdd7b48b60b4c4b94, 0x23c4f78ff8675193 },
+    { 0xf44bbaf668c01cf7, 0xa7dcb990f91c53d1, 0x3dca368245908546, 0x0b4124b0d9f6ba72 },
+    { 0xdfa1ca75419adc24, 0x7e5b9ca2c6078ab4, 0x0e37ffc0973efcc0, 0x2126ac803361ddea },
+    { 0xc47073f607c563a2, 0xa455f2b18f2a7871, 0xb1c6be163fb577b1, 0x0e6bcdd00ee1a23a },
+    { 0x219652778a73856e, 0x3227251921458995, 0x75b8d785b0efbe60, 0x06623da0e53bb317 },
+    { 0xfa4589a1db2eb231, 0xae532cc37266cb8f, 0xf677ac053d4fd42e, 0x20459d71689876f4 },
+    { 0x3d1ddbd41e3c5bed, 0xead7854009ab4f40, 0xf3fc853b3984a1d9, 0x369e7a066529aaf8 },
+    { 0x19c7f8694d567d61, 0xbbe9f623fb6efb10, 0xc70f080479ca3f05, 0x374fadb414ac8693 },
+    { 0xbf77594f48aaf3f8, 0xf962581c4c09b2bc, 0x9edd9f4c3dc6b1d6, 0x0ac09c997b9c21c7 },
+    { 0xca0d38e9b4e41ea1, 0x79c4d935fd7bf86b, 0x196f3329d140ef95, 0x1f23d0c776f5f9ac },
+    { 0xa16f9c4cec9cf459, 0xb987cbca793dcb7a, 0x1fe78470d26cfd3a, 0x1f97b74e90661040 },
+    { 0xcb375ce5a61d8a8d, 0xdc41c795df16dde6, 0x1a2dfa197ded2d4c, 0x0a9ec74baf028c7b },
+    { 0xddd6950692b8755e, 0x4d108cddb4918283, 0x94b92be7d19ba6e1, 0x3066b2058b6501ce },
+    { 0xa1cabf339e36e60f, 0x009813234257ab70, 0x35e7d737ea2f0a4b, 0x321a347ba346eb09 },
+    { 0x773c0107c01f3cad, 0xe4cb3ed82a09545a, 0x43370b40b0cbfb17, 0x2f50b1d35715a818 },
+    { 0x445fca6ad8f11bde, 0x19f449f992b07bb4, 0xdb9170c13037c6ef, 0x1088ab2095dc91d5 },
+    { 0x4c67b38e5194d18f, 0x0f28cfdf9ed64094, 0x5147cb2669ff28da, 0x2bb9d005411ec9ef },
+    { 0xc4eb9e8de324087f, 0xd502a00af71c7da7, 0x32cbc7465dc19303, 0x26c7cacfc9fae624 },
+    { 0x41aeaddafc47c192, 0x863b64cd5fa95c34, 0x2f5e8031d59e5346, 0x09bc7775082a5de2 },
+    { 0xdf49a9a887ec61a1, 0x9c341957ee7dbae3, 0xbe61fdcd2e27a2d4, 0x1433030b528f0d93 },
+    { 0x7b143446456c4a5b, 0xd27ccd4055c8a22f, 0x53b0164c33262419, 0x272f75ba8390c5cd },
+    { 0xf9d778f6409f111b, 0x48e144e44aa06815, 0x67345cf83b78b0e0, 0x292fff88b3e3997b },
+    { 0xb3a1b0dabef9e557, 0x4f82c443963405cc, 0x054801dc0708ab52, 0x03f69cad122dd5c6 },
+    { 0xf4a6f67bf780fb6d, 0x0ee2a39b88514f96, 0x11f1958e25abb543, 0x2478b28f8cd0e488 },
+    { 0x4c4af907d3646be9, 0x9df0d01c201a21e3, 0xa40b131064d8cb36, 0x34ee110b0ab801f3 },
+    { 0xca33ea350be79d4f, 0xacffe9ff6b551881, 0x9133b8f5f8dd94f7, 0x2cedb00fc6c61531 },
+    { 0x924b112779cd41b5, 0x99fdf9773135875c, 0x8bcf65cfcbc84fcf, 0x2e830b95d5adce3d },
+    { 0x2cfd819880662e18, 0x3ae2a24024395d33, 0xfc785aebf96675b4, 0x00e395d300329219 },
+    { 0x411c567c1945d326, 0x5a1170cffb60eef1, 0x886bd1385f616db2, 0x07c62b02129458a5 },
+    { 0xbba53af7ff2449c3, 0x66344e83588d91d5, 0xabd1e0a8bf524bf8, 0x2d76d10d2d77e746 },
+    { 0xb16548b82cc98ef6, 0x363ac531010b4fdd, 0x811f99088de222b6, 0x0d4a58b41669ac45 },
+    { 0xaa9f7e7d774c8841, 0xa200dfd23f634136, 0x077527ea5a6a5c78, 0x1716c6d56c8813a5 },
+    { 0x157e8e3a418dae18, 0xa0368ee5dd967806, 0xf0a7965aa715f4ce, 0x378a2d9facb6a6ae },
+    { 0x42f1c67e5c7a0597, 0x9c7ffccc2fa643f4, 0x3657867404563404, 0x39004e17f37ee977 },
+    { 0xced0b24be2b32c1b, 0x6735d6c223434751, 0xde3674368926edb4, 0x298b43f3aa5189da },
+    { 0x1b4bcd18ddf98568, 0xfb0e4f7999fa63ab, 0xd3380bb6f340db83, 0x23c16115cd18593b },
+    { 0x535753a72103f8b7, 0xeb774409db609a45, 0xb9bde9ebae9460d9, 0x22219e70fc5100d3 },
+    { 0x9f6e1782daac5be0, 0x3f30893b7b3f8e34, 0x9d79f52226057d7e, 0x32c9ae2f3d808dda },
+    { 0xf8ddecf62a4d844c, 0xd9311cadc98d77d8, 0x5e717e8a6e304b2d, 0x0e030475e8018885 },
+    { 0x6fd288489f4c43e3, 0x5d799360b2b3991e, 0x2aea1e83f4fe234d, 0x248fdfdf300444a0 },
+    { 0x2d1cd35939c613f2, 0xa74afe707adff7dd, 0xed4b3166a6519478, 0x3301dae688661f71 },
+    { 0x5b0e7792ac1901f3, 0xfaaee01049cfe82a, 0x3466d6872d038f21, 0x12290bddd7e3a1d9 },
+    { 0xde2a3797e16a2654, 0x031c54e570c031a8, 0x6c87ce058351da00, 0x28de91a98c21fc3d },
+    { 0xf3c18ca8f95070ba, 0x925971f955374889, 0xe5a40f7a3585b645, 0x1c0190c7aed5ff26 },
+    { 0xf290263e047c10a6, 0x4977eb8c70f7b748, 0xe989a08f73a597c1, 0x24b38062629f0745 },
+    { 0x0f861fda137e0243, 0xd4afe45e91e1df1a, 0xd877cf7e0533f2df, 0x237b060aeec41592 },
+    { 0x333b80e8a8c21bef, 0x09de2dedd710cccc, 0x41d23190a38684e7, 0x30ac5985fd25c4c9 },
+    { 0xafef4166f28b7c9a, 0x800eed7db7cc93e3, 0x8e6e0d2360d2fbff, 0x14531593dab6f1ea },
+    { 0x288744fc41ea09a7, 0x547e50cf4d7a5ce1, 0x2d679e51fc35ef00, 0x37b776abf27357e6 },
+    { 0xe248868bc0e39d2a, 0xd89c74889a0f6be8, 0x5f709e379e8ddb50, 0x117bce59e78bf1e2 },
+    { 0xced5aed9c5ec2dbe, 0x36f69b0d43fa1985, 0xc2f1b1ff977bd8c6, 0x2a81255f5f87d71c },
+    { 0xa511a04b4005c1ba, 0xf5787dc4cea2df79, 0xf80172c312f2b373, 0x0d3f1a48f3443dcd },
+    { 0xce5358eea1e27d92, 0x0b3a99f5284a8767, 0x3897db88ffae26c5, 0x15b21251d24645ab },
+    { 0x173e1f84f07ea242, 0x83fa5d9e718bae16, 0x78abbfb523f01375, 0x38e06447303f0491 },
+    { 0xcbab0fdd7bead180, 0x4f2340c8329131d6, 0x3d6c13dbcf9d24d3, 0x1965770a3e505f64 },
+    { 0x13975bb6199fc0a9, 0x3703767f6300dc70, 0xa926cc94c5688bcb, 0x1ba21fb580b14302 },
+    { 0x41498b4116a37f3d, 0x6bbc802820a68301, 0x0fc7412578a8025a, 0x31ae459c0bd097b1 },
+    { 0x868fbb54f08d6c7f, 0x5f6953b2a42c4225, 0x010519dc4c0380da, 0x24ce758fef18ae5a },
+    { 0x042451de4cec5f8f, 0xfecb91c745fc1825, 0x1b03d06e5d831cee, 0x0df313d3128832af },
+    { 0x5ecf18380eee8286, 0xb52e724321a5516b, 0xbf41737ba8f44227, 0x2bde2519185eb7a0 },
+    { 0x0e1fb6e3b7b031d7, 0xa8320df73aad11e6, 0x80591eb9489d64bc, 0x3ed7c8c43c16ae6c },
+    { 0xc28d3abc8111ecf3, 0x87be6e8aa8d22d49, 0x84dcae52418331bd, 0x14e1029f67878afd },
+    { 0xe4cb07f991f2d7d4, 0xb44b2e3a311fec78, 0x452948d59562d3b1, 0x11153c8dc0ea2d82 },
+    { 0x86ecfccb59cf963b, 0x48218de5a27067f5, 0x8958ef8a35cec4c2, 0x184112a812a7f079 },
+    { 0xd845d7f3321de6f4, 0x3b08f7bdff8c9f1b, 0x30fafadb66bd1a10, 0x39880a52847b413c },
+    { 0xea6e699f1be85905, 0xf620a23d84623a2a, 0x8d57e0229a69fc50, 0x2452c25aee52d3e1 },
+    { 0x101e3431f5da0c01, 0x36d91de1bf39a9a8, 0x069ed4e8c255c125, 0x08893c4fba93b433 },
+    { 0x5e2cb42f0793e824, 0x6d8d7554197ee8dd, 0xb348cfb7e45bba21, 0x0e327807204357bc },
+    { 0xb70168b27263198a, 0x2034e21007419822, 0x4b9f5d43e4fd9ccc, 0x0a4cc10c7034940e },
+    { 0x90582a0ec63e4af0, 0x03349db3ad874612, 0x43fe9c711b21d4bb, 0x113d62ebda82e5d9 },
+    { 0xa68ec62c694bcfba, 0xcfa131d2756d6703, 0x3a1b27e0d50ed241, 0x3265eb2cc506d03b },
+    { 0x48a4ba9d77aea096, 0x25d741c840cc8e43, 0xfa6a39f37ee8478f, 0x0a8ea197a1ece469 },
+    { 0xeb210906c4e25b12, 0x037e84843b0481e7, 0xdb10ae1a4d2214c4, 0x286a63e3980a7514 },
+    { 0x58a3150a90b15e74, 0xe141edb657bf70a8, 0xf4fa08f66804fda8, 0x3d9a57175f4f3841 },
+    { 0x47c690d38cfc9b60, 0x2cef0b37b97bf3fc, 0x6b6b68095234e48e, 0x1598fcc837698ad3 },
+    { 0x4f0df562cd22264c, 0x95727d4a8bf9b8e5, 0xef99dd33a15c5578, 0x21f20511073890c4 },
+    { 0x66bc4ff6e5cbca73, 0xe120e97e227e5a97, 0x33c20ffa008df1ae, 0x35f0990f049b76d0 },
+    { 0xa4c722642b264800, 0xef5b9c20767efbb3, 0x2683d4fbe6ddd772, 0x23dc107597ad48cd },
+    { 0xac984c4f8300ab30, 0x60e84566dc36536c, 0xb409e7a6e0574062, 0x2cfefa8278fae1b6 },
+    { 0xb53df107352f55ee, 0x0eb2f52e6b7d1ab6, 0x7352fa0e515e5f3e, 0x122186cfc558d301 },
+    { 0x21f02a1101793129, 0x6db06a02542ee43c, 0x1f5b3f3a6d66f1b4, 0x01d0f1c831a292e8 },
+    { 0x314eb53b892ec57f, 0xbe4967ede776f372, 0x55ae0387bb933f45, 0x17db6f63da991607 },
+    { 0xd8450364351d119c, 0xd82bce25e333c10d, 0xee1a7255c0c59288, 0x15ed1684717d887a },
+    { 0x09ae252e2fb12fec, 0x3ac8c188364c8457, 0x404d3f75bb99011a, 0x00fda1d74e5c3fd0 },
+    { 0x07ae32d602d69400, 0x4799c1877bab5427, 0x73941d32e04bc6bb, 0x01bd83ca61b9616b },
+    { 0x0f42445563835450, 0x2302acad508c37bc, 0xe385bed67d8fe11b, 0x2b0799b78cdd25d3 },
+    { 0x0b1074ac8ab8780a, 0x305534f77cfc7203, 0x0079a999cb907bea, 0x03ce9c5032867c6c },
+    { 0xb85f6c27f7ab7d06, 0xcfce4df035ef6bbf, 0x6555e3c4f9503cfb, 0x36f561d82dcaa809 },
+    { 0x06851a43aa26dde6, 0x7bb02f4d735fee43, 0x0657a814ff82001a, 0x17e6e2088947b50e },
+    { 0x5ca347d0cf21b9a0, 0x938273cb169e2af5, 0x3111cb59095614e3, 0x3d96ce606c872b60 },
+    { 0x4dacbfe0638204d3, 0x39a8a2d8d81bb87b, 0x2455814f4b84c9bf, 0x184b94338b5105b0 },
+    { 0xf47a568c1dfd5e4a, 0xd698364c5ea442ed, 0x5e8cfee17a4efd6b, 0x24e29497c05d4db2 },
+    { 0x45fbd59a3ce19f52, 0x458cc3cd6c8dfc99, 0x513fc240df00985e, 0x30c7a8821bbc7653 },
+    { 0x751fe5120b1f5bd4, 0x5b4b9ce13511dc82, 0x2354603c187ea68c, 0x3b909c0a49dca0e0 },
+    { 0xde59c0e3820102e2, 0x49d65260b110c029, 0x8fb0ff123aa40923, 0x35b86bb25aee55af },
+    { 0x82792b76fda6d002, 0x932e7c2925950cc3, 0xeb7f5868f2e17763, 0x3c36225d9d2a7b4f },
+    { 0x32d86e619d794807, 0xad89c83fb23eaeb8, 0x5cd4b9a20443e5aa, 0x0888eb8c11fb8dc6 },
+    { 0xd816123246bbb311, 0x90a262a229a14c7d, 0x6f8ba5c51d9239f0, 0x337dfcc57f27812b },
+    { 0xa1d0715dc90423b5, 0x5ca8a3ee18d915c6, 0x703971d9b6bf64df, 0x32957cdd07fdc0d6 },
+    { 0x3a2f41ccb3685a37, 0xc83fb68a8a98b6df, 0xff84adc2da2d1505, 0x398ddd6c1fa408d8 },
+    { 0x9e4ba7b7d67b57c0, 0xe0b1123ecd122a7f, 0x0e77fea3d3bac6a0, 0x3a46514e466d760d },
+    { 0x8deed94468869fac, 0x2581a71ee6a3893e, 0x3ed3dbf78bcc42f0, 0x243289fe938729a7 },
+    { 0x75339aec637b92c0, 0x89f2260fd07a2803, 0x62d8a03140a60e2c, 0x2f4182c2c4f015ca },
+    { 0xabf94fd870ec5990, 0x5ec5a8b4791da013, 0xd84ffbd731794ef7, 0x1289561a1c5ccd12 },
+    { 0xbb71b426af9472c7, 0x3a4c85a6880ef684, 0x9edaf018e80ca342, 0x35c8697459d4c59b },
+    { 0x81466b77601d636f, 0xd1ea2922331a6e68, 0xc48a4a9618655b15, 0x219f73680656beed },
+    { 0x5b23e59351708b96, 0x674a131e6507cc87, 0x24cefe1f1ce5dcd5, 0x231812c962c17d01 },
+    { 0xfd515b170d00a0e3, 0xf122f4915c72c225, 0x99d38d7ab07b7e0e, 0x3f049f59d0177567 },
+    { 0x2d3f614ae92084c4, 0xb5b8aacf59e5b202, 0x6c14d39bcd62c198, 0x37c56ecbe2fd087f },
+    { 0x0a4601ad30232f65, 0x7d44bd0f55b4892b, 0x19f89ab8a74b8e6e, 0x039a9fbd644aaf80 },
+    { 0x21996e2ec094faec, 0x17f513a157f155ee, 0x50f5a2d7026a4bb4, 0x0f911e63923839d4 },
+    { 0xf03cebc074927eae, 0x9ee3c84fbf240ace, 0x33337a9a5f861532, 0x14152d1241c0082c },
+    { 0x05871750ce6aff52, 0x5c4336e974d91461, 0x428f0809d8382f37, 0x009dbc5933fa3ec9 },
+    { 0xbde15c83786dabf4, 0x7fc4d6e79955900f, 0xc5e6eb668247c400, 0x2a36e074417a37f7 },
+    { 0xb03ade1f441ef941, 0x6e99f88556b9dee2, 0x742bd9c6ca748bb8, 0x0c51504b5e2cf62b },
+    { 0x701d9cd627bcd6cb, 0x5dffbcf9d811d820, 0xfa6f579272654a43, 0x3e2d3a581ba330fe },
+    { 0x8193daf56225f479, 0xac51857d14a9258c, 0xdecc19a5a49fd443, 0x297bd915f52050f5 },
+    { 0x2e4ebaf392a0f070, 0xe86e81a13d42f9b3, 0xbfa887ea9e05ab4d, 0x05ab765e44bf5244 },
+    { 0x8cbd5d61ce527c7b, 0x1e3c9b021a87cb2b, 0x815453a10935c5e2, 0x1a11520e3304f71f },
+    { 0x8e067136f710e9ce, 0xff83e8d4aad72dd6, 0xe0cb1fe91cf4db05, 0x094077e5bf9b8946 },
+    { 0x50bd7080a2eb33c6, 0xca356480df68eadd, 0x9b6362fc71718064, 0x121195d04b183037 },
+    { 0x203ed288904f9703, 0x7eb949a80ae7ceaa, 0x3e95a8fb549d903c, 0x0ed71a713c66d7d4 },
+    { 0xa14e51faa5f01117, 0x2d9b6e5cf180cebe, 0xa814306e9be5884c, 0x255bd9a24a0272dd },
+    { 0x5ca8c2e604d9e0eb, 0x26c3117fe288a4f0, 0xe519b60caebf6499, 0x0d461538e1ddfa74 },
+    { 0x939d94d63fed36d4, 0x1cec41357f709cfb, 0x597e01da3a8575dd, 0x29624c3edaa31188 },
+    { 0x5fd7f71327392329, 0x27ac4afd98042fac, 0x12d0fd00f8b32088, 0x129b22971b91f70f },
+    { 0xcabb4cfbe21758ea, 0xa25e3c939fe9115a, 0xcec369de25507f64, 0x244abfb183fae8bc },
+    { 0xbe9c892a8ef55cb4, 0x3ff3999adaaea37d, 0xd3c727ad97def2af, 0x025766bd5b97516b },
+    { 0x1373b3f6d3d95420, 0x6c71d4aad5de1e39, 0x4015e7ad26cac9bb, 0x1a4a0dce5f0158e7 },
+    { 0x413cde7f55503487, 0x6a7d59c0b60bb7a7, 0x63151dc4a440dcf7, 0x27ede10cdb38382c },
+    { 0x5333e6de66849336, 0xd112512fbf580139, 0xdeff7cf0bafa5adf, 0x108495a1524a4315 },
+    { 0x205405b3ced07e15, 0x10ca18b3e4787ce2, 0xbc5d62f75730f945, 0x2d6b2ec3cc0fbe00 },
+    { 0xea3a025c78536596, 0xe0cd9fa72287526c, 0xaebc528d626c1416, 0x3f40c789837b7100 },
+    { 0x008d351a16072557, 0x28eda65e09d684db, 0x9826a969020efd62, 0x1cfcacff95bb42ac },
+    { 0x2d346b8374263231, 0x71e2d5e9bf1896ea, 0x2cec033b83db27c1, 0x2b51ba6846185319 },
+    { 0xec2b5c258b5564bd, 0xd0836fc79740b0df, 0x0aea7caa1fc7ea39, 0x3ff2534bc24b858a },
+    { 0x25d2f38f1778264f, 0x056f85e3c4026179, 0xfe31c33879132217, 0x36626b753cb9300c },
+    { 0x418b982c8412d75b, 0x4cd77d5adf1215af, 0x6f93c82498a4f4bf, 0x1cce580d76100189 },
+    { 0x6b4fb7b87825fcba, 0x52676b3910fbcdda, 0x98f46136aaf4dd13, 0x338d36fec139b8c5 },
+    { 0x581f80ce4b2fe769, 0xf8d26255c99fb956, 0x34264639af061d10, 0x2b4188856eab29f8 },
+    { 0xed88f2ddc73e11af, 0xa56462db32025625, 0xdeeb575e07c0ef54, 0x29778b1ac4e5ba00 },
+    { 0xea9a2a23fd4d1df3, 0x981813c5b30efde3, 0xa41d17b637fd9cb7, 0x354e4baee2554084 },
+    { 0x39d28100436752dc, 0x729db50ced1181a5, 0x10787ce009a2e8f5, 0x3e9d10849d827098 },
+    { 0x36437812cccc2be8, 0x8051a42c029d255f, 0x72609404354f3905, 0x17804a51d15c30d0 },
+    { 0xba7e61981315f384, 0x18fb1e0e8b93b9d6, 0xfb467c6ea5f24147, 0x1317ddffc4879b06 },
+    { 0x463696bd7f64d673, 0x59b9cf636c0f88eb, 0x1cf18c4fc294aba7, 0x3eef2970d0eb57bf },
+    { 0xe3ae3043e81d0504, 0x362c7acc5dbdadf4, 0x65789d5706363890, 0x24171ebdf0574a3d },
+    { 0xbf92485550fab0a0, 0x1e49b4c87c3dbc29, 0xd43655ae6f01a85e, 0x272344fe7584affe },
+    { 0xaaf94bd973986ac0, 0x8a9026c374ea4322, 0xd95074c3a1f4d3a5, 0x2592e13aa0cbb6ac },
+    { 0x451ceec1af6e35e4, 0x19d8a9c3b03c040c, 0x95ea1ea0260c2c7a, 0x0771e9242df49087 },
+    { 0x4f12914da6803d69, 0x0c1ede6064bf77e1, 0x34b74a918580feb8, 0x1a5b00b9a629fabe },
+    { 0xebdb38550b5a41a4, 0xdc43cffedb96698b, 0x64d097fa024ced48, 0x0d50b03823b0674e },
+    { 0x265f23f424d062ed, 0x95ac93c4dd790fc5, 0x709401ccbdf5f837, 0x153fd37d9291b6a4 },
+    { 0x7475b95538c157d7, 0x2d580a78571b0a46, 0x3d6a11b3b4a8e7b6, 0x3b2fc47aded9f68d },
+    { 0xf79e438f72815778, 0x5f29caec4d1b2dae, 0xad6315aef848a30e, 0x171c89586fdc0a07 },
+    { 0xc4c9639c82566517, 0x22cdea30b1858e20, 0xabdf4433bba147ce, 0x2dde977fdb991d2b },
+    { 0x20cbf711b541378d, 0x638cc3981d522fbb, 0x2ca8189c3cbb0b23, 0x0faf18cbd37bd250 },
+    { 0x2e1f43be0173a687, 0x644e4d81974f8909, 0xb4bdb6e5d2bc12a9, 0x23a48732b182886a },
+    { 0x3c7d869379a1b9b0, 0x155e3681d58392f4, 0x2f30e9a70b13a4f2, 0x083c8b41a35e79d9 },
+    { 0x2a18ae74891c7a3c, 0xd65e1082982b6810, 0xe5cc023299e0533f, 0x36f4dd88985b65e8 },
+    { 0xeeda2682beaad31d, 0xd765ea434d2c4e0d, 0x8e5630543ef78052, 0x11b34a7298134fe6 },
+    { 0x24dad7860a5f1534, 0xfcd187f85b8da09b, 0x800ff29e4530e51e, 0x02eae726c34b654b },
+    { 0xcb78b28fabf2da93, 0x31650efbea5d8c16, 0xfaae1d31579c193c, 0x3d4e3086d7648f60 },
+    { 0xbe4aa8f7e82cffa0, 0xed4f58b965d68541, 0xc3e245d8f1c86dc1, 0x351696b162c9e8c0 },
+    { 0xe7bcfcfac40123d8, 0xa7e85a0d6934d9a3, 0x39468eece61faf73, 0x3ea4f2fc7c9ffe7e },
+    { 0xed4f9b89dc2f705e, 0x10db037559681510, 0xa0b34d7e6292c847, 0x135ae26e120d83d5 },
+    { 0xeefd4c043c044bfd, 0x422bbda85ad887da, 0xe8e706d32a5f24ba, 0x364e495d2d6ef34e },
+    { 0xddbe1f451240c963, 0x087e0252c2b89d00, 0xc25ae543ecc11e60, 0x17752f9df6a162ee },
+    { 0x4ef439ce4cb841cc, 0x15fda5b0b07331b3, 0xacdc2bd2c3a87d72, 0x236a0a48df6fd163 },
+    { 0xbedd55496a6f3145, 0x609d927798f499c2, 0xf0727f8418e56ce5, 0x23c05fd395b64560 },
+    { 0xbb409db6c74aea50, 0x9465ca87eaaaac5a, 0xefda081cac6a9112, 0x2e3eabe96307558c },
+    { 0xf8e9b268b5e29de5, 0xe052c9777cfdda63, 0x74274a488ae81db5, 0x326589ce1ebb21b3 },
+    { 0x85372e1779474ac9, 0x4edbe9b154d3006d, 0x65a9fc47838d4b93, 0x166a79e2696b9f12 },
+    { 0xc25850a2472b84d1, 0x01ba26dbeb97883a, 0x2249ca81fca8a107, 0x0478e2909c5e2a01 },
+    { 0xc1e2ebb2ce87fd7d, 0x56e1c56ecb0b6493, 0x65d566e0bb35fc3b, 0x3132896925f42cdb },
+    { 0xae438f7e04471cd1, 0x0688593af2bfe7ce, 0x21904d3b948939c4, 0x10a1ff4546bd2262 },
+    { 0x96949df87679571f, 0x45cff0f0f926ae65, 0xb95c371fdb6b5771, 0x0e77b9e5349d83bc },
+    { 0xad2b107f841e131b, 0x1eea675449113595, 0xab51614bf0056779, 0x025084e0c660d728 },
+    { 0x33fb5e188d49fa47, 0x8a088e237b6d96a1, 0xcb1feed88519168f, 0x18f80efbb7b32855 },
+    { 0xeb2988e2903ffaa1, 0xeaf2802da92faef4, 0xfcc598c716193bcd, 0x307de83ae18b0caa },
+    { 0xfbb63e844735e86f, 0x37e525a76bb27550, 0xacd91d202adc7b58, 0x2afc81dd94455582 },
+    { 0xbfc306373d98cb28, 0x372d7dd20de55807, 0x9424895e91039cb3, 0x117a0b059878c06c },
+    { 0x2a5ffb691b27c4f8, 0x01825a24d9524875, 0xf982be58d32e5cca, 0x21470299f378ff64 },
+    { 0x553bca9b966ec6a3, 0xbd78d8faf03bdd60, 0x98abd9e211d62640, 0x1690799fff264662 },
+    { 0xf885130580de95f7, 0xaaeba14a8e19462a, 0x4e460fd178a780d3, 0x38b842d2122bda06 },
+    { 0x0d6f28627ff159af, 0x04c4b2180e265716, 0xa11e2538a6373d32, 0x32e1d38f689a4928 },
+    { 0x0476795b3e78dd3a, 0x49d8f5294153f380, 0x69aec5dc7551f9dd, 0x204395c15645f0af },
+    { 0x6ff906a07ad8ae2a, 0x36656b796bf16788, 0x805fa2c131f4b6ae, 0x34541ed897ffc28c },
+    { 0xb3672585c040fe87, 0x814ec0bcdf67d4a1, 0xeec0b1aaaeb1e2f6, 0x058cf1061b3a94ef },
+    { 0xe2344f5d7e76accb, 0x58366d66a58bb5f9, 0x3bf7e98dad1398b9, 0x1825b27fcd34121a },
+    { 0x459d92a0305923e5, 0x4f7c2d76d8056293, 0xb3f07d4759c340fb, 0x163ce437649084da },
+    { 0x8c63981f1010f4e7, 0xefa818e696f19df5, 0xd07e017f5be4db21, 0x3b549f1da1ee848c },
+    { 0x4b96ca5b70926909, 0x3c96c7f514f1e37d, 0x34e383ada640b254, 0x1e807c130df73d04 },
+    { 0x5134a3c7690ad207, 0xf294390b24eb5edb, 0x0a4079c58d488a32, 0x0d239660cd0b7dc9 },
+    { 0x1b057f5101c4940a, 0x3e37e1620c1d6de2, 0xe246b7cd669da88b, 0x0fb5ca93cd45fe1e },
+    { 0x1e92de5c3fe592c3, 0x8b121fa6422859e7, 0x5dcf86582c73debb, 0x32e685de5a6c9264 },
+    { 0x2606ab140e15e8dd, 0x2656a05c76a8a673, 0xfd2e151845560455, 0x06ef580b073fadd5 },
+    { 0xb3d23720b72dfe29, 0x4c4156fa140b56f2, 0x8bfb72a8e2bc94a4, 0x371081d94d31b550 },
+    { 0x5b5181df2a05b240, 0x3ac56316c0d97a4e, 0x2c52e83559e03c58, 0x1d75ed3cefee87df },
+    { 0x34bc6c6f5f0cfd0d, 0x154c9bdab42286d0, 0xcdef6068e6589ace, 0x2e4d3a6841ea8d94 },
+    { 0xe0419f4b9498bfd1, 0x373320a485a91e43, 0xe86c5fc489d11c46, 0x35c8a85762478a57 },
+    { 0x266933615cd912b9, 0xd617d3f0dd4a5917, 0x64a51e3573a4ebb3, 0x26fac77843e5896a },
+    { 0x7d360285c84283f0, 0xa83c722f761e838e, 0x406abdddc9651e74, 0x26fea612385ec0bf },
+    { 0x77a0c0ad412e3a6f, 0x7550c3365c4f12b8, 0x9d451072c389cd6c, 0x0dbc30e32697a6b9 },
+    { 0x7cb646f56db5af9d, 0x56e9096855fcebc1, 0xf971e41ddc3486be, 0x11a7703c6b806ad6 },
+    { 0xdd37eb8d78bbd0dc, 0x4da307c2ebb78c5e, 0x3990acbcee7d5228, 0x2bae25349d9591d7 },
+    { 0x730c8578be3f1d03, 0xfafa3cbdadacf99e, 0x991e8b010ebf988e, 0x23d5e6deb9370cba },
+    { 0xa39076111524e00a, 0x93800859fb6e7682, 0x3308b8c9eca76044, 0x3f3743ce0f98e7ba },
+    { 0xfed81ed0fbddb14f, 0xe36f1c024c1fb385, 0xacb2f6ea337e088a, 0x3bdf5fdbb5a208b7 },
+    { 0x296562b2494cd507, 0xd66d364802796687, 0x49b43f489ade133d, 0x13671bec1c08e4ec },
+    { 0x8f8ab4e81de446b6, 0xca4ca04ad295a0e0, 0x9cb509dc6efe51de, 0x189ebf35789e606e },
+    { 0xa70473fd2720535b, 0xe00745f6bc9ec832, 0x43823efabba60471, 0x270dfdcd22266179 },
+    { 0x1c5661eb9a0c8d21, 0x98bdd1a464a3a99a, 0x3050c59934f8f06e, 0x358311a5d8c34d76 },
+    { 0xf06769cd1b708b99, 0xb26da37b9907b311, 0x13377a121f5222b5, 0x2bdacaf17a8d8b52 },
+    { 0xde6dcfb1c6bbf6a6, 0xa32d34cf7755e8ae, 0xa91f0bb68022a016, 0x25bda25c77f37581 },
+    { 0x17a602dd46b206b4, 0xba4f9726c22ea2d1, 0xb8c40af25a3572fd, 0x1db5fff4c8e49caa },
+    { 0xdfb1da8052b4c943, 0x748622c966524917, 0xc1b51c6443c00869, 0x0318c443b74b4c29 },
+    { 0x806f41cc85ae0412, 0x9d08b2c731c274ff, 0x92ccc17293c21013, 0x045675f6468c240b },
+    { 0x63d63a2c07134511, 0x3484ccfe79ed45e9, 0x9b491102a335d6e1, 0x2273cf5b05e463d8 },
+    { 0xa28e5340ccf1eea7, 0xef501b21fb42c05d, 0x027456a7251c7dbd, 0x0799be5f9b7e8a49 },
+    { 0x41d2a48211913a90, 0x3f59a1799ffba348, 0x04d1abeb7ce0e2a8, 0x3f89662a0ff60a2b },
+    { 0x9facc990574392d4, 0xc1c42132121e70bb, 0x77fd9fbead79764d, 0x0a0b5155523227a6 },
+    { 0x443dfdcd6bac70e4, 0x55b3b457c3938b9e, 0x2f8d1096e211836b, 0x06e04e5ae3610f48 },
+    { 0x99935184c8780637, 0x897972e0a4e14fc5, 0xbb0bd5aa07c19f3a, 0x211ee37c3a9de2e1 },
+    { 0x191de1a7fbc95c7c, 0x8fe38a0f82485c84, 0x26a42762ee4c19de, 0x2a52e7702f8a5209 },
+    { 0x24e1375ea5979898, 0xafa7e8ad0b8e5fad, 0xf987ac3a7c084e9c, 0x0ea5da81ec8b4425 },
+    { 0x449ff117862ab96f, 0xc8a2d0d2026d0496, 0x5f9bb61438677836, 0x3262c65dfc521324 },
+    { 0xd3ec222afadb0c80, 0x0cdefb5a9c7184d3, 0xd4fb4b21f93cee47, 0x19428b67e8f24f05 },
+    { 0xf73e7200f944f85a, 0x532e64738828fca7, 0xe42b6fbe9864380d, 0x1e11545bdd1bd962 },
+    { 0xa9ccdd711d548084, 0x3fa49634a268d35c, 0x8435312c87b7567c, 0x3cdf04f9d3212f7d },
+    { 0x1e3af3ba10864443, 0xcb58cbf355b8f27c, 0x473ab484fa10c829, 0x16c22a492b3a593a },
+    { 0x40cad100993e4f17, 0xf562c54b5c86ba88, 0xd8c0b6e065af0812, 0x34e0621f979e05f1 },
+  },
+  // g^(-j * 2^16)
+  {
+    { 0x5b2b3e9cfffffffd, 0x992c350be3420567, 0xffffffffffffffff, 0x3fffffffffffffff },
+    { 0x47ccec774563e020, 0x119b26e3ebc2b816, 0xaed7d83bf8e183b4, 0x1fc5d601feaa3d1b },
+    { 0x6a5854c41770e0fe, 0xe368681c2bed3ae9, 0x27f7f6b53db2d46a, 0x16b540cfd21189df },
+    { 0xd5c36b4f2a2d5252, 0xab416caafa5cb7fa, 0x2edf96e2b7616295, 0x0db6118fa3908730 },
+    { 0xdfe5722969f5f87b, 0x19f5d293d70993b1, 0xdbc66fcb780c5339, 0x0d8064a702c99479 },
+    { 0x5a507c4e3526b7b8, 0x0706987c0d477f5d, 0x2f47ef8977d8c942, 0x20d7838a9afa3879 },
+    { 0xf22f15c090bd4587, 0x9087bed69338cdf7, 0xa318e21c026a37f3, 0x1e1680306aa8c1b4 },
+    { 0x253c494ca47530ab, 0xcd46dbf4ca13c171, 0xeb1c364c85f96018, 0x1d72f91891e7c776 },
+    { 0x9c84bdcf81284775, 0x3336971238e53f83, 0xac9701135bf17538, 0x3c2311436b4f2a74 },
+    { 0xac80bcf6fa12e659, 0xde0ac87cf643aacd, 0xa22aa5cbedaf14d1, 0x121fdad39bbd57ef },
+    { 0x9bdffc406f2d3ac7, 0xe9605fe936bf5bd1, 0x657c876c84691942, 0x07ba3b98da5e8a11 },
+    { 0xefaaf85973f9836a, 0xb3025ea4c7388dc4, 0x368d758126843f78, 0x03412c2e7e672c4a },
+    { 0x92529a8f75c71260, 0x43d2a15e22158c2b, 0x93907bc70d9c1f77, 0x0a7c4bbb60e68dec },
+    { 0xfec3c6690515f661, 0x18dd23abef755712, 0xf1124464aa0afb20, 0x3d1e1b744cac325c },
+    { 0x3dcd38c27280ab0a, 0x47111e7b954c8d8a, 0x3dedeeb6e391d7d9, 0x074c798fae18f610 },
+    { 0x52ffc70847e108a5, 0x4b5b95abe02dce56, 0x4a9bf5fe5c86fe43, 0x3631483cd0ff952f },
+    { 0xd3a8ad9f763f9c5d, 0x870f37b43cb01495, 0x96893315de5a18da, 0x156e3e6d7f0ed3b0 },
+    { 0x711bfb386490306b, 0xb8ea10980df83379, 0x1e21bcb05037d244, 0x0369e7548834f41e },
+    { 0x2eb161d869c5aaac, 0x1aa0c0114ce15ca1, 0x61cad4829ca2fe01, 0x18ef49911eb6c8c0 },
+    { 0x8475678e0ebe4189, 0x28135ce797489933, 0x98fcbc8f68c41381, 0x2116e03e546b0598 },
+    { 0x30e478ff9473622f, 0x89b4cc6ca48160cd, 0x72b4a8170c358c47, 0x36239c028a7264ee },
+    { 0x220cdfefb3bc9f71, 0xbf440b59700e69d7, 0xb8a8f647a4f3309b, 0x340e118209a70434 },
+    { 0x9d7308d7d63b10be, 0x1042012cee5b4fc1, 0xf4409ad123df0742, 0x16b630c7180e7107 },
+    { 0x9b1a95dd5a1ddf3c, 0x01fb161c99d265a4, 0x1b563d2d9635dde6, 0x3af1be94287a7b59 },
+    { 0xb9a831147a2ca26f, 0x7de3ea9cf86eeafc, 0x3c87614495e9ac5b, 0x03dc10b3720a3df0 },
+    { 0xbc89ed80aafcfc36, 0x5855bf3cdcc37f36, 0x4506e248b51ee05b, 0x1052fac80b2092ca },
+    { 0x4e6beb5348d350b3, 0xdfa05df3ecdde841, 0x6d5e917e6ab68305, 0x3087aedfa46120b6 },
+    { 0xa0de0182a3a7cbb4, 0xba7fec3f7748539d, 0x47b829cc5ca6aa96, 0x09b5c66d0413534f },
+    { 0xbbfcd2bae79797d8, 0x59b9ed0c83362154, 0xdc651b9a3e9ad94d, 0x20ff2376f5e82047 },
+    { 0xdf6122659ac51842, 0x6e98fcd03ad6d039, 0x8935122c16403319, 0x024b82db36fe2caf },
+    { 0x140797e9c5f33c9c, 0x2aef6fe1147b6077, 0x4412f5e5a8577e06, 0x0fa89dc8f322b10c },
+    { 0xb42517ade7f645ec, 0x72d93391140bf2fd, 0x69767e62190fb141, 0x3f67ccec02ea39b9 },
+    { 0x5d93a3f7957a8247, 0x80a81d1f63857295, 0xc6c696e9e24a02b7, 0x0326c0b15d516fe2 },
+    { 0x4898c6ad89de63f3, 0x048743d1aa567b35, 0x6d16e8fd7106d6e4, 0x066fd4c825075cdf },
+    { 0xa97b731eb6464852, 0xf3d27a8d8f77c710, 0xcfb27bceea83ea28, 0x070a3e68cb567c95 },
+    { 0x828741622e7ea595, 0x1e2cec04941adfba, 0xdabe1fb269251f58, 0x2f754875168a4fda },
+    { 0x3cb0d2cd3491d3d3, 0x43016ed1eac84612, 0x5b85a87bd836c40e, 0x2332bac32dfc66a1 },
+    { 0xbe0ff4ac7a58286f, 0xa007abbaf6315161, 0x094b831c2bb5c3b6, 0x3d1aacb2ca4ad6ad },
+    { 0xe8c85e7937e3e603, 0xa442fa38d4e5a7b2, 0x6bab7b6be0e3607b, 0x15e173e0f093c29b },
+    { 0x5f96556adbbd8796, 0x7c8925c7b15afdf4, 0xd5e9a49a36d28b58, 0x04d865e503f4b827 },
+    { 0xe3c9afa6270f88ee, 0xecd090e60b18fa54, 0x615e80d10c796973, 0x310b52e9f2d1338b },
+    { 0x32c8f7c0307f599c, 0x22fc02a51bacf1d7, 0xf72fd3712066de87, 0x1cdc16249c972155 },
+    { 0xaceb4b8c07b8f1ba, 0x8d099ec777f8b4a4, 0x66c3eb0d529b1682, 0x0ba127677d080a56 },
+    { 0x9fc6731bce1f204b, 0xfa6940b3a471c5de, 0x9e57ba4fbb053c22, 0x1c40ec878fe6537a },
+    { 0xfa8617fdb9d88d46, 0x60bf175a41ab3811, 0xfa832c8df1d60377, 0x048642491df623c1 },
+    { 0xc6e026b68605006a, 0x28dfeffaf7d5683e, 0xd04c20e91b8adc0d, 0x080c9e5c9f8c3e5a },
+    { 0x459f9d112c22dea0, 0x5946dfdddf0cb07c, 0xa48e90fcd911b733, 0x38c648d371dd2921 },
+    { 0xfd9261b05e3a5cc2, 0x4d098b0296477462, 0x270264b5bd7821a0, 0x0aeb8294d7b718bf },
+    { 0xe552b6148ed2f619, 0x0dd139ec94a40f17, 0xe20a41e2456704de, 0x33846877adfb979b },
+    { 0xb05863a5f5b5d436, 0xb4f6907a1a3b8feb, 0x8cb33bac7e91fe1b, 0x1e4096aafd271bb0 },
+    { 0xaf2d8a5ea841b791, 0xa08c70e79f2685d1, 0xd418fc24715eb7d8, 0x29a70584a7cde98a },
+    { 0x26bd300034af4cca, 0x6121efe6f0764b85, 0x037251e28ee173f3, 0x1300de6ed79f9b27 },
+    { 0x443c2b32f9565d23, 0x227110d5f4506099, 0x74b82da817edb2c1, 0x31977d3ccf9ed103 },
+    { 0x807765cec9b51beb, 0xfb5875b9dd39f4e0, 0x1357c3ad5244581a, 0x0b2a25b47d30ab2b },
+    { 0x9d40d360ed6fd033, 0x0bfb8d5e371372bb, 0x381995ba2e837ffd, 0x11a9b54751f70098 },
+    { 0x7f279bec6c327404, 0xe7b0f47f66e2c9bc, 0x9aa635d074142925, 0x38536b97e443aade },
+    { 0x9b12ee58ed1161cc, 0x5985bf62a7291e49, 0x699b26487f4141f0, 0x1a36759a0ccf132d },
+    { 0xe5bcd687cc16c25a, 0x86f308b174e84d81, 0x4873bec335e0b498, 0x1eb3af2b3a8f088b },
+    { 0x6d1778b92e5eb42a, 0x5d917bdb97660fea, 0x30b6605483cf824a, 0x3e28dd160c45f185 },
+    { 0x4b311d18ce2dd536, 0xaacf4d84ad773be0, 0x057f6f86b0cf1553, 0x3b8f948b8143a0f8 },
+    { 0xeab99f7053c971d3, 0x7574712503f68358, 0xba7ebebca2e29927, 0x0e4843633bdf3257 },
+    { 0xabcbbbd4a4454dd6, 0x3cfb1b859676db6b, 0x43583105b23a2584, 0x17d359a4d0223a9c },
+    { 0x6a4b43a7e9b37354, 0x9bfb9b9b875425ee, 0xadc318ad91f792fb, 0x16a78885f8f200b0 },
+    { 0x4fd8d2a595fb0c72, 0xbd4c8430aa53c628, 0x530d14765b73c5e2, 0x078ba6f461c977a5 },
+    { 0x5720ee91513e4a4a, 0x226d03744c68a15b, 0x8cb88876a3c83d3c, 0x179fc93d75dd1468 },
+    { 0x092d00c1f2e0dff4, 0x8986d58af282c87a, 0xebc86f060b5b4aba, 0x2051835e1f27f93c },
+    { 0xd7feb8c7943bd98d, 0xd0cc9be240def517, 0x629b1d837cd4db04, 0x3821bbe18a4e5a11 },
+    { 0xcf914c38a8705f32, 0xcbbc15d253a74f79, 0xf2d535e3d0e0d0f2, 0x0ba359bc8ed19730 },
+    { 0x986b5c7cd0f2cb51, 0xb322b5aa408556c8, 0xeb0f24553c3e3a16, 0x39a73256e1d1b4d4 },
+    { 0xaa466c5431e5735b, 0x26b86773bbe685b1, 0xcfb06b09c613533a, 0x2a730e4e9f32e982 },
+    { 0xb869f96b62089a96, 0xc576ea138cd24535, 0xb209227586bb3017, 0x34782d0410fee65c },
+    { 0x9187489046de8244, 0x954f9c9be620d79a, 0xf282e873f3c2bd8c, 0x3dc9b3e83f8dac20 },
+    { 0x4ec017d1dc068bdb, 0x81dbc31581354522, 0x336d09b30b74342d, 0x0c4438607861cfc6 },
+    { 0x2f07b1574fb6c34d, 0x21d7912dc001308a, 0x95374272d1fdd340, 0x093b6fd02e1bff10 },
+    { 0xc2eac4a3dcb308b1, 0x382ba176f51312b1, 0xb599c06a3d65c3d1, 0x2ab8eed85be5fc8f },
+    { 0x427d237fb741162f, 0x81b3be8ac82bf562, 0xc205f41a6e6230d5, 0x2eb2e9f466495cbe },
+    { 0xbd7c033653b10ebf, 0xb548fd35b5b23eaa, 0x987211509a0c5cfc, 0x3d6489d5b4744e88 },
+    { 0x54c03b1ccf7f7de0, 0xc9abda5df27bf474, 0x11c1a7a9c2e41c92, 0x2eeb55107955cb3a },
+    { 0x0e9bc12c171d8e3d, 0x735a97d8207c1e4e, 0xd09ce78c5ad70ba3, 0x1e3234aa6191062a },
+    { 0x15f38de0f70ca8bc, 0xd931aba74a5f68b0, 0xbf79b6669308efc9, 0x1a414f8d91fe712d },
+    { 0xd39c99e32c85761e, 0xdf09b98ecc527227, 0x19041351b01badcb, 0x16401f884c1440f7 },
+    { 0x135cf08c65ec2325, 0x95f4c13406b08b50, 0xa0c0cab238788ef0, 0x2f6109fd0b63b753 },
+    { 0x906eca521ecb10d6, 0xc72ca538e64649fa, 0x46c8729bf27d816d, 0x3aaa977a519af479 },
+    { 0x3a65d00bb6ab3d8d, 0x85d5b003da0c3fe3, 0xf72dd51145032908, 0x09acb20abfe22c47 },
+    { 0x631a661715c90fc7, 0x2a3cbd2fea13576e, 0xde075eaeb50f2d0b, 0x032be4346eda4642 },
+    { 0x4a5b095ff9004780, 0x9206b80f64746cf6, 0x6fe0abeedce6f15e, 0x2e2185c94ce37205 },
+    { 0x38d0cfd07e3ab516, 0x288f9f4fe69ab9db, 0xfad833af19ea60d4, 0x151e864f382af8b5 },
+    { 0x584df46f0461d1b3, 0xc73bd037bbfd66a6, 0x15a3a720d928946e, 0x3044bd629aebc359 },
+    { 0x81f921d37691e529, 0xbd298d4d989db196, 0x573d173641827764, 0x3b2d9ece15924b14 },
+    { 0xaeadf737ae5fa1b0, 0x3b9d31b722799c41, 0x48368b38ecb4b462, 0x2e0b16e9149a70d5 },
+    { 0x61a1b2573a2fac33, 0x890b39f7de509142, 0x6a594ce8ea192b8a, 0x1b6fd9b33b1e1fd8 },
+    { 0x14c52cfa2d28c8b4, 0x51a8860c1065c3c5, 0x1403a92057248fde, 0x2aaf61feaae428a1 },
+    { 0xabd787368b5677ad, 0x31178cce48c31dcb, 0x90fa13847f924012, 0x007515853cc479cd },
+    { 0x911f42d939a54098, 0x64cd1bcfdfcf87a8, 0xbef8679fc9d30636, 0x26f9389f68628c1f },
+    { 0x6e51f4f82ff8b9ad, 0x0e021ec3ebe31969, 0x104c3662cdba8fcd, 0x11b19f1f449b4afd },
+    { 0x1d3e999899b80fe4, 0xebde14b91b488843, 0x21483ed1c4068c69, 0x1be4130547eef417 },
+    { 0xf7db33f88bf9c4c6, 0x2bff01e2bcdd41c6, 0x9dbbcfd678184d53, 0x351afe699a44b50b },
+    { 0xe34d84f477740324, 0xe6c6112010221a48, 0xfdea1ba700c4d9e0, 0x1e15063c3141d442 },
+    { 0x5a5ec353a76358bb, 0x73b98fac63531370, 0x7dba6b5b93f24d7a, 0x398d176e07667ace },
+    { 0x536a06f306912a2a, 0x0d2573e62dfffd82, 0xc026204e4071d73c, 0x0cd8a7de7cde272f },
+    { 0x849757a9cdd53d29, 0x76eaef16adc9fe05, 0xc5c08cd409481c7b, 0x0c7102976da7a9b4 },
+    { 0x580f227c2f887a8a, 0x3ccd92fcfc235916, 0x30fe4b7734a0dd84, 0x2546d72ef92b5f91 },
+    { 0x6b3db7eabfea9230, 0xa60f630056548268, 0xaf09c99b52699afc, 0x1bda43f257cb8790 },
+    { 0x3799c8fe755b540f, 0x6fcb3b853b30ed09, 0x5421975437320c5a, 0x014270900968086f },
+    { 0xc67f0990e57d2878, 0xec826219d761ff6b, 0x34cb6ae30576cba5, 0x0deab8245a5896c8 },
+    { 0x159cd9b34f6df48d, 0x0c86506da4efac13, 0x6226c048a191b4e3, 0x1822f35a2a5b7f0d },
+    { 0xc05620fea0a5eb3a, 0x2b2daac974ba4d3e, 0xec3e3a804c119d81, 0x2ab60929ea798a81 },
+    { 0x65b5cdffa4a4f3c6, 0x1cef8b5da216e8b1, 0x51e05339b3f0eeef, 0x321d1161e6c8e0b6 },
+    { 0x91a15251074da170, 0x06bb735f87123d14, 0x9cccf3eb2886698e, 0x047155d309e09e3d },
+    { 0xa629a0489fa3e7cd, 0x5a05356e7aa5880e, 0xb6fb2322844f7cca, 0x1d585a458caadaf9 },
+    { 0xdc680f586244b91c, 0x4fed043faf548f13, 0xf4c2bb44042ff7ad, 0x016384d0efc2ffbe },
+    { 0x7ad6b497703317e6, 0x7292c401e669b2a0, 0xe292b471e93a5672, 0x3afeb1be1ce3ef11 },
+    { 0x09cc7507d9550a02, 0x73a559da495dc5f9, 0x0f1da7bdb442ee61, 0x1bec663ee454e53a },
+    { 0x9e54b98797a47052, 0xbcac4b5886f1c1b8, 0x6577af6171db963c, 0x3728f411fda5cdb6 },
+    { 0xf6fad3acdf8a588e, 0x974a80b438530b60, 0x6f8ed12bfcc559bf, 0x10664e88feb932d0 },
+    { 0xe70b09d698bb8c81, 0x6b265e8162e9b10d, 0xa5304bad422f8294, 0x210bb54eb5d446d7 },
+    { 0x6e46270783332196, 0x8225972d9527174e, 0x42b149ccc3a155b0, 0x329077f060f334ef },
+    { 0xb7ad66fad16b1340, 0x07c9e960eef1f496, 0xbea09bc6c6c68495, 0x10a62ca120b47300 },
+    { 0x6c52ca76415b03be, 0xe17513b61462225a, 0xe7c123f8d22efbe0, 0x21fcb62333b9d2d0 },
+    { 0xda0a4e0618e85263, 0x89aab1d146d8cfb5, 0x57fd162b6d594a23, 0x09910d0077c47f3a },
+    { 0x5c0f5d4e30d1f387, 0x22597c5f707ae42d, 0x8794080d67816396, 0x1ca732e1a38a1292 },
+    { 0xd35bd9016f87c2f3, 0x0e9062f56a8ab5a3, 0xb0e54a69575df9c0, 0x2cbb15d626c61654 },
+    { 0xe123fd65eb9ddfb1, 0xaaca0bafee758b05, 0x50d9d04945070fbc, 0x3e66731f40270b9e },
+    { 0xcb664c5e3b24ab0d, 0x0fe24328b4e5dbd3, 0xe1e2c18cdb8ec71a, 0x0bc167254d7e6a02 },
+    { 0x0487baf71915e0bc, 0x61ffbe2b15144f0a, 0x64614046765495ae, 0x1690ab30f9cce53f },
+    { 0xb90d35d357bbdf20, 0xed9ffe3ad97c2f28, 0x2f406512c0e676f0, 0x3fa5df66ef028632 },
+    { 0x403786ec46daf87f, 0xac9fadca4237d188, 0x93b73509b0e5768b, 0x0f39aa5b27292e9d },
+    { 0xbae8235d81c98334, 0x205631249e79b492, 0xbec709ac8c28f2e4, 0x1bdd909b494b8dfd },
+    { 0x3a1bf632d2ad115f, 0xb2283acb0663939d, 0x1a99f7634de45ba8, 0x38bf3db8b0310962 },
+    { 0xf73dd4a8c335884a, 0x118da55e336e8919, 0x319a18f993590994, 0x0232c1560267dae8 },
+    { 0x0c80e06e122bceb7, 0xa04b9edea7825a47, 0xd35ec7958f5a47b7, 0x0ec28ee25fc4ceb9 },
+    { 0x7745a71a98f8db39, 0x31ba5692badfa81f, 0x33dca9c70e58dcb3, 0x25e39548b7dfd3cd },
+    { 0x62e362a3e67c5d7c, 0x336f9a7e13d771df, 0x9ac6445debe0a7b0, 0x035d9016bacf7044 },
+    { 0x01b9e5336cea4b29, 0xcdc1f6d4f5c97d09, 0xf988cb1a687037fc, 0x0e906c8786021eed },
+    { 0x7700818635e19781, 0xbde1bd421559e9ce, 0xaa5dd4db5925908d, 0x384d42fe699c177a },
+    { 0x859dde5884013300, 0xde7e9bd612ffdcd2, 0x5fd64b9322fffbea, 0x314df188464ecfed },
+    { 0x389795663b620756, 0x200222424bcc49a5, 0xc6a65a1527c94fc9, 0x3abcc5e0d37e8421 },
+    { 0xa77f091c995b963e, 0x2bbcde491aecd0b4, 0x320746997edc4a78, 0x1d8c8f77a65ec06e },
+    { 0x046f8004bb217ea9, 0x92a2d2c4285178ce, 0x34153605f6f27c01, 0x2fef071e57993bb1 },
+    { 0xe02d0981d626e704, 0x68e5fa48ddc36fe2, 0x048468ee2622c9f5, 0x2396d054733c0d35 },
+    { 0xe2f5334a831b8734, 0x3157077fde03d6bb, 0xe1557d7af2201e71, 0x2b212bc1e2333bcd },
+    { 0x4ef5fba2f02fc3ec, 0x5720b181112b1d9d, 0xf3df022879458591, 0x2947570addb98d48 },
+    { 0x8f3d505673c0696e, 0xbe51f386a243edc1, 0xc7120171615e09ae, 0x0b107997124a182f },
+    { 0x608a6bf74677e123, 0x063ee4168e0e2510, 0x0505493e8b33b660, 0x0b8298bca0ab4905 },
+    { 0xa591b79b92296576, 0x4f4ae0a2656ac82e, 0x65fa7dbc5e26014d, 0x0ae3ac6f0498b74f },
+    { 0x3d796c6b403e789e, 0x1dba75eafe1a0bae, 0x4cf121d3821d3d80, 0x08f44a9cc460a725 },
+    { 0x55fb448317fa9152, 0x909c6324d7e5e71f, 0xeaf6228991560d7b, 0x3b563a2c56b3529d },
+    { 0x2a76248356bb7d7a, 0x790ead42b2345f54, 0x2aa5f84314ac23c7, 0x07fee06e7eddd44f },
+    { 0xde3a1ed6d9ca0ca0, 0x02461fa4b67899ea, 0x32adffc73aa3bf65, 0x175edd7856d2847f },
+    { 0xdbd500e270b373b6, 0x4ae0f8e045bd7bfc, 0xe02beb6fe9b6f559, 0x15e54312bce7d24d },
+    { 0x3790c53dc5f214aa, 0xec1038a9be536788, 0x5ba7d00d820c0947, 0x3ff8040a9a76107a },
+    { 0x8603278b8912f5f6, 0xcc7ff2b1fba44e1b, 0xbd9a2c86a9b9cf1d, 0x258f8547622a7fa2 },
+    { 0x720df53eb42052b4, 0x0b12525899bf9e82, 0x237246ba1f9549bf, 0x01c00733d806675f },
+    { 0x41a927d576babcf2, 0x0471a6f800bd85ad, 0x07312adbac81b71d, 0x2163543c3b3ad168 },
+    { 0xd679ac6669e63624, 0xd937d8deb15aa2af, 0xb1905bd5cbcf9dc5, 0x2d8314f5def6a41e },
+    { 0x78db5178d8477d1b, 0xa3a55931fc572f66, 0x73320c9332dfec11, 0x1e32605167f61468 },
+    { 0x365b49197d2c294d, 0x2203b731a6722641, 0x7f958cde06af8f18, 0x08ad73d737885cab },
+    { 0x46ed70fd3df069c6, 0x54b9fcb840d4b58b, 0x8e8d6f28579bb605, 0x0890c91e884cece1 },
+    { 0x2eb1b7c0fdb89277, 0xa096f214e7f9f446, 0x2c112b2761c47085, 0x2be7ad8bffe56e01 },
+    { 0x8cd1eea9ac6afbe0, 0x19f540a633999ebe, 0xd5b2692bf8d1b75a, 0x2581b97bc442e8b1 },
+    { 0x948aa3ba585a53c3, 0x23d0905c0bd9c67b, 0x0d1750160d5300e1, 0x2aa4239dfabf5350 },
+    { 0x2062c00c620aa7ec, 0x9dbdb703239a879f, 0x0cdb3b7decc9038f, 0x2135aeea3414456b },
+    { 0x9783c7c59453a4c2, 0xc47abc20abd17a8e, 0x13ea5d0972aaf7e1, 0x13dbf6a37f6cc91b },
+    { 0x262babc6b291e1f7, 0x6e44b2b0a2edadf6, 0x9a35c0d687648448, 0x11d7b2f87d563d86 },
+    { 0x7dfda0f8e3e3c0b1, 0x197b29bca7fd8684, 0x1b18ce5232f79aac, 0x2a84930fcb479759 },
+    { 0x40678a37fb54c093, 0xe7be21961d6616e9, 0x3db46fe74df1cee9, 0x31f57c60ef74d306 },
+    { 0x0bb456687dfa201d, 0x31483fc08950d45c, 0x9b8c16afdc7b53bd, 0x043da460e9842c4a },
+    { 0x31cb7c86f8b4801e, 0xd43f8379c9bcf339, 0x182afecc630737d7, 0x2d289f9faed37677 },
+    { 0xf7e80d5ab316235b, 0x493719a529ead6d0, 0x2820f864d4bd0abf, 0x25881ba14ed3d6f8 },
+    { 0xa92918375bbc94a8, 0x79015fe8cb973de3, 0xaf1234c466a114d3, 0x31bddb8b7604a074 },
+    { 0x7317a1c98046b2a0, 0x5a92edf20e86979b, 0x2f6173fbd912e236, 0x0c7f62270e8ca6d2 },
+    { 0x6982f8bc2c124133, 0x519026ea7e0697eb, 0xd01db47a537cf51d, 0x064ff2683233ee06 },
+    { 0x3784e236228e175f, 0xca7c04741a1640a2, 0xbd872bebb7c7bd33, 0x36724face0fbe9af },
+    { 0x871fa11862ee7c00, 0xc3b9161cdbb089ac, 0x823cad0da97c4d4f, 0x1fabb2fcd7069b16 },
+    { 0x2c02feb1eccefeab, 0x1f56c84af55b5fe3, 0x2fc9518dce9389ce, 0x21288e3b8a0d8e19 },
+    { 0x8b05c415d3b7f278, 0x82517b74329ecb9b, 0x039cb279018f81f5, 0x01987053125b53db },
+    { 0xc320fcff3a06c511, 0x484fb5e1843f1880, 0xdc9ae7d01c62c530, 0x2f10ab0efa512b92 },
+    { 0x5d64a504fe9bffec, 0xed19d07dabb76b7e, 0x977a9f4b71d99111, 0x02fa88614007f547 },
+    { 0x2943d7b6b8349d0d, 0x812edb3b5e2e4372, 0xc3a3701d1090eeac, 0x291a21162fe8e38d },
+    { 0xc714d04fd8fbe975, 0xa33c057dcad08080, 0xe1404085c461d767, 0x00d5a654319b493d },
+    { 0xb3005bc019c8a207, 0x46da255a514cf64c, 0xa29f6479c4724e3c, 0x29586be93212ce7c },
+    { 0xec18c9953011ab08, 0xbb7ed5fb9a525c6a, 0xd94dc90816dcbfec, 0x367bd0d19432c1db },
+    { 0xcd63ae4856dc3e28, 0xe514041f24641059, 0x705f6d733bef4136, 0x136dccc9780b4c00 },
+    { 0x207a72b1a4161069, 0xe2e9433cf93fb0b7, 0x3d8dff5262a404dd, 0x2093f31638507e64 },
+    { 0x0bef3094330497d9, 0xf06e6d5686afd683, 0x78db5d19a3972c49, 0x008321d01df8b965 },
+    { 0xa138ff97ac2b5b92, 0xe02aee1ae411663a, 0x0557e3677ae3af83, 0x10235ad87b19ec1a },
+    { 0xd356f5ff3700a0c0, 0xe6a7def58835f46c, 0x471d741fcf99c051, 0x0d4a05410707425e },
+    { 0x95338c799afc236d, 0x1d7650316848bed9, 0x5bc572bef793f8f3, 0x187d2353e2543d4e },
+    { 0x3e8f073b14d8c33b, 0x9f9e68a1cf27a096, 0x7bb731c1fd7206da, 0x1653bc2fac1a113f },
+    { 0xa6648fba4f78ccc5, 0xef2fdf405b59b0c7, 0x8b5dec2830216249, 0x2a3368734adaf538 },
+    { 0xfb2077ccf772bb06, 0x7e49e4c82ffa5c1f, 0x6d5c05fcce9f6abe, 0x2bf4154503405ef0 },
+    { 0xc1edcce534c3b962, 0xb1ce7356cab40db5, 0xb93cfdf81437dade, 0x18199561b2e500d5 },
+    { 0x4584405783c25885, 0x6f92b393140907cf, 0x41e9058a6b5f13e8, 0x32ae075f0a1cefcf },
+    { 0xb3a1a1082484fd4e, 0x042d1f3aca309a62, 0xc45175b678bb7ffe, 0x18d01d8af28d4ce2 },
+    { 0x0f533b8b9e4c670b, 0x334a15a37324fdd2, 0xe12f24c21ee963bf, 0x2688267184fbb8c3 },
+    { 0x6e8d8cafd51341e4, 0x2d49f8e2b72b9c30, 0x255c0527762f037d, 0x27386c5f74c08281 },
+    { 0x3e0a58da859e96e7, 0x4b55ba945b2285d0, 0x24519ba62712d8f5, 0x08f60f224566183f },
+    { 0xaa29babbb913c469, 0x9a03d70e99bc13bc, 0xd814377797723d7b, 0x13b62aab56fc1e4e },
+    { 0x94f5acb7b57c3938, 0x65b7e8210cce6c0f, 0x6b3cdd6a9cbe972a, 0x13b56248ce23e8ea },
+    { 0x59481a3716bca8fc, 0x37377f5890f8f03e, 0x3a649eecf60b874e, 0x11ce8d73ed3f8706 },
+    { 0x21ed3d983fc0b79b, 0x038736a9e951e261, 0x8697d8aec45f137b, 0x038a9b2524d451b0 },
+    { 0xbee9c67f061b1d17, 0x0167f29638779a32, 0x7fee3ee5f03837de, 0x0951918695ff91aa },
+    { 0x12bfea7c4d01b325, 0xef20bc5fd787fec6, 0xdcf68df75a0d2b22, 0x323fe44d59fb10e5 },
+    { 0xbabed88695c21856, 0x3b53f2efa0274613, 0x0003dec0241d8e17, 0x2919437e0427fd52 },
+    { 0x3566d114e0694cc8, 0x1141bb415697c6f6, 0xc29b8987fd3ce731, 0x1bc9dbb41f23fc7e },
+    { 0xa2f28879bd3f23de, 0xdf18d894e4f2e0bd, 0x74fdaf5f199b936f, 0x042b5e883915da22 },
+    { 0xc4e9d19969f9b9bf, 0x770b78f8878d8491, 0x45d1a993f44b9752, 0x0b2e6af0570e683e },
+    { 0x1a3b83345476106b, 0x81739ac8186e35b3, 0x9137a83897ea67ed, 0x0531faadf2a5e19b },
+    { 0xfe46c3511f40fe98, 0xdee02067a2eabb24, 0xb82a7dd61ea58f21, 0x3efd1ba8dfb6cd1b },
+    { 0x55888211b5ef28da, 0xb026f5a7be628fdf, 0xb2393108a1584bd8, 0x1042301adacaeabc },
+    { 0x057f9ad144a11731, 0x34bc75755084ed41, 0xbe23671219e9ffef, 0x2652e49c78585989 },
+    { 0x280212e578c336b9, 0x75b9d81053911e62, 0xc6a188dfd31ff95c, 0x0935398224b8fe4f },
+    { 0xf618cdb613b0f2fc, 0x9a4713906fc33f4e, 0x6c63084f44f653b7, 0x27b090b02a496dc7 },
+    { 0x05a9a3f1942dfd12, 0x33b831aa6a3ca926, 0xfa5be2c23e648881, 0x28f75d33ec85d2cc },
+    { 0xc09e77210ec508e8, 0xc218b556759335ea, 0x632bbb3d0be93758, 0x01b0d21d7c18fe33 },
+    { 0xccf0e04d188c0c43, 0x05e011168dd79fbd, 0x4932149273aaf653, 0x23b15acecfc937d1 },
+    { 0x41230689c78d463a, 0xb61ef94835a3cd78, 0xbab1ab3b214c6da7, 0x09e12283c37cd607 },
+    { 0xb7fc33fc6943d1e5, 0xb80b6e9740c228df, 0x188dcceaf956c492, 0x01c59f0c6a2949f3 },
+    { 0xbc3bb5a04f09287e, 0xd067a8a60a4974fc, 0x0863a12558f7b234, 0x0a3bf19e003f9c2c },
+    { 0x7fdc5d2decfb7fb2, 0x89a99fe89b9352da, 0xedbcc4ceafc49b21, 0x2893ad5f09408d43 },
+    { 0xa541669e40ea968c, 0x58a85b3177799e66, 0x5e3df9eed4ce8465, 0x0bb4cb374f7e9890 },
+    { 0x63ab939839014a02, 0x63d3bc01e3c7892f, 0xc0af94bb4a32bf54, 0x1882feb48df991ed },
+    { 0x4deb503efe5e662c, 0x021b3e498805982c, 0x43762f9fe71b3f0a, 0x1264ff5603e15181 },
+    { 0x3f0d5c5972d8ee14, 0x6ad5ab196dd87204, 0x2da70c76081c4770, 0x02b384a6da31e375 },
+    { 0x45945ce5e696926e, 0x00ccbd2da8b55c9c, 0x4a689038809408c1, 0x05d0d008608e78f7 },
+    { 0x0a25775c886f6005, 0x2326b1b5178dbe32, 0xdce8037b8b89b9d5, 0x08b44265f3b2539c },
+    { 0x33fd4bedc102dfcc, 0x0efbe62d396187f3, 0xa3a44a28dc6a38d3, 0x2f6e47ec8bc9c4f9 },
+    { 0x79158ec8d582effa, 0x0e78f1365a79dbfb, 0x18c4fd0755f6af85, 0x033974ae1a69585f },
+    { 0x6b56175a58946d57, 0x65db9a6744606097, 0x007a689990459ba0, 0x3bcc66f84732f511 },
+    { 0xf14d712f2849b989, 0x0c05474126dcf5d1, 0x7fe630fe0cdfb6a3, 0x06f74e26e970a949 },
+    { 0xe55d48d3410586f0, 0x76332d47aea148c6, 0xc532f3dbf6f97bf2, 0x0ff185eaba17b8eb },
+    { 0xa974cf54bc9b8449, 0xbb629e7e4ebd33c4, 0x5faac6587eb98c51, 0x3a0e57456f43343b },
+    { 0x0b9101aae597fa69, 0x1ff5fecfbe25ad17, 0x54e20cd61f3a5439, 0x26228f896fbe1036 },
+    { 0xa1cb074966fdcfa6, 0x8078163aa0111867, 0x60236fe93f448f38, 0x0f6fcd51a05ba66b },
+    { 0xcfe2ae827827c1a1, 0x272e26853ecb2c49, 0xa5a51803538f9e61, 0x378953453339e70a },
+    { 0x835b1ec716ca7fca, 0xee57ff42e65ec4ee, 0xbd65d6108080c1cb, 0x19ed30c2df75ebfd },
+    { 0x11e7cdf3d5292d93, 0xb59ac14cad4e8eb5, 0x4ab5d8d0ce6b88a5, 0x2054379bb7ebca30 },
+    { 0xb0e5c32b9a3b8e3a, 0xde7e90748910b3ac, 0xc0105b37e6ee2624, 0x02ca3c6369c36389 },
+    { 0xc871514933714b19, 0x9bf9fb6d597e564f, 0xdec252e7d7012a4e, 0x16a45a4ca370ad3c },
+    { 0x714ce0b94377d26e, 0xd55630eefd8e8126, 0x8b3b12e182ec605d, 0x10fb5fd8d1674e22 },
+    { 0x5f7cf4d0584539f6, 0x82730aeb96d584db, 0x63905d58721713c1, 0x0e19e1c47be3df5b },
+    { 0x3864ee07a4c3852d, 0x22e53fc10c18e8da, 0x6376b690b4cab21e, 0x13dfb28c2901d6e8 },
+    { 0x0a4b543e5c1daba3, 0xa025cb2b7cd95d4c, 0x32c0e18e5737731e, 0x2fb55d7d23d1bc43 },
+    { 0x41108540b3142fb7, 0xd4681fbd37015446, 0x7ce6b5a97c799642, 0x0ee08fbd8e6d0588 },
+    { 0xe4c7d7d76d5d5f4d, 0xdb68a7e7e5202102, 0xea7090aca3119145, 0x0bcb18115e651f1f },
+    { 0xf5eac68c51081f95, 0xa79119aef4a10c9d, 0x00f5af6ba8dd6545, 0x1de654e1c39aca1a },
+    { 0x09a7c1bbb00b6cdd, 0x3e02c6f688866213, 0xc3a61b02d14f2ff5, 0x1bb3eff1401628d8 },
+    { 0xdafc59c318c14250, 0x43cc63c5de8f462b, 0xb03dc21d2329c7f6, 0x049e73f93f3cc7cc },
+    { 0x420b6d19720658bc, 0xaacc3ad2b5958a52, 0x3ab5c95e92ec5f75, 0x35a06b857df1f857 },
+    { 0x67dca40d89921c0b, 0x27294611f729539f, 0xd38fc3e183fe44cf, 0x1d850512b839cf3f },
+    { 0x83c328062c18448a, 0xd28fe9ccbdd6bb6f, 0x09345bab2649a6ed, 0x3fab7c133db46ff7 },
+    { 0xbdbde67a678a552b, 0xd8cdb577ab30738d, 0x00c503fc01e11627, 0x35b58aa838a40dfa },
+    { 0x576ac0441ae572cc, 0x23dc7fcaed3547aa, 0xa0913215a4880dba, 0x30636034b3dbf720 },
+    { 0x9050f6fb514396d7, 0x76fd97119acda0c8, 0x47129c33e97bbabd, 0x34cc4b5b7de0dd48 },
+    { 0x5696495c8a95c27d, 0x4f01cbbe635e3f73, 0x6e0a25ba38c50571, 0x2735875fbd100018 },
+    { 0xb184834de6b1377f, 0xcdb4ca5bd6b6c6b9, 0x9e1a1ff04ee5b059, 0x19c744dac01929aa },
+  },
+  // g^(-j * 2^24)
+  {
+    { 0x5b2b3e9cfffffffd, 0x992c350be3420567, 0xffffffffffffffff, 0x3fffffffffffffff },
+    { 0x0940888d0030605a, 0x44c675d32a49d764, 0x950421713cd180ae, 0x059d6129ed528c02 },
+    { 0x564b2b327bc921f6, 0x3d43357944bc8f48, 0x82ff6f4ab48fa15c, 0x2ff6af5196b7b9f1 },
+    { 0xc790c20f02ad47ac, 0x552972e19dcedb84, 0x02926afb669d9988, 0x36cd8ebddff702a8 },
+    { 0x97cb451444af06de, 0x0c3108dfb176ab4e, 0xeebbecdfd8ae23bb, 0x3d22244d542d2cd5 },
+    { 0x804fc15a38b930fb, 0x5a5f01d6b929b167, 0x1f2fdd0d1f55ca02, 0x068f01ebf09aed21 },
+    { 0x83df25161498be42, 0x647b737b23ae1542, 0x6413dc5cee0c9bb0, 0x201b205a00cb6d53 },
+    { 0xa674524694d82a52, 0xec52d44d79ce8b5d, 0x8d9f99a7865c5fce, 0x22ae433469a4315d },
+    { 0x8bfea7cd6d80bcb9, 0xb1d7554e94ae70b3, 0x88782d2088468d7a, 0x352938b7d671e816 },
+    { 0x71d20d500a16e24a, 0x17fa2116622ba7a6, 0x99349345c30a1b9d, 0x0ee4a68376fe4ae8 },
+    { 0xeaae732ccc54ad47, 0x8e2777e4568d396b, 0x2c04fd187dd4b44f, 0x18db2b89cfde4824 },
+    { 0xe214511a1ff2650e, 0x03db941d73b02567, 0xc7d753f966eaf06b, 0x23354a786e6a6f7d },
+    { 0x841fd52937831e77, 0x905725fc802ef041, 0xd60fffaa6b44c3ad, 0x3096cdf01695bbdb },
+    { 0x6b5e1dc754ec3f59, 0x5b988aa41bbc7c18, 0xe1fe793291bf7497, 0x1e132984482b6815 },
+    { 0x2ac30a9371292a82, 0xfdd9280fc930a331, 0xf4a718c3f193f053, 0x15fc96a716be34d8 },
+    { 0xb46af1b44e9aa197, 0xf2b2d96233ef774a, 0xa31d299c13b73b52, 0x0bb8f6d8f9b1e569 },
+    { 0x9c99d2f98f07725e, 0xa5a8e56f63e64ed0, 0x5bde7d8cad1907d4, 0x1839f546f8bb3507 },
+    { 0xcd142d92b8a3d41b, 0x2f69ced3b440eb7a, 0x50198ae6ce2a95b9, 0x3085fb1cbf0a534c },
+    { 0x695fc0a7ead4acb3, 0x9adfc168f13d7311, 0xf0ba52f367ec798c, 0x1bc834933782bf50 },
+    { 0x394281692d111fd9, 0xd9d50357bdf46a88, 0x1789ec3db0048246, 0x102ffb40d888ac87 },
+    { 0x899b20d4297de6c7, 0x2b4d9bd4922916d1, 0xf79b28d8226048f5, 0x3d99684006f82bf2 },
+    { 0x0158a5fc89a906a8, 0x238acbbdb5107e3b, 0x1c26bc95c866b2c2, 0x21fa12f9c088135f },
+    { 0xa478068dbfc3ffc8, 0xaf9f0f1d8dc908ba, 0x831e2ee134df5819, 0x12a9071fef2c49b5 },
+    { 0x40921a7980c6d1d4, 0x22e4ed0158f71644, 0x7a930011ecd2974e, 0x10bdd9d09bb8767c },
+    { 0x61711518cd464b67, 0xa1e2555871f2a894, 0x1664589e14a3838d, 0x0713c2833cb74c18 },
+    { 0x31f60fc955302eb2, 0x0e3cdc69f275feae, 0x4728685604c98d12, 0x2f9f33fa7dae4ce5 },
+    { 0xedbc96392f60dd69, 0x57258ee9f9e1449a, 0x88f857a0d10d5d62, 0x36c72fcfd41911f0 },
+    { 0x3e6ca376c68b5eec, 0x66c743c91d6cf80c, 0xb81bf0decb6ea5d2, 0x0cf941c382644142 },
+    { 0x87c0e91e50157552, 0x68eaba4ac292500a, 0xdfd5471c605cbd7b, 0x1b83b2e5fdabb61c },
+    { 0xfc00ca8b954b7e35, 0x61ed5ad075d6c7af, 0x85dda31b4ef4f62e, 0x1610f7f51a9981d7 },
+    { 0x287a23f4df7d1454, 0xaf39fdfabc955d81, 0x708eec9b712eaf9d, 0x3941f34133ee3518 },
+    { 0x1a4e07e031c2c9d4, 0x4d4fc24f8fcd97a2, 0x509862b3efc8090c, 0x26b6c16d09591d99 },
+    { 0xd23873d5f0a5b0e5, 0x2b522cd8e5968f0e, 0x1a7c767c3919f01a, 0x1877b00e1c71baff },
+    { 0x9ae03ebdf31ffbde, 0x496918ac20b8e9d7, 0xf58d0dfa12e8ad0f, 0x049dd25649525e3a },
+    { 0xc8ecc9da22e854f4, 0x70b24f633fec5db7, 0x6af5504f458aabcf, 0x043cde6de121151d },
+    { 0x239975032fbbb3fb, 0x5294436e47d85f7a, 0xe25c8a6d658641ce, 0x14eb26a2c403ca95 },
+    { 0xd6c79d8a1d14abb3, 0x504dc538eacbe423, 0xfb2331726c593602, 0x16535c36847e6b02 },
+    { 0x45ead2509179a67a, 0xb701f442a5939dcc, 0xe5c38248d9129efe, 0x11c9c3229f1283e7 },
+    { 0xca661c11df73c705, 0x5151227e4b477bd5, 0x71141febc69bc99b, 0x00e809679a77d729 },
+    { 0x7b75e547bc29b8f8, 0x4979ecb794e19a18, 0x27ea5cb2f9b75e21, 0x1acc8006198bc017 },
+    { 0x23f34b0756e9ad56, 0x60ffb77166a1b071, 0xe9ac482486c3d870, 0x0e4a0e4f7cb804a8 },
+    { 0x84da8729ccff40f5, 0xa1068db4d8d5dea7, 0x035b785325733bcc, 0x1a5834635091f4a6 },
+    { 0xad38a5a8e22f4465, 0xba864a5ed78e1147, 0x5a2971e41e6a78b1, 0x3091bf51e15c3a66 },
+    { 0x34c04ae562c7f7cb, 0x15c566510c0e4c19, 0xfb6eef10586b5d24, 0x1daf98d3c614f00d },
+    { 0xb0e20b559b0c2bdf, 0x047845fe811b90c2, 0x313935de97aa6f12, 0x16eafbf18e36f163 },
+    { 0xf9f30cdb33c438e9, 0xeebb970054c419a5, 0x055dd46f4d593931, 0x05fb0c652477f444 },
+    { 0x12826996d82796c4, 0x4085f1afcd620d12, 0x91705bb56eb5fc06, 0x153914491698b064 },
+    { 0xba17f42a8b427aa6, 0x475f681f666de8f4, 0x02df8ffb7bafb542, 0x02779122e1d14af9 },
+    { 0xf4a4dc2c94784899, 0x5eeac9f44bd028d9, 0x8ee0fba913170a76, 0x0fff0c1529f51ee9 },
+    { 0xd06f1b7d7ccb79df, 0x4cba2d227d52351d, 0x59321014d7fb8310, 0x36b7315f83d7f12a },
+    { 0x1fcdc44a13158596, 0x05fbd0f390740bbd, 0xeb4a3a4bb35a0e46, 0x387c6e558bce675d },
+    { 0x0e8ad44f84e40156, 0xb69fac791ede3cdd, 0x96d6fbe3c08691dc, 0x15412a66a421b806 },
+    { 0x41b4c40c820dc6ef, 0xefe28b7bcd3484ec, 0x1afc1f2bf5bb384d, 0x30489ea866f2003b },
+    { 0xf514db5a079f9572, 0xc670dc98c78d17a4, 0x2bbd4b082c399a53, 0x25184f60f1c168a9 },
+    { 0x1de761736645f923, 0x987946177d0739b1, 0xf9adca0e3f6c9d46, 0x1afc51c06c88b418 },
+    { 0xf1eb12ce2f7f2621, 0x66981f2fec879aa7, 0x6f98364a86e3daf4, 0x3ce2615664105cf8 },
+    { 0x64c37e4df578bbb7, 0x3e7501b86693a83b, 0x49bc0519a554097a, 0x1e9e58d6005e9078 },
+    { 0x393a40157bbe9f9b, 0xa582306d2e2989a4, 0x1f95934d0122c3d2, 0x2e7b00ea75552f50 },
+    { 0xce1236b4a85a9a71, 0x5dbc6f77d7f54fe3, 0x61aabedf7979fa23, 0x2de5a6e3c67638d9 },
+    { 0xeefb0dabd4f92f4d, 0x56deb4ac8c11fb96, 0x6e523917f039cf5a, 0x2c98c81fe918a131 },
+    { 0x55689261a045fc2d, 0x736f321b3387f293, 0xb52873e3c73be408, 0x14aeb486171ec953 },
+    { 0x4612454206e729d4, 0xde718ef6f3e55c51, 0xcf7348df2481028f, 0x31f012c05094e736 },
+    { 0x5accdac3c7caccb1, 0x9e40a6a4edcdd954, 0x0c3044dfd09e3ebd, 0x11bbaa4d33867b26 },
+    { 0x394b068f8e09b76c, 0x01e02547f22763e9, 0x136324c17a1ae9e5, 0x26c9bac88db987bc },
+    { 0xf2f43789afbee374, 0x5f64d6eeae4efd83, 0x60a01815861d3074, 0x00478b6e65f4fbe9 },
+    { 0xa5caa00128cadd6c, 0xb6b0803e3416eb46, 0xc38acb9aa7342746, 0x17ecadb7d96e7d0a },
+    { 0x7ccb490c7df87d45, 0x1bf8d419ffdfaf8d, 0x743ea05be6bba2f5, 0x31ae54cd76a0f9f2 },
+    { 0xad93ed4e04f238f0, 0x2cd310bc8eff2440, 0x217970fdcb88da3c, 0x28a30e629823f63a },
+    { 0xc32c56a75f8593f6, 0xad0d0be020e7b919, 0xdffce9194f21301a, 0x313c7d15aaf104f2 },
+    { 0x075f35f50c725807, 0xedbe517f0c4f0c5e, 0x688e9b9f6cf641dd, 0x020c0ae432c97ffa },
+    { 0x678f62b65bc85798, 0xe62faf078808a59a, 0x60650058779a70b8, 0x2f67159d9590e26a },
+    { 0xf8dc33bfe98e0d17, 0xc7d932f2b2efbec8, 0x86275220339c2cba, 0x190a93cc5709c85a },
+    { 0xff488400ba7111c4, 0x37f0096e0b4b2858, 0xb0d2c12588b382ea, 0x27eb07f6f554cb21 },
+    { 0x95306954d844b643, 0xa92c81f55f69feca, 0xbd90964bb48aa401, 0x259f9372bc30149e },
+    { 0x0bdac4078a5b6955, 0x60dfcae20c8b0984, 0x03a40187e5578a88, 0x14704d0bec084ad5 },
+    { 0xf30ce4b730a7c4ff, 0x055b763eccb9c1d2, 0xaa25c44d39843677, 0x1a4091af7d107b8b },
+    { 0xae497b463fcc9e58, 0x4bbeb876a552f7aa, 0xdadaed1cac7f541d, 0x03ea9b32dc944bbb },
+    { 0xb14fe7b980a8b806, 0x0302fc76f4bbecf3, 0xffb644992e9c742e, 0x2579b8e08a7d8d4b },
+    { 0xd4ed979fa2da8461, 0xce1ec4b126991486, 0x8b22a27d912951b1, 0x3f3cb02fcb66320f },
+    { 0xb64c999147a8d73f, 0xfee8eb32ca3a297c, 0xb5f2aba7b2c17cf3, 0x197d4578ea975ce4 },
+    { 0x6c24f75c078a8920, 0x603527ca9c2ab2a8, 0x965783074453b6bd, 0x153b9d6b932b3f9a },
+    { 0x83b766cdf1bc21a0, 0x9845274a5ebda12a, 0x4e2660a55310a4b9, 0x27716069e195240e },
+    { 0xffdd13492b206b2a, 0xe89215dcb07fdac7, 0xd808c665f1e0b614, 0x1b25c3841048c915 },
+    { 0xce3cb649730bf6f2, 0xc541ea73baa270e4, 0x5abc0b400a98ae13, 0x2b2646b6dddfc03c },
+    { 0x73e8bcf1a0292c29, 0xefa8faa2a0b3fb0d, 0xacb43521c97a4752, 0x051927ec1c3b511f },
+    { 0xbe04989a90deada3, 0x4f0a1ad9e976b157, 0x632bd891c1fe07de, 0x2efc9bc2fd94dea2 },
+    { 0x47255c464bce1c44, 0x6664b3fc99072599, 0x6cabd41de9ded4a6, 0x234916d718818651 },
+    { 0x35caa9d20d74361d, 0x9daae74070a14fcc, 0xdd31630e1e01438f, 0x0d107fdcff103a79 },
+    { 0x43520e93ed09167a, 0x9ae6ffc6a97f70b9, 0x8c12eb7ed65ca351, 0x2246f1baea724a10 },
+    { 0x97f824c2e60af33c, 0x47afbffd3d70cf8e, 0xb3955215aef349e2, 0x0f128b8a18709711 },
+    { 0xc586a779410e876f, 0x5f76b9bbb0dc8639, 0xeb5a285949d10583, 0x3ca7c41ebd820bfc },
+    { 0xa49b6d835bd8319a, 0x5a37c910faf28b4f, 0xf8b82ed034f3e017, 0x2ebab16d16e06ee9 },
+    { 0x8b36a7fa0c1901f3, 0x182b4adb9d3d64fd, 0xeaca2e3200241198, 0x373823ccdeba7941 },
+    { 0x1ec58faf60a863ba, 0xe07982402844eeaf, 0xf1efd79e8cd9a10d, 0x1ae8e120b43a94f8 },
+    { 0xfca2641619d8e587, 0x8e8bf42877dc97ad, 0x2be7e1a820a6c3d8, 0x3172d86a45530763 },
+    { 0x7f497c9dd7bc0588, 0x8f05066233f065d2, 0x51a4b74592024065, 0x091403ef7567b953 },
+    { 0xda24faa4080af5e8, 0x15a70c3e98a731e9, 0x220daee65d1bdaa8, 0x371ac208f3b20c09 },
+    { 0x8faedba99d69b74c, 0xa7e2daad491c7c6e, 0xd416054c174e79e0, 0x1dab77b52d2c1177 },
+    { 0x6949967402261dc9, 0xf2b4abe8c487d70a, 0xdc1403400782c9b2, 0x0070f2c215e6b019 },
+    { 0x91b33e43a2950773, 0x95863b9fe44bbed7, 0x252e22609fc75b6f, 0x131b059503a7c655 },
+    { 0xaa689bf454b05140, 0x01636cda5b58bafb, 0xaa896cb2df439e54, 0x1d4ccc797b141e11 },
+    { 0x6f102712f6a32228, 0xeb8b69d236c52bef, 0x98496320d00fb2ca, 0x15394dffd6272bd3 },
+    { 0x2ad244e43bfe58ec, 0x2d6bd1191776111c, 0x9638f21106aadda4, 0x1c82c5ee4655a0a0 },
+    { 0x2598d6144afe15b1, 0xdc0ccb71908a4bd0, 0xf19174a441e2ee58, 0x2dc2ea36fb128ec9 },
+    { 0xdc00fad6c5d180fe, 0x9c5a62ee9ba4e6f7, 0x10f4063d2688b4bc, 0x31f55ed0929795cb },
+    { 0x6fe40e02a6a93db1, 0x15dd965e9f5d5daf, 0x400159d9cbdb1b1c, 0x04d3921d6ab26188 },
+    { 0x7abf87409515a69a, 0xebec85f74a621a5d, 0x1e2c747212e1fa5a, 0x1ba891e504b874f0 },
+    { 0x07e38c80fc09f554, 0xa22f5e6da4ccac47, 0xb33aee1b5f3dff93, 0x3ef0ece4e4149abb },
+    { 0xfc83ef5044fd9c55, 0x0c0287bde3451e76, 0x23acc05b0fc77b52, 0x38259ce9934d650a },
+    { 0x01484ab7243ce693, 0xe3795748f297288b, 0x0931e7b096893a53, 0x21b723fb7789356f },
+    { 0x0ab1f76ef02ec398, 0x55a270998d94c114, 0xf0f03e80307bba25, 0x34580f25b375b240 },
+    { 0x0c65080d57d752f3, 0xd8126c9a8f9779fb, 0x3bd6ff71358b5c6c, 0x27c2b4f7200c7d04 },
+    { 0xe0bdd4d09b538e6d, 0xdcfc21beb5d736dc, 0x6ba93af276af6b82, 0x0346c83646913a64 },
+    { 0x0724d002fb716051, 0x60264e1d6fb68cc3, 0x8e4843bf6fcecb12, 0x2fdf2e3fcb6c83dd },
+    { 0x0b7e6ec3930aa155, 0x864196491c1a50fc, 0xcba315a312ea0d01, 0x06065629fde859e7 },
+    { 0xe95fbe91206eef18, 0x60898e303aef0b63, 0xb62881aec4f87e9c, 0x39753e9ec07accb6 },
+    { 0xdf2fddeedf74baee, 0xcde62507bb7661b4, 0xac2eb6b67c0fd699, 0x1d0679f117c6bdfe },
+    { 0x1404a0c70bf306ab, 0x3e98a32aad4fca04, 0x987e144671b1ea62, 0x0113a4edd364a897 },
+    { 0xa4185e4dc6c51b6e, 0x79dd175154bba450, 0x9080603af6423479, 0x1e44780acdab1052 },
+    { 0x64de5d69668435f7, 0x7c3829c108a48e2d, 0x5fdac6da2000ac05, 0x1436d63ebeeabce8 },
+    { 0xa43e7fef9afb8909, 0x6c0b78f6d9598420, 0x4dae9914e85c004f, 0x1cfcd726ffdaa8c6 },
+    { 0x4c8145571fbef38b, 0x7515815d10e986bb, 0xd6927db97ebffe02, 0x1199911ac5955b2a },
+    { 0xd991e17177b60459, 0xf989638c572dba9b, 0x049aa409ee32c7fc, 0x189862200d5fd92f },
+    { 0x6c5b8cb1bb350cd6, 0x51c828bea076139e, 0xab2ac2af00ed4719, 0x052bbb6a68dc128a },
+    { 0x760baec3c0f8b671, 0xcac016479cfdd86e, 0x530a62ad1562efde, 0x096708c8c5a903d5 },
+    { 0xe77feba1af1c4026, 0x0efc7b1aa8e199a0, 0x9ea71ba9c6a91f67, 0x3ab4695c357923b3 },
+    { 0x4e3e1fef05eee40d, 0xc7a39d851a32ef9f, 0xe28b59d6f822ff15, 0x2f2db5ba68caf1ba },
+    { 0xfcbaaa55c42d69dc, 0xda837352e729a2fa, 0x4fabf2ee592e382f, 0x1befbe295693d8b3 },
+    { 0x311bac8400000004, 0x891a63f02652a376, 0x0000000000000000, 0x0000000000000000 },
+    { 0x83066293ffcf9fa7, 0xdd802328df4ad179, 0x6afbde8ec32e7f51, 0x3a629ed612ad73fd },
+    { 0x35fbbfee8436de0b, 0xe5036382c4d81995, 0x7d0090b54b705ea3, 0x100950ae6948460e },
+    { 0xc4b62911fd52b855, 0xcd1d261a6bc5cd58, 0xfd6d950499626677, 0x093271422008fd57 },
+    { 0xf47ba60cbb50f923, 0x1615901c581dfd8e, 0x114413202751dc45, 0x02dddbb2abd2d32a },
+    { 0x0bf729c6c746cf06, 0xc7e79725506af776, 0xe0d022f2e0aa35fd, 0x3970fe140f6512de },
+    { 0x0867c60aeb6741bf, 0xbdcb2580e5e6939b, 0x9bec23a311f3644f, 0x1fe4dfa5ff3492ac },
+    { 0xe5d298da6b27d5af, 0x35f3c4ae8fc61d7f, 0x7260665879a3a031, 0x1d51bccb965bcea2 },
+    { 0x00484353927f4348, 0x706f43ad74e6382a, 0x7787d2df77b97285, 0x0ad6c748298e17e9 },
+    { 0x1a74ddd0f5e91db7, 0x0a4c77e5a7690137, 0x66cb6cba3cf5e463, 0x311b597c8901b517 },
+    { 0xa19877f433ab52ba, 0x941f2117b3076f71, 0xd3fb02e7822b4bb0, 0x2724d4763021b7db },
+    { 0xaa329a06e00d9af3, 0x1e6b04de95e48375, 0x3828ac0699150f95, 0x1ccab58791959082 },
+    { 0x082715f7c87ce18a, 0x91ef72ff8965b89c, 0x29f0005594bb3c52, 0x0f69320fe96a4424 },
+    { 0x20e8cd59ab13c0a8, 0xc6ae0e57edd82cc5, 0x1e0186cd6e408b68, 0x21ecd67bb7d497ea },
+    { 0x6183e08d8ed6d57f, 0x246d70ec406405ac, 0x0b58e73c0e6c0fac, 0x2a036958e941cb27 },
+    { 0xd7dbf96cb1655e6a, 0x2f93bf99d5a53192, 0x5ce2d663ec48c4ad, 0x34470927064e1a96 },
+    { 0xefad182770f88da3, 0x7c9db38ca5ae5a0c, 0xa421827352e6f82b, 0x27c60ab90744caf8 },
+    { 0xbf32bd8e475c2be6, 0xf2dcca285553bd62, 0xafe6751931d56a46, 0x0f7a04e340f5acb3 },
+    { 0x22e72a79152b534e, 0x8766d793185735cc, 0x0f45ad0c98138673, 0x2437cb6cc87d40af },
+    { 0x530469b7d2eee028, 0x487195a44ba03e55, 0xe87613c24ffb7db9, 0x2fd004bf27775378 },
+    { 0x02abca4cd682193a, 0xf6f8fd27776b920c, 0x0864d727dd9fb70a, 0x026697bff907d40d },
+    { 0x8aee45247656f959, 0xfebbcd3e54842aa2, 0xe3d9436a37994d3d, 0x1e05ed063f77eca0 },
+    { 0xe7cee493403c0039, 0x72a789de7bcba022, 0x7ce1d11ecb20a7e6, 0x2d56f8e010d3b64a },
+    { 0x4bb4d0a77f392e2d, 0xff61abfab09d9299, 0x856cffee132d68b1, 0x2f42262f64478983 },
+    { 0x2ad5d60832b9b49a, 0x806443a397a20049, 0xe99ba761eb5c7c72, 0x38ec3d7cc348b3e7 },
+    { 0x5a50db57aacfd14f, 0x1409bc92171eaa2f, 0xb8d797a9fb3672ee, 0x1060cc058251b31a },
+    { 0x9e8a54e7d09f2298, 0xcb210a120fb36442, 0x7707a85f2ef2a29d, 0x0938d0302be6ee0f },
+    { 0x4dda47aa3974a115, 0xbb7f5532ec27b0d1, 0x47e40f2134915a2d, 0x3306be3c7d9bbebd },
+    { 0x04860202afea8aaf, 0xb95bdeb1470258d3, 0x202ab8e39fa34284, 0x247c4d1a025449e3 },
+    { 0x904620956ab481cc, 0xc0593e2b93bde12d, 0x7a225ce4b10b09d1, 0x29ef080ae5667e28 },
+    { 0x63ccc72c2082ebad, 0x730c9b014cff4b5c, 0x8f7113648ed15062, 0x06be0cbecc11cae7 },
+    { 0x71f8e340ce3d362d, 0xd4f6d6ac79c7113b, 0xaf679d4c1037f6f3, 0x19493e92f6a6e266 },
+    { 0xba0e774b0f5a4f1c, 0xf6f46c2323fe19ce, 0xe5838983c6e60fe5, 0x27884ff1e38e4500 },
+    { 0xf166ac630ce00423, 0xd8dd804fe8dbbf05, 0x0a72f205ed1752f0, 0x3b622da9b6ada1c5 },
+    { 0xc35a2146dd17ab0d, 0xb1944998c9a84b25, 0x950aafb0ba755430, 0x3bc321921edeeae2 },
+    { 0x68ad761dd0444c06, 0xcfb2558dc1bc4963, 0x1da375929a79be31, 0x2b14d95d3bfc356a },
+    { 0xb57f4d96e2eb544e, 0xd1f8d3c31ec8c4b9, 0x04dcce8d93a6c9fd, 0x29aca3c97b8194fd },
+    { 0x465c18d06e865987, 0x6b44a4b964010b11, 0x1a3c7db726ed6101, 0x2e363cdd60ed7c18 },
+    { 0xc1e0cf0f208c38fc, 0xd0f5767dbe4d2d07, 0x8eebe01439643664, 0x3f17f698658828d6 },
+    { 0x10d105d943d64709, 0xd8ccac4474b30ec5, 0xd815a34d0648a1de, 0x25337ff9e6743fe8 },
+    { 0x6853a019a91652ab, 0xc146e18aa2f2f86c, 0x1653b7db793c278f, 0x31b5f1b08347fb57 },
+    { 0x076c63f73300bf0c, 0x81400b4730beca36, 0xfca487acda8cc433, 0x25a7cb9caf6e0b59 },
+    { 0xdf0e45781dd0bb9c, 0x67c04e9d32069795, 0xa5d68e1be195874e, 0x0f6e40ae1ea3c599 },
+    { 0x5786a03b9d380836, 0x0c8132aafd865cc4, 0x049110efa794a2dc, 0x2250672c39eb0ff2 },
+    { 0xdb64dfcb64f3d422, 0x1dce52fd8879181a, 0xcec6ca21685590ee, 0x2915040e71c90e9c },
+    { 0x9253de45cc3bc718, 0x338b01fbb4d08f37, 0xfaa22b90b2a6c6ce, 0x3a04f39adb880bbb },
+    { 0x79c4818a27d8693d, 0xe1c0a74c3c329bcb, 0x6e8fa44a914a03f9, 0x2ac6ebb6e9674f9b },
+    { 0xd22ef6f674bd855b, 0xdae730dca326bfe8, 0xfd20700484504abd, 0x3d886edd1e2eb506 },
+    { 0x97a20ef46b87b768, 0xc35bcf07bdc48003, 0x711f0456ece8f589, 0x3000f3ead60ae116 },
+    { 0xbbd7cfa383348622, 0xd58c6bd98c4273bf, 0xa6cdefeb28047cef, 0x0948cea07c280ed5 },
+    { 0x6c7926d6ecea7a6b, 0x1c4ac80879209d20, 0x14b5c5b44ca5f1ba, 0x078391aa743198a2 },
+    { 0x7dbc16d17b1bfeab, 0x6ba6ec82eab66c00, 0x6929041c3f796e23, 0x2abed5995bde47f9 },
+    { 0x4a9227147df23912, 0x32640d803c6023f1, 0xe503e0d40a44c7b2, 0x0fb76157990dffc4 },
+    { 0x97320fc6f8606a8f, 0x5bd5bc6342079138, 0xd442b4f7d3c665ac, 0x1ae7b09f0e3e9756 },
+    { 0x6e5f89ad99ba06de, 0x89cd52e48c8d6f2c, 0x065235f1c09362b9, 0x2503ae3f93774be7 },
+    { 0x9a5bd852d080d9e0, 0xbbae79cc1d0d0e35, 0x9067c9b5791c250b, 0x031d9ea99befa307 },
+    { 0x27836cd30a87444a, 0xe3d19743a30100a2, 0xb643fae65aabf685, 0x2161a729ffa16f87 },
+    { 0x530cab0b84416066, 0x7cc4688edb6b1f39, 0xe06a6cb2fedd3c2d, 0x1184ff158aaad0af },
+    { 0xbe34b46c57a56590, 0xc48a2984319f58f9, 0x9e554120868605dc, 0x121a591c3989c726 },
+    { 0x9d4bdd752b06d0b4, 0xcb67e44f7d82ad46, 0x91adc6e80fc630a5, 0x136737e016e75ece },
+    { 0x36de58bf5fba03d4, 0xaed766e0d60cb64a, 0x4ad78c1c38c41bf7, 0x2b514b79e8e136ac },
+    { 0x4634a5def918d62d, 0x43d50a0515af4c8c, 0x308cb720db7efd70, 0x0e0fed3faf6b18c9 },
+    { 0x317a105d38353350, 0x8405f2571bc6cf89, 0xf3cfbb202f61c142, 0x2e4455b2cc7984d9 },
+    { 0x52fbe49171f64895, 0x206673b4176d44f4, 0xec9cdb3e85e5161b, 0x1936453772467843 },
+    { 0x9952b39750411c8d, 0xc2e1c20d5b45ab59, 0x9f5fe7ea79e2cf8b, 0x3fb874919a0b0416 },
+    { 0xe67c4b1fd7352295, 0x6b9618bdd57dbd96, 0x3c75346558cbd8b9, 0x28135248269182f5 },
+    { 0x0f7ba214820782bc, 0x064dc4e209b4f950, 0x8bc15fa419445d0b, 0x0e51ab32895f060d },
+    { 0xdeb2fdd2fb0dc711, 0xf573883f7a95849c, 0xde868f02347725c3, 0x175cf19d67dc09c5 },
+    { 0xc91a9479a07a6c0b, 0x75398d1be8acefc3, 0x200316e6b0decfe5, 0x0ec382ea550efb0d },
+    { 0x84e7b52bf38da7fa, 0x3488477cfd459c7f, 0x977164609309be22, 0x3df3f51bcd368005 },
+    { 0x24b7886aa437a869, 0x3c16e9f4818c0343, 0x9f9affa788658f47, 0x1098ea626a6f1d95 },
+    { 0x936ab7611671f2ea, 0x5a6d660956a4ea14, 0x79d8addfcc63d345, 0x26f56c33a8f637a5 },
+    { 0x8cfe6720458eee3d, 0xea568f8dfe498084, 0x4f2d3eda774c7d15, 0x1814f8090aab34de },
+    { 0xf71681cc27bb49be, 0x791a1706aa2aaa12, 0x426f69b44b755bfe, 0x1a606c8d43cfeb61 },
+    { 0x806c271975a496ac, 0xc166ce19fd099f59, 0xfc5bfe781aa87577, 0x2b8fb2f413f7b52a },
+    { 0x993a0669cf583b02, 0x1ceb22bd3cdae70a, 0x55da3bb2c67bc989, 0x25bf6e5082ef8474 },
+    { 0xddfd6fdac03361a9, 0xd687e0856441b132, 0x252512e35380abe2, 0x3c1564cd236bb444 },
+    { 0xdaf703677f5747fb, 0x1f439c8514d8bbe9, 0x0049bb66d1638bd2, 0x1a86471f758272b4 },
+    { 0xb75953815d257ba0, 0x5427d44ae2fb9456, 0x74dd5d826ed6ae4e, 0x00c34fd03499cdf0 },
+    { 0xd5fa518fb85728c2, 0x235dadc93f5a7f60, 0x4a0d54584d3e830c, 0x2682ba871568a31b },
+    { 0x2021f3c4f87576e1, 0xc21171316d69f635, 0x69a87cf8bbac4942, 0x2ac462946cd4c065 },
+    { 0x088f84530e43de61, 0x8a0171b1aad707b3, 0xb1d99f5aacef5b46, 0x188e9f961e6adbf1 },
+    { 0x8c69d7d7d4df94d7, 0x39b4831f5914ce15, 0x27f7399a0e1f49eb, 0x24da3c7befb736ea },
+    { 0xbe0a34d78cf4090f, 0x5d04ae884ef237f8, 0xa543f4bff56751ec, 0x14d9b94922203fc3 },
+    { 0x185e2e2f5fd6d3d8, 0x329d9e5968e0add0, 0x534bcade3685b8ad, 0x3ae6d813e3c4aee0 },
+    { 0xce4252866f21525e, 0xd33c7e22201df785, 0x9cd4276e3e01f821, 0x1103643d026b215d },
+    { 0x45218edab431e3bd, 0xbbe1e4ff708d8344, 0x93542be216212b59, 0x1cb6e928e77e79ae },
+    { 0x567c414ef28bc9e4, 0x849bb1bb98f35911, 0x22ce9cf1e1febc70, 0x32ef802300efc586 },
+    { 0x48f4dc8d12f6e987, 0x875f993560153824, 0x73ed148129a35cae, 0x1db90e45158db5ef },
+    { 0xf44ec65e19f50cc5, 0xda96d8fecc23d94e, 0x4c6aadea510cb61d, 0x30ed7475e78f68ee },
+    { 0xc6c043a7bef17892, 0xc2cfdf4058b822a3, 0x14a5d7a6b62efa7c, 0x03583be1427df403 },
+    { 0xe7ab7d9da427ce67, 0xc80ecfeb0ea21d8d, 0x0747d12fcb0c1fe8, 0x11454e92e91f9116 },
+    { 0x01104326f3e6fe0e, 0x0a1b4e206c5743e0, 0x1535d1cdffdbee68, 0x08c7dc33214586be },
+    { 0x6d815b719f579c47, 0x41cd16bbe14fba2e, 0x0e10286173265ef2, 0x25171edf4bc56b07 },
+    { 0x8fa4870ae6271a7a, 0x93baa4d391b8112f, 0xd4181e57df593c27, 0x0e8d2795baacf89c },
+    { 0x0cfd6e832843fa79, 0x93419299d5a4430b, 0xae5b48ba6dfdbf9a, 0x36ebfc108a9846ac },
+    { 0xb221f07cf7f50a19, 0x0c9f8cbd70ed76f3, 0xddf25119a2e42558, 0x08e53df70c4df3f6 },
+    { 0xfc980f77629648b5, 0x7a63be4ec0782c6e, 0x2be9fab3e8b1861f, 0x2254884ad2d3ee88 },
+    { 0x22fd54acfdd9e238, 0x2f91ed13450cd1d3, 0x23ebfcbff87d364d, 0x3f8f0d3dea194fe6 },
+    { 0xfa93acdd5d6af88e, 0x8cc05d5c2548ea05, 0xdad1dd9f6038a490, 0x2ce4fa6afc5839aa },
+    { 0xe1de4f2cab4faec1, 0x20e32c21ae3bede1, 0x5576934d20bc61ac, 0x22b3338684ebe1ee },
+    { 0x1d36c40e095cddd9, 0x36bb2f29d2cf7cee, 0x67b69cdf2ff04d35, 0x2ac6b20029d8d42c },
+    { 0x6174a63cc401a715, 0xf4dac7e2f21e97c1, 0x69c70deef955225b, 0x237d3a11b9aa5f5f },
+    { 0x66ae150cb501ea50, 0x4639cd8a790a5d0d, 0x0e6e8b5bbe1d11a7, 0x123d15c904ed7136 },
+    { 0xb045f04a3a2e7f03, 0x85ec360d6defc1e5, 0xef0bf9c2d9774b43, 0x0e0aa12f6d686a34 },
+    { 0x1c62dd1e5956c250, 0x0c69029d6a374b2e, 0xbffea6263424e4e4, 0x3b2c6de2954d9e77 },
+    { 0x118763e06aea5967, 0x365a1304bf328e80, 0xe1d38b8ded1e05a5, 0x24576e1afb478b0f },
+    { 0x84635ea003f60aad, 0x80173a8e64c7fc96, 0x4cc511e4a0c2006c, 0x010f131b1beb6544 },
+    { 0x8fc2fbd0bb0263ac, 0x1644113e264f8a66, 0xdc533fa4f03884ae, 0x07da63166cb29af5 },
+    { 0x8afea069dbc3196e, 0x3ecd41b316fd8052, 0xf6ce184f6976c5ac, 0x1e48dc048876ca90 },
+    { 0x8194f3b20fd13c69, 0xcca428627bffe7c9, 0x0f0fc17fcf8445da, 0x0ba7f0da4c8a4dbf },
+    { 0x7fe1e313a828ad0e, 0x4a342c6179fd2ee2, 0xc429008eca74a393, 0x183d4b08dff382fb },
+    { 0xab89165064ac7194, 0x454a773d53bd7200, 0x9456c50d8950947d, 0x3cb937c9b96ec59b },
+    { 0x85221b1e048e9fb0, 0xc2204ade99de1c1a, 0x71b7bc40903134ed, 0x1020d1c034937c22 },
+    { 0x80c87c5d6cf55eac, 0x9c0502b2ed7a57e1, 0x345cea5ced15f2fe, 0x39f9a9d60217a618 },
+    { 0xa2e72c8fdf9110e9, 0xc1bd0acbcea59d79, 0x49d77e513b078163, 0x068ac1613f853349 },
+    { 0xad170d32208b4513, 0x546073f44e1e4728, 0x53d1494983f02966, 0x22f9860ee8394201 },
+    { 0x78424a59f40cf956, 0xe3adf5d15c44ded9, 0x6781ebb98e4e159d, 0x3eec5b122c9b5768 },
+    { 0xe82e8cd3393ae493, 0xa86981aab4d9048c, 0x6f7f9fc509bdcb86, 0x21bb87f53254efad },
+    { 0x27688db7997bca0a, 0xa60e6f3b00f01ab0, 0xa0253925dfff53fa, 0x2bc929c141154317 },
+    { 0xe8086b31650476f8, 0xb63b2005303b24bc, 0xb25166eb17a3ffb0, 0x230328d900255739 },
+    { 0x3fc5a5c9e0410c76, 0xad31179ef8ab2222, 0x296d8246814001fd, 0x2e666ee53a6aa4d5 },
+    { 0xb2b509af8849fba8, 0x28bd356fb266ee41, 0xfb655bf611cd3803, 0x27679ddff2a026d0 },
+    { 0x1feb5e6f44caf32b, 0xd07e703d691e953f, 0x54d53d50ff12b8e6, 0x3ad444959723ed75 },
+    { 0x163b3c5d3f074990, 0x578682b46c96d06f, 0xacf59d52ea9d1021, 0x3698f7373a56fc2a },
+    { 0xa4c6ff7f50e3bfdb, 0x134a1de160b30f3c, 0x6158e4563956e099, 0x054b96a3ca86dc4c },
+    { 0x3e08cb31fa111bf4, 0x5aa2fb76ef61b93e, 0x1d74a62907dd00ea, 0x10d24a4597350e45 },
+    { 0x8f8c40cb3bd29625, 0x47c325a9226b05e2, 0xb0540d11a6d1c7d0, 0x241041d6a96c274c },
+  },
+};
+
+const uint64_t fiat_pasta_fq_sqrt_dlog_keys[PASTA_SQRT_DLOG_SLOTS] = {
+  0xeaae732ccc54ad47, 0x8afea069dbc3196e, 0x0724d002fb716051, 0xe0bdd4d09b538e6d,
+  0x6f102712f6a32228, 0x1fcdc44a13158596, 0x8aee45247656f959, 0x0000000000000000,
+  0xaa329a06e00d9af3, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0xf47ba60cbb50f923, 0x118763e06aea5967, 0x6183e08d8ed6d57f,
+  0x71d20d500a16e24a, 0xdc00fad6c5d180fe, 0xedbc96392f60dd69, 0x9d4bdd752b06d0b4,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0xba0e774b0f5a4f1c,
+  0x0bf729c6c746cf06, 0x35caa9d20d74361d, 0x0000000000000000, 0x0000000000000000,
+  0x1de761736645f923, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x899b20d4297de6c7, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x6c24f75c078a8920, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0xca661c11df73c705, 0x0000000000000000, 0x45218edab431e3bd,
+  0x185e2e2f5fd6d3d8, 0xd7dbf96cb1655e6a, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0xfca2641619d8e587, 0x0000000000000000,
+  0x0000000000000000, 0x83b766cdf1bc21a0, 0x0000000000000000, 0xe82e8cd3393ae493,
+  0x6853a019a91652ab, 0x0000000000000000, 0x8f8c40cb3bd29625, 0x0000000000000000,
+  0x83066293ffcf9fa7, 0x0000000000000000, 0x71f8e340ce3d362d, 0x0000000000000000,
+  0xf44ec65e19f50cc5, 0x97320fc6f8606a8f, 0x8faedba99d69b74c, 0x0000000000000000,
+  0xad38a5a8e22f4465, 0x0000000000000000, 0x0000000000000000, 0x0ab1f76ef02ec398,
+  0x35fbbfee8436de0b, 0xbe0a34d78cf4090f, 0x0000000000000000, 0x0000000000000000,
+  0xbf32bd8e475c2be6, 0xa2e72c8fdf9110e9, 0x075f35f50c725807, 0x0000000000000000,
+  0xa5caa00128cadd6c, 0x0000000000000000, 0xf8dc33bfe98e0d17, 0xb221f07cf7f50a19,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0xf166ac630ce00423, 0x80c87c5d6cf55eac, 0x0000000000000000, 0x0000000000000000,
+  0xc35a2146dd17ab0d, 0x806c271975a496ac, 0x287a23f4df7d1454, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0xdeb2fdd2fb0dc711,
+  0xefad182770f88da3, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0xdb64dfcb64f3d422, 0x24b7886aa437a869, 0x0000000000000000, 0x10d105d943d64709,
+  0xb14fe7b980a8b806, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x48f4dc8d12f6e987, 0xa674524694d82a52, 0x0000000000000000,
+  0x78424a59f40cf956, 0xb64c999147a8d73f, 0x0000000000000000, 0xbe34b46c57a56590,
+  0x0000000000000000, 0x530cab0b84416066, 0x4a9227147df23912, 0xfc00ca8b954b7e35,
+  0x0000000000000000, 0x0000000000000000, 0x2598d6144afe15b1, 0x311bac8400000004,
+  0x55689261a045fc2d, 0x7f497c9dd7bc0588, 0x0000000000000000, 0x0000000000000000,
+  0x83df25161498be42, 0x8cfe6720458eee3d, 0x6c5b8cb1bb350cd6, 0xf2f43789afbee374,
+  0x0000000000000000, 0x3e08cb31fa111bf4, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0xddfd6fdac03361a9, 0xd06f1b7d7ccb79df, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0xb57f4d96e2eb544e, 0x076c63f73300bf0c, 0x0000000000000000,
+  0x2ad5d60832b9b49a, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0xf71681cc27bb49be, 0x0000000000000000, 0x0000000000000000, 0x12826996d82796c4,
+  0x3e6ca376c68b5eec, 0x317a105d38353350, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0xe8086b31650476f8,
+  0x0000000000000000, 0xc6c043a7bef17892, 0xf30ce4b730a7c4ff, 0x34c04ae562c7f7cb,
+  0x6949967402261dc9, 0x0000000000000000, 0x3fc5a5c9e0410c76, 0x20e8cd59ab13c0a8,
+  0xc32c56a75f8593f6, 0x0000000000000000, 0x0000000000000000, 0xe7cee493403c0039,
+  0x01104326f3e6fe0e, 0xce4252866f21525e, 0x52fbe49171f64895, 0x4634a5def918d62d,
+  0x68ad761dd0444c06, 0x0000000000000000, 0xd991e17177b60459, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0xe1de4f2cab4faec1, 0xffdd13492b206b2a,
+  0x0000000000000000, 0x0000000000000000, 0x7dbc16d17b1bfeab, 0x0000000000000000,
+  0x0000000000000000, 0xc4b62911fd52b855, 0x6d815b719f579c47, 0xfc83ef5044fd9c55,
+  0xd22ef6f674bd855b, 0x9a5bd852d080d9e0, 0x841fd52937831e77, 0x0000000000000000,
+  0xa4c6ff7f50e3bfdb, 0xe77feba1af1c4026, 0x082715f7c87ce18a, 0xf1eb12ce2f7f2621,
+  0xba17f42a8b427aa6, 0x0000000000000000, 0x1ec58faf60a863ba, 0x8fc2fbd0bb0263ac,
+  0xc790c20f02ad47ac, 0x0000000000000000, 0x0e8ad44f84e40156, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x8c69d7d7d4df94d7, 0xaa689bf454b05140,
+  0x0000000000000000, 0x0000000000000000, 0xb2b509af8849fba8, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0xbe04989a90deada3,
+  0x8b36a7fa0c1901f3, 0x394b068f8e09b76c, 0x4612454206e729d4, 0x239975032fbbb3fb,
+  0xa478068dbfc3ffc8, 0xc91a9479a07a6c0b, 0x4c8145571fbef38b, 0x6b5e1dc754ec3f59,
+  0x22fd54acfdd9e238, 0x5786a03b9d380836, 0x993a0669cf583b02, 0xc586a779410e876f,
+  0x0000000000000000, 0xa43e7fef9afb8909, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x5accdac3c7caccb1,
+  0x4dda47aa3974a115, 0x79c4818a27d8693d, 0x0000000000000000, 0x0000000000000000,
+  0x95306954d844b643, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x61711518cd464b67, 0x84da8729ccff40f5, 0x0000000000000000, 0xd6c79d8a1d14abb3,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0xbbd7cfa383348622, 0xae497b463fcc9e58, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x4e3e1fef05eee40d,
+  0x0000000000000000, 0x0000000000000000, 0x1feb5e6f44caf32b, 0x9952b39750411c8d,
+  0x0867c60aeb6741bf, 0xff488400ba7111c4, 0x0000000000000000, 0x0cfd6e832843fa79,
+  0x0000000000000000, 0x5b2b3e9cfffffffd, 0x66ae150cb501ea50, 0x36de58bf5fba03d4,
+  0x0000000000000000, 0x0000000000000000, 0x904620956ab481cc, 0x393a40157bbe9f9b,
+  0xce1236b4a85a9a71, 0x41b4c40c820dc6ef, 0x0000000000000000, 0xd5fa518fb85728c2,
+  0x1404a0c70bf306ab, 0xe5d298da6b27d5af, 0x0000000000000000, 0x43520e93ed09167a,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0xdaf703677f5747fb, 0x7b75e547bc29b8f8, 0x0000000000000000, 0x678f62b65bc85798,
+  0xb0e20b559b0c2bdf, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0xad93ed4e04f238f0, 0x9c99d2f98f07725e, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x63ccc72c2082ebad, 0x0bdac4078a5b6955,
+  0xc8ecc9da22e854f4, 0x0000000000000000, 0x0000000000000000, 0x0b7e6ec3930aa155,
+  0x9ae03ebdf31ffbde, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0xda24faa4080af5e8, 0x936ab7611671f2ea, 0x0000000000000000,
+  0xe67c4b1fd7352295, 0x0000000000000000, 0x0000000000000000, 0x84e7b52bf38da7fa,
+  0xe95fbe91206eef18, 0xcd142d92b8a3d41b, 0x0000000000000000, 0xce3cb649730bf6f2,
+  0x564b2b327bc921f6, 0x8194f3b20fd13c69, 0x0000000000000000, 0x0000000000000000,
+  0xdf0e45781dd0bb9c, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0xfc980f77629648b5, 0x97f824c2e60af33c, 0xf514db5a079f9572, 0x1a4e07e031c2c9d4,
+  0x0940888d0030605a, 0x0000000000000000, 0xfcbaaa55c42d69dc, 0x0000000000000000,
+  0x0000000000000000, 0xa4185e4dc6c51b6e, 0x23f34b0756e9ad56, 0x088f84530e43de61,
+  0x0000000000000000, 0x0000000000000000, 0x8fa4870ae6271a7a, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x73e8bcf1a0292c29, 0x47255c464bce1c44, 0xb46af1b44e9aa197, 0xc1e0cf0f208c38fc,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x2021f3c4f87576e1, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x02abca4cd682193a, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x6e5f89ad99ba06de, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x567c414ef28bc9e4, 0xd23873d5f0a5b0e5, 0x804fc15a38b930fb, 0x0000000000000000,
+  0x0000000000000000, 0x9e8a54e7d09f2298, 0xeefb0dabd4f92f4d, 0xb045f04a3a2e7f03,
+  0x1a74ddd0f5e91db7, 0x2ac30a9371292a82, 0x7abf87409515a69a, 0x97cb451444af06de,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0xe214511a1ff2650e, 0x0000000000000000, 0x0158a5fc89a906a8, 0x0000000000000000,
+  0x0000000000000000, 0x6c7926d6ecea7a6b, 0x85221b1e048e9fb0, 0xab89165064ac7194,
+  0x1d36c40e095cddd9, 0x0f7ba214820782bc, 0xa19877f433ab52ba, 0x01484ab7243ce693,
+  0x695fc0a7ead4acb3, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x91b33e43a2950773, 0x87c0e91e50157552, 0x2ad244e43bfe58ec,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0xd4ed979fa2da8461, 0xf4a4dc2c94784899, 0xdf2fddeedf74baee, 0x00484353927f4348,
+  0x5a50db57aacfd14f, 0x7fe1e313a828ad0e, 0x4bb4d0a77f392e2d, 0x07e38c80fc09f554,
+  0x0000000000000000, 0x0000000000000000, 0xa49b6d835bd8319a, 0x64c37e4df578bbb7,
+  0x0000000000000000, 0xf9f30cdb33c438e9, 0x1c62dd1e5956c250, 0x0000000000000000,
+  0x465c18d06e865987, 0x530469b7d2eee028, 0x64de5d69668435f7, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x163b3c5d3f074990, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x760baec3c0f8b671, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x27688db7997bca0a,
+  0x45ead2509179a67a, 0x394281692d111fd9, 0x9253de45cc3bc718, 0x6fe40e02a6a93db1,
+  0x0000000000000000, 0x27836cd30a87444a, 0xe7ab7d9da427ce67, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x84635ea003f60aad, 0x0c65080d57d752f3,
+  0x31f60fc955302eb2, 0x40921a7980c6d1d4, 0xad170d32208b4513, 0x97a20ef46b87b768,
+  0xb75953815d257ba0, 0x8bfea7cd6d80bcb9, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x6174a63cc401a715, 0xfa93acdd5d6af88e, 0x04860202afea8aaf,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x22e72a79152b534e, 0x0000000000000000, 0x0000000000000000, 0x7ccb490c7df87d45,
+};
+
+const uint16_t fiat_pasta_fq_sqrt_dlog_vals[PASTA_SQRT_DLOG_SLOTS] = {
+  247, 20, 144, 145, 156, 207, 108, 0, 118, 0, 0, 0, 0, 125, 23, 115,
+  248, 153, 231, 70, 0, 0, 0, 97, 124, 170, 0, 0, 203, 0, 0, 0,
+  237, 0, 0, 0, 0, 177, 0, 0, 0, 0, 0, 0, 0, 219, 0, 43,
+  45, 114, 0, 0, 0, 0, 163, 0, 0, 176, 0, 11, 89, 0, 2, 0,
+  128, 0, 98, 0, 40, 76, 160, 0, 215, 0, 0, 147, 127, 46, 0, 0,
+  112, 14, 188, 0, 192, 0, 186, 33, 0, 0, 0, 0, 96, 15, 0, 0,
+  95, 55, 227, 0, 0, 0, 0, 62, 113, 0, 0, 0, 85, 59, 0, 90,
+  180, 0, 0, 0, 0, 41, 250, 0, 12, 178, 0, 71, 0, 72, 77, 228,
+  0, 0, 154, 129, 197, 162, 0, 0, 251, 57, 134, 193, 0, 3, 0, 0,
+  0, 0, 0, 0, 53, 208, 0, 0, 0, 93, 88, 0, 105, 0, 0, 0,
+  56, 0, 0, 211, 230, 67, 0, 0, 0, 0, 0, 9, 0, 39, 182, 214,
+  159, 0, 8, 116, 189, 0, 0, 107, 37, 44, 66, 68, 94, 0, 135, 0,
+  0, 0, 29, 175, 0, 0, 78, 0, 0, 126, 36, 149, 82, 74, 245, 0,
+  4, 132, 117, 202, 210, 0, 164, 21, 254, 0, 206, 0, 0, 0, 47, 157,
+  0, 0, 7, 0, 0, 0, 0, 172, 165, 194, 196, 222, 235, 61, 136, 244,
+  31, 86, 54, 167, 0, 137, 0, 0, 0, 0, 0, 195, 102, 83, 0, 0,
+  184, 0, 0, 0, 233, 216, 0, 221, 0, 0, 0, 0, 80, 181, 0, 0,
+  0, 0, 0, 131, 0, 0, 6, 65, 123, 185, 0, 34, 0, 1, 26, 69,
+  0, 0, 100, 200, 199, 205, 0, 50, 140, 122, 0, 169, 0, 0, 0, 0,
+  52, 218, 0, 187, 213, 0, 0, 0, 0, 190, 241, 0, 0, 0, 99, 183,
+  223, 0, 0, 143, 224, 0, 0, 0, 0, 161, 58, 0, 64, 0, 0, 60,
+  142, 240, 0, 174, 255, 19, 0, 0, 87, 0, 0, 0, 32, 168, 204, 226,
+  256, 0, 130, 0, 0, 139, 217, 48, 0, 0, 35, 0, 0, 0, 0, 0,
+  173, 171, 242, 91, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0,
+  109, 0, 0, 0, 75, 0, 0, 0, 42, 225, 252, 0, 0, 103, 198, 25,
+  120, 243, 151, 253, 0, 0, 0, 0, 246, 0, 236, 0, 0, 79, 16, 17,
+  28, 63, 119, 148, 239, 0, 0, 0, 0, 158, 229, 155, 0, 0, 0, 0,
+  0, 0, 0, 0, 179, 209, 141, 121, 104, 18, 106, 150, 0, 0, 166, 201,
+  0, 212, 24, 0, 92, 110, 138, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 133, 0, 0, 0, 0, 10, 220, 238, 84, 152,
+  0, 73, 38, 0, 0, 0, 22, 146, 232, 234, 13, 81, 51, 249, 0, 0,
+  0, 0, 0, 0, 0, 27, 30, 101, 0, 0, 0, 0, 111, 0, 0, 191,
+};
@@ -0,0 +1,288 @@
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "pool.h"
+
+#define POOL_CACHE_LINE 64
+
+// Chunks [head, tail) left to a worker, packed as tail << 32 | head so that
+// the owner and thieves can update it with a single compare-and-swap.
+typedef struct pool_range {
+    _Atomic uint64_t range;
+    char pad[POOL_CACHE_LINE - sizeof(uint64_t)];
+} PoolRange;
+
+typedef struct pool_worker {
+    Pool *pool;
+    size_t index;
+    pthread_t thread;
+} PoolWorker;
+
+struct pool {
+    size_t threads;
+    size_t scratch_bytes;
+    uint8_t *scratch;
+    PoolWorker *workers;
+    PoolRange *ranges;
+
+    // current job
+    PoolTask task;
+    void *ctx;
+    size_t n;
+    size_t grain;
+
+    pthread_mutex_t run_lock; // serializes pool_run
+    pthread_mutex_t lock;
+    pthread_cond_t start;
+    pthread_cond_t done;
+    uint64_t generation;
+    size_t active;
+    int stopping;
+};
+
+static uint64_t pool_pack(uint32_t head, uint32_t tail)
+{
+    return ((uint64_t)tail << 32) | head;
+}
+
+static uint32_t pool_head(uint64_t range)
+{
+    return (uint32_t)range;
+}
+
+static uint32_t pool_tail(uint64_t range)
+{
+    return (uint32_t)(range >> 32);
+}
+
+static int pool_pop(PoolRange *r, uint32_t *chunk)
+{
+    uint64_t cur = atomic_load(&r->range);
+    while (pool_head(cur) < pool_tail(cur)) {
+        if (atomic_compare_exchange_weak(&r->range, &cur, pool_pack(pool_head(cur) + 1, pool_tail(cur)))) {
+            *chunk = pool_head(cur);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Moves half of some other worker's chunks to this worker
+static int pool_steal(Pool *pool, size_t self)
+{
+    for (size_t i = 1; i < pool->threads; ++i) {
+        PoolRange *victim = &pool->ranges[(self + i) % pool->threads];
+
+        uint64_t cur = atomic_load(&victim->range);
+        while (pool_head(cur) < pool_tail(cur)) {
+            const uint32_t take = (pool_tail(cur) - pool_head(cur) + 1) / 2;
+            const uint32_t split = pool_tail(cur) - take;
+            if (atomic_compare_exchange_weak(&victim->range, &cur, pool_pack(pool_head(cur), split))) {
+                atomic_store(&pool->ranges[self].range, pool_pack(split, split + take));
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+static void pool_work(Pool *pool, size_t self)
+{
+    for (;;) {
+        uint32_t chunk;
+        while (pool_pop(&pool->ranges[self], &chunk)) {
+            const size_t begin = (size_t)chunk * pool->grain;
+            const size_t end = (pool->n - begin < pool->grain) ? pool->n : begin + pool->grain;
+            pool->task(pool->ctx, begin, end, self);
+        }
+
+        if (!pool_steal(pool, self)) {
+            return;
+        }
+    }
+}
+
+static void *pool_worker_main(void *arg)
+{
+    PoolWorker *worker = arg;
+    Pool *pool = worker->pool;
+    uint64_t seen = 0;
+
+    for (;;) {
+        pthread_mutex_lock(&pool->lock);
+        while (pool->generation == seen && !pool->stopping) {
+            pthread_cond_wait(&pool->start, &pool->lock);
+        }
+        if (pool->stopping) {
+            pthread_mutex_unlock(&pool->lock);
+            return NULL;
+        }
+        seen = pool->generation;
+        pthread_mutex_unlock(&pool->lock);
+
+        pool_work(pool, worker->index);
+
+        pthread_mutex_lock(&pool->lock);
+        pool->active -= 1;
+        if (pool->active == 0) {
+            pthread_cond_signal(&pool->done);
+        }
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+Pool *pool_create(size_t threads, size_t scratch_bytes)
+{
+    if (threads == 0) {
+        long cores = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = cores > 0 ? (size_t)cores : 1;
+    }
+
+    Pool *pool = calloc(1, sizeof(Pool));
+    if (!pool) {
+        return NULL;
+    }
+
+    pool->threads = threads;
+    pool->scratch_bytes = (scratch_bytes + POOL_CACHE_LINE - 1) / POOL_CACHE_LINE * POOL_CACHE_LINE;
+    pool->workers = calloc(threads, sizeof(PoolWorker));
+    pool->ranges = aligned_alloc(POOL_CACHE_LINE, threads * sizeof(PoolRange));
+    pool->scratch = pool->scratch_bytes ? aligned_alloc(POOL_CACHE_LINE, threads * pool->scratch_bytes) : NULL;
+    if (!pool->workers || !pool->ranges || (pool->scratch_bytes && !pool->scratch)) {
+        free(pool->workers);
+        free(pool->ranges);
+        free(pool->scratch);
+        free(pool);
+        return NULL;
+    }
+    memset(pool->ranges, 0, threads * sizeof(PoolRange));
+
+    pthread_mutex_init(&pool->run_lock, NULL);
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->start, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    // worker 0 is the thread calling pool_run
+    for (size_t i = 0; i < threads; ++i) {
+        pool->workers[i].pool = pool;
+        pool->workers[i].index = i;
+    }
+    for (size_t i = 1; i < threads; ++i) {
+        if (pthread_create(&pool->workers[i].thread, NULL, pool_worker_main, &pool->workers[i]) != 0) {
+            pool->threads = i;
+            pool_destroy(pool);
+            return NULL;
+        }
+    }
+
+    return pool;
+}
+
+void pool_destroy(Pool *pool)
+{
+    if (!pool) {
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stopping = 1;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (size_t i = 1; i < pool->threads; ++i) {
+        pthread_join(pool->workers[i].thread, NULL);
+    }
+
+    pthread_mutex_destroy(&pool->run_lock);
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->start);
+    pthread_cond_destroy(&pool->done);
+    free(pool->workers);
+    free(pool->ranges);
+    free(pool->scratch);
+    free(pool);
+}
+
+size_t pool_threads(const Pool *pool)
+{
+    return pool->threads;
+}
+
+void *pool_scratch(Pool *pool, size_t worker)
+{
+    return pool->scratch + worker * pool->scratch_bytes;
+}
+
+void pool_run(Pool *pool, size_t n, size_t grain, PoolTask task, void *ctx)
+{
+    if (n == 0) {
+        return;
+    }
+    if (grain == 0) {
+        grain = 1;
+    }
+
+    pthread_mutex_lock(&pool->run_lock);
+
+    const size_t chunks = (n + grain - 1) / grain;
+    pool->task = task;
+    pool->ctx = ctx;
+    pool->n = n;
+    pool->grain = grain;
+    for (size_t i = 0; i < pool->threads; ++i) {
+        const uint32_t head = (uint32_t)(chunks * i / pool->threads);
+        const uint32_t tail = (uint32_t)(chunks * (i + 1) / pool->threads);
+        atomic_store(&pool->ranges[i].range, pool_pack(head, tail));
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->generation += 1;
+    pool->active = pool->threads - 1;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    pool_work(pool, 0);
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->active > 0) {
+        pthread_cond_wait(&pool->done, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    pthread_mutex_unlock(&pool->run_lock);
+}
+
+size_t pool_grain(const Pool *pool, size_t n, size_t max_grain)
+{
+    size_t grain = n / (4 * pool->threads);
+    if (max_grain && grain > max_grain) {
+        grain = max_grain;
+    }
+    return grain;
+}
+
+typedef struct pool_status_job {
+    PoolStatusTask task;
+    void *ctx;
+    _Atomic int status; // first failure
+} PoolStatusJob;
+
+static void pool_status_task(void *ctx, size_t begin, size_t end, size_t worker)
+{
+    PoolStatusJob *job = ctx;
+    const int status = job->task(job->ctx, begin, end, worker);
+    if (status != 0) {
+        int expected = 0;
+        atomic_compare_exchange_strong(&job->status, &expected, status);
+    }
+}
+
+int pool_for_status(Pool *pool, size_t n, size_t max_grain, PoolStatusTask task, void *ctx)
+{
+    PoolStatusJob job = { task, ctx, 0 };
+    pool_run(pool, n, pool_grain(pool, n, max_grain), pool_status_task, &job);
+    return atomic_load(&job.status);
+}
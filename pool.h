@@ -0,0 +1,43 @@
+// Fixed-size thread pool with work stealing
+//
+//     * pool_run splits [0, n) into chunks of grain items. Each worker starts
+//       with a contiguous range of chunks and, once it runs out, steals half
+//       of the remaining range of another worker.
+//
+//     * The calling thread acts as worker 0, so a pool of one thread spawns
+//       no threads at all.
+//
+//     * Each worker owns a scratch arena of scratch_bytes, so tasks need
+//       not allocate. Tasks write results by index, which keeps them in
+//       input order.
+
+#pragma once
+
+#include <stddef.h>
+
+typedef struct pool Pool;
+
+// Processes items [begin, end) on the given worker
+typedef void (*PoolTask)(void *ctx, size_t begin, size_t end, size_t worker);
+
+// A PoolTask that reports failure with a nonzero status
+typedef int (*PoolStatusTask)(void *ctx, size_t begin, size_t end, size_t worker);
+
+// threads = 0 uses one thread per online core. Returns NULL on failure.
+Pool *pool_create(size_t threads, size_t scratch_bytes);
+void pool_destroy(Pool *pool);
+
+size_t pool_threads(const Pool *pool);
+void *pool_scratch(Pool *pool, size_t worker);
+
+// Runs task over [0, n) and returns once every item is done. Concurrent
+// calls on the same pool are serialized.
+void pool_run(Pool *pool, size_t n, size_t grain, PoolTask task, void *ctx);
+
+// Grain that gives each worker about four chunks of [0, n) to balance
+// with, capped at max_grain (0: no cap) so batched work stays in batches
+size_t pool_grain(const Pool *pool, size_t n, size_t max_grain);
+
+// pool_run with pool_grain(pool, n, max_grain). Returns the first nonzero
+// status of any chunk, or 0; the other chunks still run.
+int pool_for_status(Pool *pool, size_t n, size_t max_grain, PoolStatusTask task, void *ctx);
@@ -6,6 +6,7 @@
  * computation in this file in the base field, but output the result as a scalar.
  ********************************************************************************/
 #include "crypto.h"
+#include "opcount.h"
 #include "pasta_fp.h"
 #include "pasta_fq.h"
 #include "poseidon.h"
@@ -537,35 +538,31 @@ static const Field mds_matrix[SPONGE_SIZE][SPONGE_SIZE] =
   }
 };
 
+// The field operations read all of their inputs before writing their
+// output, so the state is updated in place below, without copies.
+
 void matrix_mul(State s1, const State m[SPONGE_SIZE])
 {
-    Field tmp;
-
-    State s2 = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } };
+    State s2;
     for (size_t row = 0; row < SPONGE_SIZE; row++) {
         // Inner product
-        for (size_t col = 0; col < SPONGE_SIZE; col++) {
+        field_mul(s2[row], s1[0], m[row][0]);
+        for (size_t col = 1; col < SPONGE_SIZE; col++) {
             Field t0;
             field_mul(t0, s1[col], m[row][col]);
-
-            field_copy(tmp, s2[row]);
-            field_add(s2[row], tmp, t0);
+            field_add(s2[row], s2[row], t0);
         }
     }
 
-    for (size_t col = 0; col < SPONGE_SIZE; col++) {
-        field_copy(s1[col], s2[col]);
-    }
+    memcpy(s1, s2, sizeof(State));
 }
 
+// out = x^5; out may alias x
 void to_the_alpha(Field out, const Field x)
 {
-    // out = x^2
-    field_sq(out, x);
-
-    uint64_t x4[4];
-    field_sq(x4, out);
-
+    Field x2, x4;
+    field_sq(x2, x);
+    field_sq(x4, x2);
     field_mul(out, x4, x);
 }
 
@@ -577,20 +574,18 @@ void to_the_alpha(Field out, const Field x)
 // of inputs and running of the poseidon function.
 void poseidon_permutation(State s)
 {
-    Field tmp;
+    OP_COUNT(OP_POSEIDON);
 
     // Full rounds
     for (size_t r = 0; r < FULL_ROUNDS; r++) {
         // ark
         for (unsigned int i = 0; i < SPONGE_SIZE; i++) {
-            field_copy(tmp, s[i]);
-            field_add(s[i], tmp, round_keys[r][i]);
+            field_add(s[i], s[i], round_keys[r][i]);
         }
 
         // sbox
         for (unsigned int i = 0; i < SPONGE_SIZE; i++) {
-            field_copy(tmp, s[i]);
-            to_the_alpha(s[i], tmp);
+            to_the_alpha(s[i], s[i]);
         }
 
         // mds
@@ -599,28 +594,22 @@ void poseidon_permutation(State s)
 
     // Final ark
     for (unsigned int i = 0; i < SPONGE_SIZE; i++) {
-        field_copy(tmp, s[i]);
-        field_add(s[i], tmp, round_keys[ROUNDS - 1][i]);
+        field_add(s[i], s[i], round_keys[ROUNDS - 1][i]);
     }
 }
 
 void poseidon_update(State s, const uint64_t *input, size_t len)
 {
-    Field tmp;
     size_t pairs = len / 2;
 
     for (size_t i = 0; i < pairs; ++i) {
-        field_copy(tmp, s[0]);
-        field_add(s[0], tmp, input + LIMBS_PER_FIELD * (2 * i));
-
-        field_copy(tmp, s[1]);
-        field_add(s[1], tmp, input + LIMBS_PER_FIELD * (2 * i + 1));
+        field_add(s[0], s[0], input + LIMBS_PER_FIELD * (2 * i));
+        field_add(s[1], s[1], input + LIMBS_PER_FIELD * (2 * i + 1));
         poseidon_permutation(s);
     }
 
     if (2 * pairs < len) {
-        field_copy(tmp, s[0]);
-        field_add(s[0], tmp, input + LIMBS_PER_FIELD * (2 * pairs));
+        field_add(s[0], s[0], input + LIMBS_PER_FIELD * (2 * pairs));
 
         poseidon_permutation(s);
     }
@@ -0,0 +1,161 @@
+#include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/random.h>
+#include "random.h"
+
+#define CHACHA_BLOCK_BYTES 64
+#define CHACHA_KEY_BYTES 32
+
+// Blocks generated per refill, the first CHACHA_KEY_BYTES become the next key
+#define RANDOM_BUFFER_BLOCKS 8
+#define RANDOM_BUFFER_BYTES (RANDOM_BUFFER_BLOCKS * CHACHA_BLOCK_BYTES)
+
+typedef struct random_state {
+    uint32_t key[CHACHA_KEY_BYTES / 4];
+    uint8_t buf[RANDOM_BUFFER_BYTES];
+    size_t pos;             // next unused byte of buf
+    size_t since_reseed;    // bytes of output since the last reseed
+    unsigned fork_generation;
+    bool seeded;
+} RandomState;
+
+static _Thread_local RandomState random_state;
+
+// Bumped in the child after fork, so copied states reseed
+static atomic_uint random_fork_generation;
+static pthread_once_t random_atfork_once = PTHREAD_ONCE_INIT;
+
+static void random_atfork_child(void)
+{
+    atomic_fetch_add(&random_fork_generation, 1);
+}
+
+static void random_atfork_init(void)
+{
+    pthread_atfork(NULL, NULL, random_atfork_child);
+}
+
+#define CHACHA_ROTL(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+#define CHACHA_QUARTER(a, b, c, d)                  \
+    a += b; d ^= a; d = CHACHA_ROTL(d, 16);         \
+    c += d; b ^= c; b = CHACHA_ROTL(b, 12);         \
+    a += b; d ^= a; d = CHACHA_ROTL(d, 8);          \
+    c += d; b ^= c; b = CHACHA_ROTL(b, 7)
+
+static void chacha20_block(uint8_t out[CHACHA_BLOCK_BYTES], const uint32_t key[8], uint32_t counter)
+{
+    const uint32_t in[16] = {
+        0x61707865, 0x3320646e, 0x79622d32, 0x6b206574,
+        key[0], key[1], key[2], key[3], key[4], key[5], key[6], key[7],
+        counter, 0, 0, 0,
+    };
+
+    uint32_t x[16];
+    memcpy(x, in, sizeof(x));
+    for (size_t i = 0; i < 10; ++i) {
+        CHACHA_QUARTER(x[0], x[4], x[8], x[12]);
+        CHACHA_QUARTER(x[1], x[5], x[9], x[13]);
+        CHACHA_QUARTER(x[2], x[6], x[10], x[14]);
+        CHACHA_QUARTER(x[3], x[7], x[11], x[15]);
+        CHACHA_QUARTER(x[0], x[5], x[10], x[15]);
+        CHACHA_QUARTER(x[1], x[6], x[11], x[12]);
+        CHACHA_QUARTER(x[2], x[7], x[8], x[13]);
+        CHACHA_QUARTER(x[3], x[4], x[9], x[14]);
+    }
+
+    for (size_t i = 0; i < 16; ++i) {
+        const uint32_t v = x[i] + in[i];
+        out[4 * i + 0] = (uint8_t)v;
+        out[4 * i + 1] = (uint8_t)(v >> 8);
+        out[4 * i + 2] = (uint8_t)(v >> 16);
+        out[4 * i + 3] = (uint8_t)(v >> 24);
+    }
+}
+
+static bool random_getrandom(void *out, size_t len)
+{
+    uint8_t *p = out;
+    while (len > 0) {
+        ssize_t got = getrandom(p, len, 0);
+        if (got < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        p += got;
+        len -= (size_t)got;
+    }
+    return true;
+}
+
+// Mixes fresh system randomness into the key
+static bool random_reseed(RandomState *state)
+{
+    uint32_t fresh[CHACHA_KEY_BYTES / 4];
+    if (!random_getrandom(fresh, sizeof(fresh))) {
+        return false;
+    }
+
+    for (size_t i = 0; i < CHACHA_KEY_BYTES / 4; ++i) {
+        state->key[i] ^= fresh[i];
+    }
+    memset(fresh, 0, sizeof(fresh));
+
+    state->pos = RANDOM_BUFFER_BYTES; // drop output of the old key
+    state->since_reseed = 0;
+    state->fork_generation = atomic_load(&random_fork_generation);
+    state->seeded = true;
+    return true;
+}
+
+static void random_refill(RandomState *state)
+{
+    for (uint32_t i = 0; i < RANDOM_BUFFER_BLOCKS; ++i) {
+        chacha20_block(state->buf + i * CHACHA_BLOCK_BYTES, state->key, i);
+    }
+
+    for (size_t i = 0; i < CHACHA_KEY_BYTES / 4; ++i) {
+        memcpy(&state->key[i], state->buf + 4 * i, 4);
+    }
+    memset(state->buf, 0, CHACHA_KEY_BYTES);
+    state->pos = CHACHA_KEY_BYTES;
+}
+
+bool random_bytes(void *out, size_t len)
+{
+    RandomState *state = &random_state;
+
+    if (!state->seeded) {
+        pthread_once(&random_atfork_once, random_atfork_init);
+    }
+    if (!state->seeded || state->since_reseed >= RANDOM_RESEED_BYTES
+        || state->fork_generation != atomic_load_explicit(&random_fork_generation, memory_order_relaxed)) {
+        if (!random_reseed(state)) {
+            return false;
+        }
+    }
+
+    uint8_t *p = out;
+    state->since_reseed += len;
+    while (len > 0) {
+        if (state->pos == RANDOM_BUFFER_BYTES) {
+            random_refill(state);
+        }
+
+        size_t take = RANDOM_BUFFER_BYTES - state->pos;
+        if (take > len) {
+            take = len;
+        }
+        memcpy(p, state->buf + state->pos, take);
+        memset(state->buf + state->pos, 0, take);
+        state->pos += take;
+        p += take;
+        len -= take;
+    }
+
+    return true;
+}
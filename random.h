@@ -0,0 +1,20 @@
+// Per-thread ChaCha20 DRBG for key material
+//
+//     * Each thread keeps its own generator, so no locking is needed.
+//
+//     * Seeded from getrandom, reseeded after RANDOM_RESEED_BYTES of
+//       output and in the child after a fork.
+//
+//     * Fast key erasure: every refill rekeys from its own output, and
+//       bytes are wiped from the buffer once handed out, so a later
+//       compromise of the state does not reveal earlier output.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#define RANDOM_RESEED_BYTES (1 << 20)
+
+// Fills out with len random bytes, returns false if the system RNG failed
+bool random_bytes(void *out, size_t len);
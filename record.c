@@ -0,0 +1,255 @@
+#include "record.h"
+#include "pasta_fp.h"
+#include "pasta_fq.h"
+#include "utils.h"
+
+#define RECORD_MAGIC_BYTES 8
+#define RECORD_HEX_BLOCK 64
+
+static const char RECORD_FILE_MAGIC[3][RECORD_MAGIC_BYTES + 1] = { "MINATXNS", "MINASIGS", "MINASTXS" };
+static const uint32_t RECORD_FILE_RECORD_BYTES[3] = { TX_RECORD_BYTES, SIGNATURE_RECORD_BYTES, SIGNED_RECORD_BYTES };
+
+static void record_write_fp(uint8_t out[FIELD_BYTES], const Field a)
+{
+    uint64_t tmp[4];
+    fiat_pasta_fp_from_montgomery(tmp, a);
+    fiat_pasta_fp_to_bytes(out, tmp);
+}
+
+// Canonical if converting to Montgomery form and back is the identity
+static bool record_read_fp(Field out, const uint8_t in[FIELD_BYTES])
+{
+    uint64_t x[4], back[4];
+    fiat_pasta_fp_from_bytes(x, in);
+    fiat_pasta_fp_to_montgomery(out, x);
+    fiat_pasta_fp_from_montgomery(back, out);
+    return memcmp(x, back, sizeof(x)) == 0;
+}
+
+static bool record_read_fq(Scalar out, const uint8_t in[SCALAR_BYTES])
+{
+    uint64_t x[4], back[4];
+    fiat_pasta_fq_from_bytes(x, in);
+    fiat_pasta_fq_to_montgomery(out, x);
+    fiat_pasta_fq_from_montgomery(back, out);
+    return memcmp(x, back, sizeof(x)) == 0;
+}
+
+void transaction_record_write(uint8_t out[TX_RECORD_BYTES], const Transaction *txn)
+{
+    memset(out, 0, TX_RECORD_BYTES);
+    write_le(out + 0, txn->fee, 8);
+    write_le(out + 8, txn->fee_token, 8);
+    write_le(out + 16, txn->nonce, 4);
+    write_le(out + 20, txn->valid_until, 4);
+    write_le(out + 24, txn->token_id, 8);
+    write_le(out + 32, txn->amount, 8);
+    out[40] = (uint8_t)(txn->tag[0] | txn->tag[1] << 1 | txn->tag[2] << 2 | txn->token_locked << 3);
+    compressed_write(out + 48, &txn->fee_payer_pk);
+    compressed_write(out + 81, &txn->source_pk);
+    compressed_write(out + 114, &txn->receiver_pk);
+    memcpy(out + 147, txn->memo, MEMO_BYTES);
+}
+
+MinaStatus transaction_record_read(Transaction *txn, const uint8_t in[TX_RECORD_BYTES])
+{
+    uint8_t reserved = in[40] & 0xf0;
+    for (size_t i = 41; i < 48; ++i) {
+        reserved |= in[i];
+    }
+    for (size_t i = 181; i < TX_RECORD_BYTES; ++i) {
+        reserved |= in[i];
+    }
+
+    txn->fee = read_le(in + 0, 8);
+    txn->fee_token = read_le(in + 8, 8);
+    txn->nonce = (Nonce)read_le(in + 16, 4);
+    txn->valid_until = (GlobalSlot)read_le(in + 20, 4);
+    txn->token_id = read_le(in + 24, 8);
+    txn->amount = read_le(in + 32, 8);
+    for (size_t i = 0; i < 3; ++i) {
+        txn->tag[i] = (in[40] >> i) & 1;
+    }
+    txn->token_locked = (in[40] >> 3) & 1;
+    memcpy(txn->memo, in + 147, MEMO_BYTES);
+
+    bool ok = (reserved == 0);
+    ok &= compressed_read(&txn->fee_payer_pk, in + 48) == MINA_OK;
+    ok &= compressed_read(&txn->source_pk, in + 81) == MINA_OK;
+    ok &= compressed_read(&txn->receiver_pk, in + 114) == MINA_OK;
+    return ok ? MINA_OK : MINA_ERR_INVALID_PARAMETER;
+}
+
+void signature_record_write(uint8_t out[SIGNATURE_RECORD_BYTES], const Signature *sig)
+{
+    uint64_t tmp[4];
+    record_write_fp(out, sig->rx);
+    fiat_pasta_fq_from_montgomery(tmp, sig->s);
+    fiat_pasta_fq_to_bytes(out + FIELD_BYTES, tmp);
+}
+
+MinaStatus signature_record_read(Signature *sig, const uint8_t in[SIGNATURE_RECORD_BYTES])
+{
+    const bool ok = record_read_fp(sig->rx, in) & record_read_fq(sig->s, in + FIELD_BYTES);
+    return ok ? MINA_OK : MINA_ERR_INVALID_PARAMETER;
+}
+
+bool signature_record_is_signed(const uint8_t in[SIGNATURE_RECORD_BYTES])
+{
+    uint8_t acc = 0;
+    for (size_t i = 0; i < FIELD_BYTES; ++i) {
+        acc |= in[i];
+    }
+    return acc != 0;
+}
+
+void signed_record_write(uint8_t out[SIGNED_RECORD_BYTES], const Transaction *txn, const Signature *sig,
+                         const Compressed *key)
+{
+    transaction_record_write(out, txn);
+    signature_record_write(out + TX_RECORD_BYTES, sig);
+    compressed_write(out + TX_RECORD_BYTES + SIGNATURE_RECORD_BYTES, key);
+    memset(out + TX_RECORD_BYTES + SIGNATURE_RECORD_BYTES + COMPRESSED_BYTES, 0,
+           SIGNED_RECORD_BYTES - TX_RECORD_BYTES - SIGNATURE_RECORD_BYTES - COMPRESSED_BYTES);
+}
+
+MinaStatus signed_record_read(Transaction *txn, Signature *sig, Compressed *key,
+                              const uint8_t in[SIGNED_RECORD_BYTES])
+{
+    uint8_t reserved = 0;
+    for (size_t i = TX_RECORD_BYTES + SIGNATURE_RECORD_BYTES + COMPRESSED_BYTES; i < SIGNED_RECORD_BYTES; ++i) {
+        reserved |= in[i];
+    }
+
+    bool ok = (reserved == 0);
+    ok &= transaction_record_read(txn, in) == MINA_OK;
+    ok &= signature_record_read(sig, in + TX_RECORD_BYTES) == MINA_OK;
+    ok &= compressed_read(key, in + TX_RECORD_BYTES + SIGNATURE_RECORD_BYTES) == MINA_OK;
+    return ok ? MINA_OK : MINA_ERR_INVALID_PARAMETER;
+}
+
+void record_file_header_write(uint8_t out[RECORD_FILE_HEADER_BYTES], RecordFileKind kind, uint64_t count,
+                              const Compressed *signer)
+{
+    memset(out, 0, RECORD_FILE_HEADER_BYTES);
+    memcpy(out, RECORD_FILE_MAGIC[kind], RECORD_MAGIC_BYTES);
+    write_le(out + 8, RECORD_FILE_VERSION, 4);
+    write_le(out + 12, RECORD_FILE_RECORD_BYTES[kind], 4);
+    write_le(out + 16, count, 8);
+    if (signer) {
+        compressed_write(out + 24, signer);
+    }
+}
+
+MinaStatus record_file_header_read(const uint8_t in[RECORD_FILE_HEADER_BYTES], RecordFileKind kind,
+                                   uint64_t *count, Compressed *signer)
+{
+    const size_t reserved_from = (kind == RECORD_FILE_SIGNATURES) ? 24 + COMPRESSED_BYTES : 24;
+    uint8_t reserved = 0;
+    for (size_t i = reserved_from; i < RECORD_FILE_HEADER_BYTES; ++i) {
+        reserved |= in[i];
+    }
+
+    bool ok = memcmp(in, RECORD_FILE_MAGIC[kind], RECORD_MAGIC_BYTES) == 0;
+    ok &= read_le(in + 8, 4) == RECORD_FILE_VERSION;
+    ok &= read_le(in + 12, 4) == RECORD_FILE_RECORD_BYTES[kind];
+    ok &= reserved == 0;
+    *count = read_le(in + 16, 8);
+    if (kind == RECORD_FILE_SIGNATURES) {
+        Compressed key;
+        ok &= compressed_read(&key, in + 24) == MINA_OK;
+        if (signer) {
+            *signer = key;
+        }
+    }
+    return ok ? MINA_OK : MINA_ERR_INVALID_PARAMETER;
+}
+
+void compressed_write(uint8_t out[COMPRESSED_BYTES], const Compressed *c)
+{
+    record_write_fp(out, c->x);
+    out[FIELD_BYTES] = c->is_odd;
+}
+
+MinaStatus compressed_read(Compressed *c, const uint8_t in[COMPRESSED_BYTES])
+{
+    c->is_odd = in[FIELD_BYTES] & 1;
+    const bool ok = record_read_fp(c->x, in) && in[FIELD_BYTES] <= 1;
+    return ok ? MINA_OK : MINA_ERR_INVALID_PARAMETER;
+}
+
+void affine_write(uint8_t out[AFFINE_BYTES], const Affine *p)
+{
+    record_write_fp(out, p->x);
+    record_write_fp(out + FIELD_BYTES, p->y);
+}
+
+MinaStatus affine_read(Affine *p, const uint8_t in[AFFINE_BYTES])
+{
+    if (!(record_read_fp(p->x, in) & record_read_fp(p->y, in + FIELD_BYTES))) {
+        return MINA_ERR_INVALID_PARAMETER;
+    }
+    return affine_is_on_curve(p) ? MINA_OK : MINA_ERR_INVALID_POINT;
+}
+
+void signature_hex_write(char out[SIGNATURE_HEX_LEN], const Signature *sig)
+{
+    uint8_t bytes[SIGNATURE_RECORD_BYTES];
+    signature_record_write(bytes, sig);
+    hex_encode(out, bytes, sizeof(bytes));
+}
+
+MinaStatus signature_hex_read(Signature *sig, const char *hex, size_t len)
+{
+    uint8_t bytes[SIGNATURE_RECORD_BYTES];
+    if (len != SIGNATURE_HEX_LEN || !hex_decode(bytes, hex, sizeof(bytes))) {
+        return MINA_ERR_INVALID_PARAMETER;
+    }
+    return signature_record_read(sig, bytes);
+}
+
+void compressed_hex_write(char out[COMPRESSED_HEX_LEN], const Compressed *c)
+{
+    uint8_t bytes[COMPRESSED_BYTES];
+    compressed_write(bytes, c);
+    hex_encode(out, bytes, sizeof(bytes));
+}
+
+MinaStatus compressed_hex_read(Compressed *c, const char *hex, size_t len)
+{
+    uint8_t bytes[COMPRESSED_BYTES];
+    if (len != COMPRESSED_HEX_LEN || !hex_decode(bytes, hex, sizeof(bytes))) {
+        return MINA_ERR_INVALID_PARAMETER;
+    }
+    return compressed_read(c, bytes);
+}
+
+void affine_hex_write(char out[AFFINE_HEX_LEN], const Affine *p)
+{
+    uint8_t bytes[AFFINE_BYTES];
+    affine_write(bytes, p);
+    hex_encode(out, bytes, sizeof(bytes));
+}
+
+MinaStatus affine_hex_read(Affine *p, const char *hex, size_t len)
+{
+    uint8_t bytes[AFFINE_BYTES];
+    if (len != AFFINE_HEX_LEN || !hex_decode(bytes, hex, sizeof(bytes))) {
+        return MINA_ERR_INVALID_PARAMETER;
+    }
+    return affine_read(p, bytes);
+}
+
+// The records of a block are contiguous, so one hex_encode call covers
+// the whole block and stays in its vector loop
+void signature_hex_write_batch(char *out, const Signature *sigs, size_t n)
+{
+    uint8_t bytes[RECORD_HEX_BLOCK][SIGNATURE_RECORD_BYTES];
+    for (size_t begin = 0; begin < n; begin += RECORD_HEX_BLOCK) {
+        const size_t count = (n - begin < RECORD_HEX_BLOCK) ? n - begin : RECORD_HEX_BLOCK;
+        for (size_t i = 0; i < count; ++i) {
+            signature_record_write(bytes[i], &sigs[begin + i]);
+        }
+        hex_encode(out + begin * SIGNATURE_HEX_LEN, &bytes[0][0], count * SIGNATURE_RECORD_BYTES);
+    }
+}
@@ -0,0 +1,133 @@
+// Fixed-size binary records for transactions and signatures
+//
+// Integers are little-endian and field elements are canonical (not
+// Montgomery) 32-byte little-endian integers, so that any language can
+// produce records and equal values have equal bytes.
+//
+//     transaction, TX_RECORD_BYTES
+//         0    fee            u64
+//         8    fee_token      u64
+//         16   nonce          u32
+//         20   valid_until    u32
+//         24   token_id       u64
+//         32   amount         u64
+//         40   flags          u8: tag in bits 0-2, token_locked in bit 3
+//         41   reserved       7 bytes, zero
+//         48   fee_payer_pk   x (32 bytes) | parity of y (1 byte)
+//         81   source_pk      x | parity
+//         114  receiver_pk    x | parity
+//         147  memo           34 bytes
+//         181  reserved       3 bytes, zero
+//
+//     signature, SIGNATURE_RECORD_BYTES
+//         0    rx (Fp)
+//         32   s  (Fq)
+//
+//     signed transaction, SIGNED_RECORD_BYTES
+//         0    transaction    TX_RECORD_BYTES
+//         184  signature      SIGNATURE_RECORD_BYTES
+//         248  public key     x | parity, the key to verify under
+//         281  reserved       7 bytes, zero
+//
+// Record files hold a RECORD_FILE_HEADER_BYTES header and then count
+// records back to back, so record i lies at a fixed offset:
+//
+//     header
+//         0    magic          "MINATXNS", "MINASIGS" or "MINASTXS"
+//         8    version        u32 = RECORD_FILE_VERSION
+//         12   record_bytes   u32, TX_RECORD_BYTES, SIGNATURE_RECORD_BYTES or SIGNED_RECORD_BYTES
+//         16   count          u64
+//         24   signer         signature files: the signing key, x | parity
+//         57   reserved       zero
+//
+// A signed transaction file ("MINASTXS") is a dump of transactions
+// signed by any keys, such as a mempool's, each with its signature and key.
+//
+// In a signature file, record i signs record i of its transaction file. A
+// record with rx = 0 is not signed yet, whatever its s: no point has x = 0,
+// since 5 is not a square in Fp, so no signature has rx = 0. Signers write
+// s before rx, so a record torn between the two counts as unsigned.
+//
+// The same layouts serve as the raw encodings of single values: a raw
+// signature is its record (rx | s, Mina's 64-byte encoding), a compressed
+// key is x | parity as in a transaction record, and an affine point is
+// x | y. The hex forms are these bytes as lowercase hex digits, in order.
+
+#pragma once
+
+#include "crypto.h"
+
+#define TX_RECORD_BYTES 184
+#define SIGNATURE_RECORD_BYTES 64
+#define SIGNED_RECORD_BYTES 288
+#define RECORD_FILE_HEADER_BYTES 64
+#define RECORD_FILE_VERSION 1
+#define COMPRESSED_BYTES 33
+#define AFFINE_BYTES 64
+#define SIGNATURE_HEX_LEN (2 * SIGNATURE_RECORD_BYTES)
+#define COMPRESSED_HEX_LEN (2 * COMPRESSED_BYTES)
+#define AFFINE_HEX_LEN (2 * AFFINE_BYTES)
+
+typedef enum record_file_kind {
+    RECORD_FILE_TRANSACTIONS,
+    RECORD_FILE_SIGNATURES,
+    RECORD_FILE_SIGNED,
+} RecordFileKind;
+
+void transaction_record_write(uint8_t out[TX_RECORD_BYTES], const Transaction *txn);
+
+// MINA_ERR_INVALID_PARAMETER if a reserved bit is set, a parity is not 0
+// or 1, or a key's x is not below the field modulus
+MinaStatus transaction_record_read(Transaction *txn, const uint8_t in[TX_RECORD_BYTES]);
+
+void signature_record_write(uint8_t out[SIGNATURE_RECORD_BYTES], const Signature *sig);
+
+// MINA_ERR_INVALID_PARAMETER if rx or s is not below its modulus
+MinaStatus signature_record_read(Signature *sig, const uint8_t in[SIGNATURE_RECORD_BYTES]);
+
+// Whether rx is nonzero, which marks a record of a signature file signed
+bool signature_record_is_signed(const uint8_t in[SIGNATURE_RECORD_BYTES]);
+
+void signed_record_write(uint8_t out[SIGNED_RECORD_BYTES], const Transaction *txn, const Signature *sig,
+                         const Compressed *key);
+
+// transaction_record_read, signature_record_read and compressed_read of
+// the parts, and MINA_ERR_INVALID_PARAMETER if the reserved bytes are not
+// zero
+MinaStatus signed_record_read(Transaction *txn, Signature *sig, Compressed *key,
+                              const uint8_t in[SIGNED_RECORD_BYTES]);
+
+// signer is NULL for transaction and signed transaction files
+void record_file_header_write(uint8_t out[RECORD_FILE_HEADER_BYTES], RecordFileKind kind, uint64_t count,
+                              const Compressed *signer);
+
+// MINA_ERR_INVALID_PARAMETER unless in is a header of this kind and
+// version. signer, filled in for signature files, may be NULL.
+MinaStatus record_file_header_read(const uint8_t in[RECORD_FILE_HEADER_BYTES], RecordFileKind kind,
+                                   uint64_t *count, Compressed *signer);
+
+void compressed_write(uint8_t out[COMPRESSED_BYTES], const Compressed *c);
+
+// MINA_ERR_INVALID_PARAMETER if x is not below the field modulus or the
+// parity is not 0 or 1. Whether x is on the curve is left to
+// affine_decompress.
+MinaStatus compressed_read(Compressed *c, const uint8_t in[COMPRESSED_BYTES]);
+
+void affine_write(uint8_t out[AFFINE_BYTES], const Affine *p);
+
+// MINA_ERR_INVALID_PARAMETER if x or y is not below the field modulus,
+// MINA_ERR_INVALID_POINT if (x, y) is not on the curve
+MinaStatus affine_read(Affine *p, const uint8_t in[AFFINE_BYTES]);
+
+// The hex forms, without a terminator. Reading takes either case and fails
+// with MINA_ERR_INVALID_PARAMETER unless len is the exact length.
+void signature_hex_write(char out[SIGNATURE_HEX_LEN], const Signature *sig);
+MinaStatus signature_hex_read(Signature *sig, const char *hex, size_t len);
+void compressed_hex_write(char out[COMPRESSED_HEX_LEN], const Compressed *c);
+MinaStatus compressed_hex_read(Compressed *c, const char *hex, size_t len);
+void affine_hex_write(char out[AFFINE_HEX_LEN], const Affine *p);
+MinaStatus affine_hex_read(Affine *p, const char *hex, size_t len);
+
+// signature_hex_write of n signatures into n * SIGNATURE_HEX_LEN chars
+// back to back, encoding them a block of records at a time
+void signature_hex_write_batch(char *out, const Signature *sigs, size_t n);
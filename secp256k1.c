@@ -0,0 +1,502 @@
+#include <pthread.h>
+#include <string.h>
+#include "secp256k1.h"
+
+typedef unsigned __int128 uint128_t;
+
+// Field elements and scalars: 4 little-endian limbs, fully reduced
+typedef uint64_t Secp256k1Fe[4];
+
+typedef struct secp256k1_jacobian {
+    Secp256k1Fe x, y, z; // z = 0 is the point at infinity
+} Secp256k1Jacobian;
+
+typedef struct secp256k1_affine {
+    Secp256k1Fe x, y;
+} Secp256k1Affine;
+
+// p = 2^256 - SECP256K1_C
+#define SECP256K1_C 0x1000003d1ULL
+
+static const Secp256k1Fe SECP256K1_P = {
+    0xfffffffefffffc2f, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff
+};
+
+static const Secp256k1Fe SECP256K1_N = {
+    0xbfd25e8cd0364141, 0xbaaedce6af48a03b, 0xfffffffffffffffe, 0xffffffffffffffff
+};
+
+static const Secp256k1Affine SECP256K1_G = {
+    { 0x59f2815b16f81798, 0x029bfcdb2dce28d9, 0x55a06295ce870b07, 0x79be667ef9dcbbac },
+    { 0x9c47d08ffb10d4b8, 0xfd17b448a6855419, 0x5da4fbfc0e1108a8, 0x483ada7726a3c465 },
+};
+
+static bool secp256k1_is_zero(const Secp256k1Fe a)
+{
+    return (a[0] | a[1] | a[2] | a[3]) == 0;
+}
+
+// r = (a - b) mod 2^256, returns the borrow
+static uint64_t secp256k1_sub_raw(Secp256k1Fe r, const Secp256k1Fe a, const Secp256k1Fe b)
+{
+    uint64_t borrow = 0;
+    for (size_t i = 0; i < 4; ++i) {
+        const uint128_t d = (uint128_t)a[i] - b[i] - borrow;
+        r[i] = (uint64_t)d;
+        borrow = (uint64_t)(d >> 64) & 1;
+    }
+    return borrow;
+}
+
+static bool secp256k1_ge(const Secp256k1Fe a, const Secp256k1Fe b)
+{
+    Secp256k1Fe t;
+    return secp256k1_sub_raw(t, a, b) == 0;
+}
+
+// r = a where mask is all ones, unchanged where it is zero
+static void secp256k1_cmov(Secp256k1Fe r, const Secp256k1Fe a, uint64_t mask)
+{
+    for (size_t i = 0; i < 4; ++i) {
+        r[i] ^= (r[i] ^ a[i]) & mask;
+    }
+}
+
+// All ones if a == b, zero otherwise, without branching
+static uint64_t secp256k1_eq_mask(uint64_t a, uint64_t b)
+{
+    return -(((a ^ b) - 1) >> 63);
+}
+
+// r = (carry * 2^256 + s) mod p for carry < 2^64
+static void secp256k1_fe_reduce(Secp256k1Fe r, const Secp256k1Fe s, uint64_t carry)
+{
+    uint128_t c = (uint128_t)carry * SECP256K1_C + s[0];
+    r[0] = (uint64_t)c;
+    for (size_t i = 1; i < 4; ++i) {
+        c = (c >> 64) + s[i];
+        r[i] = (uint64_t)c;
+    }
+
+    // if this wrapped past 2^256 again r is now small, so folding the
+    // carry in once more cannot wrap
+    c = (uint128_t)r[0] + (uint64_t)(c >> 64) * SECP256K1_C;
+    r[0] = (uint64_t)c;
+    for (size_t i = 1; i < 4; ++i) {
+        c = (c >> 64) + r[i];
+        r[i] = (uint64_t)c;
+    }
+
+    Secp256k1Fe t;
+    const uint64_t borrow = secp256k1_sub_raw(t, r, SECP256K1_P);
+    secp256k1_cmov(r, t, borrow - 1);
+}
+
+static void secp256k1_fe_add(Secp256k1Fe r, const Secp256k1Fe a, const Secp256k1Fe b)
+{
+    Secp256k1Fe s;
+    uint128_t c = 0;
+    for (size_t i = 0; i < 4; ++i) {
+        c += (uint128_t)a[i] + b[i];
+        s[i] = (uint64_t)c;
+        c >>= 64;
+    }
+    secp256k1_fe_reduce(r, s, (uint64_t)c);
+}
+
+static void secp256k1_fe_sub(Secp256k1Fe r, const Secp256k1Fe a, const Secp256k1Fe b)
+{
+    Secp256k1Fe s;
+    const uint64_t borrow = secp256k1_sub_raw(s, a, b);
+
+    // on a borrow s = a - b + 2^256, subtracting C gives a - b + p
+    const Secp256k1Fe c = { SECP256K1_C & -borrow, 0, 0, 0 };
+    secp256k1_sub_raw(r, s, c);
+}
+
+static void secp256k1_fe_mul(Secp256k1Fe r, const Secp256k1Fe a, const Secp256k1Fe b)
+{
+    uint64_t t[8] = { 0 };
+    for (size_t i = 0; i < 4; ++i) {
+        uint128_t c = 0;
+        for (size_t j = 0; j < 4; ++j) {
+            c += (uint128_t)a[i] * b[j] + t[i + j];
+            t[i + j] = (uint64_t)c;
+            c >>= 64;
+        }
+        t[i + 4] = (uint64_t)c;
+    }
+
+    // 2^256 = C mod p
+    Secp256k1Fe s;
+    uint128_t c = 0;
+    for (size_t i = 0; i < 4; ++i) {
+        c += (uint128_t)t[i + 4] * SECP256K1_C + t[i];
+        s[i] = (uint64_t)c;
+        c >>= 64;
+    }
+    secp256k1_fe_reduce(r, s, (uint64_t)c);
+}
+
+static void secp256k1_fe_sq(Secp256k1Fe r, const Secp256k1Fe a)
+{
+    secp256k1_fe_mul(r, a, a);
+}
+
+// r = a^(p - 2)
+static void secp256k1_fe_inv(Secp256k1Fe r, const Secp256k1Fe a)
+{
+    Secp256k1Fe e, acc = { 1, 0, 0, 0 };
+    const Secp256k1Fe two = { 2, 0, 0, 0 };
+    secp256k1_sub_raw(e, SECP256K1_P, two);
+
+    for (size_t i = 256; i > 0; --i) {
+        secp256k1_fe_sq(acc, acc);
+        if ((e[(i - 1) / 64] >> ((i - 1) % 64)) & 1) {
+            secp256k1_fe_mul(acc, acc, a);
+        }
+    }
+    memcpy(r, acc, sizeof(acc));
+}
+
+// dbl-2009-l
+static void secp256k1_dbl(Secp256k1Jacobian *r, const Secp256k1Jacobian *p)
+{
+    if (secp256k1_is_zero(p->z)) {
+        *r = *p;
+        return;
+    }
+
+    Secp256k1Fe a, b, c, d, e, f, t;
+    secp256k1_fe_sq(a, p->x);
+    secp256k1_fe_sq(b, p->y);
+    secp256k1_fe_sq(c, b);
+
+    // d = 2 * ((x + b)^2 - a - c)
+    secp256k1_fe_add(t, p->x, b);
+    secp256k1_fe_sq(t, t);
+    secp256k1_fe_sub(t, t, a);
+    secp256k1_fe_sub(t, t, c);
+    secp256k1_fe_add(d, t, t);
+
+    secp256k1_fe_add(e, a, a);
+    secp256k1_fe_add(e, e, a);
+    secp256k1_fe_sq(f, e);
+
+    // z3 = 2 * y * z, before p->y may be overwritten
+    Secp256k1Fe z3;
+    secp256k1_fe_mul(z3, p->y, p->z);
+    secp256k1_fe_add(z3, z3, z3);
+
+    // x3 = f - 2d, y3 = e * (d - x3) - 8c
+    Secp256k1Fe x3, y3;
+    secp256k1_fe_sub(x3, f, d);
+    secp256k1_fe_sub(x3, x3, d);
+    secp256k1_fe_sub(t, d, x3);
+    secp256k1_fe_mul(y3, e, t);
+    secp256k1_fe_add(c, c, c);
+    secp256k1_fe_add(c, c, c);
+    secp256k1_fe_add(c, c, c);
+    secp256k1_fe_sub(y3, y3, c);
+
+    memcpy(r->x, x3, sizeof(x3));
+    memcpy(r->y, y3, sizeof(y3));
+    memcpy(r->z, z3, sizeof(z3));
+}
+
+// madd-2007-bl, r = p + q
+static void secp256k1_madd(Secp256k1Jacobian *r, const Secp256k1Jacobian *p, const Secp256k1Affine *q)
+{
+    if (secp256k1_is_zero(p->z)) {
+        memcpy(r->x, q->x, sizeof(q->x));
+        memcpy(r->y, q->y, sizeof(q->y));
+        memset(r->z, 0, sizeof(r->z));
+        r->z[0] = 1;
+        return;
+    }
+
+    Secp256k1Fe z1z1, u2, s2, h, hh, i, j, rr, v, t;
+    secp256k1_fe_sq(z1z1, p->z);
+    secp256k1_fe_mul(u2, q->x, z1z1);
+    secp256k1_fe_mul(s2, q->y, p->z);
+    secp256k1_fe_mul(s2, s2, z1z1);
+    secp256k1_fe_sub(h, u2, p->x);
+    secp256k1_fe_sub(rr, s2, p->y);
+
+    if (secp256k1_is_zero(h)) {
+        if (secp256k1_is_zero(rr)) {
+            secp256k1_dbl(r, p);
+        } else {
+            memset(r, 0, sizeof(*r));
+        }
+        return;
+    }
+
+    secp256k1_fe_add(rr, rr, rr);
+    secp256k1_fe_sq(hh, h);
+    secp256k1_fe_add(i, hh, hh);
+    secp256k1_fe_add(i, i, i);
+    secp256k1_fe_mul(j, h, i);
+    secp256k1_fe_mul(v, p->x, i);
+
+    // x3 = rr^2 - j - 2v
+    Secp256k1Fe x3, y3, z3;
+    secp256k1_fe_sq(x3, rr);
+    secp256k1_fe_sub(x3, x3, j);
+    secp256k1_fe_sub(x3, x3, v);
+    secp256k1_fe_sub(x3, x3, v);
+
+    // y3 = rr * (v - x3) - 2 * y1 * j
+    secp256k1_fe_sub(t, v, x3);
+    secp256k1_fe_mul(y3, rr, t);
+    secp256k1_fe_mul(t, p->y, j);
+    secp256k1_fe_add(t, t, t);
+    secp256k1_fe_sub(y3, y3, t);
+
+    // z3 = (z1 + h)^2 - z1z1 - hh
+    secp256k1_fe_add(z3, p->z, h);
+    secp256k1_fe_sq(z3, z3);
+    secp256k1_fe_sub(z3, z3, z1z1);
+    secp256k1_fe_sub(z3, z3, hh);
+
+    memcpy(r->x, x3, sizeof(x3));
+    memcpy(r->y, y3, sizeof(y3));
+    memcpy(r->z, z3, sizeof(z3));
+}
+
+// Homogeneous projective coordinates, x = X / Z and y = Y / Z, for the
+// complete formulas
+typedef struct secp256k1_homogeneous {
+    Secp256k1Fe x, y, z;
+} Secp256k1Homogeneous;
+
+// r = 3b * a = 21 * a, as 16a + 4a + a
+static void secp256k1_fe_mul_b3(Secp256k1Fe r, const Secp256k1Fe a)
+{
+    Secp256k1Fe a4, t;
+    secp256k1_fe_add(a4, a, a);
+    secp256k1_fe_add(a4, a4, a4);
+    secp256k1_fe_add(t, a4, a4);
+    secp256k1_fe_add(t, t, t);
+    secp256k1_fe_add(t, t, a4);
+    secp256k1_fe_add(r, t, a);
+}
+
+// r = p + q for any p, including the identity (0 : 1 : 0), and any affine
+// q. Algorithm 8 of Renes-Costello-Batina for a = 0, as homogeneous_madd
+// in crypto.c; complete since the group has prime order. r may alias p.
+static void secp256k1_hom_madd(Secp256k1Homogeneous *r, const Secp256k1Homogeneous *p, const Secp256k1Affine *q)
+{
+    Secp256k1Fe t0, t1, t2, t3, t4, x3, y3, z3;
+    secp256k1_fe_mul(t0, p->x, q->x);   // t0 = X1 * x2
+    secp256k1_fe_mul(t1, p->y, q->y);   // t1 = Y1 * y2
+    secp256k1_fe_add(t3, q->x, q->y);   // t3 = x2 + y2
+    secp256k1_fe_add(t4, p->x, p->y);   // t4 = X1 + Y1
+    secp256k1_fe_mul(t3, t3, t4);       // t3 = t3 * t4
+    secp256k1_fe_add(t4, t0, t1);       // t4 = t0 + t1
+    secp256k1_fe_sub(t3, t3, t4);       // t3 = t3 - t4
+    secp256k1_fe_mul(t4, q->y, p->z);   // t4 = y2 * Z1
+    secp256k1_fe_add(t4, t4, p->y);     // t4 = t4 + Y1
+    secp256k1_fe_mul(y3, q->x, p->z);   // Y3 = x2 * Z1
+    secp256k1_fe_add(y3, y3, p->x);     // Y3 = Y3 + X1
+    secp256k1_fe_add(x3, t0, t0);       // X3 = t0 + t0
+    secp256k1_fe_add(t0, x3, t0);       // t0 = X3 + t0
+    secp256k1_fe_mul_b3(t2, p->z);      // t2 = b3 * Z1
+    secp256k1_fe_add(z3, t1, t2);       // Z3 = t1 + t2
+    secp256k1_fe_sub(t1, t1, t2);       // t1 = t1 - t2
+    secp256k1_fe_mul_b3(y3, y3);        // Y3 = b3 * Y3
+    secp256k1_fe_mul(x3, t4, y3);       // X3 = t4 * Y3
+    secp256k1_fe_mul(t2, t3, t1);       // t2 = t3 * t1
+    secp256k1_fe_sub(x3, t2, x3);       // X3 = t2 - X3
+    secp256k1_fe_mul(y3, y3, t0);       // Y3 = Y3 * t0
+    secp256k1_fe_mul(t1, t1, z3);       // t1 = t1 * Z3
+    secp256k1_fe_add(y3, t1, y3);       // Y3 = t1 + Y3
+    secp256k1_fe_mul(t0, t0, t3);       // t0 = t0 * t3
+    secp256k1_fe_mul(z3, z3, t4);       // Z3 = Z3 * t4
+    secp256k1_fe_add(z3, z3, t0);       // Z3 = Z3 + t0
+
+    memcpy(r->x, x3, sizeof(x3));
+    memcpy(r->y, y3, sizeof(y3));
+    memcpy(r->z, z3, sizeof(z3));
+}
+
+// Montgomery batch inversion of the z coordinates, none of them zero.
+// Prefix products are kept in r[i].x.
+static void secp256k1_to_affine_batch(Secp256k1Affine *r, const Secp256k1Jacobian *p, size_t n)
+{
+    if (n == 0) {
+        return;
+    }
+
+    memcpy(r[0].x, p[0].z, sizeof(Secp256k1Fe));
+    for (size_t i = 1; i < n; ++i) {
+        secp256k1_fe_mul(r[i].x, r[i - 1].x, p[i].z);
+    }
+
+    Secp256k1Fe inv, zinv, zinv2, zinv3;
+    secp256k1_fe_inv(inv, r[n - 1].x);
+
+    for (size_t i = n; i-- > 0;) {
+        if (i > 0) {
+            secp256k1_fe_mul(zinv, inv, r[i - 1].x);
+            secp256k1_fe_mul(inv, inv, p[i].z);
+        } else {
+            memcpy(zinv, inv, sizeof(inv));
+        }
+
+        secp256k1_fe_sq(zinv2, zinv);
+        secp256k1_fe_mul(zinv3, zinv2, zinv);
+        secp256k1_fe_mul(r[i].x, p[i].x, zinv2);
+        secp256k1_fe_mul(r[i].y, p[i].y, zinv3);
+    }
+}
+
+// Fixed-base table, 4-bit windows as for the Pallas generator
+//
+//     secp256k1_table[i][j - 1] = j * 16^i * G,  1 <= j < 16
+#define SECP256K1_WINDOW_BITS 4
+#define SECP256K1_WINDOWS (256 / SECP256K1_WINDOW_BITS)
+#define SECP256K1_WINDOW_POINTS ((1 << SECP256K1_WINDOW_BITS) - 1)
+
+static Secp256k1Affine secp256k1_table[SECP256K1_WINDOWS][SECP256K1_WINDOW_POINTS];
+static pthread_once_t secp256k1_table_once = PTHREAD_ONCE_INIT;
+
+static void secp256k1_table_init(void)
+{
+    Secp256k1Affine base = SECP256K1_G;
+    Secp256k1Jacobian row[SECP256K1_WINDOW_POINTS + 1];
+    Secp256k1Affine row_affine[SECP256K1_WINDOW_POINTS + 1];
+
+    for (size_t i = 0; i < SECP256K1_WINDOWS; ++i) {
+        // row[j] = (j + 1) * base, the last entry is the next base
+        memset(&row[0], 0, sizeof(row[0]));
+        for (size_t j = 0; j <= SECP256K1_WINDOW_POINTS; ++j) {
+            secp256k1_madd(&row[j], j ? &row[j - 1] : &row[0], &base);
+        }
+
+        secp256k1_to_affine_batch(row_affine, row, SECP256K1_WINDOW_POINTS + 1);
+        memcpy(secp256k1_table[i], row_affine, sizeof(secp256k1_table[i]));
+        base = row_affine[SECP256K1_WINDOW_POINTS];
+    }
+}
+
+static void secp256k1_from_bytes(Secp256k1Fe r, const uint8_t in[32])
+{
+    for (size_t i = 0; i < 4; ++i) {
+        uint64_t limb = 0;
+        for (size_t j = 0; j < 8; ++j) {
+            limb = (limb << 8) | in[8 * (3 - i) + j];
+        }
+        r[i] = limb;
+    }
+}
+
+static void secp256k1_to_bytes(uint8_t out[32], const Secp256k1Fe a)
+{
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t j = 0; j < 8; ++j) {
+            out[8 * (3 - i) + j] = (uint8_t)(a[i] >> (56 - 8 * j));
+        }
+    }
+}
+
+// r = k * G for 0 < k < n, in constant time as generator_scalar_mul:
+// every window reads every entry of its row under a mask and does one
+// complete addition. A zero digit adds the first entry and keeps the old
+// sum.
+static void secp256k1_generator_mul(Secp256k1Jacobian *r, const Secp256k1Fe k)
+{
+    Secp256k1Homogeneous acc = { { 0, 0, 0, 0 }, { 1, 0, 0, 0 }, { 0, 0, 0, 0 } };
+
+    for (size_t i = 0; i < SECP256K1_WINDOWS; ++i) {
+        const size_t bit = SECP256K1_WINDOW_BITS * i;
+        const uint64_t digit = (k[bit / 64] >> (bit % 64)) & SECP256K1_WINDOW_POINTS;
+
+        Secp256k1Affine q = secp256k1_table[i][0];
+        for (size_t j = 2; j <= SECP256K1_WINDOW_POINTS; ++j) {
+            const uint64_t take = secp256k1_eq_mask(digit, j);
+            secp256k1_cmov(q.x, secp256k1_table[i][j - 1].x, take);
+            secp256k1_cmov(q.y, secp256k1_table[i][j - 1].y, take);
+        }
+
+        Secp256k1Homogeneous sum;
+        secp256k1_hom_madd(&sum, &acc, &q);
+
+        const uint64_t keep = secp256k1_eq_mask(digit, 0);
+        secp256k1_cmov(sum.x, acc.x, keep);
+        secp256k1_cmov(sum.y, acc.y, keep);
+        secp256k1_cmov(sum.z, acc.z, keep);
+        acc = sum;
+    }
+
+    // Jacobian (X Z : Y Z^2 : Z)
+    Secp256k1Fe z2;
+    secp256k1_fe_sq(z2, acc.z);
+    secp256k1_fe_mul(r->x, acc.x, acc.z);
+    secp256k1_fe_mul(r->y, acc.y, z2);
+    memcpy(r->z, acc.z, sizeof(acc.z));
+}
+
+bool secp256k1_key_valid(const uint8_t key[SECP256K1_KEY_BYTES])
+{
+    Secp256k1Fe k;
+    secp256k1_from_bytes(k, key);
+    return !secp256k1_is_zero(k) && !secp256k1_ge(k, SECP256K1_N);
+}
+
+bool secp256k1_key_tweak_add(uint8_t out[SECP256K1_KEY_BYTES], const uint8_t key[SECP256K1_KEY_BYTES],
+                             const uint8_t tweak[SECP256K1_KEY_BYTES])
+{
+    Secp256k1Fe k, t, s;
+    secp256k1_from_bytes(k, key);
+    secp256k1_from_bytes(t, tweak);
+    if (secp256k1_ge(t, SECP256K1_N)) {
+        return false;
+    }
+
+    uint128_t c = 0;
+    for (size_t i = 0; i < 4; ++i) {
+        c += (uint128_t)k[i] + t[i];
+        s[i] = (uint64_t)c;
+        c >>= 64;
+    }
+
+    // subtract n if the sum carried out or is at least n
+    Secp256k1Fe reduced;
+    const uint64_t borrow = secp256k1_sub_raw(reduced, s, SECP256K1_N);
+    secp256k1_cmov(s, reduced, -((uint64_t)c | (borrow ^ 1)));
+
+    const bool ok = !secp256k1_is_zero(s);
+    if (ok) {
+        secp256k1_to_bytes(out, s);
+    }
+    memset(k, 0, sizeof(k));
+    memset(s, 0, sizeof(s));
+    memset(reduced, 0, sizeof(reduced));
+    return ok;
+}
+
+void secp256k1_pubkeys(uint8_t (*out)[SECP256K1_PUBKEY_BYTES], const uint8_t (*keys)[SECP256K1_KEY_BYTES], size_t n)
+{
+    pthread_once(&secp256k1_table_once, secp256k1_table_init);
+
+    Secp256k1Jacobian points[SECP256K1_BATCH];
+    Secp256k1Affine affine[SECP256K1_BATCH];
+
+    for (size_t i = 0; i < n; i += SECP256K1_BATCH) {
+        const size_t len = (n - i < SECP256K1_BATCH) ? n - i : SECP256K1_BATCH;
+
+        for (size_t j = 0; j < len; ++j) {
+            Secp256k1Fe k;
+            secp256k1_from_bytes(k, keys[i + j]);
+            secp256k1_generator_mul(&points[j], k);
+            memset(k, 0, sizeof(k));
+        }
+        secp256k1_to_affine_batch(affine, points, len);
+
+        for (size_t j = 0; j < len; ++j) {
+            out[i + j][0] = 0x02 | (affine[j].y[0] & 1);
+            secp256k1_to_bytes(out[i + j] + 1, affine[j].x);
+        }
+    }
+}
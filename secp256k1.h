@@ -0,0 +1,27 @@
+// Minimal secp256k1 for BIP32 derivation: public keys and key tweaks
+//
+// Keys are 32-byte big-endian integers, as in BIP32. Arithmetic on keys
+// runs in constant time; only failures (a tweak or key out of range) are
+// reported early.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define SECP256K1_KEY_BYTES 32
+#define SECP256K1_PUBKEY_BYTES 33 // compressed
+
+// Points normalized together by secp256k1_pubkeys
+#define SECP256K1_BATCH 64
+
+// 0 < key < n
+bool secp256k1_key_valid(const uint8_t key[SECP256K1_KEY_BYTES]);
+
+// out = key + tweak mod n, false if tweak >= n or the result is zero
+bool secp256k1_key_tweak_add(uint8_t out[SECP256K1_KEY_BYTES], const uint8_t key[SECP256K1_KEY_BYTES],
+                             const uint8_t tweak[SECP256K1_KEY_BYTES]);
+
+// Compressed public keys of valid private keys
+void secp256k1_pubkeys(uint8_t (*out)[SECP256K1_PUBKEY_BYTES], const uint8_t (*keys)[SECP256K1_KEY_BYTES], size_t n);
@@ -0,0 +1,141 @@
+#include <string.h>
+#include "sha256.h"
+
+static const uint32_t SHA256_K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+static uint32_t sha256_rotr(uint32_t x, unsigned n)
+{
+    return (x >> n) | (x << (32 - n));
+}
+
+static uint32_t sha256_load_be(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static void sha256_store_be(uint8_t *p, uint32_t x)
+{
+    p[0] = (uint8_t)(x >> 24);
+    p[1] = (uint8_t)(x >> 16);
+    p[2] = (uint8_t)(x >> 8);
+    p[3] = (uint8_t)x;
+}
+
+static void sha256_compress(uint32_t h[8], const uint8_t block[SHA256_BLOCK_BYTES])
+{
+    uint32_t w[64];
+    for (size_t i = 0; i < 16; ++i) {
+        w[i] = sha256_load_be(block + 4 * i);
+    }
+    for (size_t i = 16; i < 64; ++i) {
+        const uint32_t s0 = sha256_rotr(w[i - 15], 7) ^ sha256_rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        const uint32_t s1 = sha256_rotr(w[i - 2], 17) ^ sha256_rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4], f = h[5], g = h[6], k = h[7];
+    for (size_t i = 0; i < 64; ++i) {
+        const uint32_t s1 = sha256_rotr(e, 6) ^ sha256_rotr(e, 11) ^ sha256_rotr(e, 25);
+        const uint32_t ch = (e & f) ^ (~e & g);
+        const uint32_t t1 = k + s1 + ch + SHA256_K[i] + w[i];
+        const uint32_t s0 = sha256_rotr(a, 2) ^ sha256_rotr(a, 13) ^ sha256_rotr(a, 22);
+        const uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+        const uint32_t t2 = s0 + maj;
+
+        k = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+
+    h[0] += a;
+    h[1] += b;
+    h[2] += c;
+    h[3] += d;
+    h[4] += e;
+    h[5] += f;
+    h[6] += g;
+    h[7] += k;
+}
+
+void sha256_init(Sha256State *state)
+{
+    static const uint32_t SHA256_IV[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+    };
+
+    memcpy(state->h, SHA256_IV, sizeof(SHA256_IV));
+    state->buf_len = 0;
+    state->total_len = 0;
+}
+
+void sha256_update(Sha256State *state, const void *data, size_t len)
+{
+    const uint8_t *in = data;
+    state->total_len += len;
+
+    if (state->buf_len > 0) {
+        size_t take = SHA256_BLOCK_BYTES - state->buf_len;
+        if (take > len) {
+            take = len;
+        }
+        memcpy(state->buf + state->buf_len, in, take);
+        state->buf_len += take;
+        in += take;
+        len -= take;
+
+        if (state->buf_len < SHA256_BLOCK_BYTES) {
+            return;
+        }
+        sha256_compress(state->h, state->buf);
+        state->buf_len = 0;
+    }
+
+    for (; len >= SHA256_BLOCK_BYTES; in += SHA256_BLOCK_BYTES, len -= SHA256_BLOCK_BYTES) {
+        sha256_compress(state->h, in);
+    }
+
+    memcpy(state->buf, in, len);
+    state->buf_len = len;
+}
+
+void sha256_final(Sha256State *state, uint8_t out[SHA256_DIGEST_BYTES])
+{
+    const uint64_t bits = state->total_len * 8;
+
+    state->buf[state->buf_len++] = 0x80;
+    if (state->buf_len > SHA256_BLOCK_BYTES - 8) {
+        memset(state->buf + state->buf_len, 0, SHA256_BLOCK_BYTES - state->buf_len);
+        sha256_compress(state->h, state->buf);
+        state->buf_len = 0;
+    }
+    memset(state->buf + state->buf_len, 0, SHA256_BLOCK_BYTES - 8 - state->buf_len);
+    sha256_store_be(state->buf + SHA256_BLOCK_BYTES - 8, (uint32_t)(bits >> 32));
+    sha256_store_be(state->buf + SHA256_BLOCK_BYTES - 4, (uint32_t)bits);
+    sha256_compress(state->h, state->buf);
+
+    for (size_t i = 0; i < 8; ++i) {
+        sha256_store_be(out + 4 * i, state->h[i]);
+    }
+}
+
+void sha256(uint8_t out[SHA256_DIGEST_BYTES], const void *data, size_t len)
+{
+    Sha256State state;
+    sha256_init(&state);
+    sha256_update(&state, data, len);
+    sha256_final(&state, out);
+}
@@ -0,0 +1,22 @@
+// SHA-256 (FIPS 180-4), used for base58check checksums
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SHA256_BLOCK_BYTES 64
+#define SHA256_DIGEST_BYTES 32
+
+typedef struct sha256_state {
+    uint32_t h[8];
+    uint8_t buf[SHA256_BLOCK_BYTES];
+    size_t buf_len;
+    uint64_t total_len;
+} Sha256State;
+
+void sha256_init(Sha256State *state);
+void sha256_update(Sha256State *state, const void *data, size_t len);
+void sha256_final(Sha256State *state, uint8_t out[SHA256_DIGEST_BYTES]);
+
+void sha256(uint8_t out[SHA256_DIGEST_BYTES], const void *data, size_t len);
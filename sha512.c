@@ -0,0 +1,184 @@
+#include <string.h>
+#include "sha512.h"
+
+static const uint64_t SHA512_K[80] = {
+    0x428a2f98d728ae22, 0x7137449123ef65cd, 0xb5c0fbcfec4d3b2f, 0xe9b5dba58189dbbc, 0x3956c25bf348b538,
+    0x59f111f1b605d019, 0x923f82a4af194f9b, 0xab1c5ed5da6d8118, 0xd807aa98a3030242, 0x12835b0145706fbe,
+    0x243185be4ee4b28c, 0x550c7dc3d5ffb4e2, 0x72be5d74f27b896f, 0x80deb1fe3b1696b1, 0x9bdc06a725c71235,
+    0xc19bf174cf692694, 0xe49b69c19ef14ad2, 0xefbe4786384f25e3, 0x0fc19dc68b8cd5b5, 0x240ca1cc77ac9c65,
+    0x2de92c6f592b0275, 0x4a7484aa6ea6e483, 0x5cb0a9dcbd41fbd4, 0x76f988da831153b5, 0x983e5152ee66dfab,
+    0xa831c66d2db43210, 0xb00327c898fb213f, 0xbf597fc7beef0ee4, 0xc6e00bf33da88fc2, 0xd5a79147930aa725,
+    0x06ca6351e003826f, 0x142929670a0e6e70, 0x27b70a8546d22ffc, 0x2e1b21385c26c926, 0x4d2c6dfc5ac42aed,
+    0x53380d139d95b3df, 0x650a73548baf63de, 0x766a0abb3c77b2a8, 0x81c2c92e47edaee6, 0x92722c851482353b,
+    0xa2bfe8a14cf10364, 0xa81a664bbc423001, 0xc24b8b70d0f89791, 0xc76c51a30654be30, 0xd192e819d6ef5218,
+    0xd69906245565a910, 0xf40e35855771202a, 0x106aa07032bbd1b8, 0x19a4c116b8d2d0c8, 0x1e376c085141ab53,
+    0x2748774cdf8eeb99, 0x34b0bcb5e19b48a8, 0x391c0cb3c5c95a63, 0x4ed8aa4ae3418acb, 0x5b9cca4f7763e373,
+    0x682e6ff3d6b2b8a3, 0x748f82ee5defb2fc, 0x78a5636f43172f60, 0x84c87814a1f0ab72, 0x8cc702081a6439ec,
+    0x90befffa23631e28, 0xa4506cebde82bde9, 0xbef9a3f7b2c67915, 0xc67178f2e372532b, 0xca273eceea26619c,
+    0xd186b8c721c0c207, 0xeada7dd6cde0eb1e, 0xf57d4f7fee6ed178, 0x06f067aa72176fba, 0x0a637dc5a2c898a6,
+    0x113f9804bef90dae, 0x1b710b35131c471b, 0x28db77f523047d84, 0x32caab7b40c72493, 0x3c9ebe0a15c9bebc,
+    0x431d67c49c100d4c, 0x4cc5d4becb3e42b6, 0x597f299cfc657e2a, 0x5fcb6fab3ad6faec, 0x6c44198c4a475817,
+};
+
+static uint64_t sha512_rotr(uint64_t x, unsigned n)
+{
+    return (x >> n) | (x << (64 - n));
+}
+
+static uint64_t sha512_load_be(const uint8_t *p)
+{
+    uint64_t x = 0;
+    for (size_t i = 0; i < 8; ++i) {
+        x = (x << 8) | p[i];
+    }
+    return x;
+}
+
+static void sha512_store_be(uint8_t *p, uint64_t x)
+{
+    for (size_t i = 0; i < 8; ++i) {
+        p[i] = (uint8_t)(x >> (56 - 8 * i));
+    }
+}
+
+static void sha512_compress(uint64_t h[8], const uint8_t block[SHA512_BLOCK_BYTES])
+{
+    uint64_t w[80];
+    for (size_t i = 0; i < 16; ++i) {
+        w[i] = sha512_load_be(block + 8 * i);
+    }
+    for (size_t i = 16; i < 80; ++i) {
+        const uint64_t s0 = sha512_rotr(w[i - 15], 1) ^ sha512_rotr(w[i - 15], 8) ^ (w[i - 15] >> 7);
+        const uint64_t s1 = sha512_rotr(w[i - 2], 19) ^ sha512_rotr(w[i - 2], 61) ^ (w[i - 2] >> 6);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint64_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4], f = h[5], g = h[6], k = h[7];
+    for (size_t i = 0; i < 80; ++i) {
+        const uint64_t s1 = sha512_rotr(e, 14) ^ sha512_rotr(e, 18) ^ sha512_rotr(e, 41);
+        const uint64_t ch = (e & f) ^ (~e & g);
+        const uint64_t t1 = k + s1 + ch + SHA512_K[i] + w[i];
+        const uint64_t s0 = sha512_rotr(a, 28) ^ sha512_rotr(a, 34) ^ sha512_rotr(a, 39);
+        const uint64_t maj = (a & b) ^ (a & c) ^ (b & c);
+        const uint64_t t2 = s0 + maj;
+
+        k = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+
+    h[0] += a;
+    h[1] += b;
+    h[2] += c;
+    h[3] += d;
+    h[4] += e;
+    h[5] += f;
+    h[6] += g;
+    h[7] += k;
+}
+
+void sha512_init(Sha512State *state)
+{
+    static const uint64_t SHA512_IV[8] = {
+        0x6a09e667f3bcc908, 0xbb67ae8584caa73b, 0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1,
+        0x510e527fade682d1, 0x9b05688c2b3e6c1f, 0x1f83d9abfb41bd6b, 0x5be0cd19137e2179,
+    };
+
+    memcpy(state->h, SHA512_IV, sizeof(SHA512_IV));
+    state->buf_len = 0;
+    state->total_len = 0;
+}
+
+void sha512_update(Sha512State *state, const void *data, size_t len)
+{
+    const uint8_t *in = data;
+    state->total_len += len;
+
+    if (state->buf_len > 0) {
+        size_t take = SHA512_BLOCK_BYTES - state->buf_len;
+        if (take > len) {
+            take = len;
+        }
+        memcpy(state->buf + state->buf_len, in, take);
+        state->buf_len += take;
+        in += take;
+        len -= take;
+
+        if (state->buf_len < SHA512_BLOCK_BYTES) {
+            return;
+        }
+        sha512_compress(state->h, state->buf);
+        state->buf_len = 0;
+    }
+
+    for (; len >= SHA512_BLOCK_BYTES; in += SHA512_BLOCK_BYTES, len -= SHA512_BLOCK_BYTES) {
+        sha512_compress(state->h, in);
+    }
+
+    memcpy(state->buf, in, len);
+    state->buf_len = len;
+}
+
+void sha512_final(Sha512State *state, uint8_t out[SHA512_DIGEST_BYTES])
+{
+    const uint64_t bits = state->total_len * 8;
+
+    // 128-bit length, messages here are far below 2^64 bits
+    state->buf[state->buf_len++] = 0x80;
+    if (state->buf_len > SHA512_BLOCK_BYTES - 16) {
+        memset(state->buf + state->buf_len, 0, SHA512_BLOCK_BYTES - state->buf_len);
+        sha512_compress(state->h, state->buf);
+        state->buf_len = 0;
+    }
+    memset(state->buf + state->buf_len, 0, SHA512_BLOCK_BYTES - 8 - state->buf_len);
+    sha512_store_be(state->buf + SHA512_BLOCK_BYTES - 8, bits);
+    sha512_compress(state->h, state->buf);
+
+    for (size_t i = 0; i < 8; ++i) {
+        sha512_store_be(out + 8 * i, state->h[i]);
+    }
+}
+
+void sha512(uint8_t out[SHA512_DIGEST_BYTES], const void *data, size_t len)
+{
+    Sha512State state;
+    sha512_init(&state);
+    sha512_update(&state, data, len);
+    sha512_final(&state, out);
+}
+
+void hmac_sha512(uint8_t out[SHA512_DIGEST_BYTES], const void *key, size_t key_len, const void *data, size_t len)
+{
+    uint8_t pad[SHA512_BLOCK_BYTES] = { 0 };
+    if (key_len > SHA512_BLOCK_BYTES) {
+        sha512(pad, key, key_len);
+    } else {
+        memcpy(pad, key, key_len);
+    }
+
+    for (size_t i = 0; i < SHA512_BLOCK_BYTES; ++i) {
+        pad[i] ^= 0x36;
+    }
+    uint8_t inner[SHA512_DIGEST_BYTES];
+    Sha512State state;
+    sha512_init(&state);
+    sha512_update(&state, pad, sizeof(pad));
+    sha512_update(&state, data, len);
+    sha512_final(&state, inner);
+
+    for (size_t i = 0; i < SHA512_BLOCK_BYTES; ++i) {
+        pad[i] ^= 0x36 ^ 0x5c;
+    }
+    sha512_init(&state);
+    sha512_update(&state, pad, sizeof(pad));
+    sha512_update(&state, inner, sizeof(inner));
+    sha512_final(&state, out);
+
+    memset(pad, 0, sizeof(pad));
+    memset(inner, 0, sizeof(inner));
+}
@@ -0,0 +1,24 @@
+// SHA-512 (FIPS 180-4) and HMAC-SHA512, used for BIP32 derivation
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SHA512_BLOCK_BYTES 128
+#define SHA512_DIGEST_BYTES 64
+
+typedef struct sha512_state {
+    uint64_t h[8];
+    uint8_t buf[SHA512_BLOCK_BYTES];
+    size_t buf_len;
+    uint64_t total_len;
+} Sha512State;
+
+void sha512_init(Sha512State *state);
+void sha512_update(Sha512State *state, const void *data, size_t len);
+void sha512_final(Sha512State *state, uint8_t out[SHA512_DIGEST_BYTES]);
+
+void sha512(uint8_t out[SHA512_DIGEST_BYTES], const void *data, size_t len);
+
+void hmac_sha512(uint8_t out[SHA512_DIGEST_BYTES], const void *key, size_t key_len, const void *data, size_t len);
@@ -0,0 +1,142 @@
+#include <string.h>
+#include "test.h"
+#include "crypto.h"
+#include "libbase58.h"
+#include "pasta_fp.h"
+
+typedef struct test {
+    const char *name;
+    void (*run)(void);
+} Test;
+
+static const Test TESTS[] = {
+    { "chains", test_chains },
+    { "sqrt", test_sqrt },
+    { "legendre", test_legendre },
+    { "decimal", test_decimal },
+    { "generator", test_generator },
+    { "homogeneous", test_homogeneous },
+    { "decompress", test_decompress },
+    { "sign", test_sign },
+    { "verify", test_verify },
+    { "verify_batch", test_verify_batch },
+    { "opcount", test_opcount },
+    { "stress", test_stress },
+    { "keygen", test_keygen },
+    { "vanity", test_vanity },
+    { "bip32", test_bip32 },
+    { "hd", test_hd },
+    { "record", test_record },
+    { "resume", test_resume },
+    { "encoding", test_encoding },
+    { "keycache", test_keycache },
+    { "verifycache", test_verifycache },
+};
+
+#define NUM_TESTS (sizeof(TESTS) / sizeof(TESTS[0]))
+
+static size_t test_failures = 0;
+
+bool test_check(bool ok, const char *file, int line, const char *expr)
+{
+    if (!ok) {
+        printf("  %s:%d: check failed: %s\n", file, line, expr);
+        test_failures += 1;
+    }
+    return ok;
+}
+
+static uint64_t test_state = 0x9e3779b97f4a7c15ULL;
+
+uint64_t test_rand(void)
+{
+    test_state ^= test_state << 13;
+    test_state ^= test_state >> 7;
+    test_state ^= test_state << 17;
+    return test_state;
+}
+
+void test_rand_field(uint64_t out[4])
+{
+    for (size_t i = 0; i < 4; ++i) {
+        out[i] = test_rand();
+    }
+    out[3] &= (((uint64_t)1 << 62) - 1);
+}
+
+void test_rand_transaction(Transaction *txn)
+{
+    memset(txn, 0, sizeof(Transaction));
+
+    txn->fee = test_rand() % COIN;
+    txn->fee_token = 1;
+    test_rand_field(txn->fee_payer_pk.x);
+    txn->fee_payer_pk.is_odd = test_rand() & 1;
+    txn->nonce = (Nonce)test_rand();
+    txn->valid_until = (GlobalSlot)test_rand();
+    txn->memo[0] = 1;
+    txn->memo[1] = 0;
+
+    txn->source_pk = txn->fee_payer_pk;
+    test_rand_field(txn->receiver_pk.x);
+    txn->receiver_pk.is_odd = test_rand() & 1;
+    txn->token_id = 1;
+    txn->amount = test_rand() % (1000 * COIN);
+}
+
+void test_rand_keypair(Keypair *kp)
+{
+    test_rand_field(kp->priv);
+    generate_pubkey(&kp->pub, kp->priv);
+}
+
+bool test_read_address(Compressed *out, const char *address)
+{
+    uint8_t bytes[40];
+    size_t len = sizeof(bytes);
+    if (!b58tobin(bytes, &len, address, 0) || len != sizeof(bytes)
+        || b58check(bytes, sizeof(bytes), address, 0) != 0xcb) {
+        return false;
+    }
+
+    uint64_t x[4] = { 0, 0, 0, 0 };
+    for (size_t i = 0; i < 32; ++i) {
+        x[i / 8] |= (uint64_t)bytes[3 + i] << (8 * (i % 8));
+    }
+    fiat_pasta_fp_to_montgomery(out->x, x);
+    out->is_odd = bytes[35];
+    return true;
+}
+
+void test_read_hex(uint64_t out[4], const char *hex)
+{
+    memset(out, 0, 4 * sizeof(uint64_t));
+    for (size_t i = 0; i < 64; ++i) {
+        const char c = hex[63 - i];
+        const uint64_t d = (c <= '9') ? (uint64_t)(c - '0') : (uint64_t)((c | 0x20) - 'a' + 10);
+        out[i / 16] |= d << (4 * (i % 16));
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    for (size_t i = 0; i < NUM_TESTS; ++i) {
+        bool selected = (argc < 2);
+        for (int j = 1; j < argc; ++j) {
+            selected |= (strcmp(argv[j], TESTS[i].name) == 0);
+        }
+
+        if (selected) {
+            const size_t before = test_failures;
+            printf("== %s\n", TESTS[i].name);
+            TESTS[i].run();
+            printf("  %s\n", test_failures == before ? "ok" : "FAILED");
+        }
+    }
+
+    if (test_failures) {
+        printf("%zu checks failed\n", test_failures);
+        return 1;
+    }
+    return 0;
+}
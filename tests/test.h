@@ -0,0 +1,59 @@
+// Correctness tests for the signer
+//
+//     ./test.out [name ...]
+//
+// runs the named tests (all of them by default) and exits with status 1
+// if any check failed. Inputs are generated with a fixed-seed xorshift so
+// failures reproduce.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+// Records a failure if cond is false, and keeps going
+#define CHECK(cond) test_check((cond), __FILE__, __LINE__, #cond)
+
+bool test_check(bool ok, const char *file, int line, const char *expr);
+
+uint64_t test_rand(void);
+
+// Random element of Fp or Fq in Montgomery form (< 2^254, so always reduced)
+void test_rand_field(uint64_t out[4]);
+
+// Random payment between random keys, and a random keypair
+struct transaction;
+struct keypair;
+struct compressed;
+void test_rand_transaction(struct transaction *txn);
+void test_rand_keypair(struct keypair *kp);
+
+// Decodes a B62... address, returns false if it is not one
+bool test_read_address(struct compressed *out, const char *address);
+
+// Parses 64 hex digits into little-endian limbs
+void test_read_hex(uint64_t out[4], const char *hex);
+
+void test_chains(void);
+void test_sqrt(void);
+void test_legendre(void);
+void test_generator(void);
+void test_homogeneous(void);
+void test_decompress(void);
+void test_sign(void);
+void test_verify(void);
+void test_verify_batch(void);
+void test_opcount(void);
+void test_stress(void);
+void test_keygen(void);
+void test_vanity(void);
+void test_bip32(void);
+void test_hd(void);
+void test_record(void);
+void test_resume(void);
+void test_encoding(void);
+void test_keycache(void);
+void test_verifycache(void);
+void test_decimal(void);
@@ -0,0 +1,114 @@
+#include <string.h>
+#include "test.h"
+#include "base10.h"
+#include "pasta_fp.h"
+#include "pasta_fq.h"
+
+#define DECIMAL_INPUTS 1000
+
+static const char *const P = "28948022309329048855892746252171976963363056481941560715954676764349967630337";
+static const char *const Q = "28948022309329048855892746252171976963363056481941647379679742748393362948097";
+static const char *const MAX = "115792089237316195423570985008687907853269984665640564039457584007913129639935";
+
+// Digit by digit, dividing by 10 a limb at a time
+static void reference_decimal(char out[DIGITS + 1], const uint64_t x[4])
+{
+    uint64_t n[4] = { x[0], x[1], x[2], x[3] };
+    char rev[DIGITS];
+    size_t len = 0;
+    do {
+        uint64_t rem = 0;
+        for (size_t i = 4; i-- > 0;) {
+            const unsigned __int128 cur = ((unsigned __int128)rem << 64) | n[i];
+            n[i] = (uint64_t)(cur / 10);
+            rem = (uint64_t)(cur % 10);
+        }
+        rev[len++] = (char)('0' + rem);
+    } while (n[0] | n[1] | n[2] | n[3]);
+
+    for (size_t i = 0; i < len; ++i) {
+        out[i] = rev[len - 1 - i];
+    }
+    out[len] = '\0';
+}
+
+static void check_round_trip(const uint64_t x[4])
+{
+    char expected[DIGITS + 1], actual[DIGITS + 1];
+    uint64_t back[4];
+    reference_decimal(expected, x);
+    CHECK(bigint_to_decimal(actual, x) == strlen(expected));
+    CHECK(strcmp(actual, expected) == 0);
+    CHECK(bigint_from_decimal(back, actual, strlen(actual)));
+    CHECK(memcmp(back, x, sizeof(back)) == 0);
+}
+
+void test_decimal(void)
+{
+    // chunk boundaries: 10^19 - 1, 10^19, 2^64 - 1, 2^64, and zeros inside
+    static const char *const EDGES[] = {
+        "0", "1", "9999999999999999999", "10000000000000000000", "18446744073709551615", "18446744073709551616",
+        "100000000000000000000000000000000000000", "1000000000000000000000000000000000000000000000000000000000",
+        "10000000000000000000000000000000000000000000000000000000000000000000000000000",
+    };
+    for (size_t i = 0; i < sizeof(EDGES) / sizeof(EDGES[0]); ++i) {
+        uint64_t x[4];
+        CHECK(bigint_from_decimal(x, EDGES[i], strlen(EDGES[i])));
+        check_round_trip(x);
+    }
+
+    const uint64_t max[4] = { ~0ULL, ~0ULL, ~0ULL, ~0ULL };
+    char buf[DIGITS + 1];
+    bigint_to_decimal(buf, max);
+    CHECK(strcmp(buf, MAX) == 0);
+
+    for (size_t i = 0; i < DECIMAL_INPUTS; ++i) {
+        uint64_t x[4];
+        for (size_t j = 0; j < 4; ++j) {
+            x[j] = test_rand();
+        }
+        // short values too
+        for (size_t j = test_rand() % 5; j < 4; ++j) {
+            x[j] = 0;
+        }
+        check_round_trip(x);
+    }
+
+    // rejected: empty, non-digits, 2^256, more than DIGITS digits
+    uint64_t x[4];
+    char too_many[DIGITS + 2];
+    memset(too_many, '0', sizeof(too_many));
+    CHECK(!bigint_from_decimal(x, "", 0));
+    CHECK(!bigint_from_decimal(x, "12a4", 4));
+    CHECK(!bigint_from_decimal(x, "-1", 2));
+    CHECK(!bigint_from_decimal(x, "115792089237316195423570985008687907853269984665640564039457584007913129639936", 78));
+    CHECK(!bigint_from_decimal(x, too_many, sizeof(too_many)));
+
+    // field elements: below the modulus only, in Montgomery form
+    uint64_t out[4], expected[4], one[4] = { 1, 0, 0, 0 };
+    CHECK(!field_from_decimal(out, P, strlen(P)));
+    CHECK(!field_from_decimal(out, Q, strlen(Q)));
+    CHECK(scalar_from_decimal(out, P, strlen(P)));
+    CHECK(!scalar_from_decimal(out, Q, strlen(Q)));
+    CHECK(field_from_decimal(out, "1", 1));
+    fiat_pasta_fp_to_montgomery(expected, one);
+    CHECK(memcmp(out, expected, sizeof(out)) == 0);
+
+    for (size_t i = 0; i < DECIMAL_INPUTS / 10; ++i) {
+        uint64_t v[4], fs[2][4], ss[2][4];
+        test_rand_field(v);
+        bigint_to_decimal(buf, v);
+
+        const char *strs[2] = { buf, "12" };
+        const size_t lens[2] = { strlen(buf), 2 };
+        CHECK(field_from_decimal_batch(fs, strs, lens, 2) == 2);
+        fiat_pasta_fp_to_montgomery(expected, v);
+        CHECK(memcmp(fs[0], expected, sizeof(expected)) == 0);
+        CHECK(scalar_from_decimal_batch(ss, strs, lens, 2) == 2);
+        fiat_pasta_fq_to_montgomery(expected, v);
+        CHECK(memcmp(ss[0], expected, sizeof(expected)) == 0);
+
+        const char *bad[2] = { buf, "x" };
+        CHECK(field_from_decimal_batch(fs, bad, lens, 2) == 1);
+    }
+}
@@ -0,0 +1,204 @@
+#include <string.h>
+#include "test.h"
+#include "pasta_fp.h"
+#include "pasta_fq.h"
+
+#define FIELD_INPUTS 500
+
+// The operations of one Pasta field, so every check runs on both
+typedef struct field_ops {
+    const char *name;
+    const uint64_t *modulus;           // little-endian limbs
+    const uint64_t *minus_1_div_2;     // (m - 1) / 2
+    void (*to_montgomery)(uint64_t out[4], const uint64_t x[4]);
+    void (*set_one)(uint64_t out[4]);
+    void (*mul)(uint64_t out[4], const uint64_t a[4], const uint64_t b[4]);
+    void (*square)(uint64_t out[4], const uint64_t a[4]);
+    void (*opp)(uint64_t out[4], const uint64_t a[4]);
+    void (*pow)(uint64_t out[4], const uint64_t a[4], const uint64_t *exp, const size_t exp_limbs);
+    bool (*equals)(const uint64_t a[4], const uint64_t b[4]);
+    bool (*equals_zero)(const uint64_t a[4]);
+    bool (*sqrt)(uint64_t out[4], const uint64_t a[4]);
+    int (*legendre)(const uint64_t a[4]);
+} FieldOps;
+
+static const uint64_t FP_MODULUS[4] = {
+    0x992d30ed00000001, 0x224698fc094cf91b, 0x0000000000000000, 0x4000000000000000
+};
+static const uint64_t FP_MINUS_1_DIV_2[4] = {
+    0xcc96987680000000, 0x11234c7e04a67c8d, 0x0000000000000000, 0x2000000000000000
+};
+static const uint64_t FQ_MODULUS[4] = {
+    0x8c46eb2100000001, 0x224698fc0994a8dd, 0x0000000000000000, 0x4000000000000000
+};
+static const uint64_t FQ_MINUS_1_DIV_2[4] = {
+    0xc623759080000000, 0x11234c7e04ca546e, 0x0000000000000000, 0x2000000000000000
+};
+
+static const FieldOps FIELDS[] = {
+    { "fp", FP_MODULUS, FP_MINUS_1_DIV_2, fiat_pasta_fp_to_montgomery, fiat_pasta_fp_set_one, fiat_pasta_fp_mul,
+      fiat_pasta_fp_square, fiat_pasta_fp_opp, fiat_pasta_fp_pow, fiat_pasta_fp_equals, fiat_pasta_fp_equals_zero,
+      fiat_pasta_fp_sqrt, fiat_pasta_fp_legendre },
+    { "fq", FQ_MODULUS, FQ_MINUS_1_DIV_2, fiat_pasta_fq_to_montgomery, fiat_pasta_fq_set_one, fiat_pasta_fq_mul,
+      fiat_pasta_fq_square, fiat_pasta_fq_opp, fiat_pasta_fq_pow, fiat_pasta_fq_equals, fiat_pasta_fq_equals_zero,
+      fiat_pasta_fq_sqrt, fiat_pasta_fq_legendre },
+};
+
+#define NUM_FIELDS (sizeof(FIELDS) / sizeof(FIELDS[0]))
+
+// Euler's criterion: 1 for squares, -1 for non-squares, 0 for zero
+static int euler(const FieldOps *f, const uint64_t x[4])
+{
+    uint64_t r[4], one[4];
+    if (f->equals_zero(x)) {
+        return 0;
+    }
+    f->pow(r, x, f->minus_1_div_2, 4);
+    f->set_one(one);
+    return f->equals(r, one) ? 1 : -1;
+}
+
+// 0, 1, -1, 5 (a non-square in both fields), and m - 1 read as an integer
+static size_t edge_inputs(const FieldOps *f, uint64_t out[][4])
+{
+    uint64_t five[4] = { 5, 0, 0, 0 };
+    uint64_t m_minus_1[4];
+    memcpy(m_minus_1, f->modulus, sizeof(m_minus_1));
+    m_minus_1[0] -= 1;
+
+    memset(out[0], 0, sizeof(out[0]));
+    f->set_one(out[1]);
+    f->opp(out[2], out[1]);
+    f->to_montgomery(out[3], five);
+    f->to_montgomery(out[4], m_minus_1);
+    return 5;
+}
+
+static void check_sqrt(const FieldOps *f, const uint64_t x[4])
+{
+    uint64_t r[4], r2[4];
+    const int symbol = euler(f, x);
+    const bool found = f->sqrt(r, x);
+
+    CHECK(found == (symbol >= 0));
+    if (found) {
+        f->square(r2, r);
+        CHECK(f->equals(r2, x));
+    } else {
+        CHECK(f->equals_zero(r));
+    }
+}
+
+void test_sqrt(void)
+{
+    for (size_t i = 0; i < NUM_FIELDS; ++i) {
+        const FieldOps *f = &FIELDS[i];
+        uint64_t edges[5][4];
+        uint64_t x[4], x2[4], r[4];
+
+        const size_t edge_len = edge_inputs(f, edges);
+        for (size_t j = 0; j < edge_len; ++j) {
+            check_sqrt(f, edges[j]);
+        }
+        CHECK(!f->sqrt(r, edges[3])); // 5
+
+        size_t squares = 0;
+        for (size_t j = 0; j < FIELD_INPUTS; ++j) {
+            test_rand_field(x);
+            f->square(x2, x);
+            CHECK(f->sqrt(r, x2));
+            f->square(r, r);
+            CHECK(f->equals(r, x2));
+
+            check_sqrt(f, x);
+            squares += (euler(f, x) == 1);
+        }
+        // about half of the random inputs are squares
+        CHECK(squares > FIELD_INPUTS / 3 && squares < 2 * FIELD_INPUTS / 3);
+    }
+}
+
+void test_legendre(void)
+{
+    for (size_t i = 0; i < NUM_FIELDS; ++i) {
+        const FieldOps *f = &FIELDS[i];
+        uint64_t edges[5][4];
+        uint64_t x[4];
+
+        const size_t edge_len = edge_inputs(f, edges);
+        for (size_t j = 0; j < edge_len; ++j) {
+            CHECK(f->legendre(edges[j]) == euler(f, edges[j]));
+        }
+        CHECK(f->legendre(edges[3]) == -1); // 5
+
+        // small integers, both as they are and in Montgomery form
+        for (uint64_t j = 0; j < 64; ++j) {
+            uint64_t small[4] = { j, 0, 0, 0 };
+            CHECK(f->legendre(small) == euler(f, small));
+            f->to_montgomery(x, small);
+            CHECK(f->legendre(x) == euler(f, x));
+        }
+
+        for (size_t j = 0; j < FIELD_INPUTS; ++j) {
+            test_rand_field(x);
+            CHECK(f->legendre(x) == euler(f, x));
+
+            // squares, and non-squares of the form 5 * square
+            f->square(x, x);
+            CHECK(f->legendre(x) == 1);
+            f->mul(x, x, edges[3]);
+            CHECK(f->legendre(x) == -1);
+        }
+    }
+}
+
+// The generated chains against the sliding-window pow
+typedef struct chain_case {
+    const FieldOps *field;
+    uint64_t exp[4];
+    void (*chain)(uint64_t out[4], const uint64_t x[4]);
+} ChainCase;
+
+void test_chains(void)
+{
+    const ChainCase cases[] = {
+        { &FIELDS[0], { 0x992d30ecffffffff, 0x224698fc094cf91b, 0, 0x4000000000000000 },
+          fiat_pasta_fp_pow_p_minus_2 },
+        { &FIELDS[0], { 0xcc96987680000000, 0x11234c7e04a67c8d, 0, 0x2000000000000000 },
+          fiat_pasta_fp_pow_p_minus_1_div_2 },
+        { &FIELDS[0], { 0x04a67c8dcc969876, 0x0000000011234c7e, 0, 0x0000000020000000 },
+          fiat_pasta_fp_pow_t_minus_1_div_2 },
+        { &FIELDS[1], { 0x8c46eb20ffffffff, 0x224698fc0994a8dd, 0, 0x4000000000000000 },
+          fiat_pasta_fq_pow_q_minus_2 },
+        { &FIELDS[1], { 0xc623759080000000, 0x11234c7e04ca546e, 0, 0x2000000000000000 },
+          fiat_pasta_fq_pow_q_minus_1_div_2 },
+        { &FIELDS[1], { 0x04ca546ec6237590, 0x0000000011234c7e, 0, 0x0000000020000000 },
+          fiat_pasta_fq_pow_t_minus_1_div_2 },
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i) {
+        const ChainCase *c = &cases[i];
+        uint64_t x[4], expected[4], out[4], one[4];
+
+        for (size_t j = 0; j < FIELD_INPUTS / 10; ++j) {
+            test_rand_field(x);
+            c->field->pow(expected, x, c->exp, 4);
+            c->chain(out, x);
+            CHECK(c->field->equals(out, expected));
+        }
+
+        c->field->set_one(one);
+        c->chain(out, one);
+        CHECK(c->field->equals(out, one));
+    }
+
+    // x^(m - 2) is the inverse
+    uint64_t x[4], inv[4], one[4];
+    for (size_t i = 0; i < NUM_FIELDS; ++i) {
+        test_rand_field(x);
+        (i == 0 ? fiat_pasta_fp_pow_p_minus_2 : fiat_pasta_fq_pow_q_minus_2)(inv, x);
+        FIELDS[i].mul(inv, inv, x);
+        FIELDS[i].set_one(one);
+        CHECK(FIELDS[i].equals(inv, one));
+    }
+}
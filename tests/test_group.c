@@ -0,0 +1,188 @@
+#include <string.h>
+#include "test.h"
+#include "crypto.h"
+#include "pasta_fp.h"
+#include "pasta_fq.h"
+
+#define GROUP_INPUTS 64
+
+static const Affine GENERATOR = {
+    { 0x34786d38fffffffd, 0x992c350be41914ad, 0xffffffffffffffff, 0x3fffffffffffffff },
+    { 0x2f474795455d409d, 0xb443b9b74b8255d9, 0x270c412f2c9a5d66, 0x8e00f71ba43dd6b }
+};
+
+// q - 1, as an integer
+static const uint64_t GROUP_ORDER_MINUS_1[4] = {
+    0x8c46eb2100000000, 0x224698fc0994a8dd, 0x0000000000000000, 0x4000000000000000
+};
+
+static void check_generator_mul(const uint64_t k_int[4])
+{
+    Scalar k;
+    Group fixed;
+    Affine expected, actual;
+
+    fiat_pasta_fq_to_montgomery(k, k_int);
+    affine_scalar_mul(&expected, k, &GENERATOR);
+    generator_scalar_mul(&fixed, k);
+    projective_to_affine(&actual, &fixed);
+    CHECK(memcmp(&expected, &actual, sizeof(Affine)) == 0);
+}
+
+void test_generator(void)
+{
+    // zero digits, all-ones windows and the partial sums of the fixed-base
+    // path meeting the next table entry (15 + 16 * 0 + ..., 16, 31, ...)
+    static const uint64_t SMALL[] = { 0, 1, 2, 15, 16, 17, 31, 32, 255, 256, 0x10f, 0xffff, 0x10000 };
+    for (size_t i = 0; i < sizeof(SMALL) / sizeof(SMALL[0]); ++i) {
+        const uint64_t k[4] = { SMALL[i], 0, 0, 0 };
+        check_generator_mul(k);
+    }
+
+    // every window set, and runs of a single repeated digit
+    for (uint64_t digit = 0; digit < 16; ++digit) {
+        uint64_t k[4];
+        for (size_t i = 0; i < 4; ++i) {
+            k[i] = digit * 0x1111111111111111ULL;
+        }
+        k[3] &= (((uint64_t)1 << 62) - 1);
+        check_generator_mul(k);
+    }
+
+    check_generator_mul(GROUP_ORDER_MINUS_1);
+
+    // the generated table is the one the group operations build
+    FixedBaseTable *table = malloc(sizeof(FixedBaseTable));
+    fixed_base_table_init(table, &GENERATOR);
+    CHECK(memcmp(table, &GENERATOR_TABLE, sizeof(FixedBaseTable)) == 0);
+    free(table);
+
+    for (size_t i = 0; i < GROUP_INPUTS; ++i) {
+        uint64_t k[4];
+        test_rand_field(k);
+        check_generator_mul(k);
+    }
+}
+
+#define HOMOGENEOUS_MSM 70
+
+static bool is_identity(const Homogeneous *h)
+{
+    return (h->Z[0] | h->Z[1] | h->Z[2] | h->Z[3]) == 0;
+}
+
+static bool same_point(const Homogeneous *h, const Group *g)
+{
+    Affine a, b;
+    homogeneous_to_affine(&a, h);
+    projective_to_affine(&b, g);
+    return memcmp(&a, &b, sizeof(Affine)) == 0;
+}
+
+// The complete formulas against the Jacobian ones, including the inputs
+// the Jacobian ones treat specially: the identity, p = q and p = -q
+void test_homogeneous(void)
+{
+    const Affine zero = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } };
+    Scalar *ks = malloc(sizeof(Scalar) * HOMOGENEOUS_MSM);
+    Affine *ps = malloc(sizeof(Affine) * HOMOGENEOUS_MSM);
+
+    for (size_t i = 0; i < GROUP_INPUTS; ++i) {
+        Scalar k1, k2;
+        Affine p, q, neg_p;
+        test_rand_field(k1);
+        test_rand_field(k2);
+        affine_scalar_mul(&p, k1, &GENERATOR);
+        affine_scalar_mul(&q, k2, &GENERATOR);
+        neg_p = p;
+        fiat_pasta_fp_opp(neg_p.y, p.y);
+
+        Homogeneous hp, hq, hneg, hzero, h;
+        Group gp, gq, g;
+        affine_to_homogeneous(&hp, &p);
+        affine_to_homogeneous(&hq, &q);
+        affine_to_homogeneous(&hneg, &neg_p);
+        affine_to_homogeneous(&hzero, &zero);
+        affine_to_projective(&gp, &p);
+        affine_to_projective(&gq, &q);
+
+        // a homogeneous point whose Z is not 1
+        Homogeneous hp2;
+        homogeneous_dbl(&hp2, &hp);
+        group_dbl(&g, &gp);
+        CHECK(same_point(&hp2, &g));
+
+        homogeneous_add(&h, &hp, &hq);
+        group_add(&g, &gp, &gq);
+        CHECK(same_point(&h, &g));
+        homogeneous_madd(&h, &hp2, &q);
+        Group g2;
+        group_dbl(&g2, &gp);
+        group_add(&g, &g2, &gq);
+        CHECK(same_point(&h, &g));
+
+        // p + p, p - p, p + 0, 0 + 0, with r aliasing p
+        h = hp;
+        homogeneous_add(&h, &h, &hp);
+        group_dbl(&g, &gp);
+        CHECK(same_point(&h, &g));
+        Group in_place = gp;
+        group_dbl(&in_place, &in_place);
+        CHECK(memcmp(&in_place, &g, sizeof(Group)) == 0);
+        h = hp2;
+        homogeneous_madd(&h, &h, &p);
+        Group g3;
+        group_add(&g3, &g, &gp);
+        CHECK(same_point(&h, &g3));
+        Affine p2;
+        homogeneous_to_affine(&p2, &hp2);
+        homogeneous_madd(&h, &hp2, &p2);
+        group_dbl(&g3, &g);
+        CHECK(same_point(&h, &g3));
+        homogeneous_add(&h, &hp, &hneg);
+        CHECK(is_identity(&h));
+        homogeneous_madd(&h, &hp, &neg_p);
+        CHECK(is_identity(&h));
+        homogeneous_add(&h, &hp, &hzero);
+        CHECK(same_point(&h, &gp));
+        homogeneous_madd(&h, &hzero, &p);
+        CHECK(same_point(&h, &gp));
+        homogeneous_dbl(&h, &hzero);
+        CHECK(is_identity(&h));
+
+        homogeneous_scalar_mul(&h, k2, &hp2);
+        group_scalar_mul(&g3, k2, &g2);
+        CHECK(same_point(&h, &g3));
+    }
+
+    // sum k[i] * p[i] over more than one block, with repeated points and
+    // the identity among them
+    Group sum;
+    affine_to_projective(&sum, &zero);
+    for (size_t i = 0; i < HOMOGENEOUS_MSM; ++i) {
+        Scalar k;
+        test_rand_field(ks[i]);
+        test_rand_field(k);
+        if (i % 7 == 3) {
+            ps[i] = ps[i - 1];
+        } else if (i % 11 == 5) {
+            ps[i] = zero;
+        } else {
+            affine_scalar_mul(&ps[i], k, &GENERATOR);
+        }
+
+        Group pi, kp, tmp;
+        affine_to_projective(&pi, &ps[i]);
+        group_scalar_mul(&kp, ks[i], &pi);
+        group_add(&tmp, &sum, &kp);
+        sum = tmp;
+    }
+    Homogeneous h;
+    homogeneous_msm(&h, ks, ps, HOMOGENEOUS_MSM);
+    CHECK(same_point(&h, &sum));
+    homogeneous_msm(&h, ks, ps, 0);
+    CHECK(is_identity(&h));
+
+    free(ks);
+    free(ps);
+}
@@ -0,0 +1,105 @@
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include "test.h"
+#include "crypto.h"
+#include "keycache.h"
+
+#define KEYCACHE_KEYS 500
+#define KEYCACHE_TXNS 100
+#define KEYCACHE_READERS 3
+
+typedef struct keycache_reader {
+    const KeyCache *cache;
+    const PreparedKey *keys; // the first half is never removed
+    _Atomic bool *stop;
+    size_t misses;
+} KeycacheReader;
+
+static void *keycache_read(void *arg)
+{
+    KeycacheReader *r = arg;
+    for (size_t i = 0; !atomic_load(r->stop) || i < KEYCACHE_KEYS; ++i) {
+        const PreparedKey *want = &r->keys[i % (KEYCACHE_KEYS / 2)];
+        const PreparedKey *key = key_cache_find(r->cache, &want->pub);
+        r->misses += !key || memcmp(&key->kp, &want->kp, sizeof(Keypair)) != 0;
+    }
+    return NULL;
+}
+
+void test_keycache(void)
+{
+    PreparedKey *keys = malloc(sizeof(PreparedKey) * KEYCACHE_KEYS);
+    for (size_t i = 0; i < KEYCACHE_KEYS; ++i) {
+        Keypair kp;
+        test_rand_keypair(&kp);
+        prepared_key_init(&keys[i], &kp);
+    }
+
+    // prepared keys sign exactly as their keypairs
+    Transaction txns[KEYCACHE_TXNS];
+    Keypair kps[KEYCACHE_TXNS];
+    const PreparedKey *prepared[KEYCACHE_TXNS];
+    Signature expected[KEYCACHE_TXNS], sigs[KEYCACHE_TXNS];
+    for (size_t i = 0; i < KEYCACHE_TXNS; ++i) {
+        prepared[i] = &keys[test_rand() % 8];
+        kps[i] = prepared[i]->kp;
+        test_rand_transaction(&txns[i]);
+    }
+    CHECK(sign_batch(kps, txns, KEYCACHE_TXNS, expected) == MINA_OK);
+    CHECK(sign_batch_prepared(prepared, txns, KEYCACHE_TXNS, sigs, NULL, NULL, NULL) == MINA_OK);
+    CHECK(memcmp(sigs, expected, sizeof(sigs)) == 0);
+    CHECK(sign_prepared(&sigs[0], prepared[0], &txns[0]) == MINA_OK);
+    CHECK(memcmp(&sigs[0], &expected[0], sizeof(Signature)) == 0);
+
+    // growing from the smallest table; duplicates keep the present key
+    KeyCache *cache = key_cache_create(0);
+    for (size_t i = 0; i < KEYCACHE_KEYS; ++i) {
+        CHECK(key_cache_insert(cache, &keys[i].kp) == MINA_OK);
+    }
+    CHECK(key_cache_insert(cache, &keys[7].kp) == MINA_OK);
+    CHECK(key_cache_size(cache) == KEYCACHE_KEYS);
+    for (size_t i = 0; i < KEYCACHE_KEYS; ++i) {
+        const PreparedKey *key = key_cache_find(cache, &keys[i].pub);
+        CHECK(key && memcmp(key, &keys[i], sizeof(PreparedKey)) == 0);
+    }
+    Compressed absent = keys[0].pub;
+    absent.is_odd = !absent.is_odd;
+    CHECK(key_cache_find(cache, &absent) == NULL);
+
+    // readers keep finding the first half while the second is removed and
+    // inserted again
+    _Atomic bool stop = false;
+    pthread_t threads[KEYCACHE_READERS];
+    KeycacheReader readers[KEYCACHE_READERS];
+    for (size_t t = 0; t < KEYCACHE_READERS; ++t) {
+        readers[t] = (KeycacheReader){ cache, keys, &stop, 0 };
+        pthread_create(&threads[t], NULL, keycache_read, &readers[t]);
+    }
+    for (size_t round = 0; round < 4; ++round) {
+        for (size_t i = KEYCACHE_KEYS / 2; i < KEYCACHE_KEYS; ++i) {
+            CHECK(key_cache_remove(cache, &keys[i].pub));
+        }
+        CHECK(!key_cache_remove(cache, &keys[KEYCACHE_KEYS - 1].pub));
+        CHECK(key_cache_size(cache) == KEYCACHE_KEYS / 2);
+        for (size_t i = KEYCACHE_KEYS / 2; i < KEYCACHE_KEYS; ++i) {
+            CHECK(key_cache_find(cache, &keys[i].pub) == NULL);
+            CHECK(key_cache_insert(cache, &keys[i].kp) == MINA_OK);
+        }
+    }
+    atomic_store(&stop, true);
+    for (size_t t = 0; t < KEYCACHE_READERS; ++t) {
+        pthread_join(threads[t], NULL);
+        CHECK(readers[t].misses == 0);
+    }
+    key_cache_collect(cache);
+
+    CHECK(key_cache_size(cache) == KEYCACHE_KEYS);
+    for (size_t i = 0; i < KEYCACHE_KEYS; ++i) {
+        const PreparedKey *key = key_cache_find(cache, &keys[i].pub);
+        CHECK(key && memcmp(&key->kp, &keys[i].kp, sizeof(Keypair)) == 0);
+    }
+    key_cache_destroy(cache);
+    free(keys);
+}
@@ -0,0 +1,307 @@
+#include <stdlib.h>
+#include <string.h>
+#include "test.h"
+#include "crypto.h"
+#include "bip32.h"
+#include "libbase58.h"
+#include "pasta_fp.h"
+#include "pasta_fq.h"
+#include "vanity.h"
+
+#define KEYGEN_N 300
+#define HD_ACCOUNTS 40
+
+// BIP32 test vector 1: seed 000102...0f, each level below the master node
+typedef struct bip32_vector {
+    uint32_t index;
+    const char *key;
+    const char *chain_code;
+    const char *pub;
+} Bip32Vector;
+
+static const Bip32Vector BIP32_VECTOR_1[] = {
+    { 0, // m
+      "e8f32e723decf4051aefac8e2c93c9c5b214313817cdb01a1494b917c8436b35",
+      "873dff81c02f525623fd1fe5167eac3a55a049de3d314bb42ee227ffed37d508",
+      "0339a36013301597daef41fbe593a02cc513d0b55527ec2df1050e2e8ff49c85c2" },
+    { 0 | BIP32_HARDENED_OFFSET,
+      "edb2e14f9ee77d26dd93b4ecede8d16ed408ce149b6cd80b0715a2d911a0afea",
+      "47fdacbd0f1097043b78c63c20c34ef4ed9a111d980047ad16282c7ae6236141",
+      "035a784662a4a20a65bf6aab9ae98a6c068a81c52e4b032c0fb5400c706cfccc56" },
+    { 1,
+      "3c6cb8d0f6a264c91ea8b5030fadaa8e538b020f0a387421a12de9319dc93368",
+      "2a7857631386ba23dacac34180dd1983734e444fdbf774041578e9b6adb37c19",
+      "03501e454bf00751f24b1b489aa925215d66af2234e3891c3b21a52bedb3cd711c" },
+    { 2 | BIP32_HARDENED_OFFSET,
+      "cbce0d719ecf7431d88e6a89fa1483e02e35092af60c042b1df2ff59fa424dca",
+      "04466b9cc8e161e966409ca52986c584f07e9dc81f735db683c3ff6ec7b1503f",
+      "0357bfe1e341d01c69fe5654309956cbea516822fba8a601743a012a7896ee8dc2" },
+    { 2,
+      "0f479245fb19a38a1954c5c7c0ebab2f9bdfd96a17563ef28a6a4b1a2a764ef4",
+      "cfb71883f01676f587d023cc53a35bc7f88f724b1f8c2892ac1275ac822a3edd",
+      "02e8445082a72f29b75ca48748a914df60622a609cacfce8ed0e35804560741d29" },
+    { 1000000000,
+      "471b76e389e528d6de6d816857e012c5455051cad6660850e58372a6c3e6e7c8",
+      "c783e67b921d2beb8f6b389cc646d7263b4145701dadd2161548a8b078e65e9e",
+      "022a471424da5e657499d1ff51cb43c47481a03b1e77f951fe64cec9f5a48f7011" },
+};
+
+// Seed of the Ledger app's test mnemonic "course grief vintage ... canyon
+// key" (BIP39, empty passphrase), and its first two accounts
+static const char *LEDGER_SEED =
+    "1bac2a4281e6095c3945cdefef36261d1af600f7b1a0d7fd473f3acfb7c61432"
+    "6261589ee860375c5c977f2ba93bd67d03bd502fda50004c787588ec57d8f0fb";
+
+static const struct {
+    const char *priv;
+    const char *address;
+} LEDGER_ACCOUNTS[] = {
+    { "164244176fddb5d769b7de2027469d027ad428fadcc0c02396e6280142efb718",
+      "B62qnzbXmRNo9q32n4SNu2mpB8e7FYYLH8NmaX6oFCBYjjQ8SbD7uzV" },
+    { "3ca187a58f09da346844964310c7e0dd948a9105702b716f4d732e042e0c172e",
+      "B62qicipYxyEHu7QjUqS7QvBipTs5CzgkYZZZkPoKVYBu6tnDUcE9Zt" },
+};
+
+static void read_bytes(uint8_t *out, const char *hex, size_t len)
+{
+    for (size_t i = 0; i < len; ++i) {
+        uint8_t byte = 0;
+        for (size_t j = 0; j < 2; ++j) {
+            const char c = hex[2 * i + j];
+            byte = (uint8_t)(byte << 4 | ((c <= '9') ? c - '0' : (c | 0x20) - 'a' + 10));
+        }
+        out[i] = byte;
+    }
+}
+
+// Address through the generic base58check encoder
+static void reference_address(char *out, const Affine *pub)
+{
+    uint8_t payload[35];
+    uint64_t x[4], y[4];
+
+    payload[0] = 0x01;
+    payload[1] = 0x01;
+    fiat_pasta_fp_from_montgomery(x, pub->x);
+    fiat_pasta_fp_from_montgomery(y, pub->y);
+    for (size_t i = 0; i < 32; ++i) {
+        payload[2 + i] = (uint8_t)(x[i / 8] >> (8 * (i % 8)));
+    }
+    payload[34] = y[0] & 1;
+
+    size_t len = MINA_ADDRESS_LEN;
+    b58check_enc(out, &len, 0xcb, payload, sizeof(payload));
+}
+
+static bool keypair_consistent(const Keypair *kp)
+{
+    Affine pub;
+    generate_pubkey(&pub, kp->priv);
+    return memcmp(&pub, &kp->pub, sizeof(Affine)) == 0;
+}
+
+void test_decompress(void)
+{
+    for (size_t i = 0; i < KEYGEN_N; ++i) {
+        Keypair kp;
+        Affine pub;
+        test_rand_keypair(&kp);
+
+        Compressed c;
+        memcpy(c.x, kp.pub.x, sizeof(Field));
+        uint64_t y[4];
+        fiat_pasta_fp_from_montgomery(y, kp.pub.y);
+        c.is_odd = y[0] & 1;
+
+        CHECK(affine_decompress(&pub, &c) == MINA_OK);
+        CHECK(memcmp(&pub, &kp.pub, sizeof(Affine)) == 0);
+
+        // the other point with this x
+        c.is_odd = !c.is_odd;
+        CHECK(affine_decompress(&pub, &c) == MINA_OK);
+        CHECK(memcmp(pub.x, kp.pub.x, sizeof(Field)) == 0);
+        CHECK(memcmp(pub.y, kp.pub.y, sizeof(Field)) != 0);
+    }
+
+    // about half of all x are not on the curve
+    size_t invalid = 0;
+    for (size_t i = 0; i < KEYGEN_N; ++i) {
+        Compressed c = { { 0 }, false };
+        Affine pub;
+        test_rand_field(c.x);
+        const MinaStatus status = affine_decompress(&pub, &c);
+        CHECK(status == MINA_OK || status == MINA_ERR_INVALID_POINT);
+        invalid += (status == MINA_ERR_INVALID_POINT);
+    }
+    CHECK(invalid > KEYGEN_N / 3 && invalid < 2 * KEYGEN_N / 3);
+}
+
+void test_keygen(void)
+{
+    Keypair *kps = malloc(sizeof(Keypair) * KEYGEN_N);
+    char (*addresses)[MINA_ADDRESS_LEN] = malloc(MINA_ADDRESS_LEN * KEYGEN_N);
+    char expected[MINA_ADDRESS_LEN];
+
+    CHECK(generate_keypairs(kps, KEYGEN_N) == MINA_OK);
+    for (size_t i = 0; i < KEYGEN_N; ++i) {
+        CHECK(keypair_consistent(&kps[i]));
+        CHECK(get_address(addresses[i], MINA_ADDRESS_LEN, &kps[i].pub) == MINA_OK);
+        reference_address(expected, &kps[i].pub);
+        CHECK(strcmp(expected, addresses[i]) == 0);
+    }
+    CHECK(memcmp(&kps[0], &kps[1], sizeof(Keypair)) != 0);
+
+    for (size_t threads = 1; threads <= 3; ++threads) {
+        Pool *pool = pool_create(threads, 0);
+        CHECK(pool != NULL);
+        if (!pool) {
+            continue;
+        }
+        memset(addresses, 0, MINA_ADDRESS_LEN * KEYGEN_N);
+        CHECK(generate_keypairs_pool(pool, kps, addresses, KEYGEN_N) == MINA_OK);
+        for (size_t i = 0; i < KEYGEN_N; ++i) {
+            CHECK(keypair_consistent(&kps[i]));
+            reference_address(expected, &kps[i].pub);
+            CHECK(strcmp(expected, addresses[i]) == 0);
+        }
+        pool_destroy(pool);
+    }
+
+    free(kps);
+    free(addresses);
+}
+
+void test_bip32(void)
+{
+    uint8_t seed[16];
+    for (size_t i = 0; i < sizeof(seed); ++i) {
+        seed[i] = (uint8_t)i;
+    }
+
+    Bip32Node node;
+    CHECK(bip32_master(&node, seed, sizeof(seed)) == MINA_OK);
+    for (size_t i = 0; i < sizeof(BIP32_VECTOR_1) / sizeof(BIP32_VECTOR_1[0]); ++i) {
+        const Bip32Vector *v = &BIP32_VECTOR_1[i];
+        if (i > 0) {
+            CHECK(bip32_derive(&node, &node, v->index) == MINA_OK);
+        }
+
+        uint8_t key[SECP256K1_KEY_BYTES], chain_code[BIP32_CHAIN_CODE_BYTES];
+        uint8_t pub[SECP256K1_PUBKEY_BYTES], expected_pub[SECP256K1_PUBKEY_BYTES];
+        read_bytes(key, v->key, sizeof(key));
+        read_bytes(chain_code, v->chain_code, sizeof(chain_code));
+        read_bytes(expected_pub, v->pub, sizeof(expected_pub));
+        secp256k1_pubkeys(&pub, (const uint8_t (*)[SECP256K1_KEY_BYTES])&node.key, 1);
+
+        CHECK(memcmp(node.key, key, sizeof(key)) == 0);
+        CHECK(memcmp(node.chain_code, chain_code, sizeof(chain_code)) == 0);
+        CHECK(memcmp(pub, expected_pub, sizeof(pub)) == 0);
+    }
+
+    uint8_t ledger_seed[64];
+    read_bytes(ledger_seed, LEDGER_SEED, sizeof(ledger_seed));
+    MinaHdWallet wallet;
+    CHECK(mina_hd_init(&wallet, ledger_seed, sizeof(ledger_seed)) == MINA_OK);
+
+    const size_t accounts = sizeof(LEDGER_ACCOUNTS) / sizeof(LEDGER_ACCOUNTS[0]);
+    Keypair kps[sizeof(LEDGER_ACCOUNTS) / sizeof(LEDGER_ACCOUNTS[0])];
+    MinaStatus results[sizeof(LEDGER_ACCOUNTS) / sizeof(LEDGER_ACCOUNTS[0])];
+    CHECK(mina_hd_keypairs(kps, &wallet, 0, accounts, results) == MINA_OK);
+    for (size_t i = 0; i < accounts; ++i) {
+        CHECK(results[i] == MINA_OK);
+        uint64_t priv[4], expected_priv[4];
+        char address[MINA_ADDRESS_LEN];
+        fiat_pasta_fq_from_montgomery(priv, kps[i].priv);
+        test_read_hex(expected_priv, LEDGER_ACCOUNTS[i].priv);
+        CHECK(memcmp(priv, expected_priv, sizeof(priv)) == 0);
+        CHECK(get_address(address, MINA_ADDRESS_LEN, &kps[i].pub) == MINA_OK);
+        CHECK(strcmp(address, LEDGER_ACCOUNTS[i].address) == 0);
+    }
+}
+
+void test_hd(void)
+{
+    uint8_t seed[64];
+    for (size_t i = 0; i < sizeof(seed); ++i) {
+        seed[i] = (uint8_t)test_rand();
+    }
+
+    MinaHdWallet wallet;
+    CHECK(mina_hd_init(&wallet, seed, sizeof(seed)) == MINA_OK);
+
+    Keypair *kps = malloc(sizeof(Keypair) * HD_ACCOUNTS);
+    Keypair *expected = malloc(sizeof(Keypair) * HD_ACCOUNTS);
+    MinaStatus *results = malloc(sizeof(MinaStatus) * HD_ACCOUNTS);
+    CHECK(mina_hd_keypairs(expected, &wallet, 7, HD_ACCOUNTS, results) == MINA_OK);
+    for (size_t i = 0; i < HD_ACCOUNTS; ++i) {
+        CHECK(results[i] == MINA_OK);
+        CHECK(keypair_consistent(&expected[i]));
+    }
+
+    // Each account alone, as the single-account path derives it
+    for (size_t i = 0; i < HD_ACCOUNTS; i += 37) {
+        Keypair kp;
+        MinaStatus result;
+        CHECK(mina_hd_keypairs(&kp, &wallet, 7 + (uint32_t)i, 1, &result) == MINA_OK);
+        CHECK(result == MINA_OK);
+        CHECK(memcmp(&kp, &expected[i], sizeof(kp)) == 0);
+    }
+
+    for (size_t threads = 1; threads <= 3; ++threads) {
+        Pool *pool = pool_create(threads, 0);
+        CHECK(pool != NULL);
+        if (!pool) {
+            continue;
+        }
+        memset(kps, 0, sizeof(Keypair) * HD_ACCOUNTS);
+        memset(results, 0xff, sizeof(MinaStatus) * HD_ACCOUNTS);
+        CHECK(mina_hd_keypairs_pool(pool, kps, &wallet, 7, HD_ACCOUNTS, results) == MINA_OK);
+        CHECK(memcmp(kps, expected, sizeof(Keypair) * HD_ACCOUNTS) == 0);
+        for (size_t i = 0; i < HD_ACCOUNTS; ++i) {
+            CHECK(results[i] == MINA_OK);
+        }
+        pool_destroy(pool);
+    }
+
+    free(kps);
+    free(expected);
+    free(results);
+}
+
+void test_vanity(void)
+{
+    Pool *pool = pool_create(2, 0);
+    CHECK(pool != NULL);
+    if (!pool) {
+        return;
+    }
+
+    // one and two characters after B62q: about 58 and 3364 candidates
+    const char *prefixes[] = { "B62qk", "B62qmi" };
+    for (size_t i = 0; i < sizeof(prefixes) / sizeof(prefixes[0]); ++i) {
+        VanityResult result;
+        char address[MINA_ADDRESS_LEN], expected[MINA_ADDRESS_LEN];
+        memset(&result, 0, sizeof(result));
+        CHECK(vanity_search(pool, prefixes[i], 0, &result) == MINA_OK);
+        CHECK(keypair_consistent(&result.kp));
+        CHECK(get_address(address, sizeof(address), &result.kp.pub) == MINA_OK);
+        reference_address(expected, &result.kp.pub);
+        CHECK(strcmp(address, expected) == 0 && strcmp(address, result.address) == 0);
+        CHECK(strncmp(address, prefixes[i], strlen(prefixes[i])) == 0);
+        CHECK(result.candidates > 0);
+    }
+
+    VanityResult result;
+    CHECK(vanity_search(pool, "B62qjjjjjjjjjjjj", 4 * VANITY_BATCH, &result) == MINA_ERR_NOT_FOUND);
+    CHECK(result.candidates >= 4 * VANITY_BATCH);
+
+    // 0, O, I and l are not base58 digits, and every address starts B62q
+    const char *invalid[] = { "B62q0", "B62qO", "B62qI", "B62ql", "B62p" };
+    for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i) {
+        CHECK(vanity_expected_candidates(invalid[i]) == 0);
+        CHECK(vanity_search(pool, invalid[i], 1, &result) == MINA_ERR_INVALID_PARAMETER);
+    }
+    CHECK(vanity_search(pool, NULL, 1, &result) == MINA_ERR_INVALID_PARAMETER);
+
+    pool_destroy(pool);
+}
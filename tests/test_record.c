@@ -0,0 +1,286 @@
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "test.h"
+#include "record.h"
+#include "utils.h"
+#include "pasta_fp.h"
+#include "pasta_fq.h"
+
+#define RECORD_INPUTS 200
+
+void test_record(void)
+{
+    for (size_t i = 0; i < RECORD_INPUTS; ++i) {
+        Transaction txn, back;
+        uint8_t bytes[TX_RECORD_BYTES], again[TX_RECORD_BYTES];
+
+        test_rand_transaction(&txn);
+        for (size_t j = 0; j < 3; ++j) {
+            txn.tag[j] = test_rand() & 1;
+        }
+        txn.token_locked = test_rand() & 1;
+        for (size_t j = 0; j < MEMO_BYTES; ++j) {
+            txn.memo[j] = (uint8_t)test_rand();
+        }
+
+        transaction_record_write(bytes, &txn);
+        CHECK(transaction_record_read(&back, bytes) == MINA_OK);
+        transaction_record_write(again, &back);
+        CHECK(memcmp(bytes, again, TX_RECORD_BYTES) == 0);
+        CHECK(back.fee == txn.fee && back.nonce == txn.nonce && back.amount == txn.amount);
+        CHECK(memcmp(back.receiver_pk.x, txn.receiver_pk.x, sizeof(Field)) == 0);
+        CHECK(back.receiver_pk.is_odd == txn.receiver_pk.is_odd);
+        CHECK(memcmp(back.memo, txn.memo, MEMO_BYTES) == 0);
+        CHECK(back.tag[2] == txn.tag[2] && back.token_locked == txn.token_locked);
+
+        // reserved bits, parities other than 0 and 1, x at or above p
+        memcpy(again, bytes, TX_RECORD_BYTES);
+        again[40] |= 0x10;
+        CHECK(transaction_record_read(&back, again) == MINA_ERR_INVALID_PARAMETER);
+        memcpy(again, bytes, TX_RECORD_BYTES);
+        again[183] = 1;
+        CHECK(transaction_record_read(&back, again) == MINA_ERR_INVALID_PARAMETER);
+        memcpy(again, bytes, TX_RECORD_BYTES);
+        again[146] = 2;
+        CHECK(transaction_record_read(&back, again) == MINA_ERR_INVALID_PARAMETER);
+        memcpy(again, bytes, TX_RECORD_BYTES);
+        memset(again + 81, 0xff, 32);
+        CHECK(transaction_record_read(&back, again) == MINA_ERR_INVALID_PARAMETER);
+
+        Signature sig, sig_back;
+        uint8_t sig_bytes[SIGNATURE_RECORD_BYTES];
+        test_rand_field(sig.rx);
+        test_rand_field(sig.s);
+        signature_record_write(sig_bytes, &sig);
+        CHECK(signature_record_read(&sig_back, sig_bytes) == MINA_OK);
+        CHECK(memcmp(&sig, &sig_back, sizeof(Signature)) == 0);
+        memset(sig_bytes + 32, 0xff, 32);
+        CHECK(signature_record_read(&sig_back, sig_bytes) == MINA_ERR_INVALID_PARAMETER);
+
+        // signed transactions: the three parts, then reserved zeros
+        Compressed key, key_back;
+        uint8_t signed_bytes[SIGNED_RECORD_BYTES];
+        test_rand_field(key.x);
+        key.is_odd = test_rand() & 1;
+        signed_record_write(signed_bytes, &txn, &sig, &key);
+        CHECK(memcmp(signed_bytes, bytes, TX_RECORD_BYTES) == 0);
+        CHECK(signed_record_read(&back, &sig_back, &key_back, signed_bytes) == MINA_OK);
+        CHECK(memcmp(&sig, &sig_back, sizeof(Signature)) == 0);
+        CHECK(memcmp(key.x, key_back.x, sizeof(Field)) == 0 && key.is_odd == key_back.is_odd);
+        signed_bytes[SIGNED_RECORD_BYTES - 1] = 1;
+        CHECK(signed_record_read(&back, &sig_back, &key_back, signed_bytes) == MINA_ERR_INVALID_PARAMETER);
+        signed_bytes[SIGNED_RECORD_BYTES - 1] = 0;
+        signed_bytes[TX_RECORD_BYTES + SIGNATURE_RECORD_BYTES + FIELD_BYTES] = 2;
+        CHECK(signed_record_read(&back, &sig_back, &key_back, signed_bytes) == MINA_ERR_INVALID_PARAMETER);
+    }
+
+    // file headers: the kind, version and signer must match
+    uint8_t header[RECORD_FILE_HEADER_BYTES];
+    uint64_t count = 0;
+    Compressed signer, signer_back;
+    test_rand_field(signer.x);
+    signer.is_odd = 1;
+
+    record_file_header_write(header, RECORD_FILE_TRANSACTIONS, 12345, NULL);
+    CHECK(record_file_header_read(header, RECORD_FILE_TRANSACTIONS, &count, NULL) == MINA_OK && count == 12345);
+    CHECK(record_file_header_read(header, RECORD_FILE_SIGNATURES, &count, NULL) == MINA_ERR_INVALID_PARAMETER);
+
+    record_file_header_write(header, RECORD_FILE_SIGNATURES, 7, &signer);
+    CHECK(record_file_header_read(header, RECORD_FILE_SIGNATURES, &count, &signer_back) == MINA_OK && count == 7);
+    CHECK(memcmp(signer.x, signer_back.x, sizeof(Field)) == 0 && signer_back.is_odd);
+    header[8] += 1;
+    CHECK(record_file_header_read(header, RECORD_FILE_SIGNATURES, &count, NULL) == MINA_ERR_INVALID_PARAMETER);
+
+    record_file_header_write(header, RECORD_FILE_SIGNED, 99, NULL);
+    CHECK(record_file_header_read(header, RECORD_FILE_SIGNED, &count, NULL) == MINA_OK && count == 99);
+    CHECK(record_file_header_read(header, RECORD_FILE_TRANSACTIONS, &count, NULL) == MINA_ERR_INVALID_PARAMETER);
+}
+
+#define RESUME_TXNS 16
+
+// Runs ./mina-signer -k key -o sigs txns, as built by build.sh next to
+// test.out, and returns its exit status
+static int resume_run(const char *key, const char *sigs, const char *txns)
+{
+    const pid_t pid = fork();
+    if (pid == 0) {
+        freopen("/dev/null", "w", stderr);
+        execl("./mina-signer", "mina-signer", "-k", key, "-t", "2", "-o", sigs, txns, (char *)NULL);
+        _exit(127);
+    }
+    int status = 0;
+    if (pid < 0 || waitpid(pid, &status, 0) != pid || !WIFEXITED(status)) {
+        return -1;
+    }
+    return WEXITSTATUS(status);
+}
+
+static bool resume_write(const char *path, const uint8_t *bytes, size_t len)
+{
+    FILE *f = fopen(path, "wb");
+    const bool ok = f && fwrite(bytes, 1, len, f) == len;
+    return (f && fclose(f) == 0) && ok;
+}
+
+static bool resume_read(const char *path, uint8_t *bytes, size_t len)
+{
+    FILE *f = fopen(path, "rb");
+    const bool ok = f && fread(bytes, 1, len, f) == len;
+    if (f) {
+        fclose(f);
+    }
+    return ok;
+}
+
+// mina-signer -o resumes a signature file whose records were torn by a
+// kill between writing s and rx: those have rx = 0 and are signed again
+void test_resume(void)
+{
+    char dir[] = "/tmp/mina-resume-XXXXXX";
+    if (!CHECK(mkdtemp(dir) != NULL)) {
+        return;
+    }
+    char key_path[64], txns_path[64], sigs_path[64];
+    snprintf(key_path, sizeof(key_path), "%s/key", dir);
+    snprintf(txns_path, sizeof(txns_path), "%s/txns", dir);
+    snprintf(sigs_path, sizeof(sigs_path), "%s/sigs", dir);
+
+    // the key file: 64 hex digits, big endian
+    Keypair kp;
+    uint64_t priv[4];
+    uint8_t priv_le[32], priv_be[32];
+    char key_hex[2 * sizeof(priv_be) + 2];
+    test_rand_keypair(&kp);
+    fiat_pasta_fq_from_montgomery(priv, kp.priv);
+    fiat_pasta_fq_to_bytes(priv_le, priv);
+    for (size_t i = 0; i < sizeof(priv_be); ++i) {
+        priv_be[i] = priv_le[sizeof(priv_le) - 1 - i];
+    }
+    hex_encode(key_hex, priv_be, sizeof(priv_be));
+    key_hex[2 * sizeof(priv_be)] = '\n';
+    CHECK(resume_write(key_path, (const uint8_t *)key_hex, sizeof(key_hex) - 1));
+
+    Compressed fee_payer;
+    uint64_t y[4];
+    fiat_pasta_fp_from_montgomery(y, kp.pub.y);
+    memcpy(fee_payer.x, kp.pub.x, sizeof(Field));
+    fee_payer.is_odd = y[0] & 1;
+
+    static uint8_t txns_file[RECORD_FILE_HEADER_BYTES + RESUME_TXNS * TX_RECORD_BYTES];
+    Transaction txns[RESUME_TXNS];
+    record_file_header_write(txns_file, RECORD_FILE_TRANSACTIONS, RESUME_TXNS, NULL);
+    for (size_t i = 0; i < RESUME_TXNS; ++i) {
+        test_rand_transaction(&txns[i]);
+        txns[i].fee_payer_pk = txns[i].source_pk = fee_payer;
+        transaction_record_write(txns_file + RECORD_FILE_HEADER_BYTES + i * TX_RECORD_BYTES, &txns[i]);
+    }
+    CHECK(resume_write(txns_path, txns_file, sizeof(txns_file)));
+
+    static uint8_t sigs_file[RECORD_FILE_HEADER_BYTES + RESUME_TXNS * SIGNATURE_RECORD_BYTES];
+    static uint8_t first[sizeof(sigs_file)];
+    CHECK(resume_run(key_path, sigs_path, txns_path) == 0);
+    CHECK(resume_read(sigs_path, first, sizeof(first)));
+
+    // torn: s written, rx not yet, and s of a different signature
+    memcpy(sigs_file, first, sizeof(sigs_file));
+    uint8_t *torn = sigs_file + RECORD_FILE_HEADER_BYTES + 3 * SIGNATURE_RECORD_BYTES;
+    memset(torn, 0, FIELD_BYTES);
+    CHECK(!signature_record_is_signed(torn));
+    torn = sigs_file + RECORD_FILE_HEADER_BYTES + 9 * SIGNATURE_RECORD_BYTES;
+    memset(torn, 0, FIELD_BYTES);
+    torn[FIELD_BYTES] ^= 1;
+    CHECK(resume_write(sigs_path, sigs_file, sizeof(sigs_file)));
+
+    CHECK(resume_run(key_path, sigs_path, txns_path) == 0);
+    CHECK(resume_read(sigs_path, sigs_file, sizeof(sigs_file)));
+    CHECK(memcmp(sigs_file, first, sizeof(first)) == 0);
+    for (size_t i = 0; i < RESUME_TXNS; ++i) {
+        Signature sig;
+        const uint8_t *record = sigs_file + RECORD_FILE_HEADER_BYTES + i * SIGNATURE_RECORD_BYTES;
+        CHECK(signature_record_is_signed(record));
+        CHECK(signature_record_read(&sig, record) == MINA_OK && verify(&sig, &kp.pub, &txns[i]) == MINA_OK);
+    }
+
+    unlink(key_path);
+    unlink(txns_path);
+    unlink(sigs_path);
+    rmdir(dir);
+}
+
+#define ENCODING_SIGNATURES 100
+
+void test_encoding(void)
+{
+    // every byte value, at every length around the 16-byte blocks
+    uint8_t bytes[256], back[256];
+    char hex[2 * sizeof(bytes)], expected[2 * sizeof(bytes) + 1];
+    for (size_t i = 0; i < sizeof(bytes); ++i) {
+        bytes[i] = (uint8_t)(i * 167 + 13);
+        snprintf(expected + 2 * i, 3, "%02x", bytes[i]);
+    }
+    for (size_t len = 0; len <= 40; ++len) {
+        memset(hex, 0, sizeof(hex));
+        hex_encode(hex, bytes, len);
+        CHECK(memcmp(hex, expected, 2 * len) == 0 && hex[2 * len] == 0);
+    }
+    hex_encode(hex, bytes, sizeof(bytes));
+    CHECK(memcmp(hex, expected, sizeof(hex)) == 0);
+    CHECK(hex_decode(back, hex, sizeof(back)) && memcmp(back, bytes, sizeof(bytes)) == 0);
+    CHECK(hex_decode(back, "aBcD", 2) && back[0] == 0xab && back[1] == 0xcd);
+    CHECK(!hex_decode(back, "0g", 1));
+
+    // the known signature of main.c, as Mina's raw rx | s
+    static const char SIGNATURE_HEX[] = "5e6a9cb865942c6f2616b8f3604aef97c0d2f951db53bb5a9d0775e087105a3a"
+                                        "5c8c001ead617aee3438594c833ebfb049f13bed2f4350d1c510d536d8f3133f";
+    Signature sig;
+    char sig_hex[SIGNATURE_HEX_LEN];
+    CHECK(signature_hex_read(&sig, SIGNATURE_HEX, SIGNATURE_HEX_LEN) == MINA_OK);
+    signature_hex_write(sig_hex, &sig);
+    CHECK(memcmp(sig_hex, SIGNATURE_HEX, SIGNATURE_HEX_LEN) == 0);
+    CHECK(signature_hex_read(&sig, SIGNATURE_HEX, SIGNATURE_HEX_LEN - 2) == MINA_ERR_INVALID_PARAMETER);
+
+    // batches match one at a time, across a block boundary
+    Signature sigs[ENCODING_SIGNATURES];
+    char batch[ENCODING_SIGNATURES * SIGNATURE_HEX_LEN];
+    for (size_t i = 0; i < ENCODING_SIGNATURES; ++i) {
+        test_rand_field(sigs[i].rx);
+        test_rand_field(sigs[i].s);
+    }
+    signature_hex_write_batch(batch, sigs, ENCODING_SIGNATURES);
+    for (size_t i = 0; i < ENCODING_SIGNATURES; ++i) {
+        signature_hex_write(sig_hex, &sigs[i]);
+        CHECK(memcmp(batch + i * SIGNATURE_HEX_LEN, sig_hex, SIGNATURE_HEX_LEN) == 0);
+        CHECK(signature_hex_read(&sig, sig_hex, SIGNATURE_HEX_LEN) == MINA_OK);
+        CHECK(memcmp(&sig, &sigs[i], sizeof(Signature)) == 0);
+    }
+
+    // points: on the curve and reduced, or rejected
+    Keypair kp;
+    test_rand_keypair(&kp);
+    Affine pub;
+    uint8_t point[AFFINE_BYTES];
+    char point_hex[AFFINE_HEX_LEN];
+    affine_write(point, &kp.pub);
+    CHECK(affine_read(&pub, point) == MINA_OK && memcmp(&pub, &kp.pub, sizeof(Affine)) == 0);
+    affine_hex_write(point_hex, &kp.pub);
+    CHECK(affine_hex_read(&pub, point_hex, AFFINE_HEX_LEN) == MINA_OK);
+    CHECK(memcmp(&pub, &kp.pub, sizeof(Affine)) == 0);
+    point[40] ^= 1;
+    CHECK(affine_read(&pub, point) == MINA_ERR_INVALID_POINT);
+    memset(point + 32, 0xff, 32);
+    CHECK(affine_read(&pub, point) == MINA_ERR_INVALID_PARAMETER);
+    memset(point, 0, sizeof(point));
+    CHECK(affine_read(&pub, point) == MINA_ERR_INVALID_POINT);
+
+    Compressed c = { .is_odd = 1 }, c_back;
+    char c_hex[COMPRESSED_HEX_LEN];
+    memcpy(c.x, kp.pub.x, sizeof(Field));
+    compressed_hex_write(c_hex, &c);
+    CHECK(memcmp(c_hex, point_hex, 64) == 0 && memcmp(c_hex + 64, "01", 2) == 0);
+    CHECK(compressed_hex_read(&c_back, c_hex, COMPRESSED_HEX_LEN) == MINA_OK);
+    CHECK(memcmp(c_back.x, c.x, sizeof(Field)) == 0 && c_back.is_odd);
+    c_hex[65] = '2';
+    CHECK(compressed_hex_read(&c_back, c_hex, COMPRESSED_HEX_LEN) == MINA_ERR_INVALID_PARAMETER);
+}
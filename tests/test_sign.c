@@ -0,0 +1,278 @@
+#include <stdlib.h>
+#include <string.h>
+#include "test.h"
+#include "crypto.h"
+#include "base10.h"
+#include "opcount.h"
+#include "pasta_fp.h"
+#include "pasta_fq.h"
+
+#define SIGN_TXNS 200
+#define SIGN_KEYS 8
+
+// The payment of main.c and its signature from the reference signer
+static void test_sign_known_answer(void)
+{
+    const Scalar priv = { 0xca14d6eed923f6e3, 0x61185a1b5e29e6b2, 0xe26d38de9c30753b, 0x3fdf0efb0a5714 };
+    const char *memo = "this is a memo";
+
+    Transaction txn;
+    memset(&txn, 0, sizeof(txn));
+    txn.fee = 3;
+    txn.fee_token = 1;
+    CHECK(test_read_address(&txn.fee_payer_pk, "B62qiy32p8kAKnny8ZFwoMhYpBppM1DWVCqAPBYNcXnsAHhnfAAuXgg"));
+    txn.nonce = 200;
+    txn.valid_until = 10000;
+    txn.memo[0] = 1;
+    txn.memo[1] = (uint8_t)strlen(memo);
+    memcpy(txn.memo + 2, memo, strlen(memo));
+    txn.source_pk = txn.fee_payer_pk;
+    CHECK(test_read_address(&txn.receiver_pk, "B62qrcFstkpqXww1EkSGrqMCwCNho86kuqBd4FrAAUsPxNKdiPzAUsy"));
+    txn.token_id = 1;
+    txn.amount = 42;
+
+    Keypair kp;
+    scalar_copy(kp.priv, priv);
+    generate_pubkey(&kp.pub, kp.priv);
+    CHECK(memcmp(kp.pub.x, txn.fee_payer_pk.x, sizeof(Field)) == 0);
+
+    Signature sig;
+    CHECK(sign(&sig, &kp, &txn) == MINA_OK);
+
+    char field[DIGITS + 1] = { 0 };
+    char scalar[DIGITS + 1] = { 0 };
+    uint64_t tmp[4];
+    fiat_pasta_fp_from_montgomery(tmp, sig.rx);
+    bigint_to_string(field, tmp);
+    fiat_pasta_fq_from_montgomery(tmp, sig.s);
+    bigint_to_string(scalar, tmp);
+
+    CHECK(strcmp(field, "26393275544831950408026742662950427846842308902199169146789849923161392179806") == 0);
+    CHECK(strcmp(scalar, "28530962508461835801829592060779431956054746814505059654319465133050504973404") == 0);
+}
+
+void test_sign(void)
+{
+    test_sign_known_answer();
+
+    Transaction *txns = malloc(sizeof(Transaction) * SIGN_TXNS);
+    Keypair *kps = malloc(sizeof(Keypair) * SIGN_TXNS);
+    Signature *expected = malloc(sizeof(Signature) * SIGN_TXNS);
+    Signature *sigs = malloc(sizeof(Signature) * SIGN_TXNS);
+    Keypair keys[SIGN_KEYS];
+
+    for (size_t i = 0; i < SIGN_KEYS; ++i) {
+        test_rand_keypair(&keys[i]);
+    }
+    for (size_t i = 0; i < SIGN_TXNS; ++i) {
+        test_rand_transaction(&txns[i]);
+        kps[i] = keys[test_rand() % SIGN_KEYS];
+    }
+
+    // mixed keys: sign, sign_batch and sign_batch_pool agree
+    for (size_t i = 0; i < SIGN_TXNS; ++i) {
+        CHECK(sign(&expected[i], &kps[i], &txns[i]) == MINA_OK);
+    }
+
+    memset(sigs, 0, sizeof(Signature) * SIGN_TXNS);
+    CHECK(sign_batch(kps, txns, SIGN_TXNS, sigs) == MINA_OK);
+    CHECK(memcmp(sigs, expected, sizeof(Signature) * SIGN_TXNS) == 0);
+
+    for (size_t threads = 1; threads <= 3; ++threads) {
+        Pool *pool = sign_pool_create(threads);
+        CHECK(pool != NULL);
+        if (!pool) {
+            continue;
+        }
+        memset(sigs, 0, sizeof(Signature) * SIGN_TXNS);
+        CHECK(sign_batch_pool(pool, kps, 1, txns, SIGN_TXNS, sigs) == MINA_OK);
+        CHECK(memcmp(sigs, expected, sizeof(Signature) * SIGN_TXNS) == 0);
+        pool_destroy(pool);
+    }
+
+    // single key through the strided path
+    for (size_t i = 0; i < SIGN_TXNS; ++i) {
+        CHECK(sign(&expected[i], &keys[0], &txns[i]) == MINA_OK);
+    }
+    MinaStatus *results = malloc(sizeof(MinaStatus) * SIGN_TXNS);
+    memset(sigs, 0, sizeof(Signature) * SIGN_TXNS);
+    memset(results, 0xff, sizeof(MinaStatus) * SIGN_TXNS);
+    CHECK(sign_batch_strided(&keys[0], 0, txns, SIGN_TXNS, sigs, results, NULL, NULL) == MINA_OK);
+    CHECK(memcmp(sigs, expected, sizeof(Signature) * SIGN_TXNS) == 0);
+    for (size_t i = 0; i < SIGN_TXNS; ++i) {
+        CHECK(results[i] == MINA_OK);
+    }
+    free(results);
+
+    free(txns);
+    free(kps);
+    free(expected);
+    free(sigs);
+}
+
+#define VERIFY_TXNS 40
+#define VERIFY_KEYS 4
+#define VERIFY_BATCH_TXNS (2 * VERIFY_BATCH + 5)
+
+void test_verify(void)
+{
+    Keypair keys[VERIFY_KEYS];
+    FixedBaseTable *tables = malloc(sizeof(FixedBaseTable) * VERIFY_KEYS);
+    for (size_t i = 0; i < VERIFY_KEYS; ++i) {
+        test_rand_keypair(&keys[i]);
+        fixed_base_table_init(&tables[i], &keys[i].pub);
+    }
+
+    for (size_t i = 0; i < VERIFY_TXNS; ++i) {
+        const size_t k = test_rand() % VERIFY_KEYS;
+        const Keypair *kp = &keys[k];
+        Transaction txn;
+        Signature sig;
+        test_rand_transaction(&txn);
+        CHECK(sign(&sig, kp, &txn) == MINA_OK);
+        CHECK(verify(&sig, &kp->pub, &txn) == MINA_OK);
+        CHECK(verify_fixed_base(&sig, &kp->pub, &tables[k], &txn) == MINA_OK);
+
+        // another key, another transaction, another s or rx
+        const size_t other = (k + 1) % VERIFY_KEYS;
+        CHECK(verify(&sig, &keys[other].pub, &txn) == MINA_ERR_BAD_SIGNATURE);
+        CHECK(verify_fixed_base(&sig, &keys[other].pub, &tables[other], &txn) == MINA_ERR_BAD_SIGNATURE);
+        Transaction changed = txn;
+        changed.amount += 1;
+        CHECK(verify(&sig, &kp->pub, &changed) == MINA_ERR_BAD_SIGNATURE);
+        CHECK(verify_fixed_base(&sig, &kp->pub, &tables[k], &changed) == MINA_ERR_BAD_SIGNATURE);
+        Signature bad = sig;
+        bad.s[0] ^= 1;
+        CHECK(verify(&bad, &kp->pub, &txn) == MINA_ERR_BAD_SIGNATURE);
+        bad = sig;
+        bad.rx[1] ^= 1;
+        CHECK(verify_fixed_base(&bad, &kp->pub, &tables[k], &txn) == MINA_ERR_BAD_SIGNATURE);
+    }
+
+    Transaction txn;
+    Signature sig;
+    test_rand_transaction(&txn);
+    CHECK(sign(&sig, &keys[0], &txn) == MINA_OK);
+    Affine off_curve = keys[0].pub;
+    off_curve.y[0] ^= 1;
+    CHECK(verify(&sig, &off_curve, &txn) == MINA_ERR_INVALID_POINT);
+
+    free(tables);
+}
+
+// verify_batch and verify_batch_pool agree with verify on every signature,
+// over partial batches and with failures of every kind mixed in
+void test_verify_batch(void)
+{
+    Keypair keys[VERIFY_KEYS];
+    for (size_t i = 0; i < VERIFY_KEYS; ++i) {
+        test_rand_keypair(&keys[i]);
+    }
+
+    Signature *sigs = malloc(sizeof(Signature) * VERIFY_BATCH_TXNS);
+    Affine *pubs = malloc(sizeof(Affine) * VERIFY_BATCH_TXNS);
+    Transaction *txns = malloc(sizeof(Transaction) * VERIFY_BATCH_TXNS);
+    MinaStatus *expected = malloc(sizeof(MinaStatus) * VERIFY_BATCH_TXNS);
+    MinaStatus *results = malloc(sizeof(MinaStatus) * VERIFY_BATCH_TXNS);
+
+    for (size_t i = 0; i < VERIFY_BATCH_TXNS; ++i) {
+        const Keypair *kp = &keys[test_rand() % VERIFY_KEYS];
+        test_rand_transaction(&txns[i]);
+        CHECK(sign(&sigs[i], kp, &txns[i]) == MINA_OK);
+        pubs[i] = kp->pub;
+
+        switch (test_rand() % 8) {
+        case 0:
+            sigs[i].s[0] ^= 1;
+            break;
+        case 1:
+            txns[i].nonce += 1;
+            break;
+        case 2:
+            pubs[i].y[0] ^= 1;
+            break;
+        default:
+            break;
+        }
+        expected[i] = verify(&sigs[i], &pubs[i], &txns[i]);
+    }
+
+    const size_t lens[] = { 0, 1, VERIFY_BATCH - 1, VERIFY_BATCH, VERIFY_BATCH_TXNS };
+    for (size_t l = 0; l < sizeof(lens) / sizeof(lens[0]); ++l) {
+        const size_t n = lens[l];
+        MinaStatus all = MINA_OK;
+        for (size_t i = 0; i < n; ++i) {
+            all = (all == MINA_OK) ? expected[i] : all;
+            results[i] = MINA_OK;
+        }
+        CHECK((verify_batch(sigs, pubs, txns, n, results) == MINA_OK) == (all == MINA_OK));
+        CHECK(memcmp(results, expected, sizeof(MinaStatus) * n) == 0);
+    }
+
+    for (size_t threads = 1; threads <= 3; ++threads) {
+        Pool *pool = pool_create(threads, 0);
+        CHECK(pool != NULL);
+        if (!pool) {
+            break;
+        }
+        memset(results, 0, sizeof(MinaStatus) * VERIFY_BATCH_TXNS);
+        CHECK(verify_batch_pool(pool, sigs, pubs, txns, VERIFY_BATCH_TXNS, results) != MINA_OK);
+        CHECK(memcmp(results, expected, sizeof(MinaStatus) * VERIFY_BATCH_TXNS) == 0);
+        pool_destroy(pool);
+    }
+
+    free(sigs);
+    free(pubs);
+    free(txns);
+    free(expected);
+    free(results);
+}
+
+// Exact counts for single fiat calls; signing counts the same operations
+// whatever it signs, but for the negation of k when R has an odd y
+void test_opcount(void)
+{
+    uint64_t a[4], b[4];
+    test_rand_field(a);
+    test_rand_field(b);
+
+    OpCounts counts;
+    op_count_reset();
+    fiat_pasta_fp_mul(a, a, b);
+    fiat_pasta_fp_mul(a, a, b);
+    fiat_pasta_fp_square(b, a);
+    fiat_pasta_fp_opp(b, b);
+    fiat_pasta_fq_inv(a, a);
+    op_count_get(&counts);
+
+    if (!op_count_enabled()) {
+        for (size_t i = 0; i < OP_KINDS; ++i) {
+            CHECK(counts.n[i] == 0);
+        }
+        return;
+    }
+    CHECK(counts.n[OP_FP_MUL] == 2);
+    CHECK(counts.n[OP_FP_SQUARE] == 1);
+    CHECK(counts.n[OP_FP_SUB] == 1);
+    CHECK(counts.n[OP_FP_ADD] == 0 && counts.n[OP_FP_INV] == 0);
+    CHECK(counts.n[OP_FQ_INV] == 1 && counts.n[OP_FQ_SQUARE] > 0);
+
+    Keypair kp;
+    Transaction txn;
+    Signature sig;
+    OpCounts first;
+    test_rand_keypair(&kp);
+    for (size_t i = 0; i < 4; ++i) {
+        test_rand_transaction(&txn);
+        op_count_reset();
+        CHECK(sign(&sig, &kp, &txn) == MINA_OK);
+        op_count_get(&counts);
+        CHECK(counts.n[OP_FQ_SUB] <= 1);
+        counts.n[OP_FQ_SUB] = 0;
+        if (i == 0) {
+            first = counts;
+            CHECK(counts.n[OP_POSEIDON] > 0 && counts.n[OP_BLAKE2B] > 0 && counts.n[OP_FP_INV] == 1);
+        }
+        CHECK(memcmp(&counts, &first, sizeof(OpCounts)) == 0);
+    }
+}
@@ -0,0 +1,111 @@
+// Concurrent signing stress test
+//
+// Threads sign the same transactions with sign, sign_batch and a shared
+// pool at the same time, and check every signature against a serial run.
+// To check for races, build with
+//
+//     gcc -O1 -g -fsanitize=thread -I. -o test_tsan.out tests/*.c $(ls *.c | grep -v '^main\.c$') -lpthread
+//
+// and run ./test_tsan.out stress
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include "test.h"
+#include "crypto.h"
+
+#define STRESS_THREADS 8
+#define STRESS_TXNS 96
+#define STRESS_ROUNDS 2
+#define STRESS_KEYS 4
+
+typedef struct stress_ctx {
+    const Keypair *kps;
+    const Transaction *txns;
+    const Signature *expected;
+    Pool *pool;
+    _Atomic size_t failures;
+} StressCtx;
+
+typedef struct stress_thread {
+    StressCtx *ctx;
+    size_t index;
+} StressThread;
+
+static void *stress_main(void *arg)
+{
+    StressThread *thread = arg;
+    StressCtx *ctx = thread->ctx;
+    Signature *sigs = malloc(sizeof(Signature) * STRESS_TXNS);
+    if (!sigs) {
+        atomic_fetch_add(&ctx->failures, 1);
+        return NULL;
+    }
+
+    for (size_t round = 0; round < STRESS_ROUNDS; ++round) {
+        memset(sigs, 0, sizeof(Signature) * STRESS_TXNS);
+
+        MinaStatus status = MINA_OK;
+        switch ((thread->index + round) % 3) {
+        case 0:
+            for (size_t i = 0; i < STRESS_TXNS && status == MINA_OK; ++i) {
+                status = sign(&sigs[i], &ctx->kps[i], &ctx->txns[i]);
+            }
+            break;
+        case 1:
+            status = sign_batch(ctx->kps, ctx->txns, STRESS_TXNS, sigs);
+            break;
+        default:
+            status = sign_batch_pool(ctx->pool, ctx->kps, 1, ctx->txns, STRESS_TXNS, sigs);
+            break;
+        }
+
+        if (status != MINA_OK || memcmp(sigs, ctx->expected, sizeof(Signature) * STRESS_TXNS) != 0) {
+            atomic_fetch_add(&ctx->failures, 1);
+        }
+    }
+
+    free(sigs);
+    return NULL;
+}
+
+void test_stress(void)
+{
+    Transaction *txns = malloc(sizeof(Transaction) * STRESS_TXNS);
+    Keypair *kps = malloc(sizeof(Keypair) * STRESS_TXNS);
+    Signature *expected = malloc(sizeof(Signature) * STRESS_TXNS);
+    Keypair keys[STRESS_KEYS];
+
+    for (size_t i = 0; i < STRESS_KEYS; ++i) {
+        test_rand_keypair(&keys[i]);
+    }
+    for (size_t i = 0; i < STRESS_TXNS; ++i) {
+        test_rand_transaction(&txns[i]);
+        kps[i] = keys[test_rand() % STRESS_KEYS];
+    }
+    for (size_t i = 0; i < STRESS_TXNS; ++i) {
+        CHECK(sign(&expected[i], &kps[i], &txns[i]) == MINA_OK);
+    }
+
+    StressCtx ctx = { kps, txns, expected, sign_pool_create(4), 0 };
+    StressThread threads[STRESS_THREADS];
+    pthread_t handles[STRESS_THREADS];
+    CHECK(ctx.pool != NULL);
+
+    for (size_t i = 0; i < STRESS_THREADS; ++i) {
+        threads[i].ctx = &ctx;
+        threads[i].index = i;
+        CHECK(pthread_create(&handles[i], NULL, stress_main, &threads[i]) == 0);
+    }
+    for (size_t i = 0; i < STRESS_THREADS; ++i) {
+        pthread_join(handles[i], NULL);
+    }
+
+    CHECK(atomic_load(&ctx.failures) == 0);
+
+    pool_destroy(ctx.pool);
+    free(txns);
+    free(kps);
+    free(expected);
+}
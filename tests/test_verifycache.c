@@ -0,0 +1,108 @@
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include "test.h"
+#include "crypto.h"
+#include "verifycache.h"
+
+#define VERIFYCACHE_KEYS 4
+#define VERIFYCACHE_TXNS 32
+#define VERIFYCACHE_THREADS 3
+
+typedef struct verifycache_worker {
+    VerifyCache *cache;
+    const Keypair *keys;
+    const Transaction *txns;
+    const Signature *sigs;
+    const size_t *key_of;
+    size_t failures;
+} VerifycacheWorker;
+
+static void *verifycache_work(void *arg)
+{
+    VerifycacheWorker *w = arg;
+    for (size_t i = 0; i < VERIFYCACHE_TXNS; ++i) {
+        w->failures += verify_cache_verify(w->cache, &w->sigs[i], &w->keys[w->key_of[i]].pub, &w->txns[i]) != MINA_OK;
+    }
+    return NULL;
+}
+
+void test_verifycache(void)
+{
+    Keypair keys[VERIFYCACHE_KEYS];
+    Transaction txns[VERIFYCACHE_TXNS];
+    Signature sigs[VERIFYCACHE_TXNS];
+    size_t key_of[VERIFYCACHE_TXNS];
+    for (size_t i = 0; i < VERIFYCACHE_KEYS; ++i) {
+        test_rand_keypair(&keys[i]);
+    }
+    // keys 1 to 3 sign transactions 1, 9 and 17, key 0 the rest
+    for (size_t i = 0; i < VERIFYCACHE_TXNS; ++i) {
+        key_of[i] = (i % 8 == 1 && i / 8 < VERIFYCACHE_KEYS - 1) ? 1 + i / 8 : 0;
+        test_rand_transaction(&txns[i]);
+        CHECK(sign(&sigs[i], &keys[key_of[i]], &txns[i]) == MINA_OK);
+    }
+
+    // room for one table: key 0 gets it on its fourth verification
+    const size_t budget = sizeof(FixedBaseTable) + 4096;
+    VerifyCache *cache = verify_cache_create(budget, 3);
+    CHECK(cache != NULL);
+    for (size_t i = 0; i < VERIFYCACHE_TXNS; ++i) {
+        const Affine *pub = &keys[key_of[i]].pub;
+        CHECK(verify_cache_verify(cache, &sigs[i], pub, &txns[i]) == MINA_OK);
+        Signature bad = sigs[i];
+        bad.s[0] ^= 1;
+        CHECK(verify_cache_verify(cache, &bad, pub, &txns[i]) == MINA_ERR_BAD_SIGNATURE);
+    }
+
+    VerifyCacheStats stats;
+    verify_cache_stats(cache, &stats);
+    CHECK(stats.verifications == 2 * VERIFYCACHE_TXNS);
+    CHECK(stats.tables_built == 1 && stats.tables == 1 && stats.evictions == 0);
+    CHECK(stats.table_hits == 2 * (VERIFYCACHE_TXNS - (VERIFYCACHE_KEYS - 1)) - 3);
+    CHECK(stats.bytes <= budget);
+
+    // keys 0 and 1 taking turns evict each other's table
+    for (size_t round = 0; round < 3; ++round) {
+        for (size_t t = 0; t <= 1; ++t) {
+            for (size_t r = 0; r < 4; ++r) {
+                CHECK(verify_cache_verify(cache, &sigs[t], &keys[key_of[t]].pub, &txns[t]) == MINA_OK);
+            }
+        }
+    }
+    verify_cache_stats(cache, &stats);
+    CHECK(stats.tables_built > 3 && stats.evictions > 0 && stats.tables == 1);
+    CHECK(stats.bytes <= budget);
+    verify_cache_destroy(cache);
+
+    // threads sharing keys while tables are built and evicted under them
+    cache = verify_cache_create(budget, 1);
+    pthread_t threads[VERIFYCACHE_THREADS];
+    VerifycacheWorker workers[VERIFYCACHE_THREADS];
+    for (size_t t = 0; t < VERIFYCACHE_THREADS; ++t) {
+        workers[t] = (VerifycacheWorker){ cache, keys, txns, sigs, key_of, 0 };
+        pthread_create(&threads[t], NULL, verifycache_work, &workers[t]);
+    }
+    for (size_t t = 0; t < VERIFYCACHE_THREADS; ++t) {
+        pthread_join(threads[t], NULL);
+        CHECK(workers[t].failures == 0);
+    }
+    verify_cache_stats(cache, &stats);
+    CHECK(stats.verifications == VERIFYCACHE_THREADS * VERIFYCACHE_TXNS && stats.bytes <= budget);
+    verify_cache_destroy(cache);
+
+    // a budget below one table only counts; zero keeps nothing
+    cache = verify_cache_create(4096, 0);
+    for (size_t i = 0; i < 4; ++i) {
+        CHECK(verify_cache_verify(cache, &sigs[i], &keys[key_of[i]].pub, &txns[i]) == MINA_OK);
+    }
+    verify_cache_stats(cache, &stats);
+    CHECK(stats.tables_built == 0 && stats.table_hits == 0 && stats.keys > 0);
+    verify_cache_destroy(cache);
+
+    cache = verify_cache_create(0, 0);
+    CHECK(verify_cache_verify(cache, &sigs[0], &keys[0].pub, &txns[0]) == MINA_OK);
+    verify_cache_stats(cache, &stats);
+    CHECK(stats.keys == 0 && stats.bytes == 0);
+    verify_cache_destroy(cache);
+}
@@ -0,0 +1,200 @@
+#!/usr/bin/env python3
+"""Generates pasta_chains.c: fixed-exponent addition chains for Fp and Fq.
+
+    python3 tools/addchain.py > pasta_chains.c
+
+Each chain is found by a search in the style of addchain's dictionary
+algorithms:
+
+  1. The exponent is split into digits, trying every window limit up to
+     MAX_LIMIT (the largest odd digit allowed) and every minimum length
+     at which a run of ones is taken as one digit 2^k - 1.
+
+  2. The digits of each split get an addition sequence, built in
+     increasing order. A digit is reached with one addition if it is the
+     sum of two values already built. Otherwise it is doubled up from its
+     half if even, or reached from the largest smaller value by
+     recursively building the difference.
+
+  3. The chain costs its sequence plus one multiplication per digit after
+     the first and the squarings between digits. Squarings cost about as
+     much as multiplications here, so the search keeps the split with the
+     fewest operations in total.
+
+Every exponent is at least 2^253 and holds a long zero run, so at least
+bit_length - 1 squarings are unavoidable. Only the multiplications can
+shrink: each chain's comment gives its cost next to Schoenhage's lower
+bound log2(e) + log2(popcount(e)) - 2.13 for any addition chain. Every
+chain is checked by evaluating it on integers before any code is emitted.
+"""
+
+import math
+import sys
+
+P = 0x40000000000000000000000000000000224698fc094cf91b992d30ed00000001
+Q = 0x40000000000000000000000000000000224698fc0994a8dd8c46eb2100000001
+
+TWO_ADICITY = 32
+MAX_LIMIT = 511
+MAX_RUN = 40
+
+
+def split(e, limit, run):
+    """Digits of e: [(squarings before, digit)] and the trailing squarings.
+
+    Digits are odd and at most limit, except runs of at least run ones
+    (if run > 0), which are taken whole."""
+    bits = [(e >> i) & 1 for i in range(e.bit_length())]
+    steps = []
+    pending = 0
+    i = len(bits) - 1
+    while i >= 0:
+        if bits[i] == 0:
+            pending += 1
+            i -= 1
+            continue
+
+        j = i
+        while j > 0 and bits[j - 1] == 1:
+            j -= 1
+        if run and i - j + 1 >= run:
+            steps.append((pending + i - j + 1, (1 << (i - j + 1)) - 1))
+            pending = 0
+            i = j - 1
+            continue
+
+        # longest window from i whose odd value is at most limit
+        digit = 0
+        end = (i, 1)
+        for k in range(i, -1, -1):
+            digit = 2 * digit + bits[k]
+            if digit > limit:
+                break
+            if bits[k]:
+                end = (k, digit)
+        k, digit = end
+        steps.append((pending + i - k + 1, digit))
+        pending = 0
+        i = k - 1
+    return steps, pending
+
+
+def sequence(targets):
+    """Addition sequence from 1 through every target: [(value, a, b)]."""
+    have = {1}
+    ops = []
+
+    def build(f):
+        if f in have:
+            return
+        for a in sorted(have, reverse=True):
+            if f - a in have and f - a <= a:
+                ops.append((f, a, f - a))
+                have.add(f)
+                return
+        if f % 2 == 0:
+            build(f // 2)
+            ops.append((f, f // 2, f // 2))
+        else:
+            a = max(x for x in have if x < f)
+            build(f - a)
+            ops.append((f, a, f - a))
+        have.add(f)
+
+    for t in sorted(set(targets)):
+        build(t)
+    return ops
+
+
+def chain(e):
+    best = None
+    for limit in range(1, MAX_LIMIT + 1, 2):
+        for run in [0] + list(range(3, MAX_RUN + 1)):
+            steps, trailing = split(e, limit, run)
+            ops = sequence([d for _, d in steps])
+            sqrs = sum(1 for _, a, b in ops if a == b) + sum(s for s, _ in steps[1:]) + trailing
+            muls = sum(1 for _, a, b in ops if a != b) + len(steps) - 1
+            if best is None or muls + sqrs < best[0]:
+                best = (muls + sqrs, muls, sqrs, steps, trailing, ops)
+    return best
+
+
+def evaluate(steps, trailing, ops):
+    values = {1: 1}
+    for f, a, b in ops:
+        assert a in values and b in values
+        values[f] = values[a] + values[b]
+    acc = values[steps[0][1]]
+    for sqrs, digit in steps[1:]:
+        acc = acc * 2 ** sqrs + values[digit]
+    return acc * 2 ** trailing
+
+
+def lower_bound(e):
+    return math.ceil(math.log2(e) + math.log2(bin(e).count("1")) - 2.13)
+
+
+def emit(field, name, doc, e):
+    cost, muls, sqrs, steps, trailing, ops = chain(e)
+    assert evaluate(steps, trailing, ops) == e
+
+    index = {1: 0}
+    for f, _, _ in ops:
+        index[f] = len(index)
+
+    f = "fiat_pasta_" + field
+    out = []
+    out.append("// out1 = arg1^%s" % doc)
+    out.append("// %d multiplications and %d squarings: %d operations, lower bound %d"
+               % (muls, sqrs, cost, lower_bound(e)))
+    out.append("void %s_pow_%s(uint64_t out1[4], const uint64_t arg1[4]) {" % (f, name))
+    out.append("  uint64_t t[%d][4]; // dictionary: %s" % (len(index), ", ".join(str(v) for v in sorted(index))))
+    out.append("  %s_copy(t[0], arg1);" % f)
+    for v, a, b in ops:
+        if a == b:
+            out.append("  %s_square(t[%d], t[%d]);" % (f, index[v], index[a]))
+        else:
+            out.append("  %s_mul(t[%d], t[%d], t[%d]);" % (f, index[v], index[a], index[b]))
+    out.append("")
+    out.append("  %s_copy(out1, t[%d]);" % (f, index[steps[0][1]]))
+    for n, digit in steps[1:]:
+        out.append("  %s_square_n(out1, %d);" % (f, n))
+        out.append("  %s_mul(out1, out1, t[%d]);" % (f, index[digit]))
+    if trailing:
+        out.append("  %s_square_n(out1, %d);" % (f, trailing))
+    out.append("}")
+    return "\n".join(out)
+
+
+def main():
+    chains = []
+    for field, m, q in (("fp", P, "p"), ("fq", Q, "q")):
+        t = (m - 1) >> TWO_ADICITY
+        chains.append(emit(field, q + "_minus_2", "(%s - 2)" % q, m - 2))
+        chains.append(emit(field, q + "_minus_1_div_2", "((%s - 1) / 2)" % q, (m - 1) // 2))
+        chains.append(emit(field, "t_minus_1_div_2", "((t - 1) / 2), where %s - 1 = 2^%d * t" % (q, TWO_ADICITY), (t - 1) // 2))
+
+    print("/* Autogenerated: python3 tools/addchain.py */")
+    print("/* Fixed-exponent addition chains for the Pasta fields. */")
+    print("/*                                                                    */")
+    print("/* fiat multiplications write their output only after reading all of */")
+    print("/* their inputs, so the chains below multiply and square in place.    */")
+    print()
+    print("#include <stdint.h>")
+    print("#include <stddef.h>")
+    print('#include "pasta_fp.h"')
+    print('#include "pasta_fq.h"')
+    print()
+    for field in ("fp", "fq"):
+        f = "fiat_pasta_" + field
+        print("static void %s_square_n(uint64_t x[4], size_t n) {" % f)
+        print("  for (size_t i = 0; i < n; ++i) {")
+        print("    %s_square(x, x);" % f)
+        print("  }")
+        print("}")
+        print()
+    print("\n\n".join(chains))
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+"""Generates pasta_sqrt_tables.c: the square root tables of both Pasta fields.
+
+    python3 tools/gensqrt.py > pasta_sqrt_tables.c
+
+Both moduli have m - 1 = 2^32 * t with t odd, and g = 5^t generates the
+2^32-th roots of unity. pasta_field.inc recovers discrete logs to the base
+g eight bits at a time (Sarkar, https://eprint.iacr.org/2020/1407) with
+
+    sqrt_table[k][j] = g^(-j * 2^(8k)),  0 <= k < 4, 0 <= j < 2^8
+
+and an open-addressing hash table from the low limb of each 2^8-th root of
+unity h^j, h = g^(2^24), back to j: sqrt_dlog_keys holds the limbs and
+sqrt_dlog_vals holds j + 1, 0 marking an empty slot. Slots are probed
+linearly from the top bits of key * 0x9e3779b97f4a7c15, as sqrt_dlog_slot
+does. Everything is in Montgomery form, the layout of pasta_sqrt.h.
+
+The values are computed here with integer arithmetic and checked before
+any code is emitted: g has order exactly 2^32, every table entry is the
+power it should be, and every key finds its j.
+"""
+
+import sys
+
+FIELDS = [
+    ("fp", 0x40000000000000000000000000000000224698fc094cf91b992d30ed00000001),
+    ("fq", 0x40000000000000000000000000000000224698fc0994a8dd8c46eb2100000001),
+]
+
+TWO_ADICITY = 32
+WINDOW_BITS = 8
+WINDOWS = TWO_ADICITY // WINDOW_BITS
+WINDOW_SIZE = 1 << WINDOW_BITS
+DLOG_SLOTS = 2 * WINDOW_SIZE
+DLOG_SHIFT = 64 - 9  # log2(DLOG_SLOTS) bits of hash
+MASK64 = 2**64 - 1
+
+
+def montgomery(a, m):
+    return a * pow(2, 256, m) % m
+
+
+def limbs(a):
+    return [(a >> (64 * i)) & MASK64 for i in range(4)]
+
+
+def dlog_slot(key):
+    return ((key * 0x9E3779B97F4A7C15) & MASK64) >> DLOG_SHIFT
+
+
+def tables(m):
+    t = (m - 1) >> TWO_ADICITY
+    assert t % 2 == 1
+    g = pow(5, t, m)
+    assert pow(g, 2 ** (TWO_ADICITY - 1), m) == m - 1, "g has order 2^32"
+
+    base = pow(g, -1, m)
+    table = []
+    for k in range(WINDOWS):
+        row = [1]
+        for _ in range(1, WINDOW_SIZE):
+            row.append(row[-1] * base % m)
+        table.append(row)
+        base = pow(base, WINDOW_SIZE, m)
+    for k in range(WINDOWS):
+        for j in range(WINDOW_SIZE):
+            assert table[k][j] == pow(g, -j * 2 ** (WINDOW_BITS * k), m)
+
+    # h^j = g^(-(2^8 - j) * 2^24)
+    keys = [0] * DLOG_SLOTS
+    vals = [0] * DLOG_SLOTS
+    for j in range(WINDOW_SIZE):
+        key = limbs(montgomery(table[WINDOWS - 1][(WINDOW_SIZE - j) % WINDOW_SIZE], m))[0]
+        slot = dlog_slot(key)
+        while vals[slot] != 0:
+            slot = (slot + 1) % DLOG_SLOTS
+        keys[slot] = key
+        vals[slot] = j + 1
+
+    h = pow(g, 2 ** (TWO_ADICITY - WINDOW_BITS), m)
+    for j in range(WINDOW_SIZE):
+        key = limbs(montgomery(pow(h, j, m), m))[0]
+        slot = dlog_slot(key)
+        while keys[slot] != key:
+            assert vals[slot] != 0
+            slot = (slot + 1) % DLOG_SLOTS
+        assert vals[slot] == j + 1
+
+    return table, keys, vals
+
+
+def emit(name, m):
+    table, keys, vals = tables(m)
+    out = ["// m = 0x%064x" % m]
+    out.append("const uint64_t fiat_pasta_%s_sqrt_table[PASTA_SQRT_WINDOWS][PASTA_SQRT_WINDOW_SIZE][4] = {" % name)
+    for k, row in enumerate(table):
+        out.append("  // g^(-j * 2^%d)" % (WINDOW_BITS * k))
+        out.append("  {")
+        for v in row:
+            out.append("    { %s }," % ", ".join("0x%016x" % x for x in limbs(montgomery(v, m))))
+        out.append("  },")
+    out.append("};")
+    out.append("")
+    out.append("const uint64_t fiat_pasta_%s_sqrt_dlog_keys[PASTA_SQRT_DLOG_SLOTS] = {" % name)
+    for i in range(0, DLOG_SLOTS, 4):
+        out.append("  %s," % ", ".join("0x%016x" % k for k in keys[i : i + 4]))
+    out.append("};")
+    out.append("")
+    out.append("const uint16_t fiat_pasta_%s_sqrt_dlog_vals[PASTA_SQRT_DLOG_SLOTS] = {" % name)
+    for i in range(0, DLOG_SLOTS, 16):
+        out.append("  %s," % ", ".join("%d" % v for v in vals[i : i + 16]))
+    out.append("};")
+    return out
+
+
+def main():
+    print("/* Autogenerated: python3 tools/gensqrt.py */")
+    print("/* Square root tables of both Pasta fields, linked in read-only so */")
+    print("/* that fiat_pasta_fp_sqrt and fiat_pasta_fq_sqrt build nothing.   */")
+    print()
+    print('#include "pasta_sqrt.h"')
+    lines = []
+    for name, m in FIELDS:
+        lines.append("")
+        lines.extend(emit(name, m))
+    print("\n".join(lines))
+
+
+if __name__ == "__main__":
+    sys.exit(main())
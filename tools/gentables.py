@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+"""Generates generator_table.c: the fixed-base table of the Pallas generator.
+
+    python3 tools/gentables.py [BITS ...] > generator_table.c
+
+The table holds, for w-bit windows over 255-bit scalars,
+
+    GENERATOR_TABLE.points[i][j - 1] = j * 2^(w * i) * g,  1 <= j < 2^w
+
+as affine points in Montgomery form, the layout of FixedBaseTable in
+crypto.h. One table is emitted for each window size given (4 by default),
+each under its own GENERATOR_TABLE_WINDOW_BITS guard, so a build picks
+whichever crypto.h asks for and fails to compile if it was not generated.
+
+The points are computed here with integer arithmetic, independently of
+the C group operations; tests/test_group.c checks the result against
+fixed_base_table_init. Every point is checked to be on the curve before
+any code is emitted.
+"""
+
+import sys
+
+P = 0x40000000000000000000000000000000224698fc094cf91b992d30ed00000001
+B = 5
+FIELD_SIZE_IN_BITS = 255
+
+# g = (1, GY), the Pallas generator of the Mina signature spec; crypto.c
+# only knows it through GENERATOR_TABLE, and tests/test_group.c spells it out
+# as GENERATOR to check the table
+GY = 12418654782883325593414442427049395787963493412651469444558597405572177144507
+
+MONTGOMERY_R = pow(2, 256, P)
+
+
+def on_curve(p):
+    x, y = p
+    return (y * y - x * x * x - B) % P == 0
+
+
+def add(p, q):
+    """p + q for affine points, neither at infinity and p != -q."""
+    (x1, y1), (x2, y2) = p, q
+    if x1 == x2:
+        assert y1 == y2, "p = -q"
+        lam = 3 * x1 * x1 * pow(2 * y1, -1, P) % P
+    else:
+        lam = (y2 - y1) * pow(x2 - x1, -1, P) % P
+    x3 = (lam * lam - x1 - x2) % P
+    return (x3, (lam * (x1 - x3) - y1) % P)
+
+
+def limbs(a):
+    m = a * MONTGOMERY_R % P
+    return ", ".join("0x%016x" % ((m >> (64 * i)) & (2**64 - 1)) for i in range(4))
+
+
+def table(w):
+    windows = (FIELD_SIZE_IN_BITS + w - 1) // w
+    base = (1, GY)
+    rows = []
+    for _ in range(windows):
+        row = [base]
+        for _ in range(2, 1 << w):
+            row.append(add(row[-1], base))
+        assert all(on_curve(p) for p in row)
+        rows.append(row)
+        # 2^w * base = (2^w - 1) * base + base
+        base = add(row[-1], base)
+    return rows
+
+
+def emit(w):
+    out = ["#if GENERATOR_TABLE_WINDOW_BITS == %d" % w, "const FixedBaseTable GENERATOR_TABLE = { {"]
+    for i, row in enumerate(table(w)):
+        out.append("  // 2^%d * g" % (w * i))
+        out.append("  {")
+        for x, y in row:
+            out.append("    { { %s }, { %s } }," % (limbs(x), limbs(y)))
+        out.append("  },")
+    out.append("} };")
+    return out
+
+
+def main():
+    bits = [int(a) for a in sys.argv[1:]] or [4]
+    assert on_curve((1, GY))
+
+    print("/* Autogenerated: python3 tools/gentables.py %s */" % " ".join(str(w) for w in bits))
+    print("/* Fixed-base table of the generator, linked in read-only so that */")
+    print("/* generator_scalar_mul and verify need no table built at startup. */")
+    print()
+    print('#include "crypto.h"')
+    print()
+    lines = []
+    for k, w in enumerate(bits):
+        block = emit(w)
+        if k > 0:
+            block[0] = "#elif" + block[0][3:]
+        lines.extend(block)
+    lines.append("#else")
+    lines.append("#error \"no generator table for GENERATOR_TABLE_WINDOW_BITS, run tools/gentables.py\"")
+    lines.append("#endif")
+    print("\n".join(lines))
+
+
+if __name__ == "__main__":
+    sys.exit(main())
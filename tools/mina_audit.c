@@ -0,0 +1,255 @@
+// mina-audit: verifies a dump of signed transactions
+//
+//     mina-audit [-t THREADS] [-o FAILURES] DUMP
+//     mina-audit -j DUMP TRANSACTIONS SIGNATURES
+//
+// DUMP is a signed transaction file (record.h): transactions, such as a
+// mempool's, each with its signature and the key to verify it under. It
+// is mapped and verified AUDIT_WINDOW records at a time. The pool decodes
+// each chunk where it lies and checks it with verify_batch; once a window
+// is done, its failures are written in order to FAILURES (stdout by
+// default), one line each:
+//
+//     <index>\t<reason>
+//
+// and its pages are dropped, so memory stays flat however large the dump
+// is. A summary with the rate goes to stderr, and the exit status is 1 if
+// any record fails.
+//
+// With -j, a transaction file and the signature file that mina-signer -o
+// made of it are joined into DUMP, with the signature file's key in every
+// record. Records not signed yet are left out.
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include "crypto.h"
+#include "record.h"
+
+#define AUDIT_WINDOW (1 << 14)
+
+typedef struct audit_scratch {
+    Transaction txns[VERIFY_BATCH];
+    Signature sigs[VERIFY_BATCH];
+    Affine pubs[VERIFY_BATCH];
+    MinaStatus results[VERIFY_BATCH];
+    size_t index[VERIFY_BATCH];
+} AuditScratch;
+
+typedef struct audit_job {
+    Pool *pool;
+    const uint8_t *records; // the window's first record
+    MinaStatus *status;     // per record of the window
+} AuditJob;
+
+// Verifies records [begin, end) of the window, at most VERIFY_BATCH of them
+static void audit_task(void *ctx, size_t begin, size_t end, size_t worker)
+{
+    AuditJob *job = ctx;
+    AuditScratch *scratch = pool_scratch(job->pool, worker);
+
+    size_t n = 0;
+    for (size_t i = begin; i < end; ++i) {
+        Compressed key;
+        MinaStatus status = signed_record_read(&scratch->txns[n], &scratch->sigs[n], &key,
+                                               job->records + i * SIGNED_RECORD_BYTES);
+        if (status == MINA_OK) {
+            status = affine_decompress(&scratch->pubs[n], &key);
+        }
+        if (status != MINA_OK) {
+            job->status[i] = status;
+            continue;
+        }
+        scratch->index[n++] = i;
+    }
+
+    verify_batch(scratch->sigs, scratch->pubs, scratch->txns, n, scratch->results);
+    for (size_t k = 0; k < n; ++k) {
+        job->status[scratch->index[k]] = scratch->results[k];
+    }
+}
+
+static int audit(size_t threads, const char *path, const char *failures_path)
+{
+    const int fd = open(path, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) < 0) {
+        perror(path);
+        return 1;
+    }
+
+    uint8_t header[RECORD_FILE_HEADER_BYTES];
+    uint64_t count = 0;
+    const size_t bytes = (size_t)st.st_size;
+    if (bytes < RECORD_FILE_HEADER_BYTES || pread(fd, header, sizeof(header), 0) != sizeof(header)
+        || record_file_header_read(header, RECORD_FILE_SIGNED, &count, NULL) != MINA_OK
+        || count > (bytes - RECORD_FILE_HEADER_BYTES) / SIGNED_RECORD_BYTES
+        || bytes != RECORD_FILE_HEADER_BYTES + count * SIGNED_RECORD_BYTES) {
+        fprintf(stderr, "%s: not a signed transaction file of version %d\n", path, RECORD_FILE_VERSION);
+        return 1;
+    }
+
+    FILE *out = failures_path ? fopen(failures_path, "w") : stdout;
+    if (!out) {
+        perror(failures_path);
+        return 1;
+    }
+
+    const uint8_t *map = mmap(NULL, bytes, PROT_READ, MAP_SHARED, fd, 0);
+    Pool *pool = pool_create(threads, sizeof(AuditScratch));
+    MinaStatus *status = malloc(sizeof(MinaStatus) * AUDIT_WINDOW);
+    if (map == MAP_FAILED || !pool || !status) {
+        fprintf(stderr, "%s: cannot map the file or start the pool\n", path);
+        return 1;
+    }
+    madvise((void *)map, bytes, MADV_SEQUENTIAL);
+
+    struct timespec start, stop;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    const size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t released = 0;
+    uint64_t failed = 0;
+    for (uint64_t first = 0; first < count; first += AUDIT_WINDOW) {
+        const size_t n = (count - first < AUDIT_WINDOW) ? (size_t)(count - first) : AUDIT_WINDOW;
+        AuditJob job = { pool, map + RECORD_FILE_HEADER_BYTES + first * SIGNED_RECORD_BYTES, status };
+        pool_run(pool, n, pool_grain(pool, n, VERIFY_BATCH), audit_task, &job);
+
+        for (size_t i = 0; i < n; ++i) {
+            if (status[i] != MINA_OK) {
+                fprintf(out, "%llu\t%s\n", (unsigned long long)(first + i), mina_status_str(status[i]));
+                failed += 1;
+            }
+        }
+
+        // the whole pages behind this window are not read again
+        const size_t done = (RECORD_FILE_HEADER_BYTES + (first + n) * SIGNED_RECORD_BYTES) / page * page;
+        if (done > released) {
+            madvise((void *)(map + released), done - released, MADV_DONTNEED);
+            released = done;
+        }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+    const double seconds = (double)(stop.tv_sec - start.tv_sec) + (double)(stop.tv_nsec - start.tv_nsec) / 1e9;
+    fprintf(stderr, "%llu records, %llu failed in %.3f s (%.0f records/s, %zu threads)\n",
+            (unsigned long long)count, (unsigned long long)failed, seconds, (double)count / seconds,
+            pool_threads(pool));
+
+    int ret = (failed > 0) ? 1 : 0;
+    if (fflush(out) != 0 || (failures_path && fclose(out) != 0)) {
+        perror(failures_path ? failures_path : "stdout");
+        ret = 1;
+    }
+    pool_destroy(pool);
+    free(status);
+    munmap((void *)map, bytes);
+    close(fd);
+    return ret;
+}
+
+// Streams both files record by record, so memory stays flat here as well
+static int join(const char *out_path, const char *txns_path, const char *sigs_path)
+{
+    FILE *txns = fopen(txns_path, "rb");
+    FILE *sigs = fopen(sigs_path, "rb");
+    FILE *out = fopen(out_path, "wb");
+    if (!txns || !sigs || !out) {
+        perror(!txns ? txns_path : !sigs ? sigs_path : out_path);
+        return 1;
+    }
+
+    uint8_t header[RECORD_FILE_HEADER_BYTES];
+    uint64_t count = 0, sigs_count = 0;
+    Compressed key;
+    if (fread(header, sizeof(header), 1, txns) != 1
+        || record_file_header_read(header, RECORD_FILE_TRANSACTIONS, &count, NULL) != MINA_OK
+        || fread(header, sizeof(header), 1, sigs) != 1
+        || record_file_header_read(header, RECORD_FILE_SIGNATURES, &sigs_count, &key) != MINA_OK
+        || sigs_count != count) {
+        fprintf(stderr, "%s, %s: not a transaction file and its signature file\n", txns_path, sigs_path);
+        return 1;
+    }
+
+    // the header is written again with the count once it is known
+    record_file_header_write(header, RECORD_FILE_SIGNED, 0, NULL);
+    fwrite(header, sizeof(header), 1, out);
+
+    uint64_t written = 0;
+    for (uint64_t i = 0; i < count; ++i) {
+        uint8_t txn[TX_RECORD_BYTES], sig[SIGNATURE_RECORD_BYTES], record[SIGNED_RECORD_BYTES];
+        if (fread(txn, sizeof(txn), 1, txns) != 1 || fread(sig, sizeof(sig), 1, sigs) != 1) {
+            fprintf(stderr, "%s, %s: truncated at record %llu\n", txns_path, sigs_path, (unsigned long long)i);
+            return 1;
+        }
+        if (!signature_record_is_signed(sig)) {
+            continue;
+        }
+        memcpy(record, txn, TX_RECORD_BYTES);
+        memcpy(record + TX_RECORD_BYTES, sig, SIGNATURE_RECORD_BYTES);
+        compressed_write(record + TX_RECORD_BYTES + SIGNATURE_RECORD_BYTES, &key);
+        memset(record + TX_RECORD_BYTES + SIGNATURE_RECORD_BYTES + COMPRESSED_BYTES, 0,
+               SIGNED_RECORD_BYTES - TX_RECORD_BYTES - SIGNATURE_RECORD_BYTES - COMPRESSED_BYTES);
+        fwrite(record, sizeof(record), 1, out);
+        written += 1;
+    }
+
+    record_file_header_write(header, RECORD_FILE_SIGNED, written, NULL);
+    if (fseek(out, 0, SEEK_SET) != 0 || fwrite(header, sizeof(header), 1, out) != 1 || fclose(out) != 0) {
+        perror(out_path);
+        return 1;
+    }
+    fclose(txns);
+    fclose(sigs);
+    fprintf(stderr, "%llu records written, %llu not signed yet\n", (unsigned long long)written,
+            (unsigned long long)(count - written));
+    return 0;
+}
+
+static int usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [-t THREADS] [-o FAILURES] DUMP\n"
+            "       %s -j DUMP TRANSACTIONS SIGNATURES\n",
+            argv0, argv0);
+    return 2;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *failures_path = NULL;
+    const char *join_path = NULL;
+    size_t threads = 0;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "t:o:j:")) != -1) {
+        switch (opt) {
+        case 't':
+            threads = strtoul(optarg, NULL, 10);
+            break;
+        case 'o':
+            failures_path = optarg;
+            break;
+        case 'j':
+            join_path = optarg;
+            break;
+        default:
+            return usage(argv[0]);
+        }
+    }
+
+    if (join_path) {
+        if (failures_path || optind + 2 != argc) {
+            return usage(argv[0]);
+        }
+        return join(join_path, argv[optind], argv[optind + 1]);
+    }
+    if (optind + 1 != argc) {
+        return usage(argv[0]);
+    }
+    return audit(threads, argv[optind], failures_path);
+}
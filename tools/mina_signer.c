@@ -0,0 +1,932 @@
+// mina-signer: streaming batch signer
+//
+//     mina-signer -k KEYFILE [-t THREADS] [-b BATCH] [-f FORMAT] [INPUT]
+//     mina-signer -k KEYFILE [-t THREADS] -o OUTPUT INPUT
+//     mina-signer [-k KEYFILE] -x OUTPUT [INPUT]
+//
+// reads newline-delimited JSON payments, in the format of the example in
+// main.c, from INPUT (stdin by default) and writes one line per payment to
+// stdout, in input order:
+//
+//     {"field":"<rx>","scalar":"<s>"}
+//     {"error":"<reason>"}
+//
+// in decimal, or with -f hex as the raw signature of record.h (rx | s, 64
+// bytes) in hex, encoded a batch at a time:
+//
+//     {"signature":"<128 hex digits>"}
+//
+// KEYFILE holds the private key, either base58 (EK...) or 64 hex digits
+// (big endian). Every payment must have the key's public key as fee payer.
+//
+// Input is parsed in place: each line is tokenized into slices of the read
+// buffer, so nothing is copied or allocated per payment. At most BATCH
+// lines are in flight; the pool signs and formats them into fixed-size
+// output slots, which are then written in order.
+//
+// With -o, INPUT is a transaction file and OUTPUT a signature file (both in
+// record.h). Both are mapped; each worker reads records where they lie and
+// writes each signature at the offset of its transaction, so nothing is
+// parsed or allocated per record. Records already signed in OUTPUT are
+// skipped, so running again after an interruption resumes. SIGINT and
+// SIGTERM let the chunks in flight finish before exiting; a hard kill can
+// leave the records being written at that moment torn, with s written and
+// rx still zero, and those are signed again. Records are only known to be
+// on disk once a run ends with its msync.
+//
+// With -x, the payments of INPUT are written to OUTPUT as a transaction
+// file instead of signed. Without -k their fee payers are not checked.
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include "crypto.h"
+#include "base10.h"
+#include "pasta_fp.h"
+#include "pasta_fq.h"
+#include "record.h"
+#include "tool.h"
+
+#define SIGNER_DEFAULT_BATCH 4096
+#define SIGNER_READ_BYTES (1 << 20)
+#define SIGNER_OUT_SLOT 192 // {"field":"<77 digits>","scalar":"<77 digits>"}\n fits
+
+#define ADDRESS_VERSION 0xcb
+#define MEMO_VERSION 0x14
+
+typedef struct slice {
+    const char *p;
+    size_t len;
+} Slice;
+
+typedef struct signer {
+    Pool *pool;
+    Keypair kp;
+    bool has_key;
+    size_t batch;
+
+    // -x: the transaction file being written
+    int records_fd;
+    uint64_t records;
+    size_t payments;
+    size_t failed;
+
+    // per line of the current batch
+    Transaction *txns;
+    const char **errors;  // NULL if txns[i] is to be signed
+    char (*out)[SIGNER_OUT_SLOT];
+    size_t *out_len;
+
+    // the lines to sign, compacted
+    Transaction *valid_txns;
+    Signature *sigs;
+    MinaStatus *results;
+    char *hex; // -f hex: SIGNATURE_HEX_LEN per signature
+    size_t *valid_index;
+    size_t valid_len;
+} Signer;
+
+// JSON, just enough for payments: objects, arrays, strings without
+// escapes, and bare numbers. Values are slices into the line.
+
+static bool json_is_ws(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static void json_ws(Slice *s)
+{
+    while (s->len && json_is_ws(*s->p)) {
+        s->p++;
+        s->len--;
+    }
+}
+
+static bool json_char(Slice *s, char c)
+{
+    json_ws(s);
+    if (s->len && *s->p == c) {
+        s->p++;
+        s->len--;
+        return true;
+    }
+    return false;
+}
+
+static bool json_string(Slice *s, Slice *out)
+{
+    if (!json_char(s, '"')) {
+        return false;
+    }
+    const char *end = memchr(s->p, '"', s->len);
+    if (!end || memchr(s->p, '\\', (size_t)(end - s->p))) {
+        return false;
+    }
+    out->p = s->p;
+    out->len = (size_t)(end - s->p);
+    s->len -= out->len + 1;
+    s->p = end + 1;
+    return true;
+}
+
+// Skips a value of any type
+static bool json_skip(Slice *s, int depth)
+{
+    Slice tmp;
+    json_ws(s);
+    if (!s->len || depth > 16) {
+        return false;
+    }
+
+    if (*s->p == '"') {
+        return json_string(s, &tmp);
+    }
+    if (*s->p == '{' || *s->p == '[') {
+        const char close = (*s->p == '{') ? '}' : ']';
+        const bool object = (close == '}');
+        s->p++;
+        s->len--;
+        if (json_char(s, close)) {
+            return true;
+        }
+        do {
+            if (object && (!json_string(s, &tmp) || !json_char(s, ':'))) {
+                return false;
+            }
+            if (!json_skip(s, depth + 1)) {
+                return false;
+            }
+        } while (json_char(s, ','));
+        return json_char(s, close);
+    }
+
+    // number, true, false, null
+    size_t n = 0;
+    while (n < s->len && s->p[n] != ',' && s->p[n] != '}' && s->p[n] != ']' && !json_is_ws(s->p[n])) {
+        n++;
+    }
+    s->p += n;
+    s->len -= n;
+    return n > 0;
+}
+
+// A string or a bare number
+static bool json_scalar(Slice *s, Slice *out)
+{
+    json_ws(s);
+    if (s->len && *s->p == '"') {
+        return json_string(s, out);
+    }
+    out->p = s->p;
+    if (!json_skip(s, 0)) {
+        return false;
+    }
+    out->len = (size_t)(s->p - out->p);
+    return true;
+}
+
+static bool slice_eq(Slice s, const char *lit)
+{
+    return s.len == strlen(lit) && memcmp(s.p, lit, s.len) == 0;
+}
+
+static bool parse_u64(Slice s, uint64_t max, uint64_t *out)
+{
+    if (s.len == 0 || s.len > 20) {
+        return false;
+    }
+    uint64_t x = 0;
+    for (size_t i = 0; i < s.len; ++i) {
+        if (s.p[i] < '0' || s.p[i] > '9') {
+            return false;
+        }
+        const uint64_t d = (uint64_t)(s.p[i] - '0');
+        if (x > (max - d) / 10) {
+            return false;
+        }
+        x = x * 10 + d;
+    }
+    *out = x;
+    return true;
+}
+
+// The address payload after its two 0x01 bytes is x | parity as in a
+// transaction record, so compressed_read rejects an x at or above p as the
+// binary path does. x^3 + 5 must also be a square, or the key is no point.
+static bool parse_public_key(Slice s, Compressed *out)
+{
+    uint8_t bytes[40];
+    if (tool_b58check(s.p, s.len, bytes, sizeof(bytes)) != ADDRESS_VERSION || bytes[1] != 0x01 || bytes[2] != 0x01
+        || compressed_read(out, bytes + 3) != MINA_OK) {
+        return false;
+    }
+
+    const uint64_t five[4] = { 5, 0, 0, 0 };
+    uint64_t b[4], y2[4];
+    fiat_pasta_fp_to_montgomery(b, five);
+    fiat_pasta_fp_square(y2, out->x);
+    fiat_pasta_fp_mul(y2, y2, out->x);
+    fiat_pasta_fp_add(y2, y2, b);
+    return fiat_pasta_fp_legendre(y2) == 1;
+}
+
+static bool parse_memo(Slice s, Memo out)
+{
+    uint8_t bytes[1 + MEMO_BYTES + 4];
+    if (tool_b58check(s.p, s.len, bytes, sizeof(bytes)) != MEMO_VERSION) {
+        return false;
+    }
+    memcpy(out, bytes + 1, MEMO_BYTES);
+    return true;
+}
+
+static const char *parse_common(Slice *s, Transaction *txn)
+{
+    if (!json_char(s, '{')) {
+        return "common is not an object";
+    }
+
+    unsigned seen = 0;
+    do {
+        Slice key, value;
+        if (!json_string(s, &key) || !json_char(s, ':')) {
+            return "malformed common";
+        }
+
+        uint64_t x;
+        if (slice_eq(key, "fee")) {
+            if (!json_scalar(s, &value) || !parse_u64(value, UINT64_MAX, &txn->fee)) {
+                return "invalid fee";
+            }
+            seen |= 1;
+        } else if (slice_eq(key, "fee_token")) {
+            if (!json_scalar(s, &value) || !parse_u64(value, UINT64_MAX, &txn->fee_token)) {
+                return "invalid fee_token";
+            }
+            seen |= 2;
+        } else if (slice_eq(key, "fee_payer_pk")) {
+            if (!json_string(s, &value) || !parse_public_key(value, &txn->fee_payer_pk)) {
+                return "invalid fee_payer_pk";
+            }
+            seen |= 4;
+        } else if (slice_eq(key, "nonce")) {
+            if (!json_scalar(s, &value) || !parse_u64(value, UINT32_MAX, &x)) {
+                return "invalid nonce";
+            }
+            txn->nonce = (Nonce)x;
+            seen |= 8;
+        } else if (slice_eq(key, "valid_until")) {
+            if (!json_scalar(s, &value) || !parse_u64(value, UINT32_MAX, &x)) {
+                return "invalid valid_until";
+            }
+            txn->valid_until = (GlobalSlot)x;
+            seen |= 16;
+        } else if (slice_eq(key, "memo")) {
+            if (!json_string(s, &value) || !parse_memo(value, txn->memo)) {
+                return "invalid memo";
+            }
+        } else if (!json_skip(s, 0)) {
+            return "malformed common";
+        }
+    } while (json_char(s, ','));
+
+    if (!json_char(s, '}')) {
+        return "malformed common";
+    }
+    return seen == 31 ? NULL : "missing field in common";
+}
+
+static const char *parse_body(Slice *s, Transaction *txn)
+{
+    Slice kind;
+    if (!json_char(s, '[') || !json_string(s, &kind) || !json_char(s, ',')) {
+        return "body is not [kind, payload]";
+    }
+    if (!slice_eq(kind, "Payment")) {
+        return "only payments are supported";
+    }
+    if (!json_char(s, '{')) {
+        return "payment is not an object";
+    }
+
+    unsigned seen = 0;
+    do {
+        Slice key, value;
+        if (!json_string(s, &key) || !json_char(s, ':')) {
+            return "malformed payment";
+        }
+
+        if (slice_eq(key, "source_pk")) {
+            if (!json_string(s, &value) || !parse_public_key(value, &txn->source_pk)) {
+                return "invalid source_pk";
+            }
+            seen |= 1;
+        } else if (slice_eq(key, "receiver_pk")) {
+            if (!json_string(s, &value) || !parse_public_key(value, &txn->receiver_pk)) {
+                return "invalid receiver_pk";
+            }
+            seen |= 2;
+        } else if (slice_eq(key, "token_id")) {
+            if (!json_scalar(s, &value) || !parse_u64(value, UINT64_MAX, &txn->token_id)) {
+                return "invalid token_id";
+            }
+            seen |= 4;
+        } else if (slice_eq(key, "amount")) {
+            if (!json_scalar(s, &value) || !parse_u64(value, UINT64_MAX, &txn->amount)) {
+                return "invalid amount";
+            }
+            seen |= 8;
+        } else if (!json_skip(s, 0)) {
+            return "malformed payment";
+        }
+    } while (json_char(s, ','));
+
+    if (!json_char(s, '}') || !json_char(s, ']')) {
+        return "malformed payment";
+    }
+    return seen == 15 ? NULL : "missing field in payment";
+}
+
+static const char *parse_payment(Slice line, Transaction *txn)
+{
+    memset(txn, 0, sizeof(Transaction));
+    txn->memo[0] = 0x01; // empty memo unless given
+
+    Slice s = line;
+    if (!json_char(&s, '{')) {
+        return "not a JSON object";
+    }
+
+    unsigned seen = 0;
+    do {
+        Slice key;
+        if (!json_string(&s, &key) || !json_char(&s, ':')) {
+            return "malformed JSON";
+        }
+
+        const char *error = NULL;
+        if (slice_eq(key, "common")) {
+            error = parse_common(&s, txn);
+            seen |= 1;
+        } else if (slice_eq(key, "body")) {
+            error = parse_body(&s, txn);
+            seen |= 2;
+        } else if (!json_skip(&s, 0)) {
+            error = "malformed JSON";
+        }
+        if (error) {
+            return error;
+        }
+    } while (json_char(&s, ','));
+
+    if (!json_char(&s, '}')) {
+        return "malformed JSON";
+    }
+    json_ws(&s);
+    if (s.len) {
+        return "trailing data";
+    }
+    return seen == 3 ? NULL : "missing common or body";
+}
+
+static size_t format_signature(char *out, const Signature *sig)
+{
+    static const char FIELD[] = "{\"field\":\"";
+    static const char SCALAR[] = "\",\"scalar\":\"";
+    static const char END[] = "\"}\n";
+    uint64_t tmp[4];
+    size_t len = 0;
+
+    memcpy(out + len, FIELD, sizeof(FIELD) - 1);
+    len += sizeof(FIELD) - 1;
+    fiat_pasta_fp_from_montgomery(tmp, sig->rx);
+    len += bigint_to_decimal(out + len, tmp);
+    memcpy(out + len, SCALAR, sizeof(SCALAR) - 1);
+    len += sizeof(SCALAR) - 1;
+    fiat_pasta_fq_from_montgomery(tmp, sig->s);
+    len += bigint_to_decimal(out + len, tmp);
+    memcpy(out + len, END, sizeof(END));
+    return len + sizeof(END) - 1;
+}
+
+static size_t format_hex(char *out, const char hex[SIGNATURE_HEX_LEN])
+{
+    static const char START[] = "{\"signature\":\"";
+    static const char END[] = "\"}\n";
+    memcpy(out, START, sizeof(START) - 1);
+    memcpy(out + sizeof(START) - 1, hex, SIGNATURE_HEX_LEN);
+    memcpy(out + sizeof(START) - 1 + SIGNATURE_HEX_LEN, END, sizeof(END));
+    return sizeof(START) - 1 + SIGNATURE_HEX_LEN + sizeof(END) - 1;
+}
+
+static size_t format_error(char *out, const char *error)
+{
+    return (size_t)snprintf(out, SIGNER_OUT_SLOT, "{\"error\":\"%s\"}\n", error);
+}
+
+// Signs and formats valid lines [begin, end) on one worker. A line that
+// fails reports its own error; the rest of its batch is signed regardless.
+static void signer_task(void *ctx, size_t begin, size_t end, size_t worker)
+{
+    Signer *signer = ctx;
+    const MinaStatus batch_status =
+        sign_batch_strided(&signer->kp, 0, signer->valid_txns + begin, end - begin, signer->sigs + begin,
+                           signer->results + begin, pool_scratch(signer->pool, worker), NULL);
+    if (batch_status == MINA_OK && signer->hex) {
+        signature_hex_write_batch(signer->hex + begin * SIGNATURE_HEX_LEN, signer->sigs + begin, end - begin);
+    }
+
+    for (size_t i = begin; i < end; ++i) {
+        const size_t line = signer->valid_index[i];
+        const MinaStatus status = signer->results[i];
+        if (status == MINA_OK && signer->hex) {
+            char *hex = signer->hex + i * SIGNATURE_HEX_LEN;
+            if (batch_status != MINA_OK) {
+                signature_hex_write(hex, &signer->sigs[i]);
+            }
+            signer->out_len[line] = format_hex(signer->out[line], hex);
+        } else if (status == MINA_OK) {
+            signer->out_len[line] = format_signature(signer->out[line], &signer->sigs[i]);
+        } else {
+            signer->out_len[line] = format_error(signer->out[line], mina_status_str(status));
+        }
+    }
+}
+
+static bool write_all(int fd, const char *buf, size_t len)
+{
+    while (len > 0) {
+        ssize_t n = write(fd, buf, len);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        buf += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+// Writes the payments of lines [0, n) as transaction records
+static bool signer_convert(Signer *signer, size_t n)
+{
+    uint8_t *out = (uint8_t *)signer->out;
+    size_t len = 0;
+    for (size_t i = 0; i < n; ++i) {
+        signer->payments += 1;
+        if (signer->errors[i]) {
+            fprintf(stderr, "payment %zu: %s\n", signer->payments, signer->errors[i]);
+            signer->failed += 1;
+            continue;
+        }
+        transaction_record_write(out + len, &signer->txns[i]);
+        len += TX_RECORD_BYTES;
+    }
+    signer->records += len / TX_RECORD_BYTES;
+    return write_all(signer->records_fd, (const char *)out, len);
+}
+
+// Signs lines [0, n) of the batch and writes the results in order
+static bool signer_flush(Signer *signer, size_t n)
+{
+    if (signer->records_fd >= 0) {
+        return signer_convert(signer, n);
+    }
+
+    signer->valid_len = 0;
+    for (size_t i = 0; i < n; ++i) {
+        if (signer->errors[i]) {
+            signer->out_len[i] = format_error(signer->out[i], signer->errors[i]);
+        } else {
+            signer->valid_txns[signer->valid_len] = signer->txns[i];
+            signer->valid_index[signer->valid_len] = i;
+            signer->valid_len++;
+        }
+    }
+
+    pool_run(signer->pool, signer->valid_len, pool_grain(signer->pool, signer->valid_len, SIGN_BATCH), signer_task,
+             signer);
+
+    // pack the slots into one run and write it with a single call
+    size_t len = 0;
+    char *out = (char *)signer->out;
+    for (size_t i = 0; i < n; ++i) {
+        memmove(out + len, signer->out[i], signer->out_len[i]);
+        len += signer->out_len[i];
+    }
+    return write_all(STDOUT_FILENO, out, len);
+}
+
+static void signer_line(Signer *signer, size_t slot, Slice line)
+{
+    const char *error = parse_payment(line, &signer->txns[slot]);
+    if (!error && signer->has_key && !tool_same_key(&signer->txns[slot].fee_payer_pk, &signer->kp.pub)) {
+        error = "fee_payer_pk is not the signing key";
+    }
+    signer->errors[slot] = error;
+}
+
+// -o: one worker's batch of records, next to its SignBatchScratch
+typedef struct file_scratch {
+    SignBatchScratch batch;
+    Transaction txns[SIGN_BATCH];
+    Signature sigs[SIGN_BATCH];
+    MinaStatus results[SIGN_BATCH];
+    size_t index[SIGN_BATCH];
+    size_t signed_len;
+    size_t skipped;
+    size_t failed;
+} FileScratch;
+
+typedef struct file_job {
+    Pool *pool;
+    const Keypair *kp;
+    const uint8_t *in;  // transaction record 0
+    uint8_t *out;       // signature record 0
+} FileJob;
+
+static volatile sig_atomic_t signer_stop = 0;
+
+static void signer_on_signal(int sig)
+{
+    (void)sig;
+    signer_stop = 1;
+}
+
+// Signs the unsigned records of [begin, end), at most SIGN_BATCH of them
+static void file_task(void *ctx, size_t begin, size_t end, size_t worker)
+{
+    FileJob *job = ctx;
+    FileScratch *scratch = pool_scratch(job->pool, worker);
+    if (signer_stop) {
+        return;
+    }
+
+    size_t n = 0;
+    for (size_t i = begin; i < end; ++i) {
+        if (signature_record_is_signed(job->out + i * SIGNATURE_RECORD_BYTES)) {
+            scratch->skipped += 1;
+            continue;
+        }
+        Transaction *txn = &scratch->txns[n];
+        if (transaction_record_read(txn, job->in + i * TX_RECORD_BYTES) != MINA_OK) {
+            fprintf(stderr, "record %zu: malformed\n", i);
+            scratch->failed += 1;
+        } else if (!tool_same_key(&txn->fee_payer_pk, &job->kp->pub)) {
+            fprintf(stderr, "record %zu: fee_payer_pk is not the signing key\n", i);
+            scratch->failed += 1;
+        } else {
+            scratch->index[n++] = i;
+        }
+    }
+
+    sign_batch_strided(job->kp, 0, scratch->txns, n, scratch->sigs, scratch->results, &scratch->batch, NULL);
+    for (size_t k = 0; k < n; ++k) {
+        const MinaStatus status = scratch->results[k];
+        if (status != MINA_OK) {
+            fprintf(stderr, "record %zu: %s\n", scratch->index[k], mina_status_str(status));
+            scratch->failed += 1;
+            continue;
+        }
+
+        // s before rx, whose being nonzero marks the record signed: a kill
+        // between the two leaves rx = 0, and the record is signed again on
+        // resume. The signal fence only stops the compiler storing rx
+        // first; what reaches the disk, and in which order, is settled by
+        // the msync once the run is done.
+        uint8_t record[SIGNATURE_RECORD_BYTES];
+        uint8_t *out = job->out + scratch->index[k] * SIGNATURE_RECORD_BYTES;
+        signature_record_write(record, &scratch->sigs[k]);
+        memcpy(out + FIELD_BYTES, record + FIELD_BYTES, SCALAR_BYTES);
+        atomic_signal_fence(memory_order_seq_cst);
+        memcpy(out, record, FIELD_BYTES);
+        scratch->signed_len += 1;
+    }
+}
+
+// Maps path whole, or prints why not
+static uint8_t *signer_map(const char *path, int fd, size_t bytes, int prot)
+{
+    void *p = mmap(NULL, bytes, prot, MAP_SHARED, fd, 0);
+    if (p == MAP_FAILED) {
+        perror(path);
+        return NULL;
+    }
+    madvise(p, bytes, MADV_SEQUENTIAL);
+    return p;
+}
+
+static int sign_file(const Keypair *kp, size_t threads, const char *in_path, const char *out_path)
+{
+    const int in = open(in_path, O_RDONLY);
+    struct stat st;
+    if (in < 0 || fstat(in, &st) < 0) {
+        perror(in_path);
+        return 1;
+    }
+
+    uint8_t header[RECORD_FILE_HEADER_BYTES];
+    uint64_t count = 0;
+    const size_t in_bytes = (size_t)st.st_size;
+    if (in_bytes < RECORD_FILE_HEADER_BYTES || pread(in, header, sizeof(header), 0) != sizeof(header)
+        || record_file_header_read(header, RECORD_FILE_TRANSACTIONS, &count, NULL) != MINA_OK
+        || count > (in_bytes - RECORD_FILE_HEADER_BYTES) / TX_RECORD_BYTES
+        || in_bytes != RECORD_FILE_HEADER_BYTES + count * TX_RECORD_BYTES) {
+        fprintf(stderr, "%s: not a transaction file of version %d\n", in_path, RECORD_FILE_VERSION);
+        return 1;
+    }
+
+    Compressed key;
+    tool_compress(&key, &kp->pub);
+    const size_t out_bytes = RECORD_FILE_HEADER_BYTES + count * SIGNATURE_RECORD_BYTES;
+    const int out = open(out_path, O_RDWR | O_CREAT, 0644);
+    if (out < 0 || fstat(out, &st) < 0) {
+        perror(out_path);
+        return 1;
+    }
+    if (st.st_size == 0) {
+        record_file_header_write(header, RECORD_FILE_SIGNATURES, count, &key);
+        if (ftruncate(out, (off_t)out_bytes) < 0 || pwrite(out, header, sizeof(header), 0) != sizeof(header)) {
+            perror(out_path);
+            return 1;
+        }
+    } else {
+        // resuming: the same number of records, signed by the same key
+        uint64_t out_count = 0;
+        Compressed signer;
+        if ((size_t)st.st_size != out_bytes || pread(out, header, sizeof(header), 0) != sizeof(header)
+            || record_file_header_read(header, RECORD_FILE_SIGNATURES, &out_count, &signer) != MINA_OK
+            || out_count != count || !tool_same_key(&signer, &kp->pub)) {
+            fprintf(stderr, "%s: not a signature file of the %llu records of %s by this key\n", out_path,
+                    (unsigned long long)count, in_path);
+            return 1;
+        }
+    }
+
+    const uint8_t *in_map = signer_map(in_path, in, in_bytes, PROT_READ);
+    uint8_t *out_map = signer_map(out_path, out, out_bytes, PROT_READ | PROT_WRITE);
+    Pool *pool = pool_create(threads, sizeof(FileScratch));
+    if (!in_map || !out_map || !pool) {
+        fprintf(stderr, "%s: cannot map the files or start the pool\n", in_path);
+        return 1;
+    }
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = signer_on_signal;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+
+    for (size_t w = 0; w < pool_threads(pool); ++w) {
+        FileScratch *scratch = pool_scratch(pool, w);
+        scratch->signed_len = scratch->skipped = scratch->failed = 0;
+    }
+
+    struct timespec start, stop;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    FileJob job = { pool, kp, in_map + RECORD_FILE_HEADER_BYTES, out_map + RECORD_FILE_HEADER_BYTES };
+    pool_run(pool, count, pool_grain(pool, count, SIGN_BATCH), file_task, &job);
+    const int synced = msync(out_map, out_bytes, MS_SYNC);
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+
+    size_t signed_len = 0, skipped = 0, failed = 0;
+    for (size_t w = 0; w < pool_threads(pool); ++w) {
+        const FileScratch *scratch = pool_scratch(pool, w);
+        signed_len += scratch->signed_len;
+        skipped += scratch->skipped;
+        failed += scratch->failed;
+    }
+    const double seconds = (double)(stop.tv_sec - start.tv_sec) + (double)(stop.tv_nsec - start.tv_nsec) / 1e9;
+    fprintf(stderr, "%zu signed, %zu already signed, %zu failed of %llu records in %.3f s (%.0f records/s)\n",
+            signed_len, skipped, failed, (unsigned long long)count, seconds, (double)signed_len / seconds);
+
+    int ret = (failed > 0) ? 1 : 0;
+    if (synced < 0) {
+        perror(out_path);
+        ret = 1;
+    }
+    if (signer_stop) {
+        fprintf(stderr, "interrupted; run again to resume\n");
+        ret = 1;
+    }
+    pool_destroy(pool);
+    munmap((void *)in_map, in_bytes);
+    munmap(out_map, out_bytes);
+    close(in);
+    close(out);
+    return ret;
+}
+
+static int usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s -k KEYFILE [-t THREADS] [-b BATCH] [-f decimal|hex] [INPUT]\n"
+            "       %s -k KEYFILE [-t THREADS] -o OUTPUT INPUT\n"
+            "       %s [-k KEYFILE] -x OUTPUT [INPUT]\n",
+            argv0, argv0, argv0);
+    return 2;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *key_path = NULL;
+    const char *sign_path = NULL;
+    const char *convert_path = NULL;
+    size_t threads = 0;
+    size_t batch = SIGNER_DEFAULT_BATCH;
+    bool hex = false;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "k:t:b:f:o:x:")) != -1) {
+        switch (opt) {
+        case 'k':
+            key_path = optarg;
+            break;
+        case 't':
+            threads = strtoul(optarg, NULL, 10);
+            break;
+        case 'b':
+            batch = strtoul(optarg, NULL, 10);
+            break;
+        case 'f':
+            if (strcmp(optarg, "hex") == 0) {
+                hex = true;
+            } else if (strcmp(optarg, "decimal") != 0) {
+                return usage(argv[0]);
+            }
+            break;
+        case 'o':
+            sign_path = optarg;
+            break;
+        case 'x':
+            convert_path = optarg;
+            break;
+        default:
+            return usage(argv[0]);
+        }
+    }
+    if ((!key_path && !convert_path) || (sign_path && (convert_path || optind + 1 != argc)) || batch == 0
+        || optind + 1 < argc) {
+        return usage(argv[0]);
+    }
+
+    Signer signer;
+    memset(&signer, 0, sizeof(signer));
+    signer.records_fd = -1;
+
+    if (key_path && !tool_load_key(key_path, &signer.kp)) {
+        return 1;
+    }
+    signer.has_key = (key_path != NULL);
+
+    if (sign_path) {
+        const int ret = sign_file(&signer.kp, threads, argv[optind], sign_path);
+        memset(&signer.kp, 0, sizeof(signer.kp));
+        return ret;
+    }
+
+    uint8_t header[RECORD_FILE_HEADER_BYTES];
+    if (convert_path) {
+        // the header is written again with the count once it is known
+        signer.records_fd = open(convert_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        record_file_header_write(header, RECORD_FILE_TRANSACTIONS, 0, NULL);
+        if (signer.records_fd < 0 || !write_all(signer.records_fd, (const char *)header, sizeof(header))) {
+            perror(convert_path);
+            return 1;
+        }
+    }
+
+    int in = STDIN_FILENO;
+    if (optind < argc && strcmp(argv[optind], "-") != 0) {
+        in = open(argv[optind], O_RDONLY);
+        if (in < 0) {
+            perror(argv[optind]);
+            return 1;
+        }
+    }
+
+    signer.batch = batch;
+    signer.pool = sign_pool_create(threads);
+    signer.txns = malloc(sizeof(Transaction) * batch);
+    signer.errors = malloc(sizeof(const char *) * batch);
+    signer.out = malloc(SIGNER_OUT_SLOT * batch);
+    signer.out_len = malloc(sizeof(size_t) * batch);
+    signer.valid_txns = malloc(sizeof(Transaction) * batch);
+    signer.sigs = malloc(sizeof(Signature) * batch);
+    signer.results = malloc(sizeof(MinaStatus) * batch);
+    signer.valid_index = malloc(sizeof(size_t) * batch);
+    signer.hex = hex ? malloc((size_t)SIGNATURE_HEX_LEN * batch) : NULL;
+    char *buf = malloc(SIGNER_READ_BYTES);
+    if (!signer.pool || !signer.txns || !signer.errors || !signer.out || !signer.out_len || !signer.valid_txns
+        || !signer.sigs || !signer.results || !signer.valid_index || (hex && !signer.hex) || !buf) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    // buf[0, have) holds unparsed input; each line is parsed in place into
+    // its Transaction before the buffer is compacted
+    size_t have = 0;
+    size_t pending = 0;
+    bool eof = false;
+    bool skipping = false; // inside a line longer than the buffer
+    int ret = 0;
+
+    while (!eof || have > 0) {
+        if (!eof && have < SIGNER_READ_BYTES) {
+            ssize_t n = read(in, buf + have, SIGNER_READ_BYTES - have);
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n < 0) {
+                perror("read");
+                ret = 1;
+                break;
+            }
+            eof = (n == 0);
+            have += (size_t)n;
+        }
+
+        size_t consumed = 0;
+        while (consumed < have && pending < batch) {
+            char *start = buf + consumed;
+            char *nl = memchr(start, '\n', have - consumed);
+            if (!nl && !eof) {
+                break;
+            }
+            const size_t len = nl ? (size_t)(nl - start) : have - consumed;
+            consumed += len + (nl ? 1 : 0);
+
+            if (skipping) {
+                skipping = false;
+                continue;
+            }
+
+            Slice line = { start, len };
+            json_ws(&line);
+            if (line.len == 0) {
+                continue;
+            }
+            signer_line(&signer, pending++, line);
+        }
+
+        // a line that cannot fit in the buffer
+        if (consumed == 0 && have == SIGNER_READ_BYTES && pending < batch) {
+            if (!skipping) {
+                signer.errors[pending++] = "line too long";
+                skipping = true;
+            }
+            have = 0;
+        }
+
+        if (pending == batch || (pending > 0 && eof && consumed == have)) {
+            if (!signer_flush(&signer, pending)) {
+                perror("write");
+                ret = 1;
+                break;
+            }
+            pending = 0;
+        }
+
+        memmove(buf, buf + consumed, have - consumed);
+        have -= consumed;
+        if (eof && have == 0) {
+            break;
+        }
+    }
+
+    if (in != STDIN_FILENO) {
+        close(in);
+    }
+    if (convert_path) {
+        record_file_header_write(header, RECORD_FILE_TRANSACTIONS, signer.records, NULL);
+        if (pwrite(signer.records_fd, header, sizeof(header), 0) != sizeof(header) || close(signer.records_fd) < 0) {
+            perror(convert_path);
+            ret = 1;
+        }
+        fprintf(stderr, "%llu records written, %zu payments failed\n", (unsigned long long)signer.records,
+                signer.failed);
+        ret |= (signer.failed > 0);
+    }
+    pool_destroy(signer.pool);
+    memset(&signer.kp, 0, sizeof(signer.kp));
+    free(signer.txns);
+    free(signer.errors);
+    free(signer.out);
+    free(signer.out_len);
+    free(signer.valid_txns);
+    free(signer.sigs);
+    free(signer.results);
+    free(signer.valid_index);
+    free(signer.hex);
+    free(buf);
+    return ret;
+}
@@ -0,0 +1,631 @@
+// mina-signerd: signing daemon on a Unix domain socket
+//
+//     mina-signerd [-s SOCKET] [-r CHANNEL ...] -k KEYFILE [-k KEYFILE ...]
+//                  [-t THREADS] [-b BATCH] [-p SPINS]
+//
+// serves the protocol of signerd.h on a socket and on shared-memory
+// channels (shmring.h). The keys are read and their public
+// keys derived once at startup; a request names its key by index. A
+// request is refused with MINA_ERR_INVALID_PARAMETER if its key index is
+// unknown, its record is malformed or its fee payer is not the key.
+//
+// One thread runs an edge-triggered epoll loop over the listening socket
+// and the connections. Each pass reads whatever has arrived, takes every
+// complete request into one batch of at most BATCH, signs the batch across
+// the pool and queues the responses. Requests that arrive while a batch
+// is signed make up the next one, so batches grow with the load and stay
+// at one request when it is light. Connections and batches use buffers
+// allocated at startup; nothing is allocated per request.
+//
+// Each channel (-r, one per co-located client) has a thread of its own
+// that takes every request waiting in the ring, up to SIGN_BATCH, signs
+// them with sign_batch_strided and writes the responses straight into the
+// response ring. It polls SPINS times before sleeping on a futex.
+
+#define _GNU_SOURCE // accept4
+
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "crypto.h"
+#include "shmring.h"
+#include "signerd.h"
+#include "tool.h"
+#include "utils.h"
+
+#define SIGNERD_MAX_KEYS 64
+#define SIGNERD_MAX_CONNS 256
+#define SIGNERD_DEFAULT_BATCH 1024
+#define SIGNERD_EVENTS 64
+#define SIGNERD_MAX_CHANNELS 16
+#define SIGNERD_CHANNEL_SLOTS 256
+
+// Requests read ahead, and responses queued, per connection. A connection
+// whose responses are not being read stops being served once its write
+// buffer is full.
+#define SIGNERD_READ_BYTES (64 * SIGNERD_REQUEST_BYTES)
+#define SIGNERD_WRITE_BYTES (256 * SIGNERD_RESPONSE_BYTES)
+
+#define SIGNERD_LISTENER UINT32_MAX
+
+typedef struct conn {
+    int fd;              // -1 if the slot is free
+    uint32_t generation; // bumped on close, so late responses are dropped
+    bool readable;       // may have unread input (edge-triggered)
+    bool eof;            // the client will send nothing more
+    size_t inflight;     // requests in the batch being signed
+    size_t rlen;
+    size_t wpos, wlen;
+    uint8_t rbuf[SIGNERD_READ_BYTES];
+    uint8_t wbuf[SIGNERD_WRITE_BYTES];
+} Conn;
+
+// Requests of one batch, and the compacted ones to sign
+typedef struct batch {
+    size_t cap;
+    size_t len;
+    uint64_t *ids;
+    uint32_t *conn;
+    uint32_t *generation;
+    MinaStatus *status;
+
+    size_t valid_len;
+    size_t *valid_index;
+    Keypair *kps;
+    Transaction *txns;
+    Signature *sigs;
+    MinaStatus *results;
+} Batch;
+
+typedef struct daemon {
+    Pool *pool;
+    int epoll_fd;
+    int listen_fd;
+    Keypair keys[SIGNERD_MAX_KEYS];
+    size_t keys_len;
+    Conn *conns;
+    uint32_t first_conn; // served first in the next pass, round robin
+    Batch batch;
+} Daemon;
+
+// The thread serving one shared-memory channel, and its batch
+typedef struct channel_server {
+    const Daemon *d;
+    ShmChannel *ch;
+    unsigned spins;
+    pthread_t thread;
+    SignBatchScratch *scratch;
+    size_t valid_index[SIGN_BATCH];
+    Keypair kps[SIGN_BATCH];
+    Transaction txns[SIGN_BATCH];
+    Signature sigs[SIGN_BATCH];
+    MinaStatus results[SIGN_BATCH];
+    MinaStatus status[SIGN_BATCH];
+} ChannelServer;
+
+static volatile sig_atomic_t signerd_stop = 0;
+
+static void signerd_on_signal(int sig)
+{
+    (void)sig;
+    signerd_stop = 1;
+}
+
+static void conn_close(Conn *c)
+{
+    close(c->fd);
+    c->fd = -1;
+    c->generation += 1;
+    c->readable = false;
+    c->eof = false;
+    c->inflight = 0;
+    c->rlen = 0;
+    c->wpos = 0;
+    c->wlen = 0;
+}
+
+// Reads until EAGAIN or a full buffer. False on a read error.
+static bool conn_read(Conn *c)
+{
+    while (c->rlen < SIGNERD_READ_BYTES) {
+        const ssize_t n = read(c->fd, c->rbuf + c->rlen, SIGNERD_READ_BYTES - c->rlen);
+        if (n > 0) {
+            c->rlen += (size_t)n;
+        } else if (n == 0) {
+            c->eof = true;
+            c->readable = false;
+            return true;
+        } else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            c->readable = false;
+            return true;
+        } else if (errno != EINTR) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Writes until EAGAIN or an empty buffer. False on a write error.
+static bool conn_flush(Conn *c)
+{
+    while (c->wpos < c->wlen) {
+        const ssize_t n = send(c->fd, c->wbuf + c->wpos, c->wlen - c->wpos, MSG_NOSIGNAL);
+        if (n >= 0) {
+            c->wpos += (size_t)n;
+        } else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            break;
+        } else if (errno != EINTR) {
+            return false;
+        }
+    }
+
+    memmove(c->wbuf, c->wbuf + c->wpos, c->wlen - c->wpos);
+    c->wlen -= c->wpos;
+    c->wpos = 0;
+    return true;
+}
+
+static bool conn_has_room(const Conn *c)
+{
+    return c->wlen + (c->inflight + 1) * SIGNERD_RESPONSE_BYTES <= SIGNERD_WRITE_BYTES;
+}
+
+static bool conn_done(const Conn *c)
+{
+    return c->eof && c->rlen < SIGNERD_REQUEST_BYTES && c->inflight == 0 && c->wlen == 0;
+}
+
+// The key a request frame names and its transaction, or NULL if the
+// request is refused
+static const Keypair *signerd_request(const Daemon *d, const uint8_t *frame, Transaction *txn)
+{
+    const uint32_t key = (uint32_t)read_le(frame + 12, 4);
+    if (key >= d->keys_len || transaction_record_read(txn, frame + SIGNERD_HEADER_BYTES) != MINA_OK
+        || !tool_same_key(&txn->fee_payer_pk, &d->keys[key].pub)) {
+        return NULL;
+    }
+    return &d->keys[key];
+}
+
+static void signerd_response(uint8_t out[SIGNERD_RESPONSE_BYTES], uint64_t id, MinaStatus status,
+                             const Signature *sig)
+{
+    memset(out, 0, SIGNERD_RESPONSE_BYTES);
+    write_le(out, SIGNERD_RESPONSE_BYTES - 4, 4);
+    write_le(out + 4, id, 8);
+    write_le(out + 12, (uint64_t)status, 4);
+    if (status == MINA_OK) {
+        signature_record_write(out + SIGNERD_HEADER_BYTES, sig);
+    }
+}
+
+static void batch_add(Daemon *d, uint32_t index, const uint8_t *frame)
+{
+    Batch *b = &d->batch;
+    const size_t i = b->len++;
+    b->ids[i] = read_le(frame + 4, 8);
+    b->conn[i] = index;
+    b->generation[i] = d->conns[index].generation;
+    b->status[i] = MINA_ERR_INVALID_PARAMETER;
+
+    const Keypair *kp = signerd_request(d, frame, &b->txns[b->valid_len]);
+    if (kp) {
+        b->kps[b->valid_len] = *kp;
+        b->valid_index[b->valid_len] = i;
+        b->valid_len++;
+    }
+}
+
+// Moves the complete requests of a connection into the batch, as far as
+// the batch and the connection's write buffer have room. False on a
+// malformed frame.
+static bool conn_take(Daemon *d, uint32_t index)
+{
+    Conn *c = &d->conns[index];
+    size_t pos = 0;
+    while (c->rlen - pos >= 4) {
+        if (read_le(c->rbuf + pos, 4) != SIGNERD_REQUEST_BYTES - 4) {
+            return false;
+        }
+        if (c->rlen - pos < SIGNERD_REQUEST_BYTES || d->batch.len == d->batch.cap || !conn_has_room(c)) {
+            break;
+        }
+        batch_add(d, index, c->rbuf + pos);
+        c->inflight += 1;
+        pos += SIGNERD_REQUEST_BYTES;
+    }
+
+    memmove(c->rbuf, c->rbuf + pos, c->rlen - pos);
+    c->rlen -= pos;
+    return true;
+}
+
+// Reads and takes requests until the connection runs dry or something
+// is full
+static void conn_service(Daemon *d, uint32_t index)
+{
+    Conn *c = &d->conns[index];
+    for (;;) {
+        if (!conn_take(d, index)) {
+            conn_close(c);
+            return;
+        }
+        if (!c->readable || c->rlen == SIGNERD_READ_BYTES) {
+            break;
+        }
+        const size_t before = c->rlen;
+        if (!conn_read(c)) {
+            conn_close(c);
+            return;
+        }
+        if (c->rlen == before) {
+            break;
+        }
+    }
+    if (conn_done(c)) {
+        conn_close(c);
+    }
+}
+
+// Signs valid requests [begin, end); a failing request reports its own
+// status and the others in its chunk are signed regardless
+static void signerd_task(void *ctx, size_t begin, size_t end, size_t worker)
+{
+    Daemon *d = ctx;
+    Batch *b = &d->batch;
+    sign_batch_strided(b->kps + begin, 1, b->txns + begin, end - begin, b->sigs + begin, b->results + begin,
+                       pool_scratch(d->pool, worker), NULL);
+
+    for (size_t i = begin; i < end; ++i) {
+        b->status[b->valid_index[i]] = b->results[i];
+    }
+}
+
+static void batch_respond(Daemon *d)
+{
+    Batch *b = &d->batch;
+    size_t valid = 0;
+    for (size_t i = 0; i < b->len; ++i) {
+        const bool signed_here = valid < b->valid_len && b->valid_index[valid] == i;
+        const size_t sig = valid;
+        valid += signed_here;
+
+        Conn *c = &d->conns[b->conn[i]];
+        if (c->fd < 0 || c->generation != b->generation[i]) {
+            continue;
+        }
+
+        signerd_response(c->wbuf + c->wlen, b->ids[i], b->status[i], &b->sigs[sig]);
+        c->wlen += SIGNERD_RESPONSE_BYTES;
+        c->inflight -= 1;
+    }
+
+    for (uint32_t i = 0; i < SIGNERD_MAX_CONNS; ++i) {
+        Conn *c = &d->conns[i];
+        if (c->fd >= 0 && c->wlen > 0 && (!conn_flush(c) || conn_done(c))) {
+            conn_close(c);
+        }
+    }
+
+    memset(b->kps, 0, sizeof(Keypair) * b->valid_len);
+    b->len = 0;
+    b->valid_len = 0;
+}
+
+// Serves one channel until it is closed. Requests are taken only while
+// their responses have room, and are parsed where they lie in the ring.
+static void *channel_serve(void *arg)
+{
+    ChannelServer *srv = arg;
+    ShmChannel *ch = srv->ch;
+    while (shm_wait_peek(ch, SHM_REQUESTS, srv->spins) && shm_wait_reserve(ch, SHM_RESPONSES, srv->spins)) {
+        uint32_t n = 0;
+        size_t valid_len = 0;
+        const uint8_t *frame;
+        while (n < SIGN_BATCH && (frame = shm_peek(ch, SHM_REQUESTS, n)) && shm_reserve(ch, SHM_RESPONSES, n)) {
+            srv->status[n] = MINA_ERR_INVALID_PARAMETER;
+            const Keypair *kp = (read_le(frame, 4) == SIGNERD_REQUEST_BYTES - 4)
+                                    ? signerd_request(srv->d, frame, &srv->txns[valid_len])
+                                    : NULL;
+            if (kp) {
+                srv->kps[valid_len] = *kp;
+                srv->valid_index[valid_len++] = n;
+            }
+            n++;
+        }
+
+        sign_batch_strided(srv->kps, 1, srv->txns, valid_len, srv->sigs, srv->results, srv->scratch, NULL);
+        for (size_t i = 0; i < valid_len; ++i) {
+            srv->status[srv->valid_index[i]] = srv->results[i];
+        }
+
+        for (uint32_t i = 0, valid = 0; i < n; ++i) {
+            const bool signed_here = valid < valid_len && srv->valid_index[valid] == i;
+            signerd_response(shm_reserve(ch, SHM_RESPONSES, i), read_le(shm_peek(ch, SHM_REQUESTS, i) + 4, 8),
+                             srv->status[i], &srv->sigs[valid]);
+            valid += signed_here;
+        }
+        shm_commit(ch, SHM_RESPONSES, n);
+        shm_release(ch, SHM_REQUESTS, n);
+        memset(srv->kps, 0, sizeof(Keypair) * valid_len);
+    }
+    return NULL;
+}
+
+static void signerd_accept(Daemon *d)
+{
+    for (;;) {
+        const int fd = accept4(d->listen_fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                perror("accept");
+            }
+            if (errno != EINTR) {
+                return;
+            }
+            continue;
+        }
+
+        uint32_t index = 0;
+        while (index < SIGNERD_MAX_CONNS && d->conns[index].fd >= 0) {
+            index++;
+        }
+        if (index == SIGNERD_MAX_CONNS) {
+            close(fd);
+            continue;
+        }
+
+        struct epoll_event ev = { .events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET, .data.u32 = index };
+        if (epoll_ctl(d->epoll_fd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+            perror("epoll_ctl");
+            close(fd);
+            continue;
+        }
+        d->conns[index].fd = fd;
+        d->conns[index].readable = true;
+    }
+}
+
+// Whether a connection can make progress without new events
+static bool signerd_backlog(const Daemon *d)
+{
+    for (uint32_t i = 0; i < SIGNERD_MAX_CONNS; ++i) {
+        const Conn *c = &d->conns[i];
+        if (c->fd >= 0 && conn_has_room(c)
+            && (c->rlen >= SIGNERD_REQUEST_BYTES || (c->readable && c->rlen < SIGNERD_READ_BYTES))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static int signerd_listen(const char *path)
+{
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        fprintf(stderr, "%s: socket path too long\n", path);
+        return -1;
+    }
+    strcpy(addr.sun_path, path);
+
+    // a socket left behind by a previous run
+    struct stat st;
+    if (stat(path, &st) == 0 && S_ISSOCK(st.st_mode)) {
+        unlink(path);
+    }
+
+    const int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0 || bind(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(fd, SOMAXCONN) < 0) {
+        perror(path);
+        if (fd >= 0) {
+            close(fd);
+        }
+        return -1;
+    }
+    return fd;
+}
+
+static bool batch_alloc(Batch *b, size_t cap)
+{
+    b->cap = cap;
+    b->ids = malloc(sizeof(uint64_t) * cap);
+    b->conn = malloc(sizeof(uint32_t) * cap);
+    b->generation = malloc(sizeof(uint32_t) * cap);
+    b->status = malloc(sizeof(MinaStatus) * cap);
+    b->valid_index = malloc(sizeof(size_t) * cap);
+    b->kps = malloc(sizeof(Keypair) * cap);
+    b->txns = malloc(sizeof(Transaction) * cap);
+    b->sigs = malloc(sizeof(Signature) * cap);
+    b->results = malloc(sizeof(MinaStatus) * cap);
+    return b->ids && b->conn && b->generation && b->status && b->valid_index && b->kps && b->txns && b->sigs
+           && b->results;
+}
+
+static int usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [-s SOCKET] [-r CHANNEL ...] -k KEYFILE [-k KEYFILE ...] [-t THREADS] [-b BATCH] [-p SPINS]\n",
+            argv0);
+    return 2;
+}
+
+int main(int argc, char *argv[])
+{
+    static Daemon d;
+    const char *socket_path = NULL;
+    size_t threads = 0;
+    size_t batch = SIGNERD_DEFAULT_BATCH;
+    static ChannelServer channels[SIGNERD_MAX_CHANNELS];
+    const char *channel_names[SIGNERD_MAX_CHANNELS];
+    size_t channels_len = 0;
+    unsigned spins = 0;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "s:r:k:t:b:p:")) != -1) {
+        switch (opt) {
+        case 's':
+            socket_path = optarg;
+            break;
+        case 'r':
+            if (channels_len == SIGNERD_MAX_CHANNELS) {
+                fprintf(stderr, "at most %d channels\n", SIGNERD_MAX_CHANNELS);
+                return 2;
+            }
+            channel_names[channels_len++] = optarg;
+            break;
+        case 'p':
+            spins = (unsigned)strtoul(optarg, NULL, 10);
+            break;
+        case 'k':
+            if (d.keys_len == SIGNERD_MAX_KEYS) {
+                fprintf(stderr, "at most %d keys\n", SIGNERD_MAX_KEYS);
+                return 2;
+            }
+            if (!tool_load_key(optarg, &d.keys[d.keys_len])) {
+                return 1;
+            }
+            d.keys_len++;
+            break;
+        case 't':
+            threads = strtoul(optarg, NULL, 10);
+            break;
+        case 'b':
+            batch = strtoul(optarg, NULL, 10);
+            break;
+        default:
+            return usage(argv[0]);
+        }
+    }
+    if ((!socket_path && channels_len == 0) || d.keys_len == 0 || batch == 0 || optind != argc) {
+        return usage(argv[0]);
+    }
+
+    // pool and channel threads inherit a mask that leaves the signals to this one
+    sigset_t mask, old_mask;
+    sigemptyset(&mask);
+    sigaddset(&mask, SIGINT);
+    sigaddset(&mask, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &mask, &old_mask);
+    d.pool = sign_pool_create(threads);
+    d.conns = calloc(SIGNERD_MAX_CONNS, sizeof(Conn));
+    if (!d.pool || !d.conns || !batch_alloc(&d.batch, batch)) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    for (size_t i = 0; i < SIGNERD_MAX_CONNS; ++i) {
+        d.conns[i].fd = -1;
+    }
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = signerd_on_signal;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+    signal(SIGPIPE, SIG_IGN);
+
+    d.listen_fd = -1;
+    d.epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (d.epoll_fd < 0) {
+        perror("epoll_create1");
+        return 1;
+    }
+    if (socket_path) {
+        d.listen_fd = signerd_listen(socket_path);
+        struct epoll_event listen_ev = { .events = EPOLLIN, .data.u32 = SIGNERD_LISTENER };
+        if (d.listen_fd < 0 || epoll_ctl(d.epoll_fd, EPOLL_CTL_ADD, d.listen_fd, &listen_ev) < 0) {
+            perror("epoll_ctl");
+            return 1;
+        }
+    }
+
+    for (size_t i = 0; i < channels_len; ++i) {
+        ChannelServer *srv = &channels[i];
+        srv->d = &d;
+        srv->spins = spins;
+        srv->scratch = malloc(sizeof(SignBatchScratch));
+        srv->ch = shm_channel_create(channel_names[i], SIGNERD_CHANNEL_SLOTS);
+        if (!srv->scratch || !srv->ch || pthread_create(&srv->thread, NULL, channel_serve, srv) != 0) {
+            fprintf(stderr, "%s: cannot serve channel\n", channel_names[i]);
+            return 1;
+        }
+    }
+    pthread_sigmask(SIG_SETMASK, &old_mask, NULL);
+
+    fprintf(stderr, "mina-signerd: %zu keys, %zu threads, %zu channels, listening on %s\n", d.keys_len,
+            pool_threads(d.pool), channels_len, socket_path ? socket_path : "no socket");
+
+    struct epoll_event events[SIGNERD_EVENTS];
+    bool backlog = false;
+    while (!signerd_stop) {
+        const int n = epoll_wait(d.epoll_fd, events, SIGNERD_EVENTS, backlog ? 0 : -1);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            perror("epoll_wait");
+            break;
+        }
+
+        for (int i = 0; i < n; ++i) {
+            const uint32_t index = events[i].data.u32;
+            if (index == SIGNERD_LISTENER) {
+                signerd_accept(&d);
+                continue;
+            }
+            Conn *c = &d.conns[index];
+            if (c->fd < 0) {
+                continue;
+            }
+            if (events[i].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) {
+                c->readable = true;
+            }
+            if ((events[i].events & EPOLLOUT) && (!conn_flush(c) || conn_done(c))) {
+                conn_close(c);
+            }
+        }
+
+        // a full batch leaves the later connections for the next pass, which
+        // starts where this one stopped
+        for (uint32_t i = 0; i < SIGNERD_MAX_CONNS && d.batch.len < d.batch.cap; ++i) {
+            const uint32_t index = (d.first_conn + i) % SIGNERD_MAX_CONNS;
+            if (d.conns[index].fd >= 0) {
+                conn_service(&d, index);
+                if (d.batch.len == d.batch.cap) {
+                    d.first_conn = (index + 1) % SIGNERD_MAX_CONNS;
+                }
+            }
+        }
+
+        if (d.batch.len > 0) {
+            pool_run(d.pool, d.batch.valid_len, pool_grain(d.pool, d.batch.valid_len, SIGN_BATCH), signerd_task, &d);
+            batch_respond(&d);
+        }
+        backlog = signerd_backlog(&d);
+    }
+
+    for (uint32_t i = 0; i < SIGNERD_MAX_CONNS; ++i) {
+        if (d.conns[i].fd >= 0) {
+            conn_close(&d.conns[i]);
+        }
+    }
+    if (socket_path) {
+        close(d.listen_fd);
+        unlink(socket_path);
+    }
+    for (size_t i = 0; i < channels_len; ++i) {
+        shm_channel_close(channels[i].ch);
+        pthread_join(channels[i].thread, NULL);
+        shm_channel_destroy(channels[i].ch);
+        free(channels[i].scratch);
+    }
+    memset(d.keys, 0, sizeof(d.keys));
+    pool_destroy(d.pool);
+    return 0;
+}
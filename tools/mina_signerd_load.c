@@ -0,0 +1,415 @@
+// mina-signerd-load: load generator for mina-signerd
+//
+//     mina-signerd-load -s SOCKET -k KEYFILE [-c CONNECTIONS] [-d DEPTH] [-n REQUESTS]
+//     mina-signerd-load -r CHANNEL -k KEYFILE [-d DEPTH] [-n REQUESTS] [-p SPINS]
+//
+// opens CONNECTIONS connections, or attaches to a shared-memory channel,
+// and keeps DEPTH requests in flight on each until REQUESTS responses are
+// back, then reports the throughput and the latency percentiles. With
+// -d 1 the percentiles are round-trip times, to compare the transports. The payments are random, paid by the key (the
+// daemon's key 0) so that the daemon signs them; the first few signatures
+// are checked against local signing once the clock has stopped.
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+#include "crypto.h"
+#include "shmring.h"
+#include "signerd.h"
+#include "tool.h"
+#include "utils.h"
+
+#define LOAD_RECORDS 1024 // distinct payments, sent round robin
+#define LOAD_CHECKED 16   // responses checked against local signing
+#define LOAD_MAX_DEPTH 256
+#define LOAD_EVENTS 64
+
+typedef struct load_conn {
+    int fd;
+    size_t inflight;
+    size_t rlen;
+    size_t wpos, wlen;
+    uint8_t rbuf[LOAD_MAX_DEPTH * SIGNERD_RESPONSE_BYTES];
+    uint8_t wbuf[LOAD_MAX_DEPTH * SIGNERD_REQUEST_BYTES];
+} LoadConn;
+
+typedef struct load {
+    size_t depth;
+    size_t total;
+    size_t next_id;
+    size_t done;
+    size_t errors;
+    double elapsed;
+    uint8_t (*records)[TX_RECORD_BYTES];
+    uint64_t *sent_ns;
+    uint64_t *latency_ns;
+    uint8_t checked[LOAD_CHECKED][SIGNATURE_RECORD_BYTES];
+} Load;
+
+static uint64_t load_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static uint64_t load_state = 0x9e3779b97f4a7c15ULL;
+
+static uint64_t load_rand(void)
+{
+    load_state ^= load_state << 13;
+    load_state ^= load_state >> 7;
+    load_state ^= load_state << 17;
+    return load_state;
+}
+
+static void load_rand_field(Field out)
+{
+    for (size_t i = 0; i < 4; ++i) {
+        out[i] = load_rand();
+    }
+    out[3] &= (((uint64_t)1 << 62) - 1);
+}
+
+static void load_transaction(Transaction *txn, const Affine *pub)
+{
+    memset(txn, 0, sizeof(Transaction));
+    tool_compress(&txn->fee_payer_pk, pub);
+    txn->source_pk = txn->fee_payer_pk;
+    load_rand_field(txn->receiver_pk.x);
+    txn->receiver_pk.is_odd = load_rand() & 1;
+
+    txn->fee = load_rand() % COIN;
+    txn->fee_token = 1;
+    txn->nonce = (Nonce)load_rand();
+    txn->valid_until = (GlobalSlot)load_rand();
+    txn->token_id = 1;
+    txn->amount = load_rand() % (1000 * COIN);
+    txn->memo[0] = 1;
+}
+
+// Writes until EAGAIN or an empty buffer. False on a write error.
+static bool load_flush(LoadConn *c)
+{
+    while (c->wpos < c->wlen) {
+        const ssize_t n = send(c->fd, c->wbuf + c->wpos, c->wlen - c->wpos, MSG_NOSIGNAL);
+        if (n >= 0) {
+            c->wpos += (size_t)n;
+        } else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            break;
+        } else if (errno != EINTR) {
+            return false;
+        }
+    }
+
+    memmove(c->wbuf, c->wbuf + c->wpos, c->wlen - c->wpos);
+    c->wlen -= c->wpos;
+    c->wpos = 0;
+    return true;
+}
+
+// Writes the next request, returns its id
+static size_t load_request(Load *load, uint8_t frame[SIGNERD_REQUEST_BYTES])
+{
+    const size_t id = load->next_id++;
+    write_le(frame, SIGNERD_REQUEST_BYTES - 4, 4);
+    write_le(frame + 4, id, 8);
+    write_le(frame + 12, 0, 4);
+    memcpy(frame + SIGNERD_HEADER_BYTES, load->records[id % LOAD_RECORDS], TX_RECORD_BYTES);
+    return id;
+}
+
+// Records a response, false if it is malformed
+static bool load_response(Load *load, const uint8_t frame[SIGNERD_RESPONSE_BYTES], uint64_t now)
+{
+    const uint64_t id = read_le(frame + 4, 8);
+    if (read_le(frame, 4) != SIGNERD_RESPONSE_BYTES - 4 || id >= load->next_id) {
+        return false;
+    }
+    if (read_le(frame + 12, 4) != MINA_OK) {
+        load->errors += 1;
+    }
+    if (id < LOAD_CHECKED) {
+        memcpy(load->checked[id], frame + SIGNERD_HEADER_BYTES, SIGNATURE_RECORD_BYTES);
+    }
+    load->latency_ns[load->done++] = now - load->sent_ns[id];
+    return true;
+}
+
+// Tops the connection up to depth requests in flight and sends them
+static bool load_pump(Load *load, LoadConn *c)
+{
+    while (c->inflight < load->depth && load->next_id < load->total) {
+        const size_t id = load_request(load, c->wbuf + c->wlen);
+        c->wlen += SIGNERD_REQUEST_BYTES;
+        c->inflight += 1;
+        load->sent_ns[id] = load_now_ns();
+    }
+    return load_flush(c);
+}
+
+// Reads and records responses until EAGAIN. False on EOF, a read error or
+// a malformed response.
+static bool load_receive(Load *load, LoadConn *c)
+{
+    for (;;) {
+        const ssize_t n = read(c->fd, c->rbuf + c->rlen, sizeof(c->rbuf) - c->rlen);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return true;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        c->rlen += (size_t)n;
+
+        const uint64_t now = load_now_ns();
+        size_t pos = 0;
+        while (c->rlen - pos >= SIGNERD_RESPONSE_BYTES) {
+            if (!load_response(load, c->rbuf + pos, now)) {
+                return false;
+            }
+            c->inflight -= 1;
+            pos += SIGNERD_RESPONSE_BYTES;
+        }
+        memmove(c->rbuf, c->rbuf + pos, c->rlen - pos);
+        c->rlen -= pos;
+    }
+}
+
+static int load_connect(const char *path)
+{
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        fprintf(stderr, "%s: socket path too long\n", path);
+        return -1;
+    }
+    strcpy(addr.sun_path, path);
+
+    const int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0 || connect(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        perror(path);
+        if (fd >= 0) {
+            close(fd);
+        }
+        return -1;
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    return fd;
+}
+
+static int compare_u64(const void *a, const void *b)
+{
+    const uint64_t x = *(const uint64_t *)a;
+    const uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static double percentile_us(const uint64_t *sorted, size_t n, double p)
+{
+    return (double)sorted[(size_t)(p * (double)(n - 1))] / 1e3;
+}
+
+static bool load_run_socket(Load *load, const char *path, size_t conns_len)
+{
+    LoadConn *conns = calloc(conns_len, sizeof(LoadConn));
+    if (!conns) {
+        fprintf(stderr, "out of memory\n");
+        return false;
+    }
+    const int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd < 0) {
+        perror("epoll_create1");
+        return false;
+    }
+    for (size_t i = 0; i < conns_len; ++i) {
+        conns[i].fd = load_connect(path);
+        struct epoll_event ev = { .events = EPOLLIN | EPOLLOUT | EPOLLET, .data.ptr = &conns[i] };
+        if (conns[i].fd < 0 || epoll_ctl(epoll_fd, EPOLL_CTL_ADD, conns[i].fd, &ev) < 0) {
+            return false;
+        }
+    }
+
+    const uint64_t start = load_now_ns();
+    for (size_t i = 0; i < conns_len; ++i) {
+        if (!load_pump(load, &conns[i])) {
+            perror("send");
+            return false;
+        }
+    }
+
+    struct epoll_event events[LOAD_EVENTS];
+    while (load->done < load->total) {
+        const int n = epoll_wait(epoll_fd, events, LOAD_EVENTS, -1);
+        if (n < 0 && errno != EINTR) {
+            perror("epoll_wait");
+            return false;
+        }
+        for (int i = 0; i < n; ++i) {
+            LoadConn *c = events[i].data.ptr;
+            if (((events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) && !load_receive(load, c))
+                || !load_pump(load, c)) {
+                fprintf(stderr, "connection to %s lost\n", path);
+                return false;
+            }
+        }
+    }
+    load->elapsed = (double)(load_now_ns() - start) / 1e9;
+    return true;
+}
+
+// The same against a shared-memory channel: requests are written into the
+// ring's slots and responses read where they lie
+static bool load_run_channel(Load *load, const char *name, unsigned spins)
+{
+    ShmChannel *ch = shm_channel_open(name);
+    if (!ch) {
+        return false;
+    }
+    if (load->depth > shm_channel_slots(ch)) {
+        fprintf(stderr, "%s: depth above the %u slots of the channel\n", name, shm_channel_slots(ch));
+        return false;
+    }
+
+    const uint64_t start = load_now_ns();
+    size_t inflight = 0;
+    while (load->done < load->total) {
+        uint8_t *slot;
+        while (inflight < load->depth && load->next_id < load->total
+               && (slot = shm_reserve(ch, SHM_REQUESTS, 0))) {
+            const size_t id = load_request(load, slot);
+            load->sent_ns[id] = load_now_ns();
+            shm_commit(ch, SHM_REQUESTS, 1);
+            inflight += 1;
+        }
+
+        if (!shm_wait_peek(ch, SHM_RESPONSES, spins)) {
+            fprintf(stderr, "%s: channel closed\n", name);
+            return false;
+        }
+        const uint64_t now = load_now_ns();
+        const uint8_t *frame;
+        uint32_t n = 0;
+        while ((frame = shm_peek(ch, SHM_RESPONSES, n))) {
+            if (!load_response(load, frame, now)) {
+                fprintf(stderr, "%s: malformed response\n", name);
+                return false;
+            }
+            n++;
+        }
+        shm_release(ch, SHM_RESPONSES, n);
+        inflight -= n;
+    }
+    load->elapsed = (double)(load_now_ns() - start) / 1e9;
+    shm_channel_destroy(ch);
+    return true;
+}
+
+static int usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s -s SOCKET -k KEYFILE [-c CONNECTIONS] [-d DEPTH] [-n REQUESTS]\n"
+            "       %s -r CHANNEL -k KEYFILE [-d DEPTH] [-n REQUESTS] [-p SPINS]\n",
+            argv0, argv0);
+    return 2;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *socket_path = NULL;
+    const char *channel = NULL;
+    const char *key_path = NULL;
+    size_t conns_len = 4;
+    unsigned spins = 0;
+    Load load = { .depth = 16, .total = 10000 };
+
+    int opt;
+    while ((opt = getopt(argc, argv, "s:r:k:c:d:n:p:")) != -1) {
+        switch (opt) {
+        case 's':
+            socket_path = optarg;
+            break;
+        case 'r':
+            channel = optarg;
+            break;
+        case 'p':
+            spins = (unsigned)strtoul(optarg, NULL, 10);
+            break;
+        case 'k':
+            key_path = optarg;
+            break;
+        case 'c':
+            conns_len = strtoul(optarg, NULL, 10);
+            break;
+        case 'd':
+            load.depth = strtoul(optarg, NULL, 10);
+            break;
+        case 'n':
+            load.total = strtoul(optarg, NULL, 10);
+            break;
+        default:
+            return usage(argv[0]);
+        }
+    }
+    if (!socket_path == !channel || !key_path || conns_len == 0 || load.depth == 0 || load.depth > LOAD_MAX_DEPTH
+        || load.total == 0 || optind != argc) {
+        return usage(argv[0]);
+    }
+
+    Keypair kp;
+    if (!tool_load_key(key_path, &kp)) {
+        return 1;
+    }
+
+    Transaction *txns = malloc(sizeof(Transaction) * LOAD_RECORDS);
+    load.records = malloc(TX_RECORD_BYTES * LOAD_RECORDS);
+    load.sent_ns = malloc(sizeof(uint64_t) * load.total);
+    load.latency_ns = malloc(sizeof(uint64_t) * load.total);
+    if (!txns || !load.records || !load.sent_ns || !load.latency_ns) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    for (size_t i = 0; i < LOAD_RECORDS; ++i) {
+        load_transaction(&txns[i], &kp.pub);
+        transaction_record_write(load.records[i], &txns[i]);
+    }
+
+    if (!(socket_path ? load_run_socket(&load, socket_path, conns_len) : load_run_channel(&load, channel, spins))) {
+        return 1;
+    }
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < LOAD_CHECKED && i < load.total; ++i) {
+        Signature sig;
+        uint8_t expected[SIGNATURE_RECORD_BYTES];
+        if (sign(&sig, &kp, &txns[i % LOAD_RECORDS]) != MINA_OK) {
+            mismatches += 1;
+            continue;
+        }
+        signature_record_write(expected, &sig);
+        mismatches += (memcmp(expected, load.checked[i], SIGNATURE_RECORD_BYTES) != 0);
+    }
+
+    qsort(load.latency_ns, load.total, sizeof(uint64_t), compare_u64);
+    if (socket_path) {
+        printf("%zu requests over %zu connections", load.total, conns_len);
+    } else {
+        printf("%zu requests over channel %s", load.total, channel);
+    }
+    printf(" at depth %zu: %.3f s, %.0f req/s\n", load.depth, load.elapsed, (double)load.total / load.elapsed);
+    printf("latency us: p50 %.1f  p99 %.1f  p999 %.1f  max %.1f\n", percentile_us(load.latency_ns, load.total, 0.5),
+           percentile_us(load.latency_ns, load.total, 0.99), percentile_us(load.latency_ns, load.total, 0.999),
+           (double)load.latency_ns[load.total - 1] / 1e3);
+    printf("errors %zu, mismatched signatures %zu of %d checked\n", load.errors, mismatches, LOAD_CHECKED);
+
+    memset(&kp, 0, sizeof(kp));
+    return (load.errors || mismatches) ? 1 : 0;
+}
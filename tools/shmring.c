@@ -0,0 +1,297 @@
+#include <fcntl.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#include "shmring.h"
+#include "signerd.h"
+
+#define SHM_LINE 64
+#define SHM_SLOT_BYTES(frame) (((frame) + SHM_LINE - 1) & ~(size_t)(SHM_LINE - 1))
+#define SHM_MAX_SLOTS (1U << 16)
+
+typedef struct shm_ring {
+    _Atomic uint32_t tail; // frames produced; the consumer sleeps on it
+    _Atomic uint32_t consumer_sleeping;
+    uint8_t pad0[SHM_LINE - 8];
+    _Atomic uint32_t head; // frames consumed; the producer sleeps on it
+    _Atomic uint32_t producer_sleeping;
+    uint8_t pad1[SHM_LINE - 8];
+} ShmRing;
+
+// Start of the segment, followed by the request slots and then the
+// response slots
+typedef struct shm_header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t slots;
+    _Atomic uint32_t closed;
+    uint8_t pad[SHM_LINE - 16];
+    ShmRing rings[2];
+} ShmHeader;
+
+struct shm_channel {
+    ShmHeader *header;
+    size_t bytes;
+    uint32_t mask;
+    uint8_t *slots[2];
+    size_t slot_bytes[2];
+    char *name; // set if this side created the segment
+};
+
+static size_t shm_segment_bytes(uint32_t slots)
+{
+    return sizeof(ShmHeader) + (size_t)slots * (SHM_SLOT_BYTES(SIGNERD_REQUEST_BYTES)
+                                                + SHM_SLOT_BYTES(SIGNERD_RESPONSE_BYTES));
+}
+
+// Closing does not move the counters a side sleeps on, so a wake from
+// shm_channel_close can slip in between the check of closed and the wait;
+// the timeout bounds how long such a sleeper takes to notice.
+static void shm_futex_wait(_Atomic uint32_t *word, uint32_t value)
+{
+    const struct timespec timeout = { 0, 100 * 1000 * 1000 };
+    syscall(SYS_futex, word, FUTEX_WAIT, value, &timeout, NULL, 0);
+}
+
+static void shm_futex_wake(_Atomic uint32_t *word)
+{
+    syscall(SYS_futex, word, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+}
+
+static void shm_pause(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#endif
+}
+
+static ShmChannel *shm_channel_map(int fd, size_t bytes)
+{
+    ShmChannel *ch = calloc(1, sizeof(ShmChannel));
+    void *base = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (!ch || base == MAP_FAILED) {
+        free(ch);
+        if (base != MAP_FAILED) {
+            munmap(base, bytes);
+        }
+        return NULL;
+    }
+    ch->header = base;
+    ch->bytes = bytes;
+    return ch;
+}
+
+static void shm_channel_layout(ShmChannel *ch, uint32_t slots)
+{
+    ch->mask = slots - 1;
+    ch->slot_bytes[SHM_REQUESTS] = SHM_SLOT_BYTES(SIGNERD_REQUEST_BYTES);
+    ch->slot_bytes[SHM_RESPONSES] = SHM_SLOT_BYTES(SIGNERD_RESPONSE_BYTES);
+    ch->slots[SHM_REQUESTS] = (uint8_t *)(ch->header + 1);
+    ch->slots[SHM_RESPONSES] = ch->slots[SHM_REQUESTS] + (size_t)slots * ch->slot_bytes[SHM_REQUESTS];
+}
+
+ShmChannel *shm_channel_create(const char *name, uint32_t slots)
+{
+    if (slots == 0 || slots > SHM_MAX_SLOTS || (slots & (slots - 1)) != 0) {
+        fprintf(stderr, "%s: slots must be a power of two up to %u\n", name, SHM_MAX_SLOTS);
+        return NULL;
+    }
+
+    shm_unlink(name);
+    const int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+    const size_t bytes = shm_segment_bytes(slots);
+    if (fd < 0 || ftruncate(fd, (off_t)bytes) < 0) {
+        perror(name);
+        if (fd >= 0) {
+            close(fd);
+            shm_unlink(name);
+        }
+        return NULL;
+    }
+
+    ShmChannel *ch = shm_channel_map(fd, bytes);
+    close(fd);
+    if (ch) {
+        ch->name = strdup(name);
+    }
+    if (!ch || !ch->name) {
+        fprintf(stderr, "%s: out of memory\n", name);
+        shm_channel_destroy(ch);
+        shm_unlink(name);
+        return NULL;
+    }
+
+    // ftruncate zeroed the counters; the magic goes last so a client that
+    // sees it sees the rest
+    ch->header->version = SHM_RING_VERSION;
+    ch->header->slots = slots;
+    shm_channel_layout(ch, slots);
+    atomic_thread_fence(memory_order_release);
+    ch->header->magic = SHM_RING_MAGIC;
+    return ch;
+}
+
+ShmChannel *shm_channel_open(const char *name)
+{
+    const int fd = shm_open(name, O_RDWR | O_CLOEXEC, 0);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) < 0) {
+        perror(name);
+        if (fd >= 0) {
+            close(fd);
+        }
+        return NULL;
+    }
+
+    ShmChannel *ch = (size_t)st.st_size >= sizeof(ShmHeader) ? shm_channel_map(fd, (size_t)st.st_size) : NULL;
+    close(fd);
+    if (!ch) {
+        fprintf(stderr, "%s: not a mina-signerd channel\n", name);
+        return NULL;
+    }
+
+    const ShmHeader *h = ch->header;
+    const uint32_t slots = h->slots;
+    atomic_thread_fence(memory_order_acquire);
+    if (h->magic != SHM_RING_MAGIC || h->version != SHM_RING_VERSION || slots == 0 || slots > SHM_MAX_SLOTS
+        || (slots & (slots - 1)) != 0 || shm_segment_bytes(slots) != ch->bytes) {
+        fprintf(stderr, "%s: not a mina-signerd channel of version %d\n", name, SHM_RING_VERSION);
+        shm_channel_destroy(ch);
+        return NULL;
+    }
+    shm_channel_layout(ch, slots);
+    return ch;
+}
+
+void shm_channel_destroy(ShmChannel *ch)
+{
+    if (!ch) {
+        return;
+    }
+    if (ch->name) {
+        shm_unlink(ch->name);
+        free(ch->name);
+    }
+    munmap(ch->header, ch->bytes);
+    free(ch);
+}
+
+uint32_t shm_channel_slots(const ShmChannel *ch)
+{
+    return ch->mask + 1;
+}
+
+void shm_channel_close(ShmChannel *ch)
+{
+    atomic_store(&ch->header->closed, 1);
+    for (size_t dir = 0; dir < 2; ++dir) {
+        ShmRing *r = &ch->header->rings[dir];
+        shm_futex_wake(&r->tail);
+        shm_futex_wake(&r->head);
+    }
+}
+
+const uint8_t *shm_peek(ShmChannel *ch, ShmDirection dir, uint32_t i)
+{
+    ShmRing *r = &ch->header->rings[dir];
+    const uint32_t head = atomic_load_explicit(&r->head, memory_order_relaxed);
+    const uint32_t tail = atomic_load_explicit(&r->tail, memory_order_acquire);
+    if (tail - head <= i) {
+        return NULL;
+    }
+    return ch->slots[dir] + (size_t)((head + i) & ch->mask) * ch->slot_bytes[dir];
+}
+
+void shm_release(ShmChannel *ch, ShmDirection dir, uint32_t n)
+{
+    ShmRing *r = &ch->header->rings[dir];
+    const uint32_t head = atomic_load_explicit(&r->head, memory_order_relaxed);
+    atomic_store_explicit(&r->head, head + n, memory_order_release);
+
+    // pairs with the fence in shm_wait_reserve: either the producer sees
+    // the new head, or this sees it asleep
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&r->producer_sleeping, memory_order_relaxed)) {
+        shm_futex_wake(&r->head);
+    }
+}
+
+uint8_t *shm_reserve(ShmChannel *ch, ShmDirection dir, uint32_t i)
+{
+    ShmRing *r = &ch->header->rings[dir];
+    const uint32_t tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+    const uint32_t head = atomic_load_explicit(&r->head, memory_order_acquire);
+    if (tail - head + i > ch->mask) {
+        return NULL;
+    }
+    return ch->slots[dir] + (size_t)((tail + i) & ch->mask) * ch->slot_bytes[dir];
+}
+
+void shm_commit(ShmChannel *ch, ShmDirection dir, uint32_t n)
+{
+    ShmRing *r = &ch->header->rings[dir];
+    const uint32_t tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+    atomic_store_explicit(&r->tail, tail + n, memory_order_release);
+
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&r->consumer_sleeping, memory_order_relaxed)) {
+        shm_futex_wake(&r->tail);
+    }
+}
+
+// Polls ready(ch, dir) up to spins times, then sleeps on the counter the
+// other side moves until it changes. sleeping is set before the last check
+// so that the other side, after moving the counter, sees it and wakes us.
+static bool shm_wait(ShmChannel *ch, ShmDirection dir, unsigned spins, bool (*ready)(ShmChannel *, ShmDirection),
+                     _Atomic uint32_t *counter, _Atomic uint32_t *sleeping)
+{
+    for (;;) {
+        for (unsigned i = 0; i <= spins; ++i) {
+            if (ready(ch, dir)) {
+                return true;
+            }
+            if (atomic_load_explicit(&ch->header->closed, memory_order_relaxed)) {
+                return false;
+            }
+            shm_pause();
+        }
+
+        atomic_store_explicit(sleeping, 1, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+        const uint32_t seen = atomic_load_explicit(counter, memory_order_relaxed);
+        if (!ready(ch, dir) && !atomic_load_explicit(&ch->header->closed, memory_order_relaxed)) {
+            shm_futex_wait(counter, seen);
+        }
+        atomic_store_explicit(sleeping, 0, memory_order_relaxed);
+    }
+}
+
+static bool shm_can_peek(ShmChannel *ch, ShmDirection dir)
+{
+    return shm_peek(ch, dir, 0) != NULL;
+}
+
+static bool shm_can_reserve(ShmChannel *ch, ShmDirection dir)
+{
+    return shm_reserve(ch, dir, 0) != NULL;
+}
+
+bool shm_wait_peek(ShmChannel *ch, ShmDirection dir, unsigned spins)
+{
+    ShmRing *r = &ch->header->rings[dir];
+    return shm_wait(ch, dir, spins, shm_can_peek, &r->tail, &r->consumer_sleeping);
+}
+
+bool shm_wait_reserve(ShmChannel *ch, ShmDirection dir, unsigned spins)
+{
+    ShmRing *r = &ch->header->rings[dir];
+    return shm_wait(ch, dir, spins, shm_can_reserve, &r->head, &r->producer_sleeping);
+}
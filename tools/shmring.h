@@ -0,0 +1,68 @@
+// Shared-memory transport of mina-signerd, for clients on the same host
+//
+// A channel is a POSIX shared memory segment (shm_open) holding two
+// single-producer single-consumer rings of fixed-size slots: requests from
+// the client to the daemon and responses back. The slots hold the frames
+// of signerd.h unchanged, so both ends parse them as they would from the
+// socket, in place.
+//
+//     * Each ring has a head (consumed) and a tail (produced) counter on
+//       its own cache line. Counters run freely and wrap; slots is a power
+//       of two, so a counter masked by slots - 1 is its slot.
+//
+//     * The consumer of a ring takes frames with shm_peek and frees them
+//       with shm_release; the producer fills slots from shm_reserve and
+//       publishes them with shm_commit. Neither call blocks or makes a
+//       system call, unless the other side is asleep.
+//
+//     * shm_wait_peek and shm_wait_reserve poll up to spins times, then
+//       sleep on the counter with a futex. spins = 0 never busy-polls.
+//
+// One client per channel: a second producer on the same ring would race.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#define SHM_RING_MAGIC 0x4d52534dU // "MSRM"
+#define SHM_RING_VERSION 1
+
+typedef enum shm_direction {
+    SHM_REQUESTS = 0,  // client to daemon
+    SHM_RESPONSES = 1, // daemon to client
+} ShmDirection;
+
+typedef struct shm_channel ShmChannel;
+
+// Creates the segment name (e.g. "/mina-signer0") with slots slots per
+// ring, replacing a segment left behind by a previous run. Returns NULL and
+// prints the reason on failure.
+ShmChannel *shm_channel_create(const char *name, uint32_t slots);
+
+// Maps a segment created by shm_channel_create. Returns NULL and prints the
+// reason on failure.
+ShmChannel *shm_channel_open(const char *name);
+
+// Unmaps the channel, and removes the segment if this side created it
+void shm_channel_destroy(ShmChannel *ch);
+
+uint32_t shm_channel_slots(const ShmChannel *ch);
+
+// Wakes both sides and makes every wait return false from now on
+void shm_channel_close(ShmChannel *ch);
+
+// The i-th unconsumed frame, or NULL if fewer than i + 1 are available
+const uint8_t *shm_peek(ShmChannel *ch, ShmDirection dir, uint32_t i);
+void shm_release(ShmChannel *ch, ShmDirection dir, uint32_t n);
+
+// The i-th free slot after the unpublished ones, or NULL if the ring has
+// fewer than i + 1 free slots
+uint8_t *shm_reserve(ShmChannel *ch, ShmDirection dir, uint32_t i);
+void shm_commit(ShmChannel *ch, ShmDirection dir, uint32_t n);
+
+// Until a frame is available (peek) or a slot is free (reserve). False
+// once the channel is closed.
+bool shm_wait_peek(ShmChannel *ch, ShmDirection dir, unsigned spins);
+bool shm_wait_reserve(ShmChannel *ch, ShmDirection dir, unsigned spins);
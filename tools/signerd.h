@@ -0,0 +1,28 @@
+// Wire protocol of mina-signerd
+//
+// A connection carries frames in both directions, each a u32 length of the
+// rest of the frame followed by its body, all little-endian. Clients may
+// send any number of requests before reading; responses come back in the
+// order the daemon finishes them, matched by id.
+//
+//     request, SIGNERD_REQUEST_BYTES
+//         0    length   u32 = SIGNERD_REQUEST_BYTES - 4
+//         4    id       u64, echoed in the response
+//         12   key      u32, index of the key in the order of -k options
+//         16   transaction record (record.h)
+//
+//     response, SIGNERD_RESPONSE_BYTES
+//         0    length   u32 = SIGNERD_RESPONSE_BYTES - 4
+//         4    id       u64
+//         12   status   u32, a MinaStatus
+//         16   signature record (record.h), zero unless status is MINA_OK
+//
+// A frame of any other length closes the connection.
+
+#pragma once
+
+#include "record.h"
+
+#define SIGNERD_HEADER_BYTES 16
+#define SIGNERD_REQUEST_BYTES (SIGNERD_HEADER_BYTES + TX_RECORD_BYTES)
+#define SIGNERD_RESPONSE_BYTES (SIGNERD_HEADER_BYTES + SIGNATURE_RECORD_BYTES)
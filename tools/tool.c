@@ -0,0 +1,101 @@
+#include "tool.h"
+#include "libbase58.h"
+#include "pasta_fp.h"
+#include "pasta_fq.h"
+
+#define PRIVATE_KEY_VERSION 0x5a
+
+int tool_b58check(const char *text, size_t text_len, uint8_t *out, size_t len)
+{
+    size_t size = len;
+    if (text_len == 0 || !b58tobin(out, &size, text, text_len) || size != len) {
+        return -1;
+    }
+    const int version = b58check(out, len, text, text_len);
+    return version < 0 ? -1 : version;
+}
+
+static bool tool_parse_private_key(const char *text, size_t len, Scalar out)
+{
+    uint64_t k[4] = { 0, 0, 0, 0 };
+
+    if (len == 64) {
+        for (size_t i = 0; i < 64; ++i) {
+            const char c = text[i];
+            uint64_t d;
+            if (c >= '0' && c <= '9') {
+                d = (uint64_t)(c - '0');
+            } else if (c >= 'a' && c <= 'f') {
+                d = (uint64_t)(c - 'a' + 10);
+            } else if (c >= 'A' && c <= 'F') {
+                d = (uint64_t)(c - 'A' + 10);
+            } else {
+                return false;
+            }
+            const size_t nibble = 63 - i;
+            k[nibble / 16] |= d << (4 * (nibble % 16));
+        }
+    } else {
+        uint8_t bytes[1 + 1 + 32 + 4];
+        if (tool_b58check(text, len, bytes, sizeof(bytes)) != PRIVATE_KEY_VERSION || bytes[1] != 0x01) {
+            return false;
+        }
+        for (size_t i = 0; i < 32; ++i) {
+            k[i / 8] |= (uint64_t)bytes[2 + i] << (8 * (i % 8));
+        }
+        memset(bytes, 0, sizeof(bytes));
+    }
+
+    // must be below the group order
+    Scalar k_montgomery;
+    uint64_t back[4];
+    fiat_pasta_fq_to_montgomery(k_montgomery, k);
+    fiat_pasta_fq_from_montgomery(back, k_montgomery);
+    const bool ok = memcmp(back, k, sizeof(k)) == 0;
+    if (ok) {
+        memcpy(out, k_montgomery, sizeof(Scalar));
+    }
+    memset(k, 0, sizeof(k));
+    memset(back, 0, sizeof(back));
+    memset(k_montgomery, 0, sizeof(k_montgomery));
+    return ok;
+}
+
+bool tool_load_key(const char *path, Keypair *kp)
+{
+    FILE *key_file = fopen(path, "r");
+    char key_text[128] = { 0 };
+    if (!key_file || !fgets(key_text, sizeof(key_text), key_file)) {
+        perror(path);
+        if (key_file) {
+            fclose(key_file);
+        }
+        return false;
+    }
+    fclose(key_file);
+
+    const size_t key_len = strcspn(key_text, " \t\r\n");
+    const bool ok = tool_parse_private_key(key_text, key_len, kp->priv);
+    memset(key_text, 0, sizeof(key_text));
+    if (!ok) {
+        fprintf(stderr, "%s: not a private key\n", path);
+        return false;
+    }
+    generate_pubkey(&kp->pub, kp->priv);
+    return true;
+}
+
+void tool_compress(Compressed *c, const Affine *pub)
+{
+    uint64_t y[4];
+    fiat_pasta_fp_from_montgomery(y, pub->y);
+    memcpy(c->x, pub->x, sizeof(Field));
+    c->is_odd = y[0] & 1;
+}
+
+bool tool_same_key(const Compressed *c, const Affine *pub)
+{
+    Compressed key;
+    tool_compress(&key, pub);
+    return memcmp(c->x, key.x, sizeof(Field)) == 0 && c->is_odd == key.is_odd;
+}
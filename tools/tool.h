@@ -0,0 +1,20 @@
+// Helpers shared by the command line tools
+
+#pragma once
+
+#include "crypto.h"
+
+// base58check of text[0, text_len) into exactly len bytes, returns the
+// version byte or -1
+int tool_b58check(const char *text, size_t text_len, uint8_t *out, size_t len);
+
+// Reads the private key on the first line of path, either base58 (EK...)
+// or 64 hex digits (big endian), and derives its public key. Prints the
+// reason and returns false on failure.
+bool tool_load_key(const char *path, Keypair *kp);
+
+// The compressed form of pub
+void tool_compress(Compressed *c, const Affine *pub);
+
+// Whether c is the compressed form of pub
+bool tool_same_key(const Compressed *c, const Affine *pub);
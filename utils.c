@@ -1,5 +1,9 @@
 #include "utils.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 // Not constant time
 void packed_bit_array_set(uint8_t *bits, size_t i, bool b) {
   size_t byte_idx = i / 8;
@@ -19,3 +23,71 @@ bool packed_bit_array_get(uint8_t *bits, size_t i) {
   return (bits[byte_idx] >> in_byte_idx) & 1;
 }
 
+
+void write_le(uint8_t *out, uint64_t x, size_t bytes) {
+  for (size_t i = 0; i < bytes; ++i) {
+    out[i] = (uint8_t)(x >> (8 * i));
+  }
+}
+
+uint64_t read_le(const uint8_t *in, size_t bytes) {
+  uint64_t x = 0;
+  for (size_t i = bytes; i > 0; --i) {
+    x = (x << 8) | in[i - 1];
+  }
+  return x;
+}
+
+static char hex_digit(uint8_t nibble) {
+  return (char)(nibble < 10 ? '0' + nibble : 'a' - 10 + nibble);
+}
+
+void hex_encode(char *out, const uint8_t *in, size_t len) {
+  size_t i = 0;
+#if defined(__SSE2__)
+  // 16 bytes at a time: each nibble plus '0', and 'a' - '0' - 10 more
+  // where it is above 9
+  const __m128i mask = _mm_set1_epi8(0x0f);
+  const __m128i nine = _mm_set1_epi8(9);
+  const __m128i zero = _mm_set1_epi8('0');
+  const __m128i letters = _mm_set1_epi8('a' - '0' - 10);
+  for (; i + 16 <= len; i += 16) {
+    const __m128i v = _mm_loadu_si128((const __m128i *)(in + i));
+    __m128i hi = _mm_and_si128(_mm_srli_epi16(v, 4), mask);
+    __m128i lo = _mm_and_si128(v, mask);
+    hi = _mm_add_epi8(_mm_add_epi8(hi, zero), _mm_and_si128(_mm_cmpgt_epi8(hi, nine), letters));
+    lo = _mm_add_epi8(_mm_add_epi8(lo, zero), _mm_and_si128(_mm_cmpgt_epi8(lo, nine), letters));
+    _mm_storeu_si128((__m128i *)(out + 2 * i), _mm_unpacklo_epi8(hi, lo));
+    _mm_storeu_si128((__m128i *)(out + 2 * i + 16), _mm_unpackhi_epi8(hi, lo));
+  }
+#endif
+  for (; i < len; ++i) {
+    out[2 * i] = hex_digit(in[i] >> 4);
+    out[2 * i + 1] = hex_digit(in[i] & 0x0f);
+  }
+}
+
+static int hex_value(char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+bool hex_decode(uint8_t *out, const char *in, size_t len) {
+  for (size_t i = 0; i < len; ++i) {
+    const int hi = hex_value(in[2 * i]);
+    const int lo = hex_value(in[2 * i + 1]);
+    if (hi < 0 || lo < 0) {
+      return false;
+    }
+    out[i] = (uint8_t)(hi << 4 | lo);
+  }
+  return true;
+}
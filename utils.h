@@ -4,3 +4,14 @@
 
 void packed_bit_array_set(uint8_t *bits, size_t i, bool b);
 bool packed_bit_array_get(uint8_t *bits, size_t i);
+
+// Little-endian integers of 1 to 8 bytes
+void write_le(uint8_t *out, uint64_t x, size_t bytes);
+uint64_t read_le(const uint8_t *in, size_t bytes);
+
+// Lowercase hex digits of in[0, len), two per byte and no terminator
+void hex_encode(char *out, const uint8_t *in, size_t len);
+
+// The len bytes written by 2 * len hex digits of either case, false if
+// one is not a hex digit
+bool hex_decode(uint8_t *out, const char *in, size_t len);
@@ -0,0 +1,283 @@
+#include <stdatomic.h>
+#include "vanity.h"
+#include "libbase58.h"
+#include "pasta_fp.h"
+#include "pasta_fq.h"
+#include "random.h"
+#include "sha256.h"
+
+// Addresses as 320-bit integers, little-endian limbs with room for the
+// bounds, which can reach 58^55 > 2^320
+#define VANITY_LIMBS 6
+#define VANITY_DIGITS (MINA_ADDRESS_LEN - 1)
+
+typedef uint64_t VanityInt[VANITY_LIMBS];
+
+typedef struct vanity_job {
+    VanityInt lo, hi; // addresses starting with the prefix are in [lo, hi)
+    uint64_t max_candidates;
+    VanityResult *result;
+    _Atomic uint64_t candidates;
+    _Atomic int found;
+} VanityJob;
+
+static int vanity_cmp(const VanityInt a, const VanityInt b)
+{
+    for (size_t i = VANITY_LIMBS; i > 0; --i) {
+        if (a[i - 1] != b[i - 1]) {
+            return a[i - 1] < b[i - 1] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+// a = a * m + d
+static void vanity_mul_add(VanityInt a, uint64_t m, uint64_t d)
+{
+    unsigned __int128 c = d;
+    for (size_t i = 0; i < VANITY_LIMBS; ++i) {
+        c += (unsigned __int128)a[i] * m;
+        a[i] = (uint64_t)c;
+        c >>= 64;
+    }
+}
+
+// r = a - b for a >= b
+static void vanity_sub(VanityInt r, const VanityInt a, const VanityInt b)
+{
+    uint64_t borrow = 0;
+    for (size_t i = 0; i < VANITY_LIMBS; ++i) {
+        const unsigned __int128 d = (unsigned __int128)a[i] - b[i] - borrow;
+        r[i] = (uint64_t)d;
+        borrow = (uint64_t)(d >> 64) & 1;
+    }
+}
+
+static double vanity_to_double(const VanityInt a)
+{
+    double r = 0;
+    for (size_t i = VANITY_LIMBS; i > 0; --i) {
+        r = r * 18446744073709551616.0 + (double)a[i - 1];
+    }
+    return r;
+}
+
+// [lo, hi) of the prefix, false if it is not base58 or too long
+static bool vanity_range(VanityInt lo, VanityInt hi, const char *prefix)
+{
+    const size_t len = strlen(prefix);
+    if (len == 0 || len > VANITY_DIGITS) {
+        return false;
+    }
+
+    memset(lo, 0, sizeof(VanityInt));
+    for (size_t i = 0; i < len; ++i) {
+        const char *digit = strchr(b58digits_ordered, prefix[i]);
+        if (!digit || !*digit) {
+            return false;
+        }
+        vanity_mul_add(lo, 58, (uint64_t)(digit - b58digits_ordered));
+    }
+
+    memcpy(hi, lo, sizeof(VanityInt));
+    vanity_mul_add(hi, 1, 1);
+    for (size_t i = len; i < VANITY_DIGITS; ++i) {
+        vanity_mul_add(lo, 58, 0);
+        vanity_mul_add(hi, 58, 0);
+    }
+    return true;
+}
+
+// Address bytes of pub as an integer, with the given checksum
+static void vanity_address_int(VanityInt v, uint8_t bytes[40], const Affine *pub, bool with_checksum, uint32_t checksum)
+{
+    uint64_t x[4], y[4];
+    fiat_pasta_fp_from_montgomery(x, pub->x);
+    fiat_pasta_fp_from_montgomery(y, pub->y);
+
+    bytes[0] = 0xcb;
+    bytes[1] = 0x01;
+    bytes[2] = 0x01;
+    for (size_t i = 0; i < 32; ++i) {
+        bytes[3 + i] = (uint8_t)(x[i / 8] >> (8 * (i % 8)));
+    }
+    bytes[35] = y[0] & 1;
+
+    if (with_checksum) {
+        uint8_t hash[SHA256_DIGEST_BYTES];
+        sha256(hash, bytes, 36);
+        sha256(hash, hash, sizeof(hash));
+        memcpy(bytes + 36, hash, 4);
+    } else {
+        bytes[36] = (uint8_t)(checksum >> 24);
+        bytes[37] = (uint8_t)(checksum >> 16);
+        bytes[38] = (uint8_t)(checksum >> 8);
+        bytes[39] = (uint8_t)checksum;
+    }
+
+    memset(v, 0, sizeof(VanityInt));
+    for (size_t i = 0; i < 40; ++i) {
+        v[(39 - i) / 8] |= (uint64_t)bytes[i] << (8 * ((39 - i) % 8));
+    }
+}
+
+static bool vanity_in_range(const VanityJob *job, const VanityInt v)
+{
+    return vanity_cmp(v, job->lo) >= 0 && vanity_cmp(v, job->hi) < 0;
+}
+
+static bool vanity_match(const VanityJob *job, const Affine *pub)
+{
+    uint8_t bytes[40];
+    VanityInt vmin, vmax;
+
+    // The checksum is the low 32 bits, so bound the address first
+    vanity_address_int(vmin, bytes, pub, false, 0);
+    memcpy(vmax, vmin, sizeof(VanityInt));
+    vmax[0] |= 0xffffffff;
+
+    if (vanity_cmp(vmax, job->lo) < 0 || vanity_cmp(vmin, job->hi) >= 0) {
+        return false;
+    }
+    if (vanity_in_range(job, vmin) && vanity_in_range(job, vmax)) {
+        return true;
+    }
+
+    VanityInt v;
+    vanity_address_int(v, bytes, pub, true, 0);
+    return vanity_in_range(job, v);
+}
+
+double vanity_expected_candidates(const char *prefix)
+{
+    VanityInt lo, hi;
+    if (!prefix || !vanity_range(lo, hi, prefix)) {
+        return 0;
+    }
+
+    // Addresses are 0xcb 0x01 0x01 followed by 37 nearly uniform bytes
+    VanityInt all_lo = { 0 }, all_hi = { 0 };
+    all_lo[4] = (uint64_t)0xcb0101 << 40;
+    all_hi[4] = (uint64_t)0xcb0102 << 40;
+
+    const uint64_t *a = vanity_cmp(lo, all_lo) > 0 ? lo : all_lo;
+    const uint64_t *b = vanity_cmp(hi, all_hi) < 0 ? hi : all_hi;
+    if (vanity_cmp(a, b) >= 0) {
+        return 0;
+    }
+
+    VanityInt overlap, all;
+    vanity_sub(overlap, b, a);
+    vanity_sub(all, all_hi, all_lo);
+    return vanity_to_double(all) / vanity_to_double(overlap);
+}
+
+typedef struct vanity_walker {
+    Scalar k;  // key of the first point of the batch
+    Group acc; // public key of k - 1
+} VanityWalker;
+
+// Random start below 2^253, so that walking never leaves [0, 2^254)
+static bool vanity_start(VanityWalker *w)
+{
+    uint64_t k_non_montgomery[4];
+    if (!random_bytes(k_non_montgomery, sizeof(k_non_montgomery))) {
+        return false;
+    }
+    k_non_montgomery[3] &= (((uint64_t)1 << 61) - 1);
+
+    Scalar k;
+    fiat_pasta_fq_to_montgomery(k, k_non_montgomery);
+    generator_scalar_mul(&w->acc, k);
+
+    Scalar one;
+    fiat_pasta_fq_set_one(one);
+    fiat_pasta_fq_add(w->k, k, one);
+    return true;
+}
+
+static int vanity_task(void *ctx, size_t begin, size_t end, size_t worker)
+{
+    VanityJob *job = ctx;
+    (void)begin;
+    (void)end;
+    (void)worker;
+
+    Scalar one;
+    Affine g;
+    fiat_pasta_fq_set_one(one);
+    generate_pubkey(&g, one);
+
+    VanityWalker w;
+    if (!vanity_start(&w)) {
+        return MINA_ERR_ENTROPY;
+    }
+
+    Group points[VANITY_BATCH];
+    Affine affine[VANITY_BATCH];
+
+    while (!atomic_load_explicit(&job->found, memory_order_relaxed)) {
+        if (job->max_candidates && atomic_load_explicit(&job->candidates, memory_order_relaxed) >= job->max_candidates) {
+            return MINA_OK;
+        }
+
+        // points[i] = (k + i) * g
+        group_madd_affine(&points[0], &w.acc, &g);
+        for (size_t i = 1; i < VANITY_BATCH; ++i) {
+            group_madd_affine(&points[i], &points[i - 1], &g);
+        }
+        w.acc = points[VANITY_BATCH - 1];
+        projective_to_affine_batch(affine, points, VANITY_BATCH);
+
+        for (size_t i = 0; i < VANITY_BATCH; ++i) {
+            if (!vanity_match(job, &affine[i])) {
+                continue;
+            }
+            if (atomic_exchange(&job->found, 1)) {
+                return MINA_OK;
+            }
+
+            Scalar offset, offset_montgomery;
+            memset(offset, 0, sizeof(offset));
+            offset[0] = i;
+            fiat_pasta_fq_to_montgomery(offset_montgomery, offset);
+            fiat_pasta_fq_add(job->result->kp.priv, w.k, offset_montgomery);
+            job->result->kp.pub = affine[i];
+            get_address(job->result->address, MINA_ADDRESS_LEN, &affine[i]);
+            atomic_fetch_add(&job->candidates, i + 1);
+            return MINA_OK;
+        }
+
+        atomic_fetch_add(&job->candidates, VANITY_BATCH);
+
+        Scalar batch, batch_montgomery;
+        memset(batch, 0, sizeof(batch));
+        batch[0] = VANITY_BATCH;
+        fiat_pasta_fq_to_montgomery(batch_montgomery, batch);
+        fiat_pasta_fq_add(w.k, w.k, batch_montgomery);
+    }
+    return MINA_OK;
+}
+
+MinaStatus vanity_search(Pool *pool, const char *prefix, uint64_t max_candidates, VanityResult *result)
+{
+    if (!pool || !prefix || !result || vanity_expected_candidates(prefix) == 0) {
+        return MINA_ERR_INVALID_PARAMETER;
+    }
+
+    VanityJob job;
+    vanity_range(job.lo, job.hi, prefix);
+    job.max_candidates = max_candidates;
+    job.result = result;
+    atomic_init(&job.candidates, 0);
+    atomic_init(&job.found, 0);
+
+    // one walker per worker
+    const int status = pool_for_status(pool, pool_threads(pool), 1, vanity_task, &job);
+
+    result->candidates = atomic_load(&job.candidates);
+    if (atomic_load(&job.found)) {
+        return MINA_OK;
+    }
+    return status != MINA_OK ? (MinaStatus)status : MINA_ERR_NOT_FOUND;
+}
@@ -0,0 +1,29 @@
+// Vanity address search
+//
+// Every worker starts at a random key k and walks k + 1, k + 2, ... by
+// adding g to the previous public key, normalizing VANITY_BATCH points
+// with one inversion. Candidates are compared with the numeric range of
+// addresses that start with the prefix, so no base58 digits are computed
+// and the checksum is only hashed when it can change the outcome.
+
+#pragma once
+
+#include "crypto.h"
+
+// Points normalized together by each worker
+#define VANITY_BATCH 256
+
+typedef struct vanity_result {
+    Keypair kp;
+    char address[MINA_ADDRESS_LEN];
+    uint64_t candidates; // tried by all workers together
+} VanityResult;
+
+// Expected number of candidates to find an address starting with prefix,
+// 0 if no address can
+double vanity_expected_candidates(const char *prefix);
+
+// Searches on every worker of the pool until an address starts with
+// prefix. Gives up with MINA_ERR_NOT_FOUND after about max_candidates,
+// 0 searches until found.
+MinaStatus vanity_search(Pool *pool, const char *prefix, uint64_t max_candidates, VanityResult *result);
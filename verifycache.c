@@ -0,0 +1,266 @@
+#include <pthread.h>
+#include "verifycache.h"
+
+#define VERIFY_CACHE_MIN_BUCKETS 256
+
+typedef struct verify_entry {
+    Affine pub;
+    struct verify_entry *next;  // in its bucket
+    struct verify_entry *newer; // in the LRU list
+    struct verify_entry *older;
+    uint32_t seen;
+    uint32_t refs;  // verifications using the table, and a build
+    bool building;
+    bool evicted;   // out of the map and the list; the last ref frees it
+    FixedBaseTable *table;
+} VerifyEntry;
+
+struct verify_cache {
+    pthread_mutex_t lock;
+    size_t budget;
+    uint32_t threshold;
+    VerifyEntry **buckets;
+    size_t mask;
+    VerifyEntry *newest;
+    VerifyEntry *oldest;
+    VerifyCacheStats stats;
+};
+
+static size_t verify_cache_hash(const VerifyCache *cache, const Affine *pub)
+{
+    return (size_t)((pub->x[0] ^ pub->y[0]) * 0x9e3779b97f4a7c15ULL >> 17) & cache->mask;
+}
+
+static VerifyEntry *verify_cache_find(VerifyCache *cache, const Affine *pub)
+{
+    for (VerifyEntry *e = cache->buckets[verify_cache_hash(cache, pub)]; e; e = e->next) {
+        if (memcmp(&e->pub, pub, sizeof(Affine)) == 0) {
+            return e;
+        }
+    }
+    return NULL;
+}
+
+static void verify_cache_unlink(VerifyCache *cache, VerifyEntry *e)
+{
+    *(e->newer ? &e->newer->older : &cache->newest) = e->older;
+    *(e->older ? &e->older->newer : &cache->oldest) = e->newer;
+    e->newer = e->older = NULL;
+}
+
+static void verify_cache_touch(VerifyCache *cache, VerifyEntry *e)
+{
+    if (cache->newest == e) {
+        return;
+    }
+    if (e->newer || e->older || cache->oldest == e) {
+        verify_cache_unlink(cache, e);
+    }
+    e->older = cache->newest;
+    *(cache->newest ? &cache->newest->newer : &cache->oldest) = e;
+    cache->newest = e;
+}
+
+static void verify_cache_free(VerifyEntry *e)
+{
+    free(e->table);
+    free(e);
+}
+
+static size_t verify_cache_bytes(const VerifyEntry *e)
+{
+    return sizeof(VerifyEntry) + (e->table ? sizeof(FixedBaseTable) : 0);
+}
+
+static void verify_cache_evict(VerifyCache *cache, VerifyEntry *e)
+{
+    VerifyEntry **link = &cache->buckets[verify_cache_hash(cache, &e->pub)];
+    while (*link != e) {
+        link = &(*link)->next;
+    }
+    *link = e->next;
+    verify_cache_unlink(cache, e);
+
+    cache->stats.bytes -= verify_cache_bytes(e);
+    cache->stats.keys -= 1;
+    cache->stats.tables -= (e->table != NULL);
+    cache->stats.evictions += 1;
+    if (e->refs == 0) {
+        verify_cache_free(e);
+    } else {
+        e->evicted = true;
+    }
+}
+
+// Evicts the least recently used keys other than keep until bytes more
+// fit, false if they cannot
+static bool verify_cache_make_room(VerifyCache *cache, size_t bytes, const VerifyEntry *keep)
+{
+    VerifyEntry *e = cache->oldest;
+    while (cache->stats.bytes + bytes > cache->budget && e) {
+        VerifyEntry *newer = e->newer;
+        if (e != keep) {
+            verify_cache_evict(cache, e);
+        }
+        e = newer;
+    }
+    return cache->stats.bytes + bytes <= cache->budget;
+}
+
+// Doubles the buckets once there are two keys per bucket; keeps the old
+// ones if out of memory
+static void verify_cache_rehash(VerifyCache *cache)
+{
+    if (cache->stats.keys <= 2 * (cache->mask + 1)) {
+        return;
+    }
+    const size_t count = 2 * (cache->mask + 1);
+    VerifyEntry **buckets = calloc(count, sizeof(VerifyEntry *));
+    if (!buckets) {
+        return;
+    }
+    VerifyEntry **old = cache->buckets;
+    const size_t old_count = cache->mask + 1;
+    cache->buckets = buckets;
+    cache->mask = count - 1;
+    for (size_t i = 0; i < old_count; ++i) {
+        while (old[i]) {
+            VerifyEntry *e = old[i];
+            old[i] = e->next;
+            VerifyEntry **bucket = &cache->buckets[verify_cache_hash(cache, &e->pub)];
+            e->next = *bucket;
+            *bucket = e;
+        }
+    }
+    free(old);
+}
+
+static VerifyEntry *verify_cache_insert(VerifyCache *cache, const Affine *pub)
+{
+    if (!verify_cache_make_room(cache, sizeof(VerifyEntry), NULL)) {
+        return NULL;
+    }
+    VerifyEntry *e = calloc(1, sizeof(VerifyEntry));
+    if (!e) {
+        return NULL;
+    }
+    e->pub = *pub;
+    VerifyEntry **bucket = &cache->buckets[verify_cache_hash(cache, pub)];
+    e->next = *bucket;
+    *bucket = e;
+    cache->stats.bytes += sizeof(VerifyEntry);
+    cache->stats.keys += 1;
+    verify_cache_rehash(cache);
+    return e;
+}
+
+static void verify_cache_release(VerifyEntry *e)
+{
+    e->refs -= 1;
+    if (e->evicted && e->refs == 0) {
+        verify_cache_free(e);
+    }
+}
+
+VerifyCache *verify_cache_create(size_t budget_bytes, uint32_t threshold)
+{
+    VerifyCache *cache = calloc(1, sizeof(VerifyCache));
+    VerifyEntry **buckets = calloc(VERIFY_CACHE_MIN_BUCKETS, sizeof(VerifyEntry *));
+    if (!cache || !buckets || pthread_mutex_init(&cache->lock, NULL) != 0) {
+        free(cache);
+        free(buckets);
+        return NULL;
+    }
+    cache->budget = budget_bytes;
+    cache->threshold = threshold;
+    cache->buckets = buckets;
+    cache->mask = VERIFY_CACHE_MIN_BUCKETS - 1;
+    return cache;
+}
+
+void verify_cache_destroy(VerifyCache *cache)
+{
+    if (!cache) {
+        return;
+    }
+    while (cache->oldest) {
+        verify_cache_evict(cache, cache->oldest);
+    }
+    free(cache->buckets);
+    pthread_mutex_destroy(&cache->lock);
+    free(cache);
+}
+
+MinaStatus verify_cache_verify(VerifyCache *cache, const Signature *sig, const Affine *pub,
+                               const Transaction *transaction)
+{
+    if (!cache || !sig || !pub || !transaction) {
+        return MINA_ERR_INVALID_PARAMETER;
+    }
+    if (!affine_is_on_curve(pub)) {
+        return MINA_ERR_INVALID_POINT;
+    }
+
+    pthread_mutex_lock(&cache->lock);
+    cache->stats.verifications += 1;
+    VerifyEntry *e = verify_cache_find(cache, pub);
+    if (!e) {
+        e = verify_cache_insert(cache, pub);
+    }
+
+    FixedBaseTable *table = NULL;
+    bool build = false;
+    if (e) {
+        verify_cache_touch(cache, e);
+        e->seen += (e->seen < UINT32_MAX);
+        if (e->table) {
+            table = e->table;
+            e->refs += 1;
+        } else if (e->seen > cache->threshold && !e->building
+                   && sizeof(VerifyEntry) + sizeof(FixedBaseTable) <= cache->budget) {
+            e->building = true;
+            e->refs += 1;
+            build = true;
+        }
+    }
+    pthread_mutex_unlock(&cache->lock);
+
+    // about a thousand group operations, so other keys go on meanwhile
+    if (build) {
+        FixedBaseTable *built = malloc(sizeof(FixedBaseTable));
+        if (built) {
+            fixed_base_table_init(built, pub);
+        }
+
+        pthread_mutex_lock(&cache->lock);
+        e->building = false;
+        if (built && !e->evicted && verify_cache_make_room(cache, sizeof(FixedBaseTable), e)) {
+            e->table = table = built;
+            cache->stats.bytes += sizeof(FixedBaseTable);
+            cache->stats.tables += 1;
+            cache->stats.tables_built += 1;
+        } else {
+            free(built);
+            verify_cache_release(e);
+        }
+        pthread_mutex_unlock(&cache->lock);
+    }
+
+    if (!table) {
+        return verify(sig, pub, transaction);
+    }
+
+    const MinaStatus status = verify_fixed_base(sig, pub, table, transaction);
+    pthread_mutex_lock(&cache->lock);
+    cache->stats.table_hits += 1;
+    verify_cache_release(e);
+    pthread_mutex_unlock(&cache->lock);
+    return status;
+}
+
+void verify_cache_stats(VerifyCache *cache, VerifyCacheStats *stats)
+{
+    pthread_mutex_lock(&cache->lock);
+    *stats = cache->stats;
+    pthread_mutex_unlock(&cache->lock);
+}
@@ -0,0 +1,41 @@
+// Opt-in cache of fixed-base tables for public keys that sign often
+//
+//     * verify_cache_verify counts the signatures of each public key it
+//       sees. Once a key has been seen more than threshold times, it
+//       builds the key's FixedBaseTable, and later signatures of the key
+//       verify with verify_fixed_base instead of a variable-base multiply.
+//
+//     * Counts and tables together stay within budget bytes: the least
+//       recently used keys are evicted to make room.
+//
+//     * Safe to share between threads. A mutex guards the map and the LRU
+//       list only; tables are built and used outside it, and an evicted
+//       table is freed by its last user.
+
+#pragma once
+
+#include "crypto.h"
+
+typedef struct verify_cache VerifyCache;
+
+typedef struct verify_cache_stats {
+    uint64_t verifications;
+    uint64_t table_hits;   // verifications that used a table
+    uint64_t tables_built;
+    uint64_t evictions;    // keys evicted, with or without a table
+    size_t keys;
+    size_t tables;
+    size_t bytes;          // counted against the budget
+} VerifyCacheStats;
+
+// NULL if out of memory. A budget below one table only counts.
+VerifyCache *verify_cache_create(size_t budget_bytes, uint32_t threshold);
+
+// No verification may be running
+void verify_cache_destroy(VerifyCache *cache);
+
+// verify, through the cache
+MinaStatus verify_cache_verify(VerifyCache *cache, const Signature *sig, const Affine *pub,
+                               const Transaction *transaction);
+
+void verify_cache_stats(VerifyCache *cache, VerifyCacheStats *stats);